@@ -25,6 +25,9 @@ typedef struct _dma_instance_info {
  */
 typedef struct _dma_channel_context {
     bool is_allocated;                               /**< Whether DMA channel was allocated */
+    DMA_Type *base;                                  /**< DMA instance of the channel */
+    uint32_t instance;                               /**< DMA instance index */
+    uint32_t channel;                                /**< Channel index */
     void *tc_cb_data_ptr;                            /**< User data required by transfer complete callback */
     void *half_tc_cb_data_ptr;                       /**< User data required by half transfer complete callback */
     void *error_cb_data_ptr;                         /**< User data required by error callback */
@@ -41,9 +44,16 @@ typedef struct _dma_channel_context {
  */
 typedef struct _dma_mgr_context {
     dma_chn_info_t dma_instance[DMA_SOC_MAX_COUNT];                                  /**< DMA instances */
+    uint32_t free_chn_mask[DMA_SOC_MAX_COUNT];                                       /**< Bit n set if channel n is free */
     dma_chn_context_t channels[DMA_SOC_MAX_COUNT][DMA_SOC_CHANNEL_NUM];              /**< Array of DMA channels */
 } dma_mgr_context_t;
 
+#if DMA_SOC_CHANNEL_NUM >= 32
+#define DMA_MGR_ALL_CHANNELS_MASK (0xFFFFFFFFUL)
+#else
+#define DMA_MGR_ALL_CHANNELS_MASK ((1UL << DMA_SOC_CHANNEL_NUM) - 1UL)
+#endif
+
 
 /*****************************************************************************************************************
  *
@@ -62,6 +72,18 @@ static dma_chn_context_t *dma_mgr_search_chn_context(const dma_resource_t *resou
 static uint32_t dma_mgr_enter_critical(void);
 static void dma_mgr_exit_critical(uint32_t level);
 
+/**
+ * @brief Get and clear the pending interrupt status of all the channels of a DMA instance
+ *
+ * @param [in] ptr DMA base address
+ * @param [out] tc_stat bit n set if channel n completed its transfer
+ * @param [out] half_tc_stat bit n set if channel n completed half of its transfer
+ * @param [out] error_stat bit n set if channel n stopped on an error
+ * @param [out] abort_stat bit n set if channel n was aborted
+ */
+static void dma_mgr_get_and_clear_irq_status(DMA_Type *ptr, uint32_t *tc_stat, uint32_t *half_tc_stat,
+                                             uint32_t *error_stat, uint32_t *abort_stat);
+
 /*****************************************************************************************************************
  *
  *  Variables
@@ -75,33 +97,71 @@ static dma_mgr_context_t s_dma_mngr_ctx;
  *  Codes
  *
  *****************************************************************************************************************/
+static void dma_mgr_get_and_clear_irq_status(DMA_Type *ptr, uint32_t *tc_stat, uint32_t *half_tc_stat,
+                                             uint32_t *error_stat, uint32_t *abort_stat)
+{
+#ifdef HPMSOC_HAS_HPMSDK_DMAV2
+    *tc_stat = ptr->INTTCSTS & DMA_MGR_ALL_CHANNELS_MASK;
+    *half_tc_stat = ptr->INTHALFSTS & DMA_MGR_ALL_CHANNELS_MASK;
+    *error_stat = ptr->INTERRSTS & DMA_MGR_ALL_CHANNELS_MASK;
+    *abort_stat = ptr->INTABORTSTS & DMA_MGR_ALL_CHANNELS_MASK;
+    /* W1C, only the bits read above so that new events are not lost */
+    ptr->INTTCSTS = *tc_stat;
+    ptr->INTHALFSTS = *half_tc_stat;
+    ptr->INTERRSTS = *error_stat;
+    ptr->INTABORTSTS = *abort_stat;
+#else
+    uint32_t int_stat = ptr->INTSTATUS;
+
+    *tc_stat = (int_stat >> DMA_STATUS_TC_SHIFT) & DMA_MGR_ALL_CHANNELS_MASK;
+    *half_tc_stat = 0;
+    *error_stat = (int_stat >> DMA_STATUS_ERROR_SHIFT) & DMA_MGR_ALL_CHANNELS_MASK;
+    *abort_stat = (int_stat >> DMA_STATUS_ABORT_SHIFT) & DMA_MGR_ALL_CHANNELS_MASK;
+    /* W1C, only the bits read above so that new events are not lost */
+    ptr->INTSTATUS = DMA_CHANNEL_IRQ_STATUS_GET_ALL_TC(int_stat) | DMA_CHANNEL_IRQ_STATUS_GET_ALL_ERROR(int_stat) |
+                     DMA_CHANNEL_IRQ_STATUS_GET_ALL_ABORT(int_stat);
+#endif
+}
+
 void dma_mgr_isr_handler(DMA_Type *ptr, uint32_t instance)
 {
     uint32_t int_disable_mask;
-    uint32_t chn_int_stat;
+    uint32_t tc_stat;
+    uint32_t half_tc_stat;
+    uint32_t error_stat;
+    uint32_t abort_stat;
+    uint32_t pending;
+    uint32_t chn_mask;
     dma_chn_context_t *chn_ctx;
 
-    for (uint8_t channel = 0; channel < DMA_SOC_CHANNEL_NUM; channel++) {
+    /* read the status of all the channels at once and only visit the channels with a pending event */
+    dma_mgr_get_and_clear_irq_status(ptr, &tc_stat, &half_tc_stat, &error_stat, &abort_stat);
+    pending = tc_stat | half_tc_stat | error_stat | abort_stat;
+
+    for (uint32_t channel = 0; pending != 0U; channel++, pending >>= 1U) {
+        if ((pending & 1U) == 0U) {
+            continue;
+        }
+        chn_mask = 1UL << channel;
         int_disable_mask = dma_check_channel_interrupt_mask(ptr, channel);
-        chn_int_stat = dma_check_transfer_status(ptr, channel);
         chn_ctx = &HPM_DMA_MGR->channels[instance][channel];
 
-        if (((int_disable_mask & DMA_MGR_INTERRUPT_MASK_TC) == 0) && ((chn_int_stat & DMA_MGR_CHANNEL_STATUS_TC) != 0)) {
+        if (((int_disable_mask & DMA_MGR_INTERRUPT_MASK_TC) == 0) && ((tc_stat & chn_mask) != 0)) {
             if (chn_ctx->tc_cb != NULL) {
                 chn_ctx->tc_cb(ptr, channel, chn_ctx->tc_cb_data_ptr);
             }
         }
-        if (((int_disable_mask & DMA_MGR_INTERRUPT_MASK_HALF_TC) == 0) && ((chn_int_stat & DMA_MGR_CHANNEL_STATUS_HALF_TC) != 0)) {
+        if (((int_disable_mask & DMA_MGR_INTERRUPT_MASK_HALF_TC) == 0) && ((half_tc_stat & chn_mask) != 0)) {
             if (chn_ctx->half_tc_cb != NULL) {
                 chn_ctx->half_tc_cb(ptr, channel, chn_ctx->half_tc_cb_data_ptr);
             }
         }
-        if (((int_disable_mask & DMA_MGR_INTERRUPT_MASK_ERROR) == 0) && ((chn_int_stat & DMA_MGR_CHANNEL_STATUS_ERROR) != 0)) {
+        if (((int_disable_mask & DMA_MGR_INTERRUPT_MASK_ERROR) == 0) && ((error_stat & chn_mask) != 0)) {
             if (chn_ctx->error_cb != NULL) {
                 chn_ctx->error_cb(ptr, channel, chn_ctx->error_cb_data_ptr);
             }
         }
-        if (((int_disable_mask & DMA_MGR_INTERRUPT_MASK_ABORT) == 0) && ((chn_int_stat & DMA_MGR_CHANNEL_STATUS_ABORT) != 0)) {
+        if (((int_disable_mask & DMA_MGR_INTERRUPT_MASK_ABORT) == 0) && ((abort_stat & chn_mask) != 0)) {
             if (chn_ctx->abort_cb != NULL) {
                 chn_ctx->abort_cb(ptr, channel, chn_ctx->abort_cb_data_ptr);
             }
@@ -142,6 +202,14 @@ void dma_mgr_init(void)
     HPM_DMA_MGR->dma_instance[1].base = HPM_XDMA;
     HPM_DMA_MGR->dma_instance[1].irq_num = IRQn_XDMA;
  #endif
+    for (uint32_t instance = 0; instance < DMA_SOC_MAX_COUNT; instance++) {
+        HPM_DMA_MGR->free_chn_mask[instance] = DMA_MGR_ALL_CHANNELS_MASK;
+        for (uint32_t channel = 0; channel < DMA_SOC_CHANNEL_NUM; channel++) {
+            HPM_DMA_MGR->channels[instance][channel].base = HPM_DMA_MGR->dma_instance[instance].base;
+            HPM_DMA_MGR->channels[instance][channel].instance = instance;
+            HPM_DMA_MGR->channels[instance][channel].channel = channel;
+        }
+    }
 }
 
 hpm_stat_t dma_mgr_request_resource(dma_resource_t *resource)
@@ -152,22 +220,23 @@ hpm_stat_t dma_mgr_request_resource(dma_resource_t *resource)
         status = status_invalid_argument;
     } else {
         uint32_t instance;
-        uint32_t channel;
-        bool has_found = false;
+        uint32_t channel = 0;
+        uint32_t free_mask = 0;
         uint32_t level = dma_mgr_enter_critical();
         for (instance = 0; instance < DMA_SOC_MAX_COUNT; instance++) {
-            for (channel = 0; channel < DMA_SOC_CHANNEL_NUM; channel++) {
-                if (!HPM_DMA_MGR->channels[instance][channel].is_allocated) {
-                    has_found = true;
-                    break;
-                }
-            }
-            if (has_found) {
+            free_mask = HPM_DMA_MGR->free_chn_mask[instance];
+            if (free_mask != 0U) {
                 break;
             }
         }
 
-        if (has_found) {
+        if (free_mask != 0U) {
+            /* lowest free channel, isolated as the lowest set bit of the mask */
+            free_mask &= ~(free_mask - 1U);
+            while ((free_mask >> channel) != 1U) {
+                channel++;
+            }
+            HPM_DMA_MGR->free_chn_mask[instance] &= ~free_mask;
             HPM_DMA_MGR->channels[instance][channel].is_allocated = true;
             resource->base = HPM_DMA_MGR->dma_instance[instance].base;
             resource->channel = channel;
@@ -188,20 +257,16 @@ static dma_chn_context_t *dma_mgr_search_chn_context(const dma_resource_t *resou
     dma_chn_context_t *chn_ctx = NULL;
 
     if ((resource != NULL) && (resource->channel < DMA_SOC_CHANNEL_NUM)) {
-        uint32_t instance;
-        uint32_t channel;
-        bool has_found = false;
-        for (instance = 0; instance < DMA_SOC_MAX_COUNT; instance++) {
-            if (resource->base == HPM_DMA_MGR->dma_instance[instance].base) {
-                has_found = true;
-                break;
-            }
+        uint32_t instance = 0;
+#if defined(DMA_SOC_MAX_COUNT) && (DMA_SOC_MAX_COUNT > 1)
+        if (resource->base != HPM_DMA_MGR->dma_instance[0].base) {
+            instance = 1;
         }
-
-        channel = resource->channel;
-        if (has_found) {
-            if (HPM_DMA_MGR->channels[instance][channel].is_allocated) {
-                chn_ctx = &HPM_DMA_MGR->channels[instance][channel];
+#endif
+        if (resource->base == HPM_DMA_MGR->dma_instance[instance].base) {
+            chn_ctx = &HPM_DMA_MGR->channels[instance][resource->channel];
+            if (!chn_ctx->is_allocated) {
+                chn_ctx = NULL;
             }
         }
     }
@@ -209,6 +274,29 @@ static dma_chn_context_t *dma_mgr_search_chn_context(const dma_resource_t *resou
     return chn_ctx;
 }
 
+dma_mgr_chn_handle_t dma_mgr_get_chn_handle(const dma_resource_t *resource)
+{
+    return dma_mgr_search_chn_context(resource);
+}
+
+hpm_stat_t dma_mgr_restart_chn_transfer(dma_mgr_chn_handle_t handle, uint32_t src_addr, uint32_t dst_addr, uint32_t size)
+{
+    hpm_stat_t status;
+
+    if ((handle == NULL) || !handle->is_allocated) {
+        status = status_invalid_argument;
+    } else {
+        uint32_t level = dma_mgr_enter_critical();
+        dma_clear_transfer_status(handle->base, handle->channel);
+        dma_set_source_address(handle->base, handle->channel, src_addr);
+        dma_set_destination_address(handle->base, handle->channel, dst_addr);
+        dma_set_transfer_size(handle->base, handle->channel, size);
+        status = dma_enable_channel(handle->base, handle->channel);
+        dma_mgr_exit_critical(level);
+    }
+    return status;
+}
+
 hpm_stat_t dma_mgr_release_resource(const dma_resource_t *resource)
 {
     hpm_stat_t status;
@@ -220,6 +308,7 @@ hpm_stat_t dma_mgr_release_resource(const dma_resource_t *resource)
     } else {
         uint32_t level = dma_mgr_enter_critical();
         chn_ctx->is_allocated = false;
+        HPM_DMA_MGR->free_chn_mask[chn_ctx->instance] |= 1UL << chn_ctx->channel;
         chn_ctx->tc_cb_data_ptr = NULL;
         chn_ctx->half_tc_cb_data_ptr = NULL;
         chn_ctx->error_cb_data_ptr = NULL;
@@ -169,6 +169,14 @@ typedef struct hpm_dma_mgr_linked_descriptor {
     uint32_t descriptor[8];
 } dma_mgr_linked_descriptor_t;
 
+/**
+ * @brief DMA channel handle
+ *
+ * Direct reference to the context of an allocated channel, see dma_mgr_get_chn_handle.
+ * It is valid until the resource is released.
+ */
+typedef struct _dma_channel_context *dma_mgr_chn_handle_t;
+
 /**
  * @brief DMA Manager ISR handler
  */
@@ -199,6 +207,35 @@ hpm_stat_t dma_mgr_request_resource(dma_resource_t *resource);
  */
 hpm_stat_t dma_mgr_release_resource(const dma_resource_t *resource);
 
+/**
+ * @brief Get the handle of an allocated DMA channel
+ *
+ * The handle refers to the channel context directly, the functions taking it do not search
+ * the context of the resource on each call. Use it on hot paths that restart transfers.
+ *
+ * @param [in] resource DMA resource
+ * @return channel handle, or NULL if the resource is invalid or not allocated
+ */
+dma_mgr_chn_handle_t dma_mgr_get_chn_handle(const dma_resource_t *resource);
+
+/**
+ * @brief Reconfigure the addresses and the size of a DMA channel and restart its transfer
+ *
+ * The pending status of the channel is cleared and the source address, the destination address,
+ * the transfer size and the channel enable are written in a single critical section. The other
+ * settings, such as the widths and the address controls, are kept.
+ *
+ * @param [in] handle channel handle
+ * @param [in] src_addr source address
+ * @param [in] dst_addr destination address
+ * @param [in] size transfer size of the channel, in source width units as dma_mgr_set_chn_transize
+ *
+ * @retval status_success if no error occurred
+ * @retval status_invalid_argument if the handle is invalid
+ * @retval status_fail if the channel could not be enabled
+ */
+hpm_stat_t dma_mgr_restart_chn_transfer(dma_mgr_chn_handle_t handle, uint32_t src_addr, uint32_t dst_addr, uint32_t size);
+
 /**
  * @brief Enable DMA interrupt with priority
  * @param [in] resource DMA resource
@@ -5,6 +5,7 @@
  *
  */
 
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -12,31 +13,125 @@
 #include "eeprom_emulation.h"
 #include "hpm_crc32.h"
 
-#define E2P_OFFSET(TYPE, MEMBER) ((uint32_t)(&(((TYPE *)0)->MEMBER)))
-#define E2P_SWAP(a, b)\
-do {\
-    uint32_t tmp = (a);\
-    (a) = (b);\
-    (b) = tmp;\
-} while (0)
+#define E2P_OFFSET(TYPE, MEMBER) ((uint32_t)offsetof(TYPE, MEMBER))
+
+/* open addressing index on block_id, slot holds (info table position + 1), 0 means empty */
+#define E2P_INDEX_SIZE          (E2P_MAX_VAR_CNT * 2 + 1)
+#define E2P_INDEX_HASH_MUL      (0x9E3779B1UL)
+
+#if E2P_MAX_VAR_CNT > 0x7FFE
+#error "E2P_MAX_VAR_CNT is too large for the 16bit block index"
+#endif
+
+#define E2P_BLANK_CHECK_SIZE    (32)
+
+enum {
+    e2p_gc_idle = 0,
+    e2p_gc_copy,
+    e2p_gc_erase,
+    e2p_gc_stopped,
+};
+
+/*
+ * Incremental compaction of one area into the other:
+ * copy - live blocks still in src are moved to the active area, a bounded batch per step,
+ *        new writes already go to the active area
+ * erase - src is erased one sector per step, then the active area is marked valid
+ * stopped - a copy failed, src is left intact and holds the blocks not moved yet, the
+ *        compaction is resumed by the next mount
+ */
+typedef struct {
+    uint8_t phase;
+    e2p_t *src;
+    uint32_t cursor;
+    uint32_t erase_addr;
+    uint32_t pending;
+} e2p_gc_t;
 
 static e2p_t e2p_dummy;
 static e2p_t *e2p_raw, *e2p_valid_ctx;
 static e2p_block e2p_info_table[E2P_MAX_VAR_CNT];
+static uint16_t e2p_index[E2P_INDEX_SIZE];
+static uint32_t e2p_info_count;
+static uint32_t e2p_live_size;
+static e2p_gc_t e2p_gc;
+
+E2P_ATTR
+static inline uint32_t e2p_index_slot(uint32_t block_id)
+{
+    uint32_t hash = block_id * E2P_INDEX_HASH_MUL;
+
+    /* map hash onto [0, E2P_INDEX_SIZE) without division */
+    return (uint32_t)(((uint64_t)hash * E2P_INDEX_SIZE) >> 32);
+}
+
+/* return the slot holding block_id, or the empty slot where it should be inserted */
+E2P_ATTR
+static uint32_t e2p_index_probe(uint32_t block_id)
+{
+    uint32_t slot = e2p_index_slot(block_id);
+
+    while (e2p_index[slot] != 0) {
+        if (e2p_info_table[e2p_index[slot] - 1].block_id == block_id)
+            break;
+        if (++slot == E2P_INDEX_SIZE)
+            slot = 0;
+    }
+
+    return slot;
+}
+
+E2P_ATTR
+static void e2p_index_reset(void)
+{
+    memset(e2p_index, 0, sizeof(e2p_index));
+    e2p_info_count = 0;
+    e2p_live_size = 0;
+}
+
+E2P_ATTR
+static inline uint32_t e2p_area_end(e2p_t *e2p)
+{
+    return e2p->config.start_addr + e2p->config.sector_cnt * e2p->config.erase_size;
+}
+
+E2P_ATTR
+static inline uint32_t e2p_area_capacity(e2p_t *e2p)
+{
+    return e2p->config.sector_cnt * e2p->config.erase_size - sizeof(e2p_block) - sizeof(e2p_header);
+}
+
+E2P_ATTR
+static inline bool e2p_area_contains(e2p_t *e2p, uint32_t addr)
+{
+    return (addr >= e2p->config.start_addr) && (addr < e2p_area_end(e2p));
+}
+
+E2P_ATTR
+static void e2p_area_reset(e2p_t *e2p)
+{
+    e2p->p_data = e2p->config.start_addr;
+    e2p->p_info = e2p_area_end(e2p) - sizeof(e2p_block) - sizeof(e2p_header);
+    e2p->remain_size = e2p->p_info - e2p->p_data;
+}
+
+E2P_ATTR
+static void e2p_set_state(e2p_t *e2p, uint32_t state)
+{
+    e2p_config_t *cfg = &e2p->config;
+
+    E2P_CRITICAL_ENTER();
+    cfg->flash_write((uint8_t *)&state, e2p_area_end(e2p) - sizeof(uint32_t), sizeof(uint32_t));
+    E2P_CRITICAL_EXIT();
+}
 
 E2P_ATTR
 static void e2p_print_info(e2p_t *e2p)
 {
     uint32_t info_count;
-    uint32_t valid_count = E2P_MAX_VAR_CNT;
+    uint32_t valid_count = e2p_info_count;
 
     info_count = (e2p->config.start_addr + e2p->config.sector_cnt * e2p->config.erase_size - e2p->p_info - sizeof(e2p_header)) / sizeof(e2p_block) - 1;
-    for (int i = 0; i < E2P_MAX_VAR_CNT; i++) {
-        if (e2p_info_table[i].block_id == E2P_EARSED_ID) {
-            valid_count = i;
-            break;
-        }
-    }
 
     e2p_info("------------ flash->eeprom init ok -----------");
     e2p_info("start address: 0x%08x", e2p->config.start_addr);
@@ -57,35 +152,46 @@ static void e2p_print_info(e2p_t *e2p)
 E2P_ATTR
 static hpm_stat_t e2p_table_update(e2p_block *block)
 {
-    uint32_t i = 0;
+    uint32_t i;
+    uint32_t slot;
 
-    if (block->valid_state == e2p_invalid)
+    /* only committed blocks are visible */
+    if (block->valid_state != e2p_valid)
         return E2P_STATUS_OK;
 
-    for ( ; i < E2P_MAX_VAR_CNT; i++) {
-        if (e2p_info_table[i].block_id == E2P_EARSED_ID)
-            break;
-        if (e2p_info_table[i].block_id == block->block_id) {
-            e2p_trace("block_id[0x%08x] multiple write, flush api solve repeat\n", block->block_id);
-            break;
-        }
+    slot = e2p_index_probe(block->block_id);
+    if (e2p_index[slot] != 0) {
+        i = e2p_index[slot] - 1;
+        e2p_trace("block_id[0x%08x] multiple write, flush api solve repeat\n", block->block_id);
+        e2p_live_size -= e2p_info_table[i].length;
+        /* superseded before compaction reached it, nothing left to move */
+        if ((e2p_gc.phase == e2p_gc_copy) && e2p_area_contains(e2p_gc.src, e2p_info_table[i].data_addr))
+            e2p_gc.pending -= e2p_info_table[i].length + sizeof(e2p_block);
+    } else {
+        if (e2p_info_count == E2P_MAX_VAR_CNT)
+            return E2P_ERROR_MUL_VAR;
+        i = e2p_info_count++;
+        e2p_index[slot] = (uint16_t)(i + 1);
+        e2p_live_size += sizeof(e2p_block);
     }
 
-    if (i == E2P_MAX_VAR_CNT)
-        return E2P_ERROR_MUL_VAR;
-
+    e2p_live_size += block->length;
     memcpy(&e2p_info_table[i], block, sizeof(e2p_block));
     return E2P_STATUS_OK;
 }
 
+/* erase one sector at a time so interrupts are only held off for a single erase */
 E2P_ATTR
 static void e2p_format(e2p_t *e2p)
 {
     e2p_config_t *cfg = &e2p->config;
+    uint32_t end_addr = e2p_area_end(e2p);
 
-    E2P_CRITICAL_ENTER();
-    cfg->flash_erase(cfg->start_addr, cfg->sector_cnt * cfg->erase_size);
-    E2P_CRITICAL_EXIT();
+    for (uint32_t addr = cfg->start_addr; addr < end_addr; addr += cfg->erase_size) {
+        E2P_CRITICAL_ENTER();
+        cfg->flash_erase(addr, cfg->erase_size);
+        E2P_CRITICAL_EXIT();
+    }
 }
 
 E2P_ATTR
@@ -112,28 +218,35 @@ static uint32_t e2p_data_crc_calc(uint16_t length, uint8_t *data)
 E2P_ATTR
 static hpm_stat_t e2p_retrieve_info(uint32_t block_id, e2p_block *block)
 {
-    int i = 0;
+    uint32_t i;
 
     if (block_id == E2P_EARSED_ID)
         return E2P_ERROR_BAD_ID;
 
-    for ( ; i < E2P_MAX_VAR_CNT; i++) {
-        if (e2p_info_table[i].block_id == block_id) {
-            e2p_trace("find read block, pos at table[%u]\n", i);
-            memcpy(block, &e2p_info_table[i], sizeof(e2p_block));
-            break;
-        }
-    }
+    i = e2p_index[e2p_index_probe(block_id)];
+    if (i == 0)
+        return E2P_ERROR_BAD_ID;
 
-    return (i == E2P_MAX_VAR_CNT ? E2P_ERROR_BAD_ID : E2P_STATUS_OK);
+    e2p_trace("find read block, pos at table[%u]\n", i - 1);
+    memcpy(block, &e2p_info_table[i - 1], sizeof(e2p_block));
+    return E2P_STATUS_OK;
 }
 
+/*
+ * Power-fail safe append:
+ * 1. info block with valid_state erased, reserves the slot and the data range
+ * 2. data
+ * 3. valid_state programmed to e2p_valid, commits the block
+ * A block interrupted before step 3 is ignored when the area is mounted.
+ */
 E2P_ATTR
 static hpm_stat_t e2p_write_private(e2p_t *e2p, uint32_t block_id, uint16_t length, uint8_t *data)
 {
     int ret = 0;
     e2p_block block;
     e2p_config_t *cfg = &e2p->config;
+    uint32_t info_addr = e2p->p_info;
+    uint16_t commit = e2p_valid;
 
     if (e2p->remain_size < length + sizeof(e2p_block)) {
         e2p_trace("no enough flash\n");
@@ -143,28 +256,38 @@ static hpm_stat_t e2p_write_private(e2p_t *e2p, uint32_t block_id, uint16_t leng
     block.block_id = block_id;
     block.data_addr = e2p->p_data;
     block.length = length;
-    block.valid_state = e2p_valid;
+    block.valid_state = e2p_earsed;
     block.crc = e2p_data_crc_calc(length, data);
 
+    /* slot and data range are consumed even if programming fails below */
+    e2p->p_data += length;
+    e2p->p_info -= sizeof(e2p_block);
+    e2p->remain_size -= length + sizeof(e2p_block);
+
     E2P_CRITICAL_ENTER();
-    ret = cfg->flash_write(data, e2p->p_data, length);
+    ret = cfg->flash_write((uint8_t *)&block, info_addr, sizeof(e2p_block));
+    E2P_CRITICAL_EXIT();
+    if (E2P_STATUS_OK != ret) {
+        e2p_trace("flash write info error\n");
+        return E2P_ERROR;
+    }
+
+    E2P_CRITICAL_ENTER();
+    ret = cfg->flash_write(data, block.data_addr, length);
     E2P_CRITICAL_EXIT();
     if (E2P_STATUS_OK != ret) {
         e2p_trace("flash write data error\n");
         return E2P_ERROR;
     }
-    e2p->p_data += length;
-    e2p->remain_size -= length;
 
     E2P_CRITICAL_ENTER();
-    ret = cfg->flash_write((uint8_t *)&block, e2p->p_info, sizeof(e2p_block));
+    ret = cfg->flash_write((uint8_t *)&commit, info_addr + E2P_OFFSET(e2p_block, valid_state), sizeof(commit));
     E2P_CRITICAL_EXIT();
     if (E2P_STATUS_OK != ret) {
-        e2p_trace("flash write info error\n");
+        e2p_trace("flash write commit error\n");
         return E2P_ERROR;
     }
-    e2p->p_info -= sizeof(e2p_block);
-    e2p->remain_size -= sizeof(e2p_block);
+    block.valid_state = e2p_valid;
 
     ret = e2p_table_update(&block);
     if (E2P_STATUS_OK != ret)
@@ -175,39 +298,6 @@ static hpm_stat_t e2p_write_private(e2p_t *e2p, uint32_t block_id, uint16_t leng
     return E2P_STATUS_OK;
 }
 
-E2P_ATTR
-static int e2p_info_table_sort(void)
-{
-    int count = 0;
-    e2p_block block;
-
-    do {
-        if (e2p_info_table[count].block_id == E2P_EARSED_ID) {
-            break;
-        }
-        count++;
-    } while (count < E2P_MAX_VAR_CNT);
-
-    if (count == 0)
-        return count;
-
-    for (int i = 0; i < count; i++) {
-        memcpy(&block, &e2p_info_table[i], sizeof(e2p_block));
-        for (int j = i + 1; j < count; j++) {
-            if (e2p_info_table[j].data_addr < block.data_addr) {
-                E2P_SWAP(e2p_info_table[j].block_id, block.block_id);
-                E2P_SWAP(e2p_info_table[j].data_addr, block.data_addr);
-                E2P_SWAP(e2p_info_table[j].length, block.length);
-                E2P_SWAP(e2p_info_table[j].valid_state, block.valid_state);
-                E2P_SWAP(e2p_info_table[j].crc, block.crc);
-            }
-        }
-        memcpy(&e2p_info_table[i], &block, sizeof(e2p_block));
-    }
-
-    return count;
-}
-
 E2P_ATTR
 static void e2p_dummy_config(e2p_t *e2p)
 {
@@ -225,6 +315,8 @@ static void e2p_dummy_config(e2p_t *e2p)
 
     addr_bisect = cfg->start_addr + cnt_bisect * cfg->erase_size;
     memset(e2p_info_table, E2P_EARSED_VAR, sizeof(e2p_info_table));
+    e2p_index_reset();
+    memset(&e2p_gc, 0, sizeof(e2p_gc));
     e2p->p_data = cfg->start_addr;
     e2p->p_info = addr_bisect - sizeof(e2p_block) - sizeof(e2p_header);
     e2p->remain_size = e2p->p_info - e2p->p_data;
@@ -253,7 +345,7 @@ static void e2p_check_version(e2p_t *e2p)
 }
 
 E2P_ATTR
-static e2p_t *e2p_get_valid_context(e2p_t *e2p, uint8_t *flush)
+static e2p_t *e2p_get_valid_context(e2p_t *e2p, e2p_t **resume)
 {
     e2p_t *valid = e2p;
     e2p_t *invalid = &e2p_dummy;
@@ -267,9 +359,10 @@ static e2p_t *e2p_get_valid_context(e2p_t *e2p, uint8_t *flush)
     cfg->flash_read((uint8_t *)&dummy_header, dummy_addr_header, sizeof(e2p_header));
 
     if ((header.state != e2p_state_valid) && (dummy_header.state != e2p_state_valid)) {
-        if ((header.state == e2p_state_finish) && (dummy_header.state == e2p_state_invalid)) {
+        /* a freshly formatted area reads back state 0xFFFFFFFF */
+        if ((header.state == e2p_state_finish) && ((dummy_header.state & 0x0f) == e2p_state_invalid)) {
             valid = e2p;
-        } else if ((header.state == e2p_state_invalid) && (dummy_header.state == e2p_state_finish)) {
+        } else if (((header.state & 0x0f) == e2p_state_invalid) && (dummy_header.state == e2p_state_finish)) {
             valid = invalid;
         } else if (((header.state & 0x0f) == e2p_state_invalid) && ((dummy_header.state & 0x0f) == e2p_state_invalid)) {
             valid = e2p;
@@ -299,19 +392,231 @@ static e2p_t *e2p_get_valid_context(e2p_t *e2p, uint8_t *flush)
         E2P_CRITICAL_ENTER();
         cfg->flash_write((uint8_t *)&header, valid->p_info + sizeof(e2p_block), sizeof(e2p_header));
         E2P_CRITICAL_EXIT();
-    /* power off between start flush and write new data, reflush */
-    } else if (other_state == e2p_state_start) {
-        *flush = 1;
-    /* power off in writing process, clean buffer, reflush */
-    } else if (other_state == e2p_state_write) {
-        e2p_format(invalid);
-        e2p_config_info(invalid);
-        *flush = 1;
+    /* power off while compacting into the other area, the other area may already hold newer writes, resume */
+    } else if ((other_state == e2p_state_start) || (other_state == e2p_state_write)) {
+        *resume = invalid;
     }
 
     return valid;
 }
 
+/* an interrupted append may have programmed data past the last committed block, skip it */
+E2P_ATTR
+static void e2p_recover_data_end(e2p_t *e2p)
+{
+    uint8_t buf[E2P_BLANK_CHECK_SIZE];
+    uint32_t addr = e2p->p_info;
+    uint32_t len;
+
+    while (addr > e2p->p_data) {
+        len = addr - e2p->p_data;
+        len = len > sizeof(buf) ? sizeof(buf) : len;
+        addr -= len;
+        e2p->config.flash_read(buf, addr, len);
+        for (uint32_t i = len; i > 0; i--) {
+            if (buf[i - 1] != E2P_EARSED_VAR) {
+                e2p->p_data = addr + i;
+                e2p_info("skip interrupted write, data write addr = 0x%08x", e2p->p_data);
+                goto done;
+            }
+        }
+    }
+
+done:
+    e2p->remain_size = e2p->p_info - e2p->p_data;
+}
+
+/* replay the info log of one area into the table */
+E2P_ATTR
+static hpm_stat_t e2p_mount_area(e2p_t *e2p)
+{
+    e2p_block block;
+    e2p_config_t *cfg = &e2p->config;
+    bool interrupted = false;
+    uint32_t data_end;
+
+    e2p_area_reset(e2p);
+    while (e2p->remain_size >= sizeof(e2p_block)) {
+        cfg->flash_read((uint8_t *)&block, e2p->p_info, sizeof(e2p_block));
+        if (block.block_id == E2P_EARSED_ID)
+            break;
+
+        if (block.valid_state == e2p_valid) {
+            int ret = e2p_table_update(&block);
+            if (E2P_STATUS_OK != ret)
+                return ret;
+            data_end = block.data_addr + block.length;
+            if (data_end > e2p->p_data)
+                e2p->p_data = data_end;
+        } else if (block.valid_state != e2p_invalid) {
+            interrupted = true;
+        }
+
+        e2p->p_info -= sizeof(e2p_block);
+        e2p->remain_size = e2p->p_info - e2p->p_data;
+    }
+
+    if (interrupted)
+        e2p_recover_data_end(e2p);
+
+    return E2P_STATUS_OK;
+}
+
+E2P_ATTR
+static uint32_t e2p_gc_threshold(e2p_t *e2p)
+{
+    uint32_t reserve = E2P_GC_RESERVE_SECTORS * e2p->config.erase_size;
+    uint32_t capacity = e2p_area_capacity(e2p);
+
+    return (reserve > capacity / 2) ? capacity / 2 : reserve;
+}
+
+/* worth compacting: running low on space and at least one sector can be reclaimed */
+E2P_ATTR
+static bool e2p_gc_needed(void)
+{
+    e2p_t *e2p = e2p_valid_ctx;
+    uint32_t used = e2p_area_capacity(e2p) - e2p->remain_size;
+
+    if (e2p->remain_size >= e2p_gc_threshold(e2p))
+        return false;
+
+    return (used > e2p_live_size) && (used - e2p_live_size >= e2p->config.erase_size);
+}
+
+E2P_ATTR
+static uint32_t e2p_gc_pending_calc(e2p_t *src)
+{
+    uint32_t pending = 0;
+
+    for (uint32_t i = 0; i < e2p_info_count; i++) {
+        if (e2p_area_contains(src, e2p_info_table[i].data_addr))
+            pending += e2p_info_table[i].length + sizeof(e2p_block);
+    }
+
+    return pending;
+}
+
+E2P_ATTR
+static void e2p_gc_begin(void)
+{
+    e2p_t *src = e2p_valid_ctx;
+    e2p_t *dst = (src == e2p_raw) ? &e2p_dummy : e2p_raw;
+
+    /* dst was erased at the end of the previous compaction */
+    e2p_set_state(dst, e2p_state_start);
+    e2p_area_reset(dst);
+    e2p_set_state(dst, e2p_state_write);
+
+    e2p_gc.src = src;
+    e2p_gc.cursor = 0;
+    e2p_gc.pending = e2p_gc_pending_calc(src);
+    e2p_gc.phase = e2p_gc_copy;
+    e2p_valid_ctx = dst;
+    e2p_trace("compaction begin, src = 0x%08x, pending = %u\n", src->config.start_addr, e2p_gc.pending);
+}
+
+/* move live blocks out of src, at most one erase size of data and E2P_GC_STEP_BLOCKS blocks */
+E2P_ATTR
+static hpm_stat_t e2p_gc_copy_step(void)
+{
+    e2p_t *src = e2p_gc.src;
+    e2p_t *dst = e2p_valid_ctx;
+    e2p_config_t *cfg = &src->config;
+    uint8_t read_buf[cfg->erase_size];
+    uint32_t read_len = 0;
+    uint32_t read_cnt = 0;
+    uint32_t end = e2p_gc.cursor;
+    uint8_t *pdata = read_buf;
+    e2p_block *block;
+    hpm_stat_t ret;
+
+    while (end < e2p_info_count) {
+        block = &e2p_info_table[end];
+        if (e2p_area_contains(src, block->data_addr)) {
+            if ((cfg->erase_size - read_len < block->length) || (read_cnt == E2P_GC_STEP_BLOCKS))
+                break;
+            cfg->flash_read(read_buf + read_len, block->data_addr, block->length);
+            read_len += block->length;
+            read_cnt++;
+        }
+        end++;
+    }
+    e2p_trace("---- transfer data to buffer: len=%u\n", read_len);
+
+    for (uint32_t i = e2p_gc.cursor; i < end; i++) {
+        block = &e2p_info_table[i];
+        if (!e2p_area_contains(src, block->data_addr))
+            continue;
+        ret = e2p_write_private(dst, block->block_id, block->length, pdata);
+        if (E2P_STATUS_OK != ret) {
+            /* the block and the ones after it still live in src, which must not be erased */
+            e2p_err("compaction stopped, block_id[0x%08x] copy error %d", block->block_id, ret);
+            e2p_gc.cursor = i;
+            e2p_gc.phase = e2p_gc_stopped;
+            return ret;
+        }
+        /* e2p_table_update took the block off pending, its old entry was still in src */
+        pdata += block->length;
+    }
+    e2p_trace("-----write data back: len=%u\n", pdata - read_buf);
+    e2p_gc.cursor = end;
+
+    if (e2p_gc.cursor >= e2p_info_count) {
+        /* indicate write finish, begin erase old */
+        e2p_set_state(dst, e2p_state_finish);
+        if (e2p_gc.pending != 0) {
+            e2p_err("compaction copy done, %u bytes still pending", e2p_gc.pending);
+            e2p_gc.pending = 0;
+        }
+        e2p_gc.erase_addr = cfg->start_addr;
+        e2p_gc.phase = e2p_gc_erase;
+    }
+
+    return E2P_STATUS_OK;
+}
+
+E2P_ATTR
+static void e2p_gc_erase_step(void)
+{
+    e2p_t *src = e2p_gc.src;
+    e2p_config_t *cfg = &src->config;
+
+    E2P_CRITICAL_ENTER();
+    cfg->flash_erase(e2p_gc.erase_addr, cfg->erase_size);
+    E2P_CRITICAL_EXIT();
+    e2p_gc.erase_addr += cfg->erase_size;
+
+    if (e2p_gc.erase_addr >= e2p_area_end(src)) {
+        e2p_config_info(src);
+        e2p_area_reset(src);
+        /* indicate all work done, use new area */
+        e2p_set_state(e2p_valid_ctx, e2p_state_valid);
+        e2p_gc.src = NULL;
+        e2p_gc.phase = e2p_gc_idle;
+        e2p_trace("compaction done\n");
+    }
+}
+
+E2P_ATTR
+hpm_stat_t e2p_gc_step(void)
+{
+    if (e2p_gc.phase == e2p_gc_stopped)
+        return E2P_ERROR;
+
+    if ((e2p_gc.phase == e2p_gc_idle) && e2p_gc_needed())
+        e2p_gc_begin();
+
+    if (e2p_gc.phase == e2p_gc_copy) {
+        if (E2P_STATUS_OK != e2p_gc_copy_step())
+            return E2P_ERROR;
+    } else if (e2p_gc.phase == e2p_gc_erase) {
+        e2p_gc_erase_step();
+    }
+
+    return (e2p_gc.phase == e2p_gc_idle) ? E2P_STATUS_OK : E2P_STATUS_BUSY;
+}
+
 E2P_ATTR
 hpm_stat_t e2p_config(e2p_t *e2p)
 {
@@ -332,43 +637,36 @@ hpm_stat_t e2p_config(e2p_t *e2p)
         return E2P_ERROR_INIT_ERR;
     }
 
-    e2p_block block;
     e2p_t *dummy = &e2p_dummy;
-    e2p_config_t *cfg = &e2p->config;
-    uint8_t need_flush = 0;
+    e2p_t *resume = NULL;
+    int ret;
 
     e2p_dummy_config(e2p);
     e2p_check_version(e2p);
     e2p_check_version(dummy);
-    e2p_valid_ctx = e2p_get_valid_context(e2p, &need_flush);
+    e2p_valid_ctx = e2p_get_valid_context(e2p, &resume);
 
     if (e2p_valid_ctx == NULL)
         return E2P_ERROR_INIT_ERR;
 
-    while (1) {
-        block.data_addr = e2p_valid_ctx->p_info;
-        block.length = sizeof(e2p_block);
-        cfg->flash_read((uint8_t *)&block, block.data_addr, block.length);
-        if (block.block_id == E2P_EARSED_ID)
-            break;
+    ret = e2p_mount_area(e2p_valid_ctx);
+    if (E2P_STATUS_OK != ret)
+        return ret;
 
-        int ret = e2p_table_update(&block);
+    if (resume != NULL) {
+        /* blocks in the compaction target are newer, replay them last */
+        ret = e2p_mount_area(resume);
         if (E2P_STATUS_OK != ret)
             return ret;
-
-        e2p_valid_ctx->p_data += block.length;
-        e2p_valid_ctx->p_info -= sizeof(e2p_block);
-        e2p_valid_ctx->remain_size -= (block.length + sizeof(e2p_block));
-
-        if (e2p_valid_ctx->remain_size < 2 * sizeof(e2p_block)) {
-            e2p_info("remain flash is not enough\n");
-            return E2P_ERROR_NO_MEM;
-        }
+        e2p_set_state(resume, e2p_state_write);
+        e2p_gc.src = e2p_valid_ctx;
+        e2p_gc.cursor = 0;
+        e2p_gc.pending = e2p_gc_pending_calc(e2p_valid_ctx);
+        e2p_gc.phase = e2p_gc_copy;
+        e2p_valid_ctx = resume;
+        e2p_info("resume interrupted compaction\n");
     }
 
-    if (need_flush)
-        e2p_flush(E2P_FLUSH_BEGIN);
-
     e2p_print_info(e2p_valid_ctx);
     return E2P_STATUS_OK;
 }
@@ -376,90 +674,87 @@ hpm_stat_t e2p_config(e2p_t *e2p)
 E2P_ATTR
 hpm_stat_t e2p_flush(uint8_t flag)
 {
-    if (e2p_valid_ctx->config.erase_size < e2p_valid_ctx->remain_size && flag == E2P_FLUSH_TRY)
+    if (flag == E2P_FLUSH_TRY && e2p_gc.phase == e2p_gc_idle && !e2p_gc_needed())
         return E2P_STATUS_OK;
 
-    e2p_t *new;
-    e2p_t *e2p = e2p_valid_ctx;
+    /* a compaction in progress is completed instead of starting another one */
+    if (e2p_gc.phase == e2p_gc_idle)
+        e2p_gc_begin();
 
-    /* switch to new instance */
-    new = (e2p == e2p_raw) ? &e2p_dummy : e2p_raw;
-    e2p_config_t *cfg = &new->config;
-    uint32_t state = e2p_state_start;
-    uint32_t addr_state = cfg->start_addr + cfg->sector_cnt * cfg->erase_size - sizeof(uint32_t);
-    /* indicate start switch */
-    E2P_CRITICAL_ENTER();
-    cfg->flash_write((uint8_t *)&state, addr_state, sizeof(uint32_t));
-    E2P_CRITICAL_EXIT();
-
-    int valid_num = e2p_info_table_sort();
-    uint8_t read_buf[cfg->erase_size];
-    int count = 0;
-    uint32_t read_len = 0;
-
-    e2p->p_data = e2p->config.start_addr;
-    e2p->p_info = e2p->config.start_addr + e2p->config.sector_cnt * e2p->config.erase_size - sizeof(e2p_block) - sizeof(e2p_header);
-    e2p->remain_size = e2p->p_info - e2p->p_data;
-    /* indicate begin write to new */
-    state = e2p_state_write;
-    E2P_CRITICAL_ENTER();
-    cfg->flash_write((uint8_t *)&state, addr_state, sizeof(uint32_t));
-    E2P_CRITICAL_EXIT();
+    while (e2p_gc.phase != e2p_gc_idle) {
+        if (E2P_ERROR == e2p_gc_step())
+            return E2P_ERROR;
+    }
 
-    for (int i = 0; i < valid_num;) {
-        while (1) {
-            if (e2p_info_table[i].block_id == E2P_EARSED_ID || i >= valid_num)
-                break;
-            if (cfg->erase_size - read_len < e2p_info_table[i].length)
-                break;
-            cfg->flash_read(read_buf + read_len, e2p_info_table[i].data_addr, e2p_info_table[i].length);
-            read_len += e2p_info_table[i].length;
-            i++;
-        }
-        e2p_trace("---- transfer data to buffer: len=%u\n", read_len);
-        uint8_t *pdata = read_buf;
+    return E2P_STATUS_OK;
+}
 
-        while (count < i) {
-            if (e2p_info_table[count].block_id == E2P_EARSED_ID)
-                break;
+/* room for size bytes, and while copying for the live blocks still in src */
+E2P_ATTR
+static bool e2p_write_fits(uint32_t size)
+{
+    uint32_t reserved = (e2p_gc.phase == e2p_gc_copy) ? e2p_gc.pending : 0;
 
-            e2p_write_private(new, e2p_info_table[count].block_id, e2p_info_table[count].length, pdata);
-            pdata += e2p_info_table[count].length;
-            count++;
-        }
-        e2p_trace("-----write data back: len=%u\n", pdata - read_buf);
-        read_len = 0;
-    }
-    /* indicate write finish, begin erase old */
-    state = e2p_state_finish;
-    E2P_CRITICAL_ENTER();
-    cfg->flash_write((uint8_t *)&state, addr_state, sizeof(uint32_t));
-    E2P_CRITICAL_EXIT();
+    return e2p_valid_ctx->remain_size >= reserved + size;
+}
 
-    e2p_format(e2p);
-    e2p_config_info(e2p);
-    /* indicate all work done, use new area */
-    state = e2p_state_valid;
-    E2P_CRITICAL_ENTER();
-    cfg->flash_write((uint8_t *)&state, addr_state, sizeof(uint32_t));
-    E2P_CRITICAL_EXIT();
-    e2p_valid_ctx = new;
+/* a compaction started now frees at least size bytes */
+E2P_ATTR
+static bool e2p_write_reclaimable(uint32_t size)
+{
+    e2p_t *e2p = e2p_valid_ctx;
+    uint32_t used = e2p_area_capacity(e2p) - e2p->remain_size;
 
-    return E2P_STATUS_OK;
+    return (used > e2p_live_size) && (used - e2p_live_size >= size);
 }
 
 E2P_ATTR
 hpm_stat_t e2p_write(uint32_t block_id, uint16_t length, uint8_t *data)
 {
-    if (e2p_valid_ctx->remain_size < length + sizeof(e2p_block)) {
-        e2p_flush(E2P_FLUSH_BEGIN);
-        if (e2p_valid_ctx->remain_size < length + sizeof(e2p_block)) {
+    uint32_t size = length + sizeof(e2p_block);
+    uint32_t steps = 0;
+    hpm_stat_t ret;
+
+    if (length > e2p_valid_ctx->config.erase_size) {
+        e2p_trace("data larger than erase size\n");
+        return E2P_ERROR;
+    }
+
+    if (e2p_gc.phase == e2p_gc_stopped)
+        return E2P_ERROR;
+
+#if E2P_GC_WRITE_ASSIST
+    if (e2p_gc.phase != e2p_gc_idle) {
+        if (E2P_ERROR == e2p_gc_step())
+            return E2P_ERROR;
+        steps++;
+    }
+#endif
+
+    /*
+     * background compaction did not keep up, help it with a bounded number of steps, new
+     * writes never take the room the remaining live blocks need
+     */
+    while (!e2p_write_fits(size)) {
+        if ((e2p_gc.phase == e2p_gc_idle) && !e2p_write_reclaimable(size)) {
             e2p_trace("no enough flash write\n");
             return E2P_ERROR_NO_MEM;
         }
+        if (steps++ >= E2P_WRITE_GC_STEPS) {
+            e2p_trace("compaction in progress, write deferred\n");
+            return E2P_STATUS_BUSY;
+        }
+        if (e2p_gc.phase == e2p_gc_idle)
+            e2p_gc_begin();
+        if (E2P_ERROR == e2p_gc_step())
+            return E2P_ERROR;
     }
 
-    return e2p_write_private(e2p_valid_ctx, block_id, length, data);
+    ret = e2p_write_private(e2p_valid_ctx, block_id, length, data);
+    if ((E2P_STATUS_OK == ret) && (e2p_gc.phase == e2p_gc_idle) && e2p_gc_needed())
+        e2p_gc_begin();
+
+    return ret;
 }
 
 E2P_ATTR
@@ -479,7 +774,7 @@ hpm_stat_t e2p_read(uint32_t block_id, uint16_t length, uint8_t *data)
         e2p_trace("crc check error, data addr = 0x%08x, crc = 0x%08x", block.data_addr, block.crc);
         return E2P_ERROR;
     }
-    
+
     length > block.length ? (length=block.length) : length;
     memmove(data, tmp, length);
     return E2P_STATUS_OK;
@@ -489,10 +784,14 @@ E2P_ATTR
 void e2p_clear(void)
 {
     e2p_config_t *cfg = &e2p_raw->config;
+    uint32_t end_addr = cfg->start_addr + cfg->sector_cnt * cfg->erase_size * 2;
 
-    E2P_CRITICAL_ENTER();
-    cfg->flash_erase(cfg->start_addr, cfg->sector_cnt * cfg->erase_size * 2);
-    E2P_CRITICAL_EXIT();
+    for (uint32_t addr = cfg->start_addr; addr < end_addr; addr += cfg->erase_size) {
+        E2P_CRITICAL_ENTER();
+        cfg->flash_erase(addr, cfg->erase_size);
+        E2P_CRITICAL_EXIT();
+    }
+    memset(&e2p_gc, 0, sizeof(e2p_gc));
 }
 
 E2P_ATTR
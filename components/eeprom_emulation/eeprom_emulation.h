@@ -64,6 +64,34 @@ extern "C" {
 #define E2P_MAX_VAR_CNT     EEPROM_MAX_VAR_CNT
 #endif
 
+/* compaction starts in background once free space drops below this many sectors */
+#define E2P_GC_RESERVE_SECTORS (2)
+#ifdef EEPROM_GC_RESERVE_SECTORS
+#undef E2P_GC_RESERVE_SECTORS
+#define E2P_GC_RESERVE_SECTORS     EEPROM_GC_RESERVE_SECTORS
+#endif
+
+/* one compaction step moves at most this many blocks, keeps a step close to one sector erase */
+#define E2P_GC_STEP_BLOCKS (8)
+#ifdef EEPROM_GC_STEP_BLOCKS
+#undef E2P_GC_STEP_BLOCKS
+#define E2P_GC_STEP_BLOCKS     EEPROM_GC_STEP_BLOCKS
+#endif
+
+/* every e2p_write also runs one compaction step, disable when e2p_gc_step is called from an idle task */
+#define E2P_GC_WRITE_ASSIST (1)
+#ifdef EEPROM_GC_WRITE_ASSIST
+#undef E2P_GC_WRITE_ASSIST
+#define E2P_GC_WRITE_ASSIST     EEPROM_GC_WRITE_ASSIST
+#endif
+
+/* e2p_write runs at most this many compaction steps to make room, then returns E2P_STATUS_BUSY */
+#define E2P_WRITE_GC_STEPS (2)
+#ifdef EEPROM_WRITE_GC_STEPS
+#undef E2P_WRITE_GC_STEPS
+#define E2P_WRITE_GC_STEPS     EEPROM_WRITE_GC_STEPS
+#endif
+
 enum {
     e2p_state_valid = 0,
     e2p_state_finish = 8,
@@ -86,6 +114,7 @@ enum {
     E2P_ERROR_BAD_ID,
     E2P_ERROR_BAD_ADDR,
     E2P_ERROR_MUL_VAR,
+    E2P_STATUS_BUSY,
 };
 
 typedef struct {
@@ -148,19 +177,38 @@ hpm_stat_t e2p_config(e2p_t *e2p);
 
 /**
  * @brief eeprom emulation flush whole area, remove redundancy
+ *
+ * @note blocks until compaction is done, a compaction already in progress is completed
  * 
  * @param flag E2P_FLUSH_TRY - conditional flush, E2P_FLUSH_BEGIN - force flush
- * @return hpm_stat_t 
+ * @return E2P_STATUS_OK, E2P_ERROR - compaction stopped on a flash error
  */
 hpm_stat_t e2p_flush(uint8_t flag);
 
+/**
+ * @brief eeprom emulation run one step of background compaction
+ *
+ * @note call from an idle hook or low priority task, one step moves at most one erase size of data
+ *       or erases one sector, compaction is started here when free space is low
+ *
+ * @return E2P_STATUS_OK - nothing left to do, E2P_STATUS_BUSY - compaction in progress,
+ *         E2P_ERROR - compaction stopped on a flash error, the source area is kept and the
+ *         compaction is resumed by the next e2p_config
+ */
+hpm_stat_t e2p_gc_step(void);
+
 /**
  * @brief eeprom emulation write
+ *
+ * @note worst case is one append plus one compaction step, as long as compaction keeps up
+ *       with E2P_GC_RESERVE_SECTORS, otherwise it runs up to E2P_WRITE_GC_STEPS steps and
+ *       returns E2P_STATUS_BUSY if the data still does not fit, call it again to retry
  * 
  * @param block_id custom id
  * @param length data length
  * @param data 
- * @return hpm_stat_t 
+ * @return E2P_STATUS_OK, E2P_STATUS_BUSY - nothing written, compaction in progress,
+ *         E2P_ERROR_NO_MEM - live data leaves no room, E2P_ERROR - flash error
  */
 hpm_stat_t e2p_write(uint32_t block_id, uint16_t length, uint8_t *data);
 
@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <math.h>
+#include <string.h>
+#include "hpm_ffa_job.h"
+#include "hpm_soc.h"
+#include "hpm_interrupt.h"
+#include "hpm_l1c_drv.h"
+
+/*****************************************************************************************************************
+ *
+ *  Definitions
+ *
+ *****************************************************************************************************************/
+
+#define FFA_JOB_INT_MASK (FFA_INT_EN_OP_CMD_DONE_MASK | FFA_INT_EN_FIR_OV_MASK | FFA_INT_EN_FFT_OV_MASK | \
+                          FFA_INT_EN_WR_ERR_MASK | FFA_INT_EN_RD_NXT_ERR_MASK | FFA_INT_EN_RD_ERR_MASK)
+
+#define FFA_JOB_STATUS_MASK (FFA_STATUS_OP_CMD_DONE_MASK | FFA_STATUS_FIR_OV_MASK | FFA_STATUS_FFT_OV_MASK | \
+                             FFA_STATUS_WR_ERR_MASK | FFA_STATUS_RD_NXT_ERR_MASK | FFA_STATUS_RD_ERR_MASK)
+
+/**
+ * @brief FFA Job Queue Context Structure
+ */
+typedef struct {
+    FFA_Type *base;
+    uint8_t running_core;
+    ffa_job_t *volatile active;                     /**< FFA job running on the FFA */
+    ffa_job_t *queue[HPM_FFA_JOB_QUEUE_SIZE];       /**< chains waiting for the FFA */
+    volatile uint32_t head;
+    volatile uint32_t count;
+} ffa_job_context_t;
+
+/*****************************************************************************************************************
+ *
+ *  Prototypes
+ *
+ *****************************************************************************************************************/
+
+static uint32_t ffa_job_enter_critical(void);
+static void ffa_job_exit_critical(uint32_t level);
+static void ffa_job_start(ffa_job_t *job);
+static ffa_job_t *ffa_job_complete(ffa_job_t *job, hpm_stat_t status);
+static bool ffa_job_run_cpu(ffa_job_t *job, ffa_job_t *stop);
+static void ffa_job_start_queued(void);
+static void ffa_job_isr_handler(FFA_Type *ptr);
+
+/*****************************************************************************************************************
+ *
+ *  Variables
+ *
+ *****************************************************************************************************************/
+static ffa_job_context_t s_ffa_job_ctx;
+#define HPM_FFA_JOB (&s_ffa_job_ctx)
+
+/*****************************************************************************************************************
+ *
+ *  Codes
+ *
+ *****************************************************************************************************************/
+static uint32_t ffa_job_enter_critical(void)
+{
+    return disable_global_irq(CSR_MSTATUS_MIE_MASK);
+}
+
+static void ffa_job_exit_critical(uint32_t level)
+{
+    restore_global_irq(level);
+}
+
+static void ffa_job_cache_writeback(const void *buf, uint32_t size)
+{
+    if ((size > 0) && l1c_dc_is_enabled()) {
+        uint32_t start = HPM_L1C_CACHELINE_ALIGN_DOWN((uint32_t)buf);
+        uint32_t end = HPM_L1C_CACHELINE_ALIGN_UP((uint32_t)buf + size);
+        l1c_dc_writeback(start, end - start);
+    }
+}
+
+static void ffa_job_cache_flush(void *buf, uint32_t size)
+{
+    if ((size > 0) && l1c_dc_is_enabled()) {
+        l1c_dc_flush((uint32_t)buf, size);
+    }
+}
+
+static void ffa_job_cache_invalidate(void *buf, uint32_t size)
+{
+    if ((size > 0) && l1c_dc_is_enabled()) {
+        l1c_dc_invalidate((uint32_t)buf, size);
+    }
+}
+
+static bool ffa_job_is_cacheline_aligned(const void *buf, uint32_t size)
+{
+    return ((((uint32_t)buf | size) & (HPM_L1C_CACHELINE_SIZE - 1U)) == 0U);
+}
+
+static uint32_t ffa_job_get_data_size(uint32_t data_type)
+{
+    switch (data_type) {
+#if defined(HPM_IP_FEATURE_FFA_FP32) && HPM_IP_FEATURE_FFA_FP32
+    case FFA_DATA_TYPE_COMPLEX_FP32:
+    case FFA_DATA_TYPE_REAL_FP32:
+#endif
+    case FFA_DATA_TYPE_REAL_Q31:
+    case FFA_DATA_TYPE_COMPLEX_Q31:
+        return 4U;
+    case FFA_DATA_TYPE_COMPLEX_Q15:
+    case FFA_DATA_TYPE_REAL_Q15:
+        return 2U;
+    default:
+        return 0U;
+    }
+}
+
+static void *ffa_job_get_dst(const ffa_job_t *job)
+{
+    switch (job->type) {
+    case ffa_job_type_fft:
+        return job->xfer.fft.dst;
+    case ffa_job_type_fir:
+        return job->xfer.fir.dst;
+    default:
+        return job->xfer.cpu.dst;
+    }
+}
+
+static bool ffa_job_is_valid(const ffa_job_t *job)
+{
+    uint32_t data_size;
+
+    if (!ffa_job_is_cacheline_aligned(ffa_job_get_dst(job), job->dst_size)) {
+        return false;
+    }
+    switch (job->type) {
+    case ffa_job_type_fft:
+        return (job->xfer.fft.num_points >= 8U) &&
+               ((job->xfer.fft.num_points & (job->xfer.fft.num_points - 1U)) == 0U);
+    case ffa_job_type_fir:
+        /* the blocking api splits longer inputs, a job runs as a single operation */
+        data_size = ffa_job_get_data_size(job->xfer.fir.data_type);
+        return (data_size > 0U) && (job->xfer.fir.input_taps <= FFA_SOC_BUFFER_MAX / data_size);
+    case ffa_job_type_cpu:
+        return job->xfer.cpu.process != NULL;
+    default:
+        return false;
+    }
+}
+
+static void ffa_job_start(ffa_job_t *job)
+{
+    uint8_t core = HPM_FFA_JOB->running_core;
+
+    HPM_FFA_JOB->active = job;
+    if (job->type == ffa_job_type_fft) {
+        fft_xfer_t xfer = job->xfer.fft;
+        xfer.src = (const void *)core_local_mem_to_sys_address(core, (uint32_t)xfer.src);
+        xfer.dst = (void *)core_local_mem_to_sys_address(core, (uint32_t)xfer.dst);
+        xfer.interrupt_mask = FFA_JOB_INT_MASK;
+        ffa_start_fft(HPM_FFA_JOB->base, &xfer);
+    } else {
+        fir_xfer_t xfer = job->xfer.fir;
+        xfer.src = (const void *)core_local_mem_to_sys_address(core, (uint32_t)xfer.src);
+        xfer.coeff = (const void *)core_local_mem_to_sys_address(core, (uint32_t)xfer.coeff);
+        xfer.dst = (void *)core_local_mem_to_sys_address(core, (uint32_t)xfer.dst);
+        xfer.interrupt_mask = FFA_JOB_INT_MASK;
+        ffa_start_fir(HPM_FFA_JOB->base, &xfer);
+    }
+}
+
+/* report a job, returns the next job of the chain or NULL if the chain ends or was aborted */
+static ffa_job_t *ffa_job_complete(ffa_job_t *job, hpm_stat_t status)
+{
+    ffa_job_t *next = job->next;
+
+    job->status = status;
+    if (job->callback != NULL) {
+        job->callback(job, job->cb_data_ptr);
+    }
+    job->done = true;
+    if (status == status_success) {
+        return next;
+    }
+    while (next != NULL) {
+        job = next;
+        next = job->next;
+        job->status = status_ffa_job_aborted;
+        if (job->callback != NULL) {
+            job->callback(job, job->cb_data_ptr);
+        }
+        job->done = true;
+    }
+    return NULL;
+}
+
+/* run the cpu jobs from job to stop, returns false if one failed */
+static bool ffa_job_run_cpu(ffa_job_t *job, ffa_job_t *stop)
+{
+    while ((job != NULL) && (job != stop)) {
+        hpm_stat_t status = job->xfer.cpu.process(job);
+        ffa_job_cache_writeback(ffa_job_get_dst(job), job->dst_size);
+        job = ffa_job_complete(job, status);
+        if (status != status_success) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void ffa_job_start_queued(void)
+{
+    if (HPM_FFA_JOB->count > 0U) {
+        ffa_job_t *job = HPM_FFA_JOB->queue[HPM_FFA_JOB->head];
+        HPM_FFA_JOB->head = (HPM_FFA_JOB->head + 1U) % HPM_FFA_JOB_QUEUE_SIZE;
+        HPM_FFA_JOB->count--;
+        ffa_job_start(job);
+    }
+}
+
+static void ffa_job_isr_handler(FFA_Type *ptr)
+{
+    uint32_t ffa_status = ffa_get_status(ptr);
+    ffa_job_t *job = HPM_FFA_JOB->active;
+    ffa_job_t *cpu;
+    ffa_job_t *next;
+
+    if (job == NULL) {
+        /* the operation was started by the blocking api, leave its status to it */
+        ffa_disable_interrupt(ptr, FFA_JOB_INT_MASK);
+        return;
+    }
+    if ((ffa_status & FFA_JOB_STATUS_MASK) == 0U) {
+        return;
+    }
+    ffa_clear_status(ptr, ffa_status);
+    /* active stays set until the next ffa job is chosen, chains submitted by the callbacks are queued */
+    ffa_job_cache_invalidate(ffa_job_get_dst(job), job->dst_size);
+    next = ffa_job_complete(job, ffa_get_operation_status(ffa_status));
+
+    /* the cpu jobs up to the next ffa job of the chain */
+    cpu = next;
+    while ((next != NULL) && (next->type == ffa_job_type_cpu)) {
+        next = next->next;
+    }
+    if (next != NULL) {
+        /* the next ffa job may read the results of the cpu jobs */
+        if (ffa_job_run_cpu(cpu, next)) {
+            ffa_job_start(next);
+        } else {
+            HPM_FFA_JOB->active = NULL;
+            ffa_job_start_queued();
+        }
+    } else {
+        /* the chain ends with cpu jobs, they run while the ffa works on the next chain */
+        HPM_FFA_JOB->active = NULL;
+        ffa_job_start_queued();
+        (void)ffa_job_run_cpu(cpu, NULL);
+    }
+}
+
+SDK_DECLARE_EXT_ISR_M(IRQn_FFA, ffa_job_isr)
+void ffa_job_isr(void)
+{
+    ffa_job_isr_handler(HPM_FFA);
+}
+
+void hpm_ffa_job_get_default_config(hpm_ffa_job_config_t *config)
+{
+    config->running_core = HPM_CORE0;
+    config->irq_priority = 1;
+}
+
+hpm_stat_t hpm_ffa_job_init(const hpm_ffa_job_config_t *config)
+{
+    if (config == NULL) {
+        return status_invalid_argument;
+    }
+    (void) memset(HPM_FFA_JOB, 0, sizeof(*HPM_FFA_JOB));
+    HPM_FFA_JOB->base = HPM_FFA;
+    HPM_FFA_JOB->running_core = config->running_core;
+    ffa_disable(HPM_FFA);
+    ffa_clear_status(HPM_FFA, FFA_JOB_STATUS_MASK);
+    intc_m_enable_irq_with_priority(IRQn_FFA, config->irq_priority);
+    return status_success;
+}
+
+hpm_stat_t hpm_ffa_job_submit(ffa_job_t *job)
+{
+    uint32_t level;
+    ffa_job_t *p;
+
+    if ((job == NULL) || (job->type == ffa_job_type_cpu)) {
+        return status_invalid_argument;
+    }
+    for (p = job; p != NULL; p = p->next) {
+        if (!ffa_job_is_valid(p)) {
+            return status_invalid_argument;
+        }
+    }
+
+    /* inputs first, an input may be the output of a previous job which is flushed below */
+    for (p = job; p != NULL; p = p->next) {
+        if (p->type == ffa_job_type_fft) {
+            ffa_job_cache_writeback(p->xfer.fft.src, p->src_size);
+        } else if (p->type == ffa_job_type_fir) {
+            ffa_job_cache_writeback(p->xfer.fir.src, p->src_size);
+            ffa_job_cache_writeback(p->xfer.fir.coeff, p->coef_size);
+        }
+    }
+    for (p = job; p != NULL; p = p->next) {
+        if (p->type != ffa_job_type_cpu) {
+            ffa_job_cache_flush(ffa_job_get_dst(p), p->dst_size);
+        }
+        p->status = status_ffa_job_pending;
+        p->done = false;
+    }
+
+    level = ffa_job_enter_critical();
+    if (HPM_FFA_JOB->active == NULL) {
+        ffa_job_start(job);
+    } else if (HPM_FFA_JOB->count < HPM_FFA_JOB_QUEUE_SIZE) {
+        HPM_FFA_JOB->queue[(HPM_FFA_JOB->head + HPM_FFA_JOB->count) % HPM_FFA_JOB_QUEUE_SIZE] = job;
+        HPM_FFA_JOB->count++;
+    } else {
+        ffa_job_exit_critical(level);
+        return status_ffa_job_queue_full;
+    }
+    ffa_job_exit_critical(level);
+    return status_success;
+}
+
+bool hpm_ffa_job_is_busy(void)
+{
+    return (HPM_FFA_JOB->active != NULL) || (HPM_FFA_JOB->count > 0U);
+}
+
+hpm_stat_t hpm_ffa_job_wait(const ffa_job_t *job)
+{
+    while (!job->done) {
+    }
+    return job->status;
+}
+
+hpm_stat_t hpm_ffa_job_cmag_q31(ffa_job_t *job)
+{
+    const ffa_q31_t *src = (const ffa_q31_t *)job->xfer.cpu.src;
+    ffa_q31_t *dst = (ffa_q31_t *)job->xfer.cpu.dst;
+
+    for (uint32_t i = 0; i < job->xfer.cpu.num; i++) {
+        float re = (float)src[2 * i];
+        float im = (float)src[2 * i + 1];
+        float mag = sqrtf(re * re + im * im);
+        dst[i] = (mag >= 2147483648.0f) ? INT32_MAX : (ffa_q31_t)mag;
+    }
+    return status_success;
+}
+
+hpm_stat_t hpm_ffa_job_cmag_q15(ffa_job_t *job)
+{
+    const ffa_q15_t *src = (const ffa_q15_t *)job->xfer.cpu.src;
+    ffa_q15_t *dst = (ffa_q15_t *)job->xfer.cpu.dst;
+
+    for (uint32_t i = 0; i < job->xfer.cpu.num; i++) {
+        int32_t re = src[2 * i];
+        int32_t im = src[2 * i + 1];
+        float mag = sqrtf((float)((uint32_t)(re * re) + (uint32_t)(im * im)));
+        dst[i] = (mag >= 32767.0f) ? INT16_MAX : (ffa_q15_t)mag;
+    }
+    return status_success;
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_FFA_JOB_H
+#define HPM_FFA_JOB_H
+
+#include "hpm_common.h"
+#include "hpm_soc_feature.h"
+#include "hpm_ffa_drv.h"
+
+/**
+ * @brief FFA job queue
+ *
+ * Non-blocking front end of the FFA. A job is an FFT or FIR operation of the FFA, or a CPU step
+ * such as a magnitude, and jobs are linked into a chain through ffa_job_t.next. Chains are
+ * submitted to a queue and run in submission order, the jobs of a chain run one after the
+ * other, each one reading the output of the previous one if needed.
+ *
+ * The done interrupt of the FFA starts the next FFA job of the queue, so the operations follow
+ * each other without waiting for the application. The CPU jobs run in the interrupt: CPU jobs
+ * at the end of a chain run after the FFA has been started on the next chain, so the CPU and
+ * the FFA work in parallel.
+ *
+ * The queue does the cache maintenance: the FFA inputs are written back when the chain is
+ * submitted, the FFA outputs are invalidated when the job is done and the outputs of the CPU
+ * jobs are written back. The outputs must therefore be aligned to HPM_L1C_CACHELINE_SIZE and
+ * their sizes multiples of it.
+ *
+ * The FFA done interrupt is handled by the component. The blocking FFA api must not be used
+ * while jobs are queued.
+ */
+
+#ifndef HPM_FFA_JOB_QUEUE_SIZE
+#define HPM_FFA_JOB_QUEUE_SIZE (8U)     /**< chains waiting for the FFA, not counting the running one */
+#endif
+
+/**
+ * @brief FFA job status codes
+ */
+enum {
+    status_ffa_job_queue_full = MAKE_STATUS(status_group_ffa_job, 0),  /**< No room in the queue */
+    status_ffa_job_pending = MAKE_STATUS(status_group_ffa_job, 1),     /**< Job is not done yet */
+    status_ffa_job_aborted = MAKE_STATUS(status_group_ffa_job, 2),     /**< A previous job of the chain failed */
+};
+
+/**
+ * @brief FFA job types
+ */
+typedef enum {
+    ffa_job_type_fft = 0,   /**< FFT or IFFT on the FFA, xfer.fft */
+    ffa_job_type_fir = 1,   /**< FIR on the FFA, xfer.fir */
+    ffa_job_type_cpu = 2,   /**< processing on the CPU, xfer.cpu */
+} ffa_job_type_t;
+
+typedef struct ffa_job ffa_job_t;
+
+/**
+ * @brief Job done callback, called in interrupt context
+ */
+typedef void (*ffa_job_cb_t)(ffa_job_t *job, void *cb_data_ptr);
+
+/**
+ * @brief CPU job transfer context
+ */
+typedef struct {
+    hpm_stat_t (*process)(ffa_job_t *job);  /**< processing, called in interrupt context */
+    const void *src;                        /**< source data buffer */
+    void *dst;                              /**< destination data buffer */
+    uint32_t num;                           /**< number of elements */
+} ffa_cpu_xfer_t;
+
+/**
+ * @brief FFA job
+ */
+struct ffa_job {
+    ffa_job_type_t type;            /**< job type */
+    union {
+        fft_xfer_t fft;
+        fir_xfer_t fir;
+        ffa_cpu_xfer_t cpu;
+    } xfer;                         /**< transfer context of the type, the interrupt mask is set by the queue */
+    uint32_t src_size;              /**< bytes read from the source, written back on submission */
+    uint32_t coef_size;             /**< bytes read from the FIR coefficients, written back on submission */
+    uint32_t dst_size;              /**< bytes written to the destination */
+    ffa_job_t *next;                /**< next job of the chain or NULL */
+    ffa_job_cb_t callback;          /**< done callback or NULL */
+    void *cb_data_ptr;              /**< user data of the callback */
+    volatile hpm_stat_t status;     /**< result of the job */
+    volatile bool done;             /**< set after the callback returned */
+};
+
+/**
+ * @brief FFA job queue configuration
+ */
+typedef struct {
+    uint8_t running_core;       /**< core owning the job buffers, for core_local_mem_to_sys_address */
+    uint8_t irq_priority;       /**< FFA interrupt priority */
+} hpm_ffa_job_config_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get the default FFA job queue configuration
+ *
+ * @param [out] config FFA job queue configuration
+ */
+void hpm_ffa_job_get_default_config(hpm_ffa_job_config_t *config);
+
+/**
+ * @brief Initialize the FFA job queue and enable the FFA interrupt
+ *
+ * @param [in] config FFA job queue configuration
+ * @retval status_success if no error occurred
+ * @retval status_invalid_argument if config is NULL
+ */
+hpm_stat_t hpm_ffa_job_init(const hpm_ffa_job_config_t *config);
+
+/**
+ * @brief Submit a chain of jobs
+ *
+ * The first job of the chain must be an FFA job. The jobs must not be modified until they are
+ * done, a chain can be submitted again once its last job is done.
+ *
+ * @param [in] job first job of the chain
+ * @retval status_success if the chain was queued
+ * @retval status_invalid_argument if a job of the chain is invalid
+ * @retval status_ffa_job_queue_full if HPM_FFA_JOB_QUEUE_SIZE chains are waiting
+ */
+hpm_stat_t hpm_ffa_job_submit(ffa_job_t *job);
+
+/**
+ * @brief Check whether the FFA runs a job or jobs are waiting
+ *
+ * @return true if the queue is busy
+ */
+bool hpm_ffa_job_is_busy(void);
+
+/**
+ * @brief Check whether a job is done
+ *
+ * @param [in] job job
+ * @return true if the job is done
+ */
+static inline bool hpm_ffa_job_is_done(const ffa_job_t *job)
+{
+    return job->done;
+}
+
+/**
+ * @brief Wait until a job is done
+ *
+ * @param [in] job job
+ * @return result of the job
+ */
+hpm_stat_t hpm_ffa_job_wait(const ffa_job_t *job);
+
+/**
+ * @brief CPU job processing: magnitude of complex q31 data
+ *
+ * xfer.cpu.src holds num complex q31 values, xfer.cpu.dst receives num q31 magnitudes.
+ *
+ * @param [in] job CPU job
+ * @return status_success
+ */
+hpm_stat_t hpm_ffa_job_cmag_q31(ffa_job_t *job);
+
+/**
+ * @brief CPU job processing: magnitude of complex q15 data
+ *
+ * xfer.cpu.src holds num complex q15 values, xfer.cpu.dst receives num q15 magnitudes.
+ *
+ * @param [in] job CPU job
+ * @return status_success
+ */
+hpm_stat_t hpm_ffa_job_cmag_q15(ffa_job_t *job);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HPM_FFA_JOB_H */
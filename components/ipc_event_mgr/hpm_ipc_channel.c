@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "hpm_ipc_channel.h"
+#include "hpm_interrupt.h"
+
+/*****************************************************************************************************************
+ *
+ *  Definitions
+ *
+ *****************************************************************************************************************/
+#define IPC_CHANNEL_MAGIC (0x4950434BUL)    /* "IPCK" */
+
+/*
+ * Shared memory: a header line, the control blocks of ring 0 and ring 1, then the data of ring 0 and
+ * ring 1. The master transmits on ring 0.
+ */
+typedef struct {
+    volatile uint32_t magic;
+    volatile uint32_t ring_size;
+    uint8_t reserved[IPC_CHANNEL_LINE_SIZE - 2U * sizeof(uint32_t)];
+} ipc_channel_shm_header_t;
+
+/* a message is a header word, type in the low half and length in the high half, then the payload */
+#define IPC_CHANNEL_MSG_HEADER(type, len) ((((uint32_t)(len)) << 16) | (uint32_t)(type))
+#define IPC_CHANNEL_MSG_TYPE(header) ((uint16_t)((header) & 0xFFFFU))
+#define IPC_CHANNEL_MSG_LEN(header) ((uint16_t)((header) >> 16))
+#define IPC_CHANNEL_RECORD_SIZE(len) (IPC_CHANNEL_MSG_HEADER_SIZE + HPM_ALIGN_UP((uint32_t)(len), 4U))
+
+/*****************************************************************************************************************
+ *
+ *  Prototypes
+ *
+ *****************************************************************************************************************/
+static void ipc_channel_event_callback(uint16_t event_data, void *context);
+
+/*****************************************************************************************************************
+ *
+ *  Variables
+ *
+ *****************************************************************************************************************/
+static ipc_channel_t *s_ipc_channels[IPC_CHANNEL_MAX];
+static volatile uint32_t s_ipc_channel_doorbell_pending;    /* channels whose doorbell waits for the mailbox */
+static bool s_ipc_channel_event_registered;
+
+/*****************************************************************************************************************
+ *
+ *  Codes
+ *
+ *****************************************************************************************************************/
+static void ipc_channel_ring_doorbell(ipc_channel_t *ch)
+{
+    uint32_t mask = 1UL << ch->id;
+    uint32_t level;
+
+    /* doorbell_seq before the event */
+    fencerw();
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    if ((s_ipc_channel_doorbell_pending & mask) == 0U) {
+        if (ipc_tigger_event(ipc_remote_channel_event, ch->id) == status_success) {
+            ch->stats.tx_doorbells++;
+        } else {
+            s_ipc_channel_doorbell_pending |= mask;
+            ipc_enable_tx_ready_interrupt();
+        }
+    }
+    restore_global_irq(level);
+}
+
+void ipc_channel_tx_ready_handler(void)
+{
+    for (uint32_t id = 0; id < IPC_CHANNEL_MAX; id++) {
+        uint32_t mask = 1UL << id;
+
+        if ((s_ipc_channel_doorbell_pending & mask) == 0U) {
+            continue;
+        }
+        if (ipc_tigger_event(ipc_remote_channel_event, (uint16_t)id) != status_success) {
+            ipc_enable_tx_ready_interrupt();
+            break;
+        }
+        s_ipc_channel_doorbell_pending &= ~mask;
+        s_ipc_channels[id]->stats.tx_doorbells++;
+    }
+}
+
+static void ipc_channel_handle_doorbell(ipc_channel_t *ch)
+{
+    ch->stats.rx_doorbells++;
+    /* the producer rings again only after the ack, so the ring must be found empty after it */
+    do {
+        (void)ipc_channel_poll(ch, 0);
+        ch->rx->doorbell_ack = ch->rx->doorbell_seq;
+        fencerw();
+    } while (ch->rx->tail != ch->rx_pos);
+}
+
+static void ipc_channel_event_callback(uint16_t event_data, void *context)
+{
+    ipc_channel_t *ch;
+
+    (void)context;
+    if (event_data >= IPC_CHANNEL_MAX) {
+        return;
+    }
+    ch = s_ipc_channels[event_data];
+    if ((ch != NULL) && ch->rx_doorbell) {
+        ipc_channel_handle_doorbell(ch);
+    }
+}
+
+void ipc_channel_get_default_config(ipc_channel_config_t *config)
+{
+    config->id = 0;
+    config->master = false;
+    config->shm = NULL;
+    config->ring_size = 4096U;
+    config->rx_doorbell = true;
+    config->callback = NULL;
+    config->callback_data = NULL;
+}
+
+hpm_stat_t ipc_channel_init(ipc_channel_t *ch, const ipc_channel_config_t *config)
+{
+    ipc_channel_shm_header_t *header;
+    ipc_channel_ring_t *rings;
+    uint8_t *data;
+    uint32_t ring_size;
+
+    if ((ch == NULL) || (config == NULL) || (config->id >= IPC_CHANNEL_MAX) || (config->shm == NULL) ||
+        (((uint32_t)config->shm & 3U) != 0U)) {
+        return status_invalid_argument;
+    }
+
+    header = (ipc_channel_shm_header_t *)config->shm;
+    rings = (ipc_channel_ring_t *)((uint8_t *)config->shm + IPC_CHANNEL_LINE_SIZE);
+    data = (uint8_t *)config->shm + 5U * IPC_CHANNEL_LINE_SIZE;
+    if (config->master) {
+        ring_size = config->ring_size;
+        if ((ring_size < 2U * IPC_CHANNEL_LINE_SIZE) || ((ring_size & (ring_size - 1U)) != 0U) ||
+            (ring_size > 0x20000U)) {
+            return status_invalid_argument;
+        }
+        header->magic = 0;
+        fencerw();
+        memset(rings, 0, 2U * sizeof(ipc_channel_ring_t));
+        header->ring_size = ring_size;
+        fencerw();
+        header->magic = IPC_CHANNEL_MAGIC;
+    } else {
+        if (header->magic != IPC_CHANNEL_MAGIC) {
+            return status_ipc_channel_not_ready;
+        }
+        fencerw();
+        ring_size = header->ring_size;
+    }
+
+    memset(ch, 0, sizeof(*ch));
+    ch->id = config->id;
+    ch->ring_size = ring_size;
+    ch->tx = config->master ? &rings[0] : &rings[1];
+    ch->rx = config->master ? &rings[1] : &rings[0];
+    ch->tx_data = config->master ? data : &data[ring_size];
+    ch->rx_data = config->master ? &data[ring_size] : data;
+    ch->tx_pos = ch->tx->tail;
+    ch->tx_tail = ch->tx_pos;
+    ch->tx_head = ch->tx->head;
+    ch->tx_doorbell_seq = ch->tx->doorbell_seq;
+    ch->rx_pos = ch->rx->head;
+    ch->rx_tail = ch->rx_pos;
+    ch->callback = config->callback;
+    ch->callback_data = config->callback_data;
+    ch->rx_doorbell = config->rx_doorbell;
+    ch->rx->doorbell_ack = ch->rx->doorbell_seq;
+    ch->rx->doorbell_enable = config->rx_doorbell ? 1U : 0U;
+
+    s_ipc_channels[ch->id] = ch;
+    if (!s_ipc_channel_event_registered) {
+        ipc_register_event(ipc_remote_channel_event, ipc_channel_event_callback, NULL);
+        s_ipc_channel_event_registered = true;
+    }
+    return status_success;
+}
+
+hpm_stat_t ipc_channel_alloc(ipc_channel_t *ch, uint16_t type, uint16_t len, void **payload)
+{
+    uint32_t record = IPC_CHANNEL_RECORD_SIZE(len);
+    uint32_t offset = ch->tx_pos & (ch->ring_size - 1U);
+    uint32_t contiguous = ch->ring_size - offset;
+    uint32_t needed;
+
+    /* at most half of the ring, so that a record and the padding before it always fit */
+    if ((record > ch->ring_size / 2U) || (type == IPC_CHANNEL_MSG_TYPE_PAD)) {
+        return status_invalid_argument;
+    }
+
+    needed = (record <= contiguous) ? record : (contiguous + record);
+    if ((ch->ring_size - (ch->tx_pos - ch->tx_head)) < needed) {
+        ch->tx_head = ch->tx->head;
+        if ((ch->ring_size - (ch->tx_pos - ch->tx_head)) < needed) {
+            ch->stats.tx_full++;
+            return status_ipc_channel_full;
+        }
+    }
+
+    if (record > contiguous) {
+        *(volatile uint32_t *)&ch->tx_data[offset] =
+            IPC_CHANNEL_MSG_HEADER(IPC_CHANNEL_MSG_TYPE_PAD, contiguous - IPC_CHANNEL_MSG_HEADER_SIZE);
+        ch->tx_pos += contiguous;
+        offset = 0;
+    }
+    *(volatile uint32_t *)&ch->tx_data[offset] = IPC_CHANNEL_MSG_HEADER(type, len);
+    *payload = &ch->tx_data[offset + IPC_CHANNEL_MSG_HEADER_SIZE];
+    ch->tx_pos += record;
+    ch->tx_count++;
+
+    return status_success;
+}
+
+void ipc_channel_commit(ipc_channel_t *ch)
+{
+    ipc_channel_ring_t *ring = ch->tx;
+
+    if (ch->tx_pos == ch->tx_tail) {
+        return;
+    }
+
+    /* messages before tail, and tail before the doorbell state is read */
+    fencerw();
+    ring->tail = ch->tx_pos;
+    ch->tx_tail = ch->tx_pos;
+    fencerw();
+    ch->stats.tx_messages += ch->tx_count;
+    ch->stats.tx_commits++;
+    ch->tx_count = 0;
+
+    if ((ring->doorbell_enable != 0U) && (ring->doorbell_ack == ch->tx_doorbell_seq)) {
+        ch->tx_doorbell_seq++;
+        ring->doorbell_seq = ch->tx_doorbell_seq;
+        ipc_channel_ring_doorbell(ch);
+    }
+}
+
+hpm_stat_t ipc_channel_send(ipc_channel_t *ch, uint16_t type, const void *data, uint16_t len)
+{
+    void *payload;
+    hpm_stat_t stat;
+
+    stat = ipc_channel_alloc(ch, type, len, &payload);
+    if (stat != status_success) {
+        return stat;
+    }
+    memcpy(payload, data, len);
+    ipc_channel_commit(ch);
+
+    return status_success;
+}
+
+hpm_stat_t ipc_channel_receive(ipc_channel_t *ch, ipc_channel_msg_t *msg)
+{
+    uint32_t offset;
+    uint32_t header;
+
+    while (1) {
+        if (ch->rx_pos == ch->rx_tail) {
+            ch->rx_tail = ch->rx->tail;
+            if (ch->rx_pos == ch->rx_tail) {
+                return status_ipc_channel_empty;
+            }
+            /* tail before the messages */
+            fencerw();
+        }
+
+        offset = ch->rx_pos & (ch->ring_size - 1U);
+        header = *(volatile uint32_t *)&ch->rx_data[offset];
+        if (IPC_CHANNEL_MSG_TYPE(header) != IPC_CHANNEL_MSG_TYPE_PAD) {
+            break;
+        }
+        ch->rx_pos += IPC_CHANNEL_MSG_HEADER_SIZE + IPC_CHANNEL_MSG_LEN(header);
+    }
+
+    msg->type = IPC_CHANNEL_MSG_TYPE(header);
+    msg->len = IPC_CHANNEL_MSG_LEN(header);
+    msg->payload = &ch->rx_data[offset + IPC_CHANNEL_MSG_HEADER_SIZE];
+    ch->rx_pos += IPC_CHANNEL_RECORD_SIZE(msg->len);
+    ch->stats.rx_messages++;
+
+    return status_success;
+}
+
+void ipc_channel_release(ipc_channel_t *ch)
+{
+    /* messages read before their room is given back */
+    fencerw();
+    ch->rx->head = ch->rx_pos;
+}
+
+uint32_t ipc_channel_poll(ipc_channel_t *ch, uint32_t max_count)
+{
+    ipc_channel_msg_t msg;
+    uint32_t count = 0;
+
+    while (((max_count == 0U) || (count < max_count)) && (ipc_channel_receive(ch, &msg) == status_success)) {
+        if (ch->callback != NULL) {
+            ch->callback(ch, &msg, ch->callback_data);
+        }
+        count++;
+    }
+    if (count > 0U) {
+        ipc_channel_release(ch);
+    }
+
+    return count;
+}
+
+void ipc_channel_set_rx_doorbell(ipc_channel_t *ch, bool enable)
+{
+    uint32_t level;
+
+    if (!enable) {
+        ch->rx_doorbell = false;
+        ch->rx->doorbell_enable = 0;
+        return;
+    }
+
+    level = disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    ch->rx_doorbell = true;
+    ch->rx->doorbell_enable = 1U;
+    fencerw();
+    /* the producer did not ring for the messages published while the doorbells were off */
+    ipc_channel_handle_doorbell(ch);
+    restore_global_irq(level);
+}
+
+bool ipc_channel_tx_is_empty(ipc_channel_t *ch)
+{
+    ch->tx_head = ch->tx->head;
+    return ch->tx_head == ch->tx_pos;
+}
+
+void ipc_channel_get_stats(ipc_channel_t *ch, ipc_channel_stats_t *stats)
+{
+    *stats = ch->stats;
+}
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_IPC_CHANNEL_H
+#define HPM_IPC_CHANNEL_H
+
+#include "hpm_common.h"
+#include "hpm_ipc_event_mgr.h"
+
+/**
+ * @brief IPC channel
+ *
+ * A channel carries typed messages of variable length between the two cores through two
+ * single producer, single consumer rings in a shared noncacheable memory, one ring for each
+ * direction. The control words written by the producer and the ones written by the consumer
+ * are kept in separate cache lines.
+ *
+ * Messages are written in place: ipc_channel_alloc reserves the room of a message in the ring
+ * and ipc_channel_commit publishes all the messages allocated since the previous commit, so a
+ * batch of messages costs one update of the ring. ipc_channel_receive returns the next message
+ * in place, it stays valid until ipc_channel_release.
+ *
+ * The IPC event is only used as a doorbell: the producer rings it when it publishes messages
+ * and the consumer has acknowledged the previous doorbell, the consumer drains the ring before
+ * acknowledging it. A consumer which polls the ring can disable the doorbells. When the mailbox
+ * is busy, the doorbell is sent again from the IPC interrupt once the remote core has taken the
+ * previous event.
+ *
+ * The shared memory must have the same address on both cores and be noncacheable, e.g. a buffer
+ * with ATTR_SHARE_MEM. The master core initializes it and must be started first, the other core
+ * gets the ring size from the shared memory.
+ */
+
+#ifndef IPC_CHANNEL_MAX
+#define IPC_CHANNEL_MAX (4U)            /**< number of channels, and largest channel id plus one */
+#endif
+
+#define IPC_CHANNEL_LINE_SIZE (64U)     /**< size of the control blocks in the shared memory */
+#define IPC_CHANNEL_MSG_HEADER_SIZE (4U)
+#define IPC_CHANNEL_MSG_TYPE_PAD (0xFFFFU)  /**< reserved message type, skips the end of the ring */
+
+/**
+ * @brief Size of the shared memory of a channel
+ *
+ * @param [in] ring_size size of the ring of each direction, a power of 2
+ */
+#define IPC_CHANNEL_SHM_SIZE(ring_size) (5U * IPC_CHANNEL_LINE_SIZE + 2U * (ring_size))
+
+/**
+ * @brief Largest message payload of a ring of ring_size bytes
+ */
+#define IPC_CHANNEL_MAX_PAYLOAD(ring_size) ((ring_size) / 2U - IPC_CHANNEL_MSG_HEADER_SIZE)
+
+/**
+ * @brief IPC channel status codes
+ */
+enum {
+    status_ipc_channel_full = MAKE_STATUS(status_group_ipc_channel, 0),         /**< No room in the ring */
+    status_ipc_channel_empty = MAKE_STATUS(status_group_ipc_channel, 1),        /**< No message in the ring */
+    status_ipc_channel_not_ready = MAKE_STATUS(status_group_ipc_channel, 2),    /**< Master has not initialized the channel */
+};
+
+/**
+ * @brief Control block of a ring in the shared memory
+ */
+typedef struct {
+    volatile uint32_t head;             /**< read position, written by the consumer */
+    volatile uint32_t doorbell_ack;     /**< last doorbell handled, written by the consumer */
+    volatile uint32_t doorbell_enable;  /**< consumer wants doorbells */
+    uint8_t reserved0[IPC_CHANNEL_LINE_SIZE - 3U * sizeof(uint32_t)];
+    volatile uint32_t tail;             /**< write position, written by the producer */
+    volatile uint32_t doorbell_seq;     /**< last doorbell rung, written by the producer */
+    uint8_t reserved1[IPC_CHANNEL_LINE_SIZE - 2U * sizeof(uint32_t)];
+} ipc_channel_ring_t;
+
+/**
+ * @brief Received message
+ */
+typedef struct {
+    uint16_t type;                      /**< message type, defined by the application */
+    uint16_t len;                       /**< payload length in bytes */
+    void *payload;                      /**< payload in the ring, 4-byte aligned */
+} ipc_channel_msg_t;
+
+typedef struct ipc_channel ipc_channel_t;
+
+/**
+ * @brief Message callback, called by ipc_channel_poll, in interrupt context for the doorbell
+ */
+typedef void (*ipc_channel_callback_t)(ipc_channel_t *ch, const ipc_channel_msg_t *msg, void *callback_data);
+
+/**
+ * @brief IPC channel config
+ */
+typedef struct {
+    uint8_t id;                         /**< channel id, the same on both cores */
+    bool master;                        /**< initializes the shared memory */
+    void *shm;                          /**< shared memory of IPC_CHANNEL_SHM_SIZE(ring_size) bytes, 4-byte aligned */
+    uint32_t ring_size;                 /**< ring size of each direction, a power of 2, used by the master only */
+    bool rx_doorbell;                   /**< the doorbell polls the ring, otherwise the application polls it */
+    ipc_channel_callback_t callback;    /**< message callback of ipc_channel_poll */
+    void *callback_data;                /**< callback data */
+} ipc_channel_config_t;
+
+/**
+ * @brief IPC channel statistics
+ */
+typedef struct {
+    uint32_t tx_messages;               /**< messages committed */
+    uint32_t tx_commits;                /**< commits which published messages */
+    uint32_t tx_doorbells;              /**< doorbells rung */
+    uint32_t tx_full;                   /**< allocations failed for lack of room */
+    uint32_t rx_messages;               /**< messages received */
+    uint32_t rx_doorbells;              /**< doorbells received */
+} ipc_channel_stats_t;
+
+/**
+ * @brief IPC channel, local to a core
+ */
+struct ipc_channel {
+    uint8_t id;
+    bool rx_doorbell;
+    uint32_t ring_size;
+    ipc_channel_ring_t *tx;
+    ipc_channel_ring_t *rx;
+    uint8_t *tx_data;
+    uint8_t *rx_data;
+    uint32_t tx_pos;                    /**< allocation position, ahead of tx->tail */
+    uint32_t tx_tail;                   /**< last tx->tail written */
+    uint32_t tx_count;                  /**< messages allocated since the last commit */
+    uint32_t tx_head;                   /**< last tx->head read */
+    uint32_t tx_doorbell_seq;
+    uint32_t rx_pos;                    /**< receive position, ahead of rx->head */
+    uint32_t rx_tail;                   /**< last rx->tail read */
+    ipc_channel_callback_t callback;
+    void *callback_data;
+    ipc_channel_stats_t stats;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get the default config of an IPC channel
+ *
+ * @param [out] config config
+ */
+void ipc_channel_get_default_config(ipc_channel_config_t *config);
+
+/**
+ * @brief Initialize an IPC channel
+ *
+ * ipc_init must be called before, and the IPC event interrupt enabled for the doorbells.
+ *
+ * @param [out] ch channel
+ * @param [in] config config
+ * @retval status_success channel ready
+ * @retval status_ipc_channel_not_ready the master has not initialized the shared memory yet
+ * @retval status_invalid_argument invalid config
+ */
+hpm_stat_t ipc_channel_init(ipc_channel_t *ch, const ipc_channel_config_t *config);
+
+/**
+ * @brief Allocate a message in the ring
+ *
+ * The message is published by the next ipc_channel_commit, several messages can be allocated
+ * before a commit.
+ *
+ * @param [in] ch channel
+ * @param [in] type message type
+ * @param [in] len payload length, at most IPC_CHANNEL_MAX_PAYLOAD(ring_size)
+ * @param [out] payload payload to fill, 4-byte aligned
+ * @retval status_success message allocated
+ * @retval status_ipc_channel_full no room in the ring, the remote core has to consume messages
+ * @retval status_invalid_argument payload too large
+ */
+hpm_stat_t ipc_channel_alloc(ipc_channel_t *ch, uint16_t type, uint16_t len, void **payload);
+
+/**
+ * @brief Publish the allocated messages, and ring the doorbell if the remote core needs it
+ *
+ * @param [in] ch channel
+ */
+void ipc_channel_commit(ipc_channel_t *ch);
+
+/**
+ * @brief Allocate, copy and commit a message
+ *
+ * @param [in] ch channel
+ * @param [in] type message type
+ * @param [in] data payload
+ * @param [in] len payload length
+ * @retval status_success message sent
+ * @retval status_ipc_channel_full no room in the ring
+ * @retval status_invalid_argument payload too large
+ */
+hpm_stat_t ipc_channel_send(ipc_channel_t *ch, uint16_t type, const void *data, uint16_t len);
+
+/**
+ * @brief Get the next message of the ring
+ *
+ * The payload stays in the ring until ipc_channel_release.
+ *
+ * @param [in] ch channel
+ * @param [out] msg message
+ * @retval status_success message received
+ * @retval status_ipc_channel_empty no message
+ */
+hpm_stat_t ipc_channel_receive(ipc_channel_t *ch, ipc_channel_msg_t *msg);
+
+/**
+ * @brief Give the room of the messages received back to the remote core
+ *
+ * @param [in] ch channel
+ */
+void ipc_channel_release(ipc_channel_t *ch);
+
+/**
+ * @brief Pass the messages of the ring to the callback and release them
+ *
+ * Must not be called while the doorbell polls the ring.
+ *
+ * @param [in] ch channel
+ * @param [in] max_count largest number of messages, 0 for all
+ * @return number of messages
+ */
+uint32_t ipc_channel_poll(ipc_channel_t *ch, uint32_t max_count);
+
+/**
+ * @brief Enable or disable the doorbells of the receive ring
+ *
+ * When enabled, the messages already in the ring are passed to the callback before returning.
+ *
+ * @param [in] ch channel
+ * @param [in] enable doorbell polls the ring
+ */
+void ipc_channel_set_rx_doorbell(ipc_channel_t *ch, bool enable);
+
+/**
+ * @brief Check whether the transmit ring is empty, i.e. all messages were consumed
+ *
+ * @param [in] ch channel
+ * @return true if the remote core has released all messages
+ */
+bool ipc_channel_tx_is_empty(ipc_channel_t *ch);
+
+/**
+ * @brief Get the statistics of a channel
+ *
+ * @param [in] ch channel
+ * @param [out] stats statistics
+ */
+void ipc_channel_get_stats(ipc_channel_t *ch, ipc_channel_stats_t *stats);
+
+/**
+ * @brief Send the doorbells delayed by a busy mailbox, called by ipc_tx_ready_handler
+ */
+void ipc_channel_tx_ready_handler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HPM_IPC_CHANNEL_H */
@@ -7,6 +7,7 @@
 #include "hpm_common.h"
 #include "hpm_ipc_event_mgr.h"
 #include "hpm_ipc_event_mgr_mbx_internal.h"
+#include "hpm_ipc_channel.h"
 
 /*****************************************************************************************************************
  *
@@ -71,8 +72,7 @@ hpm_stat_t ipc_tigger_event(ipc_event_type_t type, uint16_t event_data)
         status = status_invalid_argument;
     } else {
         remote_data = (((uint32_t)type) << 16) | event_data;
-        ipc_tigger_event_internal(remote_data);
-        status = status_success;
+        status = ipc_tigger_event_internal(remote_data);
     }
 
     return status;
@@ -95,3 +95,13 @@ void ipc_event_handler(uint32_t data)
         }
     }
 }
+
+void ipc_enable_tx_ready_interrupt(void)
+{
+    ipc_enable_tx_ready_interrupt_internal();
+}
+
+void ipc_tx_ready_handler(void)
+{
+    ipc_channel_tx_ready_handler();
+}
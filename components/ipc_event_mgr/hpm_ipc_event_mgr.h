@@ -35,6 +35,7 @@ typedef struct {
 typedef enum {
     ipc_remote_start_event = 1,
     ipc_remote_rpmsg_event,
+    ipc_remote_channel_event,       /**< doorbell of an IPC channel, the event data is the channel id */
     ipc_event_table_len
 } ipc_event_type_t;
 
@@ -87,6 +88,19 @@ hpm_stat_t ipc_tigger_event(ipc_event_type_t type, uint16_t event_data);
  */
 void ipc_event_handler(uint32_t data);
 
+/*!
+ * @brief Request a call of ipc_tx_ready_handler once an event can be triggered again
+ */
+void ipc_enable_tx_ready_interrupt(void);
+
+/*!
+ * @brief tx ready handler
+ *
+ * This function is called when the event sent last was taken by the remote core, after
+ * ipc_enable_tx_ready_interrupt.
+ */
+void ipc_tx_ready_handler(void);
+
 #ifdef __cplusplus
 }
 #endif
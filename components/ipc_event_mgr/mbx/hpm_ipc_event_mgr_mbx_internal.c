@@ -58,6 +58,11 @@ hpm_stat_t ipc_tigger_event_internal(uint32_t remote_data)
     return mbx_send_message(HPM_MBX, remote_data);
 }
 
+void ipc_enable_tx_ready_interrupt_internal(void)
+{
+    mbx_enable_intr(HPM_MBX, MBX_CR_TWMEIE_MASK);
+}
+
 /*!
  * @brief ISR handler
  *
@@ -69,6 +74,11 @@ void mbx_isr(void)
     uint32_t data;
     hpm_stat_t state;
 
+    if (IS_HPM_BITMASK_SET(HPM_MBX->CR, MBX_CR_TWMEIE_MASK) && IS_HPM_BITMASK_SET(HPM_MBX->SR, MBX_SR_TWME_MASK)) {
+        mbx_disable_intr(HPM_MBX, MBX_CR_TWMEIE_MASK);
+        ipc_tx_ready_handler();
+    }
+
     state = mbx_retrieve_message(HPM_MBX, &data);
 
     if (state == status_success) {
@@ -40,6 +40,8 @@ void ipc_disable_event_interrupt_internal(void);
  */
 hpm_stat_t ipc_tigger_event_internal(uint32_t remote_data);
 
+void ipc_enable_tx_ready_interrupt_internal(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,543 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "hpm_memcpy_async.h"
+#include "hpm_soc.h"
+#include "hpm_interrupt.h"
+#include "hpm_l1c_drv.h"
+#if USE_MEMCPY_ASYNC_DMA_MGR
+#include "hpm_dma_mgr.h"
+#endif
+#if defined(HPMSOC_HAS_HPMSDK_SDP)
+#include "hpm_sdp_drv.h"
+#endif
+
+/*****************************************************************************************************************
+ *
+ *  Definitions
+ *
+ *****************************************************************************************************************/
+
+#if defined(HPMSOC_HAS_HPMSDK_SDP)
+#define MEMCPY_ASYNC_HAS_SDP (1U)
+#else
+#define MEMCPY_ASYNC_HAS_SDP (0U)
+#endif
+
+/* below this source alignment the dma moves bytes, which is slower than the cpu */
+#define MEMCPY_ASYNC_DMA_SRC_ALIGNMENT (4U)
+
+/**
+ * @brief Engine queue
+ */
+typedef struct {
+    memcpy_async_job_t *volatile active;    /**< job running on the engine */
+    memcpy_async_job_t *head;               /**< jobs waiting for the engine */
+    memcpy_async_job_t *tail;
+    volatile uint32_t pending_bytes;        /**< bytes of the active and waiting jobs */
+} memcpy_async_queue_t;
+
+/**
+ * @brief memcpy async Context Structure
+ */
+typedef struct {
+    uint8_t running_core;
+    uint32_t cpu_threshold;
+    bool has_engine[memcpy_async_engine_count];
+    memcpy_async_queue_t queue[memcpy_async_engine_count];   /**< queues of the dma and the sdp */
+    hpm_memcpy_async_stats_t stats;
+#if USE_MEMCPY_ASYNC_DMA_MGR
+    dma_resource_t dma_resource;
+    dma_mgr_chn_handle_t dma_handle;
+    uint8_t dma_max_width;
+    uint8_t dma_width;                      /**< width of the channel setup, 0xFF if not set up */
+    uint8_t dma_src_addr_ctrl;              /**< source address control of the channel setup */
+#endif
+} memcpy_async_context_t;
+
+/*****************************************************************************************************************
+ *
+ *  Prototypes
+ *
+ *****************************************************************************************************************/
+
+static uint32_t memcpy_async_enter_critical(void);
+static void memcpy_async_exit_critical(uint32_t level);
+static hpm_stat_t memcpy_async_start(memcpy_async_job_t *job);
+static void memcpy_async_start_next(memcpy_async_queue_t *queue);
+static void memcpy_async_complete(memcpy_async_job_t *job, hpm_stat_t status);
+static void memcpy_async_engine_done(memcpy_async_engine_t engine, hpm_stat_t status);
+
+/*****************************************************************************************************************
+ *
+ *  Variables
+ *
+ *****************************************************************************************************************/
+static memcpy_async_context_t s_memcpy_async_ctx;
+#define HPM_MEMCPY_ASYNC (&s_memcpy_async_ctx)
+
+#if USE_MEMCPY_ASYNC_DMA_MGR
+/* source of the dma fills, read by the dma with a fixed address */
+ATTR_PLACE_AT_NONCACHEABLE_BSS_WITH_ALIGNMENT(8) static uint32_t s_memcpy_async_pattern[2];
+#endif
+#if MEMCPY_ASYNC_HAS_SDP
+/* packet of the sdp memcpy on the SoCs without register descriptor */
+ATTR_PLACE_AT_NONCACHEABLE_BSS_WITH_ALIGNMENT(8) static sdp_dma_ctx_t s_memcpy_async_sdp_ctx;
+#endif
+
+/*****************************************************************************************************************
+ *
+ *  Codes
+ *
+ *****************************************************************************************************************/
+static uint32_t memcpy_async_enter_critical(void)
+{
+    return disable_global_irq(CSR_MSTATUS_MIE_MASK);
+}
+
+static void memcpy_async_exit_critical(uint32_t level)
+{
+    restore_global_irq(level);
+}
+
+static void memcpy_async_cache_writeback(const void *buf, uint32_t size)
+{
+    if ((size > 0) && l1c_dc_is_enabled()) {
+        uint32_t start = HPM_L1C_CACHELINE_ALIGN_DOWN((uint32_t)buf);
+        uint32_t end = HPM_L1C_CACHELINE_ALIGN_UP((uint32_t)buf + size);
+        l1c_dc_writeback(start, end - start);
+    }
+}
+
+static void memcpy_async_cache_flush(void *buf, uint32_t size)
+{
+    if ((size > 0) && l1c_dc_is_enabled()) {
+        l1c_dc_flush((uint32_t)buf, size);
+    }
+}
+
+static void memcpy_async_cache_invalidate(void *buf, uint32_t size)
+{
+    if ((size > 0) && l1c_dc_is_enabled()) {
+        l1c_dc_invalidate((uint32_t)buf, size);
+    }
+}
+
+/* the whole cache lines of the destination are left to the engine */
+static void memcpy_async_split(memcpy_async_job_t *job)
+{
+    uint32_t dst = (uint32_t)job->dst;
+    uint32_t start = HPM_L1C_CACHELINE_ALIGN_UP(dst);
+    uint32_t end = HPM_L1C_CACHELINE_ALIGN_DOWN(dst + job->size);
+
+    if ((start < end) && (start >= dst)) {
+        job->xfer_offset = start - dst;
+        job->xfer_size = end - start;
+    } else {
+        job->xfer_offset = 0;
+        job->xfer_size = 0;
+    }
+}
+
+static void memcpy_async_run_cpu(const memcpy_async_job_t *job, uint32_t offset, uint32_t size)
+{
+    if (size == 0U) {
+        return;
+    }
+    if (job->type == memcpy_async_type_copy) {
+        (void) memcpy((uint8_t *)job->dst + offset, (const uint8_t *)job->src + offset, size);
+    } else {
+        (void) memset((uint8_t *)job->dst + offset, job->pattern, size);
+    }
+}
+
+static memcpy_async_engine_t memcpy_async_select_engine(const memcpy_async_job_t *job)
+{
+    const memcpy_async_queue_t *queue = HPM_MEMCPY_ASYNC->queue;
+    memcpy_async_engine_t engine = job->engine;
+    bool dma;
+    bool sdp;
+
+    if (job->xfer_size == 0U) {
+        return memcpy_async_engine_cpu;
+    }
+    if (engine != memcpy_async_engine_auto) {
+        return engine;
+    }
+    if (job->size < HPM_MEMCPY_ASYNC->cpu_threshold) {
+        return memcpy_async_engine_cpu;
+    }
+
+    dma = HPM_MEMCPY_ASYNC->has_engine[memcpy_async_engine_dma] &&
+          ((job->type == memcpy_async_type_fill) ||
+           ((((uint32_t)job->src + job->xfer_offset) & (MEMCPY_ASYNC_DMA_SRC_ALIGNMENT - 1U)) == 0U));
+    sdp = HPM_MEMCPY_ASYNC->has_engine[memcpy_async_engine_sdp];
+    if (dma && sdp) {
+        engine = (queue[memcpy_async_engine_sdp].pending_bytes < queue[memcpy_async_engine_dma].pending_bytes) ?
+                 memcpy_async_engine_sdp : memcpy_async_engine_dma;
+    } else if (dma) {
+        engine = memcpy_async_engine_dma;
+    } else if (sdp) {
+        engine = memcpy_async_engine_sdp;
+    } else {
+        engine = memcpy_async_engine_cpu;
+    }
+    return engine;
+}
+
+#if USE_MEMCPY_ASYNC_DMA_MGR
+static hpm_stat_t memcpy_async_dma_start(memcpy_async_job_t *job)
+{
+    uint8_t core = HPM_MEMCPY_ASYNC->running_core;
+    uint32_t dst = core_local_mem_to_sys_address(core, (uint32_t)job->dst + job->xfer_offset);
+    uint32_t src;
+    uint32_t align;
+    uint8_t width = HPM_MEMCPY_ASYNC->dma_max_width;
+    uint8_t src_addr_ctrl;
+    hpm_stat_t status;
+
+    if (job->type == memcpy_async_type_copy) {
+        src = core_local_mem_to_sys_address(core, (uint32_t)job->src + job->xfer_offset);
+        src_addr_ctrl = DMA_MGR_ADDRESS_CONTROL_INCREMENT;
+        align = src | dst | job->xfer_size;
+        while ((width > DMA_MGR_TRANSFER_WIDTH_BYTE) && ((align & ((1UL << width) - 1U)) != 0U)) {
+            width--;
+        }
+    } else {
+        s_memcpy_async_pattern[0] = job->pattern * 0x01010101UL;
+        s_memcpy_async_pattern[1] = s_memcpy_async_pattern[0];
+        src = core_local_mem_to_sys_address(core, (uint32_t)s_memcpy_async_pattern);
+        src_addr_ctrl = DMA_MGR_ADDRESS_CONTROL_FIXED;
+    }
+
+    /* the channel is set up again only if the widths or the source address control change */
+    if ((width != HPM_MEMCPY_ASYNC->dma_width) || (src_addr_ctrl != HPM_MEMCPY_ASYNC->dma_src_addr_ctrl)) {
+        dma_mgr_chn_conf_t config;
+
+        dma_mgr_get_default_chn_config(&config);
+        config.src_width = width;
+        config.dst_width = width;
+        config.src_addr_ctrl = src_addr_ctrl;
+        config.dst_addr_ctrl = DMA_MGR_ADDRESS_CONTROL_INCREMENT;
+        config.src_burst_size = DMA_MGR_NUM_TRANSFER_PER_BURST_8T;
+        config.src_addr = src;
+        config.dst_addr = dst;
+        config.size_in_byte = job->xfer_size;
+        config.interrupt_mask = DMA_MGR_INTERRUPT_MASK_HALF_TC | DMA_MGR_INTERRUPT_MASK_ABORT;
+        status = dma_mgr_setup_channel(&HPM_MEMCPY_ASYNC->dma_resource, &config);
+        if (status != status_success) {
+            HPM_MEMCPY_ASYNC->dma_width = 0xFFU;
+            return status;
+        }
+        HPM_MEMCPY_ASYNC->dma_width = width;
+        HPM_MEMCPY_ASYNC->dma_src_addr_ctrl = src_addr_ctrl;
+    }
+    return dma_mgr_restart_chn_transfer(HPM_MEMCPY_ASYNC->dma_handle, src, dst, job->xfer_size >> width);
+}
+
+static void memcpy_async_dma_tc_callback(DMA_Type *base, uint32_t channel, void *cb_data_ptr)
+{
+    (void) base;
+    (void) channel;
+    (void) cb_data_ptr;
+    memcpy_async_engine_done(memcpy_async_engine_dma, status_success);
+}
+
+static void memcpy_async_dma_error_callback(DMA_Type *base, uint32_t channel, void *cb_data_ptr)
+{
+    (void) base;
+    (void) channel;
+    (void) cb_data_ptr;
+    memcpy_async_engine_done(memcpy_async_engine_dma, status_dma_transfer_error);
+}
+
+static hpm_stat_t memcpy_async_dma_init(const hpm_memcpy_async_config_t *config)
+{
+    dma_resource_t *resource = &HPM_MEMCPY_ASYNC->dma_resource;
+    hpm_stat_t status;
+
+    status = dma_mgr_request_resource(resource);
+    if (status != status_success) {
+        return status;
+    }
+    HPM_MEMCPY_ASYNC->dma_handle = dma_mgr_get_chn_handle(resource);
+    HPM_MEMCPY_ASYNC->dma_max_width = DMA_SOC_TRANSFER_WIDTH_MAX(resource->base);
+    HPM_MEMCPY_ASYNC->dma_width = 0xFFU;
+    (void) dma_mgr_install_chn_tc_callback(resource, memcpy_async_dma_tc_callback, NULL);
+    (void) dma_mgr_install_chn_error_callback(resource, memcpy_async_dma_error_callback, NULL);
+    return dma_mgr_enable_dma_irq_with_priority(resource, config->dma_irq_priority);
+}
+#endif
+
+#if MEMCPY_ASYNC_HAS_SDP
+static hpm_stat_t memcpy_async_sdp_start(memcpy_async_job_t *job)
+{
+    uint8_t core = HPM_MEMCPY_ASYNC->running_core;
+    void *dst = (void *)core_local_mem_to_sys_address(core, (uint32_t)job->dst + job->xfer_offset);
+
+    /* the blocking sdp api may have disabled the interrupt */
+    sdp_enable_interrupt(HPM_SDP);
+    if (job->type == memcpy_async_type_copy) {
+        const void *src = (const void *)core_local_mem_to_sys_address(core, (uint32_t)job->src + job->xfer_offset);
+        return sdp_start_memcpy(HPM_SDP, &s_memcpy_async_sdp_ctx, dst, src, job->xfer_size);
+    }
+    return sdp_start_memset(HPM_SDP, &s_memcpy_async_sdp_ctx, dst, job->pattern, job->xfer_size);
+}
+
+SDK_DECLARE_EXT_ISR_M(IRQn_SDP, memcpy_async_sdp_isr)
+void memcpy_async_sdp_isr(void)
+{
+    uint32_t sdp_sta = sdp_get_status(HPM_SDP);
+
+    if (IS_HPM_BITMASK_CLR(sdp_sta, SDP_STA_IRQ_MASK)) {
+        return;
+    }
+    sdp_clear_status(HPM_SDP, SDP_STA_IRQ_MASK);
+    if (HPM_MEMCPY_ASYNC->queue[memcpy_async_engine_sdp].active == NULL) {
+        /* the operation was started by the blocking api, leave its status to it */
+        sdp_disable_interrupt(HPM_SDP);
+        return;
+    }
+    memcpy_async_engine_done(memcpy_async_engine_sdp, sdp_get_operation_status(sdp_sta));
+}
+
+static hpm_stat_t memcpy_async_sdp_init(const hpm_memcpy_async_config_t *config)
+{
+    hpm_stat_t status = sdp_init(HPM_SDP);
+
+    if (status == status_success) {
+        sdp_clear_status(HPM_SDP, SDP_STA_IRQ_MASK);
+        intc_m_enable_irq_with_priority(IRQn_SDP, config->sdp_irq_priority);
+    }
+    return status;
+}
+#endif
+
+static hpm_stat_t memcpy_async_start(memcpy_async_job_t *job)
+{
+    switch (job->engine_used) {
+#if USE_MEMCPY_ASYNC_DMA_MGR
+    case memcpy_async_engine_dma:
+        return memcpy_async_dma_start(job);
+#endif
+#if MEMCPY_ASYNC_HAS_SDP
+    case memcpy_async_engine_sdp:
+        return memcpy_async_sdp_start(job);
+#endif
+    default:
+        return status_memcpy_async_no_engine;
+    }
+}
+
+static void memcpy_async_complete(memcpy_async_job_t *job, hpm_stat_t status)
+{
+    if (status == status_success) {
+        HPM_MEMCPY_ASYNC->stats.jobs[job->engine_used]++;
+        HPM_MEMCPY_ASYNC->stats.bytes[job->engine_used] += job->size;
+    }
+    /* done before the callback, so that the callback can submit the job again */
+    job->status = status;
+    job->done = true;
+    if (job->callback != NULL) {
+        job->callback(job, job->cb_data_ptr);
+    }
+}
+
+/* start the waiting jobs of a queue until one starts, called with the engine idle */
+static void memcpy_async_start_next(memcpy_async_queue_t *queue)
+{
+    memcpy_async_job_t *job;
+    hpm_stat_t status;
+
+    while ((job = queue->head) != NULL) {
+        queue->head = job->next;
+        if (queue->head == NULL) {
+            queue->tail = NULL;
+        }
+        queue->active = job;
+        status = memcpy_async_start(job);
+        if (status == status_success) {
+            return;
+        }
+        queue->pending_bytes -= job->xfer_size;
+        memcpy_async_complete(job, status);
+    }
+    queue->active = NULL;
+}
+
+static void memcpy_async_engine_done(memcpy_async_engine_t engine, hpm_stat_t status)
+{
+    memcpy_async_queue_t *queue = &HPM_MEMCPY_ASYNC->queue[engine];
+    memcpy_async_job_t *job = queue->active;
+
+    if (job == NULL) {
+        return;
+    }
+    memcpy_async_cache_invalidate((uint8_t *)job->dst + job->xfer_offset, job->xfer_size);
+    queue->pending_bytes -= job->xfer_size;
+    /* the next job runs while the callback of this one is called, jobs submitted by the callback are queued */
+    memcpy_async_start_next(queue);
+    memcpy_async_complete(job, status);
+}
+
+void hpm_memcpy_async_get_default_config(hpm_memcpy_async_config_t *config)
+{
+    config->running_core = HPM_CORE0;
+    config->use_dma = (USE_MEMCPY_ASYNC_DMA_MGR != 0U);
+    config->use_sdp = (MEMCPY_ASYNC_HAS_SDP != 0U);
+    config->dma_irq_priority = 1;
+    config->sdp_irq_priority = 1;
+    config->cpu_threshold = HPM_MEMCPY_ASYNC_CPU_THRESHOLD;
+}
+
+hpm_stat_t hpm_memcpy_async_init(const hpm_memcpy_async_config_t *config)
+{
+    hpm_stat_t status = status_success;
+
+    if (config == NULL) {
+        return status_invalid_argument;
+    }
+    if ((config->use_dma && (USE_MEMCPY_ASYNC_DMA_MGR == 0U)) || (config->use_sdp && (MEMCPY_ASYNC_HAS_SDP == 0U))) {
+        return status_memcpy_async_no_engine;
+    }
+    (void) memset(HPM_MEMCPY_ASYNC, 0, sizeof(*HPM_MEMCPY_ASYNC));
+    HPM_MEMCPY_ASYNC->running_core = config->running_core;
+    HPM_MEMCPY_ASYNC->cpu_threshold = config->cpu_threshold;
+    HPM_MEMCPY_ASYNC->has_engine[memcpy_async_engine_cpu] = true;
+#if USE_MEMCPY_ASYNC_DMA_MGR
+    if (config->use_dma) {
+        status = memcpy_async_dma_init(config);
+        if (status != status_success) {
+            return status;
+        }
+        HPM_MEMCPY_ASYNC->has_engine[memcpy_async_engine_dma] = true;
+    }
+#endif
+#if MEMCPY_ASYNC_HAS_SDP
+    if (config->use_sdp) {
+        status = memcpy_async_sdp_init(config);
+        if (status != status_success) {
+            return status;
+        }
+        HPM_MEMCPY_ASYNC->has_engine[memcpy_async_engine_sdp] = true;
+    }
+#endif
+    return status;
+}
+
+hpm_stat_t hpm_memcpy_async_submit(memcpy_async_job_t *job)
+{
+    memcpy_async_queue_t *queue;
+    memcpy_async_engine_t engine;
+    hpm_stat_t status;
+    uint32_t level;
+
+    if ((job == NULL) || (job->dst == NULL) || (job->engine >= memcpy_async_engine_count) ||
+        ((job->type != memcpy_async_type_copy) && (job->type != memcpy_async_type_fill)) ||
+        ((job->type == memcpy_async_type_copy) && (job->src == NULL) && (job->size > 0U))) {
+        return status_invalid_argument;
+    }
+    if ((job->engine != memcpy_async_engine_auto) && !HPM_MEMCPY_ASYNC->has_engine[job->engine]) {
+        return status_memcpy_async_no_engine;
+    }
+
+    job->status = status_memcpy_async_pending;
+    job->done = false;
+    job->next = NULL;
+    memcpy_async_split(job);
+    engine = memcpy_async_select_engine(job);
+    job->engine_used = engine;
+    if (engine == memcpy_async_engine_cpu) {
+        job->xfer_offset = 0;
+        job->xfer_size = 0;
+        memcpy_async_run_cpu(job, 0, job->size);
+        memcpy_async_complete(job, status_success);
+        return status_success;
+    }
+
+    /* the destination lines of the engine are flushed before the cpu writes the partial lines around them */
+    if (job->type == memcpy_async_type_copy) {
+        memcpy_async_cache_writeback((const uint8_t *)job->src + job->xfer_offset, job->xfer_size);
+    }
+    memcpy_async_cache_flush((uint8_t *)job->dst + job->xfer_offset, job->xfer_size);
+    memcpy_async_run_cpu(job, 0, job->xfer_offset);
+    memcpy_async_run_cpu(job, job->xfer_offset + job->xfer_size, job->size - job->xfer_offset - job->xfer_size);
+
+    queue = &HPM_MEMCPY_ASYNC->queue[engine];
+    level = memcpy_async_enter_critical();
+    queue->pending_bytes += job->xfer_size;
+    if (queue->active != NULL) {
+        if (queue->tail == NULL) {
+            queue->head = job;
+        } else {
+            queue->tail->next = job;
+        }
+        queue->tail = job;
+        memcpy_async_exit_critical(level);
+        return status_success;
+    }
+    queue->active = job;
+    status = memcpy_async_start(job);
+    if (status != status_success) {
+        queue->pending_bytes -= job->xfer_size;
+        queue->active = NULL;
+    }
+    memcpy_async_exit_critical(level);
+    if (status != status_success) {
+        memcpy_async_complete(job, status);
+    }
+    return status_success;
+}
+
+hpm_stat_t hpm_memcpy_async_copy(memcpy_async_job_t *job, void *dst, const void *src, uint32_t size)
+{
+    if (job == NULL) {
+        return status_invalid_argument;
+    }
+    job->type = memcpy_async_type_copy;
+    job->dst = dst;
+    job->src = src;
+    job->size = size;
+    return hpm_memcpy_async_submit(job);
+}
+
+hpm_stat_t hpm_memcpy_async_fill(memcpy_async_job_t *job, void *dst, uint8_t pattern, uint32_t size)
+{
+    if (job == NULL) {
+        return status_invalid_argument;
+    }
+    job->type = memcpy_async_type_fill;
+    job->dst = dst;
+    job->pattern = pattern;
+    job->size = size;
+    return hpm_memcpy_async_submit(job);
+}
+
+bool hpm_memcpy_async_is_busy(void)
+{
+    for (uint32_t i = 0; i < memcpy_async_engine_count; i++) {
+        if (HPM_MEMCPY_ASYNC->queue[i].active != NULL) {
+            return true;
+        }
+    }
+    return false;
+}
+
+hpm_stat_t hpm_memcpy_async_wait(const memcpy_async_job_t *job)
+{
+    while (!job->done) {
+    }
+    return job->status;
+}
+
+void hpm_memcpy_async_get_stats(hpm_memcpy_async_stats_t *stats)
+{
+    uint32_t level = memcpy_async_enter_critical();
+    *stats = HPM_MEMCPY_ASYNC->stats;
+    memcpy_async_exit_critical(level);
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_MEMCPY_ASYNC_H
+#define HPM_MEMCPY_ASYNC_H
+
+#include "hpm_common.h"
+#include "hpm_soc_feature.h"
+
+/**
+ * @brief Asynchronous memcpy and memset
+ *
+ * Copy and fill jobs are submitted with a completion callback and run on an engine: a DMA
+ * channel of the DMA manager (when CONFIG_DMA_MGR is set), the memcpy of the SDP (on the SoCs
+ * which have one) or the CPU. Each engine has its own queue, the jobs of a queue run in
+ * submission order and the done interrupt of an engine starts its next job.
+ *
+ * With memcpy_async_engine_auto, jobs smaller than the CPU threshold are done by the CPU on
+ * submission. The other jobs go to the hardware engine with the fewest bytes queued, a copy
+ * whose source is not word aligned is not given to the DMA, which would have to move it byte
+ * by byte.
+ *
+ * The queue does the cache maintenance: the source is written back on submission and the
+ * destination is invalidated. The engines only write the whole cache lines of the destination,
+ * the partial cache lines at its start and end are written by the CPU on submission, so the
+ * buffers need no alignment and the data around them is preserved.
+ *
+ * The DMA channel and the SDP are owned by the queue: the SDP interrupt is handled by the
+ * component, and the blocking SDP api (memcpy, AES, HASH) must not be used while SDP jobs
+ * are queued.
+ */
+
+#ifndef HPM_MEMCPY_ASYNC_CPU_THRESHOLD
+#define HPM_MEMCPY_ASYNC_CPU_THRESHOLD (1024U)  /**< default size below which the CPU does the job */
+#endif
+
+#ifndef USE_MEMCPY_ASYNC_DMA_MGR
+#define USE_MEMCPY_ASYNC_DMA_MGR (0U)
+#endif
+
+/**
+ * @brief memcpy async status codes
+ */
+enum {
+    status_memcpy_async_pending = MAKE_STATUS(status_group_memcpy_async, 0),    /**< Job is not done yet */
+    status_memcpy_async_no_engine = MAKE_STATUS(status_group_memcpy_async, 1),  /**< Engine is not available */
+};
+
+/**
+ * @brief memcpy async job types
+ */
+typedef enum {
+    memcpy_async_type_copy = 0,     /**< copy size bytes from src to dst */
+    memcpy_async_type_fill = 1,     /**< fill size bytes of dst with pattern */
+} memcpy_async_type_t;
+
+/**
+ * @brief memcpy async engines
+ */
+typedef enum {
+    memcpy_async_engine_auto = 0,   /**< chosen by size and alignment */
+    memcpy_async_engine_cpu = 1,    /**< CPU, on submission */
+    memcpy_async_engine_dma = 2,    /**< DMA channel of the DMA manager */
+    memcpy_async_engine_sdp = 3,    /**< memcpy of the SDP */
+    memcpy_async_engine_count = 4,
+} memcpy_async_engine_t;
+
+typedef struct memcpy_async_job memcpy_async_job_t;
+
+/**
+ * @brief Job done callback, called in interrupt context, or in the submission for the CPU engine
+ *
+ * The job is already done when the callback runs, the callback may submit it again.
+ */
+typedef void (*memcpy_async_cb_t)(memcpy_async_job_t *job, void *cb_data_ptr);
+
+/**
+ * @brief memcpy async job
+ */
+struct memcpy_async_job {
+    memcpy_async_type_t type;       /**< job type */
+    memcpy_async_engine_t engine;   /**< requested engine */
+    void *dst;                      /**< destination buffer */
+    const void *src;                /**< source buffer of a copy */
+    uint8_t pattern;                /**< byte pattern of a fill */
+    uint32_t size;                  /**< size in bytes */
+    memcpy_async_cb_t callback;     /**< done callback or NULL */
+    void *cb_data_ptr;              /**< user data of the callback */
+    memcpy_async_engine_t engine_used;  /**< engine running the job, set by the queue */
+    uint32_t xfer_offset;           /**< offset of the part done by the engine, set by the queue */
+    uint32_t xfer_size;             /**< size of the part done by the engine, set by the queue */
+    memcpy_async_job_t *next;       /**< next job of the engine queue, set by the queue */
+    volatile hpm_stat_t status;     /**< result of the job */
+    volatile bool done;             /**< set before the callback runs, the callback may submit the job again */
+};
+
+/**
+ * @brief memcpy async configuration
+ */
+typedef struct {
+    uint8_t running_core;       /**< core owning the buffers, for core_local_mem_to_sys_address */
+    bool use_dma;               /**< request a DMA channel from the DMA manager */
+    bool use_sdp;               /**< use the memcpy of the SDP */
+    uint8_t dma_irq_priority;   /**< DMA interrupt priority */
+    uint8_t sdp_irq_priority;   /**< SDP interrupt priority */
+    uint32_t cpu_threshold;     /**< jobs smaller than this are done by the CPU with memcpy_async_engine_auto */
+} hpm_memcpy_async_config_t;
+
+/**
+ * @brief memcpy async statistics, indexed by memcpy_async_engine_t
+ */
+typedef struct {
+    uint32_t jobs[memcpy_async_engine_count];   /**< jobs done by the engine */
+    uint64_t bytes[memcpy_async_engine_count];  /**< bytes moved by the engine, including the CPU parts */
+} hpm_memcpy_async_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get the default memcpy async configuration
+ *
+ * The DMA and the SDP are used if they are available.
+ *
+ * @param [out] config memcpy async configuration
+ */
+void hpm_memcpy_async_get_default_config(hpm_memcpy_async_config_t *config);
+
+/**
+ * @brief Initialize the memcpy async queues and enable the engine interrupts
+ *
+ * dma_mgr_init must have been called if the DMA is used.
+ *
+ * @param [in] config memcpy async configuration
+ * @retval status_success if no error occurred
+ * @retval status_invalid_argument if config is NULL
+ * @retval status_memcpy_async_no_engine if an engine of the configuration is not available
+ */
+hpm_stat_t hpm_memcpy_async_init(const hpm_memcpy_async_config_t *config);
+
+/**
+ * @brief Submit a job
+ *
+ * The job must not be modified until it is done, it can be submitted again once it is done.
+ * The buffers must not be accessed until the job is done.
+ *
+ * @param [in] job job
+ * @retval status_success if the job was queued or done by the CPU
+ * @retval status_invalid_argument if the job is invalid
+ * @retval status_memcpy_async_no_engine if the requested engine is not available
+ */
+hpm_stat_t hpm_memcpy_async_submit(memcpy_async_job_t *job);
+
+/**
+ * @brief Submit a copy job
+ *
+ * The engine, the callback and its data are taken from the job.
+ *
+ * @param [in] job job
+ * @param [out] dst destination buffer
+ * @param [in] src source buffer
+ * @param [in] size size in bytes
+ * @return see hpm_memcpy_async_submit
+ */
+hpm_stat_t hpm_memcpy_async_copy(memcpy_async_job_t *job, void *dst, const void *src, uint32_t size);
+
+/**
+ * @brief Submit a fill job
+ *
+ * The engine, the callback and its data are taken from the job.
+ *
+ * @param [in] job job
+ * @param [out] dst destination buffer
+ * @param [in] pattern byte pattern
+ * @param [in] size size in bytes
+ * @return see hpm_memcpy_async_submit
+ */
+hpm_stat_t hpm_memcpy_async_fill(memcpy_async_job_t *job, void *dst, uint8_t pattern, uint32_t size);
+
+/**
+ * @brief Check whether an engine runs a job or jobs are waiting
+ *
+ * @return true if a queue is busy
+ */
+bool hpm_memcpy_async_is_busy(void);
+
+/**
+ * @brief Check whether a job is done
+ *
+ * @param [in] job job
+ * @return true if the job is done
+ */
+static inline bool hpm_memcpy_async_is_done(const memcpy_async_job_t *job)
+{
+    return job->done;
+}
+
+/**
+ * @brief Wait until a job is done
+ *
+ * @param [in] job job
+ * @return result of the job
+ */
+hpm_stat_t hpm_memcpy_async_wait(const memcpy_async_job_t *job);
+
+/**
+ * @brief Get the statistics of the engines
+ *
+ * @param [out] stats statistics since the initialization
+ */
+void hpm_memcpy_async_get_stats(hpm_memcpy_async_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HPM_MEMCPY_ASYNC_H */
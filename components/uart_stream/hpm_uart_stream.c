@@ -0,0 +1,550 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "hpm_uart_stream.h"
+#include "hpm_soc.h"
+#include "hpm_interrupt.h"
+#include "hpm_l1c_drv.h"
+
+/*****************************************************************************************************************
+ *
+ *  Definitions
+ *
+ *****************************************************************************************************************/
+
+/* interrupts of the descriptors which do not end a chain */
+#define UART_STREAM_DMA_IRQ_MASK_NO_TC (DMA_MGR_INTERRUPT_MASK_TC | DMA_MGR_INTERRUPT_MASK_HALF_TC | DMA_MGR_INTERRUPT_MASK_ABORT)
+/* interrupts of the receive descriptors and of the last transmit descriptor of a chain */
+#define UART_STREAM_DMA_IRQ_MASK_TC (DMA_MGR_INTERRUPT_MASK_HALF_TC | DMA_MGR_INTERRUPT_MASK_ABORT)
+
+/*****************************************************************************************************************
+ *
+ *  Prototypes
+ *
+ *****************************************************************************************************************/
+
+static uint32_t uart_stream_enter_critical(void);
+static void uart_stream_exit_critical(uint32_t level);
+static void uart_stream_rx_update(uart_stream_t *stream);
+static void uart_stream_rx_event(uart_stream_t *stream);
+static void uart_stream_tx_start_next(uart_stream_t *stream);
+static void uart_stream_tx_complete(uart_stream_t *stream, uart_stream_tx_req_t *chain, hpm_stat_t status);
+
+/*****************************************************************************************************************
+ *
+ *  Codes
+ *
+ *****************************************************************************************************************/
+static uint32_t uart_stream_enter_critical(void)
+{
+    return disable_global_irq(CSR_MSTATUS_MIE_MASK);
+}
+
+static void uart_stream_exit_critical(uint32_t level)
+{
+    restore_global_irq(level);
+}
+
+static uint32_t uart_stream_sys_addr(uart_stream_t *stream, const void *addr)
+{
+    return core_local_mem_to_sys_address(stream->running_core, (uint32_t)addr);
+}
+
+static void uart_stream_cache_writeback(const void *buf, uint32_t size)
+{
+    if ((size > 0) && l1c_dc_is_enabled()) {
+        uint32_t start = HPM_L1C_CACHELINE_ALIGN_DOWN((uint32_t)buf);
+        uint32_t end = HPM_L1C_CACHELINE_ALIGN_UP((uint32_t)buf + size);
+        l1c_dc_writeback(start, end - start);
+    }
+}
+
+/* the receive buffer is only written by the dma, the whole cache lines around the data can be dropped */
+static void uart_stream_cache_invalidate(const void *buf, uint32_t size)
+{
+    if ((size > 0) && l1c_dc_is_enabled()) {
+        uint32_t start = HPM_L1C_CACHELINE_ALIGN_DOWN((uint32_t)buf);
+        uint32_t end = HPM_L1C_CACHELINE_ALIGN_UP((uint32_t)buf + size);
+        l1c_dc_invalidate(start, end - start);
+    }
+}
+
+/* position of the receive dma in the receive buffer */
+static uint32_t uart_stream_rx_dma_pos(uart_stream_t *stream)
+{
+    DMA_Type *base = stream->rx_dma.base;
+    uint32_t channel = stream->rx_dma.channel;
+    uint32_t llp;
+    uint32_t remaining;
+    uint32_t next;
+    uint32_t segment;
+
+    /* the remaining size belongs to the descriptor before the linked one, read both on the same descriptor */
+    do {
+        llp = base->CHCTRL[channel].LLPOINTER;
+        (void) dma_mgr_get_chn_remaining_transize(&stream->rx_dma, &remaining);
+    } while (llp != base->CHCTRL[channel].LLPOINTER);
+
+    next = ((llp & ~0x7UL) - uart_stream_sys_addr(stream, &stream->rx_desc[0])) / sizeof(dma_mgr_linked_descriptor_t);
+    segment = (next + UART_STREAM_RX_SEGMENTS - 1U) % UART_STREAM_RX_SEGMENTS;
+
+    return (segment * stream->rx_seg_size + stream->rx_seg_size - remaining) % stream->rx_size;
+}
+
+/* must be called at least once per segment, the dma interrupt at the end of each segment does */
+static void uart_stream_rx_update(uart_stream_t *stream)
+{
+    uint32_t level = uart_stream_enter_critical();
+    uint32_t pos = uart_stream_rx_dma_pos(stream);
+    uint32_t delta = (pos + stream->rx_size - stream->rx_pos) % stream->rx_size;
+    uint32_t used;
+
+    stream->rx_pos = pos;
+    stream->rx_in += delta;
+    stream->stats.rx_bytes += delta;
+
+    /* the dma wrote over the oldest data */
+    used = stream->rx_in - stream->rx_out;
+    if (used > stream->rx_size) {
+        uint32_t lost = used - stream->rx_size;
+
+        stream->rx_out += lost;
+        stream->rx_out_pos = (stream->rx_out_pos + lost) % stream->rx_size;
+        stream->stats.rx_lost += lost;
+    }
+    uart_stream_exit_critical(level);
+}
+
+static void uart_stream_rx_deliver(uart_stream_t *stream)
+{
+    uint32_t level;
+
+    /* an event during the callback is handled by the callback loop */
+    level = uart_stream_enter_critical();
+    if (stream->rx_delivering) {
+        stream->rx_pending = true;
+        uart_stream_exit_critical(level);
+        return;
+    }
+    stream->rx_delivering = true;
+    uart_stream_exit_critical(level);
+
+    while (1) {
+        stream->rx_pending = false;
+        while (1) {
+            const uint8_t *data;
+            uint32_t size = hpm_uart_stream_rx_peek(stream, &data);
+            uint32_t consumed;
+
+            if (size == 0U) {
+                break;
+            }
+            consumed = stream->rx_callback(stream, data, size, stream->rx_cb_data_ptr);
+            if (consumed > size) {
+                consumed = size;
+            }
+            hpm_uart_stream_rx_release(stream, consumed);
+            if (consumed < size) {
+                break;
+            }
+        }
+
+        level = uart_stream_enter_critical();
+        if (!stream->rx_pending) {
+            stream->rx_delivering = false;
+            uart_stream_exit_critical(level);
+            break;
+        }
+        uart_stream_exit_critical(level);
+    }
+}
+
+static void uart_stream_rx_event(uart_stream_t *stream)
+{
+    if (stream->rx_callback != NULL) {
+        uart_stream_rx_deliver(stream);
+    } else {
+        uart_stream_rx_update(stream);
+    }
+}
+
+static void uart_stream_rx_dma_tc_callback(DMA_Type *base, uint32_t channel, void *cb_data_ptr)
+{
+    (void) base;
+    (void) channel;
+    uart_stream_rx_event((uart_stream_t *)cb_data_ptr);
+}
+
+static void uart_stream_rx_dma_error_callback(DMA_Type *base, uint32_t channel, void *cb_data_ptr)
+{
+    (void) base;
+    (void) channel;
+    ((uart_stream_t *)cb_data_ptr)->stats.dma_errors++;
+}
+
+static hpm_stat_t uart_stream_rx_start(uart_stream_t *stream, const uart_stream_config_t *config)
+{
+    dma_mgr_chn_conf_t chn_config;
+    hpm_stat_t status;
+
+    dma_mgr_get_default_chn_config(&chn_config);
+    chn_config.en_dmamux = true;
+    chn_config.dmamux_src = config->rx_dma_req;
+    chn_config.src_mode = DMA_MGR_HANDSHAKE_MODE_HANDSHAKE;
+    chn_config.dst_mode = DMA_MGR_HANDSHAKE_MODE_NORMAL;
+    chn_config.src_width = DMA_MGR_TRANSFER_WIDTH_BYTE;
+    chn_config.dst_width = DMA_MGR_TRANSFER_WIDTH_BYTE;
+    chn_config.src_burst_size = DMA_MGR_NUM_TRANSFER_PER_BURST_1T;
+    chn_config.src_addr_ctrl = DMA_MGR_ADDRESS_CONTROL_FIXED;
+    chn_config.dst_addr_ctrl = DMA_MGR_ADDRESS_CONTROL_INCREMENT;
+    chn_config.interrupt_mask = UART_STREAM_DMA_IRQ_MASK_TC;
+    chn_config.src_addr = (uint32_t)&stream->uart->RBR;
+    chn_config.size_in_byte = stream->rx_seg_size;
+
+    /* a ring of descriptors, the channel starts with the first segment */
+    for (uint32_t i = 0; i < UART_STREAM_RX_SEGMENTS; i++) {
+        chn_config.dst_addr = uart_stream_sys_addr(stream, stream->rx_buf + i * stream->rx_seg_size);
+        chn_config.linked_ptr = uart_stream_sys_addr(stream, &stream->rx_desc[(i + 1U) % UART_STREAM_RX_SEGMENTS]);
+        status = dma_mgr_config_linked_descriptor(&stream->rx_dma, &chn_config, &stream->rx_desc[i]);
+        if (status != status_success) {
+            return status;
+        }
+    }
+    uart_stream_cache_writeback(stream->rx_desc, sizeof(stream->rx_desc));
+
+    chn_config.dst_addr = uart_stream_sys_addr(stream, stream->rx_buf);
+    chn_config.linked_ptr = uart_stream_sys_addr(stream, &stream->rx_desc[1U % UART_STREAM_RX_SEGMENTS]);
+    status = dma_mgr_setup_channel(&stream->rx_dma, &chn_config);
+    if (status != status_success) {
+        return status;
+    }
+    return dma_mgr_enable_channel(&stream->rx_dma);
+}
+
+static void uart_stream_tx_config(uart_stream_t *stream, dma_mgr_chn_conf_t *chn_config, const uart_stream_tx_req_t *req)
+{
+    chn_config->src_addr = uart_stream_sys_addr(stream, req->data);
+    chn_config->size_in_byte = req->size;
+    if (req->next != NULL) {
+        chn_config->interrupt_mask = UART_STREAM_DMA_IRQ_MASK_NO_TC;
+    } else {
+        chn_config->interrupt_mask = UART_STREAM_DMA_IRQ_MASK_TC;
+        chn_config->linked_ptr = 0;
+    }
+}
+
+static void uart_stream_tx_start_next(uart_stream_t *stream)
+{
+    dma_mgr_chn_conf_t chn_config;
+    uart_stream_tx_req_t *chain;
+    uart_stream_tx_req_t *req;
+    uint32_t count;
+    uint32_t level;
+    hpm_stat_t status;
+
+    /* the chain owns the channel until it is done */
+    level = uart_stream_enter_critical();
+    if ((stream->tx_active != NULL) || (stream->tx_head == NULL)) {
+        uart_stream_exit_critical(level);
+        return;
+    }
+    chain = stream->tx_head;
+    req = chain;
+    for (count = 0; (count < UART_STREAM_TX_DESC_COUNT) && (req->next != NULL); count++) {
+        req = req->next;
+    }
+    stream->tx_head = req->next;
+    if (stream->tx_head == NULL) {
+        stream->tx_tail = NULL;
+    }
+    req->next = NULL;
+    stream->tx_active = chain;
+    stream->stats.tx_chains++;
+    uart_stream_exit_critical(level);
+
+    dma_mgr_get_default_chn_config(&chn_config);
+    chn_config.en_dmamux = true;
+    chn_config.dmamux_src = stream->tx_dma_req;
+    chn_config.src_mode = DMA_MGR_HANDSHAKE_MODE_NORMAL;
+    chn_config.dst_mode = DMA_MGR_HANDSHAKE_MODE_HANDSHAKE;
+    chn_config.src_width = DMA_MGR_TRANSFER_WIDTH_BYTE;
+    chn_config.dst_width = DMA_MGR_TRANSFER_WIDTH_BYTE;
+    chn_config.src_burst_size = DMA_MGR_NUM_TRANSFER_PER_BURST_1T;
+    chn_config.src_addr_ctrl = DMA_MGR_ADDRESS_CONTROL_INCREMENT;
+    chn_config.dst_addr_ctrl = DMA_MGR_ADDRESS_CONTROL_FIXED;
+    chn_config.dst_addr = (uint32_t)&stream->uart->THR;
+
+    /* the first request is loaded in the channel, the next ones in the descriptors */
+    req = chain->next;
+    for (uint32_t i = 0; req != NULL; i++, req = req->next) {
+        chn_config.linked_ptr = uart_stream_sys_addr(stream, &stream->tx_desc[i + 1U]);
+        uart_stream_tx_config(stream, &chn_config, req);
+        (void) dma_mgr_config_linked_descriptor(&stream->tx_dma, &chn_config, &stream->tx_desc[i]);
+    }
+    uart_stream_cache_writeback(stream->tx_desc, sizeof(stream->tx_desc));
+
+    chn_config.linked_ptr = uart_stream_sys_addr(stream, &stream->tx_desc[0]);
+    uart_stream_tx_config(stream, &chn_config, chain);
+    status = dma_mgr_setup_channel(&stream->tx_dma, &chn_config);
+    if (status == status_success) {
+        status = dma_mgr_enable_channel(&stream->tx_dma);
+    }
+    if (status != status_success) {
+        stream->tx_active = NULL;
+        uart_stream_tx_complete(stream, chain, status);
+        uart_stream_tx_start_next(stream);
+    }
+}
+
+static void uart_stream_tx_complete(uart_stream_t *stream, uart_stream_tx_req_t *chain, hpm_stat_t status)
+{
+    while (chain != NULL) {
+        uart_stream_tx_req_t *req = chain;
+
+        chain = req->next;
+        req->next = NULL;
+        if (status == status_success) {
+            stream->stats.tx_bytes += req->size;
+            stream->stats.tx_requests++;
+        }
+        /* done before the callback, so that the callback can queue the request again */
+        req->status = status;
+        req->done = true;
+        if (req->callback != NULL) {
+            req->callback(stream, req, req->cb_data_ptr);
+        }
+    }
+}
+
+static void uart_stream_tx_chain_done(uart_stream_t *stream, hpm_stat_t status)
+{
+    uart_stream_tx_req_t *chain = stream->tx_active;
+
+    /* the next chain is started before the callbacks run, the line is not left idle meanwhile */
+    stream->tx_active = NULL;
+    uart_stream_tx_start_next(stream);
+    uart_stream_tx_complete(stream, chain, status);
+}
+
+static void uart_stream_tx_dma_tc_callback(DMA_Type *base, uint32_t channel, void *cb_data_ptr)
+{
+    (void) base;
+    (void) channel;
+    uart_stream_tx_chain_done((uart_stream_t *)cb_data_ptr, status_success);
+}
+
+static void uart_stream_tx_dma_error_callback(DMA_Type *base, uint32_t channel, void *cb_data_ptr)
+{
+    uart_stream_t *stream = (uart_stream_t *)cb_data_ptr;
+
+    (void) base;
+    (void) channel;
+    stream->stats.dma_errors++;
+    uart_stream_tx_chain_done(stream, status_dma_transfer_error);
+}
+
+static hpm_stat_t uart_stream_dma_init(uart_stream_t *stream, dma_resource_t *resource, uint8_t priority,
+                                       dma_mgr_chn_cb_t tc_callback, dma_mgr_chn_cb_t error_callback)
+{
+    hpm_stat_t status;
+
+    status = dma_mgr_request_resource(resource);
+    if (status != status_success) {
+        return status;
+    }
+    (void) dma_mgr_install_chn_tc_callback(resource, tc_callback, stream);
+    (void) dma_mgr_install_chn_error_callback(resource, error_callback, stream);
+    return dma_mgr_enable_dma_irq_with_priority(resource, priority);
+}
+
+void hpm_uart_stream_get_default_config(uart_stream_config_t *config)
+{
+    memset(config, 0, sizeof(*config));
+    config->baudrate = 115200U;
+    config->hw_flow_control = false;
+    config->running_core = HPM_CORE0;
+    config->dma_irq_priority = 1U;
+    config->rx_idle_threshold = 20U; /* two characters of 8-N-1 */
+}
+
+hpm_stat_t hpm_uart_stream_init(uart_stream_t *stream, const uart_stream_config_t *config)
+{
+    uart_config_t uart_config;
+    hpm_stat_t status;
+
+    if ((stream == NULL) || (config == NULL) || (config->uart == NULL) || (config->rx_buf == NULL) ||
+        (config->rx_size == 0U) || ((config->rx_size % (UART_STREAM_RX_SEGMENTS * HPM_L1C_CACHELINE_SIZE)) != 0U) ||
+        (((uint32_t)config->rx_buf % HPM_L1C_CACHELINE_SIZE) != 0U)) {
+        return status_invalid_argument;
+    }
+
+    memset(stream, 0, sizeof(*stream));
+    stream->uart = config->uart;
+    stream->running_core = config->running_core;
+    stream->tx_dma_req = config->tx_dma_req;
+    stream->rx_buf = config->rx_buf;
+    stream->rx_size = config->rx_size;
+    stream->rx_seg_size = config->rx_size / UART_STREAM_RX_SEGMENTS;
+    stream->rx_callback = config->rx_callback;
+    stream->rx_cb_data_ptr = config->rx_cb_data_ptr;
+
+    /* the dma takes each byte, the rx fifo level must stay at not empty */
+    uart_default_config(config->uart, &uart_config);
+    uart_config.src_freq_in_hz = config->src_freq_in_hz;
+    uart_config.baudrate = config->baudrate;
+    uart_config.fifo_enable = true;
+    uart_config.dma_enable = true;
+    uart_config.rx_fifo_level = uart_rx_fifo_trg_not_empty;
+    uart_config.tx_fifo_level = uart_tx_fifo_trg_not_full;
+    uart_config.modem_config.auto_flow_ctrl_en = config->hw_flow_control;
+#if defined(HPM_IP_FEATURE_UART_RX_IDLE_DETECT) && (HPM_IP_FEATURE_UART_RX_IDLE_DETECT == 1)
+    uart_config.rxidle_config.detect_enable = true;
+    uart_config.rxidle_config.detect_irq_enable = true;
+    uart_config.rxidle_config.idle_cond = uart_rxline_idle_cond_rxline_logic_one;
+    uart_config.rxidle_config.threshold = config->rx_idle_threshold;
+#endif
+    status = uart_init(config->uart, &uart_config);
+    if (status != status_success) {
+        return status;
+    }
+
+    status = uart_stream_dma_init(stream, &stream->rx_dma, config->dma_irq_priority,
+                                  uart_stream_rx_dma_tc_callback, uart_stream_rx_dma_error_callback);
+    if (status != status_success) {
+        return status;
+    }
+    status = uart_stream_dma_init(stream, &stream->tx_dma, config->dma_irq_priority,
+                                  uart_stream_tx_dma_tc_callback, uart_stream_tx_dma_error_callback);
+    if (status != status_success) {
+        (void) dma_mgr_release_resource(&stream->rx_dma);
+        return status;
+    }
+
+    status = uart_stream_rx_start(stream, config);
+    if (status != status_success) {
+        hpm_uart_stream_deinit(stream);
+    }
+    return status;
+}
+
+void hpm_uart_stream_deinit(uart_stream_t *stream)
+{
+#if defined(HPM_IP_FEATURE_UART_RX_IDLE_DETECT) && (HPM_IP_FEATURE_UART_RX_IDLE_DETECT == 1)
+    uart_disable_irq(stream->uart, uart_intr_rx_line_idle);
+    uart_disable_rxline_idle_detection(stream->uart);
+#endif
+    (void) dma_mgr_disable_channel(&stream->rx_dma);
+    (void) dma_mgr_disable_channel(&stream->tx_dma);
+    (void) dma_mgr_release_resource(&stream->rx_dma);
+    (void) dma_mgr_release_resource(&stream->tx_dma);
+    stream->tx_head = NULL;
+    stream->tx_tail = NULL;
+    stream->tx_active = NULL;
+}
+
+void hpm_uart_stream_uart_isr(uart_stream_t *stream)
+{
+#if defined(HPM_IP_FEATURE_UART_RX_IDLE_DETECT) && (HPM_IP_FEATURE_UART_RX_IDLE_DETECT == 1)
+    if (uart_is_rxline_idle(stream->uart)) {
+        uart_clear_rxline_idle_flag(stream->uart);
+        stream->stats.rx_idle++;
+        uart_stream_rx_event(stream);
+    }
+#else
+    (void) stream;
+#endif
+}
+
+hpm_stat_t hpm_uart_stream_submit(uart_stream_t *stream, uart_stream_tx_req_t *req)
+{
+    uint32_t level;
+
+    if ((stream == NULL) || (req == NULL) || (req->data == NULL) || (req->size == 0U)) {
+        return status_invalid_argument;
+    }
+
+    uart_stream_cache_writeback(req->data, req->size);
+    req->next = NULL;
+    req->status = status_uart_stream_busy;
+    req->done = false;
+
+    level = uart_stream_enter_critical();
+    if (stream->tx_tail != NULL) {
+        stream->tx_tail->next = req;
+    } else {
+        stream->tx_head = req;
+    }
+    stream->tx_tail = req;
+    uart_stream_exit_critical(level);
+
+    uart_stream_tx_start_next(stream);
+    return status_success;
+}
+
+hpm_stat_t hpm_uart_stream_send(uart_stream_t *stream, uart_stream_tx_req_t *req, const void *data, uint32_t size)
+{
+    if (req == NULL) {
+        return status_invalid_argument;
+    }
+    req->data = (const uint8_t *)data;
+    req->size = size;
+    return hpm_uart_stream_submit(stream, req);
+}
+
+bool hpm_uart_stream_tx_is_busy(uart_stream_t *stream)
+{
+    return (stream->tx_active != NULL) || (stream->tx_head != NULL);
+}
+
+uint32_t hpm_uart_stream_rx_peek(uart_stream_t *stream, const uint8_t **data)
+{
+    uint32_t level;
+    uint32_t used;
+    uint32_t pos;
+
+    uart_stream_rx_update(stream);
+
+    level = uart_stream_enter_critical();
+    used = stream->rx_in - stream->rx_out;
+    pos = stream->rx_out_pos;
+    uart_stream_exit_critical(level);
+
+    if (used > (stream->rx_size - pos)) {
+        used = stream->rx_size - pos;
+    }
+    *data = stream->rx_buf + pos;
+    uart_stream_cache_invalidate(*data, used);
+    return used;
+}
+
+void hpm_uart_stream_rx_release(uart_stream_t *stream, uint32_t size)
+{
+    uint32_t level = uart_stream_enter_critical();
+    uint32_t used = stream->rx_in - stream->rx_out;
+
+    /* the data lost meanwhile was already dropped */
+    if (size > used) {
+        size = used;
+    }
+    stream->rx_out += size;
+    stream->rx_out_pos = (stream->rx_out_pos + size) % stream->rx_size;
+    uart_stream_exit_critical(level);
+}
+
+void hpm_uart_stream_rx_poll(uart_stream_t *stream)
+{
+    uart_stream_rx_event(stream);
+}
+
+void hpm_uart_stream_get_stats(uart_stream_t *stream, uart_stream_stats_t *stats)
+{
+    uint32_t level = uart_stream_enter_critical();
+
+    *stats = stream->stats;
+    uart_stream_exit_critical(level);
+}
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_UART_STREAM_H
+#define HPM_UART_STREAM_H
+
+#include "hpm_common.h"
+#include "hpm_soc_feature.h"
+#include "hpm_uart_drv.h"
+#include "hpm_dma_mgr.h"
+
+/**
+ * @brief UART stream over DMA
+ *
+ * Reception runs without stop: a DMA channel writes the received bytes into a receive buffer
+ * in a loop, through a ring of UART_STREAM_RX_SEGMENTS linked descriptors each covering a
+ * segment of the buffer. The write position is taken from the remaining transfer size of the
+ * channel, so that no byte is copied nor handled by the CPU on reception. The received data is
+ * handed to the receive callback, in place, at the end of each segment and when the RX line
+ * goes idle, so that a frame shorter than a segment is not held until more data arrives.
+ *
+ * Transmission runs from a queue of requests, each one a buffer sent in place: the waiting
+ * requests are gathered into a chain, the first one loaded in the channel and up to
+ * UART_STREAM_TX_DESC_COUNT more in linked descriptors. Only the last request of a chain raises
+ * an interrupt, which starts the next chain and completes the requests of the chain.
+ *
+ * Each stream has its own UART and DMA channels, several streams run at once.
+ *
+ * The receive DMA does not wait for the application: if the received data is not released
+ * before the DMA wrote the size of the receive buffer after it, the oldest data is dropped and
+ * counted as lost. The receive buffer must be large enough for the latency of the application.
+ *
+ * The application owns the UART interrupt, it calls hpm_uart_stream_uart_isr from it. On the
+ * SoCs without RX line idle detection, the data of a partial segment is handed over by
+ * hpm_uart_stream_rx_poll.
+ */
+
+#ifndef UART_STREAM_RX_SEGMENTS
+#define UART_STREAM_RX_SEGMENTS     (4U)    /**< receive descriptors, the receive buffer is split in as many segments */
+#endif
+
+#ifndef UART_STREAM_TX_DESC_COUNT
+#define UART_STREAM_TX_DESC_COUNT   (8U)    /**< transmit descriptors, requests of a transmit chain after the first one */
+#endif
+
+/**
+ * @brief UART stream status codes
+ */
+enum {
+    status_uart_stream_busy = MAKE_STATUS(status_group_uart_stream, 0),     /**< Request is queued or sent */
+};
+
+typedef struct uart_stream uart_stream_t;
+typedef struct uart_stream_tx_req uart_stream_tx_req_t;
+
+/**
+ * @brief Receive callback, called in interrupt context, or in hpm_uart_stream_rx_poll
+ *
+ * data points into the receive buffer, it is valid until the callback returns. The bytes not
+ * consumed are handed over again with the next data.
+ *
+ * @return number of bytes consumed
+ */
+typedef uint32_t (*uart_stream_rx_cb_t)(uart_stream_t *stream, const uint8_t *data, uint32_t size, void *cb_data_ptr);
+
+/**
+ * @brief Transmit done callback, called in interrupt context
+ *
+ * The request is already done when the callback runs, the callback may queue it again.
+ */
+typedef void (*uart_stream_tx_cb_t)(uart_stream_t *stream, uart_stream_tx_req_t *req, void *cb_data_ptr);
+
+/**
+ * @brief UART stream transmit request
+ */
+struct uart_stream_tx_req {
+    const uint8_t *data;            /**< data sent in place */
+    uint32_t size;                  /**< size in bytes */
+    uart_stream_tx_cb_t callback;   /**< done callback or NULL */
+    void *cb_data_ptr;              /**< user data of the callback */
+    uart_stream_tx_req_t *next;     /**< next request of the queue, set by the stream */
+    volatile hpm_stat_t status;     /**< result of the request, status_uart_stream_busy until it is done */
+    volatile bool done;             /**< set before the callback runs, the callback may queue the request again */
+};
+
+/**
+ * @brief UART stream configuration
+ */
+typedef struct {
+    UART_Type *uart;                /**< UART, its pins and clock are set up by the application */
+    uint32_t src_freq_in_hz;        /**< UART source clock frequency */
+    uint32_t baudrate;              /**< baudrate */
+    bool hw_flow_control;           /**< RTS/CTS flow control */
+    uint8_t rx_dma_req;             /**< DMAMUX source of the UART RX */
+    uint8_t tx_dma_req;             /**< DMAMUX source of the UART TX */
+    uint8_t running_core;           /**< core owning the buffers, for core_local_mem_to_sys_address */
+    uint8_t dma_irq_priority;       /**< DMA interrupt priority */
+    uint8_t rx_idle_threshold;      /**< RX line idle duration in bits which hands over the received data */
+    uint8_t *rx_buf;                /**< receive buffer, aligned to HPM_L1C_CACHELINE_SIZE */
+    uint32_t rx_size;               /**< receive buffer size, a multiple of UART_STREAM_RX_SEGMENTS cache lines */
+    uart_stream_rx_cb_t rx_callback;    /**< receive callback or NULL */
+    void *rx_cb_data_ptr;           /**< user data of the receive callback */
+} uart_stream_config_t;
+
+/**
+ * @brief UART stream statistics
+ */
+typedef struct {
+    uint32_t rx_bytes;              /**< bytes received */
+    uint32_t rx_lost;               /**< bytes overwritten before they were released */
+    uint32_t rx_idle;               /**< RX line idle events */
+    uint32_t tx_bytes;              /**< bytes sent */
+    uint32_t tx_requests;           /**< requests sent */
+    uint32_t tx_chains;             /**< descriptor chains started */
+    uint32_t dma_errors;            /**< DMA transfer errors */
+} uart_stream_stats_t;
+
+/**
+ * @brief UART stream, the descriptors are written back from the data cache before the DMA reads them
+ */
+struct uart_stream {
+    dma_mgr_linked_descriptor_t rx_desc[UART_STREAM_RX_SEGMENTS] ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE);
+    dma_mgr_linked_descriptor_t tx_desc[UART_STREAM_TX_DESC_COUNT] ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE);
+    UART_Type *uart;
+    uint8_t running_core;
+    uint8_t tx_dma_req;
+    dma_resource_t rx_dma;
+    dma_resource_t tx_dma;
+    uint8_t *rx_buf;
+    uint32_t rx_size;
+    uint32_t rx_seg_size;
+    uint32_t rx_pos;                /**< DMA position in the receive buffer at the last update */
+    uint32_t rx_out_pos;            /**< position of the oldest data not released */
+    volatile uint32_t rx_in;        /**< bytes received */
+    volatile uint32_t rx_out;       /**< bytes released or lost */
+    volatile bool rx_delivering;    /**< the receive callback runs */
+    volatile bool rx_pending;       /**< data arrived while the receive callback ran */
+    uart_stream_rx_cb_t rx_callback;
+    void *rx_cb_data_ptr;
+    uart_stream_tx_req_t *tx_head;  /**< requests waiting for a chain */
+    uart_stream_tx_req_t *tx_tail;
+    uart_stream_tx_req_t *volatile tx_active;   /**< requests of the running chain */
+    uart_stream_stats_t stats;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get the default UART stream configuration
+ *
+ * @param [out] config UART stream configuration
+ */
+void hpm_uart_stream_get_default_config(uart_stream_config_t *config);
+
+/**
+ * @brief Initialize a UART stream and start the reception
+ *
+ * The UART is initialized with its FIFO and DMA requests enabled, and the RX line idle detection
+ * where available. dma_mgr_init must have been called.
+ *
+ * @param [out] stream UART stream
+ * @param [in] config UART stream configuration
+ * @retval status_success if no error occurred
+ * @retval status_invalid_argument if the configuration is invalid
+ */
+hpm_stat_t hpm_uart_stream_init(uart_stream_t *stream, const uart_stream_config_t *config);
+
+/**
+ * @brief Stop a UART stream and release its DMA channels
+ *
+ * The waiting and running transmit requests are not completed.
+ *
+ * @param [in] stream UART stream
+ */
+void hpm_uart_stream_deinit(uart_stream_t *stream);
+
+/**
+ * @brief UART interrupt handler, called by the application from the UART interrupt
+ *
+ * @param [in] stream UART stream
+ */
+void hpm_uart_stream_uart_isr(uart_stream_t *stream);
+
+/**
+ * @brief Queue a transmit request
+ *
+ * The request must not be modified until it is done, it can be queued again once it is done.
+ * The data must not be modified until the request is done.
+ *
+ * @param [in] stream UART stream
+ * @param [in] req transmit request
+ * @retval status_success if the request was queued
+ * @retval status_invalid_argument if the request is invalid
+ */
+hpm_stat_t hpm_uart_stream_submit(uart_stream_t *stream, uart_stream_tx_req_t *req);
+
+/**
+ * @brief Queue the transmission of a buffer
+ *
+ * The callback and its data are taken from the request.
+ *
+ * @param [in] stream UART stream
+ * @param [in] req transmit request
+ * @param [in] data data sent in place
+ * @param [in] size size in bytes
+ * @return see hpm_uart_stream_submit
+ */
+hpm_stat_t hpm_uart_stream_send(uart_stream_t *stream, uart_stream_tx_req_t *req, const void *data, uint32_t size);
+
+/**
+ * @brief Check whether a transmit request is done
+ *
+ * @param [in] req transmit request
+ * @return true if the request is done
+ */
+static inline bool hpm_uart_stream_tx_is_done(const uart_stream_tx_req_t *req)
+{
+    return req->done;
+}
+
+/**
+ * @brief Check whether transmit requests are waiting or sent
+ *
+ * @param [in] stream UART stream
+ * @return true if the transmission is busy
+ */
+bool hpm_uart_stream_tx_is_busy(uart_stream_t *stream);
+
+/**
+ * @brief Get the received data not released yet
+ *
+ * The data is in place in the receive buffer, up to its end, the data from the start of the
+ * buffer is got once this part is released. Used without receive callback.
+ *
+ * @param [in] stream UART stream
+ * @param [out] data received data
+ * @return size in bytes
+ */
+uint32_t hpm_uart_stream_rx_peek(uart_stream_t *stream, const uint8_t **data);
+
+/**
+ * @brief Release received data
+ *
+ * @param [in] stream UART stream
+ * @param [in] size size in bytes, at most the size got by hpm_uart_stream_rx_peek
+ */
+void hpm_uart_stream_rx_release(uart_stream_t *stream, uint32_t size);
+
+/**
+ * @brief Hand the received data over to the receive callback
+ *
+ * For the data of a partial segment on the SoCs without RX line idle detection, or the data not
+ * consumed by the callback.
+ *
+ * @param [in] stream UART stream
+ */
+void hpm_uart_stream_rx_poll(uart_stream_t *stream);
+
+/**
+ * @brief Get the UART stream statistics
+ *
+ * @param [in] stream UART stream
+ * @param [out] stats statistics
+ */
+void hpm_uart_stream_get_stats(uart_stream_t *stream, uart_stream_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HPM_UART_STREAM_H */
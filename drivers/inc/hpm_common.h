@@ -173,6 +173,10 @@ enum {
     status_group_touch,
     status_group_plb_qei_encoder,
     status_group_pmbus,
+    status_group_ffa_job,
+    status_group_memcpy_async,
+    status_group_ipc_channel,
+    status_group_uart_stream,
 };
 
 /* @brief Common status code definitions */
@@ -220,6 +220,25 @@ static inline uint32_t ffa_get_fp_status(FFA_Type *ptr)
 
 #endif
 
+/**
+ * @brief Clear FFA status flags
+ *
+ * @param [in] ptr FFA base address
+ * @param [in] mask FFA status flags to clear
+ */
+static inline void ffa_clear_status(FFA_Type *ptr, uint32_t mask)
+{
+    ptr->STATUS = mask;
+}
+
+/**
+ * @brief Get the result of the last FFA operation from the status register value
+ *
+ * @param [in] ffa_status FFA status register value
+ * @return status_success or the FFA error code
+ */
+hpm_stat_t ffa_get_operation_status(uint32_t ffa_status);
+
 /**
  * @brief Start an FFT operation
  *
@@ -122,6 +122,7 @@ typedef enum {
 /**
  * @brief Bitfield definitions for the PKT_CTRL
  */
+#define SDP_PKT_CTRL_PKTINT_MASK (1U << 1)
 #define SDP_PKT_CTRL_DERSEMA_MASK (1U << 2)
 #define SDP_PKT_CTRL_CHAIN_MASK (1U << 3)
 #define SDP_PKT_CTRL_HASHINIT_MASK (1U << 4)
@@ -627,6 +628,34 @@ hpm_stat_t sdp_memcpy(SDP_Type *base, sdp_dma_ctx_t *sdp_ctx, void *dst, const v
  */
 hpm_stat_t sdp_memset(SDP_Type *base, sdp_dma_ctx_t *sdp_ctx, void *dst, uint8_t pattern, uint32_t length);
 
+/**
+ * @brief Start the DMA accelerated memcpy without waiting for it
+ * @note 1. The packet requests an interrupt, it is raised if the SDP interrupt is enabled, see sdp_enable_interrupt
+ *       2. The completion is reported by the SDP_STA_PKTCNT0 bit of the status, see sdp_get_operation_status
+ *       3. Without register descriptor, sdp_ctx must stay valid until the operation is done
+ * @param [in] base SDP base address
+ * @param [in] sdp_ctx SDP DMA context
+ * @param [out] dst Destination address for memcpy operation
+ * @param [in] src Source address for memcpy operation
+ * @param [in] length Length of the data to be copied
+ * @retval status_success if the operation was started
+ * @retval status_invalid_argument if length is 0
+ */
+hpm_stat_t sdp_start_memcpy(SDP_Type *base, sdp_dma_ctx_t *sdp_ctx, void *dst, const void *src, uint32_t length);
+
+/**
+ * @brief Start the DMA accelerated memset without waiting for it
+ * @note See sdp_start_memcpy
+ * @param [in] base SDP base address
+ * @param [in] sdp_ctx SDP DMA context
+ * @param [out] dst SDP destination address for memset operation
+ * @param [in] pattern pattern for memset operation
+ * @param [in] length length of the memory for memset operation
+ * @retval status_success if the operation was started
+ * @retval status_invalid_argument if length is 0
+ */
+hpm_stat_t sdp_start_memset(SDP_Type *base, sdp_dma_ctx_t *sdp_ctx, void *dst, uint8_t pattern, uint32_t length);
+
 /**
  * @brief Initialize the HASH engine
  * @param [in] base SDP base address
@@ -665,6 +694,14 @@ hpm_stat_t sdp_hash_finish(SDP_Type *base, sdp_hash_ctx_t *hash_ctx, uint8_t *di
  */
 hpm_stat_t sdp_wait_done(SDP_Type *base);
 
+/**
+ * @brief Convert the error bits of the SDP status to the status of the operation
+ * @param [in] sdp_sta SDP status, see sdp_get_status
+ *
+ * @return status_success if no error bit is set, or the status of the error.
+ */
+hpm_stat_t sdp_get_operation_status(uint32_t sdp_sta);
+
 
 /**
  * @brief Trigger SDP operation via the specified SDP packet description
@@ -115,6 +115,11 @@ static hpm_stat_t get_fft_error_kind(uint32_t ffa_status)
     return status;
 }
 
+hpm_stat_t ffa_get_operation_status(uint32_t ffa_status)
+{
+    return get_fft_error_kind(ffa_status);
+}
+
 hpm_stat_t ffa_calculate_fft_blocking(FFA_Type *ptr, fft_xfer_t *fft_xfer)
 {
     hpm_stat_t status = status_invalid_argument;
@@ -104,27 +104,34 @@ static uint8_t sdp_constant_time_cmp(const void *dst, const void *src, uint32_t
 /***********************************************************************************************************************
  * Codes
  **********************************************************************************************************************/
+hpm_stat_t sdp_get_operation_status(uint32_t sdp_sta)
+{
+    hpm_stat_t status;
+    if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRSET_MASK)) {
+        status = status_sdp_error_setup;
+    } else if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRPKT_MASK)) {
+        status = status_sdp_error_packet;
+    } else if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRSRC_MASK)) {
+        status = status_sdp_error_src;
+    } else if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRDST_MASK)) {
+        status = status_sdp_error_dst;
+    } else if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRHAS_MASK)) {
+        status = status_sdp_error_hash;
+    } else if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRCHAIN_MASK)) {
+        status = status_sdp_error_chain;
+    } else {
+        status = status_success;
+    }
+    return status;
+}
+
 hpm_stat_t sdp_wait_done(SDP_Type *base)
 {
     hpm_stat_t status;
     uint32_t sdp_sta;
     do {
         sdp_sta = base->STA;
-        if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRSET_MASK)) {
-            status = status_sdp_error_setup;
-        } else if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRPKT_MASK)) {
-            status = status_sdp_error_packet;
-        } else if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRSRC_MASK)) {
-            status = status_sdp_error_src;
-        } else if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRDST_MASK)) {
-            status = status_sdp_error_dst;
-        } else if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRHAS_MASK)) {
-            status = status_sdp_error_hash;
-        } else if (IS_HPM_BITMASK_SET(sdp_sta, SDP_STA_ERRCHAIN_MASK)) {
-            status = status_sdp_error_chain;
-        } else {
-            status = status_success;
-        }
+        status = sdp_get_operation_status(sdp_sta);
     } while (IS_HPM_BITMASK_CLR(sdp_sta, SDP_STA_PKTCNT0_MASK));
 
     return status;
@@ -901,28 +908,27 @@ hpm_stat_t sdp_hash_finish(SDP_Type *base, sdp_hash_ctx_t *hash_ctx, uint8_t *di
     return status;
 }
 
-hpm_stat_t sdp_memcpy(SDP_Type *base, sdp_dma_ctx_t *dma_ctx, void *dst, const void *src, uint32_t length)
+hpm_stat_t sdp_start_memcpy(SDP_Type *base, sdp_dma_ctx_t *dma_ctx, void *dst, const void *src, uint32_t length)
 {
     (void) dma_ctx;
-    hpm_stat_t status = status_invalid_argument;
 
     if (length == 0) {
-        status = status_success;
-        return status;
+        return status_invalid_argument;
     }
 
-    base->SDPCR = SDP_SDPCR_MCPEN_MASK;
+    /* keep the interrupt enable of the non-blocking users */
+    base->SDPCR = SDP_SDPCR_MCPEN_MASK | (base->SDPCR & SDP_SDPCR_INTEN_MASK);
 #if defined(SDP_REGISTER_DESCRIPTOR_COUNT) && SDP_REGISTER_DESCRIPTOR_COUNT
     base->SDPCR |= HPM_BITSMASK(1, 8);
     base->NPKTPTR = 0;
-    base->PKTCTL = SDP_PKT_CTRL_DERSEMA_MASK | SDP_PKTCTL_PKTTAG_SET(1);
+    base->PKTCTL = SDP_PKT_CTRL_DERSEMA_MASK | SDP_PKT_CTRL_PKTINT_MASK | SDP_PKTCTL_PKTTAG_SET(1);
     base->PKTSRC = (uint32_t) src;
     base->PKTDST = (uint32_t) dst;
     base->PKTBUF = length;
 #else
     sdp_pkt_struct_t *pkt_desc = &dma_ctx->sdp_pkt;
     pkt_desc->next_cmd = NULL;
-    pkt_desc->pkt_ctrl.PKT_CTRL = SDP_PKT_CTRL_DERSEMA_MASK;
+    pkt_desc->pkt_ctrl.PKT_CTRL = SDP_PKT_CTRL_DERSEMA_MASK | SDP_PKT_CTRL_PKTINT_MASK;
     pkt_desc->src_addr = (uint32_t) src;
     pkt_desc->dst_addr = (uint32_t) dst;
     pkt_desc->buf_size = length;
@@ -938,30 +944,49 @@ hpm_stat_t sdp_memcpy(SDP_Type *base, sdp_dma_ctx_t *dma_ctx, void *dst, const v
 #endif
     base->PKTCNT = 1;
 
-    status = sdp_wait_done(base);
+    return status_success;
+}
+
+hpm_stat_t sdp_memcpy(SDP_Type *base, sdp_dma_ctx_t *dma_ctx, void *dst, const void *src, uint32_t length)
+{
+    hpm_stat_t status;
+
+    if (length == 0) {
+        status = status_success;
+        return status;
+    }
+
+    status = sdp_start_memcpy(base, dma_ctx, dst, src, length);
+    if (status == status_success) {
+        status = sdp_wait_done(base);
+    }
 
     return status;
 }
 
-hpm_stat_t sdp_memset(SDP_Type *base, sdp_dma_ctx_t *sdp_ctx, void *dst, uint8_t pattern, uint32_t length)
+hpm_stat_t sdp_start_memset(SDP_Type *base, sdp_dma_ctx_t *sdp_ctx, void *dst, uint8_t pattern, uint32_t length)
 {
     (void) sdp_ctx;
-    hpm_stat_t status;
+
+    if (length == 0) {
+        return status_invalid_argument;
+    }
 
     uint32_t
     pattern_32 = (pattern) | ((uint32_t) pattern << 8) | ((uint32_t) pattern << 16) | ((uint32_t) pattern << 24);
 
-    base->SDPCR = SDP_SDPCR_CONFEN_MASK;
+    /* keep the interrupt enable of the non-blocking users */
+    base->SDPCR = SDP_SDPCR_CONFEN_MASK | (base->SDPCR & SDP_SDPCR_INTEN_MASK);
 #if defined(SDP_REGISTER_DESCRIPTOR_COUNT) && SDP_REGISTER_DESCRIPTOR_COUNT
     base->SDPCR |= HPM_BITSMASK(1, 8);
-    base->PKTCTL = SDP_PKT_CTRL_DERSEMA_MASK;
+    base->PKTCTL = SDP_PKT_CTRL_DERSEMA_MASK | SDP_PKT_CTRL_PKTINT_MASK;
     base->PKTSRC = (uint32_t) pattern_32;
     base->PKTDST = (uint32_t) dst;
     base->PKTBUF = length;
 #else
     sdp_pkt_struct_t *pkt_desc = &sdp_ctx->sdp_pkt;
     pkt_desc->next_cmd = NULL;
-    pkt_desc->pkt_ctrl.PKT_CTRL = SDP_PKT_CTRL_DERSEMA_MASK;
+    pkt_desc->pkt_ctrl.PKT_CTRL = SDP_PKT_CTRL_DERSEMA_MASK | SDP_PKT_CTRL_PKTINT_MASK;
     pkt_desc->src_addr = pattern_32;
     pkt_desc->dst_addr = (uint32_t) dst;
     pkt_desc->buf_size = length;
@@ -976,7 +1001,22 @@ hpm_stat_t sdp_memset(SDP_Type *base, sdp_dma_ctx_t *sdp_ctx, void *dst, uint8_t
 #endif
     base->PKTCNT = 1;
 
-    status = sdp_wait_done(base);
+    return status_success;
+}
+
+hpm_stat_t sdp_memset(SDP_Type *base, sdp_dma_ctx_t *sdp_ctx, void *dst, uint8_t pattern, uint32_t length)
+{
+    hpm_stat_t status;
+
+    if (length == 0) {
+        status = status_success;
+        return status;
+    }
+
+    status = sdp_start_memset(base, sdp_ctx, dst, pattern, length);
+    if (status == status_success) {
+        status = sdp_wait_done(base);
+    }
 
     return status;
 }
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025, HPMicro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host benchmark of chry_spsc_ringbuffer: a producer thread and a consumer
+ * thread move TOTAL_SIZE bytes through the ringbuffer, in chunks, in records,
+ * and from a simulated DMA which writes the pool and only shows its remaining
+ * size. The consumer checks every byte. The threads yield the CPU when the
+ * ringbuffer is full or empty.
+ *
+ * Before, the simulated DMA laps the consumer in a single thread, at set
+ * points of peek, read and linear read: the data it overwrote must be
+ * dropped and counted, the data returned must be the one not overwritten.
+ */
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "chry_spsc_ringbuffer.h"
+
+#define POOL_SIZE (64 * 1024)
+#ifndef TOTAL_SIZE
+#define TOTAL_SIZE (256 * 1024 * 1024UL)
+#endif
+
+static chry_spsc_ringbuffer_t rb __attribute__((aligned(CHRY_SPSC_RB_CACHELINE_SIZE)));
+static uint8_t pool[POOL_SIZE] __attribute__((aligned(CHRY_SPSC_RB_CACHELINE_SIZE)));
+
+static uint32_t chunk_size;
+static uint32_t dma_remaining;
+static unsigned long errors;
+
+static inline uint8_t pattern(uint64_t index)
+{
+    return (uint8_t)(index % 251);
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void *stream_producer(void *arg)
+{
+    uint8_t data[4096];
+    uint64_t index = 0;
+
+    (void)arg;
+    while (index < TOTAL_SIZE) {
+        uint32_t size = chunk_size;
+        uint32_t done;
+
+        for (uint32_t i = 0; i < size; i++) {
+            data[i] = pattern(index + i);
+        }
+        done = chry_spsc_ringbuffer_write(&rb, data, size);
+        while (done < size) {
+            sched_yield();
+            done += chry_spsc_ringbuffer_write(&rb, data + done, size - done);
+        }
+        index += size;
+    }
+    return NULL;
+}
+
+static void *record_producer(void *arg)
+{
+    uint8_t data[4096];
+    uint64_t index = 0;
+
+    (void)arg;
+    while (index < TOTAL_SIZE) {
+        /* sizes from 1 to chunk_size */
+        uint32_t size = 1 + (uint32_t)(index * 2654435761UL % chunk_size);
+
+        for (uint32_t i = 0; i < size; i++) {
+            data[i] = pattern(index + i);
+        }
+        while (!chry_spsc_ringbuffer_write_record(&rb, data, size)) {
+            sched_yield();
+        }
+        index += size;
+    }
+    return NULL;
+}
+
+static void *dma_producer(void *arg)
+{
+    uint64_t index = 0;
+    uint32_t position = 0;
+
+    (void)arg;
+    while (index < TOTAL_SIZE) {
+        uint32_t size = chunk_size;
+
+        /* the simulated DMA is paced by the consumer, it never overruns
+         * nor gets a whole pool ahead of the last update */
+        while ((uint32_t)index + size - __atomic_load_n(&rb.out, __ATOMIC_ACQUIRE) >= POOL_SIZE) {
+            sched_yield();
+        }
+        for (uint32_t i = 0; i < size; i++) {
+            pool[(position + i) % POOL_SIZE] = pattern(index + i);
+        }
+        position = (position + size) % POOL_SIZE;
+        index += size;
+        __atomic_store_n(&dma_remaining, POOL_SIZE - position, __ATOMIC_RELEASE);
+    }
+    return NULL;
+}
+
+static void check(const uint8_t *data, uint32_t size, uint64_t index)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        if (data[i] != pattern(index + i)) {
+            errors++;
+        }
+    }
+}
+
+static void consume_stream(void)
+{
+    uint8_t data[4096];
+    uint64_t index = 0;
+
+    while (index < TOTAL_SIZE) {
+        uint32_t size = chry_spsc_ringbuffer_read(&rb, data, sizeof(data));
+        if (size == 0) {
+            sched_yield();
+        }
+        check(data, size, index);
+        index += size;
+    }
+}
+
+static void consume_records(void)
+{
+    uint8_t data[4096];
+    uint64_t index = 0;
+
+    while (index < TOTAL_SIZE) {
+        uint32_t size = chry_spsc_ringbuffer_read_record(&rb, data, sizeof(data));
+        if (size == 0) {
+            sched_yield();
+        }
+        check(data, size, index);
+        index += size;
+    }
+}
+
+static void consume_dma(void)
+{
+    uint64_t index = 0;
+
+    while (index < TOTAL_SIZE) {
+        uint32_t size;
+        uint8_t *data;
+
+        chry_spsc_ringbuffer_dma_write_update(&rb, __atomic_load_n(&dma_remaining, __ATOMIC_ACQUIRE));
+        data = chry_spsc_ringbuffer_linear_read_setup(&rb, &size);
+        if (size == 0) {
+            sched_yield();
+        }
+        check(data, size, index);
+        chry_spsc_ringbuffer_linear_read_done(&rb, size);
+        index += size;
+    }
+}
+
+/* the simulated DMA of the overrun check, written in the thread of the consumer */
+static void dma_write(uint64_t *index, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        pool[(*index + i) % POOL_SIZE] = pattern(*index + i);
+    }
+    *index += size;
+    chry_spsc_ringbuffer_dma_write_update(&rb, POOL_SIZE - (uint32_t)(*index % POOL_SIZE));
+}
+
+static int expect(int ok, const char *what)
+{
+    if (!ok) {
+        printf("dma overrun check: %s failed\n", what);
+    }
+    return ok ? 0 : 1;
+}
+
+static int check_dma_overrun(void)
+{
+    static uint8_t data[4096];
+    uint64_t index = 0;
+    uint32_t size;
+    uint8_t *linear;
+    int failed = 0;
+
+    chry_spsc_ringbuffer_init(&rb, pool, POOL_SIZE);
+    errors = 0;
+
+    /* 1K read while the DMA is 1K short of a lap */
+    dma_write(&index, POOL_SIZE - 1024);
+    size = chry_spsc_ringbuffer_read(&rb, data, 1024);
+    check(data, size, 0);
+    failed += expect((size == 1024) && (errors == 0), "read before the lap");
+
+    /* the DMA laps the consumer by 2K, bytes 1K to 3K are overwritten, the
+     * consumer still has the write pointer of the first read cached */
+    dma_write(&index, 4096);
+    size = chry_spsc_ringbuffer_peek(&rb, data, 1024);
+    failed += expect((size == 0) && (chry_spsc_ringbuffer_get_dma_overrun(&rb) == 1024), "peek of overwritten data");
+    size = chry_spsc_ringbuffer_read(&rb, data, 2048);
+    check(data, size, 3072);
+    failed += expect((size == 2048) && (errors == 0) && (chry_spsc_ringbuffer_get_dma_overrun(&rb) == 2048),
+                     "read after the overwritten data");
+
+    /* the DMA overwrites the start of a linear read before it is done */
+    linear = chry_spsc_ringbuffer_linear_read_setup(&rb, &size);
+    failed += expect(size == POOL_SIZE - 5120, "linear read setup");
+    dma_write(&index, 8192);
+    size = chry_spsc_ringbuffer_linear_read_done(&rb, size);
+    if (size == POOL_SIZE - 11264) {
+        check(linear + 6144, size, 11264);
+    }
+    failed += expect((size == POOL_SIZE - 11264) && (errors == 0) &&
+                     (chry_spsc_ringbuffer_get_dma_overrun(&rb) == 2048 + 6144),
+                     "linear read overwritten before done");
+
+    /* the rest is read back in order, nothing more is lost */
+    size = chry_spsc_ringbuffer_read(&rb, data, sizeof(data));
+    check(data, size, POOL_SIZE);
+    failed += expect((size == 4096) && (errors == 0) && (chry_spsc_ringbuffer_get_dma_overrun(&rb) == 8192) &&
+                     (chry_spsc_ringbuffer_get_used(&rb) == 7168),
+                     "read after the linear read");
+
+    printf("dma overrun check: %s\n", failed ? "FAILED" : "passed");
+    return failed;
+}
+
+static void run(const char *name, void *(*producer)(void *), void (*consumer)(void), uint32_t chunk)
+{
+    pthread_t thread;
+    double start;
+    double elapsed;
+
+    chry_spsc_ringbuffer_init(&rb, pool, POOL_SIZE);
+    chunk_size = chunk;
+    dma_remaining = POOL_SIZE;
+    errors = 0;
+
+    start = now();
+    pthread_create(&thread, NULL, producer, NULL);
+    consumer();
+    pthread_join(thread, NULL);
+    elapsed = now() - start;
+
+    printf("%-8s %5u bytes: %8.1f MB/s, %lu errors, %u bytes lost\n", name, chunk,
+           TOTAL_SIZE / elapsed / (1024 * 1024), errors, chry_spsc_ringbuffer_get_dma_overrun(&rb));
+}
+
+int main(void)
+{
+    static const uint32_t chunks[] = { 16, 256, 4096 };
+
+    if (check_dma_overrun() != 0) {
+        return 1;
+    }
+
+    for (unsigned int i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        run("stream", stream_producer, consume_stream, chunks[i]);
+    }
+    for (unsigned int i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        run("record", record_producer, consume_records, chunks[i]);
+    }
+    for (unsigned int i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        run("dma", dma_producer, consume_dma, chunks[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,573 @@
+/*
+ * Copyright (c) 2022, Egahp
+ * Copyright (c) 2025, HPMicro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "chry_spsc_ringbuffer.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CHRY_SPSC_RB_LOAD_RELAXED(p)     __atomic_load_n((p), __ATOMIC_RELAXED)
+#define CHRY_SPSC_RB_LOAD_ACQUIRE(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define CHRY_SPSC_RB_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#include <stdatomic.h>
+static inline uint32_t chry_spsc_rb_load_acquire(uint32_t *p)
+{
+    uint32_t v = *(volatile uint32_t *)p;
+    atomic_thread_fence(memory_order_acquire);
+    return v;
+}
+
+static inline void chry_spsc_rb_store_release(uint32_t *p, uint32_t v)
+{
+    atomic_thread_fence(memory_order_release);
+    *(volatile uint32_t *)p = v;
+}
+#define CHRY_SPSC_RB_LOAD_RELAXED(p)     (*(volatile uint32_t *)(p))
+#define CHRY_SPSC_RB_LOAD_ACQUIRE(p)     chry_spsc_rb_load_acquire(p)
+#define CHRY_SPSC_RB_STORE_RELEASE(p, v) chry_spsc_rb_store_release((p), (v))
+#endif
+
+static void chry_spsc_ringbuffer_copy_in(chry_spsc_ringbuffer_t *rb, uint32_t in, const void *data, uint32_t size)
+{
+    uint32_t offset;
+    uint32_t remain;
+
+    offset = in & rb->mask;
+
+    remain = rb->mask + 1 - offset;
+    remain = remain > size ? size : remain;
+
+    memcpy(((uint8_t *)(rb->pool)) + offset, data, remain);
+    memcpy(rb->pool, (const uint8_t *)data + remain, size - remain);
+}
+
+static void chry_spsc_ringbuffer_copy_out(chry_spsc_ringbuffer_t *rb, uint32_t out, void *data, uint32_t size)
+{
+    uint32_t offset;
+    uint32_t remain;
+
+    offset = out & rb->mask;
+
+    remain = rb->mask + 1 - offset;
+    remain = remain > size ? size : remain;
+
+    memcpy(data, ((uint8_t *)(rb->pool)) + offset, remain);
+    memcpy((uint8_t *)data + remain, rb->pool, size - remain);
+}
+
+/*****************************************************************************
+* @brief        producer side, get free size, reload the read pointer
+*               only when the cached one shows less than need
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    in          write pointer
+* @param[in]    need        size in byte wanted
+*
+* @retval uint32_t          free size in byte
+*****************************************************************************/
+static uint32_t chry_spsc_ringbuffer_producer_free(chry_spsc_ringbuffer_t *rb, uint32_t in, uint32_t need)
+{
+    uint32_t unused;
+
+    unused = (rb->mask + 1) - (in - rb->out_cache);
+    if (unused < need) {
+        rb->out_cache = CHRY_SPSC_RB_LOAD_ACQUIRE(&rb->out);
+        unused = (rb->mask + 1) - (in - rb->out_cache);
+    }
+
+    return unused;
+}
+
+/*****************************************************************************
+* @brief        consumer side, get used size, reload the write pointer
+*               only when the cached one shows less than need, drop the
+*               data a DMA producer overwrote
+*
+* @param[in]    rb          ringbuffer instance
+* @param[inout] out         read pointer
+* @param[in]    need        size in byte wanted
+*
+* @retval uint32_t          used size in byte
+*****************************************************************************/
+static uint32_t chry_spsc_ringbuffer_consumer_used(chry_spsc_ringbuffer_t *rb, uint32_t *out, uint32_t need)
+{
+    uint32_t used;
+
+    used = rb->in_cache - *out;
+    if (used < need) {
+        rb->in_cache = CHRY_SPSC_RB_LOAD_ACQUIRE(&rb->in);
+        used = rb->in_cache - *out;
+    }
+    /* also when the write pointer was reloaded by the check of the last read */
+    if (used > rb->mask + 1) {
+        rb->dma_overrun += used - (rb->mask + 1);
+        *out = rb->in_cache - (rb->mask + 1);
+        CHRY_SPSC_RB_STORE_RELEASE(&rb->out, *out);
+        used = rb->mask + 1;
+    }
+
+    return used;
+}
+
+/*****************************************************************************
+* @brief        consumer side, after size bytes from out were read, drop
+*               the ones a DMA producer overwrote before or during the read,
+*               as seen from the write pointer of the last DMA update
+*
+* @param[in]    rb          ringbuffer instance
+* @param[inout] out         read pointer
+* @param[in]    size        size in byte read
+*
+* @retval uint32_t          size in byte dropped from the start of the read
+*****************************************************************************/
+static uint32_t chry_spsc_ringbuffer_consumer_lapped(chry_spsc_ringbuffer_t *rb, uint32_t *out, uint32_t size)
+{
+    uint32_t lost;
+
+    if (!CHRY_SPSC_RB_LOAD_RELAXED(&rb->dma_producer)) {
+        return 0;
+    }
+
+    rb->in_cache = CHRY_SPSC_RB_LOAD_ACQUIRE(&rb->in);
+    lost = rb->in_cache - *out;
+    if (lost <= rb->mask + 1) {
+        return 0;
+    }
+
+    lost -= rb->mask + 1;
+    if (lost > size) {
+        lost = size;
+    }
+    rb->dma_overrun += lost;
+    *out += lost;
+    CHRY_SPSC_RB_STORE_RELEASE(&rb->out, *out);
+
+    return lost;
+}
+
+/*****************************************************************************
+* @brief        init ringbuffer
+*
+* @param[in]    rb          ringbuffer instance,
+*                           aligned to CHRY_SPSC_RB_CACHELINE_SIZE
+* @param[in]    pool        memory pool address
+* @param[in]    size        memory size in byte,
+*                           must be power of 2 !!!
+*
+* @retval int               0:Success -1:Error
+*****************************************************************************/
+int chry_spsc_ringbuffer_init(chry_spsc_ringbuffer_t *rb, void *pool, uint32_t size)
+{
+    if (NULL == rb) {
+        return -1;
+    }
+
+    /* the producer and consumer indexes would share a cache line */
+    if ((uintptr_t)rb & (CHRY_SPSC_RB_CACHELINE_SIZE - 1)) {
+        return -1;
+    }
+
+    if (NULL == pool) {
+        return -1;
+    }
+
+    if ((size < 2) || (size & (size - 1))) {
+        return -1;
+    }
+
+    memset(rb, 0, sizeof(*rb));
+    rb->mask = size - 1;
+    rb->pool = pool;
+
+    return 0;
+}
+
+/*****************************************************************************
+* @brief        drop all data, consumer side
+*
+* @param[in]    rb          ringbuffer instance
+*
+*****************************************************************************/
+void chry_spsc_ringbuffer_reset_read(chry_spsc_ringbuffer_t *rb)
+{
+    rb->in_cache = CHRY_SPSC_RB_LOAD_ACQUIRE(&rb->in);
+    CHRY_SPSC_RB_STORE_RELEASE(&rb->out, rb->in_cache);
+}
+
+/*****************************************************************************
+* @brief        get ringbuffer total size in byte
+*
+* @param[in]    rb          ringbuffer instance
+*
+* @retval uint32_t          total size in byte
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_get_size(chry_spsc_ringbuffer_t *rb)
+{
+    return rb->mask + 1;
+}
+
+/*****************************************************************************
+* @brief        get ringbuffer used size in byte, consumer side
+*
+* @param[in]    rb          ringbuffer instance
+*
+* @retval uint32_t          used size in byte
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_get_used(chry_spsc_ringbuffer_t *rb)
+{
+    uint32_t out = CHRY_SPSC_RB_LOAD_RELAXED(&rb->out);
+
+    return chry_spsc_ringbuffer_consumer_used(rb, &out, rb->mask + 1);
+}
+
+/*****************************************************************************
+* @brief        get ringbuffer free size in byte, producer side
+*
+* @param[in]    rb          ringbuffer instance
+*
+* @retval uint32_t          free size in byte
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_get_free(chry_spsc_ringbuffer_t *rb)
+{
+    uint32_t in = CHRY_SPSC_RB_LOAD_RELAXED(&rb->in);
+
+    return chry_spsc_ringbuffer_producer_free(rb, in, rb->mask + 1);
+}
+
+/*****************************************************************************
+* @brief        write data to ringbuffer, producer side
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    data        data pointer
+* @param[in]    size        size in byte
+*
+* @retval uint32_t          actual write size in byte
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_write(chry_spsc_ringbuffer_t *rb, const void *data, uint32_t size)
+{
+    uint32_t in = CHRY_SPSC_RB_LOAD_RELAXED(&rb->in);
+    uint32_t unused;
+
+    unused = chry_spsc_ringbuffer_producer_free(rb, in, size);
+    if (size > unused) {
+        size = unused;
+    }
+
+    chry_spsc_ringbuffer_copy_in(rb, in, data, size);
+    CHRY_SPSC_RB_STORE_RELEASE(&rb->in, in + size);
+
+    return size;
+}
+
+/*****************************************************************************
+* @brief        peek data from ringbuffer, consumer side, the data a DMA
+*               producer overwrote is dropped
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    data        data pointer
+* @param[in]    size        size in byte
+*
+* @retval uint32_t          actual peek size in byte
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_peek(chry_spsc_ringbuffer_t *rb, void *data, uint32_t size)
+{
+    uint32_t out = CHRY_SPSC_RB_LOAD_RELAXED(&rb->out);
+    uint32_t used;
+    uint32_t lost;
+
+    used = chry_spsc_ringbuffer_consumer_used(rb, &out, size);
+    if (size > used) {
+        size = used;
+    }
+
+    chry_spsc_ringbuffer_copy_out(rb, out, data, size);
+
+    lost = chry_spsc_ringbuffer_consumer_lapped(rb, &out, size);
+    if (lost != 0) {
+        size -= lost;
+        memmove(data, (uint8_t *)data + lost, size);
+    }
+
+    return size;
+}
+
+/*****************************************************************************
+* @brief        read data from ringbuffer, consumer side
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    data        data pointer
+* @param[in]    size        size in byte
+*
+* @retval uint32_t          actual read size in byte
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_read(chry_spsc_ringbuffer_t *rb, void *data, uint32_t size)
+{
+    uint32_t out;
+
+    size = chry_spsc_ringbuffer_peek(rb, data, size);
+    /* after the peek, which drops the data overwritten by a DMA */
+    out = CHRY_SPSC_RB_LOAD_RELAXED(&rb->out);
+    CHRY_SPSC_RB_STORE_RELEASE(&rb->out, out + size);
+
+    return size;
+}
+
+/*****************************************************************************
+* @brief        drop data from ringbuffer, consumer side
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    size        size in byte
+*
+* @retval uint32_t          actual drop size in byte
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_drop(chry_spsc_ringbuffer_t *rb, uint32_t size)
+{
+    uint32_t out = CHRY_SPSC_RB_LOAD_RELAXED(&rb->out);
+    uint32_t used;
+
+    used = chry_spsc_ringbuffer_consumer_used(rb, &out, size);
+    if (size > used) {
+        size = used;
+    }
+
+    CHRY_SPSC_RB_STORE_RELEASE(&rb->out, out + size);
+
+    return size;
+}
+
+/*****************************************************************************
+* @brief        write a record to ringbuffer, producer side,
+*               the record is prefixed with its size and written whole
+*               or not at all
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    data        data pointer
+* @param[in]    size        record size in byte, not 0
+*
+* @retval true              Success
+* @retval false             not enough free space, or size is 0
+*****************************************************************************/
+bool chry_spsc_ringbuffer_write_record(chry_spsc_ringbuffer_t *rb, const void *data, uint32_t size)
+{
+    uint32_t in = CHRY_SPSC_RB_LOAD_RELAXED(&rb->in);
+    uint32_t need = CHRY_SPSC_RB_RECORD_HEADER_SIZE + size;
+
+    if ((size == 0) || (size > rb->mask + 1 - CHRY_SPSC_RB_RECORD_HEADER_SIZE)) {
+        return false;
+    }
+
+    if (chry_spsc_ringbuffer_producer_free(rb, in, need) < need) {
+        return false;
+    }
+
+    chry_spsc_ringbuffer_copy_in(rb, in, &size, CHRY_SPSC_RB_RECORD_HEADER_SIZE);
+    chry_spsc_ringbuffer_copy_in(rb, in + CHRY_SPSC_RB_RECORD_HEADER_SIZE, data, size);
+    CHRY_SPSC_RB_STORE_RELEASE(&rb->in, in + need);
+
+    return true;
+}
+
+/*****************************************************************************
+* @brief        get the size of the next record, consumer side
+*
+* @param[in]    rb          ringbuffer instance
+*
+* @retval uint32_t          record size in byte, 0:no record
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_get_record_size(chry_spsc_ringbuffer_t *rb)
+{
+    uint32_t out = CHRY_SPSC_RB_LOAD_RELAXED(&rb->out);
+    uint32_t size;
+
+    if (chry_spsc_ringbuffer_consumer_used(rb, &out, CHRY_SPSC_RB_RECORD_HEADER_SIZE) < CHRY_SPSC_RB_RECORD_HEADER_SIZE) {
+        return 0;
+    }
+
+    chry_spsc_ringbuffer_copy_out(rb, out, &size, CHRY_SPSC_RB_RECORD_HEADER_SIZE);
+
+    return size;
+}
+
+/*****************************************************************************
+* @brief        read a record from ringbuffer, consumer side
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    data        data pointer
+* @param[in]    size        data size in byte
+*
+* @retval uint32_t          record size in byte, 0:no record,
+*                           larger than size:record not read, data too small
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_read_record(chry_spsc_ringbuffer_t *rb, void *data, uint32_t size)
+{
+    uint32_t out;
+    uint32_t record;
+
+    record = chry_spsc_ringbuffer_get_record_size(rb);
+    if ((record == 0) || (record > size)) {
+        return record;
+    }
+
+    out = CHRY_SPSC_RB_LOAD_RELAXED(&rb->out);
+    /* the record is published with its header */
+    chry_spsc_ringbuffer_copy_out(rb, out + CHRY_SPSC_RB_RECORD_HEADER_SIZE, data, record);
+    CHRY_SPSC_RB_STORE_RELEASE(&rb->out, out + CHRY_SPSC_RB_RECORD_HEADER_SIZE + record);
+
+    return record;
+}
+
+/*****************************************************************************
+* @brief        linear write setup, producer side,
+*               get write pointer and max linear size.
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    size        pointer to store max linear size in byte
+*
+* @retval void*             write memory pointer
+*****************************************************************************/
+void *chry_spsc_ringbuffer_linear_write_setup(chry_spsc_ringbuffer_t *rb, uint32_t *size)
+{
+    uint32_t in = CHRY_SPSC_RB_LOAD_RELAXED(&rb->in);
+    uint32_t unused;
+    uint32_t offset;
+    uint32_t remain;
+
+    unused = chry_spsc_ringbuffer_producer_free(rb, in, rb->mask + 1);
+
+    offset = in & rb->mask;
+
+    remain = rb->mask + 1 - offset;
+    *size = remain > unused ? unused : remain;
+
+    return ((uint8_t *)(rb->pool)) + offset;
+}
+
+/*****************************************************************************
+* @brief        linear read setup, consumer side,
+*               get read pointer and max linear size.
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    size        pointer to store max linear size in byte
+*
+* @retval void*             read memory pointer
+*****************************************************************************/
+void *chry_spsc_ringbuffer_linear_read_setup(chry_spsc_ringbuffer_t *rb, uint32_t *size)
+{
+    uint32_t out = CHRY_SPSC_RB_LOAD_RELAXED(&rb->out);
+    uint32_t used;
+    uint32_t offset;
+    uint32_t remain;
+
+    used = chry_spsc_ringbuffer_consumer_used(rb, &out, rb->mask + 1);
+
+    offset = out & rb->mask;
+
+    remain = rb->mask + 1 - offset;
+    *size = remain > used ? used : remain;
+
+    return ((uint8_t *)(rb->pool)) + offset;
+}
+
+/*****************************************************************************
+* @brief        linear write done, add write pointer only, producer side
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    size        write size in byte
+*
+* @retval uint32_t          actual write size in byte
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_linear_write_done(chry_spsc_ringbuffer_t *rb, uint32_t size)
+{
+    uint32_t in = CHRY_SPSC_RB_LOAD_RELAXED(&rb->in);
+    uint32_t unused;
+
+    unused = chry_spsc_ringbuffer_producer_free(rb, in, size);
+    if (size > unused) {
+        size = unused;
+    }
+    CHRY_SPSC_RB_STORE_RELEASE(&rb->in, in + size);
+
+    return size;
+}
+
+/*****************************************************************************
+* @brief        linear read done, add read pointer only, consumer side.
+*               With a DMA producer, the data it overwrote since the linear
+*               read setup is counted as lost: only the last returned bytes
+*               of the linear read are valid.
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    size        read size in byte
+*
+* @retval uint32_t          actual read size in byte, valid data
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_linear_read_done(chry_spsc_ringbuffer_t *rb, uint32_t size)
+{
+    uint32_t out = CHRY_SPSC_RB_LOAD_RELAXED(&rb->out);
+    uint32_t used;
+    uint32_t lost;
+
+    used = chry_spsc_ringbuffer_consumer_used(rb, &out, size);
+    if (size > used) {
+        size = used;
+    }
+
+    lost = chry_spsc_ringbuffer_consumer_lapped(rb, &out, size);
+    size -= lost;
+    CHRY_SPSC_RB_STORE_RELEASE(&rb->out, out + size);
+
+    return size;
+}
+
+/*****************************************************************************
+* @brief        DMA producer, add write pointer from the DMA position.
+*               The DMA writes the pool in a loop, e.g. with a linked
+*               descriptor chain, remaining is the size in byte it has to
+*               write before it wraps to the start of the pool. Called from
+*               one context only, at least once each time the DMA writes
+*               the size of the pool, otherwise the laps are not seen.
+*               The DMA does not wait for the consumer, when it passed the
+*               read pointer the consumer drops the data overwritten and
+*               counts it as lost. The data read is checked once the read
+*               is done, against the write pointer of the last update: to
+*               check a linear read up to its end, update between the
+*               linear read setup and done, or from a context that runs
+*               while the consumer reads.
+*
+* @param[in]    rb          ringbuffer instance
+* @param[in]    remaining   DMA remaining size in byte, 0 to pool size
+*
+* @retval uint32_t          size in byte written since the last update
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_dma_write_update(chry_spsc_ringbuffer_t *rb, uint32_t remaining)
+{
+    uint32_t in = CHRY_SPSC_RB_LOAD_RELAXED(&rb->in);
+    uint32_t delta;
+
+    if (!rb->dma_producer) {
+        CHRY_SPSC_RB_STORE_RELEASE(&rb->dma_producer, 1);
+    }
+
+    delta = ((rb->mask + 1 - remaining) - in) & rb->mask;
+    if (delta != 0) {
+        CHRY_SPSC_RB_STORE_RELEASE(&rb->in, in + delta);
+    }
+
+    return delta;
+}
+
+/*****************************************************************************
+* @brief        get the size in byte lost by the DMA producer
+*
+* @param[in]    rb          ringbuffer instance
+*
+* @retval uint32_t          lost size in byte
+*****************************************************************************/
+uint32_t chry_spsc_ringbuffer_get_dma_overrun(chry_spsc_ringbuffer_t *rb)
+{
+    return CHRY_SPSC_RB_LOAD_RELAXED(&rb->dma_overrun);
+}
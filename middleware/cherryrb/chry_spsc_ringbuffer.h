@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2022, Egahp
+ * Copyright (c) 2025, HPMicro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef CHRY_SPSC_RINGBUFFER_H
+#define CHRY_SPSC_RINGBUFFER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Single producer, single consumer ringbuffer, safe without lock when the
+ * producer and the consumer run on different cores, or one of them in an
+ * interrupt: the data is published with release stores of the indexes and
+ * taken with acquire loads. The indexes written by the producer and the ones
+ * written by the consumer are in separate cache lines.
+ *
+ * Between cores without coherent data cache, the instance and the pool must
+ * be in noncacheable memory, so must the pool written by a DMA producer.
+ *
+ * A DMA producer does not wait for the consumer. Data it overwrote before or
+ * while the consumer read it is dropped and counted in dma_overrun: once a
+ * read, peek or linear read is done, the read data is checked against the
+ * write pointer of the last chry_spsc_ringbuffer_dma_write_update.
+ *
+ * The instance must be aligned to CHRY_SPSC_RB_CACHELINE_SIZE, the type is
+ * aligned with gcc and clang, chry_spsc_ringbuffer_init rejects an instance
+ * that is not, e.g. one allocated with malloc.
+ */
+
+#ifndef CHRY_SPSC_RB_CACHELINE_SIZE
+#define CHRY_SPSC_RB_CACHELINE_SIZE 64
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CHRY_SPSC_RB_ALIGNED __attribute__((aligned(CHRY_SPSC_RB_CACHELINE_SIZE)))
+#else
+#define CHRY_SPSC_RB_ALIGNED
+#endif
+
+#define CHRY_SPSC_RB_RECORD_HEADER_SIZE 4
+
+typedef struct {
+    /* written by the consumer */
+    uint32_t out;         /*!< Define the read pointer.                 */
+    uint32_t in_cache;    /*!< Define the last write pointer read.      */
+    uint32_t dma_overrun; /*!< Define the data lost by the DMA producer. */
+    uint8_t reserved0[CHRY_SPSC_RB_CACHELINE_SIZE - 3 * sizeof(uint32_t)];
+
+    /* written by the producer */
+    uint32_t in;        /*!< Define the write pointer.                  */
+    uint32_t out_cache; /*!< Define the last read pointer read.         */
+    uint8_t reserved1[CHRY_SPSC_RB_CACHELINE_SIZE - 2 * sizeof(uint32_t)];
+
+    /* constant after init, dma_producer after the first DMA update */
+    uint32_t mask;         /*!< Define the write and read pointer mask.  */
+    void *pool;            /*!< Define the memory pointer.               */
+    uint32_t dma_producer; /*!< Define the pool written by a DMA.        */
+} CHRY_SPSC_RB_ALIGNED chry_spsc_ringbuffer_t;
+
+extern int chry_spsc_ringbuffer_init(chry_spsc_ringbuffer_t *rb, void *pool, uint32_t size);
+extern void chry_spsc_ringbuffer_reset_read(chry_spsc_ringbuffer_t *rb);
+
+extern uint32_t chry_spsc_ringbuffer_get_size(chry_spsc_ringbuffer_t *rb);
+extern uint32_t chry_spsc_ringbuffer_get_used(chry_spsc_ringbuffer_t *rb);
+extern uint32_t chry_spsc_ringbuffer_get_free(chry_spsc_ringbuffer_t *rb);
+
+extern uint32_t chry_spsc_ringbuffer_write(chry_spsc_ringbuffer_t *rb, const void *data, uint32_t size);
+extern uint32_t chry_spsc_ringbuffer_peek(chry_spsc_ringbuffer_t *rb, void *data, uint32_t size);
+extern uint32_t chry_spsc_ringbuffer_read(chry_spsc_ringbuffer_t *rb, void *data, uint32_t size);
+extern uint32_t chry_spsc_ringbuffer_drop(chry_spsc_ringbuffer_t *rb, uint32_t size);
+
+extern bool chry_spsc_ringbuffer_write_record(chry_spsc_ringbuffer_t *rb, const void *data, uint32_t size);
+extern uint32_t chry_spsc_ringbuffer_get_record_size(chry_spsc_ringbuffer_t *rb);
+extern uint32_t chry_spsc_ringbuffer_read_record(chry_spsc_ringbuffer_t *rb, void *data, uint32_t size);
+
+extern void *chry_spsc_ringbuffer_linear_write_setup(chry_spsc_ringbuffer_t *rb, uint32_t *size);
+extern void *chry_spsc_ringbuffer_linear_read_setup(chry_spsc_ringbuffer_t *rb, uint32_t *size);
+extern uint32_t chry_spsc_ringbuffer_linear_write_done(chry_spsc_ringbuffer_t *rb, uint32_t size);
+extern uint32_t chry_spsc_ringbuffer_linear_read_done(chry_spsc_ringbuffer_t *rb, uint32_t size);
+
+extern uint32_t chry_spsc_ringbuffer_dma_write_update(chry_spsc_ringbuffer_t *rb, uint32_t remaining);
+extern uint32_t chry_spsc_ringbuffer_get_dma_overrun(chry_spsc_ringbuffer_t *rb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -620,8 +620,8 @@ eth_statistics, wMaxSegmentSize, wNumberMCFilters, bNumberPowerFilters, str_idx)
     0x00                                                   /* bInterval */
 // clang-format on
 
-/*Length of template descriptor: 77 bytes*/
-#define CDC_NCM_DESCRIPTOR_LEN   (8 + 9 + 5 + 5 + 13 + 6 + 7 + 9 + 7 + 7)
+/*Length of template descriptor: 86 bytes*/
+#define CDC_NCM_DESCRIPTOR_LEN   (8 + 9 + 5 + 5 + 13 + 6 + 7 + 9 + 9 + 7 + 7)
 // clang-format off
 #define CDC_NCM_DESCRIPTOR_INIT(bFirstInterface, int_ep, out_ep, in_ep, wMaxPacketSize, \
 eth_statistics, wMaxSegmentSize, wNumberMCFilters, bNumberPowerFilters, str_idx) \
@@ -658,14 +658,15 @@ eth_statistics, wMaxSegmentSize, wNumberMCFilters, bNumberPowerFilters, str_idx)
     CDC_FUNC_DESC_ETHERNET_NETWORKING, /* Ethernet Networking functional descriptor subtype  */\
     str_idx,                                                    /* Device's MAC string index */\
     DBVAL_BE(eth_statistics),                                /* Ethernet statistics (bitmap) */\
-    WBVAL(wMaxPacketSize),/* wMaxSegmentSize: Ethernet Maximum Segment size, typically 1514 bytes */\
+    WBVAL(wMaxSegmentSize),/* wMaxSegmentSize: Ethernet Maximum Segment size, typically 1514 bytes */\
     WBVAL(wNumberMCFilters),            /* wNumberMCFilters: the number of multicast filters */\
     bNumberPowerFilters,          /* bNumberPowerFilters: the number of wakeup power filters */\
-    0x06,                                                                                      \
-    CDC_CS_INTERFACE,                                                                          \
-    CDC_FUNC_DESC_NCM,                                                                         \
-    0x00, 0x01,                                                                                \
-    0x23,                                                                                      \
+    /* CDC NCM Functional Descriptor */                                                        \
+    0x06,                                                  /* bFunctionLength */               \
+    CDC_CS_INTERFACE,                                      /* bDescriptorType */               \
+    CDC_FUNC_DESC_NCM,                                     /* bDescriptorSubtype */            \
+    WBVAL(0x0100),                                         /* bcdNcmVersion */                 \
+    0x01,                                                  /* bmNetworkCapabilities */         \
     0x07,                                                  /* bLength */                       \
     USB_DESCRIPTOR_TYPE_ENDPOINT,                          /* bDescriptorType */               \
     int_ep,                                                /* bEndpointAddress */              \
@@ -676,11 +677,21 @@ eth_statistics, wMaxSegmentSize, wNumberMCFilters, bNumberPowerFilters, str_idx)
     USB_DESCRIPTOR_TYPE_INTERFACE,                         /* bDescriptorType */               \
     (uint8_t)(bFirstInterface + 1),                        /* bInterfaceNumber */              \
     0x00,                                                  /* bAlternateSetting */             \
-    0x02,                                                  /* bNumEndpoints */                 \
+    0x00,                                                  /* bNumEndpoints */                 \
     CDC_DATA_INTERFACE_CLASS,                              /* bInterfaceClass */               \
     0x00,                                                  /* bInterfaceSubClass */            \
     0x00,                                                  /* bInterfaceProtocol */            \
     0x00,                                                  /* iInterface */                    \
+    /* datagrams move with the alternate setting 1 only */                                     \
+    0x09,                                                  /* bLength */                       \
+    USB_DESCRIPTOR_TYPE_INTERFACE,                         /* bDescriptorType */               \
+    (uint8_t)(bFirstInterface + 1),                        /* bInterfaceNumber */              \
+    0x01,                                                  /* bAlternateSetting */             \
+    0x02,                                                  /* bNumEndpoints */                 \
+    CDC_DATA_INTERFACE_CLASS,                              /* bInterfaceClass */               \
+    0x00,                                                  /* bInterfaceSubClass */            \
+    0x01,                                                  /* bInterfaceProtocol: NTB */       \
+    0x00,                                                  /* iInterface */                    \
     0x07,                                                  /* bLength */                       \
     USB_DESCRIPTOR_TYPE_ENDPOINT,                          /* bDescriptorType */               \
     out_ep,                                                /* bEndpointAddress */              \
@@ -0,0 +1,561 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "usbd_core.h"
+#include "usbd_cdc_ncm.h"
+
+#define CDC_NCM_OUT_EP_IDX 0
+#define CDC_NCM_IN_EP_IDX  1
+#define CDC_NCM_INT_EP_IDX 2
+
+/* Ethernet Maximum Segment size, typically 1514 bytes */
+#define CONFIG_CDC_NCM_ETH_MAX_SEGSZE 1514U
+
+#ifndef CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE
+#define CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE 16384
+#endif
+
+#ifndef CONFIG_USBDEV_CDC_NCM_NTB_OUT_SIZE
+#define CONFIG_USBDEV_CDC_NCM_NTB_OUT_SIZE 16384
+#endif
+
+#ifndef CONFIG_USBDEV_CDC_NCM_MAX_DATAGRAMS
+#define CONFIG_USBDEV_CDC_NCM_MAX_DATAGRAMS 32
+#endif
+
+/* ndps parsed in one received ntb, the rest of a longer chain is dropped */
+#ifndef CONFIG_USBDEV_CDC_NCM_MAX_NDPS
+#define CONFIG_USBDEV_CDC_NCM_MAX_NDPS 8
+#endif
+
+/* smallest ntb input size the host may select, see usbncm10.pdf 6.2.7 */
+#define CDC_NCM_NTB_MIN_IN_SIZE 2048U
+
+#define CDC_NCM_NTB_ALIGN    4U
+#define CDC_NCM_NTH16_LEN    sizeof(struct cdc_ncm_nth16)
+#define CDC_NCM_NDP16_LEN(n) (sizeof(struct cdc_ncm_ndp16) + ((n) + 1U) * sizeof(struct cdc_ncm_ndp16_datagram))
+#define CDC_NCM_ALIGN(x)     (((x) + CDC_NCM_NTB_ALIGN - 1U) & ~(CDC_NCM_NTB_ALIGN - 1U))
+
+#define CDC_NCM_NTB_RX_COUNT 2U
+#define CDC_NCM_NTB_TX_COUNT 2U
+
+/* Describe EndPoints configuration */
+static struct usbd_endpoint cdc_ncm_ep_data[3];
+
+#ifdef CONFIG_USBDEV_CDC_NCM_USING_LWIP
+static USB_NOCACHE_RAM_SECTION USB_MEM_ALIGNX uint8_t g_cdc_ncm_rx_ntb[CDC_NCM_NTB_RX_COUNT][CONFIG_USBDEV_CDC_NCM_NTB_OUT_SIZE];
+static USB_NOCACHE_RAM_SECTION USB_MEM_ALIGNX uint8_t g_cdc_ncm_tx_ntb[CDC_NCM_NTB_TX_COUNT][CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE];
+#endif
+static USB_NOCACHE_RAM_SECTION USB_MEM_ALIGNX uint8_t g_cdc_ncm_notify_buf[16];
+
+/*
+ * Device data structure
+ *
+ * The buffers are shared with the isr without critical sections: a transfer is started by the
+ * isr while the endpoint is busy and by the application only when it is idle, and the isr does
+ * not close the filling ntb while usbd_cdc_ncm_eth_tx adds a datagram to it.
+ */
+struct usbd_cdc_ncm_priv {
+    /* received ntbs, filled by the out ep and parsed by usbd_cdc_ncm_eth_rx */
+    volatile uint32_t rx_len[CDC_NCM_NTB_RX_COUNT];
+    volatile uint8_t rx_prod; /* free running, written by the isr */
+    volatile uint8_t rx_cons; /* free running, written by usbd_cdc_ncm_eth_rx */
+    volatile bool rx_busy;
+    uint16_t rx_ndp_index;    /* ndp being parsed in the oldest ntb, 0 to start from the nth */
+    uint16_t rx_dgram;        /* next datagram of that ndp */
+    uint8_t rx_ndp_count;     /* ndps of the oldest ntb parsed so far */
+
+    /* ntbs to the host, datagrams are added to the filling one while the other is on the bus */
+    uint16_t tx_dgram_index[CONFIG_USBDEV_CDC_NCM_MAX_DATAGRAMS];
+    uint16_t tx_dgram_len[CONFIG_USBDEV_CDC_NCM_MAX_DATAGRAMS];
+    volatile uint8_t tx_fill;
+    volatile uint16_t tx_count;
+    volatile uint32_t tx_len;
+    volatile uint32_t tx_busy_len;
+    volatile bool tx_busy;
+    volatile bool tx_adding;
+    uint32_t tx_oversize;     /* datagrams dropped because longer than an ethernet frame */
+    uint32_t ntb_in_size;
+    uint16_t tx_sequence;
+
+    volatile bool data_active;
+} g_usbd_cdc_ncm;
+
+static volatile uint8_t g_current_net_status = 0;
+static volatile uint8_t g_cmd_intf = 0;
+
+static uint32_t g_connect_speed_table[2] = { CDC_ECM_CONNECT_SPEED_UPSTREAM,
+                                             CDC_ECM_CONNECT_SPEED_DOWNSTREAM };
+
+static void usbd_cdc_ncm_send_notify(uint8_t notifycode, uint8_t value, uint32_t *speed)
+{
+    struct cdc_eth_notification *notify = (struct cdc_eth_notification *)g_cdc_ncm_notify_buf;
+    uint8_t bytes2send = 0;
+
+    notify->bmRequestType = CDC_ECM_BMREQUEST_TYPE_ECM;
+    notify->bNotificationType = notifycode;
+
+    switch (notifycode) {
+        case CDC_ECM_NOTIFY_CODE_NETWORK_CONNECTION:
+            notify->wValue = value;
+            notify->wIndex = g_cmd_intf;
+            notify->wLength = 0U;
+
+            for (uint8_t i = 0U; i < 8U; i++) {
+                notify->data[i] = 0U;
+            }
+            bytes2send = 8U;
+            break;
+        case CDC_ECM_NOTIFY_CODE_CONNECTION_SPEED_CHANGE:
+            notify->wValue = 0U;
+            notify->wIndex = g_cmd_intf;
+            notify->wLength = 0x0008U;
+            bytes2send = 16U;
+
+            memcpy(notify->data, speed, 8);
+            break;
+
+        default:
+            break;
+    }
+
+    if (usb_device_is_configured(0)) {
+        if (bytes2send) {
+            usbd_ep_start_write(0, cdc_ncm_ep_data[CDC_NCM_INT_EP_IDX].ep_addr, g_cdc_ncm_notify_buf, bytes2send);
+        }
+    }
+}
+
+static void cdc_ncm_get_ntb_parameters(uint8_t *data)
+{
+    struct cdc_ncm_ntb_parameters params;
+
+    memset(&params, 0, sizeof(params));
+    params.wLength = sizeof(params);
+    params.bmNtbFormatsSupported = 0x0001U; /* 16-bit ntb */
+    params.dwNtbInMaxSize = CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE;
+    params.wNdbInDivisor = CDC_NCM_NTB_ALIGN;
+    params.wNdbInPayloadRemainder = 0U;
+    params.wNdbInAlignment = CDC_NCM_NTB_ALIGN;
+    params.dwNtbOutMaxSize = CONFIG_USBDEV_CDC_NCM_NTB_OUT_SIZE;
+    params.wNdbOutDivisor = CDC_NCM_NTB_ALIGN;
+    params.wNdbOutPayloadRemainder = 0U;
+    params.wNdbOutAlignment = CDC_NCM_NTB_ALIGN;
+    params.wNtbOutMaxDatagrams = 0U; /* no limit */
+
+    memcpy(data, &params, sizeof(params));
+}
+
+static int cdc_ncm_class_interface_request_handler(uint8_t busid, struct usb_setup_packet *setup, uint8_t **data, uint32_t *len)
+{
+    uint32_t ntb_in_size;
+
+    USB_LOG_DBG("CDC NCM Class request: "
+                "bRequest 0x%02x\r\n",
+                setup->bRequest);
+
+    (void)busid;
+
+    g_cmd_intf = LO_BYTE(setup->wIndex);
+
+    switch (setup->bRequest) {
+        case CDC_REQUEST_SET_ETHERNET_PACKET_FILTER:
+#ifdef CONFIG_USBDEV_CDC_NCM_USING_LWIP
+            if (usbd_get_port_speed(0) == USB_SPEED_HIGH) {
+                g_connect_speed_table[0] = 480000000; /* 480 Mbps */
+                g_connect_speed_table[1] = 480000000; /* 480 Mbps */
+            } else {
+                g_connect_speed_table[0] = 12000000; /* 12 Mbps */
+                g_connect_speed_table[1] = 12000000; /* 12 Mbps */
+            }
+            usbd_cdc_ncm_set_connect(true, g_connect_speed_table);
+#endif
+            break;
+        case CDC_REQUEST_GET_NTB_PARAMETERS:
+            cdc_ncm_get_ntb_parameters(*data);
+            *len = MIN(setup->wLength, sizeof(struct cdc_ncm_ntb_parameters));
+            break;
+        case CDC_REQUEST_GET_NTB_FORMAT:
+            (*data)[0] = 0x00; /* 16-bit ntb */
+            (*data)[1] = 0x00;
+            *len = 2;
+            break;
+        case CDC_REQUEST_SET_NTB_FORMAT:
+            if (setup->wValue != 0x0000) {
+                return -1;
+            }
+            break;
+        case CDC_REQUEST_GET_NTB_INPUT_SIZE:
+            memcpy(*data, &g_usbd_cdc_ncm.ntb_in_size, 4);
+            *len = 4;
+            break;
+        case CDC_REQUEST_SET_NTB_INPUT_SIZE:
+            if (*len < 4) {
+                return -1;
+            }
+            memcpy(&ntb_in_size, *data, 4);
+            if ((ntb_in_size < CDC_NCM_NTB_MIN_IN_SIZE) || (ntb_in_size > CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE)) {
+                return -1;
+            }
+            g_usbd_cdc_ncm.ntb_in_size = ntb_in_size;
+            break;
+        default:
+            USB_LOG_WRN("Unhandled CDC NCM Class bRequest 0x%02x\r\n", setup->bRequest);
+            return -1;
+    }
+
+    return 0;
+}
+
+#ifdef CONFIG_USBDEV_CDC_NCM_USING_LWIP
+/* receive into the next free ntb, called in the out isr or while the out ep is idle */
+static void cdc_ncm_rx_start(void)
+{
+    uint8_t prod = g_usbd_cdc_ncm.rx_prod;
+
+    if (g_usbd_cdc_ncm.data_active && ((uint8_t)(prod - g_usbd_cdc_ncm.rx_cons) < CDC_NCM_NTB_RX_COUNT)) {
+        g_usbd_cdc_ncm.rx_busy = true;
+        usbd_ep_start_read(0, cdc_ncm_ep_data[CDC_NCM_OUT_EP_IDX].ep_addr, g_cdc_ncm_rx_ntb[prod % CDC_NCM_NTB_RX_COUNT], CONFIG_USBDEV_CDC_NCM_NTB_OUT_SIZE);
+    } else {
+        g_usbd_cdc_ncm.rx_busy = false;
+    }
+}
+
+/* close the filling ntb and send it, called in the in isr or while the in ep is idle */
+static void cdc_ncm_tx_flush(void)
+{
+    uint8_t *ntb = g_cdc_ncm_tx_ntb[g_usbd_cdc_ncm.tx_fill];
+    struct cdc_ncm_nth16 *nth = (struct cdc_ncm_nth16 *)ntb;
+    struct cdc_ncm_ndp16 *ndp;
+    uint32_t ndp_index;
+    uint32_t block_len;
+    uint16_t count = g_usbd_cdc_ncm.tx_count;
+
+    if (g_usbd_cdc_ncm.tx_busy || (count == 0)) {
+        return;
+    }
+
+    ndp_index = CDC_NCM_ALIGN(g_usbd_cdc_ncm.tx_len);
+    block_len = ndp_index + CDC_NCM_NDP16_LEN(count);
+
+    nth->dwSignature = CDC_NCM_NTH16_SIGNATURE;
+    nth->wHeaderLength = CDC_NCM_NTH16_LEN;
+    nth->wSequence = g_usbd_cdc_ncm.tx_sequence++;
+    nth->wBlockLength = block_len;
+    nth->wNdpIndex = ndp_index;
+
+    ndp = (struct cdc_ncm_ndp16 *)(ntb + ndp_index);
+    ndp->dwSignature = CDC_NCM_NDP16_SIGNATURE_NCM0;
+    ndp->wLength = CDC_NCM_NDP16_LEN(count);
+    ndp->wNextNdpIndex = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        ndp->datagram[i].wDatagramIndex = g_usbd_cdc_ncm.tx_dgram_index[i];
+        ndp->datagram[i].wDatagramLength = g_usbd_cdc_ncm.tx_dgram_len[i];
+    }
+    ndp->datagram[count].wDatagramIndex = 0;
+    ndp->datagram[count].wDatagramLength = 0;
+
+    g_usbd_cdc_ncm.tx_busy = true;
+    g_usbd_cdc_ncm.tx_busy_len = block_len;
+    g_usbd_cdc_ncm.tx_fill = (g_usbd_cdc_ncm.tx_fill + 1U) % CDC_NCM_NTB_TX_COUNT;
+    g_usbd_cdc_ncm.tx_count = 0;
+    g_usbd_cdc_ncm.tx_len = CDC_NCM_NTH16_LEN;
+
+    USB_LOG_DBG("txlen:%d\r\n", block_len);
+    usbd_ep_start_write(0, cdc_ncm_ep_data[CDC_NCM_IN_EP_IDX].ep_addr, ntb, block_len);
+}
+
+static void cdc_ncm_data_reset(bool active)
+{
+    g_usbd_cdc_ncm.data_active = active;
+    g_usbd_cdc_ncm.rx_prod = 0;
+    g_usbd_cdc_ncm.rx_cons = 0;
+    g_usbd_cdc_ncm.rx_ndp_index = 0;
+    g_usbd_cdc_ncm.rx_dgram = 0;
+    g_usbd_cdc_ncm.tx_fill = 0;
+    g_usbd_cdc_ncm.tx_count = 0;
+    g_usbd_cdc_ncm.tx_len = CDC_NCM_NTH16_LEN;
+    g_usbd_cdc_ncm.tx_busy = false;
+    g_usbd_cdc_ncm.tx_busy_len = 0;
+    g_usbd_cdc_ncm.tx_oversize = 0;
+    cdc_ncm_rx_start();
+}
+#endif
+
+void cdc_ncm_notify_handler(uint8_t busid, uint8_t event, void *arg)
+{
+    (void)busid;
+
+    switch (event) {
+        case USBD_EVENT_RESET:
+            g_current_net_status = 0;
+            g_usbd_cdc_ncm.ntb_in_size = CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE;
+#ifdef CONFIG_USBDEV_CDC_NCM_USING_LWIP
+            cdc_ncm_data_reset(false);
+#endif
+            break;
+        case USBD_EVENT_SET_INTERFACE: {
+            struct usb_interface_descriptor *intf = (struct usb_interface_descriptor *)arg;
+
+            /* the data interface moves datagrams with alternate setting 1 only */
+            if (intf && (intf->bInterfaceClass == CDC_DATA_INTERFACE_CLASS)) {
+                g_usbd_cdc_ncm.ntb_in_size = CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE;
+#ifdef CONFIG_USBDEV_CDC_NCM_USING_LWIP
+                cdc_ncm_data_reset(intf->bAlternateSetting == 1);
+#endif
+            }
+        } break;
+
+        default:
+            break;
+    }
+}
+
+void cdc_ncm_bulk_out(uint8_t busid, uint8_t ep, uint32_t nbytes)
+{
+    (void)busid;
+    (void)ep;
+
+#ifdef CONFIG_USBDEV_CDC_NCM_USING_LWIP
+    g_usbd_cdc_ncm.rx_len[g_usbd_cdc_ncm.rx_prod % CDC_NCM_NTB_RX_COUNT] = nbytes;
+    g_usbd_cdc_ncm.rx_prod++;
+    cdc_ncm_rx_start();
+#endif
+    usbd_cdc_ncm_data_recv_done(nbytes);
+}
+
+void cdc_ncm_bulk_in(uint8_t busid, uint8_t ep, uint32_t nbytes)
+{
+    (void)busid;
+
+    if ((nbytes % usbd_get_ep_mps(0, ep)) == 0 && nbytes) {
+        /* send zlp */
+        usbd_ep_start_write(0, ep, NULL, 0);
+    } else {
+#ifdef CONFIG_USBDEV_CDC_NCM_USING_LWIP
+        uint32_t len = g_usbd_cdc_ncm.tx_busy_len;
+
+        /* datagrams added meanwhile go out in the next ntb */
+        g_usbd_cdc_ncm.tx_busy = false;
+        if (!g_usbd_cdc_ncm.tx_adding) {
+            cdc_ncm_tx_flush();
+        }
+        usbd_cdc_ncm_data_send_done(len);
+#else
+        usbd_cdc_ncm_data_send_done(nbytes);
+#endif
+    }
+}
+
+void cdc_ncm_int_in(uint8_t busid, uint8_t ep, uint32_t nbytes)
+{
+    (void)busid;
+    (void)ep;
+    (void)nbytes;
+
+    if (g_current_net_status == 2) {
+        g_current_net_status = 3;
+        usbd_cdc_ncm_send_notify(CDC_ECM_NOTIFY_CODE_CONNECTION_SPEED_CHANGE, 0, g_connect_speed_table);
+    } else {
+        g_current_net_status = 0;
+    }
+}
+
+#ifdef CONFIG_USBDEV_CDC_NCM_USING_LWIP
+/*
+ * next datagram of the oldest received ntb, false once the ntb is consumed or invalid
+ *
+ * The ndps of an ntb must follow each other forward, and at most CONFIG_USBDEV_CDC_NCM_MAX_NDPS
+ * of them are parsed, so that a chain looping back cannot keep the parser in the ntb.
+ */
+static bool cdc_ncm_rx_next(uint8_t *ntb, uint32_t ntb_len, uint16_t *index, uint16_t *len)
+{
+    struct cdc_ncm_nth16 *nth = (struct cdc_ncm_nth16 *)ntb;
+    struct cdc_ncm_ndp16 *ndp;
+    uint32_t block_len;
+    uint16_t ndp_index;
+    uint16_t count;
+
+    if (g_usbd_cdc_ncm.rx_ndp_index == 0) {
+        if ((ntb_len < CDC_NCM_NTH16_LEN) || (nth->dwSignature != CDC_NCM_NTH16_SIGNATURE) ||
+            (nth->wHeaderLength != CDC_NCM_NTH16_LEN)) {
+            USB_LOG_ERR("invalid nth16\r\n");
+            return false;
+        }
+        g_usbd_cdc_ncm.rx_ndp_index = nth->wNdpIndex;
+        g_usbd_cdc_ncm.rx_dgram = 0;
+        g_usbd_cdc_ncm.rx_ndp_count = 0;
+    }
+
+    /* wBlockLength 0 means the whole transfer */
+    block_len = (nth->wBlockLength != 0) ? MIN(nth->wBlockLength, ntb_len) : ntb_len;
+
+    while (1) {
+        ndp_index = g_usbd_cdc_ncm.rx_ndp_index;
+        if ((ndp_index < CDC_NCM_NTH16_LEN) || ((ndp_index % CDC_NCM_NTB_ALIGN) != 0) ||
+            ((ndp_index + sizeof(struct cdc_ncm_ndp16)) > block_len)) {
+            return false;
+        }
+        ndp = (struct cdc_ncm_ndp16 *)(ntb + ndp_index);
+        if (((ndp->dwSignature != CDC_NCM_NDP16_SIGNATURE_NCM0) && (ndp->dwSignature != CDC_NCM_NDP16_SIGNATURE_NCM1)) ||
+            (ndp->wLength < CDC_NCM_NDP16_LEN(0)) || ((ndp_index + ndp->wLength) > block_len)) {
+            USB_LOG_ERR("invalid ndp16\r\n");
+            return false;
+        }
+
+        count = (ndp->wLength - sizeof(struct cdc_ncm_ndp16)) / sizeof(struct cdc_ncm_ndp16_datagram);
+        if (g_usbd_cdc_ncm.rx_dgram < count) {
+            *index = ndp->datagram[g_usbd_cdc_ncm.rx_dgram].wDatagramIndex;
+            *len = ndp->datagram[g_usbd_cdc_ncm.rx_dgram].wDatagramLength;
+            if ((*index != 0) && (*len != 0)) {
+                g_usbd_cdc_ncm.rx_dgram++;
+                if ((*index + *len) > block_len) {
+                    USB_LOG_ERR("datagram out of ntb\r\n");
+                    return false;
+                }
+                return true;
+            }
+        }
+
+        /* end of this ndp */
+        if (ndp->wNextNdpIndex == 0) {
+            return false;
+        }
+        if ((ndp->wNextNdpIndex < (ndp_index + ndp->wLength)) ||
+            (++g_usbd_cdc_ncm.rx_ndp_count >= CONFIG_USBDEV_CDC_NCM_MAX_NDPS)) {
+            USB_LOG_ERR("invalid ndp16 chain\r\n");
+            return false;
+        }
+        g_usbd_cdc_ncm.rx_ndp_index = ndp->wNextNdpIndex;
+        g_usbd_cdc_ncm.rx_dgram = 0;
+    }
+}
+
+struct pbuf *usbd_cdc_ncm_eth_rx(void)
+{
+    struct pbuf *p;
+    uint8_t *ntb;
+    uint8_t cons;
+    uint16_t index;
+    uint16_t len;
+
+    while ((cons = g_usbd_cdc_ncm.rx_cons) != g_usbd_cdc_ncm.rx_prod) {
+        ntb = g_cdc_ncm_rx_ntb[cons % CDC_NCM_NTB_RX_COUNT];
+        if (cdc_ncm_rx_next(ntb, g_usbd_cdc_ncm.rx_len[cons % CDC_NCM_NTB_RX_COUNT], &index, &len)) {
+            p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+            if (p == NULL) {
+                /* the datagram is dropped, like a full rx fifo */
+                return NULL;
+            }
+            pbuf_take(p, ntb + index, len);
+            USB_LOG_DBG("rxlen:%d\r\n", len);
+            return p;
+        }
+
+        /* ntb consumed, receive the next one into it if the out ep stopped */
+        g_usbd_cdc_ncm.rx_ndp_index = 0;
+        g_usbd_cdc_ncm.rx_cons = cons + 1U;
+        if (!g_usbd_cdc_ncm.rx_busy) {
+            cdc_ncm_rx_start();
+        }
+    }
+
+    return NULL;
+}
+
+int usbd_cdc_ncm_eth_tx(struct pbuf *p)
+{
+    uint8_t *ntb;
+    uint32_t index;
+    uint32_t len = p->tot_len;
+    int ret = 0;
+
+    if (!usb_device_is_configured(0) || !g_usbd_cdc_ncm.data_active) {
+        return -USB_ERR_NODEV;
+    }
+
+    /* a frame cut to the segment size would reach the host corrupted */
+    if (len > CONFIG_CDC_NCM_ETH_MAX_SEGSZE) {
+        g_usbd_cdc_ncm.tx_oversize++;
+        return -USB_ERR_INVAL;
+    }
+
+    /* keep the in isr from closing the filling ntb */
+    g_usbd_cdc_ncm.tx_adding = true;
+
+    index = CDC_NCM_ALIGN(g_usbd_cdc_ncm.tx_len);
+    if ((g_usbd_cdc_ncm.tx_count >= CONFIG_USBDEV_CDC_NCM_MAX_DATAGRAMS) ||
+        ((CDC_NCM_ALIGN(index + len) + CDC_NCM_NDP16_LEN(g_usbd_cdc_ncm.tx_count + 1U)) > g_usbd_cdc_ncm.ntb_in_size)) {
+        ret = -USB_ERR_BUSY;
+    } else {
+        ntb = g_cdc_ncm_tx_ntb[g_usbd_cdc_ncm.tx_fill];
+        pbuf_copy_partial(p, ntb + index, len, 0);
+        g_usbd_cdc_ncm.tx_dgram_index[g_usbd_cdc_ncm.tx_count] = index;
+        g_usbd_cdc_ncm.tx_dgram_len[g_usbd_cdc_ncm.tx_count] = len;
+        g_usbd_cdc_ncm.tx_len = index + len;
+        g_usbd_cdc_ncm.tx_count++;
+    }
+
+    g_usbd_cdc_ncm.tx_adding = false;
+
+    /* sent now if the in ep is idle, else aggregated until the ntb on the bus is done */
+    if (!g_usbd_cdc_ncm.tx_busy) {
+        cdc_ncm_tx_flush();
+    }
+
+    return ret;
+}
+
+uint32_t usbd_cdc_ncm_get_tx_oversize(void)
+{
+    return g_usbd_cdc_ncm.tx_oversize;
+}
+#endif
+
+struct usbd_interface *usbd_cdc_ncm_init_intf(struct usbd_interface *intf, const uint8_t int_ep, const uint8_t out_ep, const uint8_t in_ep)
+{
+    intf->class_interface_handler = cdc_ncm_class_interface_request_handler;
+    intf->class_endpoint_handler = NULL;
+    intf->vendor_handler = NULL;
+    intf->notify_handler = cdc_ncm_notify_handler;
+
+    cdc_ncm_ep_data[CDC_NCM_OUT_EP_IDX].ep_addr = out_ep;
+    cdc_ncm_ep_data[CDC_NCM_OUT_EP_IDX].ep_cb = cdc_ncm_bulk_out;
+    cdc_ncm_ep_data[CDC_NCM_IN_EP_IDX].ep_addr = in_ep;
+    cdc_ncm_ep_data[CDC_NCM_IN_EP_IDX].ep_cb = cdc_ncm_bulk_in;
+    cdc_ncm_ep_data[CDC_NCM_INT_EP_IDX].ep_addr = int_ep;
+    cdc_ncm_ep_data[CDC_NCM_INT_EP_IDX].ep_cb = cdc_ncm_int_in;
+
+    usbd_add_endpoint(0, &cdc_ncm_ep_data[CDC_NCM_OUT_EP_IDX]);
+    usbd_add_endpoint(0, &cdc_ncm_ep_data[CDC_NCM_IN_EP_IDX]);
+    usbd_add_endpoint(0, &cdc_ncm_ep_data[CDC_NCM_INT_EP_IDX]);
+
+    g_usbd_cdc_ncm.ntb_in_size = CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE;
+    g_usbd_cdc_ncm.tx_len = CDC_NCM_NTH16_LEN;
+
+    return intf;
+}
+
+void usbd_cdc_ncm_set_connect(bool connect, uint32_t speed[2])
+{
+    if (connect) {
+        g_current_net_status = 2;
+        memcpy(g_connect_speed_table, speed, 8);
+        usbd_cdc_ncm_send_notify(CDC_ECM_NOTIFY_CODE_NETWORK_CONNECTION, CDC_ECM_NET_CONNECTED, NULL);
+    } else {
+        g_current_net_status = 1;
+        usbd_cdc_ncm_send_notify(CDC_ECM_NOTIFY_CODE_NETWORK_CONNECTION, CDC_ECM_NET_DISCONNECTED, NULL);
+    }
+}
+
+__WEAK void usbd_cdc_ncm_data_recv_done(uint32_t len)
+{
+    (void)len;
+}
+
+__WEAK void usbd_cdc_ncm_data_send_done(uint32_t len)
+{
+    (void)len;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef USBD_CDC_NCM_H
+#define USBD_CDC_NCM_H
+
+#include "usb_cdc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Init cdc ncm interface driver, call it for the communication and the data interface */
+struct usbd_interface *usbd_cdc_ncm_init_intf(struct usbd_interface *intf, const uint8_t int_ep, const uint8_t out_ep, const uint8_t in_ep);
+
+void usbd_cdc_ncm_set_connect(bool connect, uint32_t speed[2]);
+
+void usbd_cdc_ncm_data_recv_done(uint32_t len);
+void usbd_cdc_ncm_data_send_done(uint32_t len);
+
+#ifdef CONFIG_USBDEV_CDC_NCM_USING_LWIP
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+/* one datagram of the received ntbs, NULL if none */
+struct pbuf *usbd_cdc_ncm_eth_rx(void);
+/*
+ * add a datagram to the ntb sent to the host, -USB_ERR_BUSY if the ntb is full, -USB_ERR_INVAL
+ * if it is longer than an ethernet frame, it is then dropped and counted
+ */
+int usbd_cdc_ncm_eth_tx(struct pbuf *p);
+/* datagrams dropped by usbd_cdc_ncm_eth_tx because longer than an ethernet frame */
+uint32_t usbd_cdc_ncm_get_tx_oversize(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* USBD_CDC_NCM_H */
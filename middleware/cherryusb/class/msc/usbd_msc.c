@@ -16,6 +16,18 @@
 #define MSD_OUT_EP_IDX 0
 #define MSD_IN_EP_IDX  1
 
+#ifndef CONFIG_USBDEV_MSC_BUFCOUNT
+#define CONFIG_USBDEV_MSC_BUFCOUNT 1
+#endif
+
+/* with more than one buffer, the msc thread accesses the storage while the bus moves the previous buffer */
+#if defined(CONFIG_USBDEV_MSC_THREAD) && (CONFIG_USBDEV_MSC_BUFCOUNT > 1)
+#define USBD_MSC_PIPELINE
+#define USBD_MSC_BUFCOUNT CONFIG_USBDEV_MSC_BUFCOUNT
+#else
+#define USBD_MSC_BUFCOUNT 1
+#endif
+
 /* Describe EndPoints configuration */
 static struct usbd_endpoint mass_ep_data[CONFIG_USBDEV_MAX_BUS][2];
 
@@ -46,7 +58,18 @@ USB_NOCACHE_RAM_SECTION struct usbd_msc_priv {
     uint32_t scsi_blk_size[CONFIG_USBDEV_MSC_MAX_LUN];
     uint32_t scsi_blk_nbr[CONFIG_USBDEV_MSC_MAX_LUN];
 
-    USB_MEM_ALIGNX uint8_t block_buffer[CONFIG_USBDEV_MSC_MAX_BUFSIZE];
+    USB_MEM_ALIGNX uint8_t block_buffer[USBD_MSC_BUFCOUNT][CONFIG_USBDEV_MSC_MAX_BUFSIZE];
+
+#if defined(USBD_MSC_PIPELINE)
+    /* buffer ring between the storage and the bus, the producer is the storage for reads and the bus for writes */
+    uint32_t buf_len[USBD_MSC_BUFCOUNT];
+    uint8_t buf_prod;
+    uint8_t buf_cons;
+    uint8_t buf_count;
+    bool usb_busy;
+    bool pipe_error;
+    uint32_t usb_nsectors; /* sectors not requested on the bus yet, for writes */
+#endif
 
 #if defined(CONFIG_USBDEV_MSC_THREAD)
     usb_osal_mq_t usbd_msc_mq;
@@ -178,8 +201,13 @@ static void usbd_msc_send_info(uint8_t busid, uint8_t *buffer, uint8_t size)
     g_usbd_msc[busid].csw.bStatus = CSW_STATUS_CMD_PASSED;
 }
 
+#if defined(USBD_MSC_PIPELINE)
+static void usbd_msc_pipe_reset(uint8_t busid);
+static void usbd_msc_pipe_receive(uint8_t busid);
+#else
 static bool SCSI_processWrite(uint8_t busid, uint32_t nbytes);
 static bool SCSI_processRead(uint8_t busid);
+#endif
 
 /**
 * @brief  SCSI_SetSenseData
@@ -536,6 +564,9 @@ static bool SCSI_read10(uint8_t busid, uint8_t **data, uint32_t *len)
     }
     g_usbd_msc[busid].stage = MSC_DATA_IN;
 #if defined(CONFIG_USBDEV_MSC_THREAD)
+#if defined(USBD_MSC_PIPELINE)
+    usbd_msc_pipe_reset(busid);
+#endif
     usb_osal_mq_send(g_usbd_msc[busid].usbd_msc_mq, MSC_DATA_IN);
     return true;
 #elif defined(CONFIG_USBDEV_MSC_POLLING)
@@ -574,6 +605,9 @@ static bool SCSI_read12(uint8_t busid, uint8_t **data, uint32_t *len)
     }
     g_usbd_msc[busid].stage = MSC_DATA_IN;
 #if defined(CONFIG_USBDEV_MSC_THREAD)
+#if defined(USBD_MSC_PIPELINE)
+    usbd_msc_pipe_reset(busid);
+#endif
     usb_osal_mq_send(g_usbd_msc[busid].usbd_msc_mq, MSC_DATA_IN);
     return true;
 #elif defined(CONFIG_USBDEV_MSC_POLLING)
@@ -612,8 +646,13 @@ static bool SCSI_write10(uint8_t busid, uint8_t **data, uint32_t *len)
         return false;
     }
     g_usbd_msc[busid].stage = MSC_DATA_OUT;
+#if defined(USBD_MSC_PIPELINE)
+    usbd_msc_pipe_reset(busid);
+    usbd_msc_pipe_receive(busid);
+#else
     data_len = MIN(data_len, CONFIG_USBDEV_MSC_MAX_BUFSIZE);
-    usbd_ep_start_read(busid, mass_ep_data[busid][MSD_OUT_EP_IDX].ep_addr, g_usbd_msc[busid].block_buffer, data_len);
+    usbd_ep_start_read(busid, mass_ep_data[busid][MSD_OUT_EP_IDX].ep_addr, g_usbd_msc[busid].block_buffer[0], data_len);
+#endif
     return true;
 }
 
@@ -645,8 +684,13 @@ static bool SCSI_write12(uint8_t busid, uint8_t **data, uint32_t *len)
         return false;
     }
     g_usbd_msc[busid].stage = MSC_DATA_OUT;
+#if defined(USBD_MSC_PIPELINE)
+    usbd_msc_pipe_reset(busid);
+    usbd_msc_pipe_receive(busid);
+#else
     data_len = MIN(data_len, CONFIG_USBDEV_MSC_MAX_BUFSIZE);
-    usbd_ep_start_read(busid, mass_ep_data[busid][MSD_OUT_EP_IDX].ep_addr, g_usbd_msc[busid].block_buffer, data_len);
+    usbd_ep_start_read(busid, mass_ep_data[busid][MSD_OUT_EP_IDX].ep_addr, g_usbd_msc[busid].block_buffer[0], data_len);
+#endif
     return true;
 }
 /* do not use verify to reduce code size */
@@ -696,6 +740,7 @@ static bool SCSI_verify10(uint8_t busid, uint8_t **data, uint32_t *len)
 }
 #endif
 
+#if !defined(USBD_MSC_PIPELINE)
 static bool SCSI_processRead(uint8_t busid)
 {
     uint32_t transfer_len;
@@ -704,7 +749,7 @@ static bool SCSI_processRead(uint8_t busid)
 
     transfer_len = MIN(g_usbd_msc[busid].nsectors * g_usbd_msc[busid].scsi_blk_size[g_usbd_msc[busid].cbw.bLUN], CONFIG_USBDEV_MSC_MAX_BUFSIZE);
 
-    if (usbd_msc_sector_read(busid, g_usbd_msc[busid].cbw.bLUN, g_usbd_msc[busid].start_sector, g_usbd_msc[busid].block_buffer, transfer_len) != 0) {
+    if (usbd_msc_sector_read(busid, g_usbd_msc[busid].cbw.bLUN, g_usbd_msc[busid].start_sector, g_usbd_msc[busid].block_buffer[0], transfer_len) != 0) {
         SCSI_SetSenseData(busid, SCSI_KCQHE_UREINRESERVEDAREA);
         return false;
     }
@@ -717,7 +762,7 @@ static bool SCSI_processRead(uint8_t busid)
         g_usbd_msc[busid].stage = MSC_SEND_CSW;
     }
 
-    usbd_ep_start_write(busid, mass_ep_data[busid][MSD_IN_EP_IDX].ep_addr, g_usbd_msc[busid].block_buffer, transfer_len);
+    usbd_ep_start_write(busid, mass_ep_data[busid][MSD_IN_EP_IDX].ep_addr, g_usbd_msc[busid].block_buffer[0], transfer_len);
 
     return true;
 }
@@ -727,7 +772,7 @@ static bool SCSI_processWrite(uint8_t busid, uint32_t nbytes)
     uint32_t data_len = 0;
     USB_LOG_DBG("write lba:%d\r\n", g_usbd_msc[busid].start_sector);
 
-    if (usbd_msc_sector_write(busid, g_usbd_msc[busid].cbw.bLUN, g_usbd_msc[busid].start_sector, g_usbd_msc[busid].block_buffer, nbytes) != 0) {
+    if (usbd_msc_sector_write(busid, g_usbd_msc[busid].cbw.bLUN, g_usbd_msc[busid].start_sector, g_usbd_msc[busid].block_buffer[0], nbytes) != 0) {
         SCSI_SetSenseData(busid, SCSI_KCQHE_WRITEFAULT);
         return false;
     }
@@ -740,15 +785,193 @@ static bool SCSI_processWrite(uint8_t busid, uint32_t nbytes)
         usbd_msc_send_csw(busid, CSW_STATUS_CMD_PASSED);
     } else {
         data_len = MIN(g_usbd_msc[busid].nsectors * g_usbd_msc[busid].scsi_blk_size[g_usbd_msc[busid].cbw.bLUN], CONFIG_USBDEV_MSC_MAX_BUFSIZE);
-        usbd_ep_start_read(busid, mass_ep_data[busid][MSD_OUT_EP_IDX].ep_addr, g_usbd_msc[busid].block_buffer, data_len);
+        usbd_ep_start_read(busid, mass_ep_data[busid][MSD_OUT_EP_IDX].ep_addr, g_usbd_msc[busid].block_buffer[0], data_len);
     }
 
     return true;
 }
+#endif
+
+#if defined(USBD_MSC_PIPELINE)
+static void usbd_msc_pipe_reset(uint8_t busid)
+{
+    g_usbd_msc[busid].buf_prod = 0;
+    g_usbd_msc[busid].buf_cons = 0;
+    g_usbd_msc[busid].buf_count = 0;
+    g_usbd_msc[busid].usb_busy = false;
+    g_usbd_msc[busid].pipe_error = false;
+    g_usbd_msc[busid].usb_nsectors = g_usbd_msc[busid].nsectors;
+}
+
+/* send the oldest filled buffer if the in ep is idle, called in isr or critical section */
+static void usbd_msc_pipe_send(uint8_t busid)
+{
+    uint8_t idx = g_usbd_msc[busid].buf_cons;
+
+    if (!g_usbd_msc[busid].usb_busy && (g_usbd_msc[busid].buf_count > 0)) {
+        g_usbd_msc[busid].usb_busy = true;
+        usbd_ep_start_write(busid, mass_ep_data[busid][MSD_IN_EP_IDX].ep_addr, g_usbd_msc[busid].block_buffer[idx], g_usbd_msc[busid].buf_len[idx]);
+    }
+}
+
+/* receive into the next free buffer if the out ep is idle, called in isr or critical section */
+static void usbd_msc_pipe_receive(uint8_t busid)
+{
+    uint8_t idx = g_usbd_msc[busid].buf_prod;
+    uint32_t blk_size = g_usbd_msc[busid].scsi_blk_size[g_usbd_msc[busid].cbw.bLUN];
+    uint32_t data_len;
+
+    if (!g_usbd_msc[busid].usb_busy && !g_usbd_msc[busid].pipe_error &&
+        (g_usbd_msc[busid].usb_nsectors > 0) && (g_usbd_msc[busid].buf_count < USBD_MSC_BUFCOUNT)) {
+        data_len = MIN(g_usbd_msc[busid].usb_nsectors * blk_size, CONFIG_USBDEV_MSC_MAX_BUFSIZE);
+        g_usbd_msc[busid].usb_nsectors -= (data_len / blk_size);
+        g_usbd_msc[busid].usb_busy = true;
+        usbd_ep_start_read(busid, mass_ep_data[busid][MSD_OUT_EP_IDX].ep_addr, g_usbd_msc[busid].block_buffer[idx], data_len);
+    }
+}
+
+/* a buffer has been sent, called in isr */
+static void usbd_msc_pipe_in_done(uint8_t busid)
+{
+    g_usbd_msc[busid].usb_busy = false;
+    g_usbd_msc[busid].buf_cons = (g_usbd_msc[busid].buf_cons + 1u) % USBD_MSC_BUFCOUNT;
+    g_usbd_msc[busid].buf_count--;
+
+    if (g_usbd_msc[busid].pipe_error) {
+        usbd_msc_send_csw(busid, CSW_STATUS_CMD_FAILED); /* send fail status to host,and the host will retry*/
+        return;
+    }
+
+    usbd_msc_pipe_send(busid);
+    if (g_usbd_msc[busid].nsectors > 0) {
+        usb_osal_mq_send(g_usbd_msc[busid].usbd_msc_mq, MSC_DATA_IN);
+    } else if (g_usbd_msc[busid].buf_count == 0) {
+        usbd_msc_send_csw(busid, CSW_STATUS_CMD_PASSED);
+    }
+}
+
+/* a buffer has been received, called in isr */
+static void usbd_msc_pipe_out_done(uint8_t busid, uint32_t nbytes)
+{
+    g_usbd_msc[busid].usb_busy = false;
+
+    if (g_usbd_msc[busid].pipe_error) {
+        usbd_msc_send_csw(busid, CSW_STATUS_CMD_FAILED); /* send fail status to host,and the host will retry*/
+        return;
+    }
+
+    g_usbd_msc[busid].buf_len[g_usbd_msc[busid].buf_prod] = nbytes;
+    g_usbd_msc[busid].buf_prod = (g_usbd_msc[busid].buf_prod + 1u) % USBD_MSC_BUFCOUNT;
+    g_usbd_msc[busid].buf_count++;
+
+    usbd_msc_pipe_receive(busid);
+    usb_osal_mq_send(g_usbd_msc[busid].usbd_msc_mq, MSC_DATA_OUT);
+}
+
+/* storage access failed, the csw is sent now or when the bus transfer in flight is done */
+static void usbd_msc_pipe_fail(uint8_t busid)
+{
+    size_t flags;
+    bool send_csw;
+
+    flags = usb_osal_enter_critical_section();
+    g_usbd_msc[busid].pipe_error = true;
+    send_csw = !g_usbd_msc[busid].usb_busy;
+    usb_osal_leave_critical_section(flags);
+
+    if (send_csw) {
+        usbd_msc_send_csw(busid, CSW_STATUS_CMD_FAILED); /* send fail status to host,and the host will retry*/
+    }
+}
+
+/* fill the free buffers from the storage, the isr sends them */
+static void usbd_msc_pipe_read(uint8_t busid)
+{
+    uint32_t blk_size = g_usbd_msc[busid].scsi_blk_size[g_usbd_msc[busid].cbw.bLUN];
+    uint32_t transfer_len;
+    size_t flags;
+    uint8_t idx;
+
+    while (1) {
+        flags = usb_osal_enter_critical_section();
+        if ((g_usbd_msc[busid].stage != MSC_DATA_IN) || g_usbd_msc[busid].pipe_error ||
+            (g_usbd_msc[busid].nsectors == 0) || (g_usbd_msc[busid].buf_count == USBD_MSC_BUFCOUNT)) {
+            usb_osal_leave_critical_section(flags);
+            break;
+        }
+        idx = g_usbd_msc[busid].buf_prod;
+        usb_osal_leave_critical_section(flags);
+
+        USB_LOG_DBG("read lba:%d\r\n", g_usbd_msc[busid].start_sector);
+
+        transfer_len = MIN(g_usbd_msc[busid].nsectors * blk_size, CONFIG_USBDEV_MSC_MAX_BUFSIZE);
+        if (usbd_msc_sector_read(busid, g_usbd_msc[busid].cbw.bLUN, g_usbd_msc[busid].start_sector, g_usbd_msc[busid].block_buffer[idx], transfer_len) != 0) {
+            SCSI_SetSenseData(busid, SCSI_KCQHE_UREINRESERVEDAREA);
+            usbd_msc_pipe_fail(busid);
+            break;
+        }
+
+        flags = usb_osal_enter_critical_section();
+        g_usbd_msc[busid].start_sector += (transfer_len / blk_size);
+        g_usbd_msc[busid].nsectors -= (transfer_len / blk_size);
+        g_usbd_msc[busid].csw.dDataResidue -= transfer_len;
+        g_usbd_msc[busid].buf_len[idx] = transfer_len;
+        g_usbd_msc[busid].buf_prod = (idx + 1u) % USBD_MSC_BUFCOUNT;
+        g_usbd_msc[busid].buf_count++;
+        usbd_msc_pipe_send(busid);
+        usb_osal_leave_critical_section(flags);
+    }
+}
+
+/* drain the received buffers to the storage, the isr receives the next ones */
+static void usbd_msc_pipe_write(uint8_t busid)
+{
+    uint32_t blk_size = g_usbd_msc[busid].scsi_blk_size[g_usbd_msc[busid].cbw.bLUN];
+    uint32_t nbytes;
+    size_t flags;
+    uint8_t idx;
+    bool done;
+
+    while (1) {
+        flags = usb_osal_enter_critical_section();
+        if ((g_usbd_msc[busid].stage != MSC_DATA_OUT) || g_usbd_msc[busid].pipe_error ||
+            (g_usbd_msc[busid].buf_count == 0)) {
+            usb_osal_leave_critical_section(flags);
+            break;
+        }
+        idx = g_usbd_msc[busid].buf_cons;
+        nbytes = g_usbd_msc[busid].buf_len[idx];
+        usb_osal_leave_critical_section(flags);
+
+        USB_LOG_DBG("write lba:%d\r\n", g_usbd_msc[busid].start_sector);
+
+        if (usbd_msc_sector_write(busid, g_usbd_msc[busid].cbw.bLUN, g_usbd_msc[busid].start_sector, g_usbd_msc[busid].block_buffer[idx], nbytes) != 0) {
+            SCSI_SetSenseData(busid, SCSI_KCQHE_WRITEFAULT);
+            usbd_msc_pipe_fail(busid);
+            break;
+        }
+
+        flags = usb_osal_enter_critical_section();
+        g_usbd_msc[busid].start_sector += (nbytes / blk_size);
+        g_usbd_msc[busid].nsectors -= (nbytes / blk_size);
+        g_usbd_msc[busid].csw.dDataResidue -= nbytes;
+        g_usbd_msc[busid].buf_cons = (idx + 1u) % USBD_MSC_BUFCOUNT;
+        g_usbd_msc[busid].buf_count--;
+        usbd_msc_pipe_receive(busid);
+        done = (g_usbd_msc[busid].nsectors == 0);
+        usb_osal_leave_critical_section(flags);
+
+        if (done) {
+            usbd_msc_send_csw(busid, CSW_STATUS_CMD_PASSED);
+            break;
+        }
+    }
+}
+#endif
 
 static bool SCSI_CBWDecode(uint8_t busid, uint32_t nbytes)
 {
-    uint8_t *buf2send = g_usbd_msc[busid].block_buffer;
+    uint8_t *buf2send = g_usbd_msc[busid].block_buffer[0];
     uint32_t len2send = 0;
     bool ret = false;
 
@@ -847,7 +1070,9 @@ void mass_storage_bulk_out(uint8_t busid, uint8_t ep, uint32_t nbytes)
             switch (g_usbd_msc[busid].cbw.CB[0]) {
                 case SCSI_CMD_WRITE10:
                 case SCSI_CMD_WRITE12:
-#if defined(CONFIG_USBDEV_MSC_THREAD)
+#if defined(USBD_MSC_PIPELINE)
+                    usbd_msc_pipe_out_done(busid, nbytes);
+#elif defined(CONFIG_USBDEV_MSC_THREAD)
                     g_usbd_msc[busid].nbytes = nbytes;
                     usb_osal_mq_send(g_usbd_msc[busid].usbd_msc_mq, MSC_DATA_OUT);
 #elif defined(CONFIG_USBDEV_MSC_POLLING)
@@ -878,7 +1103,9 @@ void mass_storage_bulk_in(uint8_t busid, uint8_t ep, uint32_t nbytes)
             switch (g_usbd_msc[busid].cbw.CB[0]) {
                 case SCSI_CMD_READ10:
                 case SCSI_CMD_READ12:
-#if defined(CONFIG_USBDEV_MSC_THREAD)
+#if defined(USBD_MSC_PIPELINE)
+                    usbd_msc_pipe_in_done(busid);
+#elif defined(CONFIG_USBDEV_MSC_THREAD)
                     usb_osal_mq_send(g_usbd_msc[busid].usbd_msc_mq, MSC_DATA_IN);
 #elif defined(CONFIG_USBDEV_MSC_POLLING)
                     chry_ringbuffer_write_byte(&g_usbd_msc[busid].msc_rb, MSC_DATA_IN);
@@ -923,6 +1150,16 @@ static void usbdev_msc_thread(CONFIG_USB_OSAL_THREAD_SET_ARGV)
             continue;
         }
         USB_LOG_DBG("event:%d\r\n", event);
+#if defined(USBD_MSC_PIPELINE)
+        /* events may be dropped while the queue is full, the stage tells what is pending */
+        (void)event;
+        if (g_usbd_msc[busid].stage == MSC_DATA_OUT) {
+            usbd_msc_pipe_write(busid);
+        } else if (g_usbd_msc[busid].stage == MSC_DATA_IN) {
+            usbd_msc_pipe_read(busid);
+        } else {
+        }
+#else
         if (event == MSC_DATA_OUT) {
             if (SCSI_processWrite(busid, g_usbd_msc[busid].nbytes) == false) {
                 usbd_msc_send_csw(busid, CSW_STATUS_CMD_FAILED); /* send fail status to host,and the host will retry*/
@@ -933,6 +1170,7 @@ static void usbdev_msc_thread(CONFIG_USB_OSAL_THREAD_SET_ARGV)
             }
         } else {
         }
+#endif
     }
 }
 #elif defined(CONFIG_USBDEV_MSC_POLLING)
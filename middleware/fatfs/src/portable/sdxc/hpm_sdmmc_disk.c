@@ -16,6 +16,9 @@
 
 #define SD_SECTOR_SIZE (512UL)
 
+#define SDMMC_DISK_IS_DMA_ALIGNED(buf) (((uint32_t) (buf) % 4U) == 0U)
+#define SDMMC_DISK_IS_CACHELINE_ALIGNED(buf) (((uint32_t) (buf) % HPM_L1C_CACHELINE_SIZE) == 0U)
+
 typedef hpm_stat_t (*sdmmc_write_op_t)(void *card, const uint8_t *buffer, uint32_t start_block, uint32_t block_count);
 typedef hpm_stat_t (*sdmmc_read_op_t)(void *card, uint8_t *buffer, uint32_t start_block, uint32_t block_count);
 
@@ -61,105 +64,178 @@ void mmc_isr(void)
 
 
 #if defined(SD_FATFS_ENABLE) || defined(MMC_FATFS_ENABLE)
-static void sdmmc_get_card_and_aligned_buf_info(BYTE pdrv, void **card, uint32_t **buf, uint32_t *buf_size)
+typedef struct {
+    void *card;
+    sdmmc_read_op_t read;
+    sdmmc_write_op_t write;
+    uint8_t *bounce_buf;
+    uint32_t bounce_size;
+} sdmmc_disk_t;
+
+static const sdmmc_disk_t *sdmmc_get_disk(BYTE pdrv)
 {
 #if defined(SD_FATFS_ENABLE) && SD_FATFS_ENABLE
+    static const sdmmc_disk_t sd_disk = {
+        .card = &s_sd,
+        .read = (sdmmc_read_op_t) sd_read_blocks,
+        .write = (sdmmc_write_op_t) sd_write_blocks,
+        .bounce_buf = (uint8_t *) s_sd_aligned_buf,
+        .bounce_size = sizeof(s_sd_aligned_buf),
+    };
     if (pdrv == DEV_SD) {
-        *card = &s_sd;
-        *buf =  s_sd_aligned_buf;
-        *buf_size = sizeof(s_sd_aligned_buf);
+        return &sd_disk;
     }
 #endif
 #if defined(MMC_FATFS_ENABLE) && MMC_FATFS_ENABLE
+    static const sdmmc_disk_t emmc_disk = {
+        .card = &s_emmc,
+        .read = (sdmmc_read_op_t) emmc_read_blocks,
+        .write = (sdmmc_write_op_t) emmc_write_blocks,
+        .bounce_buf = (uint8_t *) s_emmc_aligned_buf,
+        .bounce_size = sizeof(s_emmc_aligned_buf),
+    };
     if (pdrv == DEV_MMC) {
-        *card = &s_emmc;
-        *buf =  s_emmc_aligned_buf;
-        *buf_size = sizeof(s_emmc_aligned_buf);
+        return &emmc_disk;
     }
 #endif
+    return NULL;
 }
 
-static DSTATUS sdmmc_card_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
+/*
+ * The hpm_sdmmc library maintains the cache around each transfer unless it is built with
+ * HPM_SDMMC_ENABLE_CACHE_MAINTENANCE=0, the port only has to do it in that case.
+ */
+static void sdmmc_disk_cache_writeback(const void *buf, uint32_t size)
 {
-    sdmmc_write_op_t card_write;
-    void *card;
-    uint32_t *aligned_buf;
-    uint32_t aligned_buf_size;
-    sdmmc_get_card_and_aligned_buf_info(pdrv, &card, &aligned_buf, &aligned_buf_size);
-#if defined(SD_FATFS_ENABLE) && SD_FATFS_ENABLE
-    if (pdrv == DEV_SD) {
-        card_write = (sdmmc_write_op_t)sd_write_blocks;
-    }
+#if defined(HPM_SDMMC_ENABLE_CACHE_MAINTENANCE) && (HPM_SDMMC_ENABLE_CACHE_MAINTENANCE == 0)
+    uint32_t start = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) buf);
+    uint32_t aligned_start = HPM_L1C_CACHELINE_ALIGN_DOWN(start);
+    uint32_t aligned_end = HPM_L1C_CACHELINE_ALIGN_UP(start + size);
+    l1c_dc_writeback(aligned_start, aligned_end - aligned_start);
+#else
+    (void) buf;
+    (void) size;
 #endif
-#if defined(MMC_FATFS_ENABLE) && MMC_FATFS_ENABLE
-    if (pdrv == DEV_MMC) {
-        card_write = (sdmmc_write_op_t)emmc_write_blocks;
-    }
+}
+
+static void sdmmc_disk_cache_invalidate(void *buf, uint32_t size)
+{
+#if defined(HPM_SDMMC_ENABLE_CACHE_MAINTENANCE) && (HPM_SDMMC_ENABLE_CACHE_MAINTENANCE == 0)
+    uint32_t start = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) buf);
+    uint32_t aligned_start = HPM_L1C_CACHELINE_ALIGN_DOWN(start);
+    uint32_t aligned_end = HPM_L1C_CACHELINE_ALIGN_UP(start + size);
+    l1c_dc_invalidate(aligned_start, aligned_end - aligned_start);
+#else
+    (void) buf;
+    (void) size;
 #endif
-    if (((uint32_t) buff % 4) != 0) {
-        uint32_t sys_aligned_buf_addr = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) aligned_buf);
-        uint32_t remaining_size = SD_SECTOR_SIZE * count;
-        while (remaining_size > 0) {
-            uint32_t write_size = MIN(aligned_buf_size, remaining_size);
-            memcpy(aligned_buf, buff, write_size);
-            l1c_dc_flush(sys_aligned_buf_addr, write_size);
-            uint32_t sector_count = (uint32_t) write_size / SD_SECTOR_SIZE;
-            if (card_write(card, (const uint8_t *) sys_aligned_buf_addr, (uint32_t) sector, sector_count) !=
-                status_success) {
-                return RES_ERROR;
-            }
-            buff += write_size;
-            sector += sector_count;
-            remaining_size -= write_size;
-        }
-    } else {
-        if (card_write(card, (const uint8_t *) buff, (uint32_t) sector, (uint32_t) count) != status_success) {
+}
+
+static DRESULT sdmmc_disk_read_bounce(const sdmmc_disk_t *disk, BYTE *buff, LBA_t sector, UINT count)
+{
+    while (count > 0) {
+        uint32_t sector_count = MIN(count, disk->bounce_size / SD_SECTOR_SIZE);
+        uint32_t read_size = sector_count * SD_SECTOR_SIZE;
+        if (disk->read(disk->card, disk->bounce_buf, (uint32_t) sector, sector_count) != status_success) {
             return RES_ERROR;
         }
+        sdmmc_disk_cache_invalidate(disk->bounce_buf, read_size);
+        memcpy(buff, disk->bounce_buf, read_size);
+        buff += read_size;
+        sector += sector_count;
+        count -= sector_count;
     }
-
     return RES_OK;
 }
 
-static DSTATUS sdmmc_card_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+static DRESULT sdmmc_disk_read_direct(const sdmmc_disk_t *disk, BYTE *buff, LBA_t sector, UINT count)
 {
-    sdmmc_read_op_t card_read;
-    void *card;
-    uint32_t *aligned_buf;
-    uint32_t aligned_buf_size;
-    sdmmc_get_card_and_aligned_buf_info(pdrv, &card, &aligned_buf, &aligned_buf_size);
-#if defined(SD_FATFS_ENABLE) && SD_FATFS_ENABLE
-    if (pdrv == DEV_SD) {
-        card_read = (sdmmc_read_op_t)sd_read_blocks;
+    uint32_t read_size = count * SD_SECTOR_SIZE;
+
+    /* lines shared with the head and tail sectors are written back, these sectors are filled later */
+    if (!SDMMC_DISK_IS_CACHELINE_ALIGNED(buff)) {
+        sdmmc_disk_cache_writeback(buff, 1);
+        sdmmc_disk_cache_writeback(buff + read_size - 1, 1);
     }
-#endif
-#if defined(MMC_FATFS_ENABLE) && MMC_FATFS_ENABLE
-    if (pdrv == DEV_MMC) {
-        card_read = (sdmmc_read_op_t)emmc_read_blocks;
+    sdmmc_disk_cache_invalidate(buff, read_size);
+    if (disk->read(disk->card, buff, (uint32_t) sector, count) != status_success) {
+        return RES_ERROR;
     }
-#endif
-    if (((uint32_t) buff % 4) != 0) {
-        uint32_t sys_aligned_buf_addr = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) aligned_buf);
-        uint32_t remaining_size = SD_SECTOR_SIZE * count;
-        while (remaining_size > 0) {
-            uint32_t read_size = MIN(aligned_buf_size, remaining_size);
-            uint32_t sector_count = read_size / SD_SECTOR_SIZE;
-            if (card_read(card, (uint8_t *) sys_aligned_buf_addr, sector, sector_count) != status_success) {
-                return RES_ERROR;
-            }
-            l1c_dc_invalidate(sys_aligned_buf_addr, read_size);
-            memcpy(buff, aligned_buf, read_size);
-            buff += read_size;
-            sector += sector_count;
-            remaining_size -= read_size;
-        }
-    } else {
-        if (card_read(card, (uint8_t *) buff, sector, count) != status_success) {
+    sdmmc_disk_cache_invalidate(buff, read_size);
+    return RES_OK;
+}
+
+static DRESULT sdmmc_disk_write_bounce(const sdmmc_disk_t *disk, const BYTE *buff, LBA_t sector, UINT count)
+{
+    while (count > 0) {
+        uint32_t sector_count = MIN(count, disk->bounce_size / SD_SECTOR_SIZE);
+        uint32_t write_size = sector_count * SD_SECTOR_SIZE;
+        memcpy(disk->bounce_buf, buff, write_size);
+        sdmmc_disk_cache_writeback(disk->bounce_buf, write_size);
+        if (disk->write(disk->card, disk->bounce_buf, (uint32_t) sector, sector_count) != status_success) {
             return RES_ERROR;
         }
+        buff += write_size;
+        sector += sector_count;
+        count -= sector_count;
+    }
+    return RES_OK;
+}
+
+static DSTATUS sdmmc_card_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
+{
+    const sdmmc_disk_t *disk = sdmmc_get_disk(pdrv);
+    if (disk == NULL) {
+        return RES_PARERR;
+    }
+
+    /* ADMA2 needs word aligned buffers, anything else goes through the bounce buffer */
+    if (!SDMMC_DISK_IS_DMA_ALIGNED(buff)) {
+        return sdmmc_disk_write_bounce(disk, buff, sector, count);
+    }
+
+    /* The DMA only reads the buffer, so lines shared with other data may be written back safely */
+    sdmmc_disk_cache_writeback(buff, count * SD_SECTOR_SIZE);
+    if (disk->write(disk->card, buff, (uint32_t) sector, count) != status_success) {
+        return RES_ERROR;
     }
+
     return RES_OK;
 }
+
+static DSTATUS sdmmc_card_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+{
+    const sdmmc_disk_t *disk = sdmmc_get_disk(pdrv);
+    DRESULT result;
+    if (disk == NULL) {
+        return RES_PARERR;
+    }
+
+    if (!SDMMC_DISK_IS_DMA_ALIGNED(buff)) {
+        return sdmmc_disk_read_bounce(disk, buff, sector, count);
+    }
+
+    if (SDMMC_DISK_IS_CACHELINE_ALIGNED(buff)) {
+        return sdmmc_disk_read_direct(disk, buff, sector, count);
+    }
+
+    /*
+     * The first and the last sector share a cacheline with memory outside of buff, which must not be
+     * invalidated while the DMA is running. Bounce just these two and read the rest in place.
+     */
+    if (count <= 2) {
+        return sdmmc_disk_read_bounce(disk, buff, sector, count);
+    }
+    result = sdmmc_disk_read_direct(disk, buff + SD_SECTOR_SIZE, sector + 1, count - 2);
+    if (result == RES_OK) {
+        result = sdmmc_disk_read_bounce(disk, buff, sector, 1);
+    }
+    if (result == RES_OK) {
+        result = sdmmc_disk_read_bounce(disk, buff + (count - 1) * SD_SECTOR_SIZE, sector + count - 1, 1);
+    }
+
+    return result;
+}
 #endif
 
 #if defined(SD_FATFS_ENABLE) && SD_FATFS_ENABLE
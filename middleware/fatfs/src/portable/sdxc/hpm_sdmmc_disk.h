@@ -13,7 +13,10 @@
 
 
 
+/* bounce buffer for caller buffers that aren't word aligned, and for the edge sectors of unaligned reads */
+#ifndef MAX_ALIGNED_BUF_SIZE
 #define MAX_ALIGNED_BUF_SIZE (16384U)
+#endif
 
 #ifdef __cplusplus
 extern "C" {
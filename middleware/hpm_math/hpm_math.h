@@ -9,12 +9,14 @@
 #define __HPM_MATH_H__
 
 #include <stddef.h>
+#include <stdint.h>
 /**
  * @defgroup hpmmath HPMicro Math Functions
  * @ingroup middleware_interfaces
  */
 
 #define HPM_DSP_HW_NDS32 1 /* andes hardware dsp */
+#define HPM_DSP_SW 2 /* portable C implementation in sw_dsp, any toolchain */
 
 #ifdef CONFIG_HPM_MATH_HAS_EXTRA_CONFIG
 #include CONFIG_HPM_MATH_HAS_EXTRA_CONFIG
@@ -47,7 +49,9 @@
 #define HPM_MATH_NN_SOFTMAX 1
 #define HPM_MATH_NN_UTIL 1
 
+#ifndef HPM_DSP_CORE
 #define HPM_DSP_CORE HPM_DSP_HW_NDS32 /* DSP core selection */
+#endif
 
 #define HPM_MATH_PI (3.14159265358979323846)
 
@@ -63,6 +67,19 @@
 
 #endif
 
+/*
+ * The portable implementation covers the statistics, basic, complex, filtering, matrix and
+ * transform functions, the other groups still need the andes library.
+ */
+#if HPM_DSP_CORE == HPM_DSP_SW
+#undef HPM_MATH_DSP_CONTROLLER
+#undef HPM_MATH_DSP_DISTANCE
+#undef HPM_MATH_DSP_SVM
+#undef HPM_MATH_DSP_UTILS
+#undef HPM_MATH_DSP_SORT
+#undef HPM_MATH_NN_TINYENGINE
+#endif
+
 #ifdef  __cplusplus
 extern "C"
 {
@@ -94,7 +111,7 @@ extern "C"
  */
 static inline float32_t hpm_dsp_max_f32(const float32_t *src, uint32_t size, uint32_t *index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     f32_t res;
     tpt_max_f32(&res, index, src, size);
@@ -106,7 +123,7 @@ static inline float32_t hpm_dsp_max_f32(const float32_t *src, uint32_t size, uin
 }
 static inline float32_t hpm_dsp_max_val_f32(const float32_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_max_val_f32(src, size);
 #endif
 }
@@ -119,7 +136,7 @@ static inline float32_t hpm_dsp_max_val_f32(const float32_t *src, uint32_t size)
  */
 static inline q15_t hpm_dsp_max_q15(const q15_t *src, uint32_t size, uint32_t *index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q15_t res;
     tpt_max_q15(&res, index, src, size);
@@ -139,7 +156,7 @@ static inline q15_t hpm_dsp_max_q15(const q15_t *src, uint32_t size, uint32_t *i
  */
 static inline q31_t hpm_dsp_max_q31(const q31_t *src, uint32_t size, uint32_t *index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
  #ifdef __zcc__
     q31_t res;
     tpt_max_q31(&res, index, src, size);
@@ -159,7 +176,7 @@ static inline q31_t hpm_dsp_max_q31(const q31_t *src, uint32_t size, uint32_t *i
  */
 static inline q7_t hpm_dsp_max_q7(const q7_t *src, uint32_t size, uint32_t *index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q7_t res;
     tpt_max_q7(&res, index, src, size);
@@ -179,7 +196,7 @@ static inline q7_t hpm_dsp_max_q7(const q7_t *src, uint32_t size, uint32_t *inde
  */
 static inline uint8_t hpm_dsp_max_u8(const uint8_t *src, uint32_t size, uint32_t *index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_max_u8(src, size, index);
 #endif
 }
@@ -194,7 +211,7 @@ static inline uint8_t hpm_dsp_max_u8(const uint8_t *src, uint32_t size, uint32_t
  */
 static inline float32_t hpm_dsp_min_f32(const float32_t *src, uint32_t size, uint32_t *index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     f32_t res;
     tpt_min_f32(&res, index, src, size);
@@ -214,7 +231,7 @@ static inline float32_t hpm_dsp_min_f32(const float32_t *src, uint32_t size, uin
  */
 static inline q15_t hpm_dsp_min_q15(const q15_t *src, uint32_t size, uint32_t *index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q15_t res;
     tpt_min_q15(&res, index, src, size);
@@ -234,7 +251,7 @@ static inline q15_t hpm_dsp_min_q15(const q15_t *src, uint32_t size, uint32_t *i
  */
 static inline q31_t hpm_dsp_min_q31(const q31_t *src, uint32_t size, uint32_t *index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q31_t res;
     tpt_min_q31(&res, index, src, size);
@@ -254,7 +271,7 @@ static inline q31_t hpm_dsp_min_q31(const q31_t *src, uint32_t size, uint32_t *i
  */
 static inline q7_t hpm_dsp_min_q7(const q7_t *src, uint32_t size, uint32_t *index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q7_t res;
     tpt_min_q7(&res, index, src, size);
@@ -274,7 +291,7 @@ static inline q7_t hpm_dsp_min_q7(const q7_t *src, uint32_t size, uint32_t *inde
  */
 static inline uint8_t hpm_dsp_min_u8(const uint8_t *src, uint32_t size, uint32_t *index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_min_u8(src, size, index);
 #endif
 }
@@ -288,7 +305,7 @@ static inline uint8_t hpm_dsp_min_u8(const uint8_t *src, uint32_t size, uint32_t
  */
 static inline float32_t hpm_dsp_mean_f32(const float32_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     f32_t res;
     tpt_mean_f32(&res, src, size);
@@ -312,7 +329,7 @@ static inline float32_t hpm_dsp_mean_f32(const float32_t *src, uint32_t size)
  */
 static inline q15_t hpm_dsp_mean_q15(const q15_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q15_t res;
     tpt_mean_q15(&res, src, size);
@@ -336,7 +353,7 @@ static inline q15_t hpm_dsp_mean_q15(const q15_t *src, uint32_t size)
  */
 static inline q31_t hpm_dsp_mean_q31(const q31_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q31_t res;
     tpt_mean_q31(&res, src, size);
@@ -360,7 +377,7 @@ static inline q31_t hpm_dsp_mean_q31(const q31_t *src, uint32_t size)
  */
 static inline q7_t hpm_dsp_mean_q7(const q7_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q7_t res;
     tpt_mean_q7(&res, src, size);
@@ -382,7 +399,7 @@ static inline q7_t hpm_dsp_mean_q7(const q7_t *src, uint32_t size)
  */
 static inline uint8_t hpm_dsp_mean_u8(const uint8_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_mean_u8(src, size);
 #endif
 }
@@ -396,7 +413,7 @@ static inline uint8_t hpm_dsp_mean_u8(const uint8_t *src, uint32_t size)
  */
 static inline float32_t hpm_dsp_pwr_f32(const float32_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     f32_t res;
     tpt_power_f32(&res, src, size);
@@ -421,7 +438,7 @@ static inline float32_t hpm_dsp_pwr_f32(const float32_t *src, uint32_t size)
  */
 static inline q63_t hpm_dsp_pwr_q15(const q15_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q63_t res;
     tpt_power_q15(&res, src, size);
@@ -447,7 +464,7 @@ static inline q63_t hpm_dsp_pwr_q15(const q15_t *src, uint32_t size)
  */
 static inline q63_t hpm_dsp_pwr_q31(const q31_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q63_t res;
     tpt_power_q31(&res, src, size);
@@ -472,7 +489,7 @@ static inline q63_t hpm_dsp_pwr_q31(const q31_t *src, uint32_t size)
  */
 static inline q31_t hpm_dsp_pwr_q7(const q7_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q31_t res;
     tpt_power_q7(&res, src, size);
@@ -492,7 +509,7 @@ static inline q31_t hpm_dsp_pwr_q7(const q7_t *src, uint32_t size)
  */
 static inline float32_t hpm_dsp_rms_f32(const float32_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     f32_t res;
     tpt_rms_f32(&res, src, size);
@@ -518,7 +535,7 @@ static inline float32_t hpm_dsp_rms_f32(const float32_t *src, uint32_t size)
  */
 static inline q15_t hpm_dsp_rms_q15(const q15_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q15_t res;
     tpt_rms_q15(&res, src, size);
@@ -544,7 +561,7 @@ static inline q15_t hpm_dsp_rms_q15(const q15_t *src, uint32_t size)
  */
 static inline q31_t hpm_dsp_rms_q31(const q31_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q31_t res;
     tpt_rms_q31(&res, src, size);
@@ -564,7 +581,7 @@ static inline q31_t hpm_dsp_rms_q31(const q31_t *src, uint32_t size)
  */
 static inline float32_t hpm_dsp_std_f32(const float32_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     f32_t res;
     tpt_std_f32(&res, src, size);
@@ -590,7 +607,7 @@ static inline float32_t hpm_dsp_std_f32(const float32_t *src, uint32_t size)
  */
 static inline q15_t hpm_dsp_std_q15(const q15_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q15_t res;
     tpt_std_q15(&res, src, size);
@@ -616,7 +633,7 @@ static inline q15_t hpm_dsp_std_q15(const q15_t *src, uint32_t size)
  */
 static inline q31_t hpm_dsp_std_q31(const q31_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q31_t res;
     tpt_std_q31(&res, src, size);
@@ -641,7 +658,7 @@ static inline q31_t hpm_dsp_std_q31(const q31_t *src, uint32_t size)
  */
 static inline q15_t hpm_dsp_std_u8(const uint8_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_std_u8(src, size);
 #endif
 }
@@ -655,7 +672,7 @@ static inline q15_t hpm_dsp_std_u8(const uint8_t *src, uint32_t size)
  */
 static inline float32_t hpm_dsp_var_f32(const float32_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     f32_t res;
     tpt_var_f32(&res, src, size);
@@ -681,7 +698,7 @@ static inline float32_t hpm_dsp_var_f32(const float32_t *src, uint32_t size)
  */
 static inline q31_t hpm_dsp_var_q15(const q15_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q15_t res;
     tpt_var_q15(&res, src, size);
@@ -707,7 +724,7 @@ static inline q31_t hpm_dsp_var_q15(const q15_t *src, uint32_t size)
  */
 static inline q63_t hpm_dsp_var_q31(const q31_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q31_t res;
     tpt_var_q31(&res, src, size);
@@ -728,7 +745,7 @@ static inline q63_t hpm_dsp_var_q31(const q31_t *src, uint32_t size)
  */
 static inline float32_t hpm_dsp_entropy_f32(const float32_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_entropy_f32(src, size);
 #else
@@ -751,7 +768,7 @@ static inline float32_t hpm_dsp_entropy_f32(const float32_t *src, uint32_t size)
  */
 static inline float32_t hpm_dsp_relative_entropy_f32(const float32_t *src1, const float32_t *src2, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_relative_entropy_f32(src1, src2, size);
 #else
@@ -769,7 +786,7 @@ static inline float32_t hpm_dsp_relative_entropy_f32(const float32_t *src1, cons
  */
 static inline float32_t hpm_dsp_lse_f32(const float32_t *src, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_lse_f32(src, size);
 #else
@@ -789,7 +806,7 @@ static inline float32_t hpm_dsp_lse_f32(const float32_t *src, uint32_t size)
  */
 static inline float32_t hpm_dsp_lse_dprod_f32(const float32_t *src1, const float32_t *src2, uint32_t size, float32_t *buffer)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_lse_dprod_f32(src1, src2, size, buffer);
 #else
@@ -809,7 +826,7 @@ static inline float32_t hpm_dsp_lse_dprod_f32(const float32_t *src1, const float
  */
 static inline uint32_t hpm_dsp_gaussian_naive_bayes_est_f32(const riscv_dsp_gaussian_naivebayes_f32_t *instance, const float32_t * src, float32_t *buf)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_gaussian_naive_bayes_est_f32(instance, src, buf);
 #endif
 }
@@ -823,7 +840,7 @@ static inline uint32_t hpm_dsp_gaussian_naive_bayes_est_f32(const riscv_dsp_gaus
  */
 static inline float32_t hpm_dsp_absmax_f32(const float32_t* src, uint32_t size, uint32_t* index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_absmax_f32(src, size, index);
 #endif
 }
@@ -837,7 +854,7 @@ static inline float32_t hpm_dsp_absmax_f32(const float32_t* src, uint32_t size,
  */
 static inline q15_t hpm_dsp_absmax_q15(const q15_t* src, uint32_t size, uint32_t* index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_absmax_q15(src, size, index);
 #endif
 }
@@ -851,7 +868,7 @@ static inline q15_t hpm_dsp_absmax_q15(const q15_t* src, uint32_t size, uint32_t
  */
 static inline q31_t hpm_dsp_absmax_q31(const q31_t* src, uint32_t size, uint32_t* index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_absmax_q31(src, size, index);
 #endif
 }
@@ -865,7 +882,7 @@ static inline q31_t hpm_dsp_absmax_q31(const q31_t* src, uint32_t size, uint32_t
  */
 static inline q7_t hpm_dsp_absmax_q7(const q7_t* src, uint32_t size, uint32_t* index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_absmax_q7(src, size, index);
 #endif
 }
@@ -879,7 +896,7 @@ static inline q7_t hpm_dsp_absmax_q7(const q7_t* src, uint32_t size, uint32_t* i
  */
 static inline float32_t hpm_dsp_absmin_f32(const float32_t* src, uint32_t size, uint32_t* index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_absmin_f32(src, size, index);
 #endif
 }
@@ -893,7 +910,7 @@ static inline float32_t hpm_dsp_absmin_f32(const float32_t* src, uint32_t size,
  */
 static inline q31_t hpm_dsp_absmin_q31(const q31_t* src, uint32_t size, uint32_t* index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_absmin_q31(src, size, index);
 #endif
 }
@@ -907,7 +924,7 @@ static inline q31_t hpm_dsp_absmin_q31(const q31_t* src, uint32_t size, uint32_t
  */
 static inline q15_t hpm_dsp_absmin_q15(const q15_t* src, uint32_t size, uint32_t* index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_absmin_q15(src, size, index);
 #endif
 }
@@ -921,7 +938,7 @@ static inline q15_t hpm_dsp_absmin_q15(const q15_t* src, uint32_t size, uint32_t
  */
 static inline q7_t hpm_dsp_absmin_q7(const q7_t* src, uint32_t size, uint32_t* index)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_absmin_q7(src, size, index);
 #endif
 }
@@ -958,7 +975,7 @@ static inline q7_t hpm_dsp_absmin_q7(const q7_t* src, uint32_t size, uint32_t* i
  */
 static inline void hpm_dsp_abs_f32(float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_abs_f32(dst, src, size);
 #else
@@ -978,7 +995,7 @@ static inline void hpm_dsp_abs_f32(float32_t *src, float32_t *dst, uint32_t size
  */
 static inline void hpm_dsp_abs_q31(q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_abs_q31(dst, src, size);
 #else
@@ -999,7 +1016,7 @@ static inline void hpm_dsp_abs_q31(q31_t *src, q31_t *dst, uint32_t size)
  */
 static inline void hpm_dsp_abs_q15(q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_abs_q15(dst, src, size);
 #else
@@ -1019,7 +1036,7 @@ static inline void hpm_dsp_abs_q15(q15_t *src, q15_t *dst, uint32_t size)
  */
 static inline void hpm_dsp_abs_q7(q7_t *src, q7_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_abs_q7(dst, src, size);
 #else
@@ -1038,7 +1055,7 @@ static inline void hpm_dsp_abs_q7(q7_t *src, q7_t *dst, uint32_t size)
  */
 static inline void hpm_dsp_add_f32(float32_t *src1, float32_t *src2, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_add_f32(dst, src1, src2, size);
 #else
@@ -1058,7 +1075,7 @@ static inline void hpm_dsp_add_f32(float32_t *src1, float32_t *src2, float32_t *
  */
 static inline void hpm_dsp_add_q31(q31_t *src1, q31_t *src2, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_add_q31(dst, src1, src2, size);
 #else
@@ -1078,7 +1095,7 @@ static inline void hpm_dsp_add_q31(q31_t *src1, q31_t *src2, q31_t *dst, uint32_
  */
 static inline void hpm_dsp_add_q15(q15_t *src1, q15_t *src2, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_add_q15(dst, src1, src2, size);
 #else
@@ -1098,7 +1115,7 @@ static inline void hpm_dsp_add_q15(q15_t *src1, q15_t *src2, q15_t *dst, uint32_
  */
 static inline void hpm_dsp_add_q7(q7_t *src1, q7_t *src2, q7_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_add_q7(dst, src1, src2, size);
 #else
@@ -1118,7 +1135,7 @@ static inline void hpm_dsp_add_q7(q7_t *src1, q7_t *src2, q7_t *dst, uint32_t si
  */
 static inline void hpm_dsp_add_u8_u16(uint8_t *src1, uint8_t *src2, uint16_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_add_u8_u16(dst, src1, src2, size);
 #else
@@ -1137,7 +1154,7 @@ static inline void hpm_dsp_add_u8_u16(uint8_t *src1, uint8_t *src2, uint16_t *ds
  */
 static inline void hpm_dsp_sub_f32(float32_t *src1, float32_t *src2, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_sub_f32(dst, src1, src2, size);
 #else
@@ -1157,7 +1174,7 @@ static inline void hpm_dsp_sub_f32(float32_t *src1, float32_t *src2, float32_t *
  */
 static inline void hpm_dsp_sub_q31(q31_t *src1, q31_t *src2, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_sub_q31(dst, src1, src2, size);
 #else
@@ -1177,7 +1194,7 @@ static inline void hpm_dsp_sub_q31(q31_t *src1, q31_t *src2, q31_t *dst, uint32_
  */
 static inline void hpm_dsp_sub_q15(q15_t *src1, q15_t *src2, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_sub_q15(dst, src1, src2, size);
 #else
@@ -1197,7 +1214,7 @@ static inline void hpm_dsp_sub_q15(q15_t *src1, q15_t *src2, q15_t *dst, uint32_
  */
 static inline void hpm_dsp_sub_q7(q7_t *src1, q7_t *src2, q7_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_sub_q7(dst, src1, src2, size);
 #else
@@ -1217,7 +1234,7 @@ static inline void hpm_dsp_sub_q7(q7_t *src1, q7_t *src2, q7_t *dst, uint32_t si
  */
 static inline void hpm_dsp_sub_u8_q7(uint8_t *src1, uint8_t *src2, q7_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_sub_u8_q7(src1, src2, dst, size);
 #endif
 }
@@ -1232,7 +1249,7 @@ static inline void hpm_dsp_sub_u8_q7(uint8_t *src1, uint8_t *src2, q7_t *dst, ui
  */
 static inline void hpm_dsp_mul_f32(float32_t *src1, float32_t *src2, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mult_f32(dst, src1, src2, size);
 #else
@@ -1252,7 +1269,7 @@ static inline void hpm_dsp_mul_f32(float32_t *src1, float32_t *src2, float32_t *
  */
 static inline void hpm_dsp_mul_q31(q31_t *src1, q31_t *src2, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mult_q31(dst, src1, src2, size);
 #else
@@ -1272,7 +1289,7 @@ static inline void hpm_dsp_mul_q31(q31_t *src1, q31_t *src2, q31_t *dst, uint32_
  */
 static inline void hpm_dsp_mul_q15(q15_t *src1, q15_t *src2, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mult_q15(dst, src1, src2, size);
 #else
@@ -1292,7 +1309,7 @@ static inline void hpm_dsp_mul_q15(q15_t *src1, q15_t *src2, q15_t *dst, uint32_
  */
 static inline void hpm_dsp_mul_q7(q7_t *src1, q7_t *src2, q7_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mult_q7(dst, src1, src2, size);
 #else
@@ -1312,7 +1329,7 @@ static inline void hpm_dsp_mul_q7(q7_t *src1, q7_t *src2, q7_t *dst, uint32_t si
  */
 static inline void hpm_dsp_mul_u8_u16(uint8_t *src1, uint8_t *src2, uint16_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_mul_u8_u16(src1, src2, dst, size);
 #endif
 }
@@ -1327,7 +1344,7 @@ static inline void hpm_dsp_mul_u8_u16(uint8_t *src1, uint8_t *src2, uint16_t *ds
  */
 static inline void hpm_dsp_div_f32(float32_t *src1, float32_t *src2, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_div_f32(dst, src1, src2, size);
 #else
@@ -1344,7 +1361,7 @@ static inline void hpm_dsp_div_f32(float32_t *src1, float32_t *src2, float32_t *
  */
 static inline q31_t hpm_dsp_div_q31(q31_t src1, q31_t src2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_div_q31(src1, src2);
 #else
@@ -1361,7 +1378,7 @@ static inline q31_t hpm_dsp_div_q31(q31_t src1, q31_t src2)
  */
 static inline q31_t hpm_dsp_div_s64_u32(q63_t src1, uint32_t src2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_div_s64_u32(src1, src2);
 #else
@@ -1378,7 +1395,7 @@ static inline q31_t hpm_dsp_div_s64_u32(q63_t src1, uint32_t src2)
  */
 static inline q31_t hpm_dsp_div_u64_u32(uint64_t src1, uint32_t src2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_div_u64_u32(src1, src2);
 #else
@@ -1396,7 +1413,7 @@ static inline q31_t hpm_dsp_div_u64_u32(uint64_t src1, uint32_t src2)
  */
 static inline void hpm_dsp_neg_f32(float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_negate_f32(dst, src, size);
 #else
@@ -1416,7 +1433,7 @@ static inline void hpm_dsp_neg_f32(float32_t *src, float32_t *dst, uint32_t size
  */
 static inline void hpm_dsp_neg_q31(q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_negate_q31(dst, src, size);
 #else
@@ -1436,7 +1453,7 @@ static inline void hpm_dsp_neg_q31(q31_t *src, q31_t *dst, uint32_t size)
  */
 static inline void hpm_dsp_neg_q15(q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_negate_q15(dst, src, size);
 #else
@@ -1456,7 +1473,7 @@ static inline void hpm_dsp_neg_q15(q15_t *src, q15_t *dst, uint32_t size)
  */
 static inline void hpm_dsp_neg_q7(q7_t *src, q7_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_negate_q7(dst, src, size);
 #else
@@ -1475,7 +1492,7 @@ static inline void hpm_dsp_neg_q7(q7_t *src, q7_t *dst, uint32_t size)
  */
 static inline float32_t hpm_dsp_dprod_f32(float32_t *src1, float32_t *src2, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     f32_t res;
     tpt_dot_prod_f32(&res, src1, src2, size);
@@ -1500,7 +1517,7 @@ static inline float32_t hpm_dsp_dprod_f32(float32_t *src1, float32_t *src2, uint
  */
 static inline q63_t hpm_dsp_dprod_q31(q31_t *src1, q31_t *src2, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q63_t res;
     tpt_dot_prod_q31(&res, src1, src2, size);
@@ -1523,7 +1540,7 @@ static inline q63_t hpm_dsp_dprod_q31(q31_t *src1, q31_t *src2, uint32_t size)
  */
 static inline q63_t hpm_dsp_dprod_q15(q15_t *src1, q15_t *src2, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q63_t res;
     tpt_dot_prod_q15(&res, src1, src2, size);
@@ -1547,7 +1564,7 @@ static inline q63_t hpm_dsp_dprod_q15(q15_t *src1, q15_t *src2, uint32_t size)
 
 static inline q31_t hpm_dsp_dprod_u8xq15(uint8_t *src1, q15_t *src2, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_dprod_u8xq15(src1, src2, size);
 #endif
 }
@@ -1565,7 +1582,7 @@ static inline q31_t hpm_dsp_dprod_u8xq15(uint8_t *src1, q15_t *src2, uint32_t si
  */
 static inline q31_t hpm_dsp_dprod_q7(q7_t *src1, q7_t *src2, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     q31_t res;
     tpt_dot_prod_q7(&res, src1, src2, size);
@@ -1588,7 +1605,7 @@ static inline q31_t hpm_dsp_dprod_q7(q7_t *src1, q7_t *src2, uint32_t size)
  */
 static inline q31_t hpm_dsp_dprod_q7xq15(q7_t *src1, q15_t *src2, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_dprod_q7xq15(src1, src2, size);
 #endif
 }
@@ -1605,7 +1622,7 @@ static inline q31_t hpm_dsp_dprod_q7xq15(q7_t *src1, q15_t *src2, uint32_t size)
  */
 static inline uint32_t hpm_dsp_dprod_u8(uint8_t *src1, uint8_t *src2, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_dprod_u8(src1, src2, size);
 #endif
 }
@@ -1620,7 +1637,7 @@ static inline uint32_t hpm_dsp_dprod_u8(uint8_t *src1, uint8_t *src2, uint32_t s
  */
 static inline void hpm_dsp_offset_f32(float32_t *src, float32_t offset, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_offset_f32(dst, src, offset, size);
 #else
@@ -1640,7 +1657,7 @@ static inline void hpm_dsp_offset_f32(float32_t *src, float32_t offset, float32_
  */
 static inline void hpm_dsp_offset_q31(q31_t *src, q31_t offset, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_offset_q31(dst, src, offset, size);
 #else
@@ -1660,7 +1677,7 @@ static inline void hpm_dsp_offset_q31(q31_t *src, q31_t offset, q31_t *dst, uint
  */
 static inline void hpm_dsp_offset_q15(q15_t *src, q15_t offset, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_offset_q15(dst, src, offset, size);
 #else
@@ -1680,7 +1697,7 @@ static inline void hpm_dsp_offset_q15(q15_t *src, q15_t offset, q15_t *dst, uint
  */
 static inline void hpm_dsp_offset_q7(q7_t *src, q7_t offset, q7_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_offset_q7(dst, src, offset, size);
 #else
@@ -1700,7 +1717,7 @@ static inline void hpm_dsp_offset_q7(q7_t *src, q7_t offset, q7_t *dst, uint32_t
  */
 static inline void hpm_dsp_offset_u8(uint8_t *src, q7_t offset, uint8_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_offset_u8(src, offset, dst, size);
 #endif
 }
@@ -1715,7 +1732,7 @@ static inline void hpm_dsp_offset_u8(uint8_t *src, q7_t offset, uint8_t *dst, ui
  */
 static inline void hpm_dsp_scale_f32(float32_t *src, float32_t scale, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_scale_f32(dst, src, scale, size);
 #else
@@ -1738,7 +1755,7 @@ static inline void hpm_dsp_scale_f32(float32_t *src, float32_t scale, float32_t
  */
 static inline void hpm_dsp_scale_q31(q31_t *src, q31_t scalefract, int8_t shift, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_scale_q31(dst, src, scalefract, shift, size);
 #else
@@ -1761,7 +1778,7 @@ static inline void hpm_dsp_scale_q31(q31_t *src, q31_t scalefract, int8_t shift,
  */
 static inline void hpm_dsp_scale_q15(q15_t *src, q15_t scalefract, int8_t shift, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_scale_q15(dst, src, scalefract, shift, size);
 #else
@@ -1784,7 +1801,7 @@ static inline void hpm_dsp_scale_q15(q15_t *src, q15_t scalefract, int8_t shift,
  */
 static inline void hpm_dsp_scale_q7(q7_t *src, q7_t scalefract, int8_t shift, q7_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_scale_q7(dst, src, scalefract, shift, size);
 #else
@@ -1806,7 +1823,7 @@ static inline void hpm_dsp_scale_q7(q7_t *src, q7_t scalefract, int8_t shift, q7
  */
 static inline void hpm_dsp_scale_u8(uint8_t *src, q7_t scalefract, int8_t shift, uint8_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_scale_u8(src, scalefract, shift, dst, size);
 #endif
 }
@@ -1824,7 +1841,7 @@ static inline void hpm_dsp_scale_u8(uint8_t *src, q7_t scalefract, int8_t shift,
  */
 static inline void hpm_dsp_shift_q15(q15_t *src, int8_t shift, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_shift_q15(dst, src, shift, size);
 #else
@@ -1845,7 +1862,7 @@ static inline void hpm_dsp_shift_q15(q15_t *src, int8_t shift, q15_t *dst, uint3
  */
 static inline void hpm_dsp_shift_q31(q31_t *src, int8_t shift, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_shift_q31(dst, src, shift, size);
 #else
@@ -1866,7 +1883,7 @@ static inline void hpm_dsp_shift_q31(q31_t *src, int8_t shift, q31_t *dst, uint3
  */
 static inline void hpm_dsp_shift_q7(q7_t *src, int8_t shift, q7_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_shift_q7(dst, src, shift, size);
 #else
@@ -1887,7 +1904,7 @@ static inline void hpm_dsp_shift_q7(q7_t *src, int8_t shift, q7_t *dst, uint32_t
  */
 static inline void hpm_dsp_shift_u8(uint8_t *src, int8_t shift, uint8_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_shift_u8(src, shift, dst, size);
 #endif
 }
@@ -1907,7 +1924,7 @@ static inline void hpm_dsp_shift_u8(uint8_t *src, int8_t shift, uint8_t *dst, ui
  */
 static inline void hpm_dsp_clip_f32(float32_t *src, float32_t *dst, float32_t low, float32_t high, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_clip_f32(dst, src, low, high, size);
 #else
@@ -1926,7 +1943,7 @@ static inline void hpm_dsp_clip_f32(float32_t *src, float32_t *dst, float32_t lo
  */
 static inline void hpm_dsp_clip_q31(q31_t *src, q31_t *dst, q31_t low, q31_t high, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_clip_q31(dst, src, low, high, size);
 #else
@@ -1945,7 +1962,7 @@ static inline void hpm_dsp_clip_q31(q31_t *src, q31_t *dst, q31_t low, q31_t hig
  */
 static inline void hpm_dsp_clip_q15(q15_t *src, q15_t *dst, q15_t low, q15_t high, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_clip_q15(dst, src, low, high, size);
 #else
@@ -1964,7 +1981,7 @@ static inline void hpm_dsp_clip_q15(q15_t *src, q15_t *dst, q15_t low, q15_t hig
  */
 static inline void hpm_dsp_clip_q7(q7_t *src, q7_t *dst, q7_t low, q7_t high, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_clip_q7(dst, src, low, high, size);
 #else
@@ -1997,7 +2014,7 @@ static inline void hpm_dsp_clip_q7(q7_t *src, q7_t *dst, q7_t low, q7_t high, ui
  */
 static inline void hpm_dsp_and_u32(u32_t *src1, u32_t *src2, u32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_and_32bit(dst, src1, src2, size);
 #else
@@ -2016,7 +2033,7 @@ static inline void hpm_dsp_and_u32(u32_t *src1, u32_t *src2, u32_t *dst, uint32_
  */
 static inline void hpm_dsp_and_u16(u16_t *src1, u16_t *src2, u16_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_and_16bit(dst, src1, src2, size);
 #else
@@ -2035,7 +2052,7 @@ static inline void hpm_dsp_and_u16(u16_t *src1, u16_t *src2, u16_t *dst, uint32_
  */
 static inline void hpm_dsp_and_u8(u8_t *src1, u8_t *src2, u8_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_and_8bit(dst, src1, src2, size);
 #else
@@ -2068,7 +2085,7 @@ static inline void hpm_dsp_and_u8(u8_t *src1, u8_t *src2, u8_t *dst, uint32_t si
  */
 static inline void hpm_dsp_or_u32(u32_t *src1, u32_t *src2, u32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_or_32bit(dst, src1, src2, size);
 #else
@@ -2086,7 +2103,7 @@ static inline void hpm_dsp_or_u32(u32_t *src1, u32_t *src2, u32_t *dst, uint32_t
  */
 static inline void hpm_dsp_or_u16(u16_t *src1, u16_t *src2, u16_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_or_16bit(dst, src1, src2, size);
 #else
@@ -2104,7 +2121,7 @@ static inline void hpm_dsp_or_u16(u16_t *src1, u16_t *src2, u16_t *dst, uint32_t
  */
 static inline void hpm_dsp_or_u8(u8_t *src1, u8_t *src2, u8_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_or_8bit(dst, src1, src2, size);
 #else
@@ -2137,7 +2154,7 @@ static inline void hpm_dsp_or_u8(u8_t *src1, u8_t *src2, u8_t *dst, uint32_t siz
  */
 static inline void hpm_dsp_xor_u32(u32_t *src1, u32_t *src2, u32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_xor_32bit(dst, src1, src2, size);
 #else
@@ -2155,7 +2172,7 @@ static inline void hpm_dsp_xor_u32(u32_t *src1, u32_t *src2, u32_t *dst, uint32_
  */
 static inline void hpm_dsp_xor_u16(u16_t *src1, u16_t *src2, u16_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_xor_16bit(dst, src1, src2, size);
 #else
@@ -2173,7 +2190,7 @@ static inline void hpm_dsp_xor_u16(u16_t *src1, u16_t *src2, u16_t *dst, uint32_
  */
 static inline void hpm_dsp_xor_u8(u8_t *src1, u8_t *src2, u8_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_xor_8bit(dst, src1, src2, size);
 #else
@@ -2205,7 +2222,7 @@ static inline void hpm_dsp_xor_u8(u8_t *src1, u8_t *src2, u8_t *dst, uint32_t si
  */
 static inline void hpm_dsp_not_u32(u32_t *src, u32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_not_32bit(dst, src, size);
 #else
@@ -2222,7 +2239,7 @@ static inline void hpm_dsp_not_u32(u32_t *src, u32_t *dst, uint32_t size)
  */
 static inline void hpm_dsp_not_u16(u16_t *src, u16_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_not_16bit(dst, src, size);
 #else
@@ -2239,7 +2256,7 @@ static inline void hpm_dsp_not_u16(u16_t *src, u16_t *dst, uint32_t size)
  */
 static inline void hpm_dsp_not_u8(u8_t *src, u8_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_not_8bit(dst, src, size);
 #else
@@ -2317,7 +2334,7 @@ uint32_t hpm_math_sw_reverse_bit32_msb_to_lsb(uint32_t msb);
  */
 static inline void hpm_dsp_cconj_f32(const float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_conj_f32(dst, src, size);
 #else
@@ -2337,7 +2354,7 @@ static inline void hpm_dsp_cconj_f32(const float32_t *src, float32_t *dst, uint3
  */
 static inline void hpm_dsp_cconj_q15(const q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_conj_q15(dst, src, size);
 #else
@@ -2357,7 +2374,7 @@ static inline void hpm_dsp_cconj_q15(const q15_t *src, q15_t *dst, uint32_t size
  */
 static inline void hpm_dsp_cconj_q31(const q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_conj_q31(dst, src, size);
 #else
@@ -2376,7 +2393,7 @@ static inline void hpm_dsp_cconj_q31(const q31_t *src, q31_t *dst, uint32_t size
  */
 static inline void hpm_dsp_cdprod_f32(const float32_t *src1, const float32_t *src2, uint32_t size, float32_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_cdprod_f32(src1, src2, size, dst);
 #endif
 }
@@ -2391,7 +2408,7 @@ static inline void hpm_dsp_cdprod_f32(const float32_t *src1, const float32_t *sr
  */
 static inline void hpm_dsp_cdprod_typ2_f32(const float32_t *src1, const float32_t *src2, uint32_t size, float32_t *rout, float32_t *iout)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_dot_prod_f32(rout, iout, src1, src2, size);
 #else
@@ -2412,7 +2429,7 @@ static inline void hpm_dsp_cdprod_typ2_f32(const float32_t *src1, const float32_
  */
 static inline void hpm_dsp_cdprod_q15(const q15_t *src1, const q15_t *src2, uint32_t size, q15_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_cdprod_q15(src1, src2, size, dst);
 #endif
 }
@@ -2430,7 +2447,7 @@ static inline void hpm_dsp_cdprod_q15(const q15_t *src1, const q15_t *src2, uint
  */
 static inline void hpm_dsp_cdprod_typ2_q15(const q15_t *src1, const q15_t *src2, uint32_t size, q31_t *rout, q31_t *iout)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_cdprod_typ2_q15(src1, src2, size, rout, iout);
 #endif
 }
@@ -2447,7 +2464,7 @@ static inline void hpm_dsp_cdprod_typ2_q15(const q15_t *src1, const q15_t *src2,
  */
 static inline void hpm_dsp_cdprod_q31(const q31_t *src1, const q31_t *src2, uint32_t size, q31_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_cdprod_q31(src1, src2, size, dst);
 #endif
 }
@@ -2466,7 +2483,7 @@ static inline void hpm_dsp_cdprod_q31(const q31_t *src1, const q31_t *src2, uint
  */
 static inline void hpm_dsp_cdprod_typ2_q31(const q31_t *src1, const q31_t *src2, uint32_t size, q63_t *rout, q63_t *iout)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_dot_prod_q31(rout, iout, src1, src2, size);
 #else
@@ -2484,7 +2501,7 @@ static inline void hpm_dsp_cdprod_typ2_q31(const q31_t *src1, const q31_t *src2,
  */
 static inline void hpm_dsp_cmag_f32(const float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mag_f32(dst, src, size);
 #else
@@ -2504,7 +2521,7 @@ static inline void hpm_dsp_cmag_f32(const float32_t *src, float32_t *dst, uint32
  */
 static inline void hpm_dsp_cmag_q15(const q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mag_q15(dst, src, size);
 #else
@@ -2524,7 +2541,7 @@ static inline void hpm_dsp_cmag_q15(const q15_t *src, q15_t *dst, uint32_t size)
  */
 static inline void hpm_dsp_cmag_q31(const q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mag_q31(dst, src, size);
 #else
@@ -2543,7 +2560,7 @@ static inline void hpm_dsp_cmag_q31(const q31_t *src, q31_t *dst, uint32_t size)
  */
 static inline void hpm_dsp_cmag_sqr_f32(const float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mag_squared_f32(dst, src, size);
 #else
@@ -2563,7 +2580,7 @@ static inline void hpm_dsp_cmag_sqr_f32(const float32_t *src, float32_t *dst, ui
  */
 static inline void hpm_dsp_cmag_sqr_q15(const q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mag_squared_q15(dst, src, size);
 #else
@@ -2583,7 +2600,7 @@ static inline void hpm_dsp_cmag_sqr_q15(const q15_t *src, q15_t *dst, uint32_t s
  */
 static inline void hpm_dsp_cmag_sqr_q31(const q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mag_squared_q31(dst, src, size);
 #else
@@ -2602,7 +2619,7 @@ static inline void hpm_dsp_cmag_sqr_q31(const q31_t *src, q31_t *dst, uint32_t s
  */
 static inline void hpm_dsp_cmul_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mult_cmplx_f32(dst, src1, src2, size);
 #else
@@ -2623,7 +2640,7 @@ static inline void hpm_dsp_cmul_f32(const float32_t *src1, const float32_t *src2
  */
 static inline void hpm_dsp_cmul_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mult_cmplx_q15(dst, src1, src2, size);
 #else
@@ -2644,7 +2661,7 @@ static inline void hpm_dsp_cmul_q15(const q15_t *src1, const q15_t *src2, q15_t
  */
 static inline void hpm_dsp_cmul_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mult_cmplx_q31(dst, src1, src2, size);
 #else
@@ -2663,7 +2680,7 @@ static inline void hpm_dsp_cmul_q31(const q31_t *src1, const q31_t *src2, q31_t
  */
 static inline void hpm_dsp_cmul_real_f32(const float32_t *src, const float32_t *real, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mult_real_f32(dst, src, real, size);
 #else
@@ -2683,7 +2700,7 @@ static inline void hpm_dsp_cmul_real_f32(const float32_t *src, const float32_t *
  */
 static inline void hpm_dsp_cmul_real_q15(const q15_t *src, const q15_t *real, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mult_real_q15(dst, src, real, size);
 #else
@@ -2703,7 +2720,7 @@ static inline void hpm_dsp_cmul_real_q15(const q15_t *src, const q15_t *real, q1
  */
 static inline void hpm_dsp_cmul_real_q31(const q31_t *src, const q31_t *real, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cmplx_mult_real_q31(dst, src, real, size);
 #else
@@ -3329,7 +3346,7 @@ static inline float32_t hpm_dsp_bdist_russell_rao_u32_f32(const uint32_t *src1,
  */
 static inline void hpm_dsp_fir_f32(const riscv_dsp_fir_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_fir_f32(instance, src, dst, size);
 #endif
 }
@@ -3350,7 +3367,7 @@ static inline void hpm_dsp_fir_f32(const riscv_dsp_fir_f32_t *instance, float32_
  */
 static inline void hpm_dsp_fir_q31(const riscv_dsp_fir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_fir_q31(instance, src, dst, size);
 #endif
 }
@@ -3371,7 +3388,7 @@ static inline void hpm_dsp_fir_q31(const riscv_dsp_fir_q31_t *instance, q31_t *s
  */
 static inline void hpm_dsp_fir_fast_q31(const riscv_dsp_fir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_fir_fast_q31(instance, src, dst, size);
 #endif
 }
@@ -3391,7 +3408,7 @@ static inline void hpm_dsp_fir_fast_q31(const riscv_dsp_fir_q31_t *instance, q31
  */
 static inline void hpm_dsp_fir_q15(const riscv_dsp_fir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_fir_q15(instance, src, dst, size);
 #endif
 }
@@ -3410,7 +3427,7 @@ static inline void hpm_dsp_fir_q15(const riscv_dsp_fir_q15_t *instance, q15_t *s
  */
 static inline void hpm_dsp_fir_fast_q15(const riscv_dsp_fir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_fir_fast_q15(instance, src, dst, size);
 #endif
 }
@@ -3429,7 +3446,7 @@ static inline void hpm_dsp_fir_fast_q15(const riscv_dsp_fir_q15_t *instance, q15
  */
 static inline void hpm_dsp_fir_q7(const riscv_dsp_fir_q7_t *instance, q7_t *src, q7_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_fir_q7(instance, src, dst, size);
 #endif
 }
@@ -3444,7 +3461,7 @@ static inline void hpm_dsp_fir_q7(const riscv_dsp_fir_q7_t *instance, q7_t *src,
  */
 static inline void hpm_dsp_lfir_f32(const riscv_dsp_lfir_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_lfir_f32(instance, src, dst, size);
 #endif
 }
@@ -3459,7 +3476,7 @@ static inline void hpm_dsp_lfir_f32(const riscv_dsp_lfir_f32_t *instance, float3
  */
 static inline void hpm_dsp_lfir_q15(const riscv_dsp_lfir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_lfir_q15(instance, src, dst, size);
 #endif
 }
@@ -3478,79 +3495,79 @@ static inline void hpm_dsp_lfir_q15(const riscv_dsp_lfir_q15_t *instance, q15_t
  */
 static inline void hpm_dsp_lfir_q31(const riscv_dsp_lfir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_lfir_q31(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_dcmfir_f32(const riscv_dsp_dcmfir_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dcmfir_f32(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_dcmfir_q15(const riscv_dsp_dcmfir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dcmfir_q15(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_dcmfir_q31(const riscv_dsp_dcmfir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dcmfir_q31(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_dcmfir_fast_q31(const riscv_dsp_dcmfir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dcmfir_fast_q31(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_dcmfir_fast_q15(const riscv_dsp_dcmfir_q15_t *instance, q15_t *src,  q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dcmfir_fast_q15(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_upsplfir_f32(const riscv_dsp_upsplfir_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_upsplfir_f32(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_upsplfir_q15(const riscv_dsp_upsplfir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_upsplfir_q15(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_upsplfir_q31(const riscv_dsp_upsplfir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_upsplfir_q31(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_spafir_f32(riscv_dsp_spafir_f32_t *instance, float32_t *src, float32_t *dst, float32_t *buf, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_spafir_f32(instance, src, dst, buf, size);
 #endif
 }
 static inline void hpm_dsp_spafir_q15(riscv_dsp_spafir_q15_t *instance, q15_t *src, q15_t *dst, q15_t *buf1, q31_t *buf2, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_spafir_q15(instance, src, dst, buf1, buf2, size);
 #endif
 }
 static inline void hpm_dsp_spafir_q31(riscv_dsp_spafir_q31_t *instance, q31_t *src, q31_t *dst, q31_t *buf, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_spafir_q31(instance, src, dst, buf, size);
 #endif
 }
 static inline void hpm_dsp_spafir_q7(riscv_dsp_spafir_q7_t *instance, q7_t *src, q7_t *dst, q7_t *buf1, q31_t *buf2, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_spafir_q7(instance, src, dst, buf1, buf2, size);
 #endif
 }
@@ -3571,7 +3588,7 @@ static inline void hpm_dsp_spafir_q7(riscv_dsp_spafir_q7_t *instance, q7_t *src,
  */
 static inline void hpm_dsp_lms_f32(const riscv_dsp_lms_f32_t *instance, float32_t *src, float32_t *ref, float32_t *dst, float32_t *err, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_lms_f32(instance, src, ref, dst, err, size);
 #endif
 }
@@ -3594,7 +3611,7 @@ static inline void hpm_dsp_lms_f32(const riscv_dsp_lms_f32_t *instance, float32_
  */
 static inline void hpm_dsp_lms_q31(const riscv_dsp_lms_q31_t *instance, q31_t *src, q31_t *ref, q31_t *dst, q31_t *err, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_lms_q31(instance, src, ref, dst, err, size);
 #endif
 }
@@ -3617,7 +3634,7 @@ static inline void hpm_dsp_lms_q31(const riscv_dsp_lms_q31_t *instance, q31_t *s
  */
 static inline void hpm_dsp_lms_q15(const riscv_dsp_lms_q15_t *instance, q15_t *src, q15_t *ref, q15_t *dst, q15_t *err, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_lms_q15(instance, src, ref, dst, err, size);
 #endif
 }
@@ -3628,7 +3645,7 @@ static inline void hpm_dsp_lms_q15(const riscv_dsp_lms_q15_t *instance, q15_t *s
 
 static inline void hpm_dsp_nlms_f32(riscv_dsp_nlms_f32_t *instance, float32_t *src, float32_t *ref, float32_t *dst, float32_t *err, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_nlms_f32(instance, src, ref, dst, err, size);
 #endif
 }
@@ -3640,7 +3657,7 @@ static inline void hpm_dsp_nlms_f32(riscv_dsp_nlms_f32_t *instance, float32_t *s
 
 static inline void hpm_dsp_nlms_q31(riscv_dsp_nlms_q31_t *instance, q31_t *src, q31_t *ref, q31_t *dst, q31_t *err, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_nlms_q31(instance, src, ref, dst, err, size);
 #endif
 }
@@ -3648,7 +3665,7 @@ static inline void hpm_dsp_nlms_q31(riscv_dsp_nlms_q31_t *instance, q31_t *src,
 
 static inline void hpm_dsp_nlms_q15(riscv_dsp_nlms_q15_t *instance, q15_t *src, q15_t *ref, q15_t *dst, q15_t *err, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_nlms_q15(instance, src, ref, dst, err, size);
 #endif
 }
@@ -3666,7 +3683,7 @@ static inline void hpm_dsp_nlms_q15(riscv_dsp_nlms_q15_t *instance, q15_t *src,
  */
 static inline void hpm_dsp_conv_f32(float32_t *src1, uint32_t len1, float32_t *src2, uint32_t len2, float32_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_conv_f32(dst, src1, len1, src2, len2);
 #else
@@ -3692,7 +3709,7 @@ static inline void hpm_dsp_conv_f32(float32_t *src1, uint32_t len1, float32_t *s
  */
 static inline void hpm_dsp_conv_q15(q15_t *src1, uint32_t len1, q15_t *src2, uint32_t len2, q15_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_conv_q15(dst, src1, len1, src2, len2);
 #else
@@ -3720,7 +3737,7 @@ static inline void hpm_dsp_conv_q15(q15_t *src1, uint32_t len1, q15_t *src2, uin
  */
 static inline void hpm_dsp_conv_q31(q31_t *src1, uint32_t len1, q31_t *src2, uint32_t len2, q31_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_conv_q31(dst, src1, len1, src2, len2);
 #else
@@ -3746,7 +3763,7 @@ static inline void hpm_dsp_conv_q31(q31_t *src1, uint32_t len1, q31_t *src2, uin
  */
 static inline void hpm_dsp_conv_q7(q7_t *src1, uint32_t len1, q7_t *src2, uint32_t len2, q7_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_conv_q7(dst, src1, len1, src2, len2);
 #else
@@ -3771,7 +3788,7 @@ static inline void hpm_dsp_conv_q7(q7_t *src1, uint32_t len1, q7_t *src2, uint32
  */
 static inline int32_t hpm_dsp_conv_partial_f32(float32_t *src1, uint32_t len1, float32_t *src2, uint32_t len2, float32_t *dst, uint32_t startindex, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_conv_partial_f32(dst, src1, len1, src2, len2, startindex, size);
 #else
@@ -3797,7 +3814,7 @@ static inline int32_t hpm_dsp_conv_partial_f32(float32_t *src1, uint32_t len1, f
  */
 static inline int32_t hpm_dsp_conv_partial_q15(q15_t *src1, uint32_t len1, q15_t *src2, uint32_t len2, q15_t *dst, uint32_t startindex, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_conv_partial_q15(dst, src1, len1, src2, len2, startindex, size);
 #else
@@ -3823,7 +3840,7 @@ static inline int32_t hpm_dsp_conv_partial_q15(q15_t *src1, uint32_t len1, q15_t
  */
 static inline int32_t hpm_dsp_conv_partial_q31(q31_t *src1, uint32_t len1, q31_t *src2, uint32_t len2, q31_t *dst, uint32_t startindex, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_conv_partial_q31(dst, src1, len1, src2, len2, startindex, size);
 #else
@@ -3849,7 +3866,7 @@ static inline int32_t hpm_dsp_conv_partial_q31(q31_t *src1, uint32_t len1, q31_t
  */
 static inline int32_t hpm_dsp_conv_partial_q7(q7_t *src1, uint32_t len1, q7_t *src2, uint32_t len2, q7_t *dst, uint32_t startindex, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_conv_partial_q7(dst, src1, len1, src2, len2, startindex, size);
 #else
@@ -3872,7 +3889,7 @@ static inline int32_t hpm_dsp_conv_partial_q7(q7_t *src1, uint32_t len1, q7_t *s
  */
 static inline void hpm_dsp_corr_f32(float32_t *src1, uint32_t len1, float32_t *src2, uint32_t len2, float32_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_correlate_f32(dst, src1, len1, src2, len2);
 #else
@@ -3898,7 +3915,7 @@ static inline void hpm_dsp_corr_f32(float32_t *src1, uint32_t len1, float32_t *s
  */
 static inline void hpm_dsp_corr_q15(q15_t *src1, uint32_t len1, q15_t *src2, uint32_t len2, q15_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_correlate_q15(dst, src1, len1, src2, len2);
 #else
@@ -3928,7 +3945,7 @@ static inline void hpm_dsp_corr_q15(q15_t *src1, uint32_t len1, q15_t *src2, uin
  */
 static inline void hpm_dsp_corr_q31(q31_t *src1, uint32_t len1, q31_t *src2, uint32_t len2, q31_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_correlate_q31(dst, src1, len1, src2, len2);
 #else
@@ -3954,7 +3971,7 @@ static inline void hpm_dsp_corr_q31(q31_t *src1, uint32_t len1, q31_t *src2, uin
  */
 static inline void hpm_dsp_corr_q7(q7_t *src1, uint32_t len1, q7_t *src2, uint32_t len2, q7_t *dst)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_correlate_q7(dst, src1, len1, src2, len2);
 #else
@@ -3964,86 +3981,86 @@ static inline void hpm_dsp_corr_q7(q7_t *src1, uint32_t len1, q7_t *src2, uint32
 }
 static inline void hpm_dsp_bq_df1_f32(const riscv_dsp_bq_df1_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_bq_df1_f32(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_bq_df1_q15(const riscv_dsp_bq_df1_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_bq_df1_q15(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_bq_df1_fast_q15(const riscv_dsp_bq_df1_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_bq_df1_fast_q15(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_bq_df1_q31(const riscv_dsp_bq_df1_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_bq_df1_q31(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_bq_df1_fast_q31(const riscv_dsp_bq_df1_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_bq_df1_fast_q31(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_bq_df1_32x64_q31(const riscv_dsp_bq_df1_32x64_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_bq_df1_32x64_q31(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_bq_df2T_f32(const riscv_dsp_bq_df2T_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_bq_df2T_f32(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_bq_df2T_f64(const riscv_dsp_bq_df2T_f64_t *instance, float64_t *src, float64_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_bq_df2T_f64(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_bq_stereo_df2T_f32(const riscv_dsp_bq_stereo_df2T_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_bq_stereo_df2T_f32(instance, src, dst, size);
 #endif
 }
 
 static inline void hpm_dsp_liir_f32(const riscv_dsp_liir_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_liir_f32(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_liir_q31(const riscv_dsp_liir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_liir_q31(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_liir_fast_q31(const riscv_dsp_liir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_liir_fast_q31(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_liir_q15(const riscv_dsp_liir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_liir_q15(instance, src, dst, size);
 #endif
 }
 static inline void hpm_dsp_liir_fast_q15(const riscv_dsp_liir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_liir_fast_q15(instance, src, dst, size);
 #endif
 }
@@ -4097,7 +4114,7 @@ static inline void hpm_dsp_liir_fast_q15(const riscv_dsp_liir_q15_t *instance, q
  */
 static inline void hpm_dsp_mat_add_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_add_f32(dst, src1, src2, row, col);
 #else
@@ -4116,7 +4133,7 @@ static inline void hpm_dsp_mat_add_f32(const float32_t *src1, const float32_t *s
  */
  static inline void hpm_dsp_mat_add_f64(const float64_t *src1, const float64_t *src2, float64_t *dst, uint32_t row, uint32_t col)
  {
- #if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
  #ifdef __zcc__
      tpt_mat_add_f64(dst, src1, src2, row, col);
  #else
@@ -4137,7 +4154,7 @@ static inline void hpm_dsp_mat_add_f32(const float32_t *src1, const float32_t *s
  */
 static inline void hpm_dsp_mat_add_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_add_q15(dst, src1, src2, row, col);
 #else
@@ -4158,7 +4175,7 @@ static inline void hpm_dsp_mat_add_q15(const q15_t *src1, const q15_t *src2, q15
  */
 static inline void hpm_dsp_mat_add_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_add_q31(dst, src1, src2, row, col);
 #else
@@ -4177,7 +4194,7 @@ static inline void hpm_dsp_mat_add_q31(const q31_t *src1, const q31_t *src2, q31
  */
 static inline int32_t hpm_dsp_mat_inv_f32(float32_t *src, float32_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_inverse_f32(dst, src, size);
 #else
@@ -4187,7 +4204,7 @@ static inline int32_t hpm_dsp_mat_inv_f32(float32_t *src, float32_t *dst, uint32
 }
 static inline int32_t hpm_dsp_mat_inv_f64(float64_t *src, float64_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_inverse_f64(dst, src, size);
 #else
@@ -4208,7 +4225,7 @@ static inline int32_t hpm_dsp_mat_inv_f64(float64_t *src, float64_t *dst, uint32
  */
 static inline void hpm_dsp_mat_mul_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t row, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_mult_f32(dst, src1, src2, row, col, col2);
 #else
@@ -4219,7 +4236,7 @@ static inline void hpm_dsp_mat_mul_f32(const float32_t *src1, const float32_t *s
 
 static inline void hpm_dsp_mat_mul_f64(const float64_t *src1, const float64_t *src2, float64_t *dst, uint32_t row, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_mult_f64(dst, src1, src2, row, col, col2);
 #else
@@ -4239,7 +4256,7 @@ static inline void hpm_dsp_mat_mul_f64(const float64_t *src1, const float64_t *s
  */
 static inline void hpm_dsp_cmat_mul_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t row, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_cmplx_mult_f32(dst, src1, src2, row, col, col2);
 #else
@@ -4266,7 +4283,7 @@ static inline void hpm_dsp_cmat_mul_f32(const float32_t *src1, const float32_t *
  */
 static inline void hpm_dsp_mat_mul_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_mult_q15(dst, src1, src2, row, col, col2);
 #else
@@ -4276,7 +4293,7 @@ static inline void hpm_dsp_mat_mul_q15(const q15_t *src1, const q15_t *src2, q15
 }
 static inline void hpm_dsp_mat_mul_fast_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_mult_q15(dst, src1, src2, row, col, col2);
 #else
@@ -4303,7 +4320,7 @@ static inline void hpm_dsp_mat_mul_fast_q15(const q15_t *src1, const q15_t *src2
  */
 static inline void hpm_dsp_cmat_mul_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_cmplx_mult_q15(dst, src1, src2, row, col, col2);
 #else
@@ -4330,7 +4347,7 @@ static inline void hpm_dsp_cmat_mul_q15(const q15_t *src1, const q15_t *src2, q1
  */
 static inline void hpm_dsp_mat_mul_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_mult_q31(dst, src1, src2, row, col, col2);
 #else
@@ -4340,7 +4357,7 @@ static inline void hpm_dsp_mat_mul_q31(const q31_t *src1, const q31_t *src2, q31
 }
 static inline void hpm_dsp_mat_mul_fast_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_mult_q31(dst, src1, src2, row, col, col2);
 #else
@@ -4367,7 +4384,7 @@ static inline void hpm_dsp_mat_mul_fast_q31(const q31_t *src1, const q31_t *src2
  */
 static inline void hpm_dsp_cmat_mul_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_mat_cmplx_mult_q31(dst, src1, src2, row, col, col2);
 #else
@@ -4394,7 +4411,7 @@ static inline void hpm_dsp_cmat_mul_q31(const q31_t *src1, const q31_t *src2, q3
  */
 static inline void hpm_dsp_mat_mul_q7(const q7_t *src1, const q7_t *src2, q7_t *dst, uint32_t row, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_mat_mul_q7(src1, src2, dst, row, col, col2);
 #endif
 }
@@ -4416,7 +4433,7 @@ static inline void hpm_dsp_mat_mul_q7(const q7_t *src1, const q7_t *src2, q7_t *
  */
 static inline void hpm_dsp_mat_mul_vxm_q7(const q7_t * src1, const q7_t * src2, q7_t * dst, uint32_t col, uint32_t col2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_mul_mxv_q7(dst, src1, src2, col, col2);
 #else
@@ -4430,7 +4447,7 @@ static inline void hpm_dsp_mat_mul_vxm_q7(const q7_t * src1, const q7_t * src2,
 // The input is a square matrix for riscv_dsp_mat_pow2_cache_f64.
 static inline int32_t hpm_dsp_mat_pwr2_cache_f64(const float64_t *src, float64_t *dst, uint32_t size)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_mat_pwr2_cache_f64(src, dst, size);
 #endif
 }
@@ -4446,7 +4463,7 @@ static inline int32_t hpm_dsp_mat_pwr2_cache_f64(const float64_t *src, float64_t
  */
 static inline void hpm_dsp_mat_scale_f32(const float32_t *src, float32_t scale, float32_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_scale_f32(dst, src, row, col, scale);
 #else
@@ -4471,7 +4488,7 @@ static inline void hpm_dsp_mat_scale_f32(const float32_t *src, float32_t scale,
  */
 static inline void hpm_dsp_mat_scale_q15(const q15_t *src, q15_t scale_fract, int32_t shift, q15_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_scale_q15(dst, src, row, col, scale_fract, shift);
 #else
@@ -4496,7 +4513,7 @@ static inline void hpm_dsp_mat_scale_q15(const q15_t *src, q15_t scale_fract, in
  */
 static inline void hpm_dsp_mat_scale_q31(const q31_t *src, q31_t scale_fract, int32_t shift, q31_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_scale_q31(dst, src, row, col, scale_fract, shift);
 #else
@@ -4519,7 +4536,7 @@ static inline void hpm_dsp_mat_scale_q31(const q31_t *src, q31_t scale_fract, in
 static inline void hpm_dsp_mat_sub_f64(const float64_t *src1, const float64_t *src2,
                        float64_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_sub_f64(dst, src1, src2, row, col);
 #else
@@ -4538,7 +4555,7 @@ static inline void hpm_dsp_mat_sub_f64(const float64_t *src1, const float64_t *s
  */
 static inline void hpm_dsp_mat_sub_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_sub_f32(dst, src1, src2, row, col);
 #else
@@ -4559,7 +4576,7 @@ static inline void hpm_dsp_mat_sub_f32(const float32_t *src1, const float32_t *s
  */
 static inline void hpm_dsp_mat_sub_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_sub_q15(dst, src1, src2, row, col);
 #else
@@ -4580,7 +4597,7 @@ static inline void hpm_dsp_mat_sub_q15(const q15_t *src1, const q15_t *src2, q15
  */
 static inline void hpm_dsp_mat_sub_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_sub_q31(dst, src1, src2, row, col);
 #else
@@ -4601,7 +4618,7 @@ static inline void hpm_dsp_mat_sub_q31(const q31_t *src1, const q31_t *src2, q31
  */
 static inline void hpm_dsp_mat_trans_f64(const float64_t *src, float64_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_trans_f64(dst, src, row, col);
 #else
@@ -4619,7 +4636,7 @@ static inline void hpm_dsp_mat_trans_f64(const float64_t *src, float64_t *dst, u
  */
 static inline void hpm_dsp_mat_trans_f32(const float32_t *src, float32_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_mat_trans_f32(src, dst, row, col);
 #endif
 }
@@ -4633,7 +4650,7 @@ static inline void hpm_dsp_mat_trans_f32(const float32_t *src, float32_t *dst, u
  */
 static inline void hpm_dsp_mat_trans_q15(const q15_t *src, q15_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_trans_q15(dst, src, row, col);
 #else
@@ -4651,7 +4668,7 @@ static inline void hpm_dsp_mat_trans_q15(const q15_t *src, q15_t *dst, uint32_t
  */
 static inline void hpm_dsp_mat_trans_q31(const q31_t *src, q31_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_trans_q31(dst, src, row, col);
 #else
@@ -4669,7 +4686,7 @@ static inline void hpm_dsp_mat_trans_q31(const q31_t *src, q31_t *dst, uint32_t
  */
 static inline void hpm_dsp_mat_trans_u8(const uint8_t *src, uint8_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_mat_trans_u8(src, dst, row, col);
 #endif
 }
@@ -4684,7 +4701,7 @@ static inline void hpm_dsp_mat_trans_u8(const uint8_t *src, uint8_t *dst, uint32
  */
 static inline void hpm_dsp_mat_trans_q7(const q7_t *src, q7_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_mat_trans_q7(src, dst, row, col);
 #endif
 }
@@ -4723,7 +4740,7 @@ static inline void hpm_dsp_mat_trans_q7(const q7_t *src, q7_t *dst, uint32_t row
 static inline void hpm_dsp_mat_oprod_q31(const q31_t * src1, const q31_t * src2,
                        q31_t * dst, uint32_t size1, uint32_t size2)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_oprod_q31(dst, src1, src2, size1, size2);
 #else
@@ -4757,7 +4774,7 @@ static inline void hpm_dsp_mat_oprod_q31(const q31_t * src1, const q31_t * src2,
 static inline void hpm_dsp_mat_mul_mxv_f32(const float32_t *src1, const float32_t *src2,
                        float32_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_mul_mxv_f32(dst, src1, src2, row, col);
 #else
@@ -4777,7 +4794,7 @@ static inline void hpm_dsp_mat_mul_mxv_f32(const float32_t *src1, const float32_
 static inline void hpm_dsp_mat_mul_mxv_q15(const q15_t *src1, const q15_t *src2,
                        q15_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_mul_mxv_q15(dst, src1, src2, row, col);
 #else
@@ -4797,7 +4814,7 @@ static inline void hpm_dsp_mat_mul_mxv_q15(const q15_t *src1, const q15_t *src2,
 static inline void hpm_dsp_mat_mul_mxv_q31(const q31_t *src1, const q31_t *src2,
                        q31_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_mul_mxv_q31(dst, src1, src2, row, col);
 #else
@@ -4817,7 +4834,7 @@ static inline void hpm_dsp_mat_mul_mxv_q31(const q31_t *src1, const q31_t *src2,
 static inline void hpm_dsp_mat_mul_mxv_q7(const q7_t *src1, const q7_t *src2,
                        q7_t *dst, uint32_t row, uint32_t col)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_mat_mul_mxv_q7(dst, src1, src2, row, col);
 #else
@@ -4954,7 +4971,7 @@ static inline void hpm_dsp_svm_poly_est_f32(const riscv_dsp_svm_poly_f32_t *inst
  */
 static inline int32_t hpm_dsp_cfft_rd2_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_f32(src, m, false);
 #else
@@ -4972,7 +4989,7 @@ static inline int32_t hpm_dsp_cfft_rd2_f32(float32_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cifft_rd2_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_f32(src, m, true);
 #else
@@ -4997,7 +5014,7 @@ static inline int32_t hpm_dsp_cifft_rd2_f32(float32_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cfft_rd2_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_q15(src, m, false);
 #else
@@ -5021,7 +5038,7 @@ static inline int32_t hpm_dsp_cfft_rd2_q15(q15_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cifft_rd2_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_q15(src, m, true);
 #else
@@ -5045,7 +5062,7 @@ static inline int32_t hpm_dsp_cifft_rd2_q15(q15_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cfft_rd2_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_q31(src, m, false);
 #else
@@ -5070,7 +5087,7 @@ static inline int32_t hpm_dsp_cfft_rd2_q31(q31_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cifft_rd2_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_q31(src, m, true);
 #else
@@ -5111,7 +5128,7 @@ static inline int32_t hpm_dsp_cifft_rd2_q31(q31_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cfft_rd4_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_f32(src, m, false);
 #else
@@ -5130,7 +5147,7 @@ static inline int32_t hpm_dsp_cfft_rd4_f32(float32_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cifft_rd4_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_f32(src, m, true);
 #else
@@ -5154,7 +5171,7 @@ static inline int32_t hpm_dsp_cifft_rd4_f32(float32_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cfft_rd4_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_q15(src, m, false);
 #else
@@ -5178,7 +5195,7 @@ static inline int32_t hpm_dsp_cfft_rd4_q15(q15_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cifft_rd4_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_q15(src, m, true);
 #else
@@ -5202,7 +5219,7 @@ static inline int32_t hpm_dsp_cifft_rd4_q15(q15_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cfft_rd4_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_q31(src, m, false);
 #else
@@ -5226,7 +5243,7 @@ static inline int32_t hpm_dsp_cfft_rd4_q31(q31_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_cifft_rd4_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_cfft_q31(src, m, true);
 #else
@@ -5257,7 +5274,7 @@ static inline int32_t hpm_dsp_cifft_rd4_q31(q31_t *src, uint32_t m)
  */
 static inline void hpm_dsp_cfft_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cfft_f32(src, m, false);
 #else
@@ -5274,7 +5291,7 @@ static inline void hpm_dsp_cfft_f32(float32_t *src, uint32_t m)
  */
 static inline void hpm_dsp_cfft_f64(float64_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cfft_f64(src, m, false);
 #else
@@ -5291,7 +5308,7 @@ static inline void hpm_dsp_cfft_f64(float64_t *src, uint32_t m)
  */
 static inline void hpm_dsp_cifft_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cfft_f32(src, m, true);
 #else
@@ -5308,7 +5325,7 @@ static inline void hpm_dsp_cifft_f32(float32_t *src, uint32_t m)
  */
 static inline void hpm_dsp_cifft_f64(float64_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cfft_f64(src, m, true);
 #else
@@ -5332,7 +5349,7 @@ static inline void hpm_dsp_cifft_f64(float64_t *src, uint32_t m)
  */
 static inline void hpm_dsp_cfft_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cfft_q15(src, m, false);
 #else
@@ -5355,7 +5372,7 @@ static inline void hpm_dsp_cfft_q15(q15_t *src, uint32_t m)
  */
 static inline void hpm_dsp_cifft_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cfft_q15(src, m, true);
 #else
@@ -5378,7 +5395,7 @@ static inline void hpm_dsp_cifft_q15(q15_t *src, uint32_t m)
  */
 static inline void hpm_dsp_cfft_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cfft_q31(src, m, false);
 #else
@@ -5401,7 +5418,7 @@ static inline void hpm_dsp_cfft_q31(q31_t *src, uint32_t m)
  */
 static inline void hpm_dsp_cifft_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     tpt_cfft_q31(src, m, true);
 #else
@@ -5441,7 +5458,7 @@ static inline void hpm_dsp_cifft_q31(q31_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_rfft_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
 #ifdef __zcc__
     return tpt_rfft_f32(src, src, m, false);
 #else
@@ -5459,7 +5476,7 @@ static inline int32_t hpm_dsp_rfft_f32(float32_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_rfft_f64(float64_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_rfft_f64(src, m);
 #endif
 }
@@ -5473,7 +5490,7 @@ static inline int32_t hpm_dsp_rfft_f64(float64_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_rifft_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_rifft_f32(src, m);
 #endif
 }
@@ -5487,7 +5504,7 @@ static inline int32_t hpm_dsp_rifft_f32(float32_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_rifft_f64(float64_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_rifft_f64(src, m);
 #endif
 }
@@ -5507,7 +5524,7 @@ static inline int32_t hpm_dsp_rifft_f64(float64_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_rfft_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_rfft_q15(src, m);
 #endif
 }
@@ -5527,7 +5544,7 @@ static inline int32_t hpm_dsp_rfft_q15(q15_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_rifft_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_rifft_q15(src, m);
 #endif
 }
@@ -5547,7 +5564,7 @@ static inline int32_t hpm_dsp_rifft_q15(q15_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_rfft_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_rfft_q31(src, m);
 #endif
 }
@@ -5567,7 +5584,7 @@ static inline int32_t hpm_dsp_rfft_q31(q31_t *src, uint32_t m)
  */
 static inline int32_t hpm_dsp_rifft_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     return riscv_dsp_rifft_q31(src, m);
 #endif
 }
@@ -5592,7 +5609,7 @@ static inline int32_t hpm_dsp_rifft_q31(q31_t *src, uint32_t m)
  */
 static inline void hpm_dsp_dct_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dct_f32(src, m);
 #endif
 }
@@ -5605,7 +5622,7 @@ static inline void hpm_dsp_dct_f32(float32_t *src, uint32_t m)
  */
 static inline void hpm_dsp_idct_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_idct_f32(src, m);
 #endif
 }
@@ -5624,7 +5641,7 @@ static inline void hpm_dsp_idct_f32(float32_t *src, uint32_t m)
  */
 static inline void hpm_dsp_dct_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dct_q15(src, m);
 #endif
 }
@@ -5643,7 +5660,7 @@ static inline void hpm_dsp_dct_q15(q15_t *src, uint32_t m)
  */
 static inline void hpm_dsp_idct_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_idct_q15(src, m);
 #endif
 }
@@ -5662,7 +5679,7 @@ static inline void hpm_dsp_idct_q15(q15_t *src, uint32_t m)
  */
 static inline void hpm_dsp_dct_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dct_q31(src, m);
 #endif
 }
@@ -5681,7 +5698,7 @@ static inline void hpm_dsp_dct_q31(q31_t *src, uint32_t m)
  */
 static inline void hpm_dsp_idct_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_idct_q31(src, m);
 #endif
 }
@@ -5706,7 +5723,7 @@ static inline void hpm_dsp_idct_q31(q31_t *src, uint32_t m)
  */
 static inline void hpm_dsp_dct4_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dct4_f32(src, m);
 #endif
 }
@@ -5719,7 +5736,7 @@ static inline void hpm_dsp_dct4_f32(float32_t *src, uint32_t m)
  */
 static inline void hpm_dsp_idct4_f32(float32_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_idct4_f32(src, m);
 #endif
 }
@@ -5738,7 +5755,7 @@ static inline void hpm_dsp_idct4_f32(float32_t *src, uint32_t m)
  */
 static inline void hpm_dsp_dct4_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dct4_q15(src, m);
 #endif
 }
@@ -5757,7 +5774,7 @@ static inline void hpm_dsp_dct4_q15(q15_t *src, uint32_t m)
  */
 static inline void hpm_dsp_idct4_q15(q15_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_idct4_q15(src, m);
 #endif
 }
@@ -5776,7 +5793,7 @@ static inline void hpm_dsp_idct4_q15(q15_t *src, uint32_t m)
  */
 static inline void hpm_dsp_dct4_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_dct4_q31(src, m);
 #endif
 }
@@ -5795,7 +5812,7 @@ static inline void hpm_dsp_dct4_q31(q31_t *src, uint32_t m)
  */
 static inline void hpm_dsp_idct4_q31(q31_t *src, uint32_t m)
 {
-#if HPM_DSP_CORE == HPM_DSP_HW_NDS32
+#if (HPM_DSP_CORE == HPM_DSP_HW_NDS32) || (HPM_DSP_CORE == HPM_DSP_SW)
     riscv_dsp_idct4_q31(src, m);
 #endif
 }
@@ -5810,6 +5827,9 @@ static inline void hpm_dsp_idct4_q31(q31_t *src, uint32_t m)
  *
  * @param src requires double the space than other interfaces, 0-n for input data, n-2n for buffers, 0-n for output data
  * @param m 2^n sampling points, including real and imaginary parts
+ *
+ * @note hpm_software_cfft_plan_float is faster, computes the twiddle factors once and
+ *  needs no scratch space in src.
  */
 void hpm_software_cfft_float(float *src, uint32_t m);
 
@@ -6932,6 +6952,7 @@ static inline void hpm_nn_activate_s16(q15_t *in_out,
 static inline void hpm_nn_leaky_relu_s8(q7_t *in_out,
                         uint32_t size,
                         q15_t slope)
+{
 #if defined(__zcc__)
     tpt_nn_leaky_relu_q7(in_out, in_out, size, slope);
 #else
@@ -12736,7 +12757,7 @@ static inline int32_t hpm_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any(const q7_t
 static inline int32_t
 hpm_nn_conv_1x1_HWC_s8_s8_s8_asym_bias_fast_any_get_buffer_size(
     const uint16_t in_tensor_ch) {
-#if defined(__zcc__)convol
+#if defined(__zcc__)
     return tpt_convolve_1x1_s8_s8_s8_asym_bias_any_get_buf_size(
       in_tensor_ch);
 #else
@@ -14109,6 +14130,7 @@ static inline int32_t hpm_nn_fc_s8_s8_s8_sft_bias(const q7_t *in_vec,
                                     const q7_t *bias,
                                     q7_t *out_vec,
                                     q15_t *in_tmp_buf)
+{
 #if defined(__zcc__)
     return tpt_nn_fc_s8_s8_s8_sft_bias(in_vec, wt_mat, size, wt_row_num,
                                      bias_lshift, out_rshift, bias, out_vec,
@@ -16226,6 +16248,101 @@ static inline void hpm_nn_reshape_s8(const int8_t *in_tensor,
 
 #endif
 
+/**
+ * @brief Planned software fft, it does not depend on any hardware
+ *
+ * The twiddle factors and the bit reversal table are computed once by the plan init function
+ * into buffers of the caller, the transforms then only read them. The complex transform runs
+ * radix-4 stages, plus one radix-2 stage for an odd m, in place and in the layout of
+ * hpm_dsp_cfft_rd2_f32. The forward transforms are not normalized, the inverse transforms
+ * divide by the number of samples.
+ *
+ * The real transform of N samples runs a complex transform of N / 2 points. Its spectrum is
+ * packed in N floats as the one of hpm_dsp_rfft_f32: [X[0], X[N/2], re X[1], im X[1], ...,
+ * re X[N/2 - 1], im X[N/2 - 1]].
+ *
+ * @b Example
+ *     <pre>
+ *      \#define FFT_LOGN 10
+ *      float twiddle[HPM_SOFTWARE_FFT_TWIDDLE_SIZE(FFT_LOGN)];
+ *      uint16_t bitrev[HPM_SOFTWARE_CFFT_BITREV_SIZE(FFT_LOGN)];
+ *      float src[2 * (1 << FFT_LOGN)];
+ *      hpm_software_fft_plan_t plan;
+ *      hpm_software_cfft_plan_init(&plan, FFT_LOGN, twiddle, bitrev);
+ *      hpm_software_cfft_plan_float(&plan, src);
+ *     </pre>
+ */
+#define HPM_SOFTWARE_CFFT_MIN_LOG2 (2U)
+#define HPM_SOFTWARE_RFFT_MIN_LOG2 (3U)
+#define HPM_SOFTWARE_FFT_MAX_LOG2  (16U)
+
+/** @brief number of floats of the twiddle table of a plan of 2^m points */
+#define HPM_SOFTWARE_FFT_TWIDDLE_SIZE(m) (3UL << ((m) - 1))
+/** @brief number of entries of the bit reversal table of a complex plan of 2^m points */
+#define HPM_SOFTWARE_CFFT_BITREV_SIZE(m) (1UL << (m))
+/** @brief number of entries of the bit reversal table of a real plan of 2^m points */
+#define HPM_SOFTWARE_RFFT_BITREV_SIZE(m) (1UL << ((m) - 1))
+
+typedef struct {
+    uint32_t m;             /**< base 2 logarithm of the number of samples */
+    const float *twiddle;   /**< e^(-j2pik/2^m), real and imaginary parts */
+    const uint16_t *bitrev; /**< bit reversal permutation */
+} hpm_software_fft_plan_t;
+
+/**
+ * @brief Initialize a plan of the complex transforms
+ *
+ * @param[out] plan plan
+ * @param[in] m base 2 logarithm of the number of complex samples, from 2 to 16
+ * @param[in] twiddle HPM_SOFTWARE_FFT_TWIDDLE_SIZE(m) floats, kept by the plan
+ * @param[in] bitrev HPM_SOFTWARE_CFFT_BITREV_SIZE(m) entries, kept by the plan
+ * @return 0 success; -1 failure
+ */
+int32_t hpm_software_cfft_plan_init(hpm_software_fft_plan_t *plan, uint32_t m, float *twiddle, uint16_t *bitrev);
+
+/**
+ * @brief Initialize a plan of the real transforms
+ *
+ * @param[out] plan plan
+ * @param[in] m base 2 logarithm of the number of real samples, from 3 to 16
+ * @param[in] twiddle HPM_SOFTWARE_FFT_TWIDDLE_SIZE(m) floats, kept by the plan
+ * @param[in] bitrev HPM_SOFTWARE_RFFT_BITREV_SIZE(m) entries, kept by the plan
+ * @return 0 success; -1 failure
+ */
+int32_t hpm_software_rfft_plan_init(hpm_software_fft_plan_t *plan, uint32_t m, float *twiddle, uint16_t *bitrev);
+
+/**
+ * @brief Complex fft with a plan of hpm_software_cfft_plan_init
+ *
+ * @param[in] plan plan
+ * @param[in,out] src 2^m complex samples [real, imaginary, ...], replaced by the spectrum
+ */
+void hpm_software_cfft_plan_float(const hpm_software_fft_plan_t *plan, float *src);
+
+/**
+ * @brief Complex ifft with a plan of hpm_software_cfft_plan_init
+ *
+ * @param[in] plan plan
+ * @param[in,out] src 2^m complex spectrum values, replaced by the samples
+ */
+void hpm_software_cifft_plan_float(const hpm_software_fft_plan_t *plan, float *src);
+
+/**
+ * @brief Real fft with a plan of hpm_software_rfft_plan_init
+ *
+ * @param[in] plan plan
+ * @param[in,out] src 2^m real samples, replaced by the packed spectrum
+ */
+void hpm_software_rfft_plan_float(const hpm_software_fft_plan_t *plan, float *src);
+
+/**
+ * @brief Real ifft with a plan of hpm_software_rfft_plan_init
+ *
+ * @param[in] plan plan
+ * @param[in,out] src packed spectrum of 2^m real samples, replaced by the samples
+ */
+void hpm_software_rifft_plan_float(const hpm_software_fft_plan_t *plan, float *src);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -0,0 +1,512 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "hpm_dsp_sw_common.h"
+#include "riscv_dsp_basic_math.h"
+
+/* Absolute value */
+void riscv_dsp_abs_f32(float32_t *src, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = fabsf(src[i]);
+    }
+}
+
+void riscv_dsp_abs_q31(q31_t *src, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q63_t v = src[i];
+        dst[i] = hpm_dsp_sw_sat_q31((v < 0) ? -v : v);
+    }
+}
+
+void riscv_dsp_abs_q15(q15_t *src, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q31_t v = src[i];
+        dst[i] = hpm_dsp_sw_sat_q15((v < 0) ? -v : v);
+    }
+}
+
+void riscv_dsp_abs_q7(q7_t *src, q7_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q31_t v = src[i];
+        dst[i] = hpm_dsp_sw_sat_q7((v < 0) ? -v : v);
+    }
+}
+
+/* Addition */
+void riscv_dsp_add_f32(float32_t *src1, float32_t *src2, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] + src2[i];
+    }
+}
+
+void riscv_dsp_add_q31(q31_t *src1, q31_t *src2, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31((q63_t)src1[i] + src2[i]);
+    }
+}
+
+void riscv_dsp_add_q15(q15_t *src1, q15_t *src2, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q15((q31_t)src1[i] + src2[i]);
+    }
+}
+
+void riscv_dsp_add_q7(q7_t *src1, q7_t *src2, q7_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q7((q31_t)src1[i] + src2[i]);
+    }
+}
+
+void riscv_dsp_add_u8_u16(uint8_t *src1, uint8_t *src2, uint16_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = (uint16_t)src1[i] + src2[i];
+    }
+}
+
+/* Subtraction */
+void riscv_dsp_sub_f32(float32_t *src1, float32_t *src2, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] - src2[i];
+    }
+}
+
+void riscv_dsp_sub_q31(q31_t *src1, q31_t *src2, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31((q63_t)src1[i] - src2[i]);
+    }
+}
+
+void riscv_dsp_sub_q15(q15_t *src1, q15_t *src2, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q15((q31_t)src1[i] - src2[i]);
+    }
+}
+
+void riscv_dsp_sub_q7(q7_t *src1, q7_t *src2, q7_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q7((q31_t)src1[i] - src2[i]);
+    }
+}
+
+void riscv_dsp_sub_u8_q7(uint8_t *src1, uint8_t *src2, q7_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q7((q31_t)src1[i] - src2[i]);
+    }
+}
+
+/* Multiplication */
+void riscv_dsp_mul_f32(float32_t *src1, float32_t *src2, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] * src2[i];
+    }
+}
+
+void riscv_dsp_mul_q31(q31_t *src1, q31_t *src2, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31(((q63_t)src1[i] * src2[i]) >> 31);
+    }
+}
+
+void riscv_dsp_mul_q15(q15_t *src1, q15_t *src2, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q15(((q31_t)src1[i] * src2[i]) >> 15);
+    }
+}
+
+void riscv_dsp_mul_q7(q7_t *src1, q7_t *src2, q7_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q7(((q31_t)src1[i] * src2[i]) >> 7);
+    }
+}
+
+void riscv_dsp_mul_u8_u16(uint8_t *src1, uint8_t *src2, uint16_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = (uint16_t)src1[i] * src2[i];
+    }
+}
+
+/* Division */
+void riscv_dsp_div_f32(float32_t *src1, float32_t *src2, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] / src2[i];
+    }
+}
+
+q31_t riscv_dsp_div_q31(q31_t src1, q31_t src2)
+{
+    if (src2 == 0) {
+        return (src1 < 0) ? HPM_DSP_SW_Q31_MIN : HPM_DSP_SW_Q31_MAX;
+    }
+    return hpm_dsp_sw_sat_q31(((q63_t)src1 * 2147483648LL) / src2);
+}
+
+q31_t riscv_dsp_div_s64_u32(q63_t src1, uint32_t src2)
+{
+    if (src2 == 0) {
+        return (src1 < 0) ? HPM_DSP_SW_Q31_MIN : HPM_DSP_SW_Q31_MAX;
+    }
+    return hpm_dsp_sw_sat_q31(src1 / (q63_t)src2);
+}
+
+q31_t riscv_dsp_div_u64_u32(uint64_t src1, uint32_t src2)
+{
+    uint64_t q;
+
+    if (src2 == 0) {
+        return HPM_DSP_SW_Q31_MAX;
+    }
+    q = src1 / src2;
+    return (q > (uint64_t)HPM_DSP_SW_Q31_MAX) ? HPM_DSP_SW_Q31_MAX : (q31_t)q;
+}
+
+/* Negation */
+void riscv_dsp_neg_f32(float32_t *src, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = -src[i];
+    }
+}
+
+void riscv_dsp_neg_q31(q31_t *src, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31(-(q63_t)src[i]);
+    }
+}
+
+void riscv_dsp_neg_q15(q15_t *src, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q15(-(q31_t)src[i]);
+    }
+}
+
+void riscv_dsp_neg_q7(q7_t *src, q7_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q7(-(q31_t)src[i]);
+    }
+}
+
+/* Dot product */
+float32_t riscv_dsp_dprod_f32(float32_t *src1, float32_t *src2, uint32_t size)
+{
+    float32_t sum = 0.0f;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src1[i] * src2[i];
+    }
+    return sum;
+}
+
+q63_t riscv_dsp_dprod_q31(q31_t *src1, q31_t *src2, uint32_t size)
+{
+    q63_t sum = 0;
+
+    /* every Q62 product is truncated to Q48 before it is accumulated */
+    for (uint32_t i = 0; i < size; i++) {
+        sum += ((q63_t)src1[i] * src2[i]) >> 14;
+    }
+    return sum;
+}
+
+q63_t riscv_dsp_dprod_q15(q15_t *src1, q15_t *src2, uint32_t size)
+{
+    q63_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += (q31_t)src1[i] * src2[i];
+    }
+    return sum;
+}
+
+q31_t riscv_dsp_dprod_u8xq15(uint8_t *src1, q15_t *src2, uint32_t size)
+{
+    q31_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += (q31_t)src1[i] * src2[i];
+    }
+    return sum;
+}
+
+q31_t riscv_dsp_dprod_q7(q7_t *src1, q7_t *src2, uint32_t size)
+{
+    q31_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += (q31_t)src1[i] * src2[i];
+    }
+    return sum;
+}
+
+q31_t riscv_dsp_dprod_q7xq15(q7_t *src1, q15_t *src2, uint32_t size)
+{
+    q31_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += (q31_t)src1[i] * src2[i];
+    }
+    return sum;
+}
+
+uint32_t riscv_dsp_dprod_u8(uint8_t *src1, uint8_t *src2, uint32_t size)
+{
+    uint32_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += (uint32_t)src1[i] * src2[i];
+    }
+    return sum;
+}
+
+/* Offset */
+void riscv_dsp_offset_f32(float32_t *src, float32_t offset, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src[i] + offset;
+    }
+}
+
+void riscv_dsp_offset_q31(q31_t *src, q31_t offset, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31((q63_t)src[i] + offset);
+    }
+}
+
+void riscv_dsp_offset_q15(q15_t *src, q15_t offset, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q15((q31_t)src[i] + offset);
+    }
+}
+
+void riscv_dsp_offset_q7(q7_t *src, q7_t offset, q7_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q7((q31_t)src[i] + offset);
+    }
+}
+
+void riscv_dsp_offset_u8(uint8_t *src, q7_t offset, uint8_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_u8((q31_t)src[i] + offset);
+    }
+}
+
+/* Scale: dst = (src * scalefract) >> (N - shift) */
+void riscv_dsp_scale_f32(float32_t *src, float32_t scale, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src[i] * scale;
+    }
+}
+
+void riscv_dsp_scale_q31(q31_t *src, q31_t scalefract, int8_t shift, q31_t *dst, uint32_t size)
+{
+    int32_t rshift = 31 - shift;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31(((q63_t)src[i] * scalefract) >> rshift);
+    }
+}
+
+void riscv_dsp_scale_q15(q15_t *src, q15_t scalefract, int8_t shift, q15_t *dst, uint32_t size)
+{
+    int32_t rshift = 15 - shift;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat64_q15(((q63_t)src[i] * scalefract) >> rshift);
+    }
+}
+
+void riscv_dsp_scale_q7(q7_t *src, q7_t scalefract, int8_t shift, q7_t *dst, uint32_t size)
+{
+    int32_t rshift = 7 - shift;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q7(((q31_t)src[i] * scalefract) >> rshift);
+    }
+}
+
+void riscv_dsp_scale_u8(uint8_t *src, q7_t scalefract, int8_t shift, uint8_t *dst, uint32_t size)
+{
+    int32_t rshift = 7 - shift;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_u8(((q31_t)src[i] * scalefract) >> rshift);
+    }
+}
+
+/* Shift: left saturates, right is arithmetic */
+void riscv_dsp_shift_q31(q31_t *src, int8_t shift, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31(hpm_dsp_sw_shift_q63(src[i], shift));
+    }
+}
+
+void riscv_dsp_shift_q15(q15_t *src, int8_t shift, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat64_q15(hpm_dsp_sw_shift_q63(src[i], shift));
+    }
+}
+
+void riscv_dsp_shift_q7(q7_t *src, int8_t shift, q7_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q7(hpm_dsp_sw_sat_q31(hpm_dsp_sw_shift_q63(src[i], shift)));
+    }
+}
+
+void riscv_dsp_shift_u8(uint8_t *src, int8_t shift, uint8_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_u8(hpm_dsp_sw_sat_q31(hpm_dsp_sw_shift_q63(src[i], shift)));
+    }
+}
+
+/* Clip */
+void riscv_dsp_clip_f32(float32_t *src, float32_t *dst, float32_t low, float32_t high, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        float32_t v = src[i];
+        dst[i] = (v > high) ? high : ((v < low) ? low : v);
+    }
+}
+
+void riscv_dsp_clip_q31(q31_t *src, q31_t *dst, q31_t low, q31_t high, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q31_t v = src[i];
+        dst[i] = (v > high) ? high : ((v < low) ? low : v);
+    }
+}
+
+void riscv_dsp_clip_q15(q15_t *src, q15_t *dst, q15_t low, q15_t high, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q15_t v = src[i];
+        dst[i] = (v > high) ? high : ((v < low) ? low : v);
+    }
+}
+
+void riscv_dsp_clip_q7(q7_t *src, q7_t *dst, q7_t low, q7_t high, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q7_t v = src[i];
+        dst[i] = (v > high) ? high : ((v < low) ? low : v);
+    }
+}
+
+/* Bitwise operations */
+void riscv_dsp_and_u32(u32_t *src1, u32_t *src2, u32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] & src2[i];
+    }
+}
+
+void riscv_dsp_and_u16(u16_t *src1, u16_t *src2, u16_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] & src2[i];
+    }
+}
+
+void riscv_dsp_and_u8(u8_t *src1, u8_t *src2, u8_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] & src2[i];
+    }
+}
+
+void riscv_dsp_or_u32(u32_t *src1, u32_t *src2, u32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] | src2[i];
+    }
+}
+
+void riscv_dsp_or_u16(u16_t *src1, u16_t *src2, u16_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] | src2[i];
+    }
+}
+
+void riscv_dsp_or_u8(u8_t *src1, u8_t *src2, u8_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] | src2[i];
+    }
+}
+
+void riscv_dsp_xor_u32(u32_t *src1, u32_t *src2, u32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] ^ src2[i];
+    }
+}
+
+void riscv_dsp_xor_u16(u16_t *src1, u16_t *src2, u16_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] ^ src2[i];
+    }
+}
+
+void riscv_dsp_xor_u8(u8_t *src1, u8_t *src2, u8_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] ^ src2[i];
+    }
+}
+
+void riscv_dsp_not_u32(u32_t *src, u32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = ~src[i];
+    }
+}
+
+void riscv_dsp_not_u16(u16_t *src, u16_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = (u16_t)~src[i];
+    }
+}
+
+void riscv_dsp_not_u8(u8_t *src, u8_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = (u8_t)~src[i];
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_DSP_SW_COMMON_H
+#define HPM_DSP_SW_COMMON_H
+
+/*
+ * Helpers shared by the portable C implementation of the riscv_dsp API (HPM_DSP_SW).
+ *
+ * Fixed-point conventions follow the Andes DSP library: products are formed at full
+ * precision, results are truncated (arithmetic shift) and saturated to the output type.
+ * Signed right shifts are arithmetic on every supported compiler.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include "riscv_dsp_math_types.h"
+
+#define HPM_DSP_SW_Q31_MAX  ((q31_t)0x7FFFFFFF)
+#define HPM_DSP_SW_Q31_MIN  ((q31_t)0x80000000)
+#define HPM_DSP_SW_Q15_MAX  ((q15_t)0x7FFF)
+#define HPM_DSP_SW_Q15_MIN  ((q15_t)0x8000)
+#define HPM_DSP_SW_Q7_MAX   ((q7_t)0x7F)
+#define HPM_DSP_SW_Q7_MIN   ((q7_t)0x80)
+
+#define HPM_DSP_SW_PI (3.14159265358979323846)
+
+/* log2 of the largest transform size */
+#define HPM_DSP_SW_FFT_MAX_LOG2 (13U)
+
+static inline q31_t hpm_dsp_sw_sat_q31(q63_t x)
+{
+    return (x > HPM_DSP_SW_Q31_MAX) ? HPM_DSP_SW_Q31_MAX : ((x < HPM_DSP_SW_Q31_MIN) ? HPM_DSP_SW_Q31_MIN : (q31_t)x);
+}
+
+static inline q15_t hpm_dsp_sw_sat_q15(q31_t x)
+{
+    return (x > HPM_DSP_SW_Q15_MAX) ? HPM_DSP_SW_Q15_MAX : ((x < HPM_DSP_SW_Q15_MIN) ? HPM_DSP_SW_Q15_MIN : (q15_t)x);
+}
+
+static inline q15_t hpm_dsp_sw_sat64_q15(q63_t x)
+{
+    return (x > HPM_DSP_SW_Q15_MAX) ? HPM_DSP_SW_Q15_MAX : ((x < HPM_DSP_SW_Q15_MIN) ? HPM_DSP_SW_Q15_MIN : (q15_t)x);
+}
+
+static inline q7_t hpm_dsp_sw_sat_q7(q31_t x)
+{
+    return (x > HPM_DSP_SW_Q7_MAX) ? HPM_DSP_SW_Q7_MAX : ((x < HPM_DSP_SW_Q7_MIN) ? HPM_DSP_SW_Q7_MIN : (q7_t)x);
+}
+
+static inline uint8_t hpm_dsp_sw_sat_u8(q31_t x)
+{
+    return (x > 0xFF) ? 0xFFU : ((x < 0) ? 0U : (uint8_t)x);
+}
+
+/* shift left for shift > 0, arithmetic shift right otherwise */
+static inline q63_t hpm_dsp_sw_shift_q63(q63_t x, int32_t shift)
+{
+    return (shift >= 0) ? (q63_t)((uint64_t)x << shift) : (x >> -shift);
+}
+
+/* floor(sqrt(x)) */
+static inline uint64_t hpm_dsp_sw_isqrt_u64(uint64_t x)
+{
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+/* Q31 twiddle factor, round(v * 2^31) saturated */
+static inline q31_t hpm_dsp_sw_double_to_q31(double v)
+{
+    double r = floor(v * 2147483648.0 + 0.5);
+    return (r >= 2147483647.0) ? HPM_DSP_SW_Q31_MAX : ((r <= -2147483648.0) ? HPM_DSP_SW_Q31_MIN : (q31_t)r);
+}
+
+static inline q15_t hpm_dsp_sw_double_to_q15(double v)
+{
+    double r = floor(v * 32768.0 + 0.5);
+    return (r >= 32767.0) ? HPM_DSP_SW_Q15_MAX : ((r <= -32768.0) ? HPM_DSP_SW_Q15_MIN : (q15_t)r);
+}
+
+#endif /* HPM_DSP_SW_COMMON_H */
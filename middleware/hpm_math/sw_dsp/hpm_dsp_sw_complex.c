@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "hpm_dsp_sw_common.h"
+#include "riscv_dsp_complex_math.h"
+
+/*
+ * Complex vectors are interleaved {re, im}. The Q15 and Q31 products are truncated to
+ * Q13 and Q29 one by one, so the sum of two full scale products can't overflow.
+ */
+
+/* Conjugate */
+void riscv_dsp_cconj_f32(const float32_t *src, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[2 * i] = src[2 * i];
+        dst[2 * i + 1] = -src[2 * i + 1];
+    }
+}
+
+void riscv_dsp_cconj_q15(const q15_t *src, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[2 * i] = src[2 * i];
+        dst[2 * i + 1] = hpm_dsp_sw_sat_q15(-(q31_t)src[2 * i + 1]);
+    }
+}
+
+void riscv_dsp_cconj_q31(const q31_t *src, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[2 * i] = src[2 * i];
+        dst[2 * i + 1] = hpm_dsp_sw_sat_q31(-(q63_t)src[2 * i + 1]);
+    }
+}
+
+/* Multiplication, element by element */
+void riscv_dsp_cmul_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        float32_t ar = src1[2 * i];
+        float32_t ai = src1[2 * i + 1];
+        float32_t br = src2[2 * i];
+        float32_t bi = src2[2 * i + 1];
+        dst[2 * i] = ar * br - ai * bi;
+        dst[2 * i + 1] = ar * bi + ai * br;
+    }
+}
+
+void riscv_dsp_cmul_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q31_t ar = src1[2 * i];
+        q31_t ai = src1[2 * i + 1];
+        q31_t br = src2[2 * i];
+        q31_t bi = src2[2 * i + 1];
+        dst[2 * i] = (q15_t)(((ar * br) >> 17) - ((ai * bi) >> 17));
+        dst[2 * i + 1] = (q15_t)(((ar * bi) >> 17) + ((ai * br) >> 17));
+    }
+}
+
+void riscv_dsp_cmul_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q63_t ar = src1[2 * i];
+        q63_t ai = src1[2 * i + 1];
+        q63_t br = src2[2 * i];
+        q63_t bi = src2[2 * i + 1];
+        dst[2 * i] = (q31_t)(((ar * br) >> 33) - ((ai * bi) >> 33));
+        dst[2 * i + 1] = (q31_t)(((ar * bi) >> 33) + ((ai * br) >> 33));
+    }
+}
+
+/* Dot product, type 1 writes the product of every pair */
+void riscv_dsp_cdprod_f32(const float32_t *src1, const float32_t *src2, uint32_t size, float32_t *dst)
+{
+    riscv_dsp_cmul_f32(src1, src2, dst, size);
+}
+
+void riscv_dsp_cdprod_q15(const q15_t *src1, const q15_t *src2, uint32_t size, q15_t *dst)
+{
+    riscv_dsp_cmul_q15(src1, src2, dst, size);
+}
+
+void riscv_dsp_cdprod_q31(const q31_t *src1, const q31_t *src2, uint32_t size, q31_t *dst)
+{
+    riscv_dsp_cmul_q31(src1, src2, dst, size);
+}
+
+/* Dot product, type 2 sums the products */
+void riscv_dsp_cdprod_typ2_f32(const float32_t *src1, const float32_t *src2, uint32_t size, float32_t *rout, float32_t *iout)
+{
+    float32_t re = 0.0f;
+    float32_t im = 0.0f;
+
+    for (uint32_t i = 0; i < size; i++) {
+        float32_t ar = src1[2 * i];
+        float32_t ai = src1[2 * i + 1];
+        float32_t br = src2[2 * i];
+        float32_t bi = src2[2 * i + 1];
+        re += ar * br - ai * bi;
+        im += ar * bi + ai * br;
+    }
+    *rout = re;
+    *iout = im;
+}
+
+/* Q24 results */
+void riscv_dsp_cdprod_typ2_q15(const q15_t *src1, const q15_t *src2, uint32_t size, q31_t *rout, q31_t *iout)
+{
+    q63_t re = 0;
+    q63_t im = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        q31_t ar = src1[2 * i];
+        q31_t ai = src1[2 * i + 1];
+        q31_t br = src2[2 * i];
+        q31_t bi = src2[2 * i + 1];
+        re += (q63_t)ar * br - (q63_t)ai * bi;
+        im += (q63_t)ar * bi + (q63_t)ai * br;
+    }
+    *rout = hpm_dsp_sw_sat_q31(re >> 6);
+    *iout = hpm_dsp_sw_sat_q31(im >> 6);
+}
+
+/* Q48 results */
+void riscv_dsp_cdprod_typ2_q31(const q31_t *src1, const q31_t *src2, uint32_t size, q63_t *rout, q63_t *iout)
+{
+    q63_t re = 0;
+    q63_t im = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        q63_t ar = src1[2 * i];
+        q63_t ai = src1[2 * i + 1];
+        q63_t br = src2[2 * i];
+        q63_t bi = src2[2 * i + 1];
+        re += ((ar * br) >> 14) - ((ai * bi) >> 14);
+        im += ((ar * bi) >> 14) + ((ai * br) >> 14);
+    }
+    *rout = re;
+    *iout = im;
+}
+
+/* Magnitude */
+void riscv_dsp_cmag_f32(const float32_t *src, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        float32_t re = src[2 * i];
+        float32_t im = src[2 * i + 1];
+        dst[i] = sqrtf(re * re + im * im);
+    }
+}
+
+void riscv_dsp_cmag_q15(const q15_t *src, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q31_t re = src[2 * i];
+        q31_t im = src[2 * i + 1];
+        uint64_t sum = (uint64_t)(re * re) + (uint64_t)(im * im);
+        dst[i] = (q15_t)(hpm_dsp_sw_isqrt_u64(sum) >> 2);
+    }
+}
+
+void riscv_dsp_cmag_q31(const q31_t *src, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q63_t re = src[2 * i];
+        q63_t im = src[2 * i + 1];
+        uint64_t sum = (uint64_t)(re * re) + (uint64_t)(im * im);
+        dst[i] = (q31_t)(hpm_dsp_sw_isqrt_u64(sum) >> 2);
+    }
+}
+
+void riscv_dsp_cmag_sqr_f32(const float32_t *src, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        float32_t re = src[2 * i];
+        float32_t im = src[2 * i + 1];
+        dst[i] = re * re + im * im;
+    }
+}
+
+void riscv_dsp_cmag_sqr_q15(const q15_t *src, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q63_t re = src[2 * i];
+        q63_t im = src[2 * i + 1];
+        dst[i] = (q15_t)((re * re + im * im) >> 17);
+    }
+}
+
+void riscv_dsp_cmag_sqr_q31(const q31_t *src, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        q63_t re = src[2 * i];
+        q63_t im = src[2 * i + 1];
+        dst[i] = (q31_t)(((re * re) >> 33) + ((im * im) >> 33));
+    }
+}
+
+/* Multiplication by a real vector */
+void riscv_dsp_cmul_real_f32(const float32_t *src, const float32_t *real, float32_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[2 * i] = src[2 * i] * real[i];
+        dst[2 * i + 1] = src[2 * i + 1] * real[i];
+    }
+}
+
+void riscv_dsp_cmul_real_q15(const q15_t *src, const q15_t *real, q15_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[2 * i] = hpm_dsp_sw_sat_q15(((q31_t)src[2 * i] * real[i]) >> 15);
+        dst[2 * i + 1] = hpm_dsp_sw_sat_q15(((q31_t)src[2 * i + 1] * real[i]) >> 15);
+    }
+}
+
+void riscv_dsp_cmul_real_q31(const q31_t *src, const q31_t *real, q31_t *dst, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        dst[2 * i] = hpm_dsp_sw_sat_q31(((q63_t)src[2 * i] * real[i]) >> 31);
+        dst[2 * i + 1] = hpm_dsp_sw_sat_q31(((q63_t)src[2 * i + 1] * real[i]) >> 31);
+    }
+}
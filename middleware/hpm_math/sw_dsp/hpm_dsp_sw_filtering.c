@@ -0,0 +1,1145 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "hpm_dsp_sw_common.h"
+#include "riscv_dsp_filtering_math.h"
+
+/*
+ * Block FIR style filters keep coeff_size - 1 history samples at the start of the state
+ * vector, the new block is appended behind them and the coefficients are time reversed:
+ * dst[n] = sum(coeff[k] * state[n + k]). After the block the newest history is moved back
+ * to the start of the state vector.
+ */
+
+/* FIR */
+void riscv_dsp_fir_f32(const riscv_dsp_fir_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    float32_t *state = instance->state;
+    const float32_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(float32_t));
+    for (uint32_t n = 0; n < size; n++) {
+        float32_t sum = 0.0f;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += coeff[k] * state[n + k];
+        }
+        dst[n] = sum;
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(float32_t));
+}
+
+void riscv_dsp_fir_q31(const riscv_dsp_fir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q31_t *state = instance->state;
+    const q31_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(q31_t));
+    for (uint32_t n = 0; n < size; n++) {
+        q63_t sum = 0;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (q63_t)coeff[k] * state[n + k];
+        }
+        dst[n] = hpm_dsp_sw_sat_q31(sum >> 31);
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q31_t));
+}
+
+/* the high word of every product is accumulated in Q2.30 */
+void riscv_dsp_fir_fast_q31(const riscv_dsp_fir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q31_t *state = instance->state;
+    const q31_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(q31_t));
+    for (uint32_t n = 0; n < size; n++) {
+        uint32_t sum = 0;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (uint32_t)(((q63_t)coeff[k] * state[n + k]) >> 32);
+        }
+        dst[n] = (q31_t)(sum << 1);
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q31_t));
+}
+
+void riscv_dsp_fir_q15(const riscv_dsp_fir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q15_t *state = instance->state;
+    const q15_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(q15_t));
+    for (uint32_t n = 0; n < size; n++) {
+        q63_t sum = 0;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (q31_t)coeff[k] * state[n + k];
+        }
+        dst[n] = hpm_dsp_sw_sat64_q15(sum >> 15);
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q15_t));
+}
+
+/* 32-bit accumulator, it wraps if the sum leaves the Q2.30 range */
+void riscv_dsp_fir_fast_q15(const riscv_dsp_fir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q15_t *state = instance->state;
+    const q15_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(q15_t));
+    for (uint32_t n = 0; n < size; n++) {
+        uint32_t sum = 0;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (uint32_t)((q31_t)coeff[k] * state[n + k]);
+        }
+        dst[n] = hpm_dsp_sw_sat_q15((q31_t)sum >> 15);
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q15_t));
+}
+
+void riscv_dsp_fir_q7(const riscv_dsp_fir_q7_t *instance, q7_t *src, q7_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q7_t *state = instance->state;
+    const q7_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(q7_t));
+    for (uint32_t n = 0; n < size; n++) {
+        q31_t sum = 0;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (q31_t)coeff[k] * state[n + k];
+        }
+        dst[n] = hpm_dsp_sw_sat_q7(sum >> 7);
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q7_t));
+}
+
+/*
+ * Lattice FIR, state[m] holds g(m, n - 1):
+ * f(m, n) = f(m - 1, n) + k(m) * g(m - 1, n - 1)
+ * g(m, n) = k(m) * f(m - 1, n) + g(m - 1, n - 1)
+ */
+void riscv_dsp_lfir_f32(const riscv_dsp_lfir_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
+{
+    float32_t *state = instance->state;
+    const float32_t *k = instance->coeff;
+
+    for (uint32_t n = 0; n < size; n++) {
+        float32_t f = src[n];
+        float32_t g = src[n];
+        for (uint32_t m = 0; m < instance->stage; m++) {
+            float32_t g_prev = state[m];
+            float32_t f_next = f + k[m] * g_prev;
+            state[m] = g;
+            g = k[m] * f + g_prev;
+            f = f_next;
+        }
+        dst[n] = f;
+    }
+}
+
+void riscv_dsp_lfir_q15(const riscv_dsp_lfir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
+{
+    q15_t *state = instance->state;
+    const q15_t *k = instance->coeff;
+
+    for (uint32_t n = 0; n < size; n++) {
+        q15_t f = src[n];
+        q15_t g = src[n];
+        for (uint32_t m = 0; m < instance->stage; m++) {
+            q15_t g_prev = state[m];
+            q15_t f_next = hpm_dsp_sw_sat_q15(f + (((q31_t)k[m] * g_prev) >> 15));
+            state[m] = g;
+            g = hpm_dsp_sw_sat_q15((((q31_t)k[m] * f) >> 15) + g_prev);
+            f = f_next;
+        }
+        dst[n] = f;
+    }
+}
+
+void riscv_dsp_lfir_q31(const riscv_dsp_lfir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    q31_t *state = instance->state;
+    const q31_t *k = instance->coeff;
+
+    for (uint32_t n = 0; n < size; n++) {
+        q31_t f = src[n];
+        q31_t g = src[n];
+        for (uint32_t m = 0; m < instance->stage; m++) {
+            q31_t g_prev = state[m];
+            q31_t f_next = hpm_dsp_sw_sat_q31(f + (((q63_t)k[m] * g_prev) >> 31));
+            state[m] = g;
+            g = hpm_dsp_sw_sat_q31((((q63_t)k[m] * f) >> 31) + g_prev);
+            f = f_next;
+        }
+        dst[n] = f;
+    }
+}
+
+/* Decimator, size must be a multiple of M and size / M samples are written */
+void riscv_dsp_dcmfir_f32(const riscv_dsp_dcmfir_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    float32_t *state = instance->state;
+    const float32_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(float32_t));
+    for (uint32_t n = 0; n < size / instance->M; n++) {
+        const float32_t *x = &state[n * instance->M];
+        float32_t sum = 0.0f;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += coeff[k] * x[k];
+        }
+        dst[n] = sum;
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(float32_t));
+}
+
+void riscv_dsp_dcmfir_q15(const riscv_dsp_dcmfir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q15_t *state = instance->state;
+    const q15_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(q15_t));
+    for (uint32_t n = 0; n < size / instance->M; n++) {
+        const q15_t *x = &state[n * instance->M];
+        q63_t sum = 0;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (q31_t)coeff[k] * x[k];
+        }
+        dst[n] = hpm_dsp_sw_sat64_q15(sum >> 15);
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q15_t));
+}
+
+void riscv_dsp_dcmfir_fast_q15(const riscv_dsp_dcmfir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q15_t *state = instance->state;
+    const q15_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(q15_t));
+    for (uint32_t n = 0; n < size / instance->M; n++) {
+        const q15_t *x = &state[n * instance->M];
+        uint32_t sum = 0;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (uint32_t)((q31_t)coeff[k] * x[k]);
+        }
+        dst[n] = hpm_dsp_sw_sat_q15((q31_t)sum >> 15);
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q15_t));
+}
+
+void riscv_dsp_dcmfir_q31(const riscv_dsp_dcmfir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q31_t *state = instance->state;
+    const q31_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(q31_t));
+    for (uint32_t n = 0; n < size / instance->M; n++) {
+        const q31_t *x = &state[n * instance->M];
+        q63_t sum = 0;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (q63_t)coeff[k] * x[k];
+        }
+        dst[n] = hpm_dsp_sw_sat_q31(sum >> 31);
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q31_t));
+}
+
+void riscv_dsp_dcmfir_fast_q31(const riscv_dsp_dcmfir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q31_t *state = instance->state;
+    const q31_t *coeff = instance->coeff;
+
+    memcpy(&state[taps - 1], src, size * sizeof(q31_t));
+    for (uint32_t n = 0; n < size / instance->M; n++) {
+        const q31_t *x = &state[n * instance->M];
+        uint32_t sum = 0;
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (uint32_t)(((q63_t)coeff[k] * x[k]) >> 32);
+        }
+        dst[n] = hpm_dsp_sw_sat_q31((q63_t)(q31_t)sum * 2);
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q31_t));
+}
+
+/*
+ * Upsampler, the polyphase filter of phase j uses coeff[L - 1 - j + L * k]. size input
+ * samples produce L * size output samples.
+ */
+void riscv_dsp_upsplfir_f32(const riscv_dsp_upsplfir_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
+{
+    uint32_t L = instance->L;
+    uint32_t plen = instance->plen;
+    float32_t *state = instance->state;
+    const float32_t *coeff = instance->coeff;
+
+    memcpy(&state[plen - 1], src, size * sizeof(float32_t));
+    for (uint32_t n = 0; n < size; n++) {
+        for (uint32_t j = 0; j < L; j++) {
+            float32_t sum = 0.0f;
+            for (uint32_t k = 0; k < plen; k++) {
+                sum += state[n + k] * coeff[(L - 1 - j) + k * L];
+            }
+            dst[n * L + j] = sum;
+        }
+    }
+    memmove(state, &state[size], (plen - 1) * sizeof(float32_t));
+}
+
+void riscv_dsp_upsplfir_q15(const riscv_dsp_upsplfir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
+{
+    uint32_t L = instance->L;
+    uint32_t plen = instance->plen;
+    q15_t *state = instance->state;
+    const q15_t *coeff = instance->coeff;
+
+    memcpy(&state[plen - 1], src, size * sizeof(q15_t));
+    for (uint32_t n = 0; n < size; n++) {
+        for (uint32_t j = 0; j < L; j++) {
+            q63_t sum = 0;
+            for (uint32_t k = 0; k < plen; k++) {
+                sum += (q31_t)state[n + k] * coeff[(L - 1 - j) + k * L];
+            }
+            dst[n * L + j] = hpm_dsp_sw_sat64_q15(sum >> 15);
+        }
+    }
+    memmove(state, &state[size], (plen - 1) * sizeof(q15_t));
+}
+
+void riscv_dsp_upsplfir_q31(const riscv_dsp_upsplfir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    uint32_t L = instance->L;
+    uint32_t plen = instance->plen;
+    q31_t *state = instance->state;
+    const q31_t *coeff = instance->coeff;
+
+    memcpy(&state[plen - 1], src, size * sizeof(q31_t));
+    for (uint32_t n = 0; n < size; n++) {
+        for (uint32_t j = 0; j < L; j++) {
+            q63_t sum = 0;
+            for (uint32_t k = 0; k < plen; k++) {
+                sum += (q63_t)state[n + k] * coeff[(L - 1 - j) + k * L];
+            }
+            dst[n * L + j] = hpm_dsp_sw_sat_q31(sum >> 31);
+        }
+    }
+    memmove(state, &state[size], (plen - 1) * sizeof(q31_t));
+}
+
+/*
+ * Sparse FIR, dst[n] = sum(coeff[t] * x[n - nezdelay[t]]). The state is a circular buffer
+ * of delay + size samples and index is its write position. For every tap the delayed
+ * samples are gathered into a temporary buffer first, so the multiply-accumulate loop is
+ * a plain vector operation.
+ */
+static uint32_t hpm_dsp_sw_spafir_read_pos(uint32_t index, uint32_t len, uint32_t size, int32_t delay)
+{
+    return (index + 2 * len - size - (uint32_t)delay) % len;
+}
+
+#define HPM_DSP_SW_SPAFIR_WRITE(instance, src, size, len)               \
+    do {                                                                \
+        uint32_t w = (instance)->index;                                 \
+        for (uint32_t i = 0; i < (size); i++) {                         \
+            (instance)->state[w] = (src)[i];                            \
+            w = (w + 1 == (len)) ? 0 : (w + 1);                         \
+        }                                                               \
+        (instance)->index = (uint16_t)w;                                \
+    } while (0)
+
+#define HPM_DSP_SW_SPAFIR_GATHER(instance, tap, buf, size, len)                                         \
+    do {                                                                                                \
+        uint32_t r = hpm_dsp_sw_spafir_read_pos((instance)->index, (len), (size),                     \
+                                                (instance)->nezdelay[tap]);                             \
+        for (uint32_t i = 0; i < (size); i++) {                                                         \
+            (buf)[i] = (instance)->state[r];                                                            \
+            r = (r + 1 == (len)) ? 0 : (r + 1);                                                         \
+        }                                                                                               \
+    } while (0)
+
+void riscv_dsp_spafir_f32(riscv_dsp_spafir_f32_t *instance, float32_t *src, float32_t *dst, float32_t *buf, uint32_t size)
+{
+    uint32_t len = instance->delay + size;
+
+    HPM_DSP_SW_SPAFIR_WRITE(instance, src, size, len);
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = 0.0f;
+    }
+    for (uint32_t t = 0; t < instance->coeff_size; t++) {
+        float32_t c = instance->coeff[t];
+        HPM_DSP_SW_SPAFIR_GATHER(instance, t, buf, size, len);
+        for (uint32_t i = 0; i < size; i++) {
+            dst[i] += c * buf[i];
+        }
+    }
+}
+
+void riscv_dsp_spafir_q15(riscv_dsp_spafir_q15_t *instance, q15_t *src, q15_t *dst, q15_t *buf1, q31_t *buf2, uint32_t size)
+{
+    uint32_t len = instance->delay + size;
+
+    HPM_DSP_SW_SPAFIR_WRITE(instance, src, size, len);
+    for (uint32_t i = 0; i < size; i++) {
+        buf2[i] = 0;
+    }
+    for (uint32_t t = 0; t < instance->coeff_size; t++) {
+        q31_t c = instance->coeff[t];
+        HPM_DSP_SW_SPAFIR_GATHER(instance, t, buf1, size, len);
+        for (uint32_t i = 0; i < size; i++) {
+            buf2[i] += c * buf1[i];
+        }
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q15(buf2[i] >> 15);
+    }
+}
+
+/* Q2.30 accumulation in the destination, like the fast Q31 filters */
+void riscv_dsp_spafir_q31(riscv_dsp_spafir_q31_t *instance, q31_t *src, q31_t *dst, q31_t *buf, uint32_t size)
+{
+    uint32_t len = instance->delay + size;
+
+    HPM_DSP_SW_SPAFIR_WRITE(instance, src, size, len);
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = 0;
+    }
+    for (uint32_t t = 0; t < instance->coeff_size; t++) {
+        q63_t c = instance->coeff[t];
+        HPM_DSP_SW_SPAFIR_GATHER(instance, t, buf, size, len);
+        for (uint32_t i = 0; i < size; i++) {
+            dst[i] = (q31_t)((uint32_t)dst[i] + (uint32_t)((c * buf[i]) >> 32));
+        }
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31((q63_t)dst[i] * 2);
+    }
+}
+
+void riscv_dsp_spafir_q7(riscv_dsp_spafir_q7_t *instance, q7_t *src, q7_t *dst, q7_t *buf1, q31_t *buf2, uint32_t size)
+{
+    uint32_t len = instance->delay + size;
+
+    HPM_DSP_SW_SPAFIR_WRITE(instance, src, size, len);
+    for (uint32_t i = 0; i < size; i++) {
+        buf2[i] = 0;
+    }
+    for (uint32_t t = 0; t < instance->coeff_size; t++) {
+        q31_t c = instance->coeff[t];
+        HPM_DSP_SW_SPAFIR_GATHER(instance, t, buf1, size, len);
+        for (uint32_t i = 0; i < size; i++) {
+            buf2[i] += c * buf1[i];
+        }
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q7(buf2[i] >> 7);
+    }
+}
+
+/*
+ * LMS: y = sum(h * x), e = d - y, h += mu * e * x. The fixed-point outputs are shifted
+ * left by the instance shift, as coefficients in Q(1 + shift) format allow.
+ */
+void riscv_dsp_lms_f32(const riscv_dsp_lms_f32_t *instance, float32_t *src, float32_t *ref, float32_t *dst, float32_t *err, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    float32_t *state = instance->state;
+    float32_t *coeff = instance->coeff;
+
+    for (uint32_t n = 0; n < size; n++) {
+        const float32_t *x = &state[n];
+        float32_t sum = 0.0f;
+        float32_t alpha;
+
+        state[taps - 1 + n] = src[n];
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += coeff[k] * x[k];
+        }
+        dst[n] = sum;
+        err[n] = ref[n] - sum;
+        alpha = instance->mu * err[n];
+        for (uint32_t k = 0; k < taps; k++) {
+            coeff[k] += alpha * x[k];
+        }
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(float32_t));
+}
+
+void riscv_dsp_lms_q31(const riscv_dsp_lms_q31_t *instance, q31_t *src, q31_t *ref, q31_t *dst, q31_t *err, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q31_t *state = instance->state;
+    q31_t *coeff = instance->coeff;
+    int32_t rshift = 31 - instance->shift;
+
+    for (uint32_t n = 0; n < size; n++) {
+        const q31_t *x = &state[n];
+        q63_t sum = 0;
+        q31_t alpha;
+
+        state[taps - 1 + n] = src[n];
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (q63_t)coeff[k] * x[k];
+        }
+        dst[n] = hpm_dsp_sw_sat_q31(sum >> rshift);
+        err[n] = hpm_dsp_sw_sat_q31((q63_t)ref[n] - dst[n]);
+        alpha = (q31_t)(((q63_t)err[n] * instance->mu) >> 31);
+        for (uint32_t k = 0; k < taps; k++) {
+            coeff[k] = hpm_dsp_sw_sat_q31((q63_t)coeff[k] + (((q63_t)alpha * x[k]) >> 31));
+        }
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q31_t));
+}
+
+void riscv_dsp_lms_q15(const riscv_dsp_lms_q15_t *instance, q15_t *src, q15_t *ref, q15_t *dst, q15_t *err, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q15_t *state = instance->state;
+    q15_t *coeff = instance->coeff;
+    int32_t rshift = 15 - instance->shift;
+
+    for (uint32_t n = 0; n < size; n++) {
+        const q15_t *x = &state[n];
+        q63_t sum = 0;
+        q15_t alpha;
+
+        state[taps - 1 + n] = src[n];
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (q31_t)coeff[k] * x[k];
+        }
+        dst[n] = hpm_dsp_sw_sat64_q15(sum >> rshift);
+        err[n] = hpm_dsp_sw_sat_q15((q31_t)ref[n] - dst[n]);
+        alpha = (q15_t)(((q31_t)err[n] * instance->mu) >> 15);
+        for (uint32_t k = 0; k < taps; k++) {
+            coeff[k] = hpm_dsp_sw_sat_q15(coeff[k] + (((q31_t)alpha * x[k]) >> 15));
+        }
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(q15_t));
+}
+
+/*
+ * Normalized LMS: the step is divided by the energy of the samples in the filter. The
+ * energy is updated sample by sample with the newest and the oldest input, the small
+ * offsets keep the division defined for silent input.
+ */
+#define HPM_DSP_SW_NLMS_DELTA_F32   (0.000000119209289f)
+#define HPM_DSP_SW_NLMS_DELTA_Q31   ((q31_t)0x100)
+#define HPM_DSP_SW_NLMS_DELTA_Q15   ((q15_t)0x5)
+
+void riscv_dsp_nlms_f32(riscv_dsp_nlms_f32_t *instance, float32_t *src, float32_t *ref, float32_t *dst, float32_t *err, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    float32_t *state = instance->state;
+    float32_t *coeff = instance->coeff;
+
+    for (uint32_t n = 0; n < size; n++) {
+        const float32_t *x = &state[n];
+        float32_t sum = 0.0f;
+        float32_t energy = 0.0f;
+        float32_t w;
+
+        state[taps - 1 + n] = src[n];
+        /* the instance holds no oldest sample, so the energy is summed again */
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += coeff[k] * x[k];
+            energy += x[k] * x[k];
+        }
+        dst[n] = sum;
+        err[n] = ref[n] - sum;
+        w = err[n] * instance->mu / (energy + HPM_DSP_SW_NLMS_DELTA_F32);
+        for (uint32_t k = 0; k < taps; k++) {
+            coeff[k] += w * x[k];
+        }
+        instance->energy = energy;
+    }
+    memmove(state, &state[size], (taps - 1) * sizeof(float32_t));
+}
+
+void riscv_dsp_nlms_q31(riscv_dsp_nlms_q31_t *instance, q31_t *src, q31_t *ref, q31_t *dst, q31_t *err, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q31_t *state = instance->state;
+    q31_t *coeff = instance->coeff;
+    int32_t rshift = 31 - instance->postshift;
+    q31_t energy = instance->energy;
+    q31_t x0 = instance->x0;
+
+    for (uint32_t n = 0; n < size; n++) {
+        const q31_t *x = &state[n];
+        q63_t sum = 0;
+        q31_t mu_err;
+        q31_t w;
+
+        state[taps - 1 + n] = src[n];
+        energy = hpm_dsp_sw_sat_q31((q63_t)energy - (((q63_t)x0 * x0) >> 31) + (((q63_t)src[n] * src[n]) >> 31));
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (q63_t)coeff[k] * x[k];
+        }
+        dst[n] = hpm_dsp_sw_sat_q31(sum >> rshift);
+        err[n] = hpm_dsp_sw_sat_q31((q63_t)ref[n] - dst[n]);
+        mu_err = (q31_t)(((q63_t)err[n] * instance->mu) >> 31);
+        w = hpm_dsp_sw_sat_q31(((q63_t)mu_err * 2147483648LL) / ((q63_t)energy + HPM_DSP_SW_NLMS_DELTA_Q31));
+        for (uint32_t k = 0; k < taps; k++) {
+            coeff[k] = hpm_dsp_sw_sat_q31((q63_t)coeff[k] + (((q63_t)w * x[k]) >> 31));
+        }
+        x0 = x[0];
+    }
+    instance->energy = energy;
+    instance->x0 = x0;
+    memmove(state, &state[size], (taps - 1) * sizeof(q31_t));
+}
+
+void riscv_dsp_nlms_q15(riscv_dsp_nlms_q15_t *instance, q15_t *src, q15_t *ref, q15_t *dst, q15_t *err, uint32_t size)
+{
+    uint32_t taps = instance->coeff_size;
+    q15_t *state = instance->state;
+    q15_t *coeff = instance->coeff;
+    int32_t rshift = 15 - instance->postshift;
+    q15_t energy = instance->energy;
+    q15_t x0 = instance->x0;
+
+    for (uint32_t n = 0; n < size; n++) {
+        const q15_t *x = &state[n];
+        q63_t sum = 0;
+        q15_t mu_err;
+        q15_t w;
+
+        state[taps - 1 + n] = src[n];
+        energy = hpm_dsp_sw_sat_q15(energy - (((q31_t)x0 * x0) >> 15) + (((q31_t)src[n] * src[n]) >> 15));
+        for (uint32_t k = 0; k < taps; k++) {
+            sum += (q31_t)coeff[k] * x[k];
+        }
+        dst[n] = hpm_dsp_sw_sat64_q15(sum >> rshift);
+        err[n] = hpm_dsp_sw_sat_q15((q31_t)ref[n] - dst[n]);
+        mu_err = (q15_t)(((q31_t)err[n] * instance->mu) >> 15);
+        w = hpm_dsp_sw_sat_q15(((q31_t)mu_err * 32768) / ((q31_t)energy + HPM_DSP_SW_NLMS_DELTA_Q15));
+        for (uint32_t k = 0; k < taps; k++) {
+            coeff[k] = hpm_dsp_sw_sat_q15(coeff[k] + (((q31_t)w * x[k]) >> 15));
+        }
+        x0 = x[0];
+    }
+    instance->energy = energy;
+    instance->x0 = x0;
+    memmove(state, &state[size], (taps - 1) * sizeof(q15_t));
+}
+
+/* Convolution, dst[n] = sum(src1[k] * src2[n - k]) for 0 <= n < len1 + len2 - 1 */
+#define HPM_DSP_SW_CONV_RANGE(n, len1, len2, kmin, kmax)                  \
+    uint32_t kmin = ((n) >= (len2)) ? ((n) - (len2) + 1) : 0;              \
+    uint32_t kmax = ((n) < (len1)) ? (n) : ((len1) - 1)
+
+void riscv_dsp_conv_f32(float32_t *src1, uint32_t len1, float32_t *src2, uint32_t len2, float32_t *dst)
+{
+    riscv_dsp_conv_partial_f32(src1, len1, src2, len2, dst, 0, len1 + len2 - 1);
+}
+
+void riscv_dsp_conv_q15(q15_t *src1, uint32_t len1, q15_t *src2, uint32_t len2, q15_t *dst)
+{
+    riscv_dsp_conv_partial_q15(src1, len1, src2, len2, dst, 0, len1 + len2 - 1);
+}
+
+void riscv_dsp_conv_q31(q31_t *src1, uint32_t len1, q31_t *src2, uint32_t len2, q31_t *dst)
+{
+    riscv_dsp_conv_partial_q31(src1, len1, src2, len2, dst, 0, len1 + len2 - 1);
+}
+
+void riscv_dsp_conv_q7(q7_t *src1, uint32_t len1, q7_t *src2, uint32_t len2, q7_t *dst)
+{
+    riscv_dsp_conv_partial_q7(src1, len1, src2, len2, dst, 0, len1 + len2 - 1);
+}
+
+/* Partial convolution, dst[n] is written for startindex <= n < startindex + size */
+int32_t riscv_dsp_conv_partial_f32(float32_t *src1, uint32_t len1, float32_t *src2, uint32_t len2, float32_t *dst,
+                                   uint32_t startindex, uint32_t size)
+{
+    if ((startindex + size) > (len1 + len2 - 1)) {
+        return -1;
+    }
+    for (uint32_t n = startindex; n < startindex + size; n++) {
+        HPM_DSP_SW_CONV_RANGE(n, len1, len2, kmin, kmax);
+        float32_t sum = 0.0f;
+        for (uint32_t k = kmin; k <= kmax; k++) {
+            sum += src1[k] * src2[n - k];
+        }
+        dst[n] = sum;
+    }
+    return 0;
+}
+
+int32_t riscv_dsp_conv_partial_q15(q15_t *src1, uint32_t len1, q15_t *src2, uint32_t len2, q15_t *dst,
+                                   uint32_t startindex, uint32_t size)
+{
+    if ((startindex + size) > (len1 + len2 - 1)) {
+        return -1;
+    }
+    for (uint32_t n = startindex; n < startindex + size; n++) {
+        HPM_DSP_SW_CONV_RANGE(n, len1, len2, kmin, kmax);
+        q63_t sum = 0;
+        for (uint32_t k = kmin; k <= kmax; k++) {
+            sum += (q31_t)src1[k] * src2[n - k];
+        }
+        dst[n] = hpm_dsp_sw_sat64_q15(sum >> 15);
+    }
+    return 0;
+}
+
+int32_t riscv_dsp_conv_partial_q31(q31_t *src1, uint32_t len1, q31_t *src2, uint32_t len2, q31_t *dst,
+                                   uint32_t startindex, uint32_t size)
+{
+    if ((startindex + size) > (len1 + len2 - 1)) {
+        return -1;
+    }
+    for (uint32_t n = startindex; n < startindex + size; n++) {
+        HPM_DSP_SW_CONV_RANGE(n, len1, len2, kmin, kmax);
+        q63_t sum = 0;
+        for (uint32_t k = kmin; k <= kmax; k++) {
+            sum += (q63_t)src1[k] * src2[n - k];
+        }
+        dst[n] = hpm_dsp_sw_sat_q31(sum >> 31);
+    }
+    return 0;
+}
+
+int32_t riscv_dsp_conv_partial_q7(q7_t *src1, uint32_t len1, q7_t *src2, uint32_t len2, q7_t *dst,
+                                  uint32_t startindex, uint32_t size)
+{
+    if ((startindex + size) > (len1 + len2 - 1)) {
+        return -1;
+    }
+    for (uint32_t n = startindex; n < startindex + size; n++) {
+        HPM_DSP_SW_CONV_RANGE(n, len1, len2, kmin, kmax);
+        q31_t sum = 0;
+        for (uint32_t k = kmin; k <= kmax; k++) {
+            sum += (q31_t)src1[k] * src2[n - k];
+        }
+        dst[n] = hpm_dsp_sw_sat_q7(sum >> 7);
+    }
+    return 0;
+}
+
+/*
+ * Correlation, 2 * max(len1, len2) - 1 samples. The lags from -(len2 - 1) to len1 - 1 are
+ * stored in order, aligned to the end of dst when len1 >= len2 and to the start in reverse
+ * lag order otherwise; the remaining samples are zero.
+ */
+#define HPM_DSP_SW_CORR(type, acc_type, src1, len1, src2, len2, dst, out)                  \
+    do {                                                                                    \
+        const type *a = (src1);                                                             \
+        const type *b = (src2);                                                             \
+        uint32_t la = (len1);                                                               \
+        uint32_t lb = (len2);                                                               \
+        uint32_t total = (la >= lb) ? (2 * la - 1) : (2 * lb - 1);                          \
+        uint32_t count;                                                                     \
+        uint32_t first;                                                                     \
+        int32_t step;                                                                       \
+        if (la >= lb) {                                                                     \
+            first = la - lb;                                                                \
+            step = 1;                                                                       \
+        } else {                                                                            \
+            a = (src2);                                                                     \
+            b = (src1);                                                                     \
+            la = (len2);                                                                    \
+            lb = (len1);                                                                    \
+            first = la + lb - 2;                                                            \
+            step = -1;                                                                      \
+        }                                                                                   \
+        count = la + lb - 1;                                                                \
+        for (uint32_t i = 0; i < total; i++) {                                              \
+            (dst)[i] = 0;                                                                   \
+        }                                                                                   \
+        for (uint32_t i = 0; i < count; i++) {                                              \
+            acc_type sum = 0;                                                               \
+            /* sum(a[j] * b[lb - 1 - i + j]) */                                             \
+            uint32_t jmin = (i >= lb) ? (i - lb + 1) : 0;                                   \
+            uint32_t jmax = (i < la) ? i : (la - 1);                                        \
+            for (uint32_t j = jmin; j <= jmax; j++) {                                       \
+                sum += (acc_type)a[j] * b[lb - 1 - i + j];                                  \
+            }                                                                               \
+            (dst)[(int32_t)first + step * (int32_t)i] = out(sum);                           \
+        }                                                                                   \
+    } while (0)
+
+#define HPM_DSP_SW_CORR_OUT_F32(x) (x)
+#define HPM_DSP_SW_CORR_OUT_Q15(x) hpm_dsp_sw_sat64_q15((x) >> 15)
+#define HPM_DSP_SW_CORR_OUT_Q31(x) hpm_dsp_sw_sat_q31((x) >> 31)
+#define HPM_DSP_SW_CORR_OUT_Q7(x)  hpm_dsp_sw_sat_q7((x) >> 7)
+
+void riscv_dsp_corr_f32(float32_t *src1, uint32_t len1, float32_t *src2, uint32_t len2, float32_t *dst)
+{
+    HPM_DSP_SW_CORR(float32_t, float32_t, src1, len1, src2, len2, dst, HPM_DSP_SW_CORR_OUT_F32);
+}
+
+void riscv_dsp_corr_q15(q15_t *src1, uint32_t len1, q15_t *src2, uint32_t len2, q15_t *dst)
+{
+    HPM_DSP_SW_CORR(q15_t, q63_t, src1, len1, src2, len2, dst, HPM_DSP_SW_CORR_OUT_Q15);
+}
+
+void riscv_dsp_corr_q31(q31_t *src1, uint32_t len1, q31_t *src2, uint32_t len2, q31_t *dst)
+{
+    HPM_DSP_SW_CORR(q31_t, q63_t, src1, len1, src2, len2, dst, HPM_DSP_SW_CORR_OUT_Q31);
+}
+
+void riscv_dsp_corr_q7(q7_t *src1, uint32_t len1, q7_t *src2, uint32_t len2, q7_t *dst)
+{
+    HPM_DSP_SW_CORR(q7_t, q31_t, src1, len1, src2, len2, dst, HPM_DSP_SW_CORR_OUT_Q7);
+}
+
+/*
+ * Biquad cascade, direct form I. Every stage has the coefficients {b0, b1, b2, a1, a2} and
+ * the state {x[n - 1], x[n - 2], y[n - 1], y[n - 2]}:
+ * y[n] = b0 * x[n] + b1 * x[n - 1] + b2 * x[n - 2] + a1 * y[n - 1] + a2 * y[n - 2]
+ * The feedback coefficients are stored negated, the fixed-point sums are shifted left by
+ * the instance shift, for coefficients scaled down by 2^shift.
+ */
+void riscv_dsp_bq_df1_f32(const riscv_dsp_bq_df1_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
+{
+    const float32_t *in = src;
+
+    for (uint32_t s = 0; s < instance->nstage; s++) {
+        const float32_t *c = &instance->coeff[5 * s];
+        float32_t *st = &instance->state[4 * s];
+        float32_t x1 = st[0], x2 = st[1], y1 = st[2], y2 = st[3];
+
+        for (uint32_t n = 0; n < size; n++) {
+            float32_t x = in[n];
+            float32_t y = c[0] * x + c[1] * x1 + c[2] * x2 + c[3] * y1 + c[4] * y2;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            dst[n] = y;
+        }
+        st[0] = x1;
+        st[1] = x2;
+        st[2] = y1;
+        st[3] = y2;
+        in = dst;
+    }
+}
+
+void riscv_dsp_bq_df1_q31(const riscv_dsp_bq_df1_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    const q31_t *in = src;
+    int32_t rshift = 31 - instance->shift;
+
+    for (uint32_t s = 0; s < instance->nstage; s++) {
+        const q31_t *c = &instance->coeff[5 * s];
+        q31_t *st = &instance->state[4 * s];
+        q31_t x1 = st[0], x2 = st[1], y1 = st[2], y2 = st[3];
+
+        for (uint32_t n = 0; n < size; n++) {
+            q31_t x = in[n];
+            q63_t acc = (q63_t)c[0] * x + (q63_t)c[1] * x1 + (q63_t)c[2] * x2 + (q63_t)c[3] * y1 + (q63_t)c[4] * y2;
+            q31_t y = hpm_dsp_sw_sat_q31(acc >> rshift);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            dst[n] = y;
+        }
+        st[0] = x1;
+        st[1] = x2;
+        st[2] = y1;
+        st[3] = y2;
+        in = dst;
+    }
+}
+
+/* the high words of the products are accumulated in Q2.30 */
+void riscv_dsp_bq_df1_fast_q31(const riscv_dsp_bq_df1_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    const q31_t *in = src;
+    int32_t lshift = instance->shift + 1;
+
+    for (uint32_t s = 0; s < instance->nstage; s++) {
+        const q31_t *c = &instance->coeff[5 * s];
+        q31_t *st = &instance->state[4 * s];
+        q31_t x1 = st[0], x2 = st[1], y1 = st[2], y2 = st[3];
+
+        for (uint32_t n = 0; n < size; n++) {
+            q31_t x = in[n];
+            uint32_t acc = (uint32_t)(((q63_t)c[0] * x) >> 32) + (uint32_t)(((q63_t)c[1] * x1) >> 32) +
+                           (uint32_t)(((q63_t)c[2] * x2) >> 32) + (uint32_t)(((q63_t)c[3] * y1) >> 32) +
+                           (uint32_t)(((q63_t)c[4] * y2) >> 32);
+            q31_t y = hpm_dsp_sw_sat_q31(hpm_dsp_sw_shift_q63((q31_t)acc, lshift));
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            dst[n] = y;
+        }
+        st[0] = x1;
+        st[1] = x2;
+        st[2] = y1;
+        st[3] = y2;
+        in = dst;
+    }
+}
+
+void riscv_dsp_bq_df1_q15(const riscv_dsp_bq_df1_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
+{
+    const q15_t *in = src;
+    int32_t rshift = 15 - instance->shift;
+
+    for (uint32_t s = 0; s < instance->nstage; s++) {
+        const q15_t *c = &instance->coeff[5 * s];
+        q15_t *st = &instance->state[4 * s];
+        q15_t x1 = st[0], x2 = st[1], y1 = st[2], y2 = st[3];
+
+        for (uint32_t n = 0; n < size; n++) {
+            q15_t x = in[n];
+            q63_t acc = (q63_t)((q31_t)c[0] * x) + (q31_t)c[1] * x1 + (q31_t)c[2] * x2 + (q31_t)c[3] * y1 +
+                        (q31_t)c[4] * y2;
+            q15_t y = hpm_dsp_sw_sat64_q15(acc >> rshift);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            dst[n] = y;
+        }
+        st[0] = x1;
+        st[1] = x2;
+        st[2] = y1;
+        st[3] = y2;
+        in = dst;
+    }
+}
+
+/* 32-bit accumulator, it wraps if the sum leaves the Q2.30 range */
+void riscv_dsp_bq_df1_fast_q15(const riscv_dsp_bq_df1_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
+{
+    const q15_t *in = src;
+    int32_t rshift = 15 - instance->shift;
+
+    for (uint32_t s = 0; s < instance->nstage; s++) {
+        const q15_t *c = &instance->coeff[5 * s];
+        q15_t *st = &instance->state[4 * s];
+        q15_t x1 = st[0], x2 = st[1], y1 = st[2], y2 = st[3];
+
+        for (uint32_t n = 0; n < size; n++) {
+            q15_t x = in[n];
+            uint32_t acc = (uint32_t)((q31_t)c[0] * x) + (uint32_t)((q31_t)c[1] * x1) +
+                           (uint32_t)((q31_t)c[2] * x2) + (uint32_t)((q31_t)c[3] * y1) +
+                           (uint32_t)((q31_t)c[4] * y2);
+            q15_t y = hpm_dsp_sw_sat_q15((q31_t)acc >> rshift);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            dst[n] = y;
+        }
+        st[0] = x1;
+        st[1] = x2;
+        st[2] = y1;
+        st[3] = y2;
+        in = dst;
+    }
+}
+
+/* (Q1.63 state * Q1.31 coefficient) >> 32, without losing the low word of the state */
+static inline q63_t hpm_dsp_sw_mul_32x64(q63_t x, q31_t y)
+{
+    return ((q63_t)((x & 0xFFFFFFFF) * (q63_t)y) >> 32) + (x >> 32) * y;
+}
+
+/* the output history is kept in Q1.63 */
+void riscv_dsp_bq_df1_32x64_q31(const riscv_dsp_bq_df1_32x64_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    const q31_t *in = src;
+    int32_t lshift = instance->shift + 1;
+
+    for (uint32_t s = 0; s < instance->nstage; s++) {
+        const q31_t *c = &instance->coeff[5 * s];
+        q63_t *st = &instance->state[4 * s];
+        q31_t x1 = (q31_t)st[0], x2 = (q31_t)st[1];
+        q63_t y1 = st[2], y2 = st[3];
+
+        for (uint32_t n = 0; n < size; n++) {
+            q31_t x = in[n];
+            q63_t acc = (q63_t)c[0] * x + (q63_t)c[1] * x1 + (q63_t)c[2] * x2;
+            q63_t y;
+            acc += hpm_dsp_sw_mul_32x64(y1, c[3]);
+            acc += hpm_dsp_sw_mul_32x64(y2, c[4]);
+            y = (q63_t)((uint64_t)acc << lshift);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            dst[n] = (q31_t)(y >> 32);
+        }
+        st[0] = x1;
+        st[1] = x2;
+        st[2] = y1;
+        st[3] = y2;
+        in = dst;
+    }
+}
+
+/*
+ * Biquad cascade, direct form II transposed, with the coefficients of direct form I and
+ * the state {d1, d2} per stage:
+ * y[n] = b0 * x[n] + d1, d1 = b1 * x[n] + a1 * y[n] + d2, d2 = b2 * x[n] + a2 * y[n]
+ */
+#define HPM_DSP_SW_BQ_DF2T(type, instance, src, dst, size)                  \
+    do {                                                                    \
+        const type *in = (src);                                             \
+        for (uint32_t s = 0; s < (instance)->nstage; s++) {                 \
+            const type *c = &(instance)->coeff[5 * s];                      \
+            type *st = &(instance)->state[2 * s];                           \
+            type d1 = st[0], d2 = st[1];                                    \
+            for (uint32_t n = 0; n < (size); n++) {                         \
+                type x = in[n];                                             \
+                type y = c[0] * x + d1;                                     \
+                d1 = c[1] * x + c[3] * y + d2;                              \
+                d2 = c[2] * x + c[4] * y;                                   \
+                (dst)[n] = y;                                               \
+            }                                                               \
+            st[0] = d1;                                                     \
+            st[1] = d2;                                                     \
+            in = (dst);                                                     \
+        }                                                                   \
+    } while (0)
+
+void riscv_dsp_bq_df2T_f32(const riscv_dsp_bq_df2T_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
+{
+    HPM_DSP_SW_BQ_DF2T(float32_t, instance, src, dst, size);
+}
+
+void riscv_dsp_bq_df2T_f64(const riscv_dsp_bq_df2T_f64_t *instance, float64_t *src, float64_t *dst, uint32_t size)
+{
+    HPM_DSP_SW_BQ_DF2T(float64_t, instance, src, dst, size);
+}
+
+/* interleaved {left, right} samples, the state of a stage is {d1 left, d2 left, d1 right, d2 right} */
+void riscv_dsp_bq_stereo_df2T_f32(const riscv_dsp_bq_stereo_df2T_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
+{
+    const float32_t *in = src;
+
+    for (uint32_t s = 0; s < instance->nstage; s++) {
+        const float32_t *c = &instance->coeff[5 * s];
+        float32_t *st = &instance->state[4 * s];
+        float32_t d1l = st[0], d2l = st[1], d1r = st[2], d2r = st[3];
+
+        for (uint32_t n = 0; n < size; n++) {
+            float32_t xl = in[2 * n];
+            float32_t xr = in[2 * n + 1];
+            float32_t yl = c[0] * xl + d1l;
+            float32_t yr = c[0] * xr + d1r;
+            d1l = c[1] * xl + c[3] * yl + d2l;
+            d1r = c[1] * xr + c[3] * yr + d2r;
+            d2l = c[2] * xl + c[4] * yl;
+            d2r = c[2] * xr + c[4] * yr;
+            dst[2 * n] = yl;
+            dst[2 * n + 1] = yr;
+        }
+        st[0] = d1l;
+        st[1] = d2l;
+        st[2] = d1r;
+        st[3] = d2r;
+        in = dst;
+    }
+}
+
+/*
+ * Lattice IIR with ladder outputs. rcoeff = {k(N), ..., k(1)}, lcoeff = {v(N), ..., v(0)}
+ * and state holds nstage history samples in front of the current block.
+ */
+void riscv_dsp_liir_f32(const riscv_dsp_liir_f32_t *instance, float32_t *src, float32_t *dst, uint32_t size)
+{
+    uint32_t stages = instance->nstage;
+    float32_t *state = instance->state;
+
+    for (uint32_t n = 0; n < size; n++) {
+        float32_t *g = &state[n];
+        const float32_t *k = instance->rcoeff;
+        const float32_t *v = instance->lcoeff;
+        float32_t f = src[n];
+        float32_t acc = 0.0f;
+
+        for (uint32_t m = 0; m < stages; m++) {
+            float32_t f_next = f - k[m] * g[m];
+            float32_t g_next = f_next * k[m] + g[m];
+            acc += g_next * v[m];
+            g[m] = g_next;
+            f = f_next;
+        }
+        acc += f * v[stages];
+        g[stages] = f;
+        dst[n] = acc;
+    }
+    memmove(state, &state[size], stages * sizeof(float32_t));
+}
+
+void riscv_dsp_liir_q31(const riscv_dsp_liir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    uint32_t stages = instance->nstage;
+    q31_t *state = instance->state;
+
+    for (uint32_t n = 0; n < size; n++) {
+        q31_t *g = &state[n];
+        const q31_t *k = instance->rcoeff;
+        const q31_t *v = instance->lcoeff;
+        q31_t f = src[n];
+        q63_t acc = 0;
+
+        for (uint32_t m = 0; m < stages; m++) {
+            q31_t f_next = hpm_dsp_sw_sat_q31((q63_t)f - (((q63_t)k[m] * g[m]) >> 31));
+            q31_t g_next = hpm_dsp_sw_sat_q31((((q63_t)f_next * k[m]) >> 31) + g[m]);
+            acc += (q63_t)g_next * v[m];
+            g[m] = g_next;
+            f = f_next;
+        }
+        acc += (q63_t)f * v[stages];
+        g[stages] = f;
+        dst[n] = hpm_dsp_sw_sat_q31(acc >> 31);
+    }
+    memmove(state, &state[size], stages * sizeof(q31_t));
+}
+
+/* the same arithmetic, the reference has no faster form of it */
+void riscv_dsp_liir_fast_q31(const riscv_dsp_liir_q31_t *instance, q31_t *src, q31_t *dst, uint32_t size)
+{
+    riscv_dsp_liir_q31(instance, src, dst, size);
+}
+
+void riscv_dsp_liir_q15(const riscv_dsp_liir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
+{
+    uint32_t stages = instance->nstage;
+    q15_t *state = instance->state;
+
+    for (uint32_t n = 0; n < size; n++) {
+        q15_t *g = &state[n];
+        const q15_t *k = instance->rcoeff;
+        const q15_t *v = instance->lcoeff;
+        q15_t f = src[n];
+        q63_t acc = 0;
+
+        for (uint32_t m = 0; m < stages; m++) {
+            q15_t f_next = hpm_dsp_sw_sat_q15(f - (((q31_t)k[m] * g[m]) >> 15));
+            q15_t g_next = hpm_dsp_sw_sat_q15((((q31_t)f_next * k[m]) >> 15) + g[m]);
+            acc += (q31_t)g_next * v[m];
+            g[m] = g_next;
+            f = f_next;
+        }
+        acc += (q31_t)f * v[stages];
+        g[stages] = f;
+        dst[n] = hpm_dsp_sw_sat64_q15(acc >> 15);
+    }
+    memmove(state, &state[size], stages * sizeof(q15_t));
+}
+
+void riscv_dsp_liir_fast_q15(const riscv_dsp_liir_q15_t *instance, q15_t *src, q15_t *dst, uint32_t size)
+{
+    riscv_dsp_liir_q15(instance, src, dst, size);
+}
@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "hpm_dsp_sw_common.h"
+#include "riscv_dsp_matrix_math.h"
+
+/* Matrices are stored row by row */
+
+/* Addition and subtraction */
+void riscv_dsp_mat_add_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] + src2[i];
+    }
+}
+
+void riscv_dsp_mat_add_f64(const float64_t *src1, const float64_t *src2, float64_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] + src2[i];
+    }
+}
+
+void riscv_dsp_mat_add_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q15((q31_t)src1[i] + src2[i]);
+    }
+}
+
+void riscv_dsp_mat_add_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31((q63_t)src1[i] + src2[i]);
+    }
+}
+
+void riscv_dsp_mat_sub_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] - src2[i];
+    }
+}
+
+void riscv_dsp_mat_sub_f64(const float64_t *src1, const float64_t *src2, float64_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src1[i] - src2[i];
+    }
+}
+
+void riscv_dsp_mat_sub_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q15((q31_t)src1[i] - src2[i]);
+    }
+}
+
+void riscv_dsp_mat_sub_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31((q63_t)src1[i] - src2[i]);
+    }
+}
+
+/* Inverse, Gauss-Jordan elimination on src while dst starts as the identity */
+#define HPM_DSP_SW_MAT_INV(type, src, dst, size)                                \
+    do {                                                                        \
+        for (uint32_t r = 0; r < (size); r++) {                                 \
+            for (uint32_t c = 0; c < (size); c++) {                             \
+                (dst)[r * (size) + c] = (r == c) ? (type)1 : (type)0;           \
+            }                                                                   \
+        }                                                                       \
+        for (uint32_t p = 0; p < (size); p++) {                                 \
+            type pivot;                                                         \
+            if ((src)[p * (size) + p] == (type)0) {                             \
+                uint32_t r = p + 1;                                             \
+                while ((r < (size)) && ((src)[r * (size) + p] == (type)0)) {    \
+                    r++;                                                        \
+                }                                                               \
+                if (r == (size)) {                                              \
+                    return -1;                                                  \
+                }                                                               \
+                for (uint32_t c = 0; c < (size); c++) {                         \
+                    type t = (src)[p * (size) + c];                             \
+                    (src)[p * (size) + c] = (src)[r * (size) + c];              \
+                    (src)[r * (size) + c] = t;                                  \
+                    t = (dst)[p * (size) + c];                                  \
+                    (dst)[p * (size) + c] = (dst)[r * (size) + c];              \
+                    (dst)[r * (size) + c] = t;                                  \
+                }                                                               \
+            }                                                                   \
+            pivot = (src)[p * (size) + p];                                      \
+            for (uint32_t c = 0; c < (size); c++) {                             \
+                (src)[p * (size) + c] /= pivot;                                 \
+                (dst)[p * (size) + c] /= pivot;                                 \
+            }                                                                   \
+            for (uint32_t r = 0; r < (size); r++) {                             \
+                type f = (src)[r * (size) + p];                                 \
+                if ((r == p) || (f == (type)0)) {                               \
+                    continue;                                                   \
+                }                                                               \
+                for (uint32_t c = 0; c < (size); c++) {                         \
+                    (src)[r * (size) + c] -= f * (src)[p * (size) + c];         \
+                    (dst)[r * (size) + c] -= f * (dst)[p * (size) + c];         \
+                }                                                               \
+            }                                                                   \
+        }                                                                       \
+        return 0;                                                               \
+    } while (0)
+
+int32_t riscv_dsp_mat_inv_f32(float32_t *src, float32_t *dst, uint32_t size)
+{
+    HPM_DSP_SW_MAT_INV(float32_t, src, dst, size);
+}
+
+int32_t riscv_dsp_mat_inv_f64(float64_t *src, float64_t *dst, uint32_t size)
+{
+    HPM_DSP_SW_MAT_INV(float64_t, src, dst, size);
+}
+
+/* Multiplication, dst[row, col2] = src1[row, col] * src2[col, col2] */
+void riscv_dsp_mat_mul_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t row, uint32_t col, uint32_t col2)
+{
+    for (uint32_t r = 0; r < row; r++) {
+        for (uint32_t c = 0; c < col2; c++) {
+            float32_t sum = 0.0f;
+            for (uint32_t k = 0; k < col; k++) {
+                sum += src1[r * col + k] * src2[k * col2 + c];
+            }
+            dst[r * col2 + c] = sum;
+        }
+    }
+}
+
+void riscv_dsp_mat_mul_f64(const float64_t *src1, const float64_t *src2, float64_t *dst, uint32_t row, uint32_t col, uint32_t col2)
+{
+    for (uint32_t r = 0; r < row; r++) {
+        for (uint32_t c = 0; c < col2; c++) {
+            float64_t sum = 0.0;
+            for (uint32_t k = 0; k < col; k++) {
+                sum += src1[r * col + k] * src2[k * col2 + c];
+            }
+            dst[r * col2 + c] = sum;
+        }
+    }
+}
+
+void riscv_dsp_mat_mul_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col, uint32_t col2)
+{
+    for (uint32_t r = 0; r < row; r++) {
+        for (uint32_t c = 0; c < col2; c++) {
+            q63_t sum = 0;
+            for (uint32_t k = 0; k < col; k++) {
+                sum += (q31_t)src1[r * col + k] * src2[k * col2 + c];
+            }
+            dst[r * col2 + c] = hpm_dsp_sw_sat64_q15(sum >> 15);
+        }
+    }
+}
+
+/* 32-bit accumulator, it wraps if the sum leaves the Q2.30 range */
+void riscv_dsp_mat_mul_fast_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col, uint32_t col2)
+{
+    for (uint32_t r = 0; r < row; r++) {
+        for (uint32_t c = 0; c < col2; c++) {
+            uint32_t sum = 0;
+            for (uint32_t k = 0; k < col; k++) {
+                sum += (uint32_t)((q31_t)src1[r * col + k] * src2[k * col2 + c]);
+            }
+            dst[r * col2 + c] = hpm_dsp_sw_sat_q15((q31_t)sum >> 15);
+        }
+    }
+}
+
+void riscv_dsp_mat_mul_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col, uint32_t col2)
+{
+    for (uint32_t r = 0; r < row; r++) {
+        for (uint32_t c = 0; c < col2; c++) {
+            q63_t sum = 0;
+            for (uint32_t k = 0; k < col; k++) {
+                sum += (q63_t)src1[r * col + k] * src2[k * col2 + c];
+            }
+            dst[r * col2 + c] = hpm_dsp_sw_sat_q31(sum >> 31);
+        }
+    }
+}
+
+/* Q2.30 products in a 32-bit accumulator, see the note in riscv_dsp_matrix_math.h */
+void riscv_dsp_mat_mul_fast_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col, uint32_t col2)
+{
+    for (uint32_t r = 0; r < row; r++) {
+        for (uint32_t c = 0; c < col2; c++) {
+            uint32_t sum = 0;
+            for (uint32_t k = 0; k < col; k++) {
+                sum += (uint32_t)(((q63_t)src1[r * col + k] * src2[k * col2 + c]) >> 32);
+            }
+            dst[r * col2 + c] = hpm_dsp_sw_sat_q31((q63_t)(q31_t)sum * 2);
+        }
+    }
+}
+
+void riscv_dsp_mat_mul_q7(const q7_t *src1, const q7_t *src2, q7_t *dst, uint32_t row, uint32_t col, uint32_t col2)
+{
+    for (uint32_t r = 0; r < row; r++) {
+        for (uint32_t c = 0; c < col2; c++) {
+            q31_t sum = 0;
+            for (uint32_t k = 0; k < col; k++) {
+                sum += (q31_t)src1[r * col + k] * src2[k * col2 + c];
+            }
+            dst[r * col2 + c] = hpm_dsp_sw_sat_q7(sum >> 7);
+        }
+    }
+}
+
+void riscv_dsp_mat_mul_vxm_q7(const q7_t *src1, const q7_t *src2, q7_t *dst, uint32_t col, uint32_t col2)
+{
+    riscv_dsp_mat_mul_q7(src1, src2, dst, 1, col, col2);
+}
+
+/* Matrix by vector, dst[row] = src1[row, col] * src2[col] */
+void riscv_dsp_mat_mul_mxv_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t row, uint32_t col)
+{
+    riscv_dsp_mat_mul_f32(src1, src2, dst, row, col, 1);
+}
+
+void riscv_dsp_mat_mul_mxv_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col)
+{
+    riscv_dsp_mat_mul_q15(src1, src2, dst, row, col, 1);
+}
+
+void riscv_dsp_mat_mul_mxv_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col)
+{
+    riscv_dsp_mat_mul_q31(src1, src2, dst, row, col, 1);
+}
+
+void riscv_dsp_mat_mul_mxv_q7(const q7_t *src1, const q7_t *src2, q7_t *dst, uint32_t row, uint32_t col)
+{
+    riscv_dsp_mat_mul_q7(src1, src2, dst, row, col, 1);
+}
+
+/* Square of a matrix, computed in blocks of four rows and columns */
+int32_t riscv_dsp_mat_pwr2_cache_f64(const float64_t *src, float64_t *dst, uint32_t size)
+{
+    if ((size == 0) || ((size % 4) != 0)) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < size * size; i++) {
+        dst[i] = 0.0;
+    }
+    for (uint32_t rb = 0; rb < size; rb += 4) {
+        for (uint32_t kb = 0; kb < size; kb += 4) {
+            for (uint32_t r = rb; r < rb + 4; r++) {
+                for (uint32_t k = kb; k < kb + 4; k++) {
+                    float64_t a = src[r * size + k];
+                    for (uint32_t c = 0; c < size; c++) {
+                        dst[r * size + c] += a * src[k * size + c];
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/* Scale: dst = (src * scale_fract) >> (N - shift) */
+void riscv_dsp_mat_scale_f32(const float32_t *src, float32_t scale, float32_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = src[i] * scale;
+    }
+}
+
+void riscv_dsp_mat_scale_q15(const q15_t *src, q15_t scale_fract, int32_t shift, q15_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+    int32_t rshift = 15 - shift;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat64_q15(((q63_t)src[i] * scale_fract) >> rshift);
+    }
+}
+
+void riscv_dsp_mat_scale_q31(const q31_t *src, q31_t scale_fract, int32_t shift, q31_t *dst, uint32_t row, uint32_t col)
+{
+    uint32_t size = row * col;
+    int32_t rshift = 31 - shift;
+
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] = hpm_dsp_sw_sat_q31(((q63_t)src[i] * scale_fract) >> rshift);
+    }
+}
+
+/* Transpose, dst[col, row] */
+#define HPM_DSP_SW_MAT_TRANS(src, dst, row, col)                \
+    do {                                                        \
+        for (uint32_t r = 0; r < (row); r++) {                  \
+            for (uint32_t c = 0; c < (col); c++) {              \
+                (dst)[c * (row) + r] = (src)[r * (col) + c];    \
+            }                                                   \
+        }                                                       \
+    } while (0)
+
+void riscv_dsp_mat_trans_f32(const float32_t *src, float32_t *dst, uint32_t row, uint32_t col)
+{
+    HPM_DSP_SW_MAT_TRANS(src, dst, row, col);
+}
+
+void riscv_dsp_mat_trans_f64(const float64_t *src, float64_t *dst, uint32_t row, uint32_t col)
+{
+    HPM_DSP_SW_MAT_TRANS(src, dst, row, col);
+}
+
+void riscv_dsp_mat_trans_q15(const q15_t *src, q15_t *dst, uint32_t row, uint32_t col)
+{
+    HPM_DSP_SW_MAT_TRANS(src, dst, row, col);
+}
+
+void riscv_dsp_mat_trans_q31(const q31_t *src, q31_t *dst, uint32_t row, uint32_t col)
+{
+    HPM_DSP_SW_MAT_TRANS(src, dst, row, col);
+}
+
+void riscv_dsp_mat_trans_u8(const uint8_t *src, uint8_t *dst, uint32_t row, uint32_t col)
+{
+    HPM_DSP_SW_MAT_TRANS(src, dst, row, col);
+}
+
+void riscv_dsp_mat_trans_q7(const q7_t *src, q7_t *dst, uint32_t row, uint32_t col)
+{
+    HPM_DSP_SW_MAT_TRANS(src, dst, row, col);
+}
+
+/* Outer product, dst[size1, size2] = src1[size1, 1] * src2[1, size2] */
+void riscv_dsp_mat_oprod_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t size1, uint32_t size2)
+{
+    for (uint32_t r = 0; r < size1; r++) {
+        for (uint32_t c = 0; c < size2; c++) {
+            dst[r * size2 + c] = hpm_dsp_sw_sat_q31(((q63_t)src1[r] * src2[c]) >> 31);
+        }
+    }
+}
+
+/* Complex multiplication, the elements are interleaved {re, im} */
+void riscv_dsp_cmat_mul_f32(const float32_t *src1, const float32_t *src2, float32_t *dst, uint32_t row, uint32_t col, uint32_t col2)
+{
+    for (uint32_t r = 0; r < row; r++) {
+        for (uint32_t c = 0; c < col2; c++) {
+            float32_t re = 0.0f;
+            float32_t im = 0.0f;
+            for (uint32_t k = 0; k < col; k++) {
+                const float32_t *a = &src1[2 * (r * col + k)];
+                const float32_t *b = &src2[2 * (k * col2 + c)];
+                re += a[0] * b[0] - a[1] * b[1];
+                im += a[0] * b[1] + a[1] * b[0];
+            }
+            dst[2 * (r * col2 + c)] = re;
+            dst[2 * (r * col2 + c) + 1] = im;
+        }
+    }
+}
+
+void riscv_dsp_cmat_mul_q15(const q15_t *src1, const q15_t *src2, q15_t *dst, uint32_t row, uint32_t col, uint32_t col2)
+{
+    for (uint32_t r = 0; r < row; r++) {
+        for (uint32_t c = 0; c < col2; c++) {
+            q63_t re = 0;
+            q63_t im = 0;
+            for (uint32_t k = 0; k < col; k++) {
+                const q15_t *a = &src1[2 * (r * col + k)];
+                const q15_t *b = &src2[2 * (k * col2 + c)];
+                re += (q31_t)a[0] * b[0] - (q63_t)((q31_t)a[1] * b[1]);
+                im += (q31_t)a[0] * b[1] + (q63_t)((q31_t)a[1] * b[0]);
+            }
+            dst[2 * (r * col2 + c)] = hpm_dsp_sw_sat64_q15(re >> 15);
+            dst[2 * (r * col2 + c) + 1] = hpm_dsp_sw_sat64_q15(im >> 15);
+        }
+    }
+}
+
+void riscv_dsp_cmat_mul_q31(const q31_t *src1, const q31_t *src2, q31_t *dst, uint32_t row, uint32_t col, uint32_t col2)
+{
+    for (uint32_t r = 0; r < row; r++) {
+        for (uint32_t c = 0; c < col2; c++) {
+            q63_t re = 0;
+            q63_t im = 0;
+            for (uint32_t k = 0; k < col; k++) {
+                const q31_t *a = &src1[2 * (r * col + k)];
+                const q31_t *b = &src2[2 * (k * col2 + c)];
+                re += (q63_t)a[0] * b[0] - (q63_t)a[1] * b[1];
+                im += (q63_t)a[0] * b[1] + (q63_t)a[1] * b[0];
+            }
+            dst[2 * (r * col2 + c)] = hpm_dsp_sw_sat_q31(re >> 31);
+            dst[2 * (r * col2 + c) + 1] = hpm_dsp_sw_sat_q31(im >> 31);
+        }
+    }
+}
@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "hpm_dsp_sw_common.h"
+#include "riscv_dsp_statistics_math.h"
+
+/* Maximum and minimum, the index of the first match is returned */
+#define HPM_DSP_SW_SEARCH(type, src, size, index, better, value)   \
+    do {                                                            \
+        type res = value(src[0]);                                   \
+        uint32_t pos = 0;                                           \
+        for (uint32_t i = 1; i < (size); i++) {                     \
+            type v = value(src[i]);                                 \
+            if (v better res) {                                     \
+                res = v;                                            \
+                pos = i;                                            \
+            }                                                       \
+        }                                                           \
+        if ((index) != NULL) {                                      \
+            *(index) = pos;                                         \
+        }                                                           \
+        return res;                                                 \
+    } while (0)
+
+#define HPM_DSP_SW_PLAIN(x) (x)
+
+static inline float32_t hpm_dsp_sw_abs_f32(float32_t x)
+{
+    return fabsf(x);
+}
+
+static inline q31_t hpm_dsp_sw_abs_q31(q31_t x)
+{
+    return (x == HPM_DSP_SW_Q31_MIN) ? HPM_DSP_SW_Q31_MAX : ((x < 0) ? -x : x);
+}
+
+static inline q15_t hpm_dsp_sw_abs_q15(q15_t x)
+{
+    return hpm_dsp_sw_sat_q15((x < 0) ? -(q31_t)x : x);
+}
+
+static inline q7_t hpm_dsp_sw_abs_q7(q7_t x)
+{
+    return hpm_dsp_sw_sat_q7((x < 0) ? -(q31_t)x : x);
+}
+
+float32_t riscv_dsp_max_f32(const float32_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(float32_t, src, size, index, >, HPM_DSP_SW_PLAIN);
+}
+
+float32_t riscv_dsp_absmax_f32(const float32_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(float32_t, src, size, index, >, hpm_dsp_sw_abs_f32);
+}
+
+float32_t riscv_dsp_max_val_f32(const float32_t *src, uint32_t size)
+{
+    float32_t res = src[0];
+
+    for (uint32_t i = 1; i < size; i++) {
+        res = (src[i] > res) ? src[i] : res;
+    }
+    return res;
+}
+
+q15_t riscv_dsp_max_q15(const q15_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q15_t, src, size, index, >, HPM_DSP_SW_PLAIN);
+}
+
+q15_t riscv_dsp_absmax_q15(const q15_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q15_t, src, size, index, >, hpm_dsp_sw_abs_q15);
+}
+
+q31_t riscv_dsp_max_q31(const q31_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q31_t, src, size, index, >, HPM_DSP_SW_PLAIN);
+}
+
+q31_t riscv_dsp_absmax_q31(const q31_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q31_t, src, size, index, >, hpm_dsp_sw_abs_q31);
+}
+
+q7_t riscv_dsp_max_q7(const q7_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q7_t, src, size, index, >, HPM_DSP_SW_PLAIN);
+}
+
+q7_t riscv_dsp_absmax_q7(const q7_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q7_t, src, size, index, >, hpm_dsp_sw_abs_q7);
+}
+
+uint8_t riscv_dsp_max_u8(const uint8_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(uint8_t, src, size, index, >, HPM_DSP_SW_PLAIN);
+}
+
+float32_t riscv_dsp_min_f32(const float32_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(float32_t, src, size, index, <, HPM_DSP_SW_PLAIN);
+}
+
+float32_t riscv_dsp_absmin_f32(const float32_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(float32_t, src, size, index, <, hpm_dsp_sw_abs_f32);
+}
+
+q15_t riscv_dsp_min_q15(const q15_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q15_t, src, size, index, <, HPM_DSP_SW_PLAIN);
+}
+
+q15_t riscv_dsp_absmin_q15(const q15_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q15_t, src, size, index, <, hpm_dsp_sw_abs_q15);
+}
+
+q31_t riscv_dsp_min_q31(const q31_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q31_t, src, size, index, <, HPM_DSP_SW_PLAIN);
+}
+
+q31_t riscv_dsp_absmin_q31(const q31_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q31_t, src, size, index, <, hpm_dsp_sw_abs_q31);
+}
+
+q7_t riscv_dsp_min_q7(const q7_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q7_t, src, size, index, <, HPM_DSP_SW_PLAIN);
+}
+
+q7_t riscv_dsp_absmin_q7(const q7_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(q7_t, src, size, index, <, hpm_dsp_sw_abs_q7);
+}
+
+uint8_t riscv_dsp_min_u8(const uint8_t *src, uint32_t size, uint32_t *index)
+{
+    HPM_DSP_SW_SEARCH(uint8_t, src, size, index, <, HPM_DSP_SW_PLAIN);
+}
+
+/* Mean, the sum is divided with truncation toward zero */
+float32_t riscv_dsp_mean_f32(const float32_t *src, uint32_t size)
+{
+    float32_t sum = 0.0f;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src[i];
+    }
+    return sum / (float32_t)size;
+}
+
+q15_t riscv_dsp_mean_q15(const q15_t *src, uint32_t size)
+{
+    q63_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src[i];
+    }
+    return (q15_t)(sum / (q63_t)size);
+}
+
+q31_t riscv_dsp_mean_q31(const q31_t *src, uint32_t size)
+{
+    q63_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src[i];
+    }
+    return (q31_t)(sum / (q63_t)size);
+}
+
+q7_t riscv_dsp_mean_q7(const q7_t *src, uint32_t size)
+{
+    q31_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src[i];
+    }
+    return (q7_t)(sum / (q31_t)size);
+}
+
+uint8_t riscv_dsp_mean_u8(const uint8_t *src, uint32_t size)
+{
+    uint32_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src[i];
+    }
+    return (uint8_t)(sum / size);
+}
+
+/* Power (sum of squares) */
+float32_t riscv_dsp_pwr_f32(const float32_t *src, uint32_t size)
+{
+    float32_t sum = 0.0f;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src[i] * src[i];
+    }
+    return sum;
+}
+
+q63_t riscv_dsp_pwr_q15(const q15_t *src, uint32_t size)
+{
+    q63_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += (q31_t)src[i] * src[i];
+    }
+    return sum;
+}
+
+q63_t riscv_dsp_pwr_q31(const q31_t *src, uint32_t size)
+{
+    q63_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += ((q63_t)src[i] * src[i]) >> 14;
+    }
+    return sum;
+}
+
+q31_t riscv_dsp_pwr_q7(const q7_t *src, uint32_t size)
+{
+    q31_t sum = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += (q31_t)src[i] * src[i];
+    }
+    return sum;
+}
+
+/* Root mean square */
+float32_t riscv_dsp_rms_f32(const float32_t *src, uint32_t size)
+{
+    return sqrtf(riscv_dsp_pwr_f32(src, size) / (float32_t)size);
+}
+
+q15_t riscv_dsp_rms_q15(const q15_t *src, uint32_t size)
+{
+    uint64_t mean = (uint64_t)riscv_dsp_pwr_q15(src, size) / size;
+
+    return hpm_dsp_sw_sat_q15((q31_t)hpm_dsp_sw_isqrt_u64(mean));
+}
+
+q31_t riscv_dsp_rms_q31(const q31_t *src, uint32_t size)
+{
+    uint64_t mean = (uint64_t)riscv_dsp_pwr_q31(src, size) / size;
+
+    if (mean >= ((uint64_t)1 << 48)) {
+        return HPM_DSP_SW_Q31_MAX;
+    }
+    return hpm_dsp_sw_sat_q31((q63_t)hpm_dsp_sw_isqrt_u64(mean << 14));
+}
+
+/* Variance and standard deviation, normalized by (size - 1) */
+float32_t riscv_dsp_var_f32(const float32_t *src, uint32_t size)
+{
+    float32_t mean;
+    float32_t sum = 0.0f;
+
+    if (size <= 1) {
+        return 0.0f;
+    }
+    mean = riscv_dsp_mean_f32(src, size);
+    for (uint32_t i = 0; i < size; i++) {
+        float32_t d = src[i] - mean;
+        sum += d * d;
+    }
+    return sum / (float32_t)(size - 1);
+}
+
+float32_t riscv_dsp_std_f32(const float32_t *src, uint32_t size)
+{
+    return sqrtf(riscv_dsp_var_f32(src, size));
+}
+
+/* Q30 result */
+q31_t riscv_dsp_var_q15(const q15_t *src, uint32_t size)
+{
+    q63_t sum = 0;
+    q63_t sum_sq = 0;
+    q63_t var;
+
+    if (size <= 1) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src[i];
+        sum_sq += (q31_t)src[i] * src[i];
+    }
+    var = (sum_sq - (sum * sum) / (q63_t)size) / (q63_t)(size - 1);
+    return hpm_dsp_sw_sat_q31(var);
+}
+
+/* Q48 result */
+q63_t riscv_dsp_var_q31(const q31_t *src, uint32_t size)
+{
+    q63_t mean;
+    q63_t sum = 0;
+
+    if (size <= 1) {
+        return 0;
+    }
+    mean = riscv_dsp_mean_q31(src, size);
+    for (uint32_t i = 0; i < size; i++) {
+        /* the difference takes 33 bits, square it in Q60 */
+        q63_t d = ((q63_t)src[i] - mean) >> 1;
+        sum += (d * d) >> 12;
+    }
+    return sum / (q63_t)(size - 1);
+}
+
+q15_t riscv_dsp_std_q15(const q15_t *src, uint32_t size)
+{
+    return hpm_dsp_sw_sat_q15((q31_t)hpm_dsp_sw_isqrt_u64((uint64_t)riscv_dsp_var_q15(src, size)));
+}
+
+q31_t riscv_dsp_std_q31(const q31_t *src, uint32_t size)
+{
+    uint64_t var = (uint64_t)riscv_dsp_var_q31(src, size);
+
+    if (var >= ((uint64_t)1 << 48)) {
+        return HPM_DSP_SW_Q31_MAX;
+    }
+    return hpm_dsp_sw_sat_q31((q63_t)hpm_dsp_sw_isqrt_u64(var << 14));
+}
+
+/* Q7 result, the samples are integers */
+q15_t riscv_dsp_std_u8(const uint8_t *src, uint32_t size)
+{
+    uint64_t sum = 0;
+    uint64_t sum_sq = 0;
+    uint64_t var;
+
+    if (size <= 1) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src[i];
+        sum_sq += (uint32_t)src[i] * src[i];
+    }
+    /* variance in Q14 */
+    var = (((uint64_t)size * sum_sq - sum * sum) << 14) / ((uint64_t)size * (size - 1));
+    return hpm_dsp_sw_sat_q15((q31_t)hpm_dsp_sw_isqrt_u64(var));
+}
+
+/* Entropy */
+float32_t riscv_dsp_entropy_f32(const float32_t *src, uint32_t size)
+{
+    float32_t sum = 0.0f;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src[i] * logf(src[i]);
+    }
+    return -sum;
+}
+
+float32_t riscv_dsp_relative_entropy_f32(const float32_t *src1, const float32_t *src2, uint32_t size)
+{
+    float32_t sum = 0.0f;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += src1[i] * logf(src1[i] / src2[i]);
+    }
+    return sum;
+}
+
+/* Log-sum-exp, evaluated around the maximum so exp() can't overflow */
+float32_t riscv_dsp_lse_f32(const float32_t *src, uint32_t size)
+{
+    float32_t max = riscv_dsp_max_val_f32(src, size);
+    float32_t sum = 0.0f;
+
+    for (uint32_t i = 0; i < size; i++) {
+        sum += expf(src[i] - max);
+    }
+    return max + logf(sum);
+}
+
+float32_t riscv_dsp_lse_dprod_f32(const float32_t *src1, const float32_t *src2, uint32_t size, float32_t *buffer)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        buffer[i] = src1[i] + src2[i];
+    }
+    return riscv_dsp_lse_f32(buffer, size);
+}
+
+/* Gaussian naive Bayes, returns the class with the largest log posterior */
+uint32_t riscv_dsp_gaussian_naive_bayes_est_f32(const riscv_dsp_gaussian_naivebayes_f32_t *instance,
+                                                const float32_t *src, float32_t *buf)
+{
+    const float32_t *mean = instance->mean;
+    const float32_t *var = instance->var;
+    uint32_t index;
+
+    for (uint32_t c = 0; c < instance->numofclass; c++) {
+        float32_t log_det = 0.0f;
+        float32_t dist = 0.0f;
+
+        for (uint32_t d = 0; d < instance->dimofvec; d++) {
+            float32_t sigma = var[d] + instance->additiveofvar;
+            float32_t diff = src[d] - mean[d];
+            log_det += logf(2.0f * (float32_t)HPM_DSP_SW_PI * sigma);
+            dist += diff * diff / sigma;
+        }
+        buf[c] = logf(instance->classprior[c]) - 0.5f * log_det - 0.5f * dist;
+        mean += instance->dimofvec;
+        var += instance->dimofvec;
+    }
+    riscv_dsp_max_f32(buf, instance->numofclass, &index);
+    return index;
+}
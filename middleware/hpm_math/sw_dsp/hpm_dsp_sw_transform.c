@@ -0,0 +1,680 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "hpm_dsp_sw_common.h"
+#include "riscv_dsp_transform_math.h"
+
+/*
+ * Transforms of N = 2^m points, computed in place by an iterative radix-2 algorithm. The
+ * radix-2, radix-4 and generic entries produce the same results, the radix-4 entries only
+ * keep their stricter check of m.
+ *
+ * Floating-point forward transforms are not normalized, the inverse transforms divide by N.
+ *
+ * Fixed-point forward transforms return the spectrum divided by 2^(m + 1), each stage
+ * halves its outputs so the butterflies can't overflow. The fixed-point inverse transforms
+ * expect that scaled spectrum and return the time signal in the input format, so a forward
+ * transform followed by an inverse one gives the input back.
+ */
+
+#define HPM_DSP_SW_FFT_MIN_LOG2  (3U)
+#define HPM_DSP_SW_RFFT_MIN_LOG2 (4U)
+#define HPM_DSP_SW_DCT_MAX_LOG2  (8U)
+
+/* swap the complex samples into bit reversed order */
+#define HPM_DSP_SW_BITREV(type, src, n)                                   \
+    do {                                                                  \
+        uint32_t j = 0;                                                   \
+        for (uint32_t i = 0; i < (n) - 1; i++) {                          \
+            uint32_t bit = (n) >> 1;                                      \
+            if (i < j) {                                                  \
+                type re = (src)[2 * i];                                   \
+                type im = (src)[2 * i + 1];                               \
+                (src)[2 * i] = (src)[2 * j];                              \
+                (src)[2 * i + 1] = (src)[2 * j + 1];                      \
+                (src)[2 * j] = re;                                        \
+                (src)[2 * j + 1] = im;                                    \
+            }                                                             \
+            while (j & bit) {                                             \
+                j ^= bit;                                                 \
+                bit >>= 1;                                                \
+            }                                                             \
+            j |= bit;                                                     \
+        }                                                                 \
+    } while (0)
+
+/*
+ * Floating-point core, sign is -1 for the forward and +1 for the inverse transform. The
+ * twiddle factor of a butterfly column is computed once, the butterflies sharing it are
+ * independent.
+ */
+#define HPM_DSP_SW_CFFT_FLOAT(type, src, m, sign)                                                   \
+    do {                                                                                            \
+        uint32_t n = 1UL << (m);                                                                    \
+        HPM_DSP_SW_BITREV(type, src, n);                                                            \
+        for (uint32_t len = 2; len <= n; len <<= 1) {                                               \
+            uint32_t half = len >> 1;                                                               \
+            for (uint32_t j = 0; j < half; j++) {                                                   \
+                double angle = (sign) * 2.0 * HPM_DSP_SW_PI * (double)j / (double)len;              \
+                type wr = (type)cos(angle);                                                         \
+                type wi = (type)sin(angle);                                                         \
+                for (uint32_t k = j; k < n; k += len) {                                             \
+                    type *a = &(src)[2 * k];                                                        \
+                    type *b = &(src)[2 * (k + half)];                                               \
+                    type tr = b[0] * wr - b[1] * wi;                                                \
+                    type ti = b[0] * wi + b[1] * wr;                                                \
+                    b[0] = a[0] - tr;                                                               \
+                    b[1] = a[1] - ti;                                                               \
+                    a[0] += tr;                                                                     \
+                    a[1] += ti;                                                                     \
+                }                                                                                   \
+            }                                                                                       \
+        }                                                                                           \
+    } while (0)
+
+static void hpm_dsp_sw_cfft_f32(float32_t *src, uint32_t m, int32_t inverse)
+{
+    HPM_DSP_SW_CFFT_FLOAT(float32_t, src, m, inverse ? 1.0 : -1.0);
+    if (inverse) {
+        float32_t scale = 1.0f / (float32_t)(1UL << m);
+        for (uint32_t i = 0; i < (2UL << m); i++) {
+            src[i] *= scale;
+        }
+    }
+}
+
+static void hpm_dsp_sw_cfft_f64(float64_t *src, uint32_t m, int32_t inverse)
+{
+    HPM_DSP_SW_CFFT_FLOAT(float64_t, src, m, inverse ? 1.0 : -1.0);
+    if (inverse) {
+        float64_t scale = 1.0 / (float64_t)(1UL << m);
+        for (uint32_t i = 0; i < (2UL << m); i++) {
+            src[i] *= scale;
+        }
+    }
+}
+
+/*
+ * Fixed-point core. The forward transform halves the input once and the outputs of every
+ * stage, the inverse one keeps the stage outputs (saturated) and doubles the result.
+ * mul(x, w) is the product with a twiddle factor in the data format.
+ */
+#define HPM_DSP_SW_CFFT_FIXED(type, acc_type, src, m, inverse, to_fixed, mul, sat)                \
+    do {                                                                                            \
+        uint32_t n = 1UL << (m);                                                                    \
+        int32_t ds = (inverse) ? 0 : 1;                                                             \
+        if (!(inverse)) {                                                                           \
+            for (uint32_t i = 0; i < 2 * n; i++) {                                                  \
+                (src)[i] >>= 1;                                                                     \
+            }                                                                                       \
+        }                                                                                           \
+        HPM_DSP_SW_BITREV(type, src, n);                                                            \
+        for (uint32_t len = 2; len <= n; len <<= 1) {                                               \
+            uint32_t half = len >> 1;                                                               \
+            for (uint32_t j = 0; j < half; j++) {                                                   \
+                double angle = ((inverse) ? 2.0 : -2.0) * HPM_DSP_SW_PI * (double)j / (double)len;  \
+                acc_type wr = to_fixed(cos(angle));                                                 \
+                acc_type wi = to_fixed(sin(angle));                                                 \
+                for (uint32_t k = j; k < n; k += len) {                                             \
+                    type *a = &(src)[2 * k];                                                        \
+                    type *b = &(src)[2 * (k + half)];                                               \
+                    acc_type tr = mul(b[0], wr) - mul(b[1], wi);                                    \
+                    acc_type ti = mul(b[0], wi) + mul(b[1], wr);                                    \
+                    acc_type ar = a[0];                                                             \
+                    acc_type ai = a[1];                                                             \
+                    a[0] = sat((ar + tr) >> ds);                                                    \
+                    a[1] = sat((ai + ti) >> ds);                                                    \
+                    b[0] = sat((ar - tr) >> ds);                                                    \
+                    b[1] = sat((ai - ti) >> ds);                                                    \
+                }                                                                                   \
+            }                                                                                       \
+        }                                                                                           \
+        if (inverse) {                                                                              \
+            for (uint32_t i = 0; i < 2 * n; i++) {                                                  \
+                (src)[i] = sat((acc_type)(src)[i] * 2);                                             \
+            }                                                                                       \
+        }                                                                                           \
+    } while (0)
+
+#define HPM_DSP_SW_MUL_Q31(x, w) (((q63_t)(x) * (w)) >> 31)
+#define HPM_DSP_SW_MUL_Q15(x, w) (((q31_t)(x) * (w)) >> 15)
+
+static void hpm_dsp_sw_cfft_q31(q31_t *src, uint32_t m, int32_t inverse)
+{
+    HPM_DSP_SW_CFFT_FIXED(q31_t, q63_t, src, m, inverse, hpm_dsp_sw_double_to_q31, HPM_DSP_SW_MUL_Q31,
+                          hpm_dsp_sw_sat_q31);
+}
+
+static void hpm_dsp_sw_cfft_q15(q15_t *src, uint32_t m, int32_t inverse)
+{
+    HPM_DSP_SW_CFFT_FIXED(q15_t, q31_t, src, m, inverse, hpm_dsp_sw_double_to_q15, HPM_DSP_SW_MUL_Q15,
+                          hpm_dsp_sw_sat_q15);
+}
+
+static inline int32_t hpm_dsp_sw_fft_m_valid(uint32_t m)
+{
+    return (m >= HPM_DSP_SW_FFT_MIN_LOG2) && (m <= HPM_DSP_SW_FFT_MAX_LOG2);
+}
+
+static inline int32_t hpm_dsp_sw_fft_rd4_m_valid(uint32_t m)
+{
+    return (m >= 4U) && (m <= HPM_DSP_SW_FFT_MAX_LOG2) && ((m & 1U) == 0U);
+}
+
+/* Radix-2 */
+int32_t riscv_dsp_cfft_rd2_f32(float32_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_f32(src, m, 0);
+    return 0;
+}
+
+int32_t riscv_dsp_cifft_rd2_f32(float32_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_f32(src, m, 1);
+    return 0;
+}
+
+int32_t riscv_dsp_cfft_rd2_q15(q15_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_q15(src, m, 0);
+    return 0;
+}
+
+int32_t riscv_dsp_cifft_rd2_q15(q15_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_q15(src, m, 1);
+    return 0;
+}
+
+int32_t riscv_dsp_cfft_rd2_q31(q31_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_q31(src, m, 0);
+    return 0;
+}
+
+int32_t riscv_dsp_cifft_rd2_q31(q31_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_q31(src, m, 1);
+    return 0;
+}
+
+/* Radix-4 */
+int32_t riscv_dsp_cfft_rd4_f32(float32_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_rd4_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_f32(src, m, 0);
+    return 0;
+}
+
+int32_t riscv_dsp_cifft_rd4_f32(float32_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_rd4_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_f32(src, m, 1);
+    return 0;
+}
+
+int32_t riscv_dsp_cfft_rd4_q15(q15_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_rd4_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_q15(src, m, 0);
+    return 0;
+}
+
+int32_t riscv_dsp_cifft_rd4_q15(q15_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_rd4_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_q15(src, m, 1);
+    return 0;
+}
+
+int32_t riscv_dsp_cfft_rd4_q31(q31_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_rd4_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_q31(src, m, 0);
+    return 0;
+}
+
+int32_t riscv_dsp_cifft_rd4_q31(q31_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_fft_rd4_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_q31(src, m, 1);
+    return 0;
+}
+
+/* Generic entries, an invalid m leaves the input untouched */
+void riscv_dsp_cfft_f32(float32_t *src, uint32_t m)
+{
+    (void)riscv_dsp_cfft_rd2_f32(src, m);
+}
+
+void riscv_dsp_cfft_f64(float64_t *src, uint32_t m)
+{
+    if (hpm_dsp_sw_fft_m_valid(m)) {
+        hpm_dsp_sw_cfft_f64(src, m, 0);
+    }
+}
+
+void riscv_dsp_cifft_f32(float32_t *src, uint32_t m)
+{
+    (void)riscv_dsp_cifft_rd2_f32(src, m);
+}
+
+void riscv_dsp_cifft_f64(float64_t *src, uint32_t m)
+{
+    if (hpm_dsp_sw_fft_m_valid(m)) {
+        hpm_dsp_sw_cfft_f64(src, m, 1);
+    }
+}
+
+void riscv_dsp_cfft_q15(q15_t *src, uint32_t m)
+{
+    (void)riscv_dsp_cfft_rd2_q15(src, m);
+}
+
+void riscv_dsp_cifft_q15(q15_t *src, uint32_t m)
+{
+    (void)riscv_dsp_cifft_rd2_q15(src, m);
+}
+
+void riscv_dsp_cfft_q31(q31_t *src, uint32_t m)
+{
+    (void)riscv_dsp_cfft_rd2_q31(src, m);
+}
+
+void riscv_dsp_cifft_q31(q31_t *src, uint32_t m)
+{
+    (void)riscv_dsp_cifft_rd2_q31(src, m);
+}
+
+/*
+ * Real transforms. The N real samples are handled as N / 2 complex samples z, and with
+ * Z = CFFT(z) the spectrum is split into the transforms of the even and odd samples:
+ * E[k] = (Z[k] + conj(Z[N/2 - k])) / 2, O[k] = (Z[k] - conj(Z[N/2 - k])) / 2j and
+ * X[k] = E[k] + e^(-j2pik/N) * O[k]. X[N/2] is real and stored in place of the imaginary
+ * part of X[0]. The pairs k and N/2 - k are updated together, so the split is in place.
+ * half_shift is the extra right shift applied to the fixed-point results.
+ */
+#define HPM_DSP_SW_RFFT_SPLIT(type, acc_type, src, m, to_fixed, mul, sat, half_shift)              \
+    do {                                                                                            \
+        uint32_t h = 1UL << ((m) - 1);                                                              \
+        acc_type z0r = (src)[0];                                                                    \
+        acc_type z0i = (src)[1];                                                                    \
+        (src)[0] = sat((z0r + z0i) >> (half_shift));                                                \
+        (src)[1] = sat((z0r - z0i) >> (half_shift));                                                \
+        for (uint32_t k = 1; k <= h / 2; k++) {                                                     \
+            uint32_t p = h - k;                                                                     \
+            acc_type ar = (src)[2 * k], ai = (src)[2 * k + 1];                                      \
+            acc_type br = (src)[2 * p], bi = (src)[2 * p + 1];                                      \
+            double angle = -2.0 * HPM_DSP_SW_PI * (double)k / (double)(2 * h);                      \
+            acc_type wr = to_fixed(cos(angle));                                                     \
+            acc_type wi = to_fixed(sin(angle));                                                     \
+            /* E[k] and O[k], E[N/2 - k] = conj(E[k]) and O[N/2 - k] = conj(O[k]) */               \
+            acc_type er = (ar + br) >> 1, ei = (ai - bi) >> 1;                                      \
+            acc_type orr = (ai + bi) >> 1, oi = (br - ar) >> 1;                                     \
+            acc_type tr = mul(orr, wr) - mul(oi, wi);                                               \
+            acc_type ti = mul(orr, wi) + mul(oi, wr);                                               \
+            (src)[2 * k] = sat((er + tr) >> (half_shift));                                          \
+            (src)[2 * k + 1] = sat((ei + ti) >> (half_shift));                                      \
+            if (p != k) {                                                                           \
+                /* X[N/2 - k] = conj(E[k]) - conj(W^k * O[k]) */                                    \
+                (src)[2 * p] = sat((er - tr) >> (half_shift));                                      \
+                (src)[2 * p + 1] = sat((ti - ei) >> (half_shift));                                  \
+            }                                                                                       \
+        }                                                                                           \
+    } while (0)
+
+/*
+ * Inverse split: E[k] = (X[k] + conj(X[N/2 - k])) / 2, O[k] = (X[k] - conj(X[N/2 - k])) / 2 *
+ * e^(j2pik/N) and Z[k] = E[k] + j * O[k]. The fixed-point version leaves out the factors
+ * 1/2, which the inverse core makes up for.
+ */
+#define HPM_DSP_SW_RIFFT_SPLIT(type, acc_type, src, m, to_fixed, mul, sat, half_shift)             \
+    do {                                                                                            \
+        uint32_t h = 1UL << ((m) - 1);                                                              \
+        acc_type x0 = (src)[0];                                                                     \
+        acc_type xh = (src)[1];                                                                     \
+        (src)[0] = sat((x0 + xh) >> (half_shift));                                                  \
+        (src)[1] = sat((x0 - xh) >> (half_shift));                                                  \
+        for (uint32_t k = 1; k <= h / 2; k++) {                                                     \
+            uint32_t p = h - k;                                                                     \
+            acc_type ar = (src)[2 * k], ai = (src)[2 * k + 1];                                      \
+            acc_type br = (src)[2 * p], bi = (src)[2 * p + 1];                                      \
+            double angle = 2.0 * HPM_DSP_SW_PI * (double)k / (double)(2 * h);                       \
+            acc_type wr = to_fixed(cos(angle));                                                     \
+            acc_type wi = to_fixed(sin(angle));                                                     \
+            acc_type er = ar + br, ei = ai - bi;                                                    \
+            acc_type dr = ar - br, di = ai + bi;                                                    \
+            acc_type orr = mul(dr, wr) - mul(di, wi);                                               \
+            acc_type oi = mul(dr, wi) + mul(di, wr);                                                \
+            /* Z[k] = E + jO, Z[N/2 - k] = conj(E) + j * conj(O) */                              \
+            (src)[2 * k] = sat((er - oi) >> (half_shift));                                          \
+            (src)[2 * k + 1] = sat((ei + orr) >> (half_shift));                                     \
+            if (p != k) {                                                                           \
+                (src)[2 * p] = sat((er + oi) >> (half_shift));                                      \
+                (src)[2 * p + 1] = sat((orr - ei) >> (half_shift));                                 \
+            }                                                                                       \
+        }                                                                                           \
+    } while (0)
+
+static inline int32_t hpm_dsp_sw_rfft_m_valid(uint32_t m)
+{
+    return (m >= HPM_DSP_SW_RFFT_MIN_LOG2) && (m <= HPM_DSP_SW_FFT_MAX_LOG2);
+}
+
+/* the floating-point splits, the macros above shift instead of multiplying by 1/2 */
+#define HPM_DSP_SW_RFFT_FLOAT(type, src, m)                                                         \
+    do {                                                                                            \
+        uint32_t h = 1UL << ((m) - 1);                                                              \
+        type z0r = (src)[0];                                                                        \
+        type z0i = (src)[1];                                                                        \
+        (src)[0] = z0r + z0i;                                                                       \
+        (src)[1] = z0r - z0i;                                                                       \
+        for (uint32_t k = 1; k <= h / 2; k++) {                                                     \
+            uint32_t p = h - k;                                                                     \
+            type ar = (src)[2 * k], ai = (src)[2 * k + 1];                                          \
+            type br = (src)[2 * p], bi = (src)[2 * p + 1];                                          \
+            double angle = -2.0 * HPM_DSP_SW_PI * (double)k / (double)(2 * h);                      \
+            type wr = (type)cos(angle);                                                             \
+            type wi = (type)sin(angle);                                                             \
+            type er = (ar + br) * (type)0.5, ei = (ai - bi) * (type)0.5;                            \
+            type orr = (ai + bi) * (type)0.5, oi = (br - ar) * (type)0.5;                           \
+            type tr = orr * wr - oi * wi;                                                           \
+            type ti = orr * wi + oi * wr;                                                           \
+            (src)[2 * k] = er + tr;                                                                 \
+            (src)[2 * k + 1] = ei + ti;                                                             \
+            if (p != k) {                                                                           \
+                (src)[2 * p] = er - tr;                                                             \
+                (src)[2 * p + 1] = ti - ei;                                                         \
+            }                                                                                       \
+        }                                                                                           \
+    } while (0)
+
+#define HPM_DSP_SW_RIFFT_FLOAT(type, src, m)                                                        \
+    do {                                                                                            \
+        uint32_t h = 1UL << ((m) - 1);                                                              \
+        type x0 = (src)[0];                                                                         \
+        type xh = (src)[1];                                                                         \
+        (src)[0] = (x0 + xh) * (type)0.5;                                                           \
+        (src)[1] = (x0 - xh) * (type)0.5;                                                           \
+        for (uint32_t k = 1; k <= h / 2; k++) {                                                     \
+            uint32_t p = h - k;                                                                     \
+            type ar = (src)[2 * k], ai = (src)[2 * k + 1];                                          \
+            type br = (src)[2 * p], bi = (src)[2 * p + 1];                                          \
+            double angle = 2.0 * HPM_DSP_SW_PI * (double)k / (double)(2 * h);                       \
+            type wr = (type)cos(angle);                                                             \
+            type wi = (type)sin(angle);                                                             \
+            type er = (ar + br) * (type)0.5, ei = (ai - bi) * (type)0.5;                            \
+            type dr = (ar - br) * (type)0.5, di = (ai + bi) * (type)0.5;                            \
+            type orr = dr * wr - di * wi;                                                           \
+            type oi = dr * wi + di * wr;                                                            \
+            (src)[2 * k] = er - oi;                                                                 \
+            (src)[2 * k + 1] = ei + orr;                                                            \
+            if (p != k) {                                                                           \
+                (src)[2 * p] = er + oi;                                                             \
+                (src)[2 * p + 1] = orr - ei;                                                        \
+            }                                                                                       \
+        }                                                                                           \
+    } while (0)
+
+int32_t riscv_dsp_rfft_f32(float32_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_rfft_m_valid(m)) {
+        return -1;
+    }
+    HPM_DSP_SW_CFFT_FLOAT(float32_t, src, m - 1, -1.0);
+    HPM_DSP_SW_RFFT_FLOAT(float32_t, src, m);
+    return 0;
+}
+
+int32_t riscv_dsp_rfft_f64(float64_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_rfft_m_valid(m)) {
+        return -1;
+    }
+    HPM_DSP_SW_CFFT_FLOAT(float64_t, src, m - 1, -1.0);
+    HPM_DSP_SW_RFFT_FLOAT(float64_t, src, m);
+    return 0;
+}
+
+int32_t riscv_dsp_rifft_f32(float32_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_rfft_m_valid(m)) {
+        return -1;
+    }
+    HPM_DSP_SW_RIFFT_FLOAT(float32_t, src, m);
+    hpm_dsp_sw_cfft_f32(src, m - 1, 1);
+    return 0;
+}
+
+int32_t riscv_dsp_rifft_f64(float64_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_rfft_m_valid(m)) {
+        return -1;
+    }
+    HPM_DSP_SW_RIFFT_FLOAT(float64_t, src, m);
+    hpm_dsp_sw_cfft_f64(src, m - 1, 1);
+    return 0;
+}
+
+/*
+ * Fixed point: the N / 2 point core returns Z / 2^m and the split halves once more, which
+ * gives X / 2^(m + 1). The inverse split drops the factors 1/2 and the core doubles the
+ * result, which undoes both.
+ */
+int32_t riscv_dsp_rfft_q15(q15_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_rfft_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_q15(src, m - 1, 0);
+    HPM_DSP_SW_RFFT_SPLIT(q15_t, q31_t, src, m, hpm_dsp_sw_double_to_q15, HPM_DSP_SW_MUL_Q15,
+                          hpm_dsp_sw_sat_q15, 1);
+    return 0;
+}
+
+int32_t riscv_dsp_rifft_q15(q15_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_rfft_m_valid(m)) {
+        return -1;
+    }
+    HPM_DSP_SW_RIFFT_SPLIT(q15_t, q31_t, src, m, hpm_dsp_sw_double_to_q15, HPM_DSP_SW_MUL_Q15,
+                           hpm_dsp_sw_sat_q15, 0);
+    hpm_dsp_sw_cfft_q15(src, m - 1, 1);
+    return 0;
+}
+
+int32_t riscv_dsp_rfft_q31(q31_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_rfft_m_valid(m)) {
+        return -1;
+    }
+    hpm_dsp_sw_cfft_q31(src, m - 1, 0);
+    HPM_DSP_SW_RFFT_SPLIT(q31_t, q63_t, src, m, hpm_dsp_sw_double_to_q31, HPM_DSP_SW_MUL_Q31,
+                          hpm_dsp_sw_sat_q31, 1);
+    return 0;
+}
+
+int32_t riscv_dsp_rifft_q31(q31_t *src, uint32_t m)
+{
+    if (!hpm_dsp_sw_rfft_m_valid(m)) {
+        return -1;
+    }
+    HPM_DSP_SW_RIFFT_SPLIT(q31_t, q63_t, src, m, hpm_dsp_sw_double_to_q31, HPM_DSP_SW_MUL_Q31,
+                           hpm_dsp_sw_sat_q31, 0);
+    hpm_dsp_sw_cfft_q31(src, m - 1, 1);
+    return 0;
+}
+
+/*
+ * DCT type II and IV, computed directly in double precision. The cosines of one output
+ * are generated by the recurrence cos(a + 2b) = 2cos(2b)cos(a + b) - cos(a), so no table is
+ * needed. Sizes beyond 2^8 points are ignored.
+ *
+ * dct:   X[k] = sum(x[n] * cos(pi * (n + 1/2) * k / N))
+ * idct:  x[n] = X[0] / N + 2 / N * sum(X[k] * cos(pi * (n + 1/2) * k / N)), k >= 1
+ * dct4:  X[k] = sum(x[n] * cos(pi * (n + 1/2) * (k + 1/2) / N))
+ * idct4: x[n] = 2 / N * dct4(X)[n]
+ */
+typedef enum {
+    hpm_dsp_sw_dct2 = 0,
+    hpm_dsp_sw_idct2,
+    hpm_dsp_sw_dct4,
+    hpm_dsp_sw_idct4,
+} hpm_dsp_sw_dct_type_t;
+
+/* output k of the transform of n points */
+static double hpm_dsp_sw_dct_f64(const double *in, uint32_t n, uint32_t k, hpm_dsp_sw_dct_type_t type)
+{
+    double acc = 0.0;
+
+    if (type == hpm_dsp_sw_idct2) {
+        /* output k is the time sample, the sum runs over the frequencies */
+        double b = HPM_DSP_SW_PI * ((double)k + 0.5) / (double)n;
+        double c_prev = cos(-b);
+        double c = 1.0;
+        double c2 = 2.0 * cos(b);
+        acc = in[0] * 0.5;
+        for (uint32_t i = 1; i < n; i++) {
+            double next = c2 * c - c_prev;
+            c_prev = c;
+            c = next;
+            acc += in[i] * c;
+        }
+        return acc * 2.0 / (double)n;
+    } else {
+        double freq = (type == hpm_dsp_sw_dct2) ? (double)k : ((double)k + 0.5);
+        double b = HPM_DSP_SW_PI * freq / (double)n;
+        double c_prev = cos(-0.5 * b);
+        double c = cos(0.5 * b);
+        double c2 = 2.0 * cos(b);
+        for (uint32_t i = 0; i < n; i++) {
+            double next = c2 * c - c_prev;
+            acc += in[i] * c;
+            c_prev = c;
+            c = next;
+        }
+        return (type == hpm_dsp_sw_idct4) ? (acc * 2.0 / (double)n) : acc;
+    }
+}
+
+/* the input is copied first, so the outputs can be stored in place */
+#define HPM_DSP_SW_DCT(src, m, type, load, store)                   \
+    do {                                                            \
+        double in[1UL << HPM_DSP_SW_DCT_MAX_LOG2];                  \
+        uint32_t n = 1UL << (m);                                    \
+        if ((m) > HPM_DSP_SW_DCT_MAX_LOG2) {                        \
+            return;                                                 \
+        }                                                           \
+        for (uint32_t i = 0; i < n; i++) {                          \
+            in[i] = load((src)[i], m);                              \
+        }                                                           \
+        for (uint32_t k = 0; k < n; k++) {                          \
+            (src)[k] = store(hpm_dsp_sw_dct_f64(in, n, k, type), m);\
+        }                                                           \
+    } while (0)
+
+/* The fixed-point forward transforms return X / 2^(m + 1), the inverse ones expect it */
+#define HPM_DSP_SW_LOAD_F32(x, m)       ((double)(x))
+#define HPM_DSP_SW_STORE_F32(x, m)      ((float32_t)(x))
+#define HPM_DSP_SW_LOAD_Q15(x, m)       ((double)(x) / 32768.0)
+#define HPM_DSP_SW_LOAD_Q31(x, m)       ((double)(x) / 2147483648.0)
+#define HPM_DSP_SW_STORE_Q15(x, m)      hpm_dsp_sw_double_to_q15(x)
+#define HPM_DSP_SW_STORE_Q31(x, m)      hpm_dsp_sw_double_to_q31(x)
+#define HPM_DSP_SW_FWD_Q15(x, m)        hpm_dsp_sw_double_to_q15(ldexp((x), -(int)((m) + 1)))
+#define HPM_DSP_SW_FWD_Q31(x, m)        hpm_dsp_sw_double_to_q31(ldexp((x), -(int)((m) + 1)))
+#define HPM_DSP_SW_INV_LOAD_Q15(x, m)   ldexp(HPM_DSP_SW_LOAD_Q15(x, m), (int)((m) + 1))
+#define HPM_DSP_SW_INV_LOAD_Q31(x, m)   ldexp(HPM_DSP_SW_LOAD_Q31(x, m), (int)((m) + 1))
+
+void riscv_dsp_dct_f32(float32_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_dct2, HPM_DSP_SW_LOAD_F32, HPM_DSP_SW_STORE_F32);
+}
+
+void riscv_dsp_idct_f32(float32_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_idct2, HPM_DSP_SW_LOAD_F32, HPM_DSP_SW_STORE_F32);
+}
+
+void riscv_dsp_dct_q15(q15_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_dct2, HPM_DSP_SW_LOAD_Q15, HPM_DSP_SW_FWD_Q15);
+}
+
+void riscv_dsp_idct_q15(q15_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_idct2, HPM_DSP_SW_INV_LOAD_Q15, HPM_DSP_SW_STORE_Q15);
+}
+
+void riscv_dsp_dct_q31(q31_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_dct2, HPM_DSP_SW_LOAD_Q31, HPM_DSP_SW_FWD_Q31);
+}
+
+void riscv_dsp_idct_q31(q31_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_idct2, HPM_DSP_SW_INV_LOAD_Q31, HPM_DSP_SW_STORE_Q31);
+}
+
+void riscv_dsp_dct4_f32(float32_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_dct4, HPM_DSP_SW_LOAD_F32, HPM_DSP_SW_STORE_F32);
+}
+
+void riscv_dsp_idct4_f32(float32_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_idct4, HPM_DSP_SW_LOAD_F32, HPM_DSP_SW_STORE_F32);
+}
+
+void riscv_dsp_dct4_q15(q15_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_dct4, HPM_DSP_SW_LOAD_Q15, HPM_DSP_SW_FWD_Q15);
+}
+
+void riscv_dsp_idct4_q15(q15_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_idct4, HPM_DSP_SW_INV_LOAD_Q15, HPM_DSP_SW_STORE_Q15);
+}
+
+void riscv_dsp_dct4_q31(q31_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_dct4, HPM_DSP_SW_LOAD_Q31, HPM_DSP_SW_FWD_Q31);
+}
+
+void riscv_dsp_idct4_q31(q31_t *src, uint32_t m)
+{
+    HPM_DSP_SW_DCT(src, m, hpm_dsp_sw_idct4, HPM_DSP_SW_INV_LOAD_Q31, HPM_DSP_SW_STORE_Q31);
+}
@@ -314,6 +314,237 @@ void hpm_software_cfft_float(float *src, uint32_t m)
     }
 }
 
+/**
+ * @brief Planned fft
+ *
+ * The complex transform runs radix-4 decimation-in-frequency stages, plus one radix-2 stage
+ * when m is odd. A radix-4 butterfly writes its outputs in the order 0, 2, 1, 3, so the
+ * result is in bit reversed order as after radix-2 stages and a single permutation with the
+ * table of the plan sorts it. The twiddle factors are read from the table of the plan, a
+ * stage of length L reads every (N / L)th entry.
+ *
+ */
+static inline void hpm_math_sw_fft_bfly4(float *a, float *b, float *c, float *d)
+{
+    float s0r = a[0] + c[0], s0i = a[1] + c[1];
+    float d0r = a[0] - c[0], d0i = a[1] - c[1];
+    float s1r = b[0] + d[0], s1i = b[1] + d[1];
+    float d1r = b[0] - d[0], d1i = b[1] - d[1];
+
+    a[0] = s0r + s1r;
+    a[1] = s0i + s1i;
+    b[0] = s0r - s1r;
+    b[1] = s0i - s1i;
+    /* (a - c) -/+ j(b - d) */
+    c[0] = d0r + d1i;
+    c[1] = d0i - d1r;
+    d[0] = d0r - d1i;
+    d[1] = d0i + d1r;
+}
+
+static inline void hpm_math_sw_fft_bfly4_tw(float *a, float *b, float *c, float *d,
+                                            const float *w1, const float *w2, const float *w3)
+{
+    float s0r = a[0] + c[0], s0i = a[1] + c[1];
+    float d0r = a[0] - c[0], d0i = a[1] - c[1];
+    float s1r = b[0] + d[0], s1i = b[1] + d[1];
+    float d1r = b[0] - d[0], d1i = b[1] - d[1];
+    float x2r = s0r - s1r, x2i = s0i - s1i;
+    float x1r = d0r + d1i, x1i = d0i - d1r;
+    float x3r = d0r - d1i, x3i = d0i + d1r;
+
+    a[0] = s0r + s1r;
+    a[1] = s0i + s1i;
+    b[0] = x2r * w2[0] - x2i * w2[1];
+    b[1] = x2r * w2[1] + x2i * w2[0];
+    c[0] = x1r * w1[0] - x1i * w1[1];
+    c[1] = x1r * w1[1] + x1i * w1[0];
+    d[0] = x3r * w3[0] - x3i * w3[1];
+    d[1] = x3r * w3[1] + x3i * w3[0];
+}
+
+/* forward complex transform of 2^m points, tw_step is the table step of the first stage */
+static void hpm_math_sw_fft_core(float *src, uint32_t m, const float *twiddle, uint32_t tw_step,
+                                 const uint16_t *bitrev)
+{
+    uint32_t n = 1UL << m;
+    uint32_t len;
+
+    for (len = n; len >= 4; len >>= 2, tw_step <<= 2) {
+        uint32_t q = len >> 2;
+        for (uint32_t k = 0; k < n; k += len) {
+            float *x = &src[2 * k];
+            hpm_math_sw_fft_bfly4(&x[0], &x[2 * q], &x[4 * q], &x[6 * q]);
+        }
+        for (uint32_t j = 1; j < q; j++) {
+            const float *w1 = &twiddle[2 * j * tw_step];
+            const float *w2 = &twiddle[4 * j * tw_step];
+            const float *w3 = &twiddle[6 * j * tw_step];
+            for (uint32_t k = j; k < n; k += len) {
+                float *x = &src[2 * k];
+                hpm_math_sw_fft_bfly4_tw(&x[0], &x[2 * q], &x[4 * q], &x[6 * q], w1, w2, w3);
+            }
+        }
+    }
+    if (len == 2) {
+        for (uint32_t k = 0; k < 2 * n; k += 4) {
+            float tr = src[k + 2], ti = src[k + 3];
+            src[k + 2] = src[k] - tr;
+            src[k + 3] = src[k + 1] - ti;
+            src[k] += tr;
+            src[k + 1] += ti;
+        }
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t r = bitrev[i];
+        if (i < r) {
+            float tr = src[2 * i], ti = src[2 * i + 1];
+            src[2 * i] = src[2 * r];
+            src[2 * i + 1] = src[2 * r + 1];
+            src[2 * r] = tr;
+            src[2 * r + 1] = ti;
+        }
+    }
+}
+
+/* e^(-j2pik/2^m) for k in [0, 3 * 2^m / 4), and the bit reversal of 2^bitrev_m indexes */
+static void hpm_math_sw_fft_plan_fill(hpm_software_fft_plan_t *plan, uint32_t m, uint32_t bitrev_m,
+                                      float *twiddle, uint16_t *bitrev)
+{
+    uint32_t n = 1UL << m;
+    uint32_t len = 1UL << bitrev_m;
+
+    for (uint32_t k = 0; k < 3 * n / 4; k++) {
+        float angle = (float)(2.0 * HPM_MATH_PI * (double)k / (double)n);
+        twiddle[2 * k] = hpm_mah_software_cosf(angle);
+        twiddle[2 * k + 1] = -hpm_mah_software_sinf(angle);
+    }
+    bitrev[0] = 0;
+    for (uint32_t i = 1; i < len; i++) {
+        bitrev[i] = (bitrev[i >> 1] >> 1) | ((i & 1) << (bitrev_m - 1));
+    }
+    plan->m = m;
+    plan->twiddle = twiddle;
+    plan->bitrev = bitrev;
+}
+
+int32_t hpm_software_cfft_plan_init(hpm_software_fft_plan_t *plan, uint32_t m, float *twiddle, uint16_t *bitrev)
+{
+    if ((plan == NULL) || (twiddle == NULL) || (bitrev == NULL) ||
+        (m < HPM_SOFTWARE_CFFT_MIN_LOG2) || (m > HPM_SOFTWARE_FFT_MAX_LOG2)) {
+        return -1;
+    }
+    hpm_math_sw_fft_plan_fill(plan, m, m, twiddle, bitrev);
+    return 0;
+}
+
+int32_t hpm_software_rfft_plan_init(hpm_software_fft_plan_t *plan, uint32_t m, float *twiddle, uint16_t *bitrev)
+{
+    if ((plan == NULL) || (twiddle == NULL) || (bitrev == NULL) ||
+        (m < HPM_SOFTWARE_RFFT_MIN_LOG2) || (m > HPM_SOFTWARE_FFT_MAX_LOG2)) {
+        return -1;
+    }
+    hpm_math_sw_fft_plan_fill(plan, m, m - 1, twiddle, bitrev);
+    return 0;
+}
+
+void hpm_software_cfft_plan_float(const hpm_software_fft_plan_t *plan, float *src)
+{
+    hpm_math_sw_fft_core(src, plan->m, plan->twiddle, 1, plan->bitrev);
+}
+
+/* ifft(x) = conj(fft(conj(x))) / N */
+void hpm_software_cifft_plan_float(const hpm_software_fft_plan_t *plan, float *src)
+{
+    uint32_t n = 1UL << plan->m;
+    float scale = 1.0f / (float)n;
+
+    for (uint32_t i = 1; i < 2 * n; i += 2) {
+        src[i] = -src[i];
+    }
+    hpm_math_sw_fft_core(src, plan->m, plan->twiddle, 1, plan->bitrev);
+    for (uint32_t i = 0; i < 2 * n; i += 2) {
+        src[i] *= scale;
+        src[i + 1] *= -scale;
+    }
+}
+
+/*
+ * The N real samples are transformed as N / 2 complex samples z, Z = CFFT(z) is then split
+ * into the transforms of the even and odd samples: E[k] = (Z[k] + conj(Z[N/2 - k])) / 2,
+ * O[k] = (Z[k] - conj(Z[N/2 - k])) / 2j and X[k] = E[k] + e^(-j2pik/N) * O[k]. The pairs k
+ * and N/2 - k are updated together.
+ */
+void hpm_software_rfft_plan_float(const hpm_software_fft_plan_t *plan, float *src)
+{
+    uint32_t h = 1UL << (plan->m - 1);
+    const float *twiddle = plan->twiddle;
+    float z0r, z0i;
+
+    hpm_math_sw_fft_core(src, plan->m - 1, twiddle, 2, plan->bitrev);
+    z0r = src[0];
+    z0i = src[1];
+    src[0] = z0r + z0i;
+    src[1] = z0r - z0i;
+    for (uint32_t k = 1; k <= h / 2; k++) {
+        uint32_t p = h - k;
+        float ar = src[2 * k], ai = src[2 * k + 1];
+        float br = src[2 * p], bi = src[2 * p + 1];
+        float wr = twiddle[2 * k], wi = twiddle[2 * k + 1];
+        float er = (ar + br) * 0.5f, ei = (ai - bi) * 0.5f;
+        float orr = (ai + bi) * 0.5f, oi = (br - ar) * 0.5f;
+        float tr = orr * wr - oi * wi;
+        float ti = orr * wi + oi * wr;
+        src[2 * k] = er + tr;
+        src[2 * k + 1] = ei + ti;
+        if (p != k) {
+            src[2 * p] = er - tr;
+            src[2 * p + 1] = ti - ei;
+        }
+    }
+}
+
+/*
+ * Inverse split: E[k] = (X[k] + conj(X[N/2 - k])) / 2, O[k] = (X[k] - conj(X[N/2 - k])) / 2 *
+ * e^(j2pik/N) and Z[k] = E[k] + j * O[k]. conj(Z) / (N / 2) is stored, so the forward core
+ * and a negation of the odd samples give z.
+ */
+void hpm_software_rifft_plan_float(const hpm_software_fft_plan_t *plan, float *src)
+{
+    uint32_t h = 1UL << (plan->m - 1);
+    const float *twiddle = plan->twiddle;
+    float scale = 1.0f / (float)h;
+    float half = 0.5f * scale;
+    float x0, xh;
+
+    x0 = src[0];
+    xh = src[1];
+    src[0] = (x0 + xh) * half;
+    src[1] = (xh - x0) * half;
+    for (uint32_t k = 1; k <= h / 2; k++) {
+        uint32_t p = h - k;
+        float ar = src[2 * k], ai = src[2 * k + 1];
+        float br = src[2 * p], bi = src[2 * p + 1];
+        /* e^(j2pik/N) is the conjugate of the table entry */
+        float wr = twiddle[2 * k], wi = -twiddle[2 * k + 1];
+        float er = (ar + br) * half, ei = (ai - bi) * half;
+        float dr = (ar - br) * half, di = (ai + bi) * half;
+        float orr = dr * wr - di * wi;
+        float oi = dr * wi + di * wr;
+        src[2 * k] = er - oi;
+        src[2 * k + 1] = -(ei + orr);
+        if (p != k) {
+            src[2 * p] = er + oi;
+            src[2 * p + 1] = ei - orr;
+        }
+    }
+    hpm_math_sw_fft_core(src, plan->m - 1, twiddle, 2, plan->bitrev);
+    for (uint32_t i = 1; i < 2 * h; i += 2) {
+        src[i] = -src[i];
+    }
+}
+
 /**
  * @brief Bit reversal
  *
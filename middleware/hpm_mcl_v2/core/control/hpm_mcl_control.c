@@ -7,20 +7,51 @@
 
 #include "hpm_mcl_control.h"
 #include "hpm_mcl_math.h"
+#include "hpm_mcl_trig.h"
+
+#if MCL_CFG_TRIG_METHOD == MCL_TRIG_METHOD_LUT
+#define MCL_CONTROL_SINCOS(x, s, c) hpm_mcl_trig_sincos_lut(x, s, c)
+#define MCL_CONTROL_ATAN2(y, x) hpm_mcl_trig_atan2_lut(y, x)
+#elif MCL_CFG_TRIG_METHOD == MCL_TRIG_METHOD_POLY
+#define MCL_CONTROL_SINCOS(x, s, c) hpm_mcl_trig_sincos_poly(x, s, c)
+#define MCL_CONTROL_ATAN2(y, x) hpm_mcl_trig_atan2_poly(y, x)
+#else
+#define MCL_CONTROL_SINCOS(x, s, c) do { *(s) = sinf(x); *(c) = cosf(x); } while (0)
+#define MCL_CONTROL_ATAN2(y, x) atan2f(y, x)
+#endif
 
 float hpm_mcl_control_sin(float x)
 {
+#if MCL_CFG_TRIG_METHOD == MCL_TRIG_METHOD_LIBM
     return sinf(x);
+#else
+    float sin_x, cos_x;
+
+    MCL_CONTROL_SINCOS(x, &sin_x, &cos_x);
+    return sin_x;
+#endif
 }
 
 float hpm_mcl_control_cos(float x)
 {
+#if MCL_CFG_TRIG_METHOD == MCL_TRIG_METHOD_LIBM
     return cosf(x);
+#else
+    float sin_x, cos_x;
+
+    MCL_CONTROL_SINCOS(x, &sin_x, &cos_x);
+    return cos_x;
+#endif
+}
+
+void hpm_mcl_control_sincos(float x, float *sin_x, float *cos_x)
+{
+    MCL_CONTROL_SINCOS(x, sin_x, cos_x);
 }
 
 float hpm_mcl_control_arctan(float y, float x)
 {
-    return atan2((double)y, (double)x);
+    return MCL_CONTROL_ATAN2(y, x);
 }
 
 hpm_mcl_stat_t hpm_mcl_control_clarke(float ia, float ib, float ic,
@@ -263,7 +294,7 @@ hpm_mcl_stat_t hpm_mcl_control_dead_area_polarity_detection(mcl_control_dead_are
 
     out_q = hpm_mcl_control_lowpass_filter(iq, &dead_area->q_mem, dead_area->cfg.lowpass_k);
     out_d = hpm_mcl_control_lowpass_filter(id, &dead_area->d_mem, dead_area->cfg.lowpass_k);
-    sens_theta = atan2f(out_q, out_d);
+    sens_theta = MCL_CONTROL_ATAN2(out_q, out_d);
     theta += sens_theta;
     theta = MCL_ANGLE_MOD_X(0, MCL_2PI, theta);
 
@@ -313,6 +344,7 @@ void hpm_mcl_control_smc_process(mcl_control_smc_t *smc_cfg, float ualpha, float
     float beta_err;
     float speed;
     float sens, ref;
+    float sin_x, cos_x;
 
     smc_cfg->ialpha_mem = smc_cfg->cfg.factor.smc_f *
                                         smc_cfg->ialpha_mem + smc_cfg->cfg.factor.smc_g *
@@ -347,8 +379,9 @@ void hpm_mcl_control_smc_process(mcl_control_smc_t *smc_cfg, float ualpha, float
     smc_cfg->beta_cal = (1 - smc_cfg->cfg.factor.filter_coeff) *
                                         smc_cfg->beta_cal + smc_cfg->cfg.factor.filter_coeff *
                                         smc_cfg->zbeta_cal;
-    ref = -smc_cfg->alpha_cal * cosf(smc_cfg->theta_mem);
-    sens = smc_cfg->beta_cal * sinf(smc_cfg->theta_mem);
+    hpm_mcl_control_sincos(smc_cfg->theta_mem, &sin_x, &cos_x);
+    ref = -smc_cfg->alpha_cal * cos_x;
+    sens = smc_cfg->beta_cal * sin_x;
     hpm_mcl_control_pi(ref, sens, &smc_cfg->cfg.pll, &speed);
     smc_cfg->theta_mem += speed * smc_cfg->cfg.const_data.loop_ts;
     smc_cfg->theta_mem = MCL_ANGLE_MOD_X(0, MCL_2PI, smc_cfg->theta_mem);
@@ -585,9 +618,13 @@ hpm_mcl_stat_t hpm_mcl_control_init(mcl_control_t *control, mcl_control_cfg_t *c
      * @brief function initialisation
      *
      */
+#if MCL_CFG_TRIG_METHOD == MCL_TRIG_METHOD_LUT
+    hpm_mcl_trig_lut_init();
+#endif
     control->method.arctan_x = &hpm_mcl_control_arctan;
     control->method.clarke = &hpm_mcl_control_clarke;
     control->method.cos_x = &hpm_mcl_control_cos;
+    control->method.sincos_x = &hpm_mcl_control_sincos;
     control->method.currentd_pid = &hpm_mcl_control_pi;
     control->method.currentq_pid = &hpm_mcl_control_pi;
     control->method.invpark = &hpm_mcl_control_inv_park;
@@ -615,6 +652,11 @@ hpm_mcl_stat_t hpm_mcl_control_init(mcl_control_t *control, mcl_control_cfg_t *c
     MCL_FUNCTION_INIT_IF_NO_EMPTY(control->method.park, control->cfg->callback.method.park);
     MCL_FUNCTION_INIT_IF_NO_EMPTY(control->method.position_pid, control->cfg->callback.method.position_pid);
     MCL_FUNCTION_INIT_IF_NO_EMPTY(control->method.sin_x, control->cfg->callback.method.sin_x);
+    /* a user sin_x or cos_x without a matching sincos_x must not be bypassed by the default one */
+    if ((control->cfg->callback.method.sin_x != NULL) || (control->cfg->callback.method.cos_x != NULL)) {
+        control->method.sincos_x = NULL;
+    }
+    MCL_FUNCTION_INIT_IF_NO_EMPTY(control->method.sincos_x, control->cfg->callback.method.sincos_x);
     MCL_FUNCTION_INIT_IF_NO_EMPTY(control->method.speed_pid, control->cfg->callback.method.speed_pid);
     MCL_FUNCTION_INIT_IF_NO_EMPTY(control->method.svpwm, control->cfg->callback.method.svpwm);
     MCL_FUNCTION_INIT_IF_NO_EMPTY(control->method.step_svpwm, control->cfg->callback.method.step_svpwm);
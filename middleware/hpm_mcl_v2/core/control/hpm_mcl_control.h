@@ -215,6 +215,7 @@ typedef struct {
     hpm_mcl_type_t (*sin_x)(hpm_mcl_type_t x);
     hpm_mcl_type_t (*cos_x)(hpm_mcl_type_t x);
     hpm_mcl_type_t (*arctan_x)(hpm_mcl_type_t y, hpm_mcl_type_t x);
+    void (*sincos_x)(hpm_mcl_type_t x, hpm_mcl_type_t *sin_x, hpm_mcl_type_t *cos_x);    /**< may be NULL, then sin_x and cos_x are used */
     hpm_mcl_stat_t (*park)(hpm_mcl_type_t alpha, hpm_mcl_type_t beta,
                 hpm_mcl_type_t sin_x, hpm_mcl_type_t cos_x,
                 hpm_mcl_type_t *d, hpm_mcl_type_t *q);
@@ -329,6 +330,18 @@ hpm_mcl_stat_t hpm_mcl_delta_pid(float setpoint, float feedback, mcl_control_pid
  */
 hpm_mcl_stat_t hpm_mcl_position_pid(float setpoint, float feedback, mcl_control_pid_t *pid_x, float *output);
 
+/**
+ * @brief Default algorithms installed by hpm_mcl_control_init, the multi-axis loop checks
+ * the method table against them before running its own batched versions
+ *
+ */
+void hpm_mcl_control_sincos(float x, float *sin_x, float *cos_x);
+hpm_mcl_stat_t hpm_mcl_control_clarke(float ia, float ib, float ic, float *alpha, float *beta);
+hpm_mcl_stat_t hpm_mcl_control_park(float alpha, float beta, float sin_x, float cos_x, float *d, float *q);
+hpm_mcl_stat_t hpm_mcl_control_pi(float ref, float sens, mcl_control_pid_t *pid_x, float *output);
+hpm_mcl_stat_t hpm_mcl_control_inv_park(float d, float q, float sin_x, float cos_x, float *alpha, float *beta);
+hpm_mcl_stat_t hpm_mcl_control_svpwm(float alpha, float beta, float vbus, mcl_control_svpwm_duty_t *duty);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <math.h>
+#include "hpm_mcl_trig.h"
+
+#define MCL_TRIG_PI         (3.14159265358979f)
+#define MCL_TRIG_PI_DIV2    (1.57079632679490f)
+#define MCL_TRIG_2_DIV_PI   (0.636619772367581f)
+/* pi/2 split in three floats, k * part is exact for the upper two so x - k * pi/2 keeps its precision */
+#define MCL_TRIG_PI_DIV2_1  (1.5703125f)
+#define MCL_TRIG_PI_DIV2_2  (4.837512969970703125e-4f)
+#define MCL_TRIG_PI_DIV2_3  (7.54978995489188216e-8f)
+
+#define MCL_TRIG_ATAN_LUT_SIZE  (MCL_TRIG_LUT_SIZE / 8)
+
+#if (MCL_TRIG_LUT_SIZE & (MCL_TRIG_LUT_SIZE - 1)) != 0
+#error "MCL_TRIG_LUT_SIZE must be a power of 2"
+#endif
+
+/* one period of sin plus the first point again, so interpolation never wraps */
+static float mcl_trig_sin_table[MCL_TRIG_LUT_SIZE + 1];
+/* atan on [0, 1] */
+static float mcl_trig_atan_table[MCL_TRIG_ATAN_LUT_SIZE + 1];
+
+void hpm_mcl_trig_lut_init(void)
+{
+    for (uint32_t i = 0; i <= MCL_TRIG_LUT_SIZE; i++) {
+        mcl_trig_sin_table[i] = (float)sin(2.0 * 3.14159265358979323846 * (double)i / MCL_TRIG_LUT_SIZE);
+    }
+    for (uint32_t i = 0; i <= MCL_TRIG_ATAN_LUT_SIZE; i++) {
+        mcl_trig_atan_table[i] = (float)atan((double)i / MCL_TRIG_ATAN_LUT_SIZE);
+    }
+}
+
+void hpm_mcl_trig_sincos_lut(float x, float *sin_x, float *cos_x)
+{
+    float t = x * (MCL_TRIG_LUT_SIZE / (2.0f * MCL_TRIG_PI));
+    int32_t i = (int32_t)t;
+    float frac;
+    uint32_t is, ic;
+
+    /* floor, the conversion truncates towards zero */
+    if (t < (float)i) {
+        i--;
+    }
+    frac = t - (float)i;
+    is = (uint32_t)i & (MCL_TRIG_LUT_SIZE - 1);
+    ic = ((uint32_t)i + (MCL_TRIG_LUT_SIZE / 4)) & (MCL_TRIG_LUT_SIZE - 1);
+    *sin_x = mcl_trig_sin_table[is] + frac * (mcl_trig_sin_table[is + 1] - mcl_trig_sin_table[is]);
+    *cos_x = mcl_trig_sin_table[ic] + frac * (mcl_trig_sin_table[ic + 1] - mcl_trig_sin_table[ic]);
+}
+
+void hpm_mcl_trig_sincos_poly(float x, float *sin_x, float *cos_x)
+{
+    float k = (float)(int32_t)(x * MCL_TRIG_2_DIV_PI + ((x >= 0) ? 0.5f : -0.5f));
+    float r = ((x - k * MCL_TRIG_PI_DIV2_1) - k * MCL_TRIG_PI_DIV2_2) - k * MCL_TRIG_PI_DIV2_3;
+    float r2 = r * r;
+    float s, c;
+
+    /* sin and cos on [-pi/4, pi/4] */
+    s = r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+    c = 1.0f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+
+    switch ((uint32_t)(int32_t)k & 3U) {
+    case 0:
+        *sin_x = s;
+        *cos_x = c;
+        break;
+    case 1:
+        *sin_x = c;
+        *cos_x = -s;
+        break;
+    case 2:
+        *sin_x = -s;
+        *cos_x = -c;
+        break;
+    default:
+        *sin_x = -c;
+        *cos_x = s;
+        break;
+    }
+}
+
+/*
+ * atan2 from atan(z) on z = min(|x|, |y|) / max(|x|, |y|) in [0, 1], mirrored to the right
+ * octant afterwards.
+ */
+#define MCL_TRIG_ATAN2(y, x, atan_01)                       \
+    do {                                                    \
+        float ax = ((x) < 0) ? -(x) : (x);                  \
+        float ay = ((y) < 0) ? -(y) : (y);                  \
+        float a;                                            \
+        if ((ax == 0) && (ay == 0)) {                       \
+            return 0;                                       \
+        }                                                   \
+        if (ay > ax) {                                      \
+            a = MCL_TRIG_PI_DIV2 - atan_01(ax / ay);        \
+        } else {                                            \
+            a = atan_01(ay / ax);                           \
+        }                                                   \
+        if ((x) < 0) {                                      \
+            a = MCL_TRIG_PI - a;                            \
+        }                                                   \
+        return ((y) < 0) ? -a : a;                          \
+    } while (0)
+
+static inline float mcl_trig_atan_01_lut(float z)
+{
+    float t = z * MCL_TRIG_ATAN_LUT_SIZE;
+    uint32_t i = (uint32_t)t;
+
+    if (i >= MCL_TRIG_ATAN_LUT_SIZE) {
+        i = MCL_TRIG_ATAN_LUT_SIZE - 1;
+    }
+    return mcl_trig_atan_table[i] + (t - (float)i) * (mcl_trig_atan_table[i + 1] - mcl_trig_atan_table[i]);
+}
+
+/* Abramowitz and Stegun 4.4.49, |error| <= 1e-5 */
+static inline float mcl_trig_atan_01_poly(float z)
+{
+    float z2 = z * z;
+
+    return z * (0.9998660f + z2 * (-0.3302995f + z2 * (0.1801410f + z2 * (-0.0851330f + z2 * 0.0208351f))));
+}
+
+float hpm_mcl_trig_atan2_lut(float y, float x)
+{
+    MCL_TRIG_ATAN2(y, x, mcl_trig_atan_01_lut);
+}
+
+float hpm_mcl_trig_atan2_poly(float y, float x)
+{
+    MCL_TRIG_ATAN2(y, x, mcl_trig_atan_01_poly);
+}
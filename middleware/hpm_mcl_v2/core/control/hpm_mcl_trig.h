@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef HPM_MCL_TRIG_H
+#define HPM_MCL_TRIG_H
+#include <stdint.h>
+#include "hpm_mcl_math.h"
+
+/**
+ * @brief Fast trigonometric kernels for the current loop
+ *
+ * The current loop needs sin and cos of the same angle every PWM period and atan2 in the
+ * observers. These kernels compute them in single precision without calling the C library:
+ *
+ * lut:  table of one sine period with MCL_TRIG_LUT_SIZE points and linear interpolation,
+ *       the table is filled by @ref hpm_mcl_trig_lut_init. With 1024 points the max error
+ *       of sin/cos is about 5e-6 within one turn and 1.5e-5 at 64 * pi, 5e-6 rad for atan2.
+ * poly: range reduction to [-pi/4, pi/4] and minimax polynomials, no table. Max error is
+ *       about 1e-7 for sin/cos and 1.2e-5 rad for atan2.
+ *
+ * The angle of the sincos kernels is in radians and may be any value, the accuracy is
+ * specified for |x| < 64 * pi.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Fill the tables of the lut kernels, must be called once before they are used
+ *
+ */
+void hpm_mcl_trig_lut_init(void);
+
+/**
+ * @brief sin and cos of x by table lookup
+ *
+ * @param x angle in radians
+ * @param sin_x sin(x)
+ * @param cos_x cos(x)
+ */
+void hpm_mcl_trig_sincos_lut(float x, float *sin_x, float *cos_x);
+
+/**
+ * @brief atan2(y, x) by table lookup
+ *
+ * @param y y coordinate
+ * @param x x coordinate
+ * @return angle in (-pi, pi], 0 for x = y = 0
+ */
+float hpm_mcl_trig_atan2_lut(float y, float x);
+
+/**
+ * @brief sin and cos of x by polynomial approximation
+ *
+ * @param x angle in radians
+ * @param sin_x sin(x)
+ * @param cos_x cos(x)
+ */
+void hpm_mcl_trig_sincos_poly(float x, float *sin_x, float *cos_x);
+
+/**
+ * @brief atan2(y, x) by polynomial approximation
+ *
+ * @param y y coordinate
+ * @param x x coordinate
+ * @return angle in (-pi, pi], 0 for x = y = 0
+ */
+float hpm_mcl_trig_atan2_poly(float y, float x);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -7,6 +7,17 @@
 #include "hpm_mcl_loop.h"
 #include "hpm_csr_drv.h"
 
+static inline void hpm_mcl_loop_sincos(mcl_control_t *control, hpm_mcl_type_t theta,
+                                hpm_mcl_type_t *sin_x, hpm_mcl_type_t *cos_x)
+{
+    if (control->method.sincos_x != NULL) {
+        control->method.sincos_x(theta, sin_x, cos_x);
+    } else {
+        *sin_x = control->method.sin_x(theta);
+        *cos_x = control->method.cos_x(theta);
+    }
+}
+
 hpm_mcl_stat_t hpm_mcl_loop_init(mcl_loop_t *loop, mcl_loop_cfg_t *cfg, mcl_cfg_t *mcl_cfg,
                                 mcl_encoder_t *encoder, mcl_analog_t *analog,
                                 mcl_control_t *control, mcl_drivers_t *drivers, mcl_path_plan_t *path)
@@ -139,8 +150,7 @@ hpm_mcl_stat_t hpm_mcl_detect_offline_para(mcl_loop_t *loop)
             theta = 0;
         }
         ic = -(ia + ib);
-        sinx = loop->control->method.sin_x(theta);
-        cosx = loop->control->method.cos_x(theta);
+        hpm_mcl_loop_sincos(loop->control, theta, &sinx, &cosx);
         loop->control->method.clarke(ia, ib, ic, &alpha, &beta);
         loop->control->method.park(alpha, beta, sinx, cosx, &sens_d, &sens_q);
         uq = 0;
@@ -269,11 +279,54 @@ hpm_mcl_stat_t hpm_mcl_detect_offline_para(mcl_loop_t *loop)
     return  mcl_success;
 }
 
-hpm_mcl_stat_t hpm_mcl_current_foc_loop(mcl_loop_t *loop)
+hpm_mcl_stat_t hpm_mcl_loop_refresh_reference(mcl_loop_t *loop, float *ref_d, float *ref_q)
 {
     float ref_speed = 0;
     float sens_speed;
     float ref_position = 0;
+    float theta_abs;
+
+    MCL_ASSERT_OPT(loop != NULL, mcl_invalid_pointer);
+    MCL_ASSERT_OPT(ref_d != NULL, mcl_invalid_pointer);
+    MCL_ASSERT_OPT(ref_q != NULL, mcl_invalid_pointer);
+    *ref_d = 0;
+    *ref_q = 0;
+    if (loop->cfg->enable_position_loop) {
+        loop->time.position_ts += *loop->const_time.current_ts;
+        MCL_FUNCTION_SET_IF_ELSE_TRUE(loop->ref_position.enable, ref_position, loop->ref_position.value, loop->exec_ref.position);
+        if (loop->time.position_ts >= *loop->const_time.position_ts) {
+            loop->time.position_ts = 0;
+            MCL_ASSERT_EXEC_CODE_AND_RETURN(hpm_mcl_encoder_get_absolute_theta(loop->encoder, &theta_abs) == mcl_success,
+            loop->status = loop_status_fail, mcl_fail);
+            loop->control->method.position_pid(ref_position, theta_abs, &loop->control->cfg->position_pid_cfg, &loop->exec_ref.speed);
+        }
+    } else {
+        loop->exec_ref.speed = 0;
+        loop->time.position_ts = 0;
+    }
+    if (loop->cfg->enable_speed_loop) {
+        loop->time.speed_ts += *loop->const_time.current_ts;
+        MCL_FUNCTION_SET_IF_ELSE_TRUE(loop->ref_speed.enable, ref_speed, loop->ref_speed.value, loop->exec_ref.speed);
+        if (loop->time.speed_ts >= *loop->const_time.speed_ts) {
+            loop->time.speed_ts = 0;
+            sens_speed = hpm_mcl_encoder_get_speed(loop->encoder);
+            loop->control->method.speed_pid(ref_speed, sens_speed,
+            &loop->control->cfg->speed_pid_cfg, &loop->exec_ref.iq);
+        }
+    } else {
+        loop->time.speed_ts = 0;
+        loop->exec_ref.iq = 0;
+    }
+    MCL_VALUE_SET_IF_TRUE(loop->ref_id.enable, *ref_d, loop->ref_id.value);
+    MCL_FUNCTION_SET_IF_ELSE_TRUE(loop->ref_iq.enable, *ref_q, loop->ref_iq.value, loop->exec_ref.iq);
+    return mcl_success;
+}
+
+hpm_mcl_stat_t hpm_mcl_current_foc_loop(mcl_loop_t *loop)
+{
+#if defined(MCL_CFG_EN_DQ_AXIS_DECOUPLING) && MCL_CFG_EN_DQ_AXIS_DECOUPLING
+    float sens_speed;
+#endif
     float ia, ib, ic;
     float theta;
     float alpha, beta;
@@ -281,7 +334,6 @@ hpm_mcl_stat_t hpm_mcl_current_foc_loop(mcl_loop_t *loop)
     float sens_d, sens_q;
     float ref_d = 0, ref_q = 0;
     float ud, uq;
-    float theta_abs;
 #if defined(MCL_EN_LOOP_TIME_COUNT) && MCL_EN_LOOP_TIME_COUNT
     uint64_t delta_time;
 #endif
@@ -302,34 +354,9 @@ hpm_mcl_stat_t hpm_mcl_current_foc_loop(mcl_loop_t *loop)
     theta_forecast = hpm_mcl_encoder_get_forecast_theta(loop->encoder);
 #endif
     if (loop->enable) {
-        if (loop->cfg->enable_position_loop) {
-            loop->time.position_ts += *loop->const_time.current_ts;
-            MCL_FUNCTION_SET_IF_ELSE_TRUE(loop->ref_position.enable, ref_position, loop->ref_position.value, loop->exec_ref.position);
-            if (loop->time.position_ts >= *loop->const_time.position_ts) {
-                loop->time.position_ts = 0;
-                MCL_ASSERT_EXEC_CODE_AND_RETURN(hpm_mcl_encoder_get_absolute_theta(loop->encoder, &theta_abs) == mcl_success,
-                loop->status = loop_status_fail, mcl_fail);
-                loop->control->method.position_pid(ref_position, theta_abs, &loop->control->cfg->position_pid_cfg, &loop->exec_ref.speed);
-            }
-        } else {
-            loop->exec_ref.speed = 0;
-            loop->time.position_ts = 0;
+        if (hpm_mcl_loop_refresh_reference(loop, &ref_d, &ref_q) != mcl_success) {
+            return mcl_fail;
         }
-        if (loop->cfg->enable_speed_loop) {
-            loop->time.speed_ts += *loop->const_time.current_ts;
-            MCL_FUNCTION_SET_IF_ELSE_TRUE(loop->ref_speed.enable, ref_speed, loop->ref_speed.value, loop->exec_ref.speed);
-            if (loop->time.speed_ts >= *loop->const_time.speed_ts) {
-                loop->time.speed_ts = 0;
-                sens_speed = hpm_mcl_encoder_get_speed(loop->encoder);
-                loop->control->method.speed_pid(ref_speed, sens_speed,
-                &loop->control->cfg->speed_pid_cfg, &loop->exec_ref.iq);
-            }
-        } else {
-            loop->time.speed_ts = 0;
-            loop->exec_ref.iq = 0;
-        }
-        MCL_VALUE_SET_IF_TRUE(loop->ref_id.enable, ref_d, loop->ref_id.value);
-        MCL_FUNCTION_SET_IF_ELSE_TRUE(loop->ref_iq.enable, ref_q, loop->ref_iq.value, loop->exec_ref.iq);
         switch (loop->cfg->mode) {
         case mcl_mode_foc:
             /**
@@ -347,8 +374,7 @@ hpm_mcl_stat_t hpm_mcl_current_foc_loop(mcl_loop_t *loop)
             loop->control->method.smc_process(&loop->control->cfg->smc_cfg, loop->control->cfg->smc_cfg.ualpha,
                 loop->control->cfg->smc_cfg.ubeta, alpha, beta);
 #endif
-            sinx = loop->control->method.sin_x(theta);
-            cosx = loop->control->method.cos_x(theta);
+            hpm_mcl_loop_sincos(loop->control, theta, &sinx, &cosx);
             loop->control->method.park(alpha, beta, sinx, cosx, &sens_d, &sens_q);
             loop->control->method.currentd_pid(ref_d, sens_d, &loop->control->cfg->currentd_pid_cfg, &ud);
             loop->control->method.currentq_pid(ref_q, sens_q, &loop->control->cfg->currentq_pid_cfg, &uq);
@@ -362,8 +388,7 @@ hpm_mcl_stat_t hpm_mcl_current_foc_loop(mcl_loop_t *loop)
             }
 #endif
 #if defined(MCL_CFG_EN_THETA_FORECAST) && MCL_CFG_EN_THETA_FORECAST
-            sinx_ = loop->control->method.sin_x(theta_forecast);
-            cosx_ = loop->control->method.cos_x(theta_forecast);
+            hpm_mcl_loop_sincos(loop->control, theta_forecast, &sinx_, &cosx_);
             loop->control->method.invpark(ud, uq, sinx_, cosx_, &alpha, &beta);
 #else
             loop->control->method.invpark(ud, uq, sinx, cosx, &alpha, &beta);
@@ -435,13 +460,11 @@ hpm_mcl_stat_t hpm_mcl_step_foc_loop(mcl_loop_t *loop)
         MCL_VALUE_SET_IF_TRUE(loop->ref_id.enable, ref_d, loop->ref_id.value);
         alpha = ia;
         beta = ib;
-        sinx = loop->control->method.sin_x(theta);
-        cosx = loop->control->method.cos_x(theta);
+        hpm_mcl_loop_sincos(loop->control, theta, &sinx, &cosx);
         loop->control->method.park(alpha, beta, sinx, cosx, &sens_d, &sens_q);
         loop->control->method.currentd_pid(ref_d, sens_d, &loop->control->cfg->currentd_pid_cfg, &ud);
         loop->control->method.currentq_pid(0, sens_q, &loop->control->cfg->currentq_pid_cfg, &uq);
-        sinx_ = loop->control->method.sin_x(theta_);
-        cosx_ = loop->control->method.cos_x(theta_);
+        hpm_mcl_loop_sincos(loop->control, theta_, &sinx_, &cosx_);
         loop->control->method.invpark(ud, uq, sinx_, cosx_, &alpha, &beta);
         loop->control->method.step_svpwm(alpha, beta, *loop->const_vbus, &duty);
         hpm_mcl_drivers_update_step_duty(loop->drivers, duty.a0, duty.a1, duty.b0, duty.b1);
@@ -219,6 +219,17 @@ hpm_mcl_stat_t hpm_mcl_loop_disable_all_user_set_value(mcl_loop_t *loop);
  */
 hpm_mcl_stat_t hpm_mcl_loop(mcl_loop_t *loop);
 
+/**
+ * @brief Internal use, run the position and speed loops of a foc loop for one current
+ * loop period and get the references of the current loop
+ *
+ * @param loop @ref mcl_loop_t
+ * @param ref_d d-axis current reference
+ * @param ref_q q-axis current reference
+ * @return hpm_mcl_stat_t
+ */
+hpm_mcl_stat_t hpm_mcl_loop_refresh_reference(mcl_loop_t *loop, float *ref_d, float *ref_q);
+
 /**
  * @brief Call this function in the interrupt function to update the motor's sector
  *
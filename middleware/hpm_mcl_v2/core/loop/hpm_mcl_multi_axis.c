@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include "hpm_mcl_multi_axis.h"
+#include "hpm_csr_drv.h"
+
+/* same arithmetic as hpm_mcl_control_pi */
+static inline float hpm_mcl_multi_axis_pi(float ref, float sens, mcl_control_pid_t *pid_x)
+{
+    float err;
+    float val;
+
+    err = ref - sens;
+    pid_x->integral += pid_x->cfg.ki * err;
+    MCL_VALUE_LIMIT(pid_x->integral, pid_x->cfg.integral_min, pid_x->cfg.integral_max);
+    val = pid_x->cfg.kp * err + pid_x->integral;
+    MCL_VALUE_LIMIT(val, pid_x->cfg.output_min, pid_x->cfg.output_max);
+
+    return val;
+}
+
+static inline float hpm_mcl_multi_axis_max3(float a, float b, float c)
+{
+    float m = (a > b) ? a : b;
+
+    return (m > c) ? m : c;
+}
+
+static inline float hpm_mcl_multi_axis_min3(float a, float b, float c)
+{
+    float m = (a < b) ? a : b;
+
+    return (m < c) ? m : c;
+}
+
+static bool hpm_mcl_multi_axis_is_builtin(mcl_control_t *control)
+{
+    return (control->method.clarke == &hpm_mcl_control_clarke) &&
+           (control->method.sincos_x == &hpm_mcl_control_sincos) &&
+           (control->method.park == &hpm_mcl_control_park) &&
+           (control->method.currentd_pid == &hpm_mcl_control_pi) &&
+           (control->method.currentq_pid == &hpm_mcl_control_pi) &&
+           (control->method.invpark == &hpm_mcl_control_inv_park) &&
+           (control->method.svpwm == &hpm_mcl_control_svpwm);
+}
+
+hpm_mcl_stat_t hpm_mcl_multi_axis_init(mcl_multi_axis_t *multi, mcl_loop_t *const *loop, uint8_t num,
+                                const mcl_multi_axis_callback_t *callback)
+{
+    MCL_ASSERT(multi != NULL, mcl_invalid_pointer);
+    MCL_ASSERT(loop != NULL, mcl_invalid_pointer);
+    MCL_ASSERT((num > 0) && (num <= MCL_MULTI_AXIS_MAX), mcl_invalid_argument);
+
+    multi->status = loop_status_init;
+    for (uint8_t i = 0; i < num; i++) {
+        MCL_ASSERT(loop[i] != NULL, mcl_invalid_pointer);
+        MCL_ASSERT(loop[i]->status == loop_status_run, mcl_fail);
+        MCL_ASSERT(loop[i]->cfg->mode == mcl_mode_foc, mcl_invalid_argument);
+        MCL_ASSERT(*loop[i]->const_vbus != 0, mcl_invalid_argument);
+        MCL_ASSERT(hpm_mcl_multi_axis_is_builtin(loop[i]->control), mcl_invalid_argument);
+        multi->loop[i] = loop[i];
+    }
+    multi->num = num;
+    if (callback != NULL) {
+        multi->callback = *callback;
+    } else {
+        multi->callback.commit = NULL;
+    }
+    multi->rundata.slot_num = 0;
+    multi->rundata.current_loop_tick = 0;
+    multi->status = loop_status_run;
+
+    return mcl_success;
+}
+
+hpm_mcl_stat_t hpm_mcl_multi_axis_loop(mcl_multi_axis_t *multi)
+{
+    mcl_multi_axis_soa_t *soa;
+    mcl_loop_t *loop;
+    uint8_t num = 0;
+    uint32_t disabled = 0;
+    hpm_mcl_stat_t stat = mcl_success;
+#if defined(MCL_EN_LOOP_TIME_COUNT) && MCL_EN_LOOP_TIME_COUNT
+    uint64_t delta_time;
+#endif
+#if defined(MCL_CFG_EN_DQ_AXIS_DECOUPLING) && MCL_CFG_EN_DQ_AXIS_DECOUPLING
+    float sens_speed;
+#endif
+#if defined(MCL_CFG_EN_THETA_FORECAST) && MCL_CFG_EN_THETA_FORECAST
+    float sinx_, cosx_;
+#endif
+#if defined(MCL_CFG_EN_DEAD_AREA_COMPENSATION) && MCL_CFG_EN_DEAD_AREA_COMPENSATION
+    mcl_control_dead_area_pwm_offset_t duty_offset;
+#endif
+
+    MCL_ASSERT_OPT(multi != NULL, mcl_invalid_pointer);
+    MCL_ASSERT_OPT(multi->status == loop_status_run, mcl_fail);
+    soa = &multi->soa;
+
+    /**
+     * @brief sampling, the conversions of all axes were started by the same trigger
+     *
+     */
+    for (uint8_t i = 0; i < multi->num; i++) {
+        loop = multi->loop[i];
+        if (!loop->enable) {
+            disabled |= 1U << i;
+            continue;
+        }
+        if (hpm_mcl_loop_refresh_reference(loop, &soa->ref_d[num], &soa->ref_q[num]) != mcl_success) {
+            stat = mcl_fail;
+            continue;
+        }
+        MCL_STATUS_SET_IF_TRUE(mcl_success != hpm_mcl_analog_get_value(loop->analog, analog_a_current, &soa->ia[num]), loop->status, loop_status_fail);
+        MCL_STATUS_SET_IF_TRUE(mcl_success != hpm_mcl_analog_get_value(loop->analog, analog_b_current, &soa->ib[num]), loop->status, loop_status_fail);
+        soa->theta[num] = hpm_mcl_encoder_get_theta(loop->encoder);
+#if defined(MCL_CFG_EN_THETA_FORECAST) && MCL_CFG_EN_THETA_FORECAST
+        soa->theta_forecast[num] = hpm_mcl_encoder_get_forecast_theta(loop->encoder);
+#endif
+        soa->vbus[num] = *loop->const_vbus;
+        soa->axis[num] = i;
+        num++;
+    }
+    multi->rundata.slot_num = num;
+
+    /**
+     * @brief current loop, stage by stage over all slots
+     *
+     */
+#if defined(MCL_EN_LOOP_TIME_COUNT) && MCL_EN_LOOP_TIME_COUNT
+    delta_time = hpm_csr_get_core_mcycle();
+#endif
+    for (uint8_t k = 0; k < num; k++) {
+        soa->alpha[k] = soa->ia[k];
+        soa->beta[k] = SQRT3_DIV3 * soa->ia[k] + (SQRT3_DIV3 * 2) * soa->ib[k];
+    }
+#if defined(MCL_CFG_EN_SENSORLESS_SMC) && MCL_CFG_EN_SENSORLESS_SMC
+    for (uint8_t k = 0; k < num; k++) {
+        loop = multi->loop[soa->axis[k]];
+        loop->control->method.smc_process(&loop->control->cfg->smc_cfg, loop->control->cfg->smc_cfg.ualpha,
+            loop->control->cfg->smc_cfg.ubeta, soa->alpha[k], soa->beta[k]);
+    }
+#endif
+    for (uint8_t k = 0; k < num; k++) {
+        hpm_mcl_control_sincos(soa->theta[k], &soa->sin_x[k], &soa->cos_x[k]);
+    }
+    for (uint8_t k = 0; k < num; k++) {
+        soa->sens_d[k] = soa->cos_x[k] * soa->alpha[k] + soa->sin_x[k] * soa->beta[k];
+        soa->sens_q[k] = -soa->sin_x[k] * soa->alpha[k] + soa->cos_x[k] * soa->beta[k];
+    }
+    for (uint8_t k = 0; k < num; k++) {
+        loop = multi->loop[soa->axis[k]];
+        soa->ud[k] = hpm_mcl_multi_axis_pi(soa->ref_d[k], soa->sens_d[k], &loop->control->cfg->currentd_pid_cfg);
+        soa->uq[k] = hpm_mcl_multi_axis_pi(soa->ref_q[k], soa->sens_q[k], &loop->control->cfg->currentq_pid_cfg);
+    }
+#if defined(MCL_CFG_EN_DQ_AXIS_DECOUPLING) && MCL_CFG_EN_DQ_AXIS_DECOUPLING
+    for (uint8_t k = 0; k < num; k++) {
+        loop = multi->loop[soa->axis[k]];
+        if (loop->cfg->enable_dq_axis_decoupling && loop->cfg->enable_speed_loop) {
+            sens_speed = hpm_mcl_encoder_get_speed(loop->encoder);
+            soa->ud[k] -= soa->sens_q[k] * sens_speed * (*loop->encoder->pole_num) * (*loop->lq);
+            soa->uq[k] += sens_speed * (*loop->encoder->pole_num) * (*loop->ld * soa->sens_q[k] + *loop->flux);
+        }
+    }
+#endif
+#if defined(MCL_CFG_EN_THETA_FORECAST) && MCL_CFG_EN_THETA_FORECAST
+    for (uint8_t k = 0; k < num; k++) {
+        hpm_mcl_control_sincos(soa->theta_forecast[k], &sinx_, &cosx_);
+        soa->alpha[k] = cosx_ * soa->ud[k] - sinx_ * soa->uq[k];
+        soa->beta[k] = sinx_ * soa->ud[k] + cosx_ * soa->uq[k];
+    }
+#else
+    for (uint8_t k = 0; k < num; k++) {
+        soa->alpha[k] = soa->cos_x[k] * soa->ud[k] - soa->sin_x[k] * soa->uq[k];
+        soa->beta[k] = soa->sin_x[k] * soa->ud[k] + soa->cos_x[k] * soa->uq[k];
+    }
+#endif
+#if defined(MCL_CFG_EN_SENSORLESS_SMC) && MCL_CFG_EN_SENSORLESS_SMC
+    for (uint8_t k = 0; k < num; k++) {
+        loop = multi->loop[soa->axis[k]];
+        loop->control->cfg->smc_cfg.ualpha = soa->alpha[k];
+        loop->control->cfg->smc_cfg.ubeta = soa->beta[k];
+    }
+#endif
+    /**
+     * @brief svpwm, duty = 1/2 - (v - (max + min) / 2) / vbus for the phase voltages v,
+     * the low side share of the period as in hpm_mcl_control_svpwm
+     *
+     */
+    for (uint8_t k = 0; k < num; k++) {
+        float va = soa->alpha[k];
+        float vb = -0.5f * soa->alpha[k] + (SQRT3 / 2) * soa->beta[k];
+        float vc = -0.5f * soa->alpha[k] - (SQRT3 / 2) * soa->beta[k];
+        float vo = 0.5f * (hpm_mcl_multi_axis_max3(va, vb, vc) + hpm_mcl_multi_axis_min3(va, vb, vc));
+        float k_vbus = 1.0f / soa->vbus[k];
+
+        soa->duty_a[k] = 0.5f - (va - vo) * k_vbus;
+        soa->duty_b[k] = 0.5f - (vb - vo) * k_vbus;
+        soa->duty_c[k] = 0.5f - (vc - vo) * k_vbus;
+        MCL_VALUE_LIMIT(soa->duty_a[k], 0, 1);
+        MCL_VALUE_LIMIT(soa->duty_b[k], 0, 1);
+        MCL_VALUE_LIMIT(soa->duty_c[k], 0, 1);
+    }
+#if defined(MCL_CFG_EN_DEAD_AREA_COMPENSATION) && MCL_CFG_EN_DEAD_AREA_COMPENSATION
+    for (uint8_t k = 0; k < num; k++) {
+        loop = multi->loop[soa->axis[k]];
+        if (loop->cfg->enable_dead_area_compensation) {
+            loop->control->method.dead_area_polarity_detection(&loop->control->cfg->dead_area_compensation_cfg, soa->sens_d[k], soa->sens_q[k],
+                                                                soa->theta[k], loop->const_time.dead_area_ts, *loop->const_time.current_ts, &duty_offset);
+            soa->duty_a[k] += duty_offset.a_offset;
+            soa->duty_b[k] += duty_offset.b_offset;
+            soa->duty_c[k] += duty_offset.c_offset;
+            MCL_VALUE_LIMIT(soa->duty_a[k], 0, 1);
+            MCL_VALUE_LIMIT(soa->duty_b[k], 0, 1);
+            MCL_VALUE_LIMIT(soa->duty_c[k], 0, 1);
+        }
+    }
+#endif
+#if defined(MCL_EN_LOOP_TIME_COUNT) && MCL_EN_LOOP_TIME_COUNT
+    multi->rundata.current_loop_tick = hpm_csr_get_core_mcycle() - delta_time;
+#endif
+
+    /**
+     * @brief pwm update, all axes back to back so that they load at the same reload
+     *
+     */
+    for (uint8_t k = 0; k < num; k++) {
+        hpm_mcl_drivers_update_bldc_duty(multi->loop[soa->axis[k]]->drivers, soa->duty_a[k], soa->duty_b[k], soa->duty_c[k]);
+    }
+    for (uint8_t i = 0; disabled != 0; i++, disabled >>= 1) {
+        if ((disabled & 1U) != 0) {
+            hpm_mcl_drivers_update_bldc_duty(multi->loop[i]->drivers, 0, 0, 0);
+        }
+    }
+    if (multi->callback.commit != NULL) {
+        MCL_ASSERT_EXEC_CODE_AND_RETURN(multi->callback.commit() == mcl_success, multi->status = loop_status_fail, mcl_fail);
+    }
+
+    return stat;
+}
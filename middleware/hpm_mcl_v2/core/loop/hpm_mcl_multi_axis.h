@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef HPM_MCL_MULTI_AXIS_H
+#define HPM_MCL_MULTI_AXIS_H
+
+#include "hpm_mcl_loop.h"
+
+/**
+ * @brief Current loop of several foc axes in one pass
+ *
+ * Each axis keeps its own @ref mcl_loop_t with its encoder, analog, control and drivers
+ * modules, set up as for @ref hpm_mcl_loop. The PWM timers of all axes are synchronised and
+ * the current conversions of all axes are started by the same trigger, whose interrupt calls
+ * @ref hpm_mcl_multi_axis_loop once instead of calling @ref hpm_mcl_loop per axis.
+ *
+ * The pass has three phases:
+ * - sampling: the references from the speed and position loops, the currents and the angle
+ *   of every enabled axis are collected into arrays indexed by slot.
+ * - current loop: clarke, sincos, park, the d and q current pi, inverse park and svpwm run
+ *   stage by stage over all slots. The built-in algorithms are inlined, there is no call
+ *   through the method table and the axes are independent, so the stages pipeline.
+ * - pwm update: the duty cycles of all axes are written back to back, then the optional
+ *   commit callback lets the application release the shadow registers of all timers at once.
+ *
+ * The results are those of @ref hpm_mcl_loop in mcl_mode_foc up to rounding: svpwm uses the
+ * min-max form of the centred modulation of hpm_mcl_control_svpwm.
+ *
+ * The gain grows with the number of axes. With one axis the pass only adds the cost of the
+ * slot arrays and is slower than @ref hpm_mcl_loop, by up to about 13% in the
+ * mcl_multi_axis_bench sample; with 2 and 3 axes it is around break-even, from a small loss
+ * to about 15% saved depending on the build; with 4 axes it saves about 15 to 20%. A board
+ * with one axis keeps calling @ref hpm_mcl_loop, and the bench sample measures the crossover
+ * of a given target.
+ */
+
+/**
+ * @brief Called once per pass after the duty cycles of all axes are written
+ *
+ */
+typedef struct {
+    _FUNC_OPTIONAL_ hpm_mcl_stat_t (*commit)(void);
+} mcl_multi_axis_callback_t;
+
+/**
+ * @brief Signals of the enabled axes of one pass, one element per slot
+ *
+ */
+typedef struct {
+    uint8_t axis[MCL_MULTI_AXIS_MAX];   /**< index in mcl_multi_axis_t.loop of each slot */
+    float ia[MCL_MULTI_AXIS_MAX];
+    float ib[MCL_MULTI_AXIS_MAX];
+    float theta[MCL_MULTI_AXIS_MAX];
+#if defined(MCL_CFG_EN_THETA_FORECAST) && MCL_CFG_EN_THETA_FORECAST
+    float theta_forecast[MCL_MULTI_AXIS_MAX];
+#endif
+    float alpha[MCL_MULTI_AXIS_MAX];
+    float beta[MCL_MULTI_AXIS_MAX];
+    float sin_x[MCL_MULTI_AXIS_MAX];
+    float cos_x[MCL_MULTI_AXIS_MAX];
+    float sens_d[MCL_MULTI_AXIS_MAX];
+    float sens_q[MCL_MULTI_AXIS_MAX];
+    float ref_d[MCL_MULTI_AXIS_MAX];
+    float ref_q[MCL_MULTI_AXIS_MAX];
+    float ud[MCL_MULTI_AXIS_MAX];
+    float uq[MCL_MULTI_AXIS_MAX];
+    float vbus[MCL_MULTI_AXIS_MAX];
+    float duty_a[MCL_MULTI_AXIS_MAX];
+    float duty_b[MCL_MULTI_AXIS_MAX];
+    float duty_c[MCL_MULTI_AXIS_MAX];
+} mcl_multi_axis_soa_t;
+
+/**
+ * @brief Multi-axis loop operation data
+ *
+ */
+typedef struct {
+    mcl_loop_status_t status;
+    mcl_loop_t *loop[MCL_MULTI_AXIS_MAX];
+    uint8_t num;
+    mcl_multi_axis_callback_t callback;
+    mcl_multi_axis_soa_t soa;
+    struct {
+        uint8_t slot_num;           /**< enabled axes in the last pass */
+        uint32_t current_loop_tick; /**< cycles of the current loop phase of the last pass */
+    } rundata;
+} mcl_multi_axis_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initialise a multi-axis loop over initialised loops
+ *
+ * Every loop must be in mcl_mode_foc and use the built-in clarke, sincos, park, current pi,
+ * inverse park and svpwm of @ref hpm_mcl_control_init. A loop with user algorithms in these
+ * places keeps running through @ref hpm_mcl_loop.
+ *
+ * @param multi @ref mcl_multi_axis_t
+ * @param loop array of num @ref mcl_loop_t
+ * @param num number of axes, 1 to MCL_MULTI_AXIS_MAX
+ * @param callback @ref mcl_multi_axis_callback_t, may be NULL
+ * @return hpm_mcl_stat_t
+ */
+hpm_mcl_stat_t hpm_mcl_multi_axis_init(mcl_multi_axis_t *multi, mcl_loop_t *const *loop, uint8_t num,
+                                const mcl_multi_axis_callback_t *callback);
+
+/**
+ * @brief Current loop of all axes, called from the interrupt of the common trigger
+ *
+ * hpm_mcl_encoder_process of each axis is called before, as for @ref hpm_mcl_loop. A disabled
+ * axis gets a zero duty cycle. An axis whose speed or position loop fails keeps its duty
+ * cycle and is marked loop_status_fail, the other axes still run.
+ *
+ * @param multi @ref mcl_multi_axis_t
+ * @return hpm_mcl_stat_t mcl_fail if an axis failed
+ */
+hpm_mcl_stat_t hpm_mcl_multi_axis_loop(mcl_multi_axis_t *multi);
+
+/**
+ * @brief Get the cycles of the current loop phase of the last pass, for all axes together
+ *
+ * @param multi @ref mcl_multi_axis_t
+ * @return uint32_t tick
+ */
+static inline uint32_t hpm_mcl_multi_axis_get_current_loop_run_tick(mcl_multi_axis_t *multi)
+{
+#if defined(MCL_EN_LOOP_TIME_COUNT) && MCL_EN_LOOP_TIME_COUNT
+    return multi->rundata.current_loop_tick;
+#else
+    (void)multi;
+    return 0;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -30,8 +30,11 @@ hpm_mcl_stat_t hpm_mcl_encoder_init(mcl_encoder_t *encoder, mcl_cfg_t *mcl_cfg,
      */
     memset(encoder->cal_speed.memory, 0, MCL_ENCODER_CAL_STRUCT_MAX_MEMMORY * sizeof(uint32_t));
     encoder->mcu_clock_tick = &mcl_cfg->physical.time.mcu_clock_tick;
-    encoder->cal_speed.pll_method.cfg = (mcl_encoder_cal_speed_pll_cfg_t *)&encoder_cfg->cal_speed_pll_cfg;
-    encoder->cal_speed.pll_method.period_call_time_s = (float *)&encoder_cfg->period_call_time_s;
+    /* the pll pointers share the union with the state of the other methods */
+    if (encoder_cfg->speed_cal_method == encoder_method_pll) {
+        encoder->cal_speed.pll_method.cfg = (mcl_encoder_cal_speed_pll_cfg_t *)&encoder_cfg->cal_speed_pll_cfg;
+        encoder->cal_speed.pll_method.period_call_time_s = (float *)&encoder_cfg->period_call_time_s;
+    }
     encoder->iirfilter = iir;
     encoder->current_loop_ts = &mcl_cfg->physical.time.current_loop_ts;
     encoder->pole_num = &mcl_cfg->physical.motor.pole_num;
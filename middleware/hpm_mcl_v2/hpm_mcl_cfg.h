@@ -35,8 +35,39 @@
 
 #define MCL_CFG_EN_SENSORLESS_SMC   MCL_EN_SENSORLESS_SMC
 
+/**
+ * @brief Max number of axes run by one multi-axis loop, sets the size of its arrays
+ *
+ */
+#ifndef MCL_MULTI_AXIS_MAX
+#define MCL_MULTI_AXIS_MAX      (4)
+#endif
+
 #ifndef MCL_USER_DEFINED_DEBUG_FIFO
 #define MCL_USER_DEFINED_DEBUG_FIFO (100)
 #endif
 
+/**
+ * @brief Default kernels of sin_x, cos_x, sincos_x and arctan_x
+ *
+ * libm: C library, lut: table and linear interpolation, poly: polynomial approximation
+ */
+#define MCL_TRIG_METHOD_LIBM    (0)
+#define MCL_TRIG_METHOD_LUT     (1)
+#define MCL_TRIG_METHOD_POLY    (2)
+
+#ifndef MCL_TRIG_METHOD
+#define MCL_TRIG_METHOD         MCL_TRIG_METHOD_LIBM
+#endif
+
+#define MCL_CFG_TRIG_METHOD     MCL_TRIG_METHOD
+
+/**
+ * @brief Points per period of the sine table of the lut kernels, must be a power of 2
+ *
+ */
+#ifndef MCL_TRIG_LUT_SIZE
+#define MCL_TRIG_LUT_SIZE       (1024)
+#endif
+
 #endif
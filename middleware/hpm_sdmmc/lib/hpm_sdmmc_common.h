@@ -76,6 +76,7 @@ enum {
     status_sdmmc_no_sd_card_inserted = MAKE_STATUS(status_group_sdmmc, 2),
     status_sdmmc_device_init_required = MAKE_STATUS(status_group_sdmmc, 3),
     status_sdmmc_wait_busy_timeout = MAKE_STATUS(status_group_sdmmc, 4),
+    status_sdmmc_busy = MAKE_STATUS(status_group_sdmmc, 5),
 };
 
 #ifndef HPM_SDMMC_MALLOC
@@ -88,6 +88,8 @@ static hpm_stat_t emmc_send_cmd(const emmc_card_t *card, const sdmmchost_cmd_t *
 
 static hpm_stat_t emmc_transfer(const emmc_card_t *card, const sdmmchost_xfer_t *content);
 
+static hpm_stat_t emmc_handle_transfer_error(const emmc_card_t *card, hpm_stat_t status);
+
 static hpm_stat_t emmc_send_cmd(const emmc_card_t *card, const sdmmchost_cmd_t *cmd)
 {
     hpm_stat_t status = sdmmchost_send_command(card->host, cmd);
@@ -105,6 +107,11 @@ static hpm_stat_t emmc_transfer(const emmc_card_t *card, const sdmmchost_xfer_t
 {
     hpm_stat_t status = sdmmchost_transfer(card->host, content);
 
+    return emmc_handle_transfer_error(card, status);
+}
+
+static hpm_stat_t emmc_handle_transfer_error(const emmc_card_t *card, hpm_stat_t status)
+{
     if ((status >= status_sdxc_busy) && (status <= status_sdxc_tuning_failed)) {
         hpm_stat_t error_recovery_status = emmc_error_recovery(card);
         if (error_recovery_status != status_success) {
@@ -859,7 +866,7 @@ hpm_stat_t emmc_read_blocks(emmc_card_t *card, uint8_t *buffer, uint32_t start_b
 #if !defined(HPM_SDMMC_ENABLE_CACHE_MAINTENANCE) || (HPM_SDMMC_ENABLE_CACHE_MAINTENANCE == 1)
             uint32_t buf_start = (uint32_t) data->rx_data;
             uint32_t aligned_start = HPM_L1C_CACHELINE_ALIGN_DOWN(buf_start);
-            uint32_t end_addr = buf_start + card->device_attribute.sector_size * block_count;
+            uint32_t end_addr = buf_start + card->device_attribute.sector_size * read_block_count;
             uint32_t aligned_end = HPM_L1C_CACHELINE_ALIGN_UP(end_addr);
             uint32_t aligned_size = aligned_end - aligned_start;
             /* FLUSH un-cacheline aligned memory region */
@@ -949,6 +956,124 @@ hpm_stat_t emmc_write_blocks(emmc_card_t *card, const uint8_t *buffer, uint32_t
     return status;
 }
 
+hpm_stat_t emmc_start_read_blocks(emmc_card_t *card, uint8_t *buffer, uint32_t start_block, uint32_t block_count)
+{
+    hpm_stat_t status = emmc_check_card_parameters(card);
+    do {
+        HPM_BREAK_IF(status != status_success);
+
+        if (!card->host->card_init_done) {
+            status = status_sdmmc_device_init_required;
+            break;
+        }
+        if ((block_count == 0) || (block_count > MAX_BLOCK_COUNT)) {
+            status = status_invalid_argument;
+            break;
+        }
+
+        sdmmchost_cmd_t *cmd = &card->host->cmd;
+        sdmmchost_data_t *data = &card->host->data;
+        sdmmchost_xfer_t *content = &card->host->xfer;
+        memset(cmd, 0, sizeof(*cmd));
+        memset(data, 0, sizeof(*data));
+        memset(content, 0, sizeof(*content));
+
+        if (block_count > 1) {
+            cmd->cmd_index = sdmmc_cmd_read_multiple_block;
+            data->enable_auto_cmd23 = true;
+        } else {
+            cmd->cmd_index = sdmmc_cmd_read_single_block;
+        }
+        cmd->resp_type = (sdxc_dev_resp_type_t) sdmmc_resp_r1;
+        cmd->cmd_argument = card->is_byte_addressing_mode ?
+                            start_block * card->device_attribute.sector_size :
+                            start_block;
+        data->block_size = SDMMC_BLOCK_SIZE_DEFAULT;
+        data->block_cnt = block_count;
+        data->rx_data = (uint32_t *) sdmmc_get_sys_addr(card->host, (uint32_t) buffer);
+        content->data = data;
+        content->command = cmd;
+        status = emmc_handle_transfer_error(card, sdmmchost_start_transfer(card->host, content));
+    } while (false);
+
+    return status;
+}
+
+hpm_stat_t emmc_start_write_blocks(emmc_card_t *card, const uint8_t *buffer, uint32_t start_block, uint32_t block_count)
+{
+    hpm_stat_t status = emmc_check_card_parameters(card);
+    do {
+        HPM_BREAK_IF(status != status_success);
+
+        if (!card->host->card_init_done) {
+            status = status_sdmmc_device_init_required;
+            break;
+        }
+        if ((block_count == 0) || (block_count > MAX_BLOCK_COUNT)) {
+            status = status_invalid_argument;
+            break;
+        }
+
+        sdmmchost_cmd_t *cmd = &card->host->cmd;
+        sdmmchost_data_t *data = &card->host->data;
+        sdmmchost_xfer_t *content = &card->host->xfer;
+        memset(cmd, 0, sizeof(*cmd));
+        memset(data, 0, sizeof(*data));
+        memset(content, 0, sizeof(*content));
+
+        if (block_count > 1) {
+            cmd->cmd_index = sdmmc_cmd_write_multiple_block;
+            data->enable_auto_cmd23 = true;
+        } else {
+            cmd->cmd_index = sdmmc_cmd_write_single_block;
+        }
+        cmd->resp_type = (sdxc_dev_resp_type_t) sdmmc_resp_r1;
+        cmd->cmd_argument = card->is_byte_addressing_mode ?
+                            start_block * card->device_attribute.sector_size :
+                            start_block;
+        data->block_size = SDMMC_BLOCK_SIZE_DEFAULT;
+        data->block_cnt = block_count;
+        data->tx_data = (const uint32_t *) sdmmc_get_sys_addr(card->host, (uint32_t) buffer);
+        content->data = data;
+        content->command = cmd;
+        status = emmc_handle_transfer_error(card, sdmmchost_start_transfer(card->host, content));
+    } while (false);
+
+    return status;
+}
+
+hpm_stat_t emmc_check_transfer_done(emmc_card_t *card)
+{
+    hpm_stat_t status = sdmmchost_check_transfer(card->host);
+    if (status == status_sdmmc_busy) {
+        return status;
+    }
+
+    return emmc_handle_transfer_error(card, status);
+}
+
+hpm_stat_t emmc_check_card_busy(emmc_card_t *card)
+{
+    hpm_stat_t status = emmc_check_card_parameters(card);
+    do {
+        HPM_BREAK_IF(status != status_success);
+
+        /* DAT0 stays low while the card is programming, CMD13 is only needed once it is released */
+        if ((sdmmchost_get_data_pin_level(card->host) & 1U) == 0U) {
+            status = status_sdmmc_busy;
+            break;
+        }
+        status = emmc_send_card_status(card);
+        HPM_BREAK_IF(status != status_success);
+        if ((card->current_r1_status.current_state == sdmmc_state_program) ||
+            (card->current_r1_status.ready_for_data == 0U)) {
+            status = status_sdmmc_busy;
+        }
+    } while (false);
+
+    return status;
+}
+
 /**
  * @brief Calculate SD erase timeout value
  * Refer to SD_Specification_Part1_Physical_Layer_Specification_Version4.20.pdf, section 4.14 for more details.
@@ -1025,6 +1150,64 @@ hpm_stat_t emmc_erase_blocks(emmc_card_t *card,
     return status;
 }
 
+hpm_stat_t emmc_start_erase_blocks(emmc_card_t *card,
+                                   uint32_t start_block,
+                                   uint32_t block_count,
+                                   emmc_erase_option_t erase_option,
+                                   uint32_t *timeout_ms)
+{
+    hpm_stat_t status = emmc_check_card_parameters(card);
+    do {
+        HPM_BREAK_IF(status != status_success);
+
+        if (!card->host->card_init_done) {
+            status = status_sdmmc_device_init_required;
+            break;
+        }
+
+        sdmmchost_cmd_t *cmd = &card->host->cmd;
+        memset(cmd, 0, sizeof(*cmd));
+        uint32_t end_block = start_block + block_count - 1U;
+        cmd->cmd_index = emmc_cmd_erase_group_start;
+        cmd->cmd_argument = card->is_byte_addressing_mode ?
+                            start_block * card->device_attribute.sector_size :
+                            start_block;
+        cmd->resp_type = (sdxc_dev_resp_type_t) sdmmc_resp_r1;
+        status = emmc_send_cmd(card, cmd);
+        HPM_BREAK_IF(status != status_success);
+        cmd->cmd_index = emmc_cmd_erase_group_end;
+        cmd->cmd_argument = card->is_byte_addressing_mode ?
+                            end_block * card->device_attribute.sector_size :
+                            end_block;
+        status = emmc_send_cmd(card, cmd);
+        HPM_BREAK_IF(status != status_success);
+
+        uint32_t argument = 0;
+        switch (erase_option) {
+        default:
+            argument = 0;
+            break;
+        case emmc_erase_option_discard:
+            argument = 3;
+            break;
+        case emmc_erase_option_trim:
+            argument = 1;
+            break;
+        }
+        /* Sent as R1 so the host doesn't wait for the busy signal, it is polled by emmc_check_card_busy() instead */
+        cmd->cmd_index = sdmmc_cmd_erase;
+        cmd->cmd_argument = argument;
+        status = emmc_send_cmd(card, cmd);
+        HPM_BREAK_IF(status != status_success);
+
+        if (timeout_ms != NULL) {
+            *timeout_ms = emmc_calculate_erase_timeout(card, start_block, block_count);
+        }
+    } while (false);
+
+    return status;
+}
+
 hpm_stat_t emmc_polling_card_status_busy(emmc_card_t *card, uint32_t timeout_ms)
 {
     hpm_stat_t status = status_invalid_argument;
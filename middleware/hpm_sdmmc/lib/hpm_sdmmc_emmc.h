@@ -819,6 +819,75 @@ hpm_stat_t emmc_write_blocks(emmc_card_t *card, const uint8_t *buffer, uint32_t
  */
 hpm_stat_t emmc_erase_blocks(emmc_card_t *card, uint32_t start_block, uint32_t block_count, emmc_erase_option_t option);
 
+/**
+ * @brief Start reading eMMC blocks without waiting for the data
+ *
+ * The caller polls emmc_check_transfer_done() afterwards and takes care of the cache maintenance of @p buffer.
+ * No other command may be sent to the device until the transfer is done.
+ *
+ * @param [in,out] card eMMC card context
+ * @param [out] buffer Buffer to hold the data
+ * @param [in] start_block Start block index
+ * @param [in] block_count Number of blocks to be read
+ *
+ * @return Command Execution status
+ */
+hpm_stat_t emmc_start_read_blocks(emmc_card_t *card, uint8_t *buffer, uint32_t start_block, uint32_t block_count);
+
+/**
+ * @brief Start writing eMMC blocks without waiting for the data or the programming
+ *
+ * The caller polls emmc_check_transfer_done() and then emmc_check_card_busy() before the next data command, and
+ * takes care of the cache maintenance of @p buffer.
+ *
+ * @param [in,out] card eMMC card context
+ * @param [in] buffer Buffer to be written
+ * @param [in] start_block Start block index
+ * @param [in] block_count Number of blocks to be written
+ *
+ * @return Command Execution status
+ */
+hpm_stat_t emmc_start_write_blocks(emmc_card_t *card, const uint8_t *buffer, uint32_t start_block, uint32_t block_count);
+
+/**
+ * @brief Start erasing eMMC blocks without waiting for the device
+ *
+ * The caller polls emmc_check_card_busy() until the erase is finished.
+ *
+ * @param [in,out] card eMMC card context
+ * @param [in] start_block Start block index
+ * @param [in] block_count Number of blocks to be erased
+ * @param [in] option Erase option
+ * @param [out] timeout_ms Time the erase may take, can be NULL
+ *
+ * @return Command Execution status
+ */
+hpm_stat_t emmc_start_erase_blocks(emmc_card_t *card,
+                                   uint32_t start_block,
+                                   uint32_t block_count,
+                                   emmc_erase_option_t option,
+                                   uint32_t *timeout_ms);
+
+/**
+ * @brief Check the data phase started by emmc_start_read_blocks() or emmc_start_write_blocks()
+ *
+ * @param [in,out] card eMMC card context
+ *
+ * @retval status_sdmmc_busy The data is still being transferred
+ * @return Transfer execution status otherwise
+ */
+hpm_stat_t emmc_check_transfer_done(emmc_card_t *card);
+
+/**
+ * @brief Check whether the eMMC device is still programming or erasing, without blocking
+ *
+ * @param [in,out] card eMMC card context
+ *
+ * @retval status_sdmmc_busy The device is busy
+ * @retval status_success The device is ready for the next data command
+ */
+hpm_stat_t emmc_check_card_busy(emmc_card_t *card);
+
 /**
  * @brief Switch eMMC device into sleep mode
  *
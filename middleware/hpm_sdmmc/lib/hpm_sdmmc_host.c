@@ -356,7 +356,7 @@ hpm_stat_t sdmmchost_send_command(sdmmc_host_t *host, const sdmmchost_cmd_t *cmd
     return status;
 }
 
-hpm_stat_t sdmmchost_transfer(sdmmc_host_t *host, const sdmmchost_xfer_t *content)
+hpm_stat_t sdmmchost_start_transfer(sdmmc_host_t *host, const sdmmchost_xfer_t *content)
 {
     hpm_stat_t status;
 
@@ -373,7 +373,7 @@ hpm_stat_t sdmmchost_transfer(sdmmc_host_t *host, const sdmmchost_xfer_t *conten
 
         SDXC_Type *base = host->host_param.base;
         sdxc_adma_config_t dma_config = { 0 };
-        uint32_t timeout_ms = HPM_SDMMC_HOST_TIMEOUT_DEFAULT;
+        host->xfer_timeout_ms = HPM_SDMMC_HOST_TIMEOUT_DEFAULT;
         if (content->data != NULL) {
 #if defined(HPM_SDMMC_USE_ADMA2) && (HPM_SDMMC_USE_ADMA2 == 1)
             dma_config.dma_type = sdxc_dmasel_adma2;
@@ -394,8 +394,8 @@ hpm_stat_t sdmmchost_transfer(sdmmc_host_t *host, const sdmmchost_xfer_t *conten
             uint32_t block_cnt = content->data->block_cnt;
             uint32_t block_size = content->data->block_size;
             uint32_t read_write_size = block_cnt * block_size;
-            timeout_ms = (uint32_t) (1.0f * read_write_size / tx_rx_bytes_per_sec) * 1000 + 500;
-            sdxc_set_data_timeout(base, timeout_ms, NULL);
+            host->xfer_timeout_ms = (uint32_t) (1.0f * read_write_size / tx_rx_bytes_per_sec) * 1000 + 500;
+            sdxc_set_data_timeout(base, host->xfer_timeout_ms, NULL);
         }
 
         if (dma_config.dma_type == sdxc_dmasel_adma3) {
@@ -414,12 +414,47 @@ hpm_stat_t sdmmchost_transfer(sdmmc_host_t *host, const sdmmchost_xfer_t *conten
         }
 
         status = sdxc_parse_interrupt_status(base);
+    } while (false);
+
+    return status;
+}
+
+hpm_stat_t sdmmchost_check_transfer(sdmmc_host_t *host)
+{
+    SDMMCHOST_Type *base = host->host_param.base;
+    const uint32_t event_to_wait = SDXC_INT_STAT_XFER_COMPLETE_MASK | SDXC_INT_STAT_ERR_INTERRUPT_MASK;
+
+#if defined(HPM_SDMMC_HOST_ENABLE_IRQ) && (HPM_SDMMC_HOST_ENABLE_IRQ == 1)
+    if (hpm_sdmmc_osal_event_wait(host, host->xfer_done_or_error_event, event_to_wait, 0) != status_success) {
+        return status_sdmmc_busy;
+    }
+#else
+    if (!IS_HPM_BITMASK_SET(sdxc_get_interrupt_status(base), event_to_wait)) {
+        return status_sdmmc_busy;
+    }
+#endif
+
+    hpm_stat_t status = sdxc_parse_interrupt_status(base);
+    sdxc_clear_interrupt_status(base, event_to_wait);
+    if (status == status_success) {
+        status = sdxc_receive_cmd_response(base, &host->cmd);
+    }
+
+    return status;
+}
+
+hpm_stat_t sdmmchost_transfer(sdmmc_host_t *host, const sdmmchost_xfer_t *content)
+{
+    hpm_stat_t status;
+
+    do {
+        status = sdmmchost_start_transfer(host, content);
         if (status != status_success) {
             break;
         }
 
         if (content->data != NULL) {
-            status = sdmmchost_wait_xfer_done(host, timeout_ms);
+            status = sdmmchost_wait_xfer_done(host, host->xfer_timeout_ms);
             if (status != status_success) {
                 break;
             }
@@ -217,6 +217,7 @@ typedef struct {
     /* Host run-time fields */
     bool card_inserted;
     bool card_init_done;
+    uint32_t xfer_timeout_ms;                           /* Data timeout of the last transfer */
     void (*sdio_irq_handler)(void *param);
     void *sdio_irq_param;
 #if defined(HPM_SDMMC_HOST_ENABLE_IRQ) && (HPM_SDMMC_HOST_ENABLE_IRQ == 1)
@@ -286,6 +287,28 @@ hpm_stat_t sdmmchost_send_command(sdmmc_host_t *host, const sdmmchost_cmd_t *cmd
  */
 hpm_stat_t sdmmchost_transfer(sdmmc_host_t *host, const sdmmchost_xfer_t *content);
 
+/**
+ * @brief Start a transfer without waiting for the data phase
+ *
+ * Returns once the command has been accepted. The data phase is then tracked via sdmmchost_check_transfer().
+ * The host context and the data buffer must stay untouched until the transfer is done.
+ *
+ * @param [in] host Host context
+ * @param [in] content Transfer context
+ *
+ * @return Command execution status
+ */
+hpm_stat_t sdmmchost_start_transfer(sdmmc_host_t *host, const sdmmchost_xfer_t *content);
+
+/**
+ * @brief Check the data phase of a transfer started by sdmmchost_start_transfer()
+ * @param [in] host Host context
+ *
+ * @retval status_sdmmc_busy The data phase is still ongoing
+ * @return Transfer execution status otherwise
+ */
+hpm_stat_t sdmmchost_check_transfer(sdmmc_host_t *host);
+
 /**
  * @brief Check whether the card is detected or not
  * @param [in] host Host context
@@ -40,7 +40,8 @@ ATTR_WEAK hpm_stat_t hpm_sdmmc_osal_event_wait(void *ctx, hpm_sdmmc_osal_event_t
     uint32_t ticks_per_sec = osKernelGetTickFreq();
     uint32_t timeout_ticks = (timeout * ticks_per_sec + 999UL) / 1000UL;
     uint32_t err = osEventFlagsWait(event, flags, osFlagsWaitAny, timeout_ticks);
-    if (err == osErrorTimeout) {
+    /* a zero timeout reports unset flags as a resource error */
+    if ((err == osFlagsErrorTimeout) || (err == osFlagsErrorResource)) {
         return status_timeout;
     }
     return status_success;
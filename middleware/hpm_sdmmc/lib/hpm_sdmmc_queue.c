@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "hpm_sdmmc_queue.h"
+#include "hpm_sdmmc_common.h"
+#include "hpm_sdmmc_osal.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_clock_drv.h"
+#include "hpm_csr_drv.h"
+
+/* Margin on top of the data timeout programmed into the host */
+#define QUEUE_XFER_TIMEOUT_MARGIN_MS (100U)
+
+static hpm_stat_t queue_sd_start_read(void *card, uint8_t *buffer, uint32_t start_block, uint32_t block_count)
+{
+    return sd_start_read_blocks((sd_card_t *) card, buffer, start_block, block_count);
+}
+
+static hpm_stat_t queue_sd_start_write(void *card, const uint8_t *buffer, uint32_t start_block, uint32_t block_count)
+{
+    return sd_start_write_blocks((sd_card_t *) card, buffer, start_block, block_count);
+}
+
+static hpm_stat_t queue_sd_start_erase(void *card, uint32_t start_block, uint32_t block_count, uint32_t *timeout_ms)
+{
+    return sd_start_erase_blocks((sd_card_t *) card, start_block, block_count, timeout_ms);
+}
+
+static hpm_stat_t queue_sd_check_transfer_done(void *card)
+{
+    return sd_check_transfer_done((sd_card_t *) card);
+}
+
+static hpm_stat_t queue_sd_check_card_busy(void *card)
+{
+    return sd_check_card_busy((sd_card_t *) card);
+}
+
+static const hpm_sdmmc_queue_ops_t queue_sd_ops = {
+    .start_read = queue_sd_start_read,
+    .start_write = queue_sd_start_write,
+    .start_erase = queue_sd_start_erase,
+    .check_transfer_done = queue_sd_check_transfer_done,
+    .check_card_busy = queue_sd_check_card_busy,
+};
+
+static hpm_stat_t queue_emmc_start_read(void *card, uint8_t *buffer, uint32_t start_block, uint32_t block_count)
+{
+    return emmc_start_read_blocks((emmc_card_t *) card, buffer, start_block, block_count);
+}
+
+static hpm_stat_t queue_emmc_start_write(void *card, const uint8_t *buffer, uint32_t start_block, uint32_t block_count)
+{
+    return emmc_start_write_blocks((emmc_card_t *) card, buffer, start_block, block_count);
+}
+
+static hpm_stat_t queue_emmc_start_erase(void *card, uint32_t start_block, uint32_t block_count, uint32_t *timeout_ms)
+{
+    return emmc_start_erase_blocks((emmc_card_t *) card, start_block, block_count,
+                                   HPM_SDMMC_QUEUE_EMMC_ERASE_OPTION, timeout_ms);
+}
+
+static hpm_stat_t queue_emmc_check_transfer_done(void *card)
+{
+    return emmc_check_transfer_done((emmc_card_t *) card);
+}
+
+static hpm_stat_t queue_emmc_check_card_busy(void *card)
+{
+    return emmc_check_card_busy((emmc_card_t *) card);
+}
+
+static const hpm_sdmmc_queue_ops_t queue_emmc_ops = {
+    .start_read = queue_emmc_start_read,
+    .start_write = queue_emmc_start_write,
+    .start_erase = queue_emmc_start_erase,
+    .check_transfer_done = queue_emmc_check_transfer_done,
+    .check_card_busy = queue_emmc_check_card_busy,
+};
+
+static hpm_stat_t queue_init(hpm_sdmmc_queue_t *queue, const hpm_sdmmc_queue_ops_t *ops, void *card,
+                             sdmmc_host_t *host)
+{
+    if ((queue == NULL) || (card == NULL) || (host == NULL)) {
+        return status_invalid_argument;
+    }
+
+    memset(queue, 0, sizeof(*queue));
+    queue->ops = ops;
+    queue->card = card;
+    queue->host = host;
+    queue->ticks_per_ms = clock_get_core_clock_ticks_per_ms();
+
+    return status_success;
+}
+
+static void queue_set_deadline(hpm_sdmmc_queue_t *queue, uint32_t timeout_ms)
+{
+    queue->deadline = hpm_csr_get_core_mcycle() + (uint64_t) timeout_ms * queue->ticks_per_ms;
+}
+
+static bool queue_is_expired(const hpm_sdmmc_queue_t *queue)
+{
+    return hpm_csr_get_core_mcycle() > queue->deadline;
+}
+
+/*
+ * Cache maintenance of the request buffers, the start APIs leave it to the caller. The lines of a write buffer are
+ * written back as soon as the request joins a batch, lines a read shares with other data before the command.
+ */
+static void queue_prepare_cache(const hpm_sdmmc_queue_t *queue, const hpm_sdmmc_req_t *req)
+{
+#if !defined(HPM_SDMMC_ENABLE_CACHE_MAINTENANCE) || (HPM_SDMMC_ENABLE_CACHE_MAINTENANCE == 1)
+    uint32_t start = sdmmc_get_sys_addr(queue->host, (uint32_t) req->buffer);
+    uint32_t end = start + req->block_count * SDMMC_BLOCK_SIZE_DEFAULT;
+    uint32_t aligned_start = HPM_L1C_CACHELINE_ALIGN_DOWN(start);
+    uint32_t aligned_end = HPM_L1C_CACHELINE_ALIGN_UP(end);
+
+    if (req->type == hpm_sdmmc_req_write) {
+        l1c_dc_writeback(aligned_start, aligned_end - aligned_start);
+    } else if (req->type == hpm_sdmmc_req_read) {
+        if ((start % HPM_L1C_CACHELINE_SIZE) != 0) {
+            l1c_dc_writeback(aligned_start, HPM_L1C_CACHELINE_SIZE);
+        }
+        if ((end % HPM_L1C_CACHELINE_SIZE) != 0) {
+            l1c_dc_writeback(HPM_L1C_CACHELINE_ALIGN_DOWN(end), HPM_L1C_CACHELINE_SIZE);
+        }
+    }
+#else
+    (void) queue;
+    (void) req;
+#endif
+}
+
+static void queue_finish_cache(const hpm_sdmmc_queue_t *queue, const hpm_sdmmc_batch_t *batch)
+{
+#if !defined(HPM_SDMMC_ENABLE_CACHE_MAINTENANCE) || (HPM_SDMMC_ENABLE_CACHE_MAINTENANCE == 1)
+    if (batch->type == hpm_sdmmc_req_read) {
+        uint32_t start = sdmmc_get_sys_addr(queue->host, (uint32_t) batch->buffer);
+        uint32_t aligned_start = HPM_L1C_CACHELINE_ALIGN_DOWN(start);
+        uint32_t aligned_end = HPM_L1C_CACHELINE_ALIGN_UP(start + batch->block_count * SDMMC_BLOCK_SIZE_DEFAULT);
+        l1c_dc_invalidate(aligned_start, aligned_end - aligned_start);
+    }
+#else
+    (void) queue;
+    (void) batch;
+#endif
+}
+
+static bool queue_can_merge(const hpm_sdmmc_batch_t *batch, const hpm_sdmmc_req_t *req)
+{
+    if ((req->type != batch->type) || (req->start_block != batch->start_block + batch->block_count) ||
+        (batch->block_count + req->block_count > HPM_SDMMC_QUEUE_MAX_MERGE_BLOCKS)) {
+        return false;
+    }
+    if (req->type == hpm_sdmmc_req_erase) {
+        return true;
+    }
+    return req->buffer == batch->buffer + batch->block_count * SDMMC_BLOCK_SIZE_DEFAULT;
+}
+
+/* Move the requests at the head of the pending list into the batch as long as they are adjacent */
+static void queue_fill_batch(hpm_sdmmc_queue_t *queue, hpm_sdmmc_batch_t *batch)
+{
+    while (true) {
+        hpm_sdmmc_osal_enter_critical(queue->host);
+        hpm_sdmmc_req_t *req = queue->pending_head;
+        if ((req == NULL) || ((batch->head != NULL) && !queue_can_merge(batch, req))) {
+            hpm_sdmmc_osal_exit_critical(queue->host);
+            break;
+        }
+        queue->pending_head = req->next;
+        if (queue->pending_head == NULL) {
+            queue->pending_tail = NULL;
+        }
+        hpm_sdmmc_osal_exit_critical(queue->host);
+
+        req->next = NULL;
+        queue_prepare_cache(queue, req);
+        if (batch->head == NULL) {
+            batch->head = req;
+            batch->type = req->type;
+            batch->buffer = req->buffer;
+            batch->start_block = req->start_block;
+            batch->block_count = req->block_count;
+        } else {
+            batch->tail->next = req;
+            batch->block_count += req->block_count;
+            queue->stats.merged++;
+        }
+        batch->tail = req;
+    }
+}
+
+static void queue_complete_batch(hpm_sdmmc_queue_t *queue, hpm_sdmmc_batch_t *batch, hpm_stat_t status)
+{
+    hpm_sdmmc_req_t *req = batch->head;
+
+    memset(batch, 0, sizeof(*batch));
+    if (status != status_success) {
+        queue->stats.errors++;
+    }
+    while (req != NULL) {
+        hpm_sdmmc_req_t *next = req->next;
+        req->next = NULL;
+        queue->stats.requests++;
+        if (req->callback != NULL) {
+            req->callback(req, status);
+        }
+        req = next;
+    }
+}
+
+/* Issue the prepared batch, or the next one from the pending list, until a command is accepted */
+static void queue_start_next(hpm_sdmmc_queue_t *queue)
+{
+    hpm_stat_t status;
+
+    while (queue->state == hpm_sdmmc_queue_state_idle) {
+        if (queue->next.head != NULL) {
+            queue->active = queue->next;
+            memset(&queue->next, 0, sizeof(queue->next));
+        } else {
+            queue_fill_batch(queue, &queue->active);
+        }
+        /* late requests adjacent to the prepared batch still join it */
+        queue_fill_batch(queue, &queue->active);
+
+        hpm_sdmmc_batch_t *batch = &queue->active;
+        if (batch->head == NULL) {
+            break;
+        }
+
+        queue->stats.commands++;
+        if (batch->type == hpm_sdmmc_req_erase) {
+            uint32_t timeout_ms = 0;
+            status = queue->ops->start_erase(queue->card, batch->start_block, batch->block_count, &timeout_ms);
+            if (status == status_success) {
+                queue->state = hpm_sdmmc_queue_state_busy;
+                queue_set_deadline(queue, timeout_ms);
+            }
+        } else {
+            if (batch->type == hpm_sdmmc_req_read) {
+                status = queue->ops->start_read(queue->card, batch->buffer, batch->start_block, batch->block_count);
+            } else {
+                status = queue->ops->start_write(queue->card, batch->buffer, batch->start_block, batch->block_count);
+            }
+            if (status == status_success) {
+                queue->state = hpm_sdmmc_queue_state_xfer;
+                queue_set_deadline(queue, queue->host->xfer_timeout_ms + QUEUE_XFER_TIMEOUT_MARGIN_MS);
+            }
+        }
+        if (status != status_success) {
+            queue_complete_batch(queue, batch, status);
+        }
+    }
+}
+
+hpm_stat_t hpm_sdmmc_queue_init_sd(hpm_sdmmc_queue_t *queue, sd_card_t *card)
+{
+    return queue_init(queue, &queue_sd_ops, card, (card != NULL) ? card->host : NULL);
+}
+
+hpm_stat_t hpm_sdmmc_queue_init_emmc(hpm_sdmmc_queue_t *queue, emmc_card_t *card)
+{
+    return queue_init(queue, &queue_emmc_ops, card, (card != NULL) ? card->host : NULL);
+}
+
+hpm_stat_t hpm_sdmmc_queue_submit(hpm_sdmmc_queue_t *queue, hpm_sdmmc_req_t *req)
+{
+    if ((queue == NULL) || (req == NULL) || (req->block_count == 0) || (req->type > hpm_sdmmc_req_erase)) {
+        return status_invalid_argument;
+    }
+    if ((req->type != hpm_sdmmc_req_erase) && ((req->buffer == NULL) || (((uint32_t) req->buffer % 4U) != 0))) {
+        return status_invalid_argument;
+    }
+
+    req->next = NULL;
+    hpm_sdmmc_osal_enter_critical(queue->host);
+    if (queue->pending_tail != NULL) {
+        queue->pending_tail->next = req;
+    } else {
+        queue->pending_head = req;
+    }
+    queue->pending_tail = req;
+    hpm_sdmmc_osal_exit_critical(queue->host);
+
+    return status_success;
+}
+
+bool hpm_sdmmc_queue_process(hpm_sdmmc_queue_t *queue)
+{
+    hpm_stat_t status;
+
+    switch (queue->state) {
+    case hpm_sdmmc_queue_state_xfer:
+        status = queue->ops->check_transfer_done(queue->card);
+        if (status == status_sdmmc_busy) {
+            if (!queue_is_expired(queue)) {
+                break;
+            }
+            sdmmchost_error_recovery(queue->host, NULL);
+            status = status_timeout;
+        }
+        queue_finish_cache(queue, &queue->active);
+        if ((status == status_success) && (queue->active.type == hpm_sdmmc_req_write)) {
+            /* report the write once the card has programmed it */
+            queue->state = hpm_sdmmc_queue_state_busy;
+            queue_set_deadline(queue, HPM_SDMMC_QUEUE_WRITE_BUSY_TIMEOUT_MS);
+            break;
+        }
+        queue->state = hpm_sdmmc_queue_state_idle;
+        queue_complete_batch(queue, &queue->active, status);
+        break;
+    case hpm_sdmmc_queue_state_busy:
+        status = queue->ops->check_card_busy(queue->card);
+        if (status == status_sdmmc_busy) {
+            /* the bus is free while the card programs, get the next command ready meanwhile */
+            bool had_next = (queue->next.head != NULL);
+            queue_fill_batch(queue, &queue->next);
+            if (!had_next && (queue->next.head != NULL)) {
+                queue->stats.prepared_in_busy++;
+            }
+            if (!queue_is_expired(queue)) {
+                break;
+            }
+            status = status_sdmmc_wait_busy_timeout;
+        }
+        queue->state = hpm_sdmmc_queue_state_idle;
+        queue_complete_batch(queue, &queue->active, status);
+        break;
+    default:
+        break;
+    }
+
+    queue_start_next(queue);
+
+    return queue->state != hpm_sdmmc_queue_state_idle;
+}
+
+bool hpm_sdmmc_queue_is_idle(const hpm_sdmmc_queue_t *queue)
+{
+    return (queue->state == hpm_sdmmc_queue_state_idle) && (queue->pending_head == NULL) &&
+           (queue->next.head == NULL);
+}
+
+hpm_stat_t hpm_sdmmc_queue_flush(hpm_sdmmc_queue_t *queue, uint32_t timeout_ms)
+{
+    uint64_t deadline = hpm_csr_get_core_mcycle() + (uint64_t) timeout_ms * queue->ticks_per_ms;
+
+    while (true) {
+        hpm_sdmmc_queue_process(queue);
+        if (hpm_sdmmc_queue_is_idle(queue)) {
+            return status_success;
+        }
+        if (hpm_csr_get_core_mcycle() > deadline) {
+            return status_timeout;
+        }
+    }
+}
+
+void hpm_sdmmc_queue_get_stats(const hpm_sdmmc_queue_t *queue, hpm_sdmmc_queue_stats_t *stats)
+{
+    *stats = queue->stats;
+}
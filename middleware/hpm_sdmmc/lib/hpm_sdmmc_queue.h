@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_SDMMC_QUEUE_H
+#define HPM_SDMMC_QUEUE_H
+
+/**
+ *
+ * @brief HPM SDMMC asynchronous request queue
+ * @defgroup hpm_sdmmc HPM SDMMC stack
+ *  @ingroup hpm_sdmmc_interfaces
+ * @{
+ *
+ */
+
+#include "hpm_common.h"
+#include "hpm_sdmmc_host.h"
+#include "hpm_sdmmc_sd.h"
+#include "hpm_sdmmc_emmc.h"
+
+/* Largest transfer built by merging adjacent requests, in blocks */
+#ifndef HPM_SDMMC_QUEUE_MAX_MERGE_BLOCKS
+#define HPM_SDMMC_QUEUE_MAX_MERGE_BLOCKS        (2048U)
+#endif
+
+/* Time the card may stay busy after a write */
+#ifndef HPM_SDMMC_QUEUE_WRITE_BUSY_TIMEOUT_MS
+#define HPM_SDMMC_QUEUE_WRITE_BUSY_TIMEOUT_MS   (1000U)
+#endif
+
+/* Operation used for erase requests on eMMC devices */
+#ifndef HPM_SDMMC_QUEUE_EMMC_ERASE_OPTION
+#define HPM_SDMMC_QUEUE_EMMC_ERASE_OPTION       emmc_erase_option_erase
+#endif
+
+typedef enum {
+    hpm_sdmmc_req_read = 0,
+    hpm_sdmmc_req_write = 1,
+    hpm_sdmmc_req_erase = 2,
+} hpm_sdmmc_req_type_t;
+
+typedef struct hpm_sdmmc_req hpm_sdmmc_req_t;
+
+/**
+ * @brief Request completion callback, called from hpm_sdmmc_queue_process()
+ *
+ * The request may be submitted again from the callback.
+ */
+typedef void (*hpm_sdmmc_req_callback_t)(hpm_sdmmc_req_t *req, hpm_stat_t status);
+
+/**
+ * @brief Block I/O request
+ *
+ * Owned by the queue from hpm_sdmmc_queue_submit() until its callback is called.
+ */
+struct hpm_sdmmc_req {
+    hpm_sdmmc_req_type_t type;
+    uint8_t *buffer;                        /* Word aligned data buffer, not used by erase requests */
+    uint32_t start_block;
+    uint32_t block_count;
+    hpm_sdmmc_req_callback_t callback;      /* Can be NULL */
+    void *user_data;
+    hpm_sdmmc_req_t *next;                  /* Private */
+};
+
+typedef struct {
+    hpm_stat_t (*start_read)(void *card, uint8_t *buffer, uint32_t start_block, uint32_t block_count);
+    hpm_stat_t (*start_write)(void *card, const uint8_t *buffer, uint32_t start_block, uint32_t block_count);
+    hpm_stat_t (*start_erase)(void *card, uint32_t start_block, uint32_t block_count, uint32_t *timeout_ms);
+    hpm_stat_t (*check_transfer_done)(void *card);
+    hpm_stat_t (*check_card_busy)(void *card);
+} hpm_sdmmc_queue_ops_t;
+
+/**
+ * @brief Adjacent requests merged into one command
+ */
+typedef struct {
+    hpm_sdmmc_req_t *head;
+    hpm_sdmmc_req_t *tail;
+    hpm_sdmmc_req_type_t type;
+    uint8_t *buffer;
+    uint32_t start_block;
+    uint32_t block_count;
+} hpm_sdmmc_batch_t;
+
+typedef enum {
+    hpm_sdmmc_queue_state_idle = 0,
+    hpm_sdmmc_queue_state_xfer = 1,         /* Data phase of the active batch */
+    hpm_sdmmc_queue_state_busy = 2,         /* Card programming or erasing the active batch */
+} hpm_sdmmc_queue_state_t;
+
+typedef struct {
+    uint32_t commands;                      /* Read/write/erase commands issued */
+    uint32_t requests;                      /* Requests completed */
+    uint32_t merged;                        /* Requests merged into the command of an earlier one */
+    uint32_t prepared_in_busy;              /* Commands prepared while the card was busy */
+    uint32_t errors;                        /* Commands that failed */
+} hpm_sdmmc_queue_stats_t;
+
+typedef struct {
+    const hpm_sdmmc_queue_ops_t *ops;
+    void *card;
+    sdmmc_host_t *host;
+    hpm_sdmmc_req_t *pending_head;
+    hpm_sdmmc_req_t *pending_tail;
+    hpm_sdmmc_batch_t active;
+    hpm_sdmmc_batch_t next;                 /* Taken from the pending list while the card is busy */
+    hpm_sdmmc_queue_state_t state;
+    uint64_t deadline;
+    uint32_t ticks_per_ms;
+    hpm_sdmmc_queue_stats_t stats;
+} hpm_sdmmc_queue_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initialize a request queue for an initialized SD card
+ *
+ * While the queue is in use, the blocking SD APIs must not be called for the same card.
+ *
+ * @param [out] queue Queue context
+ * @param [in] card SD card context
+ *
+ * @return status_success or status_invalid_argument
+ */
+hpm_stat_t hpm_sdmmc_queue_init_sd(hpm_sdmmc_queue_t *queue, sd_card_t *card);
+
+/**
+ * @brief Initialize a request queue for an initialized eMMC device
+ *
+ * While the queue is in use, the blocking eMMC APIs must not be called for the same device.
+ *
+ * @param [out] queue Queue context
+ * @param [in] card eMMC card context
+ *
+ * @return status_success or status_invalid_argument
+ */
+hpm_stat_t hpm_sdmmc_queue_init_emmc(hpm_sdmmc_queue_t *queue, emmc_card_t *card);
+
+/**
+ * @brief Append a request to the queue
+ *
+ * May be called from another task than the one processing the queue. A request that starts right after the
+ * previous one, on the card and in memory, is merged into its command.
+ *
+ * @param [in,out] queue Queue context
+ * @param [in] req Request, must stay valid until its callback is called
+ *
+ * @return status_success or status_invalid_argument
+ */
+hpm_stat_t hpm_sdmmc_queue_submit(hpm_sdmmc_queue_t *queue, hpm_sdmmc_req_t *req);
+
+/**
+ * @brief Advance the queue without blocking
+ *
+ * Call it from a task or the main loop. It only waits for short command responses, never for data or for the
+ * card programming. Completion callbacks are called from here.
+ *
+ * @param [in,out] queue Queue context
+ *
+ * @return true if a command is still in progress
+ */
+bool hpm_sdmmc_queue_process(hpm_sdmmc_queue_t *queue);
+
+/**
+ * @brief Check whether all submitted requests are completed
+ *
+ * @param [in] queue Queue context
+ *
+ * @return true if the queue is idle and empty
+ */
+bool hpm_sdmmc_queue_is_idle(const hpm_sdmmc_queue_t *queue);
+
+/**
+ * @brief Process the queue until all submitted requests are completed
+ *
+ * @param [in,out] queue Queue context
+ * @param [in] timeout_ms Timeout in milliseconds
+ *
+ * @return status_success or status_timeout
+ */
+hpm_stat_t hpm_sdmmc_queue_flush(hpm_sdmmc_queue_t *queue, uint32_t timeout_ms);
+
+/**
+ * @brief Get the counters of a queue
+ *
+ * @param [in] queue Queue context
+ * @param [out] stats Counters since init
+ */
+void hpm_sdmmc_queue_get_stats(const hpm_sdmmc_queue_t *queue, hpm_sdmmc_queue_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* HPM_SDMMC_QUEUE_H */
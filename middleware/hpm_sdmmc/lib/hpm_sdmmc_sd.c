@@ -82,6 +82,8 @@ static hpm_stat_t sd_send_cmd(const sd_card_t *card, const sdmmchost_cmd_t *cmd)
 
 static hpm_stat_t sd_transfer(const sd_card_t *card, const sdmmchost_xfer_t *content);
 
+static hpm_stat_t sd_handle_transfer_error(const sd_card_t *card, const sdmmchost_xfer_t *content, hpm_stat_t status);
+
 static hpm_stat_t sd_send_cmd(const sd_card_t *card, const sdmmchost_cmd_t *cmd)
 {
     hpm_stat_t status = sdmmchost_send_command(card->host, cmd);
@@ -99,6 +101,11 @@ static hpm_stat_t sd_transfer(const sd_card_t *card, const sdmmchost_xfer_t *con
 {
     hpm_stat_t status = sdmmchost_transfer(card->host, content);
 
+    return sd_handle_transfer_error(card, content, status);
+}
+
+static hpm_stat_t sd_handle_transfer_error(const sd_card_t *card, const sdmmchost_xfer_t *content, hpm_stat_t status)
+{
     if ((status >= status_sdxc_busy) && (status <= status_sdxc_tuning_failed)) {
         /* According to IP block this condition can be ignored */
         bool ignore_error = content->data->enable_auto_cmd12 &&
@@ -927,7 +934,7 @@ hpm_stat_t sd_read_blocks(sd_card_t *card, uint8_t *buffer, uint32_t start_block
 #if !defined(HPM_SDMMC_ENABLE_CACHE_MAINTENANCE) || (HPM_SDMMC_ENABLE_CACHE_MAINTENANCE == 1)
             uint32_t buf_start = (uint32_t) data->rx_data;
             uint32_t aligned_start = HPM_L1C_CACHELINE_ALIGN_DOWN(buf_start);
-            uint32_t end_addr = buf_start + card->block_size * block_count;
+            uint32_t end_addr = buf_start + card->block_size * read_block_count;
             uint32_t aligned_end = HPM_L1C_CACHELINE_ALIGN_UP(end_addr);
             uint32_t aligned_size = aligned_end - aligned_start;
             /* FLUSH un-cacheline aligned memory region */
@@ -1028,6 +1035,141 @@ hpm_stat_t sd_write_blocks(sd_card_t *card, const uint8_t *buffer, uint32_t star
     return status;
 }
 
+hpm_stat_t sd_start_read_blocks(sd_card_t *card, uint8_t *buffer, uint32_t start_block, uint32_t block_count)
+{
+    hpm_stat_t status = sd_check_card_parameters(card);
+    do {
+        HPM_BREAK_IF(status != status_success);
+
+        if (!card->host->card_init_done) {
+            status = status_sdmmc_device_init_required;
+            break;
+        }
+        if ((block_count == 0) || (block_count > MAX_BLOCK_COUNT)) {
+            status = status_invalid_argument;
+            break;
+        }
+
+        sdmmchost_cmd_t *cmd = &card->host->cmd;
+        sdmmchost_data_t *data = &card->host->data;
+        sdmmchost_xfer_t *content = &card->host->xfer;
+        memset(cmd, 0, sizeof(*cmd));
+        memset(data, 0, sizeof(*data));
+        memset(content, 0, sizeof(*content));
+
+        if (block_count > 1) {
+            cmd->cmd_index = sdmmc_cmd_read_multiple_block;
+            if (card->sd_flags.support_set_block_count_cmd != 0) {
+                data->enable_auto_cmd23 = true;
+            } else {
+                data->enable_auto_cmd12 = true;
+            }
+        } else {
+            cmd->cmd_index = sdmmc_cmd_read_single_block;
+        }
+        uint32_t start_addr = start_block;
+        if (card->sd_flags.is_byte_addressing_mode == 1U) {
+            start_addr *= card->block_size;
+        }
+        cmd->resp_type = (sdxc_dev_resp_type_t) sdmmc_resp_r1;
+        cmd->cmd_argument = start_addr;
+        data->block_size = SDMMC_BLOCK_SIZE_DEFAULT;
+        data->block_cnt = block_count;
+        data->rx_data = (uint32_t *) sdmmc_get_sys_addr(card->host, (uint32_t) buffer);
+        content->data = data;
+        content->command = cmd;
+        status = sd_handle_transfer_error(card, content, sdmmchost_start_transfer(card->host, content));
+    } while (false);
+
+    return status;
+}
+
+hpm_stat_t sd_start_write_blocks(sd_card_t *card, const uint8_t *buffer, uint32_t start_block, uint32_t block_count)
+{
+    hpm_stat_t status = sd_check_card_parameters(card);
+    do {
+        HPM_BREAK_IF(status != status_success);
+
+        if (!card->host->card_init_done) {
+            status = status_sdmmc_device_init_required;
+            break;
+        }
+        if ((block_count == 0) || (block_count > MAX_BLOCK_COUNT)) {
+            status = status_invalid_argument;
+            break;
+        }
+
+        /* If the card is not an SDUC card, issue ACMD23 to accelerate write performance  */
+        if (card->csd.csd_structure <= 1) {
+            status = sd_app_cmd_set_write_block_erase_count(card, block_count);
+            HPM_BREAK_IF(status != status_success);
+        }
+
+        sdmmchost_cmd_t *cmd = &card->host->cmd;
+        sdmmchost_data_t *data = &card->host->data;
+        sdmmchost_xfer_t *content = &card->host->xfer;
+        memset(cmd, 0, sizeof(*cmd));
+        memset(data, 0, sizeof(*data));
+        memset(content, 0, sizeof(*content));
+
+        if (block_count > 1) {
+            cmd->cmd_index = sdmmc_cmd_write_multiple_block;
+            if (card->sd_flags.support_set_block_count_cmd != 0) {
+                data->enable_auto_cmd23 = true;
+            } else {
+                data->enable_auto_cmd12 = true;
+            }
+        } else {
+            cmd->cmd_index = sdmmc_cmd_write_single_block;
+        }
+        uint32_t start_addr = start_block;
+        if (card->sd_flags.is_byte_addressing_mode == 1U) {
+            start_addr *= card->block_size;
+        }
+        cmd->resp_type = (sdxc_dev_resp_type_t) sdmmc_resp_r1;
+        cmd->cmd_argument = start_addr;
+        data->block_size = SDMMC_BLOCK_SIZE_DEFAULT;
+        data->block_cnt = block_count;
+        data->tx_data = (const uint32_t *) sdmmc_get_sys_addr(card->host, (uint32_t) buffer);
+        content->data = data;
+        content->command = cmd;
+        status = sd_handle_transfer_error(card, content, sdmmchost_start_transfer(card->host, content));
+    } while (false);
+
+    return status;
+}
+
+hpm_stat_t sd_check_transfer_done(sd_card_t *card)
+{
+    hpm_stat_t status = sdmmchost_check_transfer(card->host);
+    if (status == status_sdmmc_busy) {
+        return status;
+    }
+
+    return sd_handle_transfer_error(card, &card->host->xfer, status);
+}
+
+hpm_stat_t sd_check_card_busy(sd_card_t *card)
+{
+    hpm_stat_t status = sd_check_card_parameters(card);
+    do {
+        HPM_BREAK_IF(status != status_success);
+
+        /* DAT0 stays low while the card is programming, CMD13 is only needed once it is released */
+        if ((sdmmchost_get_data_pin_level(card->host) & 1U) == 0U) {
+            status = status_sdmmc_busy;
+            break;
+        }
+        status = sd_send_card_status(card);
+        HPM_BREAK_IF(status != status_success);
+        if ((card->r1_status.current_state == sdmmc_state_program) || (card->r1_status.ready_for_data == 0U)) {
+            status = status_sdmmc_busy;
+        }
+    } while (false);
+
+    return status;
+}
+
 /**
  * @brief Calculate SD erase timeout value
  * Refer to SD_Specification_Part1_Physical_Layer_Specification_Version4.20.pdf, section 4.14 for more details.
@@ -1107,6 +1249,49 @@ hpm_stat_t sd_erase_blocks(sd_card_t *card, uint32_t start_block, uint32_t block
     return status;
 }
 
+hpm_stat_t sd_start_erase_blocks(sd_card_t *card, uint32_t start_block, uint32_t block_count, uint32_t *timeout_ms)
+{
+    hpm_stat_t status = sd_check_card_parameters(card);
+    do {
+        HPM_BREAK_IF(status != status_success);
+
+        if (!card->host->card_init_done) {
+            status = status_sdmmc_device_init_required;
+            break;
+        }
+
+        sdmmchost_cmd_t *cmd = &card->host->cmd;
+        memset(cmd, 0, sizeof(*cmd));
+        uint32_t erase_start_addr = start_block;
+        uint32_t erase_end_addr = start_block + block_count - 1U;
+        if (card->sd_flags.is_byte_addressing_mode == 1U) {
+            erase_start_addr *= card->block_size;
+            erase_end_addr *= card->block_size;
+        }
+        cmd->cmd_index = sd_cmd_erase_start;
+        cmd->cmd_argument = erase_start_addr;
+        cmd->resp_type = (sdxc_dev_resp_type_t) sdmmc_resp_r1;
+        status = sd_send_cmd(card, cmd);
+        HPM_BREAK_IF(status != status_success);
+        cmd->cmd_index = sd_cmd_erase_end;
+        cmd->cmd_argument = erase_end_addr;
+        status = sd_send_cmd(card, cmd);
+        HPM_BREAK_IF(status != status_success);
+
+        /* Sent as R1 so the host doesn't wait for the busy signal, it is polled by sd_check_card_busy() instead */
+        cmd->cmd_index = sdmmc_cmd_erase;
+        cmd->cmd_argument = 0xFF;
+        status = sd_send_cmd(card, cmd);
+        HPM_BREAK_IF(status != status_success);
+
+        if (timeout_ms != NULL) {
+            *timeout_ms = sd_calculate_erase_timeout(card, start_block, block_count);
+        }
+    } while (false);
+
+    return status;
+}
+
 hpm_stat_t sd_set_driver_strength(sd_card_t *card, sd_drive_strength_t driver_strength)
 {
     return sd_switch_function(card, (uint32_t) sd_switch_function_mode_set,
@@ -243,6 +243,70 @@ hpm_stat_t sd_write_blocks(sd_card_t *card, const uint8_t *buffer, uint32_t star
  */
 hpm_stat_t sd_erase_blocks(sd_card_t *card, uint32_t start_block, uint32_t block_count);
 
+/**
+ * @brief Start reading SD blocks without waiting for the data
+ *
+ * The caller polls sd_check_transfer_done() afterwards and takes care of the cache maintenance of @p buffer.
+ * No other command may be sent to the card until the transfer is done.
+ *
+ * @param [in] card SD card context
+ * @param [out] buffer Data buffer
+ * @param [in] start_block start block index
+ * @param [in] block_count Number of blocks to be read
+ *
+ * @return Command execution status
+ */
+hpm_stat_t sd_start_read_blocks(sd_card_t *card, uint8_t *buffer, uint32_t start_block, uint32_t block_count);
+
+/**
+ * @brief Start writing SD blocks without waiting for the data or the programming
+ *
+ * The caller polls sd_check_transfer_done() and then sd_check_card_busy() before the next data command, and
+ * takes care of the cache maintenance of @p buffer.
+ *
+ * @param [in] card SD card context
+ * @param [in] buffer Data buffer
+ * @param [in] start_block start block index
+ * @param [in] block_count Number of blocks to be written
+ *
+ * @return Command execution status
+ */
+hpm_stat_t sd_start_write_blocks(sd_card_t *card, const uint8_t *buffer, uint32_t start_block, uint32_t block_count);
+
+/**
+ * @brief Start erasing SD blocks without waiting for the card
+ *
+ * The caller polls sd_check_card_busy() until the erase is finished.
+ *
+ * @param [in] card SD card context
+ * @param [in] start_block start block index
+ * @param [in] block_count Number of blocks to be erased
+ * @param [out] timeout_ms Time the erase may take, can be NULL
+ *
+ * @return Command execution status
+ */
+hpm_stat_t sd_start_erase_blocks(sd_card_t *card, uint32_t start_block, uint32_t block_count, uint32_t *timeout_ms);
+
+/**
+ * @brief Check the data phase started by sd_start_read_blocks() or sd_start_write_blocks()
+ *
+ * @param [in] card SD card context
+ *
+ * @retval status_sdmmc_busy The data is still being transferred
+ * @return Transfer execution status otherwise
+ */
+hpm_stat_t sd_check_transfer_done(sd_card_t *card);
+
+/**
+ * @brief Check whether the SD card is still programming or erasing, without blocking
+ *
+ * @param [in] card SD card context
+ *
+ * @retval status_sdmmc_busy The card is busy
+ * @retval status_success The card is ready for the next data command
+ */
+hpm_stat_t sd_check_card_busy(sd_card_t *card);
+
 /**
  * @brief Set the driver strength for SD card
  *
@@ -1161,6 +1161,16 @@
 #ifndef LV_USE_HPM_PDMA_WAIT_VSYNC
 #define LV_USE_HPM_PDMA_WAIT_VSYNC 0
 #endif
+
+/*Offload fills, image/layer blits and 90 degree rotation/scaling to the PDMA draw unit*/
+#ifndef LV_USE_DRAW_HPM_PDMA
+#define LV_USE_DRAW_HPM_PDMA 0
+#endif
+
+/*Smaller tasks (in pixels) stay on the SW renderer, the PDMA setup and cache maintenance would cost more*/
+#ifndef LV_DRAW_HPM_PDMA_MIN_AREA
+#define LV_DRAW_HPM_PDMA_MIN_AREA (32 * 32)
+#endif
 #endif /*LV_CONF_H*/
 
 #endif /*End of "Content enable"*/
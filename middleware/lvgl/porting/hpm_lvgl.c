@@ -4,6 +4,7 @@
  *
  */
 #include "hpm_lvgl.h"
+#include "lv_draw_hpm_pdma.h"
 #include <hpm_touch.h>
 #include <hpm_panel.h>
 #include <board.h>
@@ -39,6 +40,19 @@
 #define HPM_LVGL_MCHTMR HPM_MCHTMR
 #define HPM_LVGL_MCHTMR_CLK clock_mchtmr0
 
+/*
+ * Above this many bytes of dirty framebuffer a single writeback of the whole
+ * D-cache is cheaper than walking the dirty range line by line.
+ */
+#ifndef HPM_LVGL_DC_WRITEBACK_ALL_SIZE
+#define HPM_LVGL_DC_WRITEBACK_ALL_SIZE HPM_L1C_DCACHE_SIZE
+#endif
+
+typedef struct hpm_lvgl_dirty_area {
+    lv_area_t areas[LV_INV_BUF_SIZE];
+    uint16_t area_num;
+} hpm_lvgl_dirty_area_t;
+
 #if defined(LV_USE_HPM_PDMA_FLUSH) && LV_USE_HPM_PDMA_FLUSH
 
 #define HPM_LVGL_PDMA_IRQ_NUM IRQn_PDMA_D0
@@ -52,6 +66,7 @@ typedef struct hpm_lvgl_pdma_flush_context {
     struct {
         uint32_t pixel_size;
         uint32_t stride;
+        pdma_config_t config;
         pdma_plane_config_t plane_src;
         pdma_output_config_t output;
     } cfg;
@@ -71,6 +86,8 @@ typedef struct hpm_lvgl_context {
 #if defined(LV_USE_HPM_PDMA_FLUSH) && LV_USE_HPM_PDMA_FLUSH
     hpm_lvgl_pdma_flush_context_t pdma_ctx;
 #endif
+    hpm_lvgl_dirty_area_t dirty;
+    hpm_lvgl_dirty_area_t dirty_prev;
     lv_display_t *disp;
     lv_indev_t *indev;
     volatile int lcdc_vsync_flag;
@@ -180,7 +197,7 @@ void hpm_lvgl_tick_init(void)
 #if defined(LV_USE_HPM_PDMA_FLUSH) && LV_USE_HPM_PDMA_FLUSH
 static void hpm_lvgl_pdma_init(hpm_lvgl_pdma_flush_context_t *ctx, void *pdma_base, uint32_t pixel_size)
 {
-    pdma_config_t config;
+    pdma_config_t *config = &ctx->cfg.config;
     display_pixel_format_t pixel_format;
     pdma_plane_config_t *plane_src_cfg = &ctx->cfg.plane_src;
     pdma_output_config_t *output_cfg = &ctx->cfg.output;
@@ -189,36 +206,32 @@ static void hpm_lvgl_pdma_init(hpm_lvgl_pdma_flush_context_t *ctx, void *pdma_ba
     ctx->cfg.pixel_size = pixel_size;
     clock_add_to_group(LVGL_PDMA_CLOCK, HPM_LVGL_RUNNING_CORE);
     pixel_format = (pixel_size == 4) ? display_pixel_format_argb8888 : display_pixel_format_rgb565;
-    pdma_get_default_config(pdma_ptr, &config, pixel_format);
+    pdma_get_default_config(pdma_ptr, config, pixel_format);
 
-    config.enable_plane = pdma_plane_src;
-    config.block_size = pdma_blocksize_16x16;
-    pdma_init(pdma_ptr, &config);
+    config->enable_plane = pdma_plane_src;
+    config->block_size = pdma_blocksize_16x16;
+    pdma_init(pdma_ptr, config);
 
     pdma_get_default_plane_config(pdma_ptr, plane_src_cfg, pixel_format);
     pdma_get_default_output_config(pdma_ptr, output_cfg, pixel_format);
     intc_m_enable_irq_with_priority(HPM_LVGL_PDMA_IRQ_NUM, HPM_LVGL_PDMA_IRQ_PRIORITY);
 }
 
-ATTR_RAMFUNC static int hpm_lvgl_pdma_copy_start(hpm_lvgl_pdma_flush_context_t *ctx, uint32_t dst, uint32_t src)
+ATTR_RAMFUNC static void hpm_lvgl_pdma_copy_area(hpm_lvgl_pdma_flush_context_t *ctx)
 {
     PDMA_Type *pdma_ptr;
     lv_area_t *area;
     pdma_plane_config_t *plane_src_cfg;
     pdma_output_config_t *output_cfg;
     hpm_lvgl_context_t *lvgl_ctx = ctx->user_data;
+    uint32_t dst, src;
 
-    if (ctx->area_num < 1)
-        return -1;
-
-    ctx->area_num_cnt = 0;
-    ctx->dst_addr = dst;
-    ctx->src_addr = src;
+    dst = ctx->dst_addr;
+    src = ctx->src_addr;
     pdma_ptr = (PDMA_Type *)ctx->pdma_base;
     area = &ctx->areas[ctx->area_num_cnt];
     plane_src_cfg = &ctx->cfg.plane_src;
     output_cfg = &ctx->cfg.output;
-    pdma_stop(pdma_ptr);
 
     lv_display_t *disp = lvgl_ctx->disp;
     lv_display_rotation_t lvgl_rotation = lv_display_get_rotation(disp);
@@ -272,19 +285,29 @@ ATTR_RAMFUNC static int hpm_lvgl_pdma_copy_start(hpm_lvgl_pdma_flush_context_t *
 
     pdma_start(pdma_ptr);
     pdma_enable_irq(pdma_ptr, PDMA_CTRL_PDMA_DONE_IRQ_EN_MASK, true);
+}
+
+/* copy only the given (already merged) dirty areas, one PDMA job per area */
+ATTR_RAMFUNC static int hpm_lvgl_pdma_copy_start(hpm_lvgl_pdma_flush_context_t *ctx, uint32_t dst, uint32_t src,
+                                                 const lv_area_t *areas, uint16_t area_num)
+{
+    if ((area_num < 1) || (area_num > LV_INV_BUF_SIZE))
+        return -1;
+
+    memcpy(ctx->areas, areas, area_num * sizeof(lv_area_t));
+    ctx->area_num = area_num;
+    ctx->area_num_cnt = 0;
+    ctx->dst_addr = dst;
+    ctx->src_addr = src;
+    /* the PDMA draw unit may have reprogrammed the control register in between */
+    pdma_init((PDMA_Type *)ctx->pdma_base, &ctx->cfg.config);
+    hpm_lvgl_pdma_copy_area(ctx);
 
     return 0;
 }
 
 ATTR_RAMFUNC static void hpm_lvgl_pdma_copy_done(hpm_lvgl_pdma_flush_context_t *ctx)
 {
-    PDMA_Type *pdma_ptr;
-    lv_area_t *area;;
-    pdma_plane_config_t *plane_src_cfg;
-    pdma_output_config_t *output_cfg;
-    hpm_lvgl_context_t *lvgl_ctx = ctx->user_data;
-    uint32_t dst, src;
-
     if (ctx->area_num < 1)
         return;
 
@@ -296,65 +319,7 @@ ATTR_RAMFUNC static void hpm_lvgl_pdma_copy_done(hpm_lvgl_pdma_flush_context_t *
         return;
     }
 
-    dst = ctx->dst_addr;
-    src = ctx->src_addr;
-    pdma_ptr = (PDMA_Type *)ctx->pdma_base;
-    area = &ctx->areas[ctx->area_num_cnt];
-    plane_src_cfg = &ctx->cfg.plane_src;
-    output_cfg = &ctx->cfg.output;
-
-    lv_display_t *disp = lvgl_ctx->disp;
-    lv_display_rotation_t lvgl_rotation = lv_display_get_rotation(disp);
-    lv_color_format_t cf = lv_display_get_color_format(disp);
-    uint32_t src_stride;
-    uint32_t dst_stride;
-    lv_area_t dst_area;
-
-    if (lvgl_rotation == LV_DISPLAY_ROTATION_90) {
-        plane_src_cfg->rotate = pdma_rotate_270_degree;
-        src_stride = lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp), cf);
-        dst_stride = lv_draw_buf_width_to_stride(lv_display_get_vertical_resolution(disp), cf);
-    } else if (lvgl_rotation == LV_DISPLAY_ROTATION_270) {
-        plane_src_cfg->rotate = pdma_rotate_90_degree;
-        src_stride = lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp), cf);
-        dst_stride = lv_draw_buf_width_to_stride(lv_display_get_vertical_resolution(disp), cf);
-    } else if (lvgl_rotation == LV_DISPLAY_ROTATION_180) {
-        plane_src_cfg->rotate = pdma_rotate_180_degree;
-        src_stride = lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp), cf);
-        dst_stride = src_stride;
-    } else {
-        plane_src_cfg->rotate = pdma_rotate_0_degree;
-        src_stride = lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp), cf);
-        dst_stride = src_stride;
-    }
-
-    lv_area_copy(&dst_area, area);
-    lv_display_rotate_area(disp, &dst_area);
-
-    plane_src_cfg->buffer = (uint32_t)src + (area->y1 * src_stride + area->x1 * ctx->cfg.pixel_size);
-    plane_src_cfg->width = lv_area_get_width(area);
-    plane_src_cfg->height = lv_area_get_height(area);
-    plane_src_cfg->pitch = src_stride;
-    plane_src_cfg->background = 0x0;
-    pdma_config_planes(pdma_ptr, plane_src_cfg, NULL, NULL);
-
-    output_cfg->plane[pdma_plane_src].x = 0;
-    output_cfg->plane[pdma_plane_src].y = 0;
-    output_cfg->plane[pdma_plane_src].width = lv_area_get_width(&dst_area);
-    output_cfg->plane[pdma_plane_src].height = lv_area_get_height(&dst_area);
-
-    output_cfg->alphablend.src_alpha = 0xFF;
-    output_cfg->alphablend.src_alpha_op = display_alpha_op_override;
-    output_cfg->alphablend.mode = display_alphablend_mode_clear;
-
-    output_cfg->buffer = (uint32_t)dst + (dst_area.y1 * dst_stride + dst_area.x1 * ctx->cfg.pixel_size);
-    output_cfg->width = lv_area_get_width(&dst_area);
-    output_cfg->height = lv_area_get_height(&dst_area);
-    output_cfg->pitch = dst_stride;
-    pdma_config_output(pdma_ptr, output_cfg);
-
-    pdma_start(pdma_ptr);
-    pdma_enable_irq(pdma_ptr, PDMA_CTRL_PDMA_DONE_IRQ_EN_MASK, true);
+    hpm_lvgl_pdma_copy_area(ctx);
 }
 
 ATTR_RAMFUNC static void hpm_lvgl_pdma_copy_register_finish_cb(hpm_lvgl_pdma_flush_context_t *ctx, hpm_lvgl_pdma_finish_cb_t cb, void *cb_data)
@@ -363,11 +328,9 @@ ATTR_RAMFUNC static void hpm_lvgl_pdma_copy_register_finish_cb(hpm_lvgl_pdma_flu
     ctx->finish_cb_data = cb_data;
 }
 
-ATTR_RAMFUNC static int hpm_lvgl_pdma_add_area(hpm_lvgl_pdma_flush_context_t *ctx, const lv_area_t *area)
+ATTR_RAMFUNC bool hpm_lvgl_pdma_flush_is_busy(void)
 {
-    lv_area_copy(&ctx->areas[ctx->area_num], area);
-    ctx->area_num++;
-    return 0;
+    return hpm_lvgl_context.pdma_ctx.area_num != 0;
 }
 
 SDK_DECLARE_EXT_ISR_M(HPM_LVGL_PDMA_IRQ_NUM, hpm_lvgl_pdma_isr)
@@ -456,13 +419,166 @@ static void hpm_lvgl_lcdc_enable(uint32_t fb_buffer)
     intc_m_enable_irq_with_priority(HPM_LVGL_LCDC_IRQ_NUM, HPM_LVGL_LCDC_IRQ_PRIORITY);
 }
 
+/*
+ * Join two areas when they overlap or touch and the bounding box does not
+ * cover more pixels than the two areas together, e.g. stacked row strips.
+ */
+static bool hpm_lvgl_dirty_area_try_join(lv_area_t *dst, const lv_area_t *src)
+{
+    lv_area_t joined;
+
+    if ((src->x1 > dst->x2 + 1) || (dst->x1 > src->x2 + 1) ||
+        (src->y1 > dst->y2 + 1) || (dst->y1 > src->y2 + 1))
+        return false;
+
+    joined.x1 = LV_MIN(dst->x1, src->x1);
+    joined.y1 = LV_MIN(dst->y1, src->y1);
+    joined.x2 = LV_MAX(dst->x2, src->x2);
+    joined.y2 = LV_MAX(dst->y2, src->y2);
+    if (lv_area_get_size(&joined) > lv_area_get_size(dst) + lv_area_get_size(src))
+        return false;
+
+    lv_area_copy(dst, &joined);
+    return true;
+}
+
+static void hpm_lvgl_dirty_area_add(hpm_lvgl_dirty_area_t *dirty, const lv_area_t *area)
+{
+    lv_area_t new_area;
+    uint32_t best = 0;
+    uint32_t best_size = UINT32_MAX;
+    uint32_t size;
+    uint16_t i;
+
+    lv_area_copy(&new_area, area);
+
+    /* a joined area may now reach others, so restart the scan after every join */
+    i = 0;
+    while (i < dirty->area_num) {
+        if (hpm_lvgl_dirty_area_try_join(&new_area, &dirty->areas[i])) {
+            dirty->area_num--;
+            lv_area_copy(&dirty->areas[i], &dirty->areas[dirty->area_num]);
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if (dirty->area_num < LV_INV_BUF_SIZE) {
+        lv_area_copy(&dirty->areas[dirty->area_num++], &new_area);
+        return;
+    }
+
+    /* no room left, grow the area whose bounding box increases the least */
+    for (i = 0; i < dirty->area_num; i++) {
+        lv_area_t joined;
+
+        joined.x1 = LV_MIN(dirty->areas[i].x1, new_area.x1);
+        joined.y1 = LV_MIN(dirty->areas[i].y1, new_area.y1);
+        joined.x2 = LV_MAX(dirty->areas[i].x2, new_area.x2);
+        joined.y2 = LV_MAX(dirty->areas[i].y2, new_area.y2);
+        size = lv_area_get_size(&joined);
+        if (size < best_size) {
+            best_size = size;
+            best = i;
+        }
+    }
+    dirty->areas[best].x1 = LV_MIN(dirty->areas[best].x1, new_area.x1);
+    dirty->areas[best].y1 = LV_MIN(dirty->areas[best].y1, new_area.y1);
+    dirty->areas[best].x2 = LV_MAX(dirty->areas[best].x2, new_area.x2);
+    dirty->areas[best].y2 = LV_MAX(dirty->areas[best].y2, new_area.y2);
+}
+
+/*
+ * Rows of an area narrower than the stride are written back one by one,
+ * otherwise the rows are adjacent in memory and one range covers them all.
+ */
+static bool hpm_lvgl_dirty_area_is_contiguous(const lv_area_t *area, uint32_t stride, uint32_t pixel_size)
+{
+    return (lv_area_get_width(area) * pixel_size + 2 * HPM_L1C_CACHELINE_SIZE) >= stride;
+}
+
+static uint32_t hpm_lvgl_dirty_area_bytes(const hpm_lvgl_dirty_area_t *dirty, uint32_t stride, uint32_t pixel_size)
+{
+    const lv_area_t *area;
+    uint32_t bytes = 0;
+
+    for (uint16_t i = 0; i < dirty->area_num; i++) {
+        area = &dirty->areas[i];
+        if (hpm_lvgl_dirty_area_is_contiguous(area, stride, pixel_size)) {
+            bytes += lv_area_get_height(area) * stride;
+        } else {
+            bytes += lv_area_get_height(area) * (lv_area_get_width(area) * pixel_size + HPM_L1C_CACHELINE_SIZE);
+        }
+    }
+    return bytes;
+}
+
+static void hpm_lvgl_dirty_area_writeback(const hpm_lvgl_dirty_area_t *dirty, uint32_t fb,
+                                          uint32_t stride, uint32_t pixel_size)
+{
+    const lv_area_t *area;
+    uint32_t start, end;
+
+    for (uint16_t i = 0; i < dirty->area_num; i++) {
+        area = &dirty->areas[i];
+        start = fb + area->y1 * stride + area->x1 * pixel_size;
+        end = fb + area->y2 * stride + (area->x2 + 1) * pixel_size;
+        if (hpm_lvgl_dirty_area_is_contiguous(area, stride, pixel_size)) {
+            start = HPM_L1C_CACHELINE_ALIGN_DOWN(start);
+            l1c_dc_writeback(start, HPM_L1C_CACHELINE_ALIGN_UP(end) - start);
+            continue;
+        }
+
+        end = start + lv_area_get_width(area) * pixel_size;
+        for (int32_t y = area->y1; y <= area->y2; y++) {
+            l1c_dc_writeback(HPM_L1C_CACHELINE_ALIGN_DOWN(start),
+                             HPM_L1C_CACHELINE_ALIGN_UP(end) - HPM_L1C_CACHELINE_ALIGN_DOWN(start));
+            start += stride;
+            end += stride;
+        }
+    }
+}
+
+static void hpm_lvgl_dirty_writeback(hpm_lvgl_context_t *ctx, uint8_t *px_map)
+{
+    lv_display_t *disp = ctx->disp;
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    uint32_t stride = lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp), cf);
+    uint32_t pixel_size = HPM_LVGL_PIXEL_SIZE;
+    bool sync_prev = false;
+    uint32_t bytes;
+
+#if !(defined(LV_USE_HPM_PDMA_FLUSH) && LV_USE_HPM_PDMA_FLUSH)
+    /*
+     * The LCDC scans this buffer directly. In double buffered direct mode LVGL
+     * copied the areas of the previous frame into it before rendering, those
+     * lines are dirty as well.
+     */
+    sync_prev = (ctx->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) && lv_display_is_double_buffered(disp);
+#endif
+
+    bytes = hpm_lvgl_dirty_area_bytes(&ctx->dirty, stride, pixel_size);
+    if (sync_prev) {
+        bytes += hpm_lvgl_dirty_area_bytes(&ctx->dirty_prev, stride, pixel_size);
+    }
+
+    if (bytes >= HPM_LVGL_DC_WRITEBACK_ALL_SIZE) {
+        l1c_dc_writeback_all();
+        return;
+    }
+
+    hpm_lvgl_dirty_area_writeback(&ctx->dirty, (uint32_t)px_map, stride, pixel_size);
+    if (sync_prev) {
+        hpm_lvgl_dirty_area_writeback(&ctx->dirty_prev, (uint32_t)px_map, stride, pixel_size);
+    }
+}
+
 void hpm_lvgl_display_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
 {
     hpm_lvgl_context_t *ctx = (hpm_lvgl_context_t *)lv_display_get_user_data(disp);
 
-#if defined(LV_USE_HPM_PDMA_FLUSH) && LV_USE_HPM_PDMA_FLUSH
-    hpm_lvgl_pdma_add_area(&ctx->pdma_ctx, area);
-#endif
+    hpm_lvgl_dirty_area_add(&ctx->dirty, area);
 
     if (ctx->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT && lv_display_flush_is_last(disp) == 0) {
         lv_display_flush_ready(disp);
@@ -470,20 +586,24 @@ void hpm_lvgl_display_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_
     }
 
     if (l1c_dc_is_enabled()) {
-        l1c_dc_writeback((uint32_t)px_map, HPM_LVGL_FB_SIZE);
+        hpm_lvgl_dirty_writeback(ctx, px_map);
     }
 
+    memcpy(&ctx->dirty_prev, &ctx->dirty, sizeof(ctx->dirty));
+    ctx->dirty.area_num = 0;
+
 #if defined(LV_USE_HPM_PDMA_FLUSH) && LV_USE_HPM_PDMA_FLUSH
 #if defined(LV_USE_HPM_PDMA_WAIT_VSYNC) && LV_USE_HPM_PDMA_WAIT_VSYNC
     hpm_lvgl_wait_lcdc_vsync(ctx);
 #endif
-    hpm_lvgl_pdma_copy_start(&ctx->pdma_ctx, (uint32_t)hpm_lcdc_fb, (uint32_t)px_map);
+    hpm_lvgl_pdma_copy_start(&ctx->pdma_ctx, (uint32_t)hpm_lcdc_fb, (uint32_t)px_map,
+                             ctx->dirty_prev.areas, ctx->dirty_prev.area_num);
 #else
     do {
         lcdc_layer_set_next_buffer(HPM_LVGL_LCDC_BASE, HPM_LVGL_LCDC_LAYER_INDEX, (uint32_t)px_map);
         hpm_lvgl_wait_lcdc_vsync(ctx);
     } while (!lcdc_layer_control_shadow_loaded(HPM_LVGL_LCDC_BASE, HPM_LVGL_LCDC_LAYER_INDEX));
-        
+
     lv_display_flush_ready(disp);
 #endif
 }
@@ -609,5 +729,8 @@ void hpm_lvgl_init(void)
     lv_init();
     hpm_lvgl_tick_init();
     hpm_lvgl_display_init();
+#if defined(LV_USE_DRAW_HPM_PDMA) && LV_USE_DRAW_HPM_PDMA
+    lv_draw_hpm_pdma_init();
+#endif
     hpm_lvgl_indev_init();
 }
@@ -7,9 +7,15 @@
 #define _HPM_LVGL_H
 #include "../lvgl/lvgl.h"
 #include "stdint.h"
+#include "stdbool.h"
 
 
 void hpm_lvgl_init(void);
 
+#if defined(LV_USE_HPM_PDMA_FLUSH) && LV_USE_HPM_PDMA_FLUSH
+/* true while the framebuffer copy owns the PDMA */
+bool hpm_lvgl_pdma_flush_is_busy(void);
+#endif
+
 #endif
 
@@ -0,0 +1,489 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include "lv_draw_hpm_pdma.h"
+
+#if defined(LV_USE_DRAW_HPM_PDMA) && LV_USE_DRAW_HPM_PDMA
+#include <string.h>
+#include "hpm_lvgl.h"
+#include "../lvgl/src/lvgl_private.h"
+#include "../lvgl/src/draw/sw/lv_draw_sw.h"
+#include <hpm_soc.h>
+#include <hpm_misc.h>
+#include <hpm_clock_drv.h>
+#include <hpm_l1c_drv.h>
+#include <hpm_pdma_drv.h>
+
+#if !LV_USE_DRAW_SW
+#error LV_USE_DRAW_HPM_PDMA needs LV_USE_DRAW_SW for the tasks the PDMA can not draw
+#endif
+
+#define LV_DRAW_HPM_PDMA_UNIT_ID        (5)
+#define LV_DRAW_HPM_PDMA_SCORE          (70)
+#define LV_DRAW_HPM_PDMA_BASE           HPM_PDMA
+#define LV_DRAW_HPM_PDMA_CLOCK          clock_pdma
+#define LV_DRAW_HPM_PDMA_RUNNING_CORE   HPM_CORE0
+
+/* PDMA scaler range is 1/16x .. 16x of the source */
+#define LV_DRAW_HPM_PDMA_SCALE_MIN      (LV_SCALE_NONE / 16)
+#define LV_DRAW_HPM_PDMA_SCALE_MAX      (LV_SCALE_NONE * 16)
+
+typedef struct lv_draw_hpm_pdma_unit {
+    lv_draw_unit_t base_unit;
+    lv_draw_task_t *task_act;
+    PDMA_Type *pdma;
+    lv_draw_hpm_pdma_stats_t stats;
+} lv_draw_hpm_pdma_unit_t;
+
+static lv_draw_hpm_pdma_unit_t *lv_draw_hpm_pdma_unit;
+
+static bool lv_draw_hpm_pdma_cf_supported(lv_color_format_t cf)
+{
+    return (cf == LV_COLOR_FORMAT_RGB565) || (cf == LV_COLOR_FORMAT_ARGB8888) || (cf == LV_COLOR_FORMAT_XRGB8888);
+}
+
+static display_buf_format_t lv_draw_hpm_pdma_buf_format(lv_color_format_t cf)
+{
+    return (cf == LV_COLOR_FORMAT_RGB565) ? display_buf_format_rgb565 : display_buf_format_argb8888;
+}
+
+static display_pixel_format_t lv_draw_hpm_pdma_pixel_format(lv_color_format_t cf)
+{
+    return (cf == LV_COLOR_FORMAT_RGB565) ? display_pixel_format_rgb565 : display_pixel_format_argb8888;
+}
+
+static bool lv_draw_hpm_pdma_area_supported(const lv_area_t *area)
+{
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+
+    /* the PDMA works on 8x8/16x16 blocks, thin strips are faster on the CPU */
+    return (w > 8) && (h > 8) && ((uint32_t)(w * h) >= LV_DRAW_HPM_PDMA_MIN_AREA);
+}
+
+static bool lv_draw_hpm_pdma_has_transform(const lv_draw_image_dsc_t *dsc)
+{
+    return (dsc->rotation != 0) || (dsc->scale_x != LV_SCALE_NONE) || (dsc->scale_y != LV_SCALE_NONE);
+}
+
+static bool lv_draw_hpm_pdma_transform_supported(const lv_draw_image_dsc_t *dsc)
+{
+    if ((dsc->rotation != 0) && (dsc->rotation != 900) && (dsc->rotation != 1800) && (dsc->rotation != 2700)) {
+        return false;
+    }
+    if ((dsc->scale_x < LV_DRAW_HPM_PDMA_SCALE_MIN) || (dsc->scale_x > LV_DRAW_HPM_PDMA_SCALE_MAX) ||
+        (dsc->scale_y < LV_DRAW_HPM_PDMA_SCALE_MIN) || (dsc->scale_y > LV_DRAW_HPM_PDMA_SCALE_MAX)) {
+        return false;
+    }
+    /* the order of scaling and rotation inside the PDMA only matters for non-uniform scaling */
+    if (((dsc->rotation == 900) || (dsc->rotation == 2700)) && (dsc->scale_x != dsc->scale_y)) {
+        return false;
+    }
+    return true;
+}
+
+/*
+ * The area in layer coordinates the blit will write. Transformed images can't
+ * be clipped by the PDMA, so they are only accepted when fully visible.
+ */
+static bool lv_draw_hpm_pdma_blit_area(const lv_draw_image_dsc_t *dsc, const lv_area_t *coords,
+                                       const lv_area_t *clip_area, lv_area_t *dst_area)
+{
+    if (!lv_draw_hpm_pdma_has_transform(dsc)) {
+        return lv_area_intersect(dst_area, coords, clip_area);
+    }
+
+    lv_image_buf_get_transformed_area(dst_area, lv_area_get_width(coords), lv_area_get_height(coords),
+                                      dsc->rotation, dsc->scale_x, dsc->scale_y, &dsc->pivot);
+    lv_area_move(dst_area, coords->x1, coords->y1);
+    return lv_area_is_in(dst_area, clip_area, 0);
+}
+
+static bool lv_draw_hpm_pdma_image_supported(const lv_draw_image_dsc_t *dsc, lv_color_format_t src_cf,
+                                             int32_t src_w, int32_t src_h, const lv_draw_task_t *t)
+{
+    lv_area_t dst_area;
+
+    if ((dsc->blend_mode != LV_BLEND_MODE_NORMAL) || (dsc->recolor_opa > LV_OPA_MIN) ||
+        (dsc->skew_x != 0) || (dsc->skew_y != 0) || (dsc->clip_radius != 0) ||
+        (dsc->bitmap_mask_src != NULL) || dsc->tile) {
+        return false;
+    }
+    if (!lv_draw_hpm_pdma_cf_supported(src_cf)) {
+        return false;
+    }
+    /* the whole source must map onto the task area, stretched or tiled images are left to SW */
+    if ((lv_area_get_width(&t->area) != src_w) || (lv_area_get_height(&t->area) != src_h)) {
+        return false;
+    }
+    if (lv_draw_hpm_pdma_has_transform(dsc) && !lv_draw_hpm_pdma_transform_supported(dsc)) {
+        return false;
+    }
+    if (!lv_draw_hpm_pdma_blit_area(dsc, &t->area, &t->clip_area, &dst_area)) {
+        return false;
+    }
+    if (!lv_area_is_in(&dst_area, &dsc->base.layer->buf_area, 0)) {
+        return false;
+    }
+    return lv_draw_hpm_pdma_area_supported(&dst_area);
+}
+
+static int32_t lv_draw_hpm_pdma_evaluate(lv_draw_unit_t *draw_unit, lv_draw_task_t *t)
+{
+    const lv_draw_dsc_base_t *base = (const lv_draw_dsc_base_t *)t->draw_dsc;
+    bool supported = false;
+
+    (void) draw_unit;
+
+    if (!lv_draw_hpm_pdma_cf_supported(base->layer->color_format)) {
+        return 0;
+    }
+
+    switch (t->type) {
+    case LV_DRAW_TASK_TYPE_FILL: {
+        const lv_draw_fill_dsc_t *dsc = (const lv_draw_fill_dsc_t *)t->draw_dsc;
+        lv_area_t dst_area;
+
+        /* plain opaque rectangles only, blending a solid color is cheap enough on the CPU */
+        supported = (dsc->radius == 0) && (dsc->grad.dir == (lv_grad_dir_t)LV_GRAD_DIR_NONE) &&
+                    (dsc->opa >= LV_OPA_MAX) &&
+                    lv_area_intersect(&dst_area, &t->area, &t->clip_area) &&
+                    lv_draw_hpm_pdma_area_supported(&dst_area);
+        break;
+    }
+    case LV_DRAW_TASK_TYPE_IMAGE: {
+        const lv_draw_image_dsc_t *dsc = (const lv_draw_image_dsc_t *)t->draw_dsc;
+
+        if ((lv_image_src_get_type(dsc->src) != LV_IMAGE_SRC_VARIABLE) ||
+            (dsc->header.flags & (LV_IMAGE_FLAGS_COMPRESSED | LV_IMAGE_FLAGS_PREMULTIPLIED))) {
+            break;
+        }
+        supported = lv_draw_hpm_pdma_image_supported(dsc, dsc->header.cf, dsc->header.w, dsc->header.h, t);
+        break;
+    }
+    case LV_DRAW_TASK_TYPE_LAYER: {
+        const lv_draw_image_dsc_t *dsc = (const lv_draw_image_dsc_t *)t->draw_dsc;
+        const lv_layer_t *layer_to_draw = (const lv_layer_t *)dsc->src;
+
+        supported = lv_draw_hpm_pdma_image_supported(dsc, layer_to_draw->color_format,
+                                                     lv_area_get_width(&layer_to_draw->buf_area),
+                                                     lv_area_get_height(&layer_to_draw->buf_area), t);
+        break;
+    }
+    default:
+        break;
+    }
+
+    if (!supported) {
+        return 0;
+    }
+
+    if (t->preference_score > LV_DRAW_HPM_PDMA_SCORE) {
+        t->preference_score = LV_DRAW_HPM_PDMA_SCORE;
+        t->preferred_draw_unit_id = LV_DRAW_HPM_PDMA_UNIT_ID;
+    }
+    return 1;
+}
+
+/*
+ * Cache maintenance on a rectangle of a buffer. Narrow rectangles are handled
+ * row by row, beyond the D-cache size one whole-cache operation is cheaper.
+ */
+static void lv_draw_hpm_pdma_cache_op(const uint8_t *buf, uint32_t stride, uint32_t row_bytes, uint32_t rows, bool invalidate)
+{
+    uint32_t start = (uint32_t)buf;
+    uint32_t end;
+
+    if (!l1c_dc_is_enabled()) {
+        return;
+    }
+
+    if (row_bytes + 2 * HPM_L1C_CACHELINE_SIZE >= stride) {
+        end = start + (rows - 1) * stride + row_bytes;
+        rows = 1;
+        row_bytes = end - start;
+    }
+
+    if (rows * (row_bytes + HPM_L1C_CACHELINE_SIZE) >= HPM_L1C_DCACHE_SIZE) {
+        if (invalidate) {
+            l1c_dc_flush_all();
+        } else {
+            l1c_dc_writeback_all();
+        }
+        return;
+    }
+
+    for (uint32_t i = 0; i < rows; i++) {
+        end = HPM_L1C_CACHELINE_ALIGN_UP(start + row_bytes);
+        if (invalidate) {
+            l1c_dc_flush(HPM_L1C_CACHELINE_ALIGN_DOWN(start), end - HPM_L1C_CACHELINE_ALIGN_DOWN(start));
+        } else {
+            l1c_dc_writeback(HPM_L1C_CACHELINE_ALIGN_DOWN(start), end - HPM_L1C_CACHELINE_ALIGN_DOWN(start));
+        }
+        start += stride;
+    }
+}
+
+static uint32_t lv_draw_hpm_pdma_sys_addr(const void *addr)
+{
+    return core_local_mem_to_sys_address(LV_DRAW_HPM_PDMA_RUNNING_CORE, (uint32_t)addr);
+}
+
+static hpm_stat_t lv_draw_hpm_pdma_fill(lv_draw_hpm_pdma_unit_t *u, const lv_draw_fill_dsc_t *dsc, const lv_area_t *coords)
+{
+    lv_layer_t *layer = u->base_unit.target_layer;
+    lv_draw_buf_t *draw_buf = layer->draw_buf;
+    lv_color_format_t cf = draw_buf->header.cf;
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t stride = draw_buf->header.stride;
+    lv_area_t area;
+    uint8_t *dst;
+
+    if (!lv_area_intersect(&area, coords, u->base_unit.clip_area)) {
+        return status_success;
+    }
+    lv_area_move(&area, -layer->buf_area.x1, -layer->buf_area.y1);
+    dst = draw_buf->data + area.y1 * stride + area.x1 * px_size;
+
+    /* write back what SW drew around the area, and drop the lines the PDMA is going to overwrite */
+    lv_draw_hpm_pdma_cache_op(dst, stride, lv_area_get_width(&area) * px_size, lv_area_get_height(&area), true);
+
+    return pdma_fill_color(u->pdma, lv_draw_hpm_pdma_sys_addr(dst), stride / px_size,
+                           lv_area_get_width(&area), lv_area_get_height(&area),
+                           lv_color_to_u32(dsc->color), 0xFF,
+                           lv_draw_hpm_pdma_pixel_format(cf), true, NULL);
+}
+
+static hpm_stat_t lv_draw_hpm_pdma_blit(lv_draw_hpm_pdma_unit_t *u, const lv_draw_image_dsc_t *dsc,
+                                        const lv_area_t *coords, const lv_image_header_t *header, const uint8_t *data)
+{
+    lv_layer_t *layer = u->base_unit.target_layer;
+    lv_draw_buf_t *draw_buf = layer->draw_buf;
+    uint32_t dst_px_size = lv_color_format_get_size(draw_buf->header.cf);
+    uint32_t src_px_size = lv_color_format_get_size(header->cf);
+    uint32_t src_stride = header->stride ? header->stride : header->w * src_px_size;
+    bool has_transform = lv_draw_hpm_pdma_has_transform(dsc);
+    pdma_blit_option_t op;
+    display_buf_t dst, src;
+    lv_area_t dst_area, src_area;
+    uint8_t *dst_addr;
+    const uint8_t *src_addr;
+
+    if (!lv_draw_hpm_pdma_blit_area(dsc, coords, u->base_unit.clip_area, &dst_area)) {
+        /* fully clipped, or became partially visible after evaluation */
+        return has_transform ? status_invalid_argument : status_success;
+    }
+
+    if (has_transform) {
+        lv_area_set(&src_area, 0, 0, header->w - 1, header->h - 1);
+    } else {
+        lv_area_copy(&src_area, &dst_area);
+        lv_area_move(&src_area, -coords->x1, -coords->y1);
+    }
+    lv_area_move(&dst_area, -layer->buf_area.x1, -layer->buf_area.y1);
+
+    dst_addr = draw_buf->data + dst_area.y1 * draw_buf->header.stride + dst_area.x1 * dst_px_size;
+    src_addr = data + src_area.y1 * src_stride + src_area.x1 * src_px_size;
+
+    dst.buf = (void *)lv_draw_hpm_pdma_sys_addr(dst_addr);
+    dst.width = lv_area_get_width(&dst_area);
+    dst.height = lv_area_get_height(&dst_area);
+    dst.stride = draw_buf->header.stride;
+    dst.format = lv_draw_hpm_pdma_buf_format(draw_buf->header.cf);
+    /* only ARGB8888 layers carry a meaningful destination alpha */
+    if (draw_buf->header.cf == LV_COLOR_FORMAT_ARGB8888) {
+        dst.alpha.op = display_alpha_op_invalid;
+        dst.alpha.val = 0xFF;
+    } else {
+        dst.alpha.op = display_alpha_op_override;
+        dst.alpha.val = 0xFF;
+    }
+
+    src.buf = (void *)lv_draw_hpm_pdma_sys_addr(src_addr);
+    src.width = lv_area_get_width(&src_area);
+    src.height = lv_area_get_height(&src_area);
+    src.stride = src_stride;
+    src.format = lv_draw_hpm_pdma_buf_format(header->cf);
+    if (header->cf == LV_COLOR_FORMAT_ARGB8888) {
+        src.alpha.op = (dsc->opa >= LV_OPA_MAX) ? display_alpha_op_invalid : display_alpha_op_scale;
+    } else {
+        src.alpha.op = display_alpha_op_override;
+    }
+    src.alpha.val = dsc->opa;
+
+    pdma_get_default_blit_option(&op);
+    op.blend = display_alphablend_mode_src_over;
+    op.scale.x = (float)dsc->scale_x / LV_SCALE_NONE;
+    op.scale.y = (float)dsc->scale_y / LV_SCALE_NONE;
+    switch (dsc->rotation) {
+    case 900:
+        op.rotate = pdma_rotate_90_degree;
+        break;
+    case 1800:
+        op.rotate = pdma_rotate_180_degree;
+        break;
+    case 2700:
+        op.rotate = pdma_rotate_270_degree;
+        break;
+    default:
+        op.rotate = pdma_rotate_0_degree;
+        break;
+    }
+
+    lv_draw_hpm_pdma_cache_op(src_addr, src_stride, src.width * src_px_size, src.height, false);
+    lv_draw_hpm_pdma_cache_op(dst_addr, dst.stride, dst.width * dst_px_size, dst.height, true);
+
+    return pdma_blit_ex(u->pdma, &dst, &src, &op, true, NULL);
+}
+
+static void lv_draw_hpm_pdma_count_blit(lv_draw_hpm_pdma_unit_t *u, const lv_draw_image_dsc_t *dsc)
+{
+    if (lv_draw_hpm_pdma_has_transform(dsc)) {
+        u->stats.transform++;
+    } else {
+        u->stats.blit++;
+    }
+}
+
+static void lv_draw_hpm_pdma_execute(lv_draw_hpm_pdma_unit_t *u, lv_draw_task_t *t)
+{
+    lv_draw_unit_t *draw_unit = &u->base_unit;
+    hpm_stat_t stat = status_invalid_argument;
+
+#if defined(LV_USE_HPM_PDMA_FLUSH) && LV_USE_HPM_PDMA_FLUSH
+    /* the framebuffer copy of the previous frame may still be running */
+    while (hpm_lvgl_pdma_flush_is_busy()) {
+    }
+#endif
+
+    switch (t->type) {
+    case LV_DRAW_TASK_TYPE_FILL:
+        stat = lv_draw_hpm_pdma_fill(u, t->draw_dsc, &t->area);
+        if ((stat == status_success) || (stat == status_pdma_done)) {
+            u->stats.fill++;
+            return;
+        }
+        u->stats.fallback++;
+        lv_draw_sw_fill(draw_unit, t->draw_dsc, &t->area);
+        break;
+    case LV_DRAW_TASK_TYPE_IMAGE: {
+        const lv_draw_image_dsc_t *dsc = t->draw_dsc;
+        const lv_image_dsc_t *img = dsc->src;
+
+        stat = lv_draw_hpm_pdma_blit(u, dsc, &t->area, &img->header, img->data);
+        if ((stat == status_success) || (stat == status_pdma_done)) {
+            lv_draw_hpm_pdma_count_blit(u, dsc);
+            return;
+        }
+        u->stats.fallback++;
+        lv_draw_sw_image(draw_unit, dsc, &t->area);
+        break;
+    }
+    case LV_DRAW_TASK_TYPE_LAYER: {
+        const lv_draw_image_dsc_t *dsc = t->draw_dsc;
+        const lv_layer_t *layer_to_draw = dsc->src;
+        const lv_draw_buf_t *layer_buf = layer_to_draw->draw_buf;
+
+        /* nothing was drawn on the layer */
+        if (layer_buf == NULL) {
+            return;
+        }
+        stat = lv_draw_hpm_pdma_blit(u, dsc, &t->area, &layer_buf->header, layer_buf->data);
+        if ((stat == status_success) || (stat == status_pdma_done)) {
+            lv_draw_hpm_pdma_count_blit(u, dsc);
+            return;
+        }
+        u->stats.fallback++;
+        lv_draw_sw_layer(draw_unit, dsc, &t->area);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/*
+ * With LV_USE_OS the SW unit renders from its own thread. Cache lines at the
+ * edge of a task area can hold pixels of a neighbouring task, so the PDMA
+ * only starts while nothing else is drawing into the layer.
+ */
+static bool lv_draw_hpm_pdma_layer_is_idle(lv_layer_t *layer)
+{
+    for (lv_draw_task_t *t = layer->draw_task_head; t != NULL; t = t->next) {
+        if (t->state == LV_DRAW_TASK_STATE_IN_PROGRESS) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int32_t lv_draw_hpm_pdma_dispatch(lv_draw_unit_t *draw_unit, lv_layer_t *layer)
+{
+    lv_draw_hpm_pdma_unit_t *u = (lv_draw_hpm_pdma_unit_t *)draw_unit;
+    lv_draw_task_t *t;
+
+    if (u->task_act) {
+        return 0;
+    }
+
+    t = lv_draw_get_next_available_task(layer, NULL, LV_DRAW_HPM_PDMA_UNIT_ID);
+    if ((t == NULL) || (t->preferred_draw_unit_id != LV_DRAW_HPM_PDMA_UNIT_ID)) {
+        return LV_DRAW_UNIT_IDLE;
+    }
+
+    if (!lv_draw_hpm_pdma_layer_is_idle(layer)) {
+        return LV_DRAW_UNIT_IDLE;
+    }
+
+    if (lv_draw_layer_alloc_buf(layer) == NULL) {
+        return LV_DRAW_UNIT_IDLE;
+    }
+
+    t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    u->base_unit.target_layer = layer;
+    u->base_unit.clip_area = &t->clip_area;
+    u->task_act = t;
+
+    lv_draw_hpm_pdma_execute(u, t);
+
+    t->state = LV_DRAW_TASK_STATE_READY;
+    u->task_act = NULL;
+
+    /* the unit is free again, let the dispatcher hand out the next task */
+    lv_draw_dispatch_request();
+
+    return 1;
+}
+
+void lv_draw_hpm_pdma_init(void)
+{
+    lv_draw_hpm_pdma_unit_t *u;
+
+    clock_add_to_group(LV_DRAW_HPM_PDMA_CLOCK, 0);
+
+    u = lv_draw_create_unit(sizeof(lv_draw_hpm_pdma_unit_t));
+    u->base_unit.evaluate_cb = lv_draw_hpm_pdma_evaluate;
+    u->base_unit.dispatch_cb = lv_draw_hpm_pdma_dispatch;
+    u->pdma = LV_DRAW_HPM_PDMA_BASE;
+    lv_draw_hpm_pdma_unit = u;
+}
+
+void lv_draw_hpm_pdma_get_stats(lv_draw_hpm_pdma_stats_t *stats)
+{
+    if (lv_draw_hpm_pdma_unit == NULL) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    *stats = lv_draw_hpm_pdma_unit->stats;
+}
+
+void lv_draw_hpm_pdma_reset_stats(void)
+{
+    if (lv_draw_hpm_pdma_unit != NULL) {
+        memset(&lv_draw_hpm_pdma_unit->stats, 0, sizeof(lv_draw_hpm_pdma_stats_t));
+    }
+}
+
+#endif /* LV_USE_DRAW_HPM_PDMA */
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef _LV_DRAW_HPM_PDMA_H
+#define _LV_DRAW_HPM_PDMA_H
+#include "../lvgl/lvgl.h"
+#include "stdint.h"
+
+#if defined(LV_USE_DRAW_HPM_PDMA) && LV_USE_DRAW_HPM_PDMA
+
+typedef struct lv_draw_hpm_pdma_stats {
+    uint32_t fill;          /* opaque rectangle fills done by the PDMA */
+    uint32_t blit;          /* image/layer blits, opaque or alpha blended */
+    uint32_t transform;     /* blits with 90 degree rotation and/or scaling */
+    uint32_t fallback;      /* accepted tasks the PDMA rejected at run time, drawn by SW */
+} lv_draw_hpm_pdma_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Register the PDMA draw unit
+ *
+ * Must be called after lv_init(). Tasks the PDMA can't do (radius, gradient,
+ * recolor, arbitrary angles, small areas...) keep going to the SW renderer.
+ */
+void lv_draw_hpm_pdma_init(void);
+
+/**
+ * @brief Get the number of tasks done by the PDMA draw unit
+ *
+ * @param [out] stats counters since init or the last reset
+ */
+void lv_draw_hpm_pdma_get_stats(lv_draw_hpm_pdma_stats_t *stats);
+
+/**
+ * @brief Clear the PDMA draw unit counters
+ */
+void lv_draw_hpm_pdma_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LV_USE_DRAW_HPM_PDMA */
+
+#endif
@@ -0,0 +1,590 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "board.h"
+#include "hpm_l1c_drv.h"
+#include "lwip/opt.h"
+#include "lwip/def.h"
+#include "lwip/sys.h"
+#include "lwip/etharp.h"
+#include "hpm_enet_netif.h"
+
+#define HPM_ENET_NETIF_MTU      (1500U)
+
+static void hpm_enet_netif_cache_writeback(uint32_t addr, uint32_t size)
+{
+    uint32_t start = HPM_L1C_CACHELINE_ALIGN_DOWN(addr);
+    uint32_t end = HPM_L1C_CACHELINE_ALIGN_UP(addr + size);
+
+    l1c_dc_writeback(start, end - start);
+}
+
+static void hpm_enet_netif_cache_invalidate(uint32_t addr, uint32_t size)
+{
+    /* RX buffers are cacheline aligned and sized */
+    l1c_dc_invalidate(addr, HPM_L1C_CACHELINE_ALIGN_UP(size));
+}
+
+/*---------------------------------------------------------------------*
+ * RX
+ *---------------------------------------------------------------------*/
+static void hpm_enet_netif_rx_buf_free(struct pbuf *p)
+{
+    hpm_enet_netif_rx_buf_t *rx_buf = (hpm_enet_netif_rx_buf_t *)p;
+    hpm_enet_netif_t *ctx = rx_buf->owner;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+    rx_buf->next = ctx->rx_free;
+    ctx->rx_free = rx_buf;
+    SYS_ARCH_UNPROTECT(lev);
+}
+
+/* take n spare buffers, all or nothing */
+static hpm_enet_netif_rx_buf_t *hpm_enet_netif_rx_buf_alloc(hpm_enet_netif_t *ctx, uint32_t n)
+{
+    hpm_enet_netif_rx_buf_t *head, *tail;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    SYS_ARCH_PROTECT(lev);
+    head = ctx->rx_free;
+    tail = head;
+    for (uint32_t i = 1; (i < n) && (tail != NULL); i++) {
+        tail = tail->next;
+    }
+    if (tail == NULL) {
+        SYS_ARCH_UNPROTECT(lev);
+        return NULL;
+    }
+    ctx->rx_free = tail->next;
+    tail->next = NULL;
+    SYS_ARCH_UNPROTECT(lev);
+
+    return head;
+}
+
+/* give every consumed descriptor back to the DMA with a single fence and resume */
+static void hpm_enet_netif_rx_refill(hpm_enet_netif_t *ctx)
+{
+    ENET_Type *base = ctx->cfg.base;
+    enet_rx_desc_t *rx_desc = ctx->rx_desc_dirty;
+
+    if (ctx->rx_dirty == 0) {
+        return;
+    }
+
+    __asm volatile("fence rw, rw");
+    for (uint32_t i = 0; i < ctx->rx_dirty; i++) {
+        rx_desc->rdes0_bm.own = 1;
+        rx_desc = (enet_rx_desc_t *)rx_desc->rdes3_bm.next_desc;
+    }
+    ctx->rx_desc_dirty = rx_desc;
+    ctx->rx_dirty = 0;
+    __asm volatile("fence rw, rw");
+
+    if (ENET_DMA_STATUS_RU_GET(base->DMA_STATUS)) {
+        ctx->stats.rx_desc_starved++;
+        base->DMA_STATUS = ENET_DMA_STATUS_RU_MASK;
+        base->DMA_RX_POLL_DEMAND = 1;
+    }
+}
+
+static struct pbuf *hpm_enet_netif_rx_frame(hpm_enet_netif_t *ctx, enet_rx_desc_t *fs, uint32_t seg_cnt, uint32_t frame_len)
+{
+    enet_desc_t *desc = ctx->cfg.desc;
+    uint32_t buf_size = desc->rx_buff_cfg.size;
+    enet_rx_desc_t *rx_desc = fs;
+    hpm_enet_netif_rx_buf_t *spare;
+    hpm_enet_netif_rx_buf_t *rx_buf;
+    struct pbuf *p = NULL;
+    struct pbuf *q;
+    uint32_t offset = 0;
+    uint32_t len;
+    uint32_t idx;
+
+    spare = hpm_enet_netif_rx_buf_alloc(ctx, (frame_len + buf_size - 1) / buf_size);
+    if (spare == NULL) {
+        /* every spare buffer is held by lwIP, fall back to a copy */
+        p = pbuf_alloc(PBUF_RAW, frame_len, PBUF_POOL);
+        if (p == NULL) {
+            ctx->stats.rx_pbuf_exhausted++;
+            return NULL;
+        }
+        ctx->stats.rx_copy++;
+    }
+
+    for (uint32_t i = 0; (i < seg_cnt) && (offset < frame_len); i++) {
+        idx = rx_desc - desc->rx_desc_list_head;
+        rx_buf = ctx->cfg.rx_desc_buf[idx];
+        len = LWIP_MIN(frame_len - offset, buf_size);
+        hpm_enet_netif_cache_invalidate((uint32_t)rx_buf->buf, len);
+
+        if (spare == NULL) {
+            pbuf_take_at(p, rx_buf->buf, len, offset);
+        } else {
+            q = pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF, &rx_buf->pc, rx_buf->buf, buf_size);
+            if (p == NULL) {
+                p = q;
+            } else {
+                pbuf_cat(p, q);
+            }
+            /* lwIP may have written to a recycled buffer, drop those lines before the DMA fills it */
+            rx_buf = spare;
+            spare = spare->next;
+            hpm_enet_netif_cache_invalidate((uint32_t)rx_buf->buf, buf_size);
+            ctx->cfg.rx_desc_buf[idx] = rx_buf;
+            rx_desc->rdes2_bm.buffer1 = (uint32_t)rx_buf->buf;
+        }
+
+        offset += len;
+        rx_desc = (enet_rx_desc_t *)rx_desc->rdes3_bm.next_desc;
+    }
+
+#if defined(LWIP_PTP) && LWIP_PTP
+    p->time_sec  = fs->rdes7_bm.rtsh;
+    p->time_nsec = fs->rdes6_bm.rtsl;
+#endif
+
+    return p;
+}
+
+static struct pbuf *hpm_enet_netif_rx(hpm_enet_netif_t *ctx)
+{
+    enet_desc_t *desc = ctx->cfg.desc;
+    enet_rx_desc_t *fs;
+    enet_rx_desc_t *rx_desc;
+    struct pbuf *p = NULL;
+    uint32_t avail;
+    uint32_t seg_cnt;
+
+    while (p == NULL) {
+        if (ctx->rx_dirty >= ctx->rx_refill_batch) {
+            hpm_enet_netif_rx_refill(ctx);
+        }
+
+        /* descriptors waiting for refill are own == 0 too, never walk into them */
+        avail = desc->rx_buff_cfg.count - ctx->rx_dirty;
+        fs = desc->rx_desc_list_cur;
+        rx_desc = fs;
+        for (seg_cnt = 1; ; seg_cnt++) {
+            if (rx_desc->rdes0_bm.own) {
+                return NULL;
+            }
+            if (rx_desc->rdes0_bm.ls || (seg_cnt == avail)) {
+                break;
+            }
+            rx_desc = (enet_rx_desc_t *)rx_desc->rdes3_bm.next_desc;
+        }
+
+        if (!rx_desc->rdes0_bm.ls && (ctx->rx_dirty > 0)) {
+            /* the rest of the frame goes to descriptors not given back yet */
+            hpm_enet_netif_rx_refill(ctx);
+            continue;
+        }
+
+        desc->rx_desc_list_cur = (enet_rx_desc_t *)rx_desc->rdes3_bm.next_desc;
+
+        /* drop errored frames and segments we lost the start of */
+        if (fs->rdes0_bm.fs && rx_desc->rdes0_bm.ls && !rx_desc->rdes0_bm.es && (rx_desc->rdes0_bm.fl > 4)) {
+            /* without the CRC */
+            p = hpm_enet_netif_rx_frame(ctx, fs, seg_cnt, rx_desc->rdes0_bm.fl - 4);
+        } else {
+            ctx->stats.rx_err_drop++;
+        }
+
+        ctx->rx_dirty += seg_cnt;
+    }
+
+    ctx->stats.rx_frames++;
+
+    return p;
+}
+
+uint32_t hpm_enet_netif_poll(hpm_enet_netif_t *ctx, uint32_t budget)
+{
+    ENET_Type *base = ctx->cfg.base;
+    struct netif *netif = ctx->netif;
+    struct pbuf *p;
+    uint32_t done = 0;
+
+    while (done < budget) {
+        p = hpm_enet_netif_rx(ctx);
+        if (p == NULL) {
+            break;
+        }
+        if (netif->input(p, netif) != ERR_OK) {
+            ctx->stats.rx_input_drop++;
+            pbuf_free(p);
+        }
+        done++;
+    }
+    hpm_enet_netif_rx_refill(ctx);
+
+    if ((done < budget) && ctx->rx_irq) {
+        /* drained: back to interrupt mode, unless a frame came in before the unmask */
+        base->DMA_STATUS = ENET_DMA_STATUS_RI_MASK;
+        base->DMA_INTR_EN |= ENET_DMA_INTR_EN_RIE_MASK;
+        if (!ctx->cfg.desc->rx_desc_list_cur->rdes0_bm.own) {
+            base->DMA_INTR_EN &= ~ENET_DMA_INTR_EN_RIE_MASK;
+            return budget;
+        }
+    }
+
+    return done;
+}
+
+bool hpm_enet_netif_isr(hpm_enet_netif_t *ctx)
+{
+    ENET_Type *base = ctx->cfg.base;
+
+    if (ctx->netif == NULL) {
+        return false;
+    }
+
+    if (ENET_DMA_STATUS_RI_GET(base->DMA_STATUS) && (base->DMA_INTR_EN & ENET_DMA_INTR_EN_RIE_MASK)) {
+        /* switch to polling until the ring is drained */
+        base->DMA_INTR_EN &= ~ENET_DMA_INTR_EN_RIE_MASK;
+        base->DMA_STATUS = ENET_DMA_STATUS_RI_MASK | ENET_DMA_STATUS_NIS_MASK;
+        ctx->stats.rx_irq++;
+        hpm_enet_netif_os_rx_notify_from_isr(&ctx->os);
+    }
+
+    return true;
+}
+
+#if defined(NO_SYS) && NO_SYS
+void hpm_enet_netif_input(struct netif *netif)
+{
+    hpm_enet_netif_t *ctx = (hpm_enet_netif_t *)netif->state;
+
+    if (ctx->rx_irq && !hpm_enet_netif_os_rx_wait(&ctx->os, 0)) {
+        return;
+    }
+
+    if ((hpm_enet_netif_poll(ctx, HPM_ENET_NETIF_RX_BUDGET) == HPM_ENET_NETIF_RX_BUDGET) && ctx->rx_irq) {
+        /* the interrupt stays masked, carry on with the next call */
+        hpm_enet_netif_os_rx_notify(&ctx->os);
+    }
+}
+#else
+static void hpm_enet_netif_rx_thread(void *arg)
+{
+    hpm_enet_netif_t *ctx = (hpm_enet_netif_t *)arg;
+
+    for (;;) {
+        /* poll on timeout as well, a lost interrupt only costs latency */
+        hpm_enet_netif_os_rx_wait(&ctx->os, HPM_ENET_NETIF_RX_WAIT_MS);
+        while (hpm_enet_netif_poll(ctx, HPM_ENET_NETIF_RX_BUDGET) == HPM_ENET_NETIF_RX_BUDGET) {
+            hpm_enet_netif_os_yield();
+        }
+    }
+}
+#endif
+
+/*---------------------------------------------------------------------*
+ * TX
+ *---------------------------------------------------------------------*/
+#if defined(LWIP_PTP) && LWIP_PTP
+/* the driver records the TX timestamp for single-buffer frames, keep using it */
+static err_t hpm_enet_netif_tx(hpm_enet_netif_t *ctx, struct pbuf *p)
+{
+    enet_desc_t *desc = ctx->cfg.desc;
+    enet_ptp_ts_system_t timestamp;
+    uint32_t addr;
+
+    if (p->tot_len + 4 > desc->tx_buff_cfg.size) {
+        return ERR_VAL;
+    }
+    if (desc->tx_desc_list_cur->tdes0_bm.own != 0) {
+        ctx->stats.tx_ring_full++;
+        return ERR_INPROGRESS;
+    }
+
+    addr = ctx->cfg.tx_slots[desc->tx_desc_list_cur - desc->tx_desc_list_head].bounce;
+    pbuf_copy_partial(p, (void *)addr, p->tot_len, 0);
+    hpm_enet_netif_cache_writeback(addr, p->tot_len + 4);
+    desc->tx_desc_list_cur->tdes2_bm.buffer1 = addr;
+
+    /* 4 more bytes for the CRC replaced by the MAC */
+    enet_prepare_tx_desc_with_ts_record(ctx->cfg.base, &desc->tx_desc_list_cur, &desc->tx_control_config,
+                                        p->tot_len + 4, desc->tx_buff_cfg.size, &timestamp);
+    p->time_sec  = timestamp.sec;
+    p->time_nsec = timestamp.nsec;
+    ctx->stats.tx_frames++;
+
+    return ERR_OK;
+}
+#else
+static void hpm_enet_netif_tx_reclaim(hpm_enet_netif_t *ctx)
+{
+    enet_tx_desc_t *tx_desc = ctx->tx_desc_dirty;
+    hpm_enet_netif_tx_slot_t *slot;
+
+    while ((ctx->tx_busy > 0) && (tx_desc->tdes0_bm.own == 0)) {
+        slot = &ctx->cfg.tx_slots[tx_desc - ctx->cfg.desc->tx_desc_list_head];
+        if (slot->p != NULL) {
+            pbuf_free(slot->p);
+            slot->p = NULL;
+        }
+        tx_desc = (enet_tx_desc_t *)tx_desc->tdes3_bm.next_desc;
+        ctx->tx_busy--;
+    }
+    ctx->tx_desc_dirty = tx_desc;
+}
+
+static bool hpm_enet_netif_tx_wait(hpm_enet_netif_t *ctx, uint32_t desc_cnt)
+{
+    uint32_t count = ctx->cfg.desc->tx_buff_cfg.count;
+
+    hpm_enet_netif_tx_reclaim(ctx);
+    if (count - ctx->tx_busy >= desc_cnt) {
+        return true;
+    }
+
+    ctx->stats.tx_ring_full++;
+    for (uint32_t i = 0; i < HPM_ENET_NETIF_TX_RECLAIM_RETRY; i++) {
+        hpm_enet_netif_tx_reclaim(ctx);
+        if (count - ctx->tx_busy >= desc_cnt) {
+            return true;
+        }
+    }
+    ctx->stats.tx_drop++;
+
+    return false;
+}
+
+static err_t hpm_enet_netif_tx(hpm_enet_netif_t *ctx, struct pbuf *p)
+{
+    enet_desc_t *desc = ctx->cfg.desc;
+    enet_tx_control_config_t *config = &desc->tx_control_config;
+    enet_tx_desc_t *first = desc->tx_desc_list_cur;
+    enet_tx_desc_t *tx_desc = first;
+    enet_tx_desc_t tdes;
+    struct pbuf *q;
+    bool linearize;
+    bool hold = false;
+    uint32_t seg_cnt = 0;
+    uint32_t idx = 0;
+    uint32_t addr;
+    uint32_t len;
+
+    for (q = p; q != NULL; q = q->next) {
+        if (q->len > 0) {
+            seg_cnt++;
+        }
+    }
+
+    if (seg_cnt == 0) {
+        return ERR_VAL;
+    }
+
+    linearize = (seg_cnt > HPM_ENET_NETIF_TX_MAX_SEGS);
+    if (linearize) {
+        if (p->tot_len > desc->tx_buff_cfg.size) {
+            return ERR_VAL;
+        }
+        seg_cnt = 1;
+    }
+
+    if (!hpm_enet_netif_tx_wait(ctx, seg_cnt)) {
+        return ERR_MEM;
+    }
+
+    q = p;
+    for (uint32_t i = 0; i < seg_cnt; i++) {
+        idx = tx_desc - desc->tx_desc_list_head;
+        while (q->len == 0) {
+            q = q->next;
+        }
+
+        if (linearize) {
+            addr = ctx->cfg.tx_slots[idx].bounce;
+            len = p->tot_len;
+            pbuf_copy_partial(p, (void *)addr, len, 0);
+            hpm_enet_netif_cache_writeback(addr, len);
+        } else if (q->type_internal & PBUF_TYPE_FLAG_STRUCT_DATA_CONTIGUOUS) {
+            /* PBUF_RAM and PBUF_POOL: let the DMA read the payload in place */
+            addr = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)q->payload);
+            len = q->len;
+            hpm_enet_netif_cache_writeback((uint32_t)q->payload, len);
+            hold = true;
+        } else {
+            /* PBUF_ROM/PBUF_REF may point to memory the DMA can't read or that changes later */
+            addr = ctx->cfg.tx_slots[idx].bounce;
+            len = q->len;
+            memcpy((void *)addr, q->payload, len);
+            hpm_enet_netif_cache_writeback(addr, len);
+        }
+        q = q->next;
+
+        /* the MAC appends the CRC, a chain has no room for the CRC replacement bytes */
+        tdes.tdes0 = 0;
+        tdes.tdes0_bm.tch  = 1;
+        tdes.tdes0_bm.fs   = (i == 0);
+        tdes.tdes0_bm.ls   = (i == seg_cnt - 1);
+        tdes.tdes0_bm.ic   = (i == seg_cnt - 1) ? config->enable_ioc : 0;
+        tdes.tdes0_bm.dp   = config->disable_pad;
+        tdes.tdes0_bm.cic  = config->cic;
+        tdes.tdes0_bm.vlic = config->vlic;
+        tdes.tdes0_bm.own  = (i != 0);
+        tdes.tdes1 = 0;
+        tdes.tdes1_bm.tbs1 = len & ENET_DMATxDesc_TBS1;
+        tdes.tdes1_bm.saic = config->saic;
+
+        tx_desc->tdes1 = tdes.tdes1;
+        tx_desc->tdes2_bm.buffer1 = addr;
+        tx_desc->tdes0 = tdes.tdes0;
+        tx_desc = (enet_tx_desc_t *)tx_desc->tdes3_bm.next_desc;
+    }
+
+    if (hold) {
+        pbuf_ref(p);
+        ctx->cfg.tx_slots[idx].p = p;
+    }
+    ctx->tx_busy += seg_cnt;
+    desc->tx_desc_list_cur = tx_desc;
+
+    /* hand over the first descriptor last so the DMA never sees a partial frame */
+    __asm volatile("fence rw, rw");
+    first->tdes0_bm.own = 1;
+    __asm volatile("fence rw, rw");
+    ctx->cfg.base->DMA_TX_POLL_DEMAND = 1;
+    ctx->stats.tx_frames++;
+
+    return ERR_OK;
+}
+#endif
+
+static err_t hpm_enet_netif_linkoutput(struct netif *netif, struct pbuf *p)
+{
+    hpm_enet_netif_t *ctx = (hpm_enet_netif_t *)netif->state;
+    err_t err;
+
+    if (p == NULL) {
+        return ERR_VAL;
+    }
+
+    if (!hpm_enet_netif_os_tx_lock(&ctx->os, HPM_ENET_NETIF_TX_LOCK_TIMEOUT_MS)) {
+        return ERR_TIMEOUT;
+    }
+    err = hpm_enet_netif_tx(ctx, p);
+    hpm_enet_netif_os_tx_unlock(&ctx->os);
+
+    return err;
+}
+
+/*---------------------------------------------------------------------*
+ * Setup
+ *---------------------------------------------------------------------*/
+hpm_stat_t hpm_enet_netif_config(hpm_enet_netif_t *ctx, const hpm_enet_netif_config_t *config)
+{
+    enet_desc_t *desc = config->desc;
+    uint32_t rx_count = desc->rx_buff_cfg.count;
+    uint32_t rx_size = desc->rx_buff_cfg.size;
+    hpm_enet_netif_rx_buf_t *rx_buf;
+
+    if ((config->base == NULL) || (config->mac == NULL) || (config->rx_bufs == NULL) ||
+        (config->rx_desc_buf == NULL) || (config->tx_slots == NULL) ||
+        ((config->rx_spare == NULL) && (config->rx_spare_count > 0)) ||
+        (rx_count < 2) || (rx_size % HPM_L1C_CACHELINE_SIZE != 0) ||
+        ((uint32_t)config->rx_spare % HPM_L1C_CACHELINE_SIZE != 0)) {
+        return status_invalid_argument;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->cfg = *config;
+    ctx->rx_refill_batch = LWIP_MAX(1U, LWIP_MIN(HPM_ENET_NETIF_RX_REFILL_BATCH, rx_count / 2));
+    ctx->rx_irq = (config->base->DMA_INTR_EN & ENET_DMA_INTR_EN_RIE_MASK) != 0;
+
+    for (uint32_t i = 0; i < rx_count + config->rx_spare_count; i++) {
+        rx_buf = &config->rx_bufs[i];
+        rx_buf->pc.custom_free_function = hpm_enet_netif_rx_buf_free;
+        rx_buf->owner = ctx;
+        if (i < rx_count) {
+            /* adopt the buffer the driver attached to the descriptor */
+            rx_buf->buf = (uint8_t *)desc->rx_desc_list_head[i].rdes2_bm.buffer1;
+            config->rx_desc_buf[i] = rx_buf;
+        } else {
+            rx_buf->buf = (uint8_t *)core_local_mem_to_sys_address(BOARD_RUNNING_CORE,
+                                                                   (uint32_t)config->rx_spare + (i - rx_count) * rx_size);
+            rx_buf->next = ctx->rx_free;
+            ctx->rx_free = rx_buf;
+        }
+    }
+    ctx->rx_desc_dirty = desc->rx_desc_list_cur;
+
+    for (uint32_t i = 0; i < desc->tx_buff_cfg.count; i++) {
+        config->tx_slots[i].bounce = desc->tx_desc_list_head[i].tdes2_bm.buffer1;
+        config->tx_slots[i].p = NULL;
+    }
+    ctx->tx_desc_dirty = desc->tx_desc_list_cur;
+
+    return status_success;
+}
+
+err_t hpm_enet_netif_init(struct netif *netif)
+{
+    hpm_enet_netif_t *ctx;
+    char name[] = "erx0";
+    void (*rx_entry)(void *) = NULL;
+
+    LWIP_ASSERT("netif != NULL", (netif != NULL));
+    ctx = (hpm_enet_netif_t *)netif->state;
+    if ((ctx == NULL) || (ctx->cfg.base == NULL)) {
+        return ERR_ARG;
+    }
+
+#if LWIP_NETIF_HOSTNAME
+    netif->hostname = "lwip";
+#endif
+
+    netif->name[0] = 'e';
+    netif->name[1] = '0' + netif->num;
+    netif->output = etharp_output;
+    netif->linkoutput = hpm_enet_netif_linkoutput;
+    netif->hwaddr_len = ETH_HWADDR_LEN;
+    memcpy(netif->hwaddr, ctx->cfg.mac, ETH_HWADDR_LEN);
+    netif->mtu = HPM_ENET_NETIF_MTU;
+    netif->flags |= NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_IGMP;
+
+#if defined(NO_SYS) && !NO_SYS
+    rx_entry = hpm_enet_netif_rx_thread;
+#endif
+    name[3] += netif->num;
+    if (hpm_enet_netif_os_init(&ctx->os, name, rx_entry, ctx) != status_success) {
+        return ERR_MEM;
+    }
+
+    /* the ISR and the RX thread start working from here */
+    ctx->netif = netif;
+
+    return ERR_OK;
+}
+
+/*---------------------------------------------------------------------*
+ * Statistics
+ *---------------------------------------------------------------------*/
+static void hpm_enet_netif_collect_hw_stats(hpm_enet_netif_t *ctx)
+{
+    uint32_t cnt = ctx->cfg.base->DMA_MISS_OVF_CNT;
+
+    ctx->stats.rx_missed += ENET_DMA_MISS_OVF_CNT_MISFRMCNT_GET(cnt);
+    ctx->stats.rx_fifo_overflow += ENET_DMA_MISS_OVF_CNT_OVFFRMCNT_GET(cnt);
+}
+
+void hpm_enet_netif_get_stats(hpm_enet_netif_t *ctx, hpm_enet_netif_stats_t *stats)
+{
+    hpm_enet_netif_collect_hw_stats(ctx);
+    *stats = ctx->stats;
+}
+
+void hpm_enet_netif_reset_stats(hpm_enet_netif_t *ctx)
+{
+    hpm_enet_netif_collect_hw_stats(ctx);
+    memset(&ctx->stats, 0, sizeof(ctx->stats));
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_ENET_NETIF_H
+#define HPM_ENET_NETIF_H
+
+#include "hpm_common.h"
+#include "hpm_enet_drv.h"
+#include "lwip/err.h"
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+#include "hpm_enet_netif_os.h"
+
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "hpm_enet_netif needs LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+/* frames handed to lwIP per poll before other threads get a turn */
+#ifndef HPM_ENET_NETIF_RX_BUDGET
+#define HPM_ENET_NETIF_RX_BUDGET            (16U)
+#endif
+
+/* consumed RX descriptors given back to the DMA at once, capped to half the ring */
+#ifndef HPM_ENET_NETIF_RX_REFILL_BATCH
+#define HPM_ENET_NETIF_RX_REFILL_BATCH      (8U)
+#endif
+
+/* the RX thread polls anyway after this long without an interrupt */
+#ifndef HPM_ENET_NETIF_RX_WAIT_MS
+#define HPM_ENET_NETIF_RX_WAIT_MS           (100U)
+#endif
+
+/* pbuf chains longer than this are copied into one TX buffer */
+#ifndef HPM_ENET_NETIF_TX_MAX_SEGS
+#define HPM_ENET_NETIF_TX_MAX_SEGS          (4U)
+#endif
+
+/* reclaim attempts while the TX ring is full before giving up with ERR_MEM */
+#ifndef HPM_ENET_NETIF_TX_RECLAIM_RETRY
+#define HPM_ENET_NETIF_TX_RECLAIM_RETRY     (10000U)
+#endif
+
+/* time to wait for another thread sending on the same interface */
+#ifndef HPM_ENET_NETIF_TX_LOCK_TIMEOUT_MS
+#define HPM_ENET_NETIF_TX_LOCK_TIMEOUT_MS   (250U)
+#endif
+
+typedef struct hpm_enet_netif hpm_enet_netif_t;
+
+typedef struct hpm_enet_netif_rx_buf {
+    struct pbuf_custom pc;          /* must be the first member */
+    hpm_enet_netif_t *owner;
+    uint8_t *buf;
+    struct hpm_enet_netif_rx_buf *next;
+} hpm_enet_netif_rx_buf_t;
+
+typedef struct {
+    uint32_t bounce;                /* TX buffer set up by the driver */
+    struct pbuf *p;                 /* pbuf held until its last descriptor is done */
+} hpm_enet_netif_tx_slot_t;
+
+typedef struct {
+    uint32_t rx_frames;             /* frames passed up to lwIP */
+    uint32_t rx_err_drop;           /* frames with MAC errors or a lost first segment */
+    uint32_t rx_input_drop;         /* frames lwIP refused to take */
+    uint32_t rx_pbuf_exhausted;     /* frames dropped because PBUF_POOL was empty */
+    uint32_t rx_copy;               /* frames copied because lwIP held every spare buffer */
+    uint32_t rx_desc_starved;       /* times the DMA suspended on a descriptor it didn't own */
+    uint32_t rx_missed;             /* frames the DMA missed for lack of descriptors */
+    uint32_t rx_fifo_overflow;      /* frames lost to an RX FIFO overflow */
+    uint32_t rx_irq;                /* switches from interrupt to polling */
+    uint32_t tx_frames;             /* frames queued to the DMA */
+    uint32_t tx_ring_full;          /* frames that had to wait for a TX descriptor */
+    uint32_t tx_drop;               /* frames dropped because the TX ring stayed full */
+} hpm_enet_netif_stats_t;
+
+typedef struct {
+    ENET_Type *base;
+    enet_desc_t *desc;                          /* rings set up by enet_controller_init() */
+    const uint8_t *mac;                         /* ETH_HWADDR_LEN bytes */
+    hpm_enet_netif_rx_buf_t *rx_bufs;           /* rx_buff_cfg.count + rx_spare_count entries */
+    hpm_enet_netif_rx_buf_t **rx_desc_buf;      /* rx_buff_cfg.count entries */
+    hpm_enet_netif_tx_slot_t *tx_slots;         /* tx_buff_cfg.count entries */
+    uint8_t *rx_spare;                          /* rx_spare_count buffers of rx_buff_cfg.size */
+    uint32_t rx_spare_count;
+} hpm_enet_netif_config_t;
+
+struct hpm_enet_netif {
+    hpm_enet_netif_config_t cfg;
+    struct netif *netif;
+    hpm_enet_netif_rx_buf_t *rx_free;           /* spare buffers, refilled by pbuf_free() */
+    enet_rx_desc_t *rx_desc_dirty;              /* oldest descriptor not given back yet */
+    uint32_t rx_dirty;
+    uint32_t rx_refill_batch;
+    bool rx_irq;                                /* RX interrupt enabled by enet_controller_init() */
+    enet_tx_desc_t *tx_desc_dirty;              /* oldest descriptor not reclaimed yet */
+    uint32_t tx_busy;
+    hpm_enet_netif_os_t os;
+    hpm_enet_netif_stats_t stats;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Attach an ENET controller and its buffers to a netif context
+ *
+ * Must be called after enet_controller_init() and before netif_add(). The
+ * RX buffers of the driver become the first entries of the RX buffer pool,
+ * the spare buffers are swapped into the ring when a frame is passed up to
+ * lwIP. The spare buffers must be aligned and sized to the cacheline like
+ * the driver's RX buffers.
+ *
+ * @param ctx netif context, usually static
+ * @param config controller, descriptor rings and storage of this interface
+ * @return status_success or status_invalid_argument
+ */
+hpm_stat_t hpm_enet_netif_config(hpm_enet_netif_t *ctx, const hpm_enet_netif_config_t *config);
+
+/**
+ * @brief netif init callback
+ *
+ * Pass it to netif_add() with the context configured by
+ * hpm_enet_netif_config() as state. With an OS, an RX thread is created for
+ * the interface.
+ *
+ * @param netif lwIP interface
+ * @return ERR_OK, or ERR_ARG/ERR_MEM on failure
+ */
+err_t hpm_enet_netif_init(struct netif *netif);
+
+/**
+ * @brief RX interrupt handler
+ *
+ * Masks the RX interrupt and wakes up the RX side, which polls the ring
+ * until it is empty before it unmasks the interrupt again. Call it from the
+ * ENET ISR, it does nothing unless an unmasked RX interrupt is pending.
+ *
+ * @param ctx netif context
+ * @return false if the netif isn't added yet, the caller has to clear the
+ *         RX interrupt status then
+ */
+bool hpm_enet_netif_isr(hpm_enet_netif_t *ctx);
+
+/**
+ * @brief Pass up to @p budget received frames to lwIP
+ *
+ * Used by the RX thread. When the ring is drained in interrupt mode, the RX
+ * interrupt is unmasked again.
+ *
+ * @param ctx netif context
+ * @param budget max number of frames
+ * @return number of frames, @p budget if the ring may hold more
+ */
+uint32_t hpm_enet_netif_poll(hpm_enet_netif_t *ctx, uint32_t budget);
+
+#if defined(NO_SYS) && NO_SYS
+/**
+ * @brief Receive from the main loop
+ *
+ * In interrupt mode only polls after an RX interrupt, otherwise on every
+ * call. At most HPM_ENET_NETIF_RX_BUDGET frames are handled per call.
+ *
+ * @param netif lwIP interface
+ */
+void hpm_enet_netif_input(struct netif *netif);
+#endif
+
+/**
+ * @brief Get the counters of an interface
+ *
+ * Also collects the missed frame counters of the DMA, which clear on read.
+ *
+ * @param ctx netif context
+ * @param [out] stats counters since init or the last reset
+ */
+void hpm_enet_netif_get_stats(hpm_enet_netif_t *ctx, hpm_enet_netif_stats_t *stats);
+
+/**
+ * @brief Clear the counters of an interface
+ *
+ * @param ctx netif context
+ */
+void hpm_enet_netif_reset_stats(hpm_enet_netif_t *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HPM_ENET_NETIF_H */
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "hpm_enet_netif_os.h"
+
+#if defined(NO_SYS) && !NO_SYS && defined(__ENABLE_RTTHREAD_NANO) && __ENABLE_RTTHREAD_NANO
+#include "rthw.h"
+#endif
+
+#if defined(NO_SYS) && !NO_SYS
+#if defined(__ENABLE_FREERTOS) && __ENABLE_FREERTOS
+hpm_stat_t hpm_enet_netif_os_init(hpm_enet_netif_os_t *os, const char *name, void (*rx_entry)(void *), void *arg)
+{
+    os->rx_sem = xSemaphoreCreateBinary();
+    os->tx_lock = xSemaphoreCreateMutex();
+    if ((os->rx_sem == NULL) || (os->tx_lock == NULL)) {
+        return status_fail;
+    }
+
+    if (xTaskCreate(rx_entry, name, HPM_ENET_NETIF_RX_THREAD_STACK_SIZE, arg,
+                    HPM_ENET_NETIF_RX_THREAD_PRIORITY, NULL) != pdPASS) {
+        return status_fail;
+    }
+
+    return status_success;
+}
+
+void hpm_enet_netif_os_rx_notify_from_isr(hpm_enet_netif_os_t *os)
+{
+    BaseType_t woken = pdFALSE;
+
+    xSemaphoreGiveFromISR(os->rx_sem, &woken);
+    portEND_SWITCHING_ISR(woken);
+}
+
+void hpm_enet_netif_os_rx_notify(hpm_enet_netif_os_t *os)
+{
+    xSemaphoreGive(os->rx_sem);
+}
+
+bool hpm_enet_netif_os_rx_wait(hpm_enet_netif_os_t *os, uint32_t timeout_ms)
+{
+    return xSemaphoreTake(os->rx_sem, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+}
+
+bool hpm_enet_netif_os_tx_lock(hpm_enet_netif_os_t *os, uint32_t timeout_ms)
+{
+    return xSemaphoreTake(os->tx_lock, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+}
+
+void hpm_enet_netif_os_tx_unlock(hpm_enet_netif_os_t *os)
+{
+    xSemaphoreGive(os->tx_lock);
+}
+
+void hpm_enet_netif_os_yield(void)
+{
+    taskYIELD();
+}
+#else
+hpm_stat_t hpm_enet_netif_os_init(hpm_enet_netif_os_t *os, const char *name, void (*rx_entry)(void *), void *arg)
+{
+    rt_thread_t thread;
+
+    os->rx_sem = rt_sem_create(name, 0, RT_IPC_FLAG_PRIO);
+    os->tx_lock = rt_mutex_create(name, RT_IPC_FLAG_PRIO);
+    if ((os->rx_sem == RT_NULL) || (os->tx_lock == RT_NULL)) {
+        return status_fail;
+    }
+
+    thread = rt_thread_create(name, rx_entry, arg, HPM_ENET_NETIF_RX_THREAD_STACK_SIZE,
+                              HPM_ENET_NETIF_RX_THREAD_PRIORITY, 16);
+    if ((thread == RT_NULL) || (rt_thread_startup(thread) != RT_EOK)) {
+        return status_fail;
+    }
+
+    return status_success;
+}
+
+void hpm_enet_netif_os_rx_notify_from_isr(hpm_enet_netif_os_t *os)
+{
+    /* a binary notification: don't let the count grow while the RX thread is polling */
+    if (os->rx_sem->value == 0) {
+        rt_sem_release(os->rx_sem);
+    }
+}
+
+void hpm_enet_netif_os_rx_notify(hpm_enet_netif_os_t *os)
+{
+    rt_base_t level = rt_hw_interrupt_disable();
+
+    if (os->rx_sem->value == 0) {
+        rt_sem_release(os->rx_sem);
+    }
+    rt_hw_interrupt_enable(level);
+}
+
+bool hpm_enet_netif_os_rx_wait(hpm_enet_netif_os_t *os, uint32_t timeout_ms)
+{
+    return rt_sem_take(os->rx_sem, rt_tick_from_millisecond(timeout_ms)) == RT_EOK;
+}
+
+bool hpm_enet_netif_os_tx_lock(hpm_enet_netif_os_t *os, uint32_t timeout_ms)
+{
+    return rt_mutex_take(os->tx_lock, rt_tick_from_millisecond(timeout_ms)) == RT_EOK;
+}
+
+void hpm_enet_netif_os_tx_unlock(hpm_enet_netif_os_t *os)
+{
+    rt_mutex_release(os->tx_lock);
+}
+
+void hpm_enet_netif_os_yield(void)
+{
+    rt_thread_yield();
+}
+#endif
+#else
+hpm_stat_t hpm_enet_netif_os_init(hpm_enet_netif_os_t *os, const char *name, void (*rx_entry)(void *), void *arg)
+{
+    (void)name;
+    (void)rx_entry;
+    (void)arg;
+
+    os->rx_pending = false;
+
+    return status_success;
+}
+
+void hpm_enet_netif_os_rx_notify_from_isr(hpm_enet_netif_os_t *os)
+{
+    os->rx_pending = true;
+}
+
+void hpm_enet_netif_os_rx_notify(hpm_enet_netif_os_t *os)
+{
+    os->rx_pending = true;
+}
+
+bool hpm_enet_netif_os_rx_wait(hpm_enet_netif_os_t *os, uint32_t timeout_ms)
+{
+    (void)timeout_ms;
+
+    if (!os->rx_pending) {
+        return false;
+    }
+    os->rx_pending = false;
+
+    return true;
+}
+
+bool hpm_enet_netif_os_tx_lock(hpm_enet_netif_os_t *os, uint32_t timeout_ms)
+{
+    (void)os;
+    (void)timeout_ms;
+
+    return true;
+}
+
+void hpm_enet_netif_os_tx_unlock(hpm_enet_netif_os_t *os)
+{
+    (void)os;
+}
+
+void hpm_enet_netif_os_yield(void)
+{
+}
+#endif
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_ENET_NETIF_OS_H
+#define HPM_ENET_NETIF_OS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "hpm_common.h"
+#include "lwip/opt.h"
+
+#if defined(NO_SYS) && !NO_SYS
+#if defined(__ENABLE_FREERTOS) && __ENABLE_FREERTOS
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
+#elif defined(__ENABLE_RTTHREAD_NANO) && __ENABLE_RTTHREAD_NANO
+#include "rtthread.h"
+#else
+#error "hpm_enet_netif: unsupported OS, enable FreeRTOS or RT-Thread nano"
+#endif
+#endif
+
+#if defined(NO_SYS) && !NO_SYS
+#if defined(__ENABLE_FREERTOS) && __ENABLE_FREERTOS
+#ifndef HPM_ENET_NETIF_RX_THREAD_STACK_SIZE
+#define HPM_ENET_NETIF_RX_THREAD_STACK_SIZE     (350U)      /* in words */
+#endif
+#ifndef HPM_ENET_NETIF_RX_THREAD_PRIORITY
+#define HPM_ENET_NETIF_RX_THREAD_PRIORITY       (configMAX_PRIORITIES - 1)
+#endif
+
+typedef struct {
+    SemaphoreHandle_t rx_sem;
+    SemaphoreHandle_t tx_lock;
+} hpm_enet_netif_os_t;
+#else
+#ifndef HPM_ENET_NETIF_RX_THREAD_STACK_SIZE
+#define HPM_ENET_NETIF_RX_THREAD_STACK_SIZE     (4096U)     /* in bytes */
+#endif
+#ifndef HPM_ENET_NETIF_RX_THREAD_PRIORITY
+#define HPM_ENET_NETIF_RX_THREAD_PRIORITY       (12U)
+#endif
+
+typedef struct {
+    rt_sem_t rx_sem;
+    rt_mutex_t tx_lock;
+} hpm_enet_netif_os_t;
+#endif
+#else
+typedef struct {
+    volatile bool rx_pending;
+} hpm_enet_netif_os_t;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Create the RX notification, the TX lock and the RX thread
+ *
+ * Without an OS only the RX notification flag is set up and @p rx_entry is
+ * not used, the application polls from its main loop instead.
+ *
+ * @param os OS objects of one interface
+ * @param name RX thread name
+ * @param rx_entry RX thread entry
+ * @param arg RX thread argument
+ * @return status_success or status_fail if an OS object couldn't be created
+ */
+hpm_stat_t hpm_enet_netif_os_init(hpm_enet_netif_os_t *os, const char *name, void (*rx_entry)(void *), void *arg);
+
+/**
+ * @brief Wake up the RX side, to be called from the ENET interrupt
+ *
+ * @param os OS objects of one interface
+ */
+void hpm_enet_netif_os_rx_notify_from_isr(hpm_enet_netif_os_t *os);
+
+/**
+ * @brief Wake up the RX side from thread context
+ *
+ * @param os OS objects of one interface
+ */
+void hpm_enet_netif_os_rx_notify(hpm_enet_netif_os_t *os);
+
+/**
+ * @brief Wait for an RX notification and consume it
+ *
+ * @param os OS objects of one interface
+ * @param timeout_ms time to block, 0 only tests and clears the notification
+ * @return true if a notification was pending
+ */
+bool hpm_enet_netif_os_rx_wait(hpm_enet_netif_os_t *os, uint32_t timeout_ms);
+
+/**
+ * @brief Serialize the TX ring between callers
+ *
+ * @param os OS objects of one interface
+ * @param timeout_ms time to block
+ * @return true if the lock is taken
+ */
+bool hpm_enet_netif_os_tx_lock(hpm_enet_netif_os_t *os, uint32_t timeout_ms);
+
+/**
+ * @brief Release the TX ring lock
+ *
+ * @param os OS objects of one interface
+ */
+void hpm_enet_netif_os_tx_unlock(hpm_enet_netif_os_t *os);
+
+/**
+ * @brief Let threads of the same priority run between two RX budgets
+ */
+void hpm_enet_netif_os_yield(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HPM_ENET_NETIF_OS_H */
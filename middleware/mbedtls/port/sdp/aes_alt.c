@@ -2087,6 +2087,125 @@ int mbedtls_aes_crypt_cbc(mbedtls_aes_context *ctx,
 #endif /* defined(MBEDTLS_AES_CRYPT_CBC_ALT) */
 #endif /* MBEDTLS_CIPHER_MODE_CBC */
 
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+
+#if defined(MBEDTLS_AES_CRYPT_CTR_ALT)
+/*
+ * AES-CTR buffer encryption/decryption
+ *
+ * The SDP has no counter mode, so up to MBEDTLS_HPM_SDP_CTR_BLOCKS counter blocks
+ * are laid out in a noncacheable buffer and encrypted in place by one ECB packet,
+ * then the key stream is xored with the input.
+ */
+int mbedtls_aes_crypt_ctr(mbedtls_aes_context *ctx,
+                          size_t length,
+                          size_t *nc_off,
+                          unsigned char nonce_counter[16],
+                          unsigned char stream_block[16],
+                          const unsigned char *input,
+                          unsigned char *output)
+{
+    static uint8_t ATTR_PLACE_AT_NONCACHEABLE local_key[32];
+    static uint8_t ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(16) local_stream[MBEDTLS_HPM_SDP_CTR_BLOCKS * 16];
+    hpm_stat_t status = status_success;
+    size_t n;
+
+    AES_VALIDATE_RET( ctx != NULL );
+    AES_VALIDATE_RET( nc_off != NULL );
+    AES_VALIDATE_RET( nonce_counter != NULL );
+    AES_VALIDATE_RET( stream_block != NULL );
+    AES_VALIDATE_RET( input != NULL );
+    AES_VALIDATE_RET( output != NULL );
+
+    n = *nc_off;
+    if (n > 0x0F)
+        return (MBEDTLS_ERR_AES_BAD_INPUT_DATA);
+
+    /* Use up the key stream left by the previous call */
+    while ((n != 0) && (length > 0))
+    {
+        *output++ = (unsigned char)(*input++ ^ stream_block[n]);
+        n = (n + 1) & 0x0F;
+        length--;
+    }
+    *nc_off = n;
+    if (length == 0)
+        return (0);
+
+    sdp_crypto_key_bits_t key_size;
+    switch (ctx->nr)
+    {
+        case 10:
+            key_size = sdp_aes_keybits_128;
+            break;
+        case 14:
+            key_size = sdp_aes_keybits_256;
+            break;
+        default:
+            return (MBEDTLS_ERR_AES_INVALID_KEY_LENGTH);
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    int ret;
+    if ((ret = mbedtls_mutex_lock(&mbedtls_threading_hwcrypto_hashcrypt_mutex)) != 0)
+        return (ret);
+#endif
+
+    uint32_t key_tmp = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) ctx->rk);
+    uint8_t *p_sys_key = (uint8_t *) core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) local_key);
+    uint8_t *p_sys_stream = (uint8_t *) core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) local_stream);
+    sdp_aes_ctx_t *p_sys_sdp_ctx = (sdp_aes_ctx_t *) core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) &s_aes_ctx);
+
+    memcpy(p_sys_key, (uint8_t *)key_tmp, key_size == sdp_aes_keybits_128 ? 16 : 32);
+    status = rom_sdp_aes_set_key(p_sys_sdp_ctx, (const uint8_t *)p_sys_key, key_size, 0);
+
+    while ((status == status_success) && (length > 0))
+    {
+        size_t blocks = (length + 15) / 16;
+        size_t use_len;
+        size_t i;
+        int j;
+
+        if (blocks > MBEDTLS_HPM_SDP_CTR_BLOCKS)
+            blocks = MBEDTLS_HPM_SDP_CTR_BLOCKS;
+
+        for (i = 0; i < blocks; i++)
+        {
+            memcpy(&p_sys_stream[i * 16], nonce_counter, 16);
+            for (j = 16; j > 0; j--)
+                if (++nonce_counter[j - 1] != 0)
+                    break;
+        }
+
+        status = rom_sdp_aes_crypt_ecb(p_sys_sdp_ctx, sdp_aes_op_encrypt, blocks * 16, p_sys_stream, p_sys_stream);
+        if (status != status_success)
+            break;
+
+        use_len = (length < blocks * 16) ? length : blocks * 16;
+        for (i = 0; i < use_len; i++)
+            output[i] = (unsigned char)(input[i] ^ p_sys_stream[i]);
+
+        /* Keep the rest of a partial last block for the next call */
+        if ((use_len & 0x0F) != 0)
+        {
+            memcpy(stream_block, &p_sys_stream[(blocks - 1) * 16], 16);
+            *nc_off = use_len & 0x0F;
+        }
+
+        input += use_len;
+        output += use_len;
+        length -= use_len;
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    if ((ret = mbedtls_mutex_unlock(&mbedtls_threading_hwcrypto_hashcrypt_mutex)) != 0)
+        return (ret);
+#endif
+    return (status_success == status) ? 0 : MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+}
+#endif /* defined(MBEDTLS_AES_CRYPT_CTR_ALT) */
+#endif /* MBEDTLS_CIPHER_MODE_CTR */
+
 #endif /* !CONFIG_MBEDTLS_USE_HPM_SDP */
 
 #endif /* MBEDTLS_AES_ALT */
@@ -79,6 +79,24 @@ typedef struct mbedtls_aes_context {
                                 case by generating an extra round key.
                                 </li></ul> */
 } mbedtls_aes_context;
+
+/**
+ * \brief Number of counter blocks encrypted by one SDP packet in AES-CTR,
+ *        the key stream buffer takes 16 bytes of noncacheable memory per block.
+ */
+#ifndef MBEDTLS_HPM_SDP_CTR_BLOCKS
+#define MBEDTLS_HPM_SDP_CTR_BLOCKS (64U)
+#endif
+
+#if defined(MBEDTLS_AES192_ALT_SW) || defined(MBEDTLS_AES256_ALT_SW)
+/**
+ * \brief Software AES key schedule and block cipher, without the SDP.
+ */
+int mbedtls_aes_setkey_enc_sw(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits);
+int mbedtls_aes_setkey_dec_sw(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits);
+int mbedtls_internal_aes_encrypt_sw(mbedtls_aes_context *ctx, const unsigned char input[16], unsigned char output[16]);
+int mbedtls_internal_aes_decrypt_sw(mbedtls_aes_context *ctx, const unsigned char input[16], unsigned char output[16]);
+#endif
 #endif /* defined(MBEDTLS_AES_ALT) */
 #if defined(MBEDTLS_CIPHER_MODE_XTS)
 /**
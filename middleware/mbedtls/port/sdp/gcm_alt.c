@@ -0,0 +1,587 @@
+/*
+ *  NIST SP800-38D compliant GCM implementation
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Fow HW integration change
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * http://csrc.nist.gov/publications/nistpubs/800-38D/SP-800-38D.pdf
+ *
+ * GHASH uses Shoup's method with 4-bit tables, as the mbed TLS implementation,
+ * with the 128-bit values held in four 32-bit words instead of two 64-bit ones.
+ * The payload of AES-128 and AES-256 is handed to mbedtls_aes_crypt_ctr() a
+ * whole record at a time, which the SDP port encrypts in bulk.
+ */
+
+#include "gcm_alt.h"
+#if defined(MBEDTLS_GCM_C) && defined(MBEDTLS_GCM_ALT)
+#include <string.h>
+
+#include "mbedtls/gcm.h"
+#include "mbedtls/platform_util.h"
+#include "mbedtls/error.h"
+
+/* Parameter validation macros */
+#define GCM_VALIDATE_RET( cond ) \
+    MBEDTLS_INTERNAL_VALIDATE_RET( cond, MBEDTLS_ERR_GCM_BAD_INPUT )
+#define GCM_VALIDATE( cond ) \
+    MBEDTLS_INTERNAL_VALIDATE( cond )
+
+/*
+ * 32-bit integer manipulation macros (big endian)
+ */
+#ifndef GET_UINT32_BE
+#define GET_UINT32_BE(n,b,i)                            \
+{                                                       \
+    (n) = ( (uint32_t) (b)[(i)    ] << 24 )             \
+        | ( (uint32_t) (b)[(i) + 1] << 16 )             \
+        | ( (uint32_t) (b)[(i) + 2] <<  8 )             \
+        | ( (uint32_t) (b)[(i) + 3]       );            \
+}
+#endif
+
+#ifndef PUT_UINT32_BE
+#define PUT_UINT32_BE(n,b,i)                            \
+{                                                       \
+    (b)[(i)    ] = (unsigned char) ( (n) >> 24 );       \
+    (b)[(i) + 1] = (unsigned char) ( (n) >> 16 );       \
+    (b)[(i) + 2] = (unsigned char) ( (n) >>  8 );       \
+    (b)[(i) + 3] = (unsigned char) ( (n)       );       \
+}
+#endif
+
+/*
+ * Initialize a context
+ */
+void mbedtls_gcm_init(mbedtls_gcm_context *ctx)
+{
+    GCM_VALIDATE( ctx != NULL );
+    memset(ctx, 0, sizeof(mbedtls_gcm_context));
+    mbedtls_aes_init(&ctx->aes_ctx);
+}
+
+/*
+ * Precompute small multiples of H, that is set
+ *      HM[i] = H times i,
+ * where i is seen as a field element as in [MGV], ie high-order bits
+ * correspond to low powers of P. The result is stored in the same way, that
+ * is the high-order bit of HM[i][0] corresponds to P^0 and the low-order bit
+ * of HM[i][3] corresponds to P^127.
+ */
+static int gcm_gen_table(mbedtls_gcm_context *ctx)
+{
+    int ret, i, j, k;
+    uint32_t v0, v1, v2, v3;
+    unsigned char h[16];
+    size_t olen = 0;
+
+    memset(h, 0, 16);
+    if ((ret = mbedtls_cipher_update(&ctx->cipher_ctx, h, 16, h, &olen)) != 0)
+        return (ret);
+
+    GET_UINT32_BE(v0, h,  0);
+    GET_UINT32_BE(v1, h,  4);
+    GET_UINT32_BE(v2, h,  8);
+    GET_UINT32_BE(v3, h, 12);
+
+    /* 8 = 1000 corresponds to 1 in GF(2^128) */
+    ctx->HM[8][0] = v0;
+    ctx->HM[8][1] = v1;
+    ctx->HM[8][2] = v2;
+    ctx->HM[8][3] = v3;
+
+    /* 0 corresponds to 0 in GF(2^128) */
+    memset(ctx->HM[0], 0, sizeof(ctx->HM[0]));
+
+    for (i = 4; i > 0; i >>= 1)
+    {
+        uint32_t T = (v3 & 1) * 0xe1000000U;
+        v3 = (v2 << 31) | (v3 >> 1);
+        v2 = (v1 << 31) | (v2 >> 1);
+        v1 = (v0 << 31) | (v1 >> 1);
+        v0 = (v0 >> 1) ^ T;
+
+        ctx->HM[i][0] = v0;
+        ctx->HM[i][1] = v1;
+        ctx->HM[i][2] = v2;
+        ctx->HM[i][3] = v3;
+    }
+
+    for (i = 2; i <= 8; i *= 2)
+    {
+        for (j = 1; j < i; j++)
+        {
+            for (k = 0; k < 4; k++)
+                ctx->HM[i + j][k] = ctx->HM[i][k] ^ ctx->HM[j][k];
+        }
+    }
+
+    return (0);
+}
+
+int mbedtls_gcm_setkey(mbedtls_gcm_context *ctx,
+                       mbedtls_cipher_id_t cipher,
+                       const unsigned char *key,
+                       unsigned int keybits)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const mbedtls_cipher_info_t *cipher_info;
+
+    GCM_VALIDATE_RET( ctx != NULL );
+    GCM_VALIDATE_RET( key != NULL );
+    GCM_VALIDATE_RET( keybits == 128 || keybits == 192 || keybits == 256 );
+
+    cipher_info = mbedtls_cipher_info_from_values(cipher, keybits,
+                                                  MBEDTLS_MODE_ECB);
+    if (cipher_info == NULL)
+        return (MBEDTLS_ERR_GCM_BAD_INPUT);
+
+    if (cipher_info->block_size != 16)
+        return (MBEDTLS_ERR_GCM_BAD_INPUT);
+
+    mbedtls_cipher_free(&ctx->cipher_ctx);
+
+    if ((ret = mbedtls_cipher_setup(&ctx->cipher_ctx, cipher_info)) != 0)
+        return (ret);
+
+    if ((ret = mbedtls_cipher_setkey(&ctx->cipher_ctx, key, keybits,
+                                     MBEDTLS_ENCRYPT)) != 0)
+    {
+        return (ret);
+    }
+
+    ctx->use_sdp = 0;
+#if defined(MBEDTLS_CIPHER_MODE_CTR) && defined(MBEDTLS_AES_CRYPT_CTR_ALT)
+    /* The SDP supports AES-128 and AES-256 only */
+    if ((cipher == MBEDTLS_CIPHER_ID_AES) && ((keybits == 128) || (keybits == 256)))
+    {
+        if ((ret = mbedtls_aes_setkey_enc(&ctx->aes_ctx, key, keybits)) != 0)
+            return (ret);
+        ctx->use_sdp = 1;
+    }
+#endif
+
+    if ((ret = gcm_gen_table(ctx)) != 0)
+        return (ret);
+
+    return (0);
+}
+
+/*
+ * Shoup's method for multiplication use this table with
+ *      last4[x] = x times P^128
+ * where x and last4[x] are seen as elements of GF(2^128) as in [MGV]
+ */
+static const uint32_t last4[16] =
+{
+    0x0000, 0x1c20, 0x3840, 0x2460,
+    0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560,
+    0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+/*
+ * Shifts z right by 4 bits, reduces the bits shifted out and adds HM[idx]
+ */
+#define GCM_SHIFT4_XOR(idx)                                 \
+{                                                           \
+    rem = z3 & 0xf;                                         \
+    z3 = (z2 << 28) | (z3 >> 4);                            \
+    z2 = (z1 << 28) | (z2 >> 4);                            \
+    z1 = (z0 << 28) | (z1 >> 4);                            \
+    z0 = (z0 >> 4) ^ (last4[rem] << 16);                    \
+    z0 ^= ctx->HM[(idx)][0];                                \
+    z1 ^= ctx->HM[(idx)][1];                                \
+    z2 ^= ctx->HM[(idx)][2];                                \
+    z3 ^= ctx->HM[(idx)][3];                                \
+}
+
+/*
+ * Sets x to x times H using the precomputed tables.
+ * x is seen as an element of GF(2^128) as in [MGV], most significant word first.
+ */
+static void gcm_mult(const mbedtls_gcm_context *ctx, uint32_t x[4])
+{
+    int i;
+    uint32_t z0, z1, z2, z3, rem;
+    uint8_t b, lo, hi;
+
+    lo = x[3] & 0xf;
+
+    z0 = ctx->HM[lo][0];
+    z1 = ctx->HM[lo][1];
+    z2 = ctx->HM[lo][2];
+    z3 = ctx->HM[lo][3];
+
+    for (i = 15; i >= 0; i--)
+    {
+        b = (uint8_t)(x[i >> 2] >> (24 - 8 * (i & 3)));
+        lo = b & 0xf;
+        hi = (b >> 4) & 0xf;
+
+        if (i != 15)
+            GCM_SHIFT4_XOR(lo);
+
+        GCM_SHIFT4_XOR(hi);
+    }
+
+    x[0] = z0;
+    x[1] = z1;
+    x[2] = z2;
+    x[3] = z3;
+}
+
+/*
+ * Adds data to the hash state block by block, the last block may be partial
+ * and is padded with zeros, and multiplies the state by H after each block.
+ */
+static void gcm_ghash(const mbedtls_gcm_context *ctx, unsigned char state[16],
+                      const unsigned char *data, size_t length)
+{
+    uint32_t x[4], w;
+    unsigned char last[16];
+    int k;
+
+    for (k = 0; k < 4; k++)
+        GET_UINT32_BE(x[k], state, 4 * k);
+
+    while (length > 0)
+    {
+        if (length < 16)
+        {
+            memset(last, 0, 16);
+            memcpy(last, data, length);
+            data = last;
+            length = 16;
+        }
+
+        for (k = 0; k < 4; k++)
+        {
+            GET_UINT32_BE(w, data, 4 * k);
+            x[k] ^= w;
+        }
+        gcm_mult(ctx, x);
+
+        data += 16;
+        length -= 16;
+    }
+
+    for (k = 0; k < 4; k++)
+        PUT_UINT32_BE(x[k], state, 4 * k);
+}
+
+/*
+ * Encrypts or decrypts the payload in counter mode, one counter block per
+ * 16 bytes of input starting at Y + 1, and leaves the last counter used in Y.
+ */
+static int gcm_ctr(mbedtls_gcm_context *ctx, size_t length,
+                   const unsigned char *input, unsigned char *output)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    unsigned char ectr[16];
+    size_t i, use_len, olen = 0;
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR) && defined(MBEDTLS_AES_CRYPT_CTR_ALT)
+    if (ctx->use_sdp)
+    {
+        unsigned char ctr[16];
+        size_t nc_off;
+        uint32_t low;
+        uint64_t blocks;
+
+        while (length > 0)
+        {
+            /* GCM increments the low 32 bits only, while the AES-CTR counter carries
+             * into the nonce: split the payload where the 32-bit counter wraps */
+            GET_UINT32_BE(low, ctx->y, 12);
+            low++;
+            blocks = 0x100000000ULL - low;
+            use_len = ((uint64_t)length > blocks * 16) ? (size_t)(blocks * 16) : length;
+
+            memcpy(ctr, ctx->y, 12);
+            PUT_UINT32_BE(low, ctr, 12);
+            nc_off = 0;
+            if ((ret = mbedtls_aes_crypt_ctr(&ctx->aes_ctx, use_len, &nc_off, ctr, ectr,
+                                             input, output)) != 0)
+            {
+                return (ret);
+            }
+
+            low += (uint32_t)((use_len + 15) / 16) - 1;
+            PUT_UINT32_BE(low, ctx->y, 12);
+
+            length -= use_len;
+            input += use_len;
+            output += use_len;
+        }
+        mbedtls_platform_zeroize(ectr, sizeof(ectr));
+
+        return (0);
+    }
+#endif
+
+    while (length > 0)
+    {
+        use_len = (length < 16) ? length : 16;
+
+        for (i = 16; i > 12; i--)
+            if (++ctx->y[i - 1] != 0)
+                break;
+
+        if ((ret = mbedtls_cipher_update(&ctx->cipher_ctx, ctx->y, 16, ectr,
+                                         &olen)) != 0)
+        {
+            return (ret);
+        }
+
+        for (i = 0; i < use_len; i++)
+            output[i] = ectr[i] ^ input[i];
+
+        length -= use_len;
+        input += use_len;
+        output += use_len;
+    }
+
+    return (0);
+}
+
+int mbedtls_gcm_starts(mbedtls_gcm_context *ctx,
+                       int mode,
+                       const unsigned char *iv,
+                       size_t iv_len,
+                       const unsigned char *add,
+                       size_t add_len)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    unsigned char work_buf[16];
+    size_t olen = 0;
+
+    GCM_VALIDATE_RET( ctx != NULL );
+    GCM_VALIDATE_RET( iv != NULL );
+    GCM_VALIDATE_RET( add_len == 0 || add != NULL );
+
+    /* IV and AD are limited to 2^64 bits, so 2^61 bytes */
+    /* IV is not allowed to be zero length */
+    if (iv_len == 0 ||
+        ((uint64_t) iv_len) >> 61 != 0 ||
+        ((uint64_t) add_len) >> 61 != 0)
+    {
+        return (MBEDTLS_ERR_GCM_BAD_INPUT);
+    }
+
+    memset(ctx->y, 0x00, sizeof(ctx->y));
+    memset(ctx->buf, 0x00, sizeof(ctx->buf));
+
+    ctx->mode = mode;
+    ctx->len = 0;
+    ctx->add_len = 0;
+
+    if (iv_len == 12)
+    {
+        memcpy(ctx->y, iv, iv_len);
+        ctx->y[15] = 1;
+    }
+    else
+    {
+        memset(work_buf, 0x00, 16);
+        PUT_UINT32_BE(iv_len * 8, work_buf, 12);
+
+        gcm_ghash(ctx, ctx->y, iv, iv_len);
+        gcm_ghash(ctx, ctx->y, work_buf, 16);
+    }
+
+    if ((ret = mbedtls_cipher_update(&ctx->cipher_ctx, ctx->y, 16,
+                                     ctx->base_ectr, &olen)) != 0)
+    {
+        return (ret);
+    }
+
+    ctx->add_len = add_len;
+    gcm_ghash(ctx, ctx->buf, add, add_len);
+
+    return (0);
+}
+
+int mbedtls_gcm_update(mbedtls_gcm_context *ctx,
+                       size_t length,
+                       const unsigned char *input,
+                       unsigned char *output)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    GCM_VALIDATE_RET( ctx != NULL );
+    GCM_VALIDATE_RET( length == 0 || input != NULL );
+    GCM_VALIDATE_RET( length == 0 || output != NULL );
+
+    if (output > input && (size_t) (output - input) < length)
+        return (MBEDTLS_ERR_GCM_BAD_INPUT);
+
+    /* Total length is restricted to 2^39 - 256 bits, ie 2^36 - 2^5 bytes
+     * Also check for possible overflow */
+    if (ctx->len + length < ctx->len ||
+        (uint64_t) ctx->len + length > 0xFFFFFFFE0ull)
+    {
+        return (MBEDTLS_ERR_GCM_BAD_INPUT);
+    }
+
+    ctx->len += length;
+
+    /* GHASH covers the ciphertext: hash the input before it may be overwritten
+     * when decrypting, the output when encrypting */
+    if (ctx->mode == MBEDTLS_GCM_DECRYPT)
+        gcm_ghash(ctx, ctx->buf, input, length);
+
+    if ((ret = gcm_ctr(ctx, length, input, output)) != 0)
+        return (ret);
+
+    if (ctx->mode == MBEDTLS_GCM_ENCRYPT)
+        gcm_ghash(ctx, ctx->buf, output, length);
+
+    return (0);
+}
+
+int mbedtls_gcm_finish(mbedtls_gcm_context *ctx,
+                       unsigned char *tag,
+                       size_t tag_len)
+{
+    unsigned char work_buf[16];
+    size_t i;
+    uint64_t orig_len;
+    uint64_t orig_add_len;
+
+    GCM_VALIDATE_RET( ctx != NULL );
+    GCM_VALIDATE_RET( tag != NULL );
+
+    orig_len = ctx->len * 8;
+    orig_add_len = ctx->add_len * 8;
+
+    if (tag_len > 16 || tag_len < 4)
+        return (MBEDTLS_ERR_GCM_BAD_INPUT);
+
+    memcpy(tag, ctx->base_ectr, tag_len);
+
+    if (orig_len || orig_add_len)
+    {
+        memset(work_buf, 0x00, 16);
+
+        PUT_UINT32_BE((orig_add_len >> 32), work_buf, 0);
+        PUT_UINT32_BE((orig_add_len),       work_buf, 4);
+        PUT_UINT32_BE((orig_len     >> 32), work_buf, 8);
+        PUT_UINT32_BE((orig_len),           work_buf, 12);
+
+        gcm_ghash(ctx, ctx->buf, work_buf, 16);
+
+        for (i = 0; i < tag_len; i++)
+            tag[i] ^= ctx->buf[i];
+    }
+
+    return (0);
+}
+
+int mbedtls_gcm_crypt_and_tag(mbedtls_gcm_context *ctx,
+                              int mode,
+                              size_t length,
+                              const unsigned char *iv,
+                              size_t iv_len,
+                              const unsigned char *add,
+                              size_t add_len,
+                              const unsigned char *input,
+                              unsigned char *output,
+                              size_t tag_len,
+                              unsigned char *tag)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    GCM_VALIDATE_RET( ctx != NULL );
+    GCM_VALIDATE_RET( iv != NULL );
+    GCM_VALIDATE_RET( add_len == 0 || add != NULL );
+    GCM_VALIDATE_RET( length == 0 || input != NULL );
+    GCM_VALIDATE_RET( length == 0 || output != NULL );
+    GCM_VALIDATE_RET( tag != NULL );
+
+    if ((ret = mbedtls_gcm_starts(ctx, mode, iv, iv_len, add, add_len)) != 0)
+        return (ret);
+
+    if ((ret = mbedtls_gcm_update(ctx, length, input, output)) != 0)
+        return (ret);
+
+    if ((ret = mbedtls_gcm_finish(ctx, tag, tag_len)) != 0)
+        return (ret);
+
+    return (0);
+}
+
+int mbedtls_gcm_auth_decrypt(mbedtls_gcm_context *ctx,
+                             size_t length,
+                             const unsigned char *iv,
+                             size_t iv_len,
+                             const unsigned char *add,
+                             size_t add_len,
+                             const unsigned char *tag,
+                             size_t tag_len,
+                             const unsigned char *input,
+                             unsigned char *output)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    unsigned char check_tag[16];
+    size_t i;
+    int diff;
+
+    GCM_VALIDATE_RET( ctx != NULL );
+    GCM_VALIDATE_RET( iv != NULL );
+    GCM_VALIDATE_RET( add_len == 0 || add != NULL );
+    GCM_VALIDATE_RET( tag != NULL );
+    GCM_VALIDATE_RET( length == 0 || input != NULL );
+    GCM_VALIDATE_RET( length == 0 || output != NULL );
+
+    if ((ret = mbedtls_gcm_crypt_and_tag(ctx, MBEDTLS_GCM_DECRYPT, length,
+                                         iv, iv_len, add, add_len,
+                                         input, output, tag_len, check_tag)) != 0)
+    {
+        return (ret);
+    }
+
+    /* Check tag in "constant-time" */
+    for (diff = 0, i = 0; i < tag_len; i++)
+        diff |= tag[i] ^ check_tag[i];
+
+    if (diff != 0)
+    {
+        mbedtls_platform_zeroize(output, length);
+        return (MBEDTLS_ERR_GCM_AUTH_FAILED);
+    }
+
+    return (0);
+}
+
+void mbedtls_gcm_free(mbedtls_gcm_context *ctx)
+{
+    if (ctx == NULL)
+        return;
+    mbedtls_cipher_free(&ctx->cipher_ctx);
+    mbedtls_aes_free(&ctx->aes_ctx);
+    mbedtls_platform_zeroize(ctx, sizeof(mbedtls_gcm_context));
+}
+
+#endif /* MBEDTLS_GCM_C && MBEDTLS_GCM_ALT */
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef GCM_ALT_H
+#define GCM_ALT_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include "mbedtls/aes.h"
+#include "mbedtls/cipher.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#if defined(MBEDTLS_GCM_ALT)
+/**
+ * \brief The GCM context structure.
+ *
+ * With an AES-128 or AES-256 key the payload is encrypted by the SDP through
+ * the AES-CTR of \c aes_ctx, a whole record at a time, and GHASH is computed
+ * by the CPU with 32-bit words for the RV32 cores.
+ */
+typedef struct mbedtls_gcm_context {
+    mbedtls_cipher_context_t cipher_ctx; /*!< The cipher context used for H, the first ECTR and
+                                              the payload when the SDP can't be used. */
+    mbedtls_aes_context aes_ctx;         /*!< The AES context used for the payload on the SDP. */
+    int use_sdp;                         /*!< Whether the payload is encrypted by the SDP. */
+    uint32_t HM[16][4];                  /*!< Precalculated H times i, most significant word first. */
+    uint64_t len;                        /*!< The total length of the encrypted data. */
+    uint64_t add_len;                    /*!< The total length of the additional data. */
+    unsigned char base_ectr[16];         /*!< The first ECTR for tag. */
+    unsigned char y[16];                 /*!< The Y working value. */
+    unsigned char buf[16];               /*!< The buf working value. */
+    int mode;                            /*!< The operation to perform:
+                                              #MBEDTLS_GCM_ENCRYPT or
+                                              #MBEDTLS_GCM_DECRYPT. */
+} mbedtls_gcm_context;
+#endif /* defined(MBEDTLS_GCM_ALT) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GCM_ALT_H */
@@ -0,0 +1,143 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+   Copyright (c) 2025 HPMicro
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "hpm_math.h"
+
+#include "tensorflow/lite/kernels/internal/reference/dequantize.h"
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/quantize.h"
+#include "tensorflow/lite/kernels/internal/reference/requantize.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/dequantize.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+
+namespace tflite {
+
+namespace {
+
+// hpmicro porting: the reference kernel computes every element in double
+// precision, which is emulated in software on a single precision FPU. An int8
+// input has only 256 values, their float results are tabulated in Prepare.
+// DequantizeOpData has to stay the first member, it is filled by
+// DequantizePrepare.
+struct DequantizeOpDataLut {
+  DequantizeOpData reference;
+  float lut[256];
+};
+
+}  // namespace
+
+void* DequantizeInit(TfLiteContext* context, const char* buffer,
+                     size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context,
+                                           sizeof(DequantizeOpDataLut));
+}
+
+TfLiteStatus DequantizePrepareLut(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(DequantizePrepare(context, node));
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, 0);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, 0);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  if (input->type == kTfLiteInt8 && output->type == kTfLiteFloat32) {
+    DequantizeOpDataLut* data =
+        static_cast<DequantizeOpDataLut*>(node->user_data);
+    const RuntimeShape lut_shape(1, 256);
+    int8_t values[256];
+    for (int i = 0; i < 256; i++) {
+      values[i] = static_cast<int8_t>(i - 128);
+    }
+    reference_ops::Dequantize(data->reference.quantization_params, lut_shape,
+                              values, lut_shape, data->lut);
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus DequantizeEval(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  DequantizeOpData* data = static_cast<DequantizeOpData*>(node->user_data);
+
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, 0);
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, 0);
+
+  if (output->type == kTfLiteFloat32) {
+    switch (input->type) {
+      case kTfLiteInt8: {
+#if 0 // original
+        reference_ops::Dequantize(data->quantization_params,
+                                  tflite::micro::GetTensorShape(input),
+                                  tflite::micro::GetTensorData<int8_t>(input),
+                                  tflite::micro::GetTensorShape(output),
+                                  tflite::micro::GetTensorData<float>(output));
+#else // hpmicro porting
+        const float* lut =
+            static_cast<DequantizeOpDataLut*>(node->user_data)->lut;
+        const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+        float* output_data = tflite::micro::GetTensorData<float>(output);
+        const int size =
+            MatchingFlatSize(tflite::micro::GetTensorShape(input),
+                             tflite::micro::GetTensorShape(output));
+        for (int i = 0; i < size; i++) {
+          output_data[i] = lut[static_cast<uint8_t>(input_data[i]) ^ 0x80];
+        }
+#endif
+      } break;
+      case kTfLiteInt16:
+        reference_ops::Dequantize(data->quantization_params,
+                                  tflite::micro::GetTensorShape(input),
+                                  tflite::micro::GetTensorData<int16_t>(input),
+                                  tflite::micro::GetTensorShape(output),
+                                  tflite::micro::GetTensorData<float>(output));
+        break;
+      default:
+        MicroPrintf("Input %s, output %s not supported.",
+                    TfLiteTypeGetName(input->type),
+                    TfLiteTypeGetName(output->type));
+        return kTfLiteError;
+    }
+  } else {
+    MicroPrintf("Input %s, output %s not supported.",
+                TfLiteTypeGetName(input->type),
+                TfLiteTypeGetName(output->type));
+    return kTfLiteError;
+  }
+
+  return kTfLiteOk;
+}
+
+TfLiteRegistration Register_DEQUANTIZE() {
+  return {/*init=*/DequantizeInit,
+          /*free=*/nullptr,
+          /*prepare=*/DequantizePrepareLut,
+          /*invoke=*/DequantizeEval,
+          /*profiling_string=*/nullptr,
+          /*builtin_code=*/0,
+          /*custom_name=*/nullptr,
+          /*version=*/0};
+}
+
+}  // namespace tflite
@@ -0,0 +1,148 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+   Copyright (c) 2025 HPMicro
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "hpm_math.h"
+
+#include "tensorflow/lite/micro/kernels/quantize.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/requantize.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_utils.h"
+
+namespace tflite {
+namespace {
+
+// hpmicro porting: int8 to int8 requantization only depends on the input
+// value, the outputs of the reference kernel for all 256 inputs are tabulated
+// in Prepare. OpDataQuantizeReference has to stay the first member, it is
+// filled by PrepareQuantizeReference.
+struct OpDataQuantizeLut {
+  OpDataQuantizeReference reference;
+  bool use_lut;
+  int8_t lut[256];
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpDataQuantizeLut));
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(PrepareQuantizeReference(context, node));
+
+  OpDataQuantizeLut* data = static_cast<OpDataQuantizeLut*>(node->user_data);
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, 0);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, 0);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  data->use_lut =
+      (input->type == kTfLiteInt8) && (output->type == kTfLiteInt8);
+  if (data->use_lut) {
+    int8_t values[256];
+    for (int i = 0; i < 256; i++) {
+      values[i] = static_cast<int8_t>(i - 128);
+    }
+    reference_ops::Requantize(
+        values, 256, data->reference.requantize_output_multiplier,
+        data->reference.requantize_output_shift,
+        data->reference.input_zero_point,
+        data->reference.quantization_params.zero_point, data->lut);
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+// Same result as reference_ops::AffineQuantize, which rounds through the
+// double precision round() that is emulated in software on a single precision
+// FPU. Values are clamped first to keep the integer conversion defined, the
+// clamped range still saturates the output for any zero point.
+void AffineQuantizeFloatToInt8(const float* input_data, int size, float scale,
+                               int32_t zero_point, int8_t* output_data) {
+  static constexpr int32_t min_val = std::numeric_limits<int8_t>::min();
+  static constexpr int32_t max_val = std::numeric_limits<int8_t>::max();
+
+  for (int i = 0; i < size; i++) {
+    float val = input_data[i] / scale;
+    val = val < -512.0f ? -512.0f : (val > 512.0f ? 512.0f : val);
+    int32_t rounded = static_cast<int32_t>(val);
+    const float frac = val - static_cast<float>(rounded);
+    if (frac >= 0.5f) {
+      rounded++;
+    } else if (frac <= -0.5f) {
+      rounded--;
+    }
+    const int32_t unclamped = rounded + zero_point;
+    output_data[i] = static_cast<int8_t>(
+        std::min(std::max(unclamped, min_val), max_val));
+  }
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpDataQuantizeLut* data =
+      static_cast<const OpDataQuantizeLut*>(node->user_data);
+
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, 0);
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, 0);
+
+  if (data->use_lut) {
+    const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+    int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output);
+    const int size = ElementCount(*input->dims);
+    for (int i = 0; i < size; i++) {
+      output_data[i] = data->lut[static_cast<uint8_t>(input_data[i]) ^ 0x80];
+    }
+    return kTfLiteOk;
+  }
+
+  if (input->type == kTfLiteFloat32 && output->type == kTfLiteInt8) {
+    AffineQuantizeFloatToInt8(
+        tflite::micro::GetTensorData<float>(input),
+        MatchingFlatSize(tflite::micro::GetTensorShape(input),
+                         tflite::micro::GetTensorShape(output)),
+        static_cast<float>(data->reference.quantization_params.scale),
+        data->reference.quantization_params.zero_point,
+        tflite::micro::GetTensorData<int8_t>(output));
+    return kTfLiteOk;
+  }
+
+  return EvalQuantizeReference(context, node);
+}
+
+}  // namespace
+
+TfLiteRegistration Register_QUANTIZE() {
+  return {/*init=*/Init,
+          /*free=*/nullptr,
+          /*prepare=*/Prepare,
+          /*invoke=*/Eval,
+          /*profiling_string=*/nullptr,
+          /*builtin_code=*/0,
+          /*custom_name=*/nullptr,
+          /*version=*/0};
+}
+
+}  // namespace tflite
@@ -75,6 +75,19 @@ class MicroMemoryPlanner {
   virtual TfLiteStatus GetOffsetForBuffer(tflite::ErrorReporter* error_reporter,
                                           int buffer_index, int* offset) = 0;
 
+  // HPMicro: address of the N-th buffer added to the planner, given the start
+  // of the arena head. Planners which place buffers outside of the head, such
+  // as the TieredMemoryPlanner, override it.
+  virtual TfLiteStatus GetBufferAddress(tflite::ErrorReporter* error_reporter,
+                                        int buffer_index, uint8_t* head,
+                                        uint8_t** address) {
+    int offset = -1;
+    TF_LITE_ENSURE_STATUS(
+        GetOffsetForBuffer(error_reporter, buffer_index, &offset));
+    *address = head + offset;
+    return kTfLiteOk;
+  }
+
   // Provides the scratch buffer in case that the memory planner needs it.
   // The lifetime of scratch buffers lifetime lasts until the static memory plan
   // is committed.
@@ -0,0 +1,263 @@
+/* Copyright 2025 HPMicro. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/memory_planner/tiered_memory_planner.h"
+
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+
+namespace tflite {
+
+TieredMemoryPlanner::TieredMemoryPlanner(uint8_t* fast_arena,
+                                         size_t fast_arena_size)
+    : fast_arena_(fast_arena),
+      fast_arena_size_(fast_arena_size),
+      max_buffer_count_(0),
+      buffer_count_(0),
+      requirements_(nullptr),
+      buffer_ids_sorted_(nullptr),
+      fast_planner_scratch_(nullptr),
+      slow_planner_scratch_(nullptr),
+      planner_scratch_size_(0),
+      fast_memory_size_(0),
+      slow_memory_size_(0),
+      need_to_calculate_plan_(true) {}
+
+TieredMemoryPlanner::~TieredMemoryPlanner() {
+  // We don't own the scratch buffer, so don't deallocate anything.
+}
+
+TfLiteStatus TieredMemoryPlanner::Init(unsigned char* scratch_buffer,
+                                       int scratch_buffer_size) {
+  // Reset internal states
+  buffer_count_ = 0;
+  fast_memory_size_ = 0;
+  slow_memory_size_ = 0;
+  need_to_calculate_plan_ = true;
+
+  // Allocate the arrays we need within the scratch buffer arena.
+  max_buffer_count_ = scratch_buffer_size / per_buffer_size();
+
+  unsigned char* next_free = scratch_buffer;
+  requirements_ = reinterpret_cast<BufferRequirements*>(next_free);
+  next_free += sizeof(BufferRequirements) * max_buffer_count_;
+
+  buffer_ids_sorted_ = reinterpret_cast<int*>(next_free);
+  next_free += sizeof(int) * max_buffer_count_;
+
+  planner_scratch_size_ =
+      GreedyMemoryPlanner::per_buffer_size() * max_buffer_count_;
+  fast_planner_scratch_ = next_free;
+  next_free += planner_scratch_size_;
+  slow_planner_scratch_ = next_free;
+  return kTfLiteOk;
+}
+
+TfLiteStatus TieredMemoryPlanner::AddBuffer(
+    tflite::ErrorReporter* error_reporter, int size, int first_time_used,
+    int last_time_used) {
+  return AddBuffer(error_reporter, size, first_time_used, last_time_used,
+                   kOnlinePlannedBuffer);
+}
+
+TfLiteStatus TieredMemoryPlanner::AddBuffer(
+    tflite::ErrorReporter* error_reporter, int size, int first_time_used,
+    int last_time_used, int offline_offset) {
+  if (buffer_count_ >= max_buffer_count_) {
+    TF_LITE_REPORT_ERROR(error_reporter, "Too many buffers (max is %d)",
+                         max_buffer_count_);
+    return kTfLiteError;
+  }
+  BufferRequirements* current = &requirements_[buffer_count_];
+  current->size = size;
+  current->offline_offset = offline_offset;
+  current->first_time_used = first_time_used;
+  current->last_time_used = last_time_used;
+  current->in_fast_memory = 0;
+  current->offset = -1;
+  ++buffer_count_;
+  need_to_calculate_plan_ = true;
+  return kTfLiteOk;
+}
+
+bool TieredMemoryPlanner::PlanFastTier() {
+  fast_planner_.Init(fast_planner_scratch_, planner_scratch_size_);
+  for (int i = 0; i < buffer_count_; ++i) {
+    const BufferRequirements* current = &requirements_[i];
+    if (current->in_fast_memory) {
+      fast_planner_.AddBuffer(nullptr, current->size, current->first_time_used,
+                              current->last_time_used);
+    }
+  }
+  return fast_planner_.GetMaximumMemorySize() <= fast_arena_size_;
+}
+
+void TieredMemoryPlanner::CalculatePlanIfNeeded() {
+  if (!need_to_calculate_plan_ || (buffer_count_ == 0)) {
+    return;
+  }
+  need_to_calculate_plan_ = false;
+
+  // Rank the online planned buffers by access density: shortest lifetime
+  // first, then smallest first so that more of them fit. The buffer counts
+  // are small, a stable insertion sort is enough.
+  int candidate_count = 0;
+  for (int i = 0; i < buffer_count_; ++i) {
+    const BufferRequirements* current = &requirements_[i];
+    if (current->offline_offset != kOnlinePlannedBuffer ||
+        current->size > static_cast<int>(fast_arena_size_)) {
+      continue;
+    }
+    const int lifetime = current->last_time_used - current->first_time_used;
+    int j = candidate_count;
+    while (j > 0) {
+      const BufferRequirements* previous =
+          &requirements_[buffer_ids_sorted_[j - 1]];
+      const int previous_lifetime =
+          previous->last_time_used - previous->first_time_used;
+      if ((previous_lifetime < lifetime) ||
+          ((previous_lifetime == lifetime) &&
+           (previous->size <= current->size))) {
+        break;
+      }
+      buffer_ids_sorted_[j] = buffer_ids_sorted_[j - 1];
+      --j;
+    }
+    buffer_ids_sorted_[j] = i;
+    ++candidate_count;
+  }
+
+  // Fill the fast memory in that order, a buffer whose plan does not fit goes
+  // back to the head of the arena.
+  for (int i = 0; i < candidate_count; ++i) {
+    BufferRequirements* current = &requirements_[buffer_ids_sorted_[i]];
+    current->in_fast_memory = 1;
+    if (!PlanFastTier()) {
+      current->in_fast_memory = 0;
+    }
+  }
+  PlanFastTier();
+  fast_memory_size_ = fast_planner_.GetMaximumMemorySize();
+
+  slow_planner_.Init(slow_planner_scratch_, planner_scratch_size_);
+  for (int i = 0; i < buffer_count_; ++i) {
+    const BufferRequirements* current = &requirements_[i];
+    if (current->in_fast_memory) {
+      continue;
+    }
+    if (current->offline_offset == kOnlinePlannedBuffer) {
+      slow_planner_.AddBuffer(nullptr, current->size, current->first_time_used,
+                              current->last_time_used);
+    } else {
+      slow_planner_.AddBuffer(nullptr, current->size, current->first_time_used,
+                              current->last_time_used, current->offline_offset);
+    }
+  }
+  slow_memory_size_ = slow_planner_.GetMaximumMemorySize();
+
+  // Keep the offsets, the tier planners are reused for the next plan.
+  int fast_index = 0;
+  int slow_index = 0;
+  for (int i = 0; i < buffer_count_; ++i) {
+    BufferRequirements* current = &requirements_[i];
+    if (current->in_fast_memory) {
+      fast_planner_.GetOffsetForBuffer(nullptr, fast_index++,
+                                       &current->offset);
+    } else {
+      slow_planner_.GetOffsetForBuffer(nullptr, slow_index++,
+                                       &current->offset);
+    }
+  }
+}
+
+size_t TieredMemoryPlanner::GetMaximumMemorySize() {
+  CalculatePlanIfNeeded();
+  return slow_memory_size_;
+}
+
+size_t TieredMemoryPlanner::GetFastMemorySize() {
+  CalculatePlanIfNeeded();
+  return fast_memory_size_;
+}
+
+int TieredMemoryPlanner::GetBufferCount() { return buffer_count_; }
+
+TfLiteStatus TieredMemoryPlanner::GetOffsetForBuffer(
+    tflite::ErrorReporter* error_reporter, int buffer_index, int* offset) {
+  CalculatePlanIfNeeded();
+  if ((buffer_index < 0) || (buffer_index >= buffer_count_)) {
+    TF_LITE_REPORT_ERROR(error_reporter,
+                         "buffer index %d is outside range 0 to %d",
+                         buffer_index, buffer_count_);
+    return kTfLiteError;
+  }
+  if (requirements_[buffer_index].in_fast_memory) {
+    TF_LITE_REPORT_ERROR(error_reporter,
+                         "buffer %d is placed in the fast memory",
+                         buffer_index);
+    return kTfLiteError;
+  }
+  *offset = requirements_[buffer_index].offset;
+  return kTfLiteOk;
+}
+
+TfLiteStatus TieredMemoryPlanner::GetBufferAddress(
+    tflite::ErrorReporter* error_reporter, int buffer_index, uint8_t* head,
+    uint8_t** address) {
+  CalculatePlanIfNeeded();
+  if ((buffer_index < 0) || (buffer_index >= buffer_count_)) {
+    TF_LITE_REPORT_ERROR(error_reporter,
+                         "buffer index %d is outside range 0 to %d",
+                         buffer_index, buffer_count_);
+    return kTfLiteError;
+  }
+  const BufferRequirements* current = &requirements_[buffer_index];
+  if (current->in_fast_memory) {
+    *address = fast_arena_ + current->offset;
+  } else {
+    *address = head + current->offset;
+  }
+  return kTfLiteOk;
+}
+
+void TieredMemoryPlanner::PrintMemoryPlan() {
+  CalculatePlanIfNeeded();
+
+  int fast_count = 0;
+  size_t fast_bytes = 0;
+  size_t slow_bytes = 0;
+  MicroPrintf("Tiered memory plan, %d buffers:", buffer_count_);
+  for (int i = 0; i < buffer_count_; ++i) {
+    const BufferRequirements* current = &requirements_[i];
+    MicroPrintf("buffer %d: size=%d, first_used=%d, last_used=%d, %s+%d",
+                i, current->size, current->first_time_used,
+                current->last_time_used,
+                current->in_fast_memory ? "fast" : "arena", current->offset);
+    if (current->in_fast_memory) {
+      ++fast_count;
+      fast_bytes += current->size;
+    } else {
+      slow_bytes += current->size;
+    }
+  }
+  MicroPrintf("fast memory: %d buffers, %d bytes, peak %d of %d bytes",
+              fast_count, static_cast<int>(fast_bytes),
+              static_cast<int>(fast_memory_size_),
+              static_cast<int>(fast_arena_size_));
+  MicroPrintf("arena head: %d buffers, %d bytes, peak %d bytes",
+              buffer_count_ - fast_count, static_cast<int>(slow_bytes),
+              static_cast<int>(slow_memory_size_));
+}
+
+}  // namespace tflite
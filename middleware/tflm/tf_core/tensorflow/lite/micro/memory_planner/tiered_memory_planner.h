@@ -0,0 +1,151 @@
+/* Copyright 2025 HPMicro. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_TIERED_MEMORY_PLANNER_H_
+#define TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_TIERED_MEMORY_PLANNER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+#include "tensorflow/lite/micro/memory_planner/micro_memory_planner.h"
+
+namespace tflite {
+
+// A memory planner that splits the non-persistent buffers between two
+// memories: a small fast one, such as the DLM of the core, and the head of the
+// tensor arena, which can then live in a large slow memory such as the SDRAM.
+//
+// The algorithm works like this:
+//  - The buffers are ranked by access density. Every byte of an activation
+//    tensor is written once and read about once while it is alive, so the
+//    buffers with the shortest lifetimes are accessed the most per byte and
+//    per operator they occupy the fast memory. Scratch buffers, which live for
+//    one operator only, come first.
+//  - In that order, a buffer is moved to the fast memory if the greedy plan of
+//    the buffers already there plus this one still fits in the fast memory.
+//  - The buffers left over, and the offline planned ones, are laid out in the
+//    head of the arena by a GreedyMemoryPlanner.
+//
+// GetMaximumMemorySize() only counts the head of the arena, so the arena can be
+// made smaller by the peak usage of the fast memory. The fast memory is reused
+// by every subgraph, like the head of the arena.
+//
+// Usage:
+//   static TieredMemoryPlanner planner(fast_arena, kFastArenaSize);
+//   MicroAllocator* allocator = MicroAllocator::Create(
+//       tensor_arena, kTensorArenaSize, &planner, error_reporter);
+//   MicroInterpreter interpreter(model, resolver, allocator, error_reporter);
+class TieredMemoryPlanner : public MicroMemoryPlanner {
+ public:
+  TieredMemoryPlanner(uint8_t* fast_arena, size_t fast_arena_size);
+  ~TieredMemoryPlanner() override;
+
+  // The scratch buffer is shared by the tiering and the two greedy planners of
+  // the tiers, each buffer requires per_buffer_size() bytes of it.
+  TfLiteStatus Init(unsigned char* scratch_buffer,
+                    int scratch_buffer_size) override;
+
+  TfLiteStatus AddBuffer(ErrorReporter* error_reporter, int size,
+                         int first_time_used, int last_time_used) override;
+
+  // Offline planned buffers always stay in the head of the arena, the offline
+  // offset is relative to it.
+  TfLiteStatus AddBuffer(ErrorReporter* error_reporter, int size,
+                         int first_time_used, int last_time_used,
+                         int offline_offset) override;
+
+  // Returns the high-water mark of the head of the arena.
+  size_t GetMaximumMemorySize() override;
+
+  int GetBufferCount() override;
+
+  // Offset of a buffer in the head of the arena, fails for the buffers placed
+  // in the fast memory.
+  TfLiteStatus GetOffsetForBuffer(ErrorReporter* error_reporter,
+                                  int buffer_index, int* offset) override;
+
+  TfLiteStatus GetBufferAddress(ErrorReporter* error_reporter,
+                                int buffer_index, uint8_t* head,
+                                uint8_t** address) override;
+
+  // Prints the placement of each buffer and the usage of the two tiers. Like
+  // the offsets, the placement is stored in the scratch buffer, so it must be
+  // printed before the arena is used, the MicroAllocator does it when
+  // TF_LITE_SHOW_MEMORY_USE is defined.
+  void PrintMemoryPlan() override;
+
+  // Returns the high-water mark of the fast memory.
+  size_t GetFastMemorySize();
+
+  // Number of bytes required in order to plan a buffer.
+  static size_t per_buffer_size() {
+    const int per_buffer_size =
+        sizeof(BufferRequirements) +                // requirements_
+        sizeof(int) +                               // buffer_ids_sorted_
+        2 * GreedyMemoryPlanner::per_buffer_size();  // tier planners
+    return per_buffer_size;
+  }
+
+ private:
+  // Plans the buffers marked for the fast memory, returns whether they fit.
+  bool PlanFastTier();
+
+  // If there isn't an up to date plan, calculate a new one.
+  void CalculatePlanIfNeeded();
+
+  uint8_t* fast_arena_;
+  size_t fast_arena_size_;
+
+  // How many buffers we can plan for, based on the scratch buffer size.
+  int max_buffer_count_;
+
+  // The number of buffers added so far.
+  int buffer_count_;
+
+  // Records the client-provided information about each buffer, and where the
+  // plan placed it.
+  struct BufferRequirements {
+    int size;
+    int offline_offset;
+    int first_time_used;
+    int last_time_used;
+    int in_fast_memory;
+    int offset;
+  };
+
+  BufferRequirements* requirements_;
+  // Online planned buffers, in descending order of access density.
+  int* buffer_ids_sorted_;
+
+  GreedyMemoryPlanner fast_planner_;
+  GreedyMemoryPlanner slow_planner_;
+  unsigned char* fast_planner_scratch_;
+  unsigned char* slow_planner_scratch_;
+  int planner_scratch_size_;
+
+  size_t fast_memory_size_;
+  size_t slow_memory_size_;
+
+  // Whether buffers have been added since the last plan was calculated.
+  bool need_to_calculate_plan_;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MEMORY_PLANNER_TIERED_MEMORY_PLANNER_H_
@@ -273,10 +273,17 @@ TfLiteStatus CommitPlan(ErrorReporter* error_reporter,
   for (size_t i = 0; i < allocation_info_size; ++i) {
     const AllocationInfo* current = &allocation_info[i];
     if (current->needs_allocating) {
+#if 0 // original
       int offset = -1;
       TF_LITE_ENSURE_STATUS(
           planner->GetOffsetForBuffer(error_reporter, planner_index, &offset));
       *current->output_ptr = reinterpret_cast<void*>(starting_point + offset);
+#else // hpmicro porting: the planner may place buffers outside of the head
+      uint8_t* address = nullptr;
+      TF_LITE_ENSURE_STATUS(planner->GetBufferAddress(
+          error_reporter, planner_index, starting_point, &address));
+      *current->output_ptr = reinterpret_cast<void*>(address);
+#endif
       ++planner_index;
     }
   }
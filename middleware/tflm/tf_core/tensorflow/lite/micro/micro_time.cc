@@ -28,11 +28,27 @@ limitations under the License.
 
 #if defined(TF_LITE_USE_CTIME)
 #include <ctime>
+#elif defined(__HPMICRO__)
+#include "hpm_clock_drv.h"
+#include "hpm_csr_drv.h"
 #endif
 
 namespace tflite {
 
-#if !defined(TF_LITE_USE_CTIME)
+#if defined(__HPMICRO__) && !defined(TF_LITE_USE_CTIME)
+
+// HPMicro: ticks are cycles of the core, from the mcycle counter. The profiler
+// only uses differences of the low 32 bits, so the wrap-around is harmless for
+// events shorter than 2^31 cycles.
+int32_t ticks_per_second() {
+  return static_cast<int32_t>(clock_get_frequency(clock_cpu0));
+}
+
+int32_t GetCurrentTimeTicks() {
+  return static_cast<int32_t>(hpm_csr_get_core_mcycle());
+}
+
+#elif !defined(TF_LITE_USE_CTIME)
 
 // Reference implementation of the ticks_per_second() function that's required
 // for a platform to support Tensorflow Lite for Microcontrollers profiling.
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "board.h"
+#include "hpm_clock_drv.h"
+#include "hpm_csr_drv.h"
+#include "hpm_gptmr_drv.h"
+#include "hpm_dma_mgr.h"
+#include "chry_ringbuffer.h"
+#include "chry_spsc_ringbuffer.h"
+
+/*
+ * Throughput of the cherryrb ringbuffers on target.
+ *
+ * - copy: the CPU writes then reads TEST_COPY_BYTES in chunks through chry_ringbuffer and through
+ *   chry_spsc_ringbuffer in stream and in record mode, the difference is the cost of the fences
+ *   and of the record headers
+ * - dma: a GPTMR paces a DMA which writes words into the pool of a chry_spsc_ringbuffer in a loop,
+ *   with two linked descriptors each covering half of the pool. The consumer takes the write
+ *   pointer from the remaining transfer size, checks the data and poisons what it read, so that a
+ *   write pointer ahead of the DMA is seen as an error. The write pointer is taken again before the
+ *   read is done, the data the DMA overwrote meanwhile is counted as lost. The DMA writes the same
+ *   pattern on every lap, so overwritten data is only seen in the lost count, the host benchmark
+ *   of cherryrb checks it. When data is lost the consumer may poison words of the next lap, so
+ *   errors are only meaningful at rates without loss.
+ */
+
+#define APP_COPY_POOL_SIZE      (4096U)
+#define APP_DMA_POOL_SIZE       (16384U)
+#define APP_DMA_HALF_SIZE       (APP_DMA_POOL_SIZE / 2U)
+#define APP_DMA_POISON          (0xDEADBEEFUL)
+
+#define TEST_COPY_BYTES         (1024U * 1024U)
+#define TEST_DMA_MS             (1000U)
+
+typedef uint32_t (*app_copy_t)(uint8_t *data, uint32_t size);
+
+static chry_ringbuffer_t s_rb;
+ATTR_ALIGN(CHRY_SPSC_RB_CACHELINE_SIZE) static chry_spsc_ringbuffer_t s_spsc_rb;
+ATTR_ALIGN(CHRY_SPSC_RB_CACHELINE_SIZE) static uint8_t s_copy_pool[APP_COPY_POOL_SIZE];
+static uint8_t s_data[1024];
+
+/* the DMA writes the pool and reads the descriptors behind the data cache */
+ATTR_PLACE_AT_NONCACHEABLE_BSS_WITH_ALIGNMENT(CHRY_SPSC_RB_CACHELINE_SIZE) static uint32_t s_dma_pool[APP_DMA_POOL_SIZE / 4U];
+ATTR_PLACE_AT_NONCACHEABLE_BSS_WITH_ALIGNMENT(8) static dma_mgr_linked_descriptor_t s_dma_desc[2];
+static uint32_t s_dma_pattern[APP_DMA_HALF_SIZE / 4U];
+static dma_resource_t s_dma;
+
+static uint32_t app_copy_rb(uint8_t *data, uint32_t size)
+{
+    (void)chry_ringbuffer_write(&s_rb, data, size);
+    return chry_ringbuffer_read(&s_rb, data, size);
+}
+
+static uint32_t app_copy_spsc(uint8_t *data, uint32_t size)
+{
+    (void)chry_spsc_ringbuffer_write(&s_spsc_rb, data, size);
+    return chry_spsc_ringbuffer_read(&s_spsc_rb, data, size);
+}
+
+static uint32_t app_copy_spsc_record(uint8_t *data, uint32_t size)
+{
+    (void)chry_spsc_ringbuffer_write_record(&s_spsc_rb, data, size);
+    return chry_spsc_ringbuffer_read_record(&s_spsc_rb, data, size);
+}
+
+static uint32_t app_kbps(uint64_t bytes, uint64_t cycles)
+{
+    return (uint32_t)(bytes * clock_get_frequency(clock_cpu0) / 1024U / cycles);
+}
+
+static void test_copy(const char *name, app_copy_t copy, uint32_t chunk)
+{
+    uint32_t count = TEST_COPY_BYTES / chunk;
+    uint32_t bytes = 0;
+    uint64_t start;
+    uint64_t cycles;
+
+    chry_ringbuffer_init(&s_rb, s_copy_pool, APP_COPY_POOL_SIZE);
+    chry_spsc_ringbuffer_init(&s_spsc_rb, s_copy_pool, APP_COPY_POOL_SIZE);
+
+    start = hpm_csr_get_core_mcycle();
+    for (uint32_t i = 0; i < count; i++) {
+        bytes += copy(s_data, chunk);
+    }
+    cycles = hpm_csr_get_core_mcycle() - start;
+
+    printf("  %-12s %4u bytes: %6u KB/s%s\n", name, chunk, app_kbps(TEST_COPY_BYTES, cycles),
+           (bytes == TEST_COPY_BYTES) ? "" : ", ERROR");
+}
+
+static void app_dma_start(uint32_t rate)
+{
+    dma_mgr_chn_conf_t config;
+    gptmr_channel_config_t gptmr_config;
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(s_dma_pool); i++) {
+        s_dma_pool[i] = APP_DMA_POISON;
+    }
+    chry_spsc_ringbuffer_init(&s_spsc_rb, s_dma_pool, APP_DMA_POOL_SIZE);
+
+    /* one word per GPTMR reload, half of the pool per descriptor, the second links back to the first */
+    dma_mgr_get_default_chn_config(&config);
+    config.en_dmamux = true;
+    config.dmamux_src = BOARD_GPTMR_DMA_SRC;
+    config.src_mode = DMA_MGR_HANDSHAKE_MODE_NORMAL;
+    config.dst_mode = DMA_MGR_HANDSHAKE_MODE_HANDSHAKE;
+    config.src_width = DMA_MGR_TRANSFER_WIDTH_WORD;
+    config.dst_width = DMA_MGR_TRANSFER_WIDTH_WORD;
+    config.src_burst_size = DMA_MGR_NUM_TRANSFER_PER_BURST_1T;
+    config.src_addr_ctrl = DMA_MGR_ADDRESS_CONTROL_INCREMENT;
+    config.dst_addr_ctrl = DMA_MGR_ADDRESS_CONTROL_INCREMENT;
+    config.interrupt_mask = DMA_MGR_INTERRUPT_MASK_ALL;
+    config.src_addr = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)s_dma_pattern);
+    config.size_in_byte = APP_DMA_HALF_SIZE;
+
+    config.dst_addr = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)s_dma_pool);
+    config.linked_ptr = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)&s_dma_desc[1]);
+    dma_mgr_config_linked_descriptor(&s_dma, &config, &s_dma_desc[0]);
+    dma_mgr_setup_channel(&s_dma, &config);
+
+    config.dst_addr = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)s_dma_pool + APP_DMA_HALF_SIZE);
+    config.linked_ptr = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)&s_dma_desc[0]);
+    dma_mgr_config_linked_descriptor(&s_dma, &config, &s_dma_desc[1]);
+
+    gptmr_channel_get_default_config(BOARD_GPTMR, &gptmr_config);
+    gptmr_config.reload = clock_get_frequency(BOARD_GPTMR_CLK_NAME) / (rate / 4U);
+    gptmr_config.dma_request_event = gptmr_dma_request_on_reload;
+    gptmr_channel_reset_count(BOARD_GPTMR, BOARD_GPTMR_CHANNEL);
+    gptmr_channel_config(BOARD_GPTMR, BOARD_GPTMR_CHANNEL, &gptmr_config, false);
+
+    dma_mgr_enable_channel(&s_dma);
+    gptmr_start_counter(BOARD_GPTMR, BOARD_GPTMR_CHANNEL);
+}
+
+static void app_dma_stop(void)
+{
+    gptmr_stop_counter(BOARD_GPTMR, BOARD_GPTMR_CHANNEL);
+    dma_mgr_disable_channel(&s_dma);
+}
+
+/* size in byte the DMA writes before it wraps to the start of the pool */
+static uint32_t app_dma_remaining(void)
+{
+    uint32_t llp;
+    uint32_t remaining;
+
+    do {
+        llp = s_dma.base->CHCTRL[s_dma.channel].LLPOINTER;
+        dma_mgr_get_chn_remaining_transize(&s_dma, &remaining);
+    } while (llp != s_dma.base->CHCTRL[s_dma.channel].LLPOINTER);
+
+    remaining *= 4U;
+    /* the first half is being written while the second half is linked next */
+    if (llp == core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)&s_dma_desc[1])) {
+        remaining += APP_DMA_HALF_SIZE;
+    }
+    return remaining;
+}
+
+static void test_dma(uint32_t rate)
+{
+    uint64_t duration = (uint64_t)clock_get_frequency(clock_cpu0) / 1000U * TEST_DMA_MS;
+    uint64_t bytes = 0;
+    uint64_t busy = 0;
+    uint32_t errors = 0;
+    uint64_t start;
+    uint64_t now;
+
+    app_dma_start(rate);
+    start = hpm_csr_get_core_mcycle();
+    now = start;
+    while ((now - start) < duration) {
+        uint64_t begin = now;
+        uint32_t offset;
+        uint32_t size;
+        uint32_t *data;
+
+        chry_spsc_ringbuffer_dma_write_update(&s_spsc_rb, app_dma_remaining());
+        data = chry_spsc_ringbuffer_linear_read_setup(&s_spsc_rb, &size);
+        offset = (uint32_t)((uint8_t *)data - (uint8_t *)s_dma_pool);
+        for (uint32_t i = 0; i < size / 4U; i++) {
+            if (data[i] != ((offset / 4U + i) % ARRAY_SIZE(s_dma_pattern))) {
+                errors++;
+            }
+            data[i] = APP_DMA_POISON;
+        }
+        chry_spsc_ringbuffer_dma_write_update(&s_spsc_rb, app_dma_remaining());
+        bytes += chry_spsc_ringbuffer_linear_read_done(&s_spsc_rb, size);
+
+        now = hpm_csr_get_core_mcycle();
+        if (size != 0U) {
+            busy += now - begin;
+        }
+    }
+    app_dma_stop();
+
+    printf("  %6u KB/s: %6u KB/s read, %6u bytes lost, %u errors, consumer busy %u%%\n", rate / 1024U,
+           app_kbps(bytes, now - start), chry_spsc_ringbuffer_get_dma_overrun(&s_spsc_rb), errors,
+           (uint32_t)(busy * 100U / (now - start)));
+}
+
+int main(void)
+{
+    static const uint32_t chunks[] = { 16, 256, 1024 };
+    static const uint32_t rates[] = { 256U * 1024U, 1024U * 1024U, 4096U * 1024U, 16384U * 1024U };
+
+    board_init();
+    clock_add_to_group(BOARD_GPTMR_CLK_NAME, BOARD_RUNNING_CORE & 0x01);
+    dma_mgr_init();
+    if (dma_mgr_request_resource(&s_dma) != status_success) {
+        printf("dma resource request failed\n");
+        while (1) {
+            ;
+        }
+    }
+
+    for (uint32_t i = 0; i < sizeof(s_data); i++) {
+        s_data[i] = (uint8_t)i;
+    }
+    for (uint32_t i = 0; i < ARRAY_SIZE(s_dma_pattern); i++) {
+        s_dma_pattern[i] = i;
+    }
+
+    printf("cherryrb benchmark\n");
+    printf("copy, pool of %u bytes:\n", APP_COPY_POOL_SIZE);
+    for (uint32_t i = 0; i < ARRAY_SIZE(chunks); i++) {
+        test_copy("ringbuffer", app_copy_rb, chunks[i]);
+        test_copy("spsc", app_copy_spsc, chunks[i]);
+        test_copy("spsc record", app_copy_spsc_record, chunks[i]);
+    }
+    printf("dma producer, pool of %u bytes:\n", APP_DMA_POOL_SIZE);
+    for (uint32_t i = 0; i < ARRAY_SIZE(rates); i++) {
+        test_dma(rates[i]);
+    }
+    printf("cherryrb benchmark done\n");
+
+    while (1) {
+        ;
+    }
+    return 0;
+}
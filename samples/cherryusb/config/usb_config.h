@@ -82,6 +82,11 @@
 #define CONFIG_USBDEV_MSC_MAX_BUFSIZE 512
 #endif
 
+/* number of msc transfer buffers, more than 1 overlaps storage and usb transfers with CONFIG_USBDEV_MSC_THREAD */
+#ifndef CONFIG_USBDEV_MSC_BUFCOUNT
+#define CONFIG_USBDEV_MSC_BUFCOUNT 1
+#endif
+
 #ifndef CONFIG_USBDEV_MSC_MANUFACTURER_STRING
 #define CONFIG_USBDEV_MSC_MANUFACTURER_STRING ""
 #endif
@@ -127,6 +132,27 @@
 
 #define CONFIG_USBDEV_RNDIS_USING_LWIP
 
+/* cdc ncm transfer block sizes, several datagrams are aggregated in one ntb */
+#ifndef CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE
+#define CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE 16384
+#endif
+
+#ifndef CONFIG_USBDEV_CDC_NCM_NTB_OUT_SIZE
+#define CONFIG_USBDEV_CDC_NCM_NTB_OUT_SIZE 16384
+#endif
+
+/* datagrams aggregated in one ntb to the host */
+#ifndef CONFIG_USBDEV_CDC_NCM_MAX_DATAGRAMS
+#define CONFIG_USBDEV_CDC_NCM_MAX_DATAGRAMS 32
+#endif
+
+/* ndps parsed in one ntb from the host */
+#ifndef CONFIG_USBDEV_CDC_NCM_MAX_NDPS
+#define CONFIG_USBDEV_CDC_NCM_MAX_NDPS 8
+#endif
+
+#define CONFIG_USBDEV_CDC_NCM_USING_LWIP
+
 /* ================ USB HOST Stack Configuration ================== */
 
 #define CONFIG_USBHOST_MAX_RHPORTS          1
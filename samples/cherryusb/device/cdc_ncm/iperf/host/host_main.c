@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Checks of the cdc ncm class on a host: transfer blocks made by hand are handed to the out
+ * endpoint callback and parsed by usbd_cdc_ncm_eth_rx, datagrams are sent by usbd_cdc_ncm_eth_tx.
+ * The USB controller and lwip functions are stubs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "usbd_core.h"
+#include "usbd_cdc_ncm.h"
+
+#define NCM_OUT_EP 0x01U
+#define NCM_IN_EP  0x81U
+#define NCM_INT_EP 0x82U
+
+/* endpoint and event callbacks of usbd_cdc_ncm.c, registered by usbd_cdc_ncm_init_intf */
+void cdc_ncm_bulk_out(uint8_t busid, uint8_t ep, uint32_t nbytes);
+void cdc_ncm_notify_handler(uint8_t busid, uint8_t event, void *arg);
+
+#define NTB_NDP_LEN(n) (sizeof(struct cdc_ncm_ndp16) + ((n) + 1U) * sizeof(struct cdc_ncm_ndp16_datagram))
+
+static struct usbd_interface s_intf;
+static uint8_t *s_read_buf;
+static uint32_t s_writes;
+static uint32_t s_fail_count;
+
+/* controller stubs, the buffer of the last read is where the next ntb is received */
+int usbd_ep_start_read(uint8_t busid, const uint8_t ep, uint8_t *data, uint32_t data_len)
+{
+    (void)busid;
+    (void)ep;
+    (void)data_len;
+    s_read_buf = data;
+    return 0;
+}
+
+int usbd_ep_start_write(uint8_t busid, const uint8_t ep, const uint8_t *data, uint32_t data_len)
+{
+    (void)busid;
+    (void)data;
+    (void)data_len;
+    if (ep == NCM_IN_EP) {
+        s_writes++;
+    }
+    return 0;
+}
+
+bool usb_device_is_configured(uint8_t busid)
+{
+    (void)busid;
+    return true;
+}
+
+uint8_t usbd_get_port_speed(uint8_t busid)
+{
+    (void)busid;
+    return USB_SPEED_HIGH;
+}
+
+uint16_t usbd_get_ep_mps(uint8_t busid, uint8_t ep)
+{
+    (void)busid;
+    (void)ep;
+    return 512U;
+}
+
+void usbd_add_endpoint(uint8_t busid, struct usbd_endpoint *ep)
+{
+    (void)busid;
+    (void)ep;
+}
+
+/* lwip stubs */
+struct pbuf *pbuf_alloc(pbuf_layer layer, uint16_t length, pbuf_type type)
+{
+    struct pbuf *p = malloc(sizeof(struct pbuf) + length);
+
+    (void)layer;
+    (void)type;
+    if (p != NULL) {
+        p->payload = p + 1;
+        p->tot_len = length;
+        p->len = length;
+    }
+    return p;
+}
+
+uint8_t pbuf_free(struct pbuf *p)
+{
+    free(p);
+    return 1;
+}
+
+int8_t pbuf_take(struct pbuf *buf, const void *dataptr, uint16_t len)
+{
+    memcpy(buf->payload, dataptr, len);
+    return 0;
+}
+
+uint16_t pbuf_copy_partial(const struct pbuf *p, void *dataptr, uint16_t len, uint16_t offset)
+{
+    memcpy(dataptr, (const uint8_t *)p->payload + offset, len);
+    return len;
+}
+
+static void report(const char *name, int ok)
+{
+    if (!ok) {
+        s_fail_count++;
+    }
+    printf("  %-32s %s\n", name, ok ? "PASS" : "FAIL");
+}
+
+static void ntb_put_nth(uint8_t *ntb, uint16_t block_len, uint16_t ndp_index)
+{
+    struct cdc_ncm_nth16 *nth = (struct cdc_ncm_nth16 *)ntb;
+
+    nth->dwSignature = CDC_NCM_NTH16_SIGNATURE;
+    nth->wHeaderLength = sizeof(struct cdc_ncm_nth16);
+    nth->wSequence = 0;
+    nth->wBlockLength = block_len;
+    nth->wNdpIndex = ndp_index;
+}
+
+/* an ndp of count datagrams of len bytes, from index on, each one filled with its index */
+static void ntb_put_ndp(uint8_t *ntb, uint16_t ndp_index, uint16_t next, uint16_t count, uint16_t index, uint16_t len)
+{
+    struct cdc_ncm_ndp16 *ndp = (struct cdc_ncm_ndp16 *)(ntb + ndp_index);
+
+    ndp->dwSignature = CDC_NCM_NDP16_SIGNATURE_NCM0;
+    ndp->wLength = NTB_NDP_LEN(count);
+    ndp->wNextNdpIndex = next;
+    for (uint16_t i = 0; i < count; i++) {
+        ndp->datagram[i].wDatagramIndex = index + i * len;
+        ndp->datagram[i].wDatagramLength = len;
+        memset(ntb + index + i * len, (uint8_t)(index + i * len), len);
+    }
+    ndp->datagram[count].wDatagramIndex = 0;
+    ndp->datagram[count].wDatagramLength = 0;
+}
+
+/* hand the ntb over as received and count the datagrams parsed from it */
+static uint32_t ntb_receive(uint32_t len)
+{
+    struct pbuf *p;
+    uint32_t count = 0;
+
+    cdc_ncm_bulk_out(0, NCM_OUT_EP, len);
+    while ((p = usbd_cdc_ncm_eth_rx()) != NULL) {
+        count++;
+        pbuf_free(p);
+    }
+    return count;
+}
+
+static void check_rx(void)
+{
+    uint8_t *ntb;
+
+    printf("rx\n");
+    /* two ndps one after the other, 2 and 3 datagrams */
+    ntb = s_read_buf;
+    ntb_put_nth(ntb, 512, 16);
+    ntb_put_ndp(ntb, 16, 64, 2, 128, 60);
+    ntb_put_ndp(ntb, 64, 0, 3, 256, 64);
+    report("ndp chain", ntb_receive(512) == 5);
+
+    /* an ndp whose next ndp is itself, its datagram is taken once */
+    ntb = s_read_buf;
+    ntb_put_nth(ntb, 512, 16);
+    ntb_put_ndp(ntb, 16, 16, 1, 128, 60);
+    report("self-referencing ndp", ntb_receive(512) == 1);
+
+    /* a chain looping back to the first ndp */
+    ntb = s_read_buf;
+    ntb_put_nth(ntb, 512, 16);
+    ntb_put_ndp(ntb, 16, 48, 1, 128, 60);
+    ntb_put_ndp(ntb, 48, 16, 1, 256, 60);
+    report("ndp chain looping back", ntb_receive(512) == 2);
+
+    /* an ndp overlapping the previous one */
+    ntb = s_read_buf;
+    ntb_put_nth(ntb, 512, 16);
+    ntb_put_ndp(ntb, 16, 20, 1, 128, 60);
+    report("overlapping ndp", ntb_receive(512) == 1);
+
+    /* a chain longer than CONFIG_USBDEV_CDC_NCM_MAX_NDPS, the rest of the ntb is dropped */
+    ntb = s_read_buf;
+    ntb_put_nth(ntb, 1024, 16);
+    for (uint16_t i = 0; i < CONFIG_USBDEV_CDC_NCM_MAX_NDPS + 2U; i++) {
+        ntb_put_ndp(ntb, 16 + i * 32, (i == CONFIG_USBDEV_CDC_NCM_MAX_NDPS + 1U) ? 0 : 16 + (i + 1) * 32, 1,
+                    512 + i * 32, 32);
+    }
+    report("ndps beyond the limit dropped", ntb_receive(1024) == CONFIG_USBDEV_CDC_NCM_MAX_NDPS);
+
+    /* the next ntb is parsed from its start */
+    ntb = s_read_buf;
+    ntb_put_nth(ntb, 512, 16);
+    ntb_put_ndp(ntb, 16, 0, 2, 128, 60);
+    report("next ntb", ntb_receive(512) == 2);
+}
+
+static void check_tx(void)
+{
+    struct pbuf *p;
+
+    printf("tx\n");
+    p = pbuf_alloc(PBUF_RAW, 1515, PBUF_POOL);
+    s_writes = 0;
+    report("oversize frame dropped", (usbd_cdc_ncm_eth_tx(p) == -USB_ERR_INVAL) && (s_writes == 0));
+    report("oversize frame counted", usbd_cdc_ncm_get_tx_oversize() == 1);
+    pbuf_free(p);
+
+    p = pbuf_alloc(PBUF_RAW, 1514, PBUF_POOL);
+    report("full size frame sent", (usbd_cdc_ncm_eth_tx(p) == 0) && (s_writes == 1));
+    report("full size frame not counted", usbd_cdc_ncm_get_tx_oversize() == 1);
+    pbuf_free(p);
+}
+
+int main(void)
+{
+    struct usb_interface_descriptor data_intf = {
+        .bInterfaceClass = CDC_DATA_INTERFACE_CLASS,
+        .bAlternateSetting = 1,
+    };
+
+    usbd_cdc_ncm_init_intf(&s_intf, NCM_INT_EP, NCM_OUT_EP, NCM_IN_EP);
+    cdc_ncm_notify_handler(0, USBD_EVENT_RESET, NULL);
+    cdc_ncm_notify_handler(0, USBD_EVENT_SET_INTERFACE, &data_intf);
+
+    check_rx();
+    check_tx();
+    printf("%s\n", (s_fail_count == 0) ? "cdc ncm check PASSED" : "cdc ncm check FAILED");
+    return (s_fail_count == 0) ? 0 : 1;
+}
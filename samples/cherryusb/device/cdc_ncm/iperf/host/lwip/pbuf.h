@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef HOST_LWIP_PBUF_H
+#define HOST_LWIP_PBUF_H
+
+#include <stdint.h>
+
+/* host stand-in for the lwip pbufs, one contiguous buffer per pbuf */
+typedef enum {
+    PBUF_RAW
+} pbuf_layer;
+
+typedef enum {
+    PBUF_POOL
+} pbuf_type;
+
+struct pbuf {
+    void *payload;
+    uint16_t tot_len;
+    uint16_t len;
+};
+
+struct pbuf *pbuf_alloc(pbuf_layer layer, uint16_t length, pbuf_type type);
+uint8_t pbuf_free(struct pbuf *p);
+int8_t pbuf_take(struct pbuf *buf, const void *dataptr, uint16_t len);
+uint16_t pbuf_copy_partial(const struct pbuf *p, void *dataptr, uint16_t len, uint16_t offset);
+
+#endif
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef CHERRYUSB_CONFIG_H
+#define CHERRYUSB_CONFIG_H
+
+#include <stdio.h>
+
+/* host stand-in for the usb_config.h of the samples, the cdc ncm part only */
+#define CONFIG_USB_PRINTF(...) printf(__VA_ARGS__)
+#define CONFIG_USB_DBG_LEVEL   USB_DBG_ERROR
+#define CONFIG_USB_ALIGN_SIZE  4
+#define USB_NOCACHE_RAM_SECTION
+
+#define CONFIG_USBDEV_CDC_NCM_NTB_IN_SIZE   4096
+#define CONFIG_USBDEV_CDC_NCM_NTB_OUT_SIZE  4096
+#define CONFIG_USBDEV_CDC_NCM_MAX_DATAGRAMS 8
+#define CONFIG_USBDEV_CDC_NCM_MAX_NDPS      4
+#define CONFIG_USBDEV_CDC_NCM_USING_LWIP
+
+#endif
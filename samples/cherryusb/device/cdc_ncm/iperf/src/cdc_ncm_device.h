@@ -0,0 +1,12 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#ifndef CDC_NCM_DEVICE_H
+#define CDC_NCM_DEVICE_H
+
+void cdc_ncm_init(uint8_t busid, uint32_t reg_base);
+
+#endif
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include "board.h"
+#include "dhserver.h"
+#include "netif/etharp.h"
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+#include "lwip/timeouts.h"
+#include "lwip/apps/lwiperf.h"
+#include "usbd_core.h"
+#include "usbd_cdc_ncm.h"
+#include "cdc_ncm_device.h"
+
+/* Macro Definition */
+#define LWIP_SYS_TIME_MS 1
+#define NUM_DHCP_ENTRY   3
+#define PADDR(ptr)       ((ip_addr_t *)ptr)
+
+/* the in ntb on the bus completes within this many polls unless the host stopped reading */
+#define CDC_NCM_TX_RETRY 100000U
+
+/* Static Variable Definition*/
+static uint8_t hwaddr[6]  = { 0x20, 0x89, 0x84, 0x6A, 0x96, 00 };
+static uint8_t ipaddr[4]  = { 192, 168, 7, 1 };
+static uint8_t netmask[4] = { 255, 255, 255, 0 };
+static uint8_t gateway[4] = { 0, 0, 0, 0 };
+
+static dhcp_entry_t entries[NUM_DHCP_ENTRY] = {
+    /* mac    ip address        subnet mask        lease time */
+    { { 0 }, { 192, 168, 7, 2 }, { 255, 255, 255, 0 }, 24 * 60 * 60 },
+    { { 0 }, { 192, 168, 7, 3 }, { 255, 255, 255, 0 }, 24 * 60 * 60 },
+    { { 0 }, { 192, 168, 7, 4 }, { 255, 255, 255, 0 }, 24 * 60 * 60 }
+};
+
+static dhcp_config_t dhcp_config = {
+    { 192, 168, 7, 1 }, /* server address */
+    67,                 /* port */
+    { 192, 168, 7, 1 }, /* dns server */
+    "hpm",              /* dns suffix */
+    NUM_DHCP_ENTRY,     /* num entry */
+    entries             /* entries */
+};
+
+static volatile uint32_t sys_tick;
+static struct netif netif_data;
+
+/* Static Function Declaration */
+static void  user_init_lwip(void);
+static err_t netif_init_cb(struct netif *netif);
+static err_t linkoutput_fn(struct netif *netif, struct pbuf *p);
+static void  lwip_service_traffic(void);
+static void  lwiperf_report(void *arg, enum lwiperf_report_type report_type,
+                            const ip_addr_t *local_addr, u16_t local_port, const ip_addr_t *remote_addr, u16_t remote_port,
+                            u32_t bytes_transferred, u32_t ms_duration, u32_t bandwidth_kbitpsec);
+
+/* Function Definition */
+void sys_timer_callback(void)
+{
+    sys_tick++;
+}
+
+uint32_t sys_now(void)
+{
+    return sys_tick;
+}
+
+int main(void)
+{
+    board_init();
+    board_init_led_pins();
+    board_init_usb((USB_Type *)CONFIG_HPM_USBD_BASE);
+
+    board_timer_create(LWIP_SYS_TIME_MS, sys_timer_callback);
+
+    /* set irq priority */
+    intc_set_irq_priority(BOARD_CALLBACK_TIMER_IRQ, 2);
+    intc_set_irq_priority(CONFIG_HPM_USBD_IRQn, 1);
+
+    printf("cherry usb cdc ncm device iperf sample.\n");
+
+    cdc_ncm_init(0, CONFIG_HPM_USBD_BASE);    /* BUSID must be 0 */
+
+    user_init_lwip();
+    while (!netif_is_up(&netif_data)) {
+        ;
+    }
+    while (dhserv_init(&dhcp_config) != ERR_OK) {
+        ;
+    }
+
+    lwiperf_start_tcp_server_default(lwiperf_report, NULL);
+    printf("iperf server at %u.%u.%u.%u:%u, run `iperf -c %u.%u.%u.%u` on the host\n",
+           ipaddr[0], ipaddr[1], ipaddr[2], ipaddr[3], LWIPERF_TCP_PORT_DEFAULT,
+           ipaddr[0], ipaddr[1], ipaddr[2], ipaddr[3]);
+
+    while (1) {
+        lwip_service_traffic();
+        sys_check_timeouts();
+    }
+    return 0;
+}
+
+static void lwiperf_report(void *arg, enum lwiperf_report_type report_type,
+                           const ip_addr_t *local_addr, u16_t local_port, const ip_addr_t *remote_addr, u16_t remote_port,
+                           u32_t bytes_transferred, u32_t ms_duration, u32_t bandwidth_kbitpsec)
+{
+    (void)arg;
+    (void)local_addr;
+    (void)local_port;
+
+    printf("iperf report: type=%d, remote: %s:%d, total bytes: %u, duration in ms: %u, kbits/s: %u\n",
+           (int)report_type, ipaddr_ntoa(remote_addr), (int)remote_port,
+           (uint32_t)bytes_transferred, (uint32_t)ms_duration, (uint32_t)bandwidth_kbitpsec);
+}
+
+static void user_init_lwip(void)
+{
+    struct netif *netif = &netif_data;
+
+    lwip_init();
+    netif->hwaddr_len = 6;
+    memcpy(netif->hwaddr, hwaddr, 6);
+
+    netif = netif_add(netif, PADDR(ipaddr), PADDR(netmask), PADDR(gateway), NULL, netif_init_cb, netif_input);
+    netif_set_default(netif);
+}
+
+static err_t netif_init_cb(struct netif *netif)
+{
+    LWIP_ASSERT("netif != NULL", (netif != NULL));
+    netif->mtu        = 1500;
+    netif->flags      = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_LINK_UP | NETIF_FLAG_UP;
+    netif->state      = NULL;
+    netif->name[0]    = 'E';
+    netif->name[1]    = 'X';
+    netif->linkoutput = linkoutput_fn;
+    netif->output     = etharp_output;
+    return ERR_OK;
+}
+
+static err_t linkoutput_fn(struct netif *netif, struct pbuf *p)
+{
+    (void)netif;
+    uint32_t retry = 0;
+    int ret;
+
+    /* the filling ntb is full: wait for the one on the bus, then the filling one is sent */
+    while (((ret = usbd_cdc_ncm_eth_tx(p)) == -USB_ERR_BUSY) && (retry < CDC_NCM_TX_RETRY)) {
+        retry++;
+    }
+
+    if (0 != ret) {
+        ret = ERR_BUF;
+    }
+
+    return ret;
+}
+
+static void lwip_service_traffic(void)
+{
+    err_t        err;
+    struct pbuf *p;
+
+    /* all the datagrams of the received ntbs, so that the out ep is rearmed soon */
+    while ((p = usbd_cdc_ncm_eth_rx()) != NULL) {
+        /* entry point to the LwIP stack */
+        err = netif_data.input(p, &netif_data);
+
+        if (err != ERR_OK) {
+            LWIP_DEBUGF(NETIF_DEBUG, ("ethernetif_input: IP input error\n"));
+            pbuf_free(p);
+        }
+    }
+}
@@ -5,17 +5,25 @@
  *
  */
 
+#include <string.h>
 #include "usbh_core.h"
 #include "usbd_core.h"
 #include "usbd_msc.h"
 #include "board.h"
 #include "hpm_sdmmc_sd.h"
+#include "hpm_clock_drv.h"
+#include "hpm_csr_drv.h"
+#include "FreeRTOS.h"
+#include "task.h"
 
 #define MSC_IN_EP  0x81
 #define MSC_OUT_EP 0x02
 
 #define USB_CONFIG_SIZE (9 + MSC_DESCRIPTOR_LEN)
 
+#define MSC_STAT_PERIOD_MS  (2000U)
+#define MSC_STAT_TASK_PRIO  (tskIDLE_PRIORITY + 1U)
+
 static const uint8_t device_descriptor[] = {
     USB_DEVICE_DESCRIPTOR_INIT(USB_2_0, 0x00, 0x00, 0x00, USBD_VID, USBD_PID, 0x0200, 0x01),
 };
@@ -105,9 +113,69 @@ const struct usb_descriptor msc_device_descriptor = {
     .string_descriptor_callback = string_descriptor_callback,
 };
 
+typedef struct {
+    uint32_t bytes;
+    uint64_t sd_cycles;
+} msc_stat_t;
+
 static struct usbd_interface intf0;
 ATTR_PLACE_AT_NONCACHEABLE_BSS sdmmc_host_t g_sdmmc_host;
 static sd_card_t s_sd = {.host = &g_sdmmc_host};
+static msc_stat_t s_read_stat;
+static msc_stat_t s_write_stat;
+
+static void msc_stat_add(msc_stat_t *stat, uint32_t bytes, uint64_t start)
+{
+    uint64_t cycles = hpm_csr_get_core_mcycle() - start;
+
+    taskENTER_CRITICAL();
+    stat->bytes += bytes;
+    stat->sd_cycles += cycles;
+    taskEXIT_CRITICAL();
+}
+
+static void msc_stat_print(const char *name, const msc_stat_t *stat, uint32_t freq)
+{
+    /* bytes per microsecond are MB/s */
+    uint32_t usb_rate = (uint32_t)((uint64_t)stat->bytes * 100U / (MSC_STAT_PERIOD_MS * 1000U));
+    uint32_t sd_rate = (uint32_t)((uint64_t)stat->bytes * 100U * (freq / 1000000U) / stat->sd_cycles);
+
+    printf("%s: usb %u.%02u MB/s, sd card %u.%02u MB/s, sd card busy %u%%\n", name,
+           usb_rate / 100U, usb_rate % 100U, sd_rate / 100U, sd_rate % 100U,
+           (uint32_t)(stat->sd_cycles * 100U / ((uint64_t)freq / 1000U * MSC_STAT_PERIOD_MS)));
+}
+
+/*
+ * Throughput of the transfers of the host, e.g. while copying a large file. With
+ * CONFIG_USBDEV_MSC_BUFCOUNT > 1 the sd card is accessed while the usb moves the
+ * previous buffer, and the usb rate gets close to the sd card rate.
+ */
+static void msc_stat_task(void *pvParameters)
+{
+    uint32_t freq = clock_get_frequency(clock_cpu0);
+    msc_stat_t read_stat;
+    msc_stat_t write_stat;
+
+    (void)pvParameters;
+
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(MSC_STAT_PERIOD_MS));
+
+        taskENTER_CRITICAL();
+        read_stat = s_read_stat;
+        write_stat = s_write_stat;
+        memset(&s_read_stat, 0, sizeof(s_read_stat));
+        memset(&s_write_stat, 0, sizeof(s_write_stat));
+        taskEXIT_CRITICAL();
+
+        if (read_stat.bytes > 0) {
+            msc_stat_print("read ", &read_stat, freq);
+        }
+        if (write_stat.bytes > 0) {
+            msc_stat_print("write", &write_stat, freq);
+        }
+    }
+}
 
 static void usbd_event_handler(uint8_t busid, uint8_t event)
 {
@@ -158,9 +226,12 @@ int usbd_msc_sector_read(uint8_t busid, uint8_t lun, uint32_t sector, uint8_t *b
 
     if (s_sd.host->card_inserted) {
         uint32_t sys_buf_addr = core_local_mem_to_sys_address(0, (uint32_t)buffer);
+        uint64_t start = hpm_csr_get_core_mcycle();
         hpm_stat_t status = sd_read_blocks(&s_sd, (uint8_t *) sys_buf_addr, sector, length / s_sd.block_size);
         if (status != status_success) {
             printf("SD Read failed at sector %lu\n", sector);
+        } else {
+            msc_stat_add(&s_read_stat, length, start);
         }
         return status;
     } else {
@@ -175,8 +246,12 @@ int usbd_msc_sector_write(uint8_t busid, uint8_t lun, uint32_t sector, uint8_t *
 
     if (s_sd.host->card_inserted) {
         uint32_t sys_buf_addr = core_local_mem_to_sys_address(0, (uint32_t)buffer);
+        uint64_t start = hpm_csr_get_core_mcycle();
         hpm_stat_t status;
         status =  sd_write_blocks(&s_sd, (uint8_t *) sys_buf_addr, sector, length / s_sd.block_size);
+        if (status == status_success) {
+            msc_stat_add(&s_write_stat, length, start);
+        }
         return status;
     } else {
         return -1;
@@ -203,4 +278,8 @@ void msc_device_init(uint8_t busid, uint32_t reg_base)
     usbd_add_interface(busid, usbd_msc_init_intf(busid, &intf0, MSC_OUT_EP, MSC_IN_EP));
 
     usbd_initialize(busid, reg_base, usbd_event_handler);
+
+    if (xTaskCreate(msc_stat_task, "msc_stat", configMINIMAL_STACK_SIZE + 256U, NULL, MSC_STAT_TASK_PRIO, NULL) != pdPASS) {
+        printf("msc stat task creation failed!\n");
+    }
 }
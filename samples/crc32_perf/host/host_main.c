@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "crc32_perf.h"
+
+uint64_t crc32_perf_get_ticks(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+const char *crc32_perf_tick_unit(void)
+{
+    return "ns";
+}
+
+uint64_t crc32_perf_ticks_per_second(void)
+{
+    return 1000000000ULL;
+}
+
+int main(void)
+{
+    uint32_t failed;
+
+    printf("crc32 engine benchmark (host)\n");
+    failed = crc32_perf_run_check();
+    crc32_perf_run_benchmark();
+    return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "hpm_common.h"
+#include "hpm_crc32.h"
+#include "crc32_perf.h"
+
+#define PERF_BUF_SIZE    (16 * 1024)
+#define PERF_LOOP_CNT    (16)
+#define STREAM_CHUNK_MAX (97)
+
+typedef uint32_t (*crc32_engine_t)(const uint8_t *buf, uint32_t len);
+
+typedef struct {
+    const char *data;
+    uint32_t expect;
+} crc32_vector_t;
+
+typedef struct {
+    const char *name;
+    crc32_engine_t engine;
+} crc32_variant_t;
+
+static const crc32_vector_t crc32_vectors[] = {
+    { "", 0x00000000 },
+    { "a", 0xE8B7BE43 },
+    { "abc", 0x352441C2 },
+    { "123456789", 0xCBF43926 },
+    { "message digest", 0x20159D7F },
+    { "abcdefghijklmnopqrstuvwxyz", 0x4C2750BD },
+    { "The quick brown fox jumps over the lazy dog", 0x414FA339 },
+    { "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 0x7CA94A72 },
+};
+
+ATTR_ALIGN(8) static uint8_t perf_buf[PERF_BUF_SIZE + 8];
+
+static uint32_t crc32_engine_bitwise(const uint8_t *buf, uint32_t len)
+{
+    return ~hpm_crc32_bitwise(HPM_CRC32_INIT_VALUE, buf, len);
+}
+
+static uint32_t crc32_engine_slicing4(const uint8_t *buf, uint32_t len)
+{
+    return ~hpm_crc32_slicing4(HPM_CRC32_INIT_VALUE, buf, len);
+}
+
+static uint32_t crc32_engine_slicing8(const uint8_t *buf, uint32_t len)
+{
+    return ~hpm_crc32_slicing8(HPM_CRC32_INIT_VALUE, buf, len);
+}
+
+static uint32_t crc32_engine_stream(const uint8_t *buf, uint32_t len)
+{
+    hpm_crc32_ctx_t ctx;
+    uint32_t chunk = 1;
+
+    hpm_crc32_init(&ctx);
+    while (len > 0) {
+        chunk = (chunk > len) ? len : chunk;
+        hpm_crc32_update(&ctx, buf, chunk);
+        buf += chunk;
+        len -= chunk;
+        chunk = (chunk % STREAM_CHUNK_MAX) + 7;
+    }
+    return hpm_crc32_final(&ctx);
+}
+
+static const crc32_variant_t crc32_variants[] = {
+    { "bitwise", crc32_engine_bitwise },
+    { "slicing-by-4", crc32_engine_slicing4 },
+    { "slicing-by-8", crc32_engine_slicing8 },
+#if HPM_CRC32_HW_ENABLED
+    { "crc peripheral", hpm_crc32_hw },
+#endif
+    { "init/update/final", crc32_engine_stream },
+};
+
+#define CRC32_VARIANT_CNT (sizeof(crc32_variants) / sizeof(crc32_variants[0]))
+#define CRC32_VECTOR_CNT  (sizeof(crc32_vectors) / sizeof(crc32_vectors[0]))
+
+uint32_t crc32_perf_run_check(void)
+{
+    uint32_t errors = 0;
+    uint32_t result;
+    uint32_t reference;
+
+    for (uint32_t i = 0; i < sizeof(perf_buf); i++) {
+        perf_buf[i] = (uint8_t)((i * 131) ^ (i >> 7));
+    }
+
+    for (uint32_t v = 0; v < CRC32_VARIANT_CNT; v++) {
+        for (uint32_t i = 0; i < CRC32_VECTOR_CNT; i++) {
+            result = crc32_variants[v].engine((const uint8_t *)crc32_vectors[i].data, strlen(crc32_vectors[i].data));
+            if (result != crc32_vectors[i].expect) {
+                printf("[%s] vector %u failed: 0x%08x != 0x%08x\n", crc32_variants[v].name, i, result, crc32_vectors[i].expect);
+                errors++;
+            }
+        }
+    }
+
+    /* cross check all variants against bitwise on every misalignment and odd tail */
+    for (uint32_t offset = 0; offset < 8; offset++) {
+        for (uint32_t len = PERF_BUF_SIZE - 13; len <= PERF_BUF_SIZE - offset; len += 5) {
+            reference = crc32_engine_bitwise(&perf_buf[offset], len);
+            for (uint32_t v = 1; v < CRC32_VARIANT_CNT; v++) {
+                result = crc32_variants[v].engine(&perf_buf[offset], len);
+                if (result != reference) {
+                    printf("[%s] offset %u len %u failed: 0x%08x != 0x%08x\n", crc32_variants[v].name, offset, len, result, reference);
+                    errors++;
+                }
+            }
+        }
+    }
+
+    if (errors) {
+        printf("crc32 test vectors: %u errors\n", errors);
+    } else {
+        printf("crc32 test vectors: all %u variants passed\n", (uint32_t)CRC32_VARIANT_CNT);
+    }
+    return errors;
+}
+
+void crc32_perf_run_benchmark(void)
+{
+    uint64_t ticks;
+    uint64_t bytes = (uint64_t)PERF_BUF_SIZE * PERF_LOOP_CNT;
+    uint64_t rate = crc32_perf_ticks_per_second();
+    char unit[16];
+
+    snprintf(unit, sizeof(unit), "%s/KB", crc32_perf_tick_unit());
+    printf("\n%-20s %12s %12s\n", "engine", unit, "MB/s");
+    for (uint32_t v = 0; v < CRC32_VARIANT_CNT; v++) {
+        /* warm up tables and caches */
+        (void)crc32_variants[v].engine(perf_buf, PERF_BUF_SIZE);
+
+        ticks = crc32_perf_get_ticks();
+        for (uint32_t i = 0; i < PERF_LOOP_CNT; i++) {
+            (void)crc32_variants[v].engine(perf_buf, PERF_BUF_SIZE);
+        }
+        ticks = crc32_perf_get_ticks() - ticks;
+        if (ticks == 0) {
+            ticks = 1;
+        }
+
+        printf("%-20s %12u %12u\n", crc32_variants[v].name, (uint32_t)(ticks * 1024 / bytes),
+               (uint32_t)(bytes * rate / ticks / 1000000U));
+    }
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef CRC32_PERF_H
+#define CRC32_PERF_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Provided by the platform: a free running counter for timing the engines, the name of its
+ * unit, e.g. "cycles" on the board or "ns" on the host, and its rate.
+ */
+uint64_t crc32_perf_get_ticks(void);
+const char *crc32_perf_tick_unit(void);
+uint64_t crc32_perf_ticks_per_second(void);
+
+/*
+ * Checks every engine against the reference vectors, then against the bitwise engine on
+ * every misalignment and odd tail of the benchmark buffer.
+ *
+ * Returns the number of failed checks.
+ */
+uint32_t crc32_perf_run_check(void);
+
+/*
+ * Prints the throughput of every engine on the benchmark buffer.
+ */
+void crc32_perf_run_benchmark(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC32_PERF_H */
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include "board.h"
+#include "hpm_csr_drv.h"
+#include "hpm_clock_drv.h"
+#include "crc32_perf.h"
+
+uint64_t crc32_perf_get_ticks(void)
+{
+    return hpm_csr_get_core_mcycle();
+}
+
+const char *crc32_perf_tick_unit(void)
+{
+    return "cycles";
+}
+
+uint64_t crc32_perf_ticks_per_second(void)
+{
+    return clock_get_frequency(clock_cpu0);
+}
+
+int main(void)
+{
+    board_init();
+    printf("crc32 engine benchmark\n");
+
+    (void)crc32_perf_run_check();
+    crc32_perf_run_benchmark();
+
+    while (1) {
+        ;
+    }
+    return 0;
+}
@@ -8,9 +8,11 @@
 #include <stdio.h>
 #include "board.h"
 #include "hpm_debug_console.h"
+#include "hpm_csr_drv.h"
 #include "hpm_dma_mgr.h"
 
 #define DMA_RESOURCE_NUM (DMA_SOC_CHANNEL_NUM * DMA_SOC_MAX_COUNT)
+#define DMA_RESTART_ROUNDS (1000U)
 
 dma_resource_t dma_resource_pools[DMA_RESOURCE_NUM];
 
@@ -29,6 +31,7 @@ void show_description(void);
 void dma_manager_test_setup(void);
 bool dma_manager_test_execute(void);
 void dma_manager_test_teardown(void);
+bool dma_manager_restart_benchmark(void);
 
 int main(void)
 {
@@ -51,6 +54,9 @@ int main(void)
 
         ++round;
     }
+    if (result) {
+        result = dma_manager_restart_benchmark();
+    }
 
     printf("DMA Manager test %s\n", result ? "PASSED" : "FAILED");
 
@@ -75,6 +81,7 @@ void show_description(void)
                         "      2. Setup DMA config\n"
                         "      3. Enable DMA interrupt\n"
                         "      4. DMA callback installation\n"
+                        "      5. Restart latency with the setters and with a channel handle\n"
                         "\n\n"
                         "=============================================================================\n";
      printf("%s", desc);
@@ -146,3 +153,68 @@ void dma_manager_test_teardown(void)
         dma_mgr_release_resource(resource);
     }
 }
+
+static void dma_wait_transfer_done(const dma_resource_t *resource)
+{
+    uint32_t stat;
+
+    do {
+        dma_mgr_check_chn_transfer_status(resource, &stat);
+    } while ((stat & DMA_MGR_CHANNEL_STATUS_TC) == 0);
+}
+
+bool dma_manager_restart_benchmark(void)
+{
+    dma_resource_t resource;
+    dma_mgr_chn_conf_t chg_config;
+    dma_mgr_chn_handle_t handle;
+    dma_test_context *test_ctx = &s_dma_test_ctx[0];
+    uint32_t src_addr = (uint32_t)core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)test_ctx->src);
+    uint32_t dst_addr = (uint32_t)core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)test_ctx->dst);
+    uint32_t size = sizeof(test_ctx->src) / sizeof(uint32_t);
+    uint64_t setter_cycles = 0;
+    uint64_t handle_cycles = 0;
+    uint64_t start;
+    bool result = true;
+
+    if (dma_mgr_request_resource(&resource) != status_success) {
+        return false;
+    }
+    /* channel interrupts stay masked, the transfers are polled */
+    dma_mgr_get_default_chn_config(&chg_config);
+    chg_config.src_width = DMA_MGR_TRANSFER_WIDTH_WORD;
+    chg_config.dst_width = DMA_MGR_TRANSFER_WIDTH_WORD;
+    chg_config.src_addr = src_addr;
+    chg_config.dst_addr = dst_addr;
+    chg_config.size_in_byte = sizeof(test_ctx->src);
+    dma_mgr_setup_channel(&resource, &chg_config);
+    handle = dma_mgr_get_chn_handle(&resource);
+
+    for (uint32_t i = 0; i < DMA_RESTART_ROUNDS; i++) {
+        memset(test_ctx->dst, 0, sizeof(test_ctx->dst));
+        start = hpm_csr_get_core_mcycle();
+        dma_mgr_set_chn_src_addr(&resource, src_addr);
+        dma_mgr_set_chn_dst_addr(&resource, dst_addr);
+        dma_mgr_set_chn_transize(&resource, size);
+        dma_mgr_enable_channel(&resource);
+        setter_cycles += hpm_csr_get_core_mcycle() - start;
+        dma_wait_transfer_done(&resource);
+        result &= (memcmp(test_ctx->src, test_ctx->dst, sizeof(test_ctx->src)) == 0);
+
+        memset(test_ctx->dst, 0, sizeof(test_ctx->dst));
+        start = hpm_csr_get_core_mcycle();
+        dma_mgr_restart_chn_transfer(handle, src_addr, dst_addr, size);
+        handle_cycles += hpm_csr_get_core_mcycle() - start;
+        dma_wait_transfer_done(&resource);
+        result &= (memcmp(test_ctx->src, test_ctx->dst, sizeof(test_ctx->src)) == 0);
+    }
+    dma_mgr_release_resource(&resource);
+
+    printf("DMA restart latency over %u transfers:\n", DMA_RESTART_ROUNDS);
+    printf("    setters + enable: %u cycles\n", (uint32_t)(setter_cycles / DMA_RESTART_ROUNDS));
+    printf("    handle restart:   %u cycles\n", (uint32_t)(handle_cycles / DMA_RESTART_ROUNDS));
+    if (!result) {
+        printf("DMA restart transfer data mismatch\n");
+    }
+    return result;
+}
@@ -7,6 +7,7 @@
 
 #include "board.h"
 #include "hpm_sdmmc_sd.h"
+#include "hpm_sdmmc_queue.h"
 #include "hpm_mchtmr_drv.h"
 #include "hpm_clock_drv.h"
 
@@ -28,6 +29,13 @@ static sd_card_t g_sd = { .host = &g_sdmmc_host };
 ATTR_PLACE_AT_NONCACHEABLE uint32_t s_write_buf[MAX_BUF_SIZE_DEFAULT / sizeof(uint32_t)];
 ATTR_PLACE_AT_NONCACHEABLE uint32_t s_read_buf[MAX_BUF_SIZE_DEFAULT / sizeof(uint32_t)];
 
+/* The queued test splits the buffer into 4KB requests, the queue merges them back into one command */
+#define QUEUE_TEST_REQ_BLOCKS (8U)
+static hpm_sdmmc_queue_t s_queue;
+static hpm_sdmmc_req_t s_queue_reqs[MAX_BUF_SIZE_DEFAULT / (QUEUE_TEST_REQ_BLOCKS * 512U)];
+static uint32_t s_queue_reqs_done;
+static hpm_stat_t s_queue_status;
+
 #if defined(HPM_SDMMC_HOST_ENABLE_IRQ) && (HPM_SDMMC_HOST_ENABLE_IRQ == 1)
 SDK_DECLARE_EXT_ISR_M(BOARD_APP_SDCARD_SDXC_IRQ, sdxc_isr)
 void sdxc_isr(void)
@@ -48,6 +56,8 @@ void test_hot_plug(void);
 
 void test_sd_stress_test(void);
 
+void test_queued_write_read_last_1024_blocks(void);
+
 
 static void show_card_info(const sd_card_t *card)
 {
@@ -129,6 +139,9 @@ int main(void)
         case '4':
             test_sd_stress_test();
             break;
+        case '5':
+            test_queued_write_read_last_1024_blocks();
+            break;
         }
     }
 
@@ -147,6 +160,7 @@ void show_help(void)
                              "*        2. Write & Read the last 1024 blocks                                     *\n"
                              "*        3. Hot plug test                                                         *\n"
                              "*        4. SD Stress test (Write / Read 200MBytes)                               *\n"
+                             "*        5. Queued Write & Read the last 1024 blocks                              *\n"
                              "*                                                                                 *\n"
                              "*---------------------------------------------------------------------------------*\n";
     printf("%s", help_info);
@@ -334,3 +348,101 @@ void test_sd_stress_test(void)
         printf("NOTE: Increasing the MAX_BUF_SIZE_DEFAULT can achieve higher Read/write performance\n");
     }
 }
+
+static void queue_req_done(hpm_sdmmc_req_t *req, hpm_stat_t status)
+{
+    (void) req;
+    if (status != status_success) {
+        s_queue_status = status;
+    }
+    s_queue_reqs_done++;
+}
+
+/* Submit the buffer as 4KB requests and process the queue, counting the time spent inside the queue */
+static hpm_stat_t queue_run(hpm_sdmmc_req_type_t type, uint8_t *buf, uint32_t start_block, uint32_t block_count,
+                            uint64_t *total_ticks, uint64_t *queue_ticks)
+{
+    uint32_t req_count = 0;
+
+    s_queue_reqs_done = 0;
+    s_queue_status = status_success;
+    uint64_t start_ticks = mchtmr_get_count(HPM_MCHTMR);
+    for (uint32_t offset = 0; offset < block_count; offset += QUEUE_TEST_REQ_BLOCKS) {
+        hpm_sdmmc_req_t *req = &s_queue_reqs[req_count++];
+        req->type = type;
+        req->buffer = buf + offset * g_sd.block_size;
+        req->start_block = start_block + offset;
+        req->block_count = MIN(QUEUE_TEST_REQ_BLOCKS, block_count - offset);
+        req->callback = queue_req_done;
+        hpm_sdmmc_queue_submit(&s_queue, req);
+    }
+    while (s_queue_reqs_done < req_count) {
+        uint64_t process_ticks = mchtmr_get_count(HPM_MCHTMR);
+        hpm_sdmmc_queue_process(&s_queue);
+        *queue_ticks += mchtmr_get_count(HPM_MCHTMR) - process_ticks;
+        /* the application would do its own work here */
+    }
+    *total_ticks += mchtmr_get_count(HPM_MCHTMR) - start_ticks;
+
+    return s_queue_status;
+}
+
+void test_queued_write_read_last_1024_blocks(void)
+{
+    uint32_t sector_addr = g_sd.block_count - 1024U;
+    uint32_t step = MIN(sizeof(s_write_buf) / g_sd.block_size, 1024U);
+    uint64_t write_ticks = 0;
+    uint64_t read_ticks = 0;
+    uint64_t queue_ticks = 0;
+    hpm_sdmmc_queue_stats_t stats;
+    hpm_stat_t status;
+    bool result = false;
+
+    status = hpm_sdmmc_queue_init_sd(&s_queue, &g_sd);
+    if (status != status_success) {
+        printf("Queue initialization failed, status=%d\n", status);
+        return;
+    }
+    srand((unsigned int) HPM_MCHTMR->MTIME);
+    for (uint32_t i = 0; i < ARRAY_SIZE(s_write_buf); i++) {
+        s_write_buf[i] = ((uint32_t) rand() << 16) | rand();
+    }
+
+    for (uint32_t i = 0; i < 1024; i += step) {
+        uint32_t blocks = MIN(step, 1024 - i);
+        result = false;
+        status = queue_run(hpm_sdmmc_req_write, (uint8_t *) s_write_buf, sector_addr + i, blocks,
+                           &write_ticks, &queue_ticks);
+        if (status != status_success) {
+            break;
+        }
+        status = queue_run(hpm_sdmmc_req_read, (uint8_t *) s_read_buf, sector_addr + i, blocks,
+                           &read_ticks, &queue_ticks);
+        if (status != status_success) {
+            break;
+        }
+        result = (memcmp(s_write_buf, s_read_buf, blocks * g_sd.block_size) == 0);
+        if (!result) {
+            printf("SD queued write-read-verify block range 0x%08x-0x%08x FAILED\n",
+                   sector_addr + i, sector_addr + i + blocks - 1U);
+            break;
+        }
+    }
+
+    if (status != status_success) {
+        printf("Error code: %d\n", status);
+    }
+    printf("Test completed, %s\n", result ? "PASSED" : "FAILED");
+
+    if (result) {
+        uint32_t xfer_bytes = 1024 * g_sd.block_size;
+        float write_speed = 1.0f * xfer_bytes / (1.0f * write_ticks / clock_get_frequency(clock_mchtmr0));
+        float read_speed = 1.0f * xfer_bytes / (1.0f * read_ticks / clock_get_frequency(clock_mchtmr0));
+
+        hpm_sdmmc_queue_get_stats(&s_queue, &stats);
+        printf("Write Speed: %.2fMB/s, Read Speed: %.2fMB/s\n", write_speed / 1024 / 1024, read_speed / 1024 / 1024);
+        printf("CPU time inside the queue: %.1f%%\n", 100.0f * queue_ticks / (write_ticks + read_ticks));
+        printf("Requests: %u, commands: %u, merged: %u, prepared while busy: %u\n",
+               stats.requests, stats.commands, stats.merged, stats.prepared_in_busy);
+    }
+}
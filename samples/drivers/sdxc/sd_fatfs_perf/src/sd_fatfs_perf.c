@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "board.h"
+#include "hpm_clock_drv.h"
+#include "hpm_csr_drv.h"
+#include "ff.h"
+#include "diskio.h"
+
+#define PERF_FILE_NAME      "perf.bin"
+#define PERF_FILE_SIZE      (8U * 1024U * 1024U)
+#define SEQ_IO_SIZE         (64U * 1024U)
+#define RANDOM_IO_SIZE      (4U * 1024U)
+#define RANDOM_IO_COUNT     (512U)
+/* byte offset of the unaligned runs: word aligned for the DMA, but not cacheline aligned */
+#define UNALIGNED_OFFSET    (4U)
+
+typedef struct {
+    const char *name;
+    uint32_t offset;
+} perf_buf_variant_t;
+
+static const perf_buf_variant_t perf_buf_variants[] = {
+    { "aligned", 0 },
+    { "unaligned", UNALIGNED_OFFSET },
+};
+
+static FATFS s_sd_disk;
+static FIL s_file;
+static BYTE s_work[FF_MAX_SS];
+static const TCHAR driver_num_buf[4] = { DEV_SD + '0', ':', '/', '\0' };
+
+ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) static uint8_t s_perf_buf[SEQ_IO_SIZE + HPM_L1C_CACHELINE_SIZE];
+
+static uint32_t s_rand_state;
+static uint32_t s_ticks_per_us;
+
+static uint32_t perf_rand(void)
+{
+    s_rand_state = s_rand_state * 1664525UL + 1013904223UL;
+    return s_rand_state;
+}
+
+static uint8_t perf_pattern(uint32_t pos)
+{
+    return (uint8_t)(pos ^ (pos >> 9));
+}
+
+static void perf_fill(uint8_t *buf, uint32_t pos, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        buf[i] = perf_pattern(pos + i);
+    }
+}
+
+static bool perf_check(const uint8_t *buf, uint32_t pos, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        if (buf[i] != perf_pattern(pos + i)) {
+            printf("data mismatch at 0x%08x\n", pos + i);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void perf_report(const char *test, const char *variant, uint32_t bytes, uint32_t ios, uint64_t cycles)
+{
+    uint32_t us = (uint32_t)(cycles / s_ticks_per_us);
+    uint32_t kb_per_s = (us == 0) ? 0 : (uint32_t)((uint64_t)bytes * 1000000UL / 1024UL / us);
+    uint32_t iops = (us == 0) ? 0 : (uint32_t)((uint64_t)ios * 1000000UL / us);
+
+    printf("%-14s %-10s %8u.%02u %10u\n", test, variant, kb_per_s / 1024, (kb_per_s % 1024) * 100 / 1024, iops);
+}
+
+static FRESULT perf_seq_write(const perf_buf_variant_t *variant)
+{
+    uint8_t *buf = s_perf_buf + variant->offset;
+    uint64_t cycles = 0;
+    uint64_t start;
+    UINT bw;
+    FRESULT fresult = f_open(&s_file, PERF_FILE_NAME, FA_WRITE | FA_CREATE_ALWAYS);
+    if (fresult != FR_OK) {
+        return fresult;
+    }
+
+    for (uint32_t pos = 0; pos < PERF_FILE_SIZE; pos += SEQ_IO_SIZE) {
+        perf_fill(buf, pos, SEQ_IO_SIZE);
+        start = hpm_csr_get_core_mcycle();
+        fresult = f_write(&s_file, buf, SEQ_IO_SIZE, &bw);
+        cycles += hpm_csr_get_core_mcycle() - start;
+        if ((fresult != FR_OK) || (bw != SEQ_IO_SIZE)) {
+            f_close(&s_file);
+            return (fresult != FR_OK) ? fresult : FR_DENIED;
+        }
+    }
+    start = hpm_csr_get_core_mcycle();
+    fresult = f_close(&s_file);
+    cycles += hpm_csr_get_core_mcycle() - start;
+
+    perf_report("seq write", variant->name, PERF_FILE_SIZE, PERF_FILE_SIZE / SEQ_IO_SIZE, cycles);
+    return fresult;
+}
+
+static FRESULT perf_seq_read(const perf_buf_variant_t *variant)
+{
+    uint8_t *buf = s_perf_buf + variant->offset;
+    uint64_t cycles = 0;
+    uint64_t start;
+    UINT br;
+    FRESULT fresult = f_open(&s_file, PERF_FILE_NAME, FA_READ);
+    if (fresult != FR_OK) {
+        return fresult;
+    }
+
+    for (uint32_t pos = 0; pos < PERF_FILE_SIZE; pos += SEQ_IO_SIZE) {
+        start = hpm_csr_get_core_mcycle();
+        fresult = f_read(&s_file, buf, SEQ_IO_SIZE, &br);
+        cycles += hpm_csr_get_core_mcycle() - start;
+        if ((fresult != FR_OK) || (br != SEQ_IO_SIZE) || !perf_check(buf, pos, SEQ_IO_SIZE)) {
+            f_close(&s_file);
+            return (fresult != FR_OK) ? fresult : FR_INT_ERR;
+        }
+    }
+    f_close(&s_file);
+
+    perf_report("seq read", variant->name, PERF_FILE_SIZE, PERF_FILE_SIZE / SEQ_IO_SIZE, cycles);
+    return FR_OK;
+}
+
+static FRESULT perf_random_io(const perf_buf_variant_t *variant, bool write)
+{
+    uint8_t *buf = s_perf_buf + variant->offset;
+    uint64_t cycles = 0;
+    uint64_t start;
+    UINT bytes;
+    FRESULT fresult = f_open(&s_file, PERF_FILE_NAME, write ? (FA_READ | FA_WRITE) : FA_READ);
+    if (fresult != FR_OK) {
+        return fresult;
+    }
+
+    s_rand_state = 0x12345678UL;
+    for (uint32_t i = 0; i < RANDOM_IO_COUNT; i++) {
+        uint32_t pos = (perf_rand() % (PERF_FILE_SIZE / RANDOM_IO_SIZE)) * RANDOM_IO_SIZE;
+        if (write) {
+            /* rewrite the same pattern, so the file still verifies afterwards */
+            perf_fill(buf, pos, RANDOM_IO_SIZE);
+        }
+        start = hpm_csr_get_core_mcycle();
+        fresult = f_lseek(&s_file, pos);
+        if (fresult == FR_OK) {
+            fresult = write ? f_write(&s_file, buf, RANDOM_IO_SIZE, &bytes) : f_read(&s_file, buf, RANDOM_IO_SIZE, &bytes);
+        }
+        cycles += hpm_csr_get_core_mcycle() - start;
+        if ((fresult != FR_OK) || (bytes != RANDOM_IO_SIZE)) {
+            f_close(&s_file);
+            return (fresult != FR_OK) ? fresult : FR_INT_ERR;
+        }
+        if (!write && !perf_check(buf, pos, RANDOM_IO_SIZE)) {
+            f_close(&s_file);
+            return FR_INT_ERR;
+        }
+    }
+    start = hpm_csr_get_core_mcycle();
+    fresult = f_close(&s_file);
+    cycles += hpm_csr_get_core_mcycle() - start;
+
+    perf_report(write ? "random write" : "random read", variant->name,
+                RANDOM_IO_SIZE * RANDOM_IO_COUNT, RANDOM_IO_COUNT, cycles);
+    return fresult;
+}
+
+static FRESULT sd_mount_fs(void)
+{
+    FRESULT fresult = f_mount(&s_sd_disk, driver_num_buf, 1);
+    if (fresult == FR_NO_FILESYSTEM) {
+        printf("There is no File system available, making file system...\n");
+        fresult = f_mkfs(driver_num_buf, NULL, s_work, sizeof(s_work));
+        if (fresult == FR_OK) {
+            fresult = f_mount(&s_sd_disk, driver_num_buf, 1);
+        }
+    }
+    if (fresult == FR_OK) {
+        fresult = f_chdrive(driver_num_buf);
+    }
+    return fresult;
+}
+
+int main(void)
+{
+    FRESULT fresult;
+
+    board_init();
+    s_ticks_per_us = clock_get_frequency(clock_cpu0) / 1000UL / 1000UL;
+
+    printf("SD FATFS performance test\n");
+    while (disk_status(DEV_SD) == STA_NODISK) {
+        printf("No disk in the SD slot, please insert an SD card...\n");
+        board_delay_ms(1000);
+    }
+    if (disk_initialize(DEV_SD) != RES_OK) {
+        printf("Failed to initialize SD disk\n");
+        while (1) {
+        }
+    }
+    fresult = sd_mount_fs();
+    if (fresult != FR_OK) {
+        printf("Failed to mount SD card, error: %d\n", fresult);
+        while (1) {
+        }
+    }
+
+    printf("file: %u KB, sequential I/O: %u KB, random I/O: %u x %u KB\n\n",
+           PERF_FILE_SIZE / 1024, SEQ_IO_SIZE / 1024, RANDOM_IO_COUNT, RANDOM_IO_SIZE / 1024);
+    printf("%-14s %-10s %11s %10s\n", "test", "buffer", "MB/s", "IOPS");
+    for (uint32_t i = 0; i < ARRAY_SIZE(perf_buf_variants); i++) {
+        const perf_buf_variant_t *variant = &perf_buf_variants[i];
+        fresult = perf_seq_write(variant);
+        if (fresult == FR_OK) {
+            fresult = perf_seq_read(variant);
+        }
+        if (fresult == FR_OK) {
+            fresult = perf_random_io(variant, true);
+        }
+        if (fresult == FR_OK) {
+            fresult = perf_random_io(variant, false);
+        }
+        if (fresult != FR_OK) {
+            printf("%s buffer test failed, error: %d\n", variant->name, fresult);
+            break;
+        }
+    }
+    f_unlink(PERF_FILE_NAME);
+    printf("\nSD FATFS performance test done\n");
+
+    while (1) {
+    }
+
+    return 0;
+}
@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "eeprom_emulation.h"
+
+/* the host samples are single threaded, there is nothing to mask */
+void e2p_enter_critical(void)
+{
+}
+
+void e2p_exit_critical(void)
+{
+}
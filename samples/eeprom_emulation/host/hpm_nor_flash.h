@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _HPM_NOR_FLASH_H
+#define _HPM_NOR_FLASH_H
+
+#include <stdint.h>
+#include "hpm_common.h"
+
+/*
+ * host stand-in for the port of components/eeprom_emulation: the samples run the emulation
+ * layer on a flash simulated in RAM, there is no XPI nor ROM API
+ */
+#define E2P_ATTR
+
+typedef struct {
+    uint32_t base_addr;
+    uint32_t sector_size;
+} nor_flash_config_t;
+
+#endif
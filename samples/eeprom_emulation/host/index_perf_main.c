@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <time.h>
+#include "index_perf.h"
+
+uint64_t index_perf_get_ticks(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t index_perf_ticks_per_second(void)
+{
+    return 1000000000ULL;
+}
+
+int main(void)
+{
+    index_perf_run();
+    return 0;
+}
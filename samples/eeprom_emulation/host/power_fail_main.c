@@ -0,0 +1,13 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "power_fail.h"
+
+int main(void)
+{
+    return (power_fail_run() == 0) ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "eeprom_emulation.h"
+#include "index_perf.h"
+
+/*
+ * flash is simulated in RAM, so the numbers show the bookkeeping cost only, it is mapped at
+ * SIM_FLASH_BASE so that the addresses fit in 32 bits on any platform
+ */
+#define SIM_FLASH_BASE      (0x80000000UL)
+#define SIM_ERASE_SIZE      (4096)
+#define SIM_SECTOR_CNT      (40)
+#define SIM_FLASH_SIZE      (SIM_ERASE_SIZE * SIM_SECTOR_CNT)
+
+#define PERF_WRITE_CNT      (64)
+
+ATTR_PLACE_AT_NONCACHEABLE_BSS_WITH_ALIGNMENT(4) uint8_t sim_flash[SIM_FLASH_SIZE];
+
+static const uint32_t perf_var_cnt[] = {64, 512, 4096};
+
+e2p_t e2p_perf;
+
+static uint32_t sim_read(uint8_t *buf, uint32_t addr, uint32_t size)
+{
+    memcpy(buf, &sim_flash[addr - SIM_FLASH_BASE], size);
+    return E2P_STATUS_OK;
+}
+
+static uint32_t sim_write(uint8_t *buf, uint32_t addr, uint32_t size)
+{
+    uint8_t *dst = &sim_flash[addr - SIM_FLASH_BASE];
+
+    /* NOR semantics, programming can only clear bits */
+    for (uint32_t i = 0; i < size; i++) {
+        dst[i] &= buf[i];
+    }
+    return E2P_STATUS_OK;
+}
+
+static void sim_erase(uint32_t start_addr, uint32_t size)
+{
+    memset(&sim_flash[start_addr - SIM_FLASH_BASE], E2P_EARSED_VAR, size);
+}
+
+static uint32_t ticks_to_ns(uint64_t ticks)
+{
+    return (uint32_t)(ticks * 1000000000ULL / index_perf_ticks_per_second());
+}
+
+/* a write deferred by a compaction in progress is retried */
+static void eeprom_write(uint32_t id, uint16_t value)
+{
+    while (e2p_write(id, sizeof(value), (uint8_t *)&value) == E2P_STATUS_BUSY) {
+        ;
+    }
+}
+
+static void eeprom_init(void)
+{
+    e2p_perf.config.start_addr = SIM_FLASH_BASE;
+    e2p_perf.config.erase_size = SIM_ERASE_SIZE;
+    e2p_perf.config.sector_cnt = SIM_SECTOR_CNT;
+    e2p_perf.config.version = 0x4553; /* 'E' 'S' */
+    e2p_perf.config.flash_read = sim_read;
+    e2p_perf.config.flash_write = sim_write;
+    e2p_perf.config.flash_erase = sim_erase;
+
+    sim_erase(SIM_FLASH_BASE, SIM_FLASH_SIZE);
+    e2p_config(&e2p_perf);
+}
+
+static void eeprom_perf_run(uint32_t var_cnt)
+{
+    uint64_t ticks;
+    uint32_t mount_ns, read_ns, write_ns;
+    uint16_t value;
+
+    e2p_clear();
+    e2p_config(&e2p_perf);
+
+    for (uint32_t id = 1; id <= var_cnt; id++) {
+        eeprom_write(id, (uint16_t)id);
+    }
+
+    /* mount replays the whole info log and rebuilds the index */
+    ticks = index_perf_get_ticks();
+    e2p_config(&e2p_perf);
+    mount_ns = ticks_to_ns(index_perf_get_ticks() - ticks);
+
+    ticks = index_perf_get_ticks();
+    for (uint32_t id = 1; id <= var_cnt; id++) {
+        e2p_read(id, sizeof(value), (uint8_t *)&value);
+    }
+    read_ns = ticks_to_ns(index_perf_get_ticks() - ticks) / var_cnt;
+
+    ticks = index_perf_get_ticks();
+    for (uint32_t i = 0; i < PERF_WRITE_CNT; i++) {
+        eeprom_write(var_cnt - (i % var_cnt), (uint16_t)i);
+    }
+    write_ns = ticks_to_ns(index_perf_get_ticks() - ticks) / PERF_WRITE_CNT;
+
+    printf("%8u %14u %14u %14u\n", var_cnt, mount_ns / 1000, read_ns, write_ns);
+}
+
+void index_perf_run(void)
+{
+    eeprom_init();
+    printf("eeprom emulation index perf test, flash simulated in RAM\n");
+    printf("%8s %14s %14s %14s\n", "vars", "mount(us)", "read(ns)", "write(ns)");
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(perf_var_cnt); i++) {
+        if (perf_var_cnt[i] > EEPROM_MAX_VAR_CNT) {
+            break;
+        }
+        eeprom_perf_run(perf_var_cnt[i]);
+    }
+}
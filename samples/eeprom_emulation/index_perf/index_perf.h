@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _INDEX_PERF_H
+#define _INDEX_PERF_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Provided by the platform: a free running counter for timing the emulation layer and its rate
+ */
+uint64_t index_perf_get_ticks(void);
+uint64_t index_perf_ticks_per_second(void);
+
+/*
+ * Prints the mount time and the average read and write latency for 64, 512 and 4096
+ * variables, the counts above EEPROM_MAX_VAR_CNT are skipped.
+ */
+void index_perf_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "board.h"
+#include "hpm_csr_drv.h"
+#include "hpm_clock_drv.h"
+#include "index_perf.h"
+
+uint64_t index_perf_get_ticks(void)
+{
+    return hpm_csr_get_core_mcycle();
+}
+
+uint64_t index_perf_ticks_per_second(void)
+{
+    return clock_get_frequency(clock_cpu0);
+}
+
+int main(void)
+{
+    board_init();
+    index_perf_run();
+
+    while (1) {
+        ;
+    }
+    return 0;
+}
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _USER_CONFIG_H
+#define _USER_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define E2P_DEBUG_LEVEL        E2P_DEBUG_LEVEL_WARN
+#define EEPROM_MAX_VAR_CNT     (4096)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -71,7 +71,9 @@ static void eeprom_perf_write_data(void)
         blob++;
         while (count_per_blob < DEMO_WRITE_CYCLE) {
             blob_data[1] += 10;
-            e2p_write(blob, sizeof(blob_data), (uint8_t *)blob_data);
+            while (e2p_write(blob, sizeof(blob_data), (uint8_t *)blob_data) == E2P_STATUS_BUSY) {
+                ;
+            }
             count_per_blob++;        
         }
         i++;
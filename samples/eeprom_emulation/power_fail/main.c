@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "board.h"
+#include "power_fail.h"
+
+int main(void)
+{
+    board_init();
+    (void)power_fail_run();
+
+    while (1) {
+        ;
+    }
+    return 0;
+}
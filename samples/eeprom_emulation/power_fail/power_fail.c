@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "eeprom_emulation.h"
+#include "sim_flash.h"
+#include "power_fail.h"
+
+/* mapped at SIM_FLASH_BASE so that the addresses fit in 32 bits on any platform */
+#define SIM_FLASH_BASE      (0x80000000UL)
+#define SIM_ERASE_SIZE      (4096)
+#define SIM_SECTOR_CNT      (16)
+#define SIM_FLASH_SIZE      (SIM_ERASE_SIZE * SIM_SECTOR_CNT)
+
+#define TEST_VAR_CNT        (48)
+#define TEST_DATA_MAX       (64)
+#define TEST_WRITE_CNT      (2000)
+#define TEST_TRIAL_CNT      (200)
+#define TEST_IDLE_INTERVAL  (4)
+#define TEST_CUT_SPAN       (300000)
+
+#define LATENCY_WRITE_CNT   (4000)
+
+/* the copy of the fourth block fails: two area state writes, three writes per block, then the info of the block */
+#define GC_ERROR_WRITE_CNT  (2 + 3 * 3 + 1)
+
+ATTR_PLACE_AT_NONCACHEABLE_BSS_WITH_ALIGNMENT(4) uint8_t sim_flash[SIM_FLASH_SIZE];
+
+static uint32_t committed_seq[TEST_VAR_CNT];
+static uint32_t write_latency[LATENCY_WRITE_CNT];
+static uint32_t rand_state = 0x12345678;
+
+e2p_t e2p_test;
+
+static uint32_t test_rand(void)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state;
+}
+
+/* the first 4 bytes carry the sequence number, the rest is derived from it */
+static uint16_t test_fill(uint8_t *buf, uint32_t seq)
+{
+    uint16_t len = 4 + (seq * 13) % (TEST_DATA_MAX - 4);
+
+    memcpy(buf, &seq, sizeof(seq));
+    for (uint16_t i = 4; i < len; i++) {
+        buf[i] = (uint8_t)(seq * 31 + i);
+    }
+    return len;
+}
+
+/* the application retries a write deferred by a compaction in progress */
+static hpm_stat_t test_write(uint32_t id, uint16_t len, uint8_t *buf)
+{
+    hpm_stat_t ret;
+
+    do {
+        ret = e2p_write(id, len, buf);
+    } while (ret == E2P_STATUS_BUSY);
+    return ret;
+}
+
+static bool test_check_var(uint32_t id, uint32_t inflight_id, uint32_t inflight_seq)
+{
+    uint8_t buf[TEST_DATA_MAX];
+    uint8_t expect[TEST_DATA_MAX];
+    uint32_t seq;
+    uint16_t len;
+    hpm_stat_t ret;
+
+    ret = e2p_read(id + 1, sizeof(seq), (uint8_t *)&seq);
+    if (ret != E2P_STATUS_OK) {
+        /* only a variable never committed may be missing */
+        return (committed_seq[id] == 0);
+    }
+
+    if ((seq != committed_seq[id]) && !((id == inflight_id) && (seq == inflight_seq))) {
+        printf("var %u: seq %u, expect %u\n", id, seq, committed_seq[id]);
+        return false;
+    }
+
+    len = test_fill(expect, seq);
+    e2p_read(id + 1, len, buf);
+    if (memcmp(buf, expect, len) != 0) {
+        printf("var %u: data mismatch\n", id);
+        return false;
+    }
+    committed_seq[id] = seq;
+    return true;
+}
+
+static bool test_check_all(uint32_t inflight_id, uint32_t inflight_seq)
+{
+    for (uint32_t id = 0; id < TEST_VAR_CNT; id++) {
+        if (!test_check_var(id, inflight_id, inflight_seq)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool test_power_fail_trial(uint32_t budget, uint32_t *seq)
+{
+    uint8_t buf[TEST_DATA_MAX];
+    uint32_t inflight_id = TEST_VAR_CNT;
+    uint32_t inflight_seq = 0;
+    uint32_t id;
+    uint16_t len;
+
+    e2p_clear();
+    e2p_config(&e2p_test);
+    memset(committed_seq, 0, sizeof(committed_seq));
+
+    sim_flash_arm_power_cut(budget);
+    for (uint32_t i = 0; i < TEST_WRITE_CNT && !sim_flash_power_lost(); i++) {
+        id = test_rand() % TEST_VAR_CNT;
+        len = test_fill(buf, ++(*seq));
+        inflight_id = id;
+        inflight_seq = *seq;
+        if ((e2p_write(id + 1, len, buf) == E2P_STATUS_OK) && !sim_flash_power_lost()) {
+            committed_seq[id] = *seq;
+            inflight_id = TEST_VAR_CNT;
+        }
+        /* idle hook */
+        if (((i % TEST_IDLE_INTERVAL) == 0) && !sim_flash_power_lost()) {
+            e2p_gc_step();
+        }
+    }
+    sim_flash_power_on();
+
+    /* reboot */
+    if (e2p_config(&e2p_test) != E2P_STATUS_OK) {
+        printf("budget %u: mount failed\n", budget);
+        return false;
+    }
+    if (!test_check_all(inflight_id, inflight_seq)) {
+        printf("budget %u: check after power cut failed\n", budget);
+        return false;
+    }
+
+    /* the recovered area must stay usable */
+    for (id = 0; id < TEST_VAR_CNT; id++) {
+        len = test_fill(buf, ++(*seq));
+        if (test_write(id + 1, len, buf) != E2P_STATUS_OK) {
+            printf("budget %u: write after recovery failed\n", budget);
+            return false;
+        }
+        committed_seq[id] = *seq;
+    }
+    e2p_flush(E2P_FLUSH_BEGIN);
+    e2p_config(&e2p_test);
+    if (!test_check_all(TEST_VAR_CNT, 0)) {
+        printf("budget %u: check after recovery failed\n", budget);
+        return false;
+    }
+
+    return true;
+}
+
+static uint32_t test_power_fail(void)
+{
+    uint32_t seq = 0;
+    uint32_t passed = 0;
+
+    for (uint32_t trial = 0; trial < TEST_TRIAL_CNT; trial++) {
+        if (test_power_fail_trial(1 + test_rand() % TEST_CUT_SPAN, &seq)) {
+            passed++;
+        }
+    }
+    printf("power cut test: %u / %u trials consistent\n", passed, TEST_TRIAL_CNT);
+    return TEST_TRIAL_CNT - passed;
+}
+
+/* a program error during the copy stops the compaction, the source area keeps the blocks not moved yet */
+static bool test_gc_error(void)
+{
+    uint8_t buf[TEST_DATA_MAX];
+    uint32_t seq = 0;
+    uint16_t len;
+
+    e2p_clear();
+    e2p_config(&e2p_test);
+    memset(committed_seq, 0, sizeof(committed_seq));
+    for (uint32_t id = 0; id < TEST_VAR_CNT; id++) {
+        len = test_fill(buf, ++seq);
+        if (test_write(id + 1, len, buf) != E2P_STATUS_OK) {
+            printf("gc error: write failed\n");
+            return false;
+        }
+        committed_seq[id] = seq;
+    }
+
+    sim_flash_arm_write_error(GC_ERROR_WRITE_CNT);
+    if (e2p_flush(E2P_FLUSH_BEGIN) != E2P_ERROR) {
+        printf("gc error: flush did not report the error\n");
+        return false;
+    }
+    len = test_fill(buf, seq + 1);
+    if ((e2p_gc_step() != E2P_ERROR) || (e2p_write(1, len, buf) != E2P_ERROR)) {
+        printf("gc error: compaction not stopped\n");
+        return false;
+    }
+    if (!test_check_all(TEST_VAR_CNT, 0)) {
+        printf("gc error: check after the error failed\n");
+        return false;
+    }
+
+    /* reboot, the compaction is resumed */
+    sim_flash_power_on();
+    if ((e2p_config(&e2p_test) != E2P_STATUS_OK) || (e2p_flush(E2P_FLUSH_BEGIN) != E2P_STATUS_OK)) {
+        printf("gc error: resume failed\n");
+        return false;
+    }
+    e2p_config(&e2p_test);
+    if (!test_check_all(TEST_VAR_CNT, 0)) {
+        printf("gc error: check after resume failed\n");
+        return false;
+    }
+
+    printf("compaction error test: passed\n");
+    return true;
+}
+
+/*
+ * the live blocks take a small part of the area, so a write during the copy never has to wait
+ * for the compaction: the room reserved for the blocks still to move must not go wrong
+ */
+static bool test_gc_reserve(void)
+{
+    uint8_t buf[TEST_DATA_MAX];
+    uint32_t seq = 0;
+    uint32_t busy = 0;
+    uint32_t erases = 0;
+    uint32_t id;
+    uint64_t start;
+    uint16_t len;
+    hpm_stat_t ret;
+
+    e2p_clear();
+    e2p_config(&e2p_test);
+    memset(committed_seq, 0, sizeof(committed_seq));
+    for (uint32_t i = 0; i < LATENCY_WRITE_CNT; i++) {
+        id = test_rand() % TEST_VAR_CNT;
+        len = test_fill(buf, ++seq);
+        start = sim_flash_time_us();
+        ret = e2p_write(id + 1, len, buf);
+        /* a compaction step erasing a sector of the source area ran in this write */
+        if ((sim_flash_time_us() - start) >= SIM_FLASH_SECTOR_ERASE_US) {
+            erases++;
+        }
+        if (ret == E2P_STATUS_BUSY) {
+            busy++;
+        } else if (ret != E2P_STATUS_OK) {
+            printf("gc reserve: write failed\n");
+            return false;
+        } else {
+            committed_seq[id] = seq;
+        }
+    }
+    if ((erases == 0) || (busy != 0)) {
+        printf("gc reserve: %u writes deferred in %u compaction steps\n", busy, erases);
+        return false;
+    }
+    if (!test_check_all(TEST_VAR_CNT, 0)) {
+        printf("gc reserve: check failed\n");
+        return false;
+    }
+
+    printf("compaction reserve test: passed\n");
+    return true;
+}
+
+static int latency_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* every e2p_write call is one sample, a deferred write is retried with the same data */
+static void test_latency(bool idle_hook)
+{
+    uint8_t buf[TEST_DATA_MAX];
+    uint32_t seq = 0;
+    uint32_t busy = 0;
+    uint32_t id = 0;
+    uint64_t start;
+    uint16_t len = 0;
+    hpm_stat_t ret = E2P_STATUS_OK;
+
+    e2p_clear();
+    e2p_config(&e2p_test);
+
+    for (uint32_t i = 0; i < LATENCY_WRITE_CNT; i++) {
+        if (ret != E2P_STATUS_BUSY) {
+            id = test_rand() % TEST_VAR_CNT + 1;
+            len = test_fill(buf, ++seq);
+        }
+        start = sim_flash_time_us();
+        ret = e2p_write(id, len, buf);
+        write_latency[i] = (uint32_t)(sim_flash_time_us() - start);
+        if (ret == E2P_STATUS_BUSY) {
+            busy++;
+        }
+        if (idle_hook && ((i % TEST_IDLE_INTERVAL) == 0)) {
+            e2p_gc_step();
+        }
+    }
+
+    qsort(write_latency, LATENCY_WRITE_CNT, sizeof(write_latency[0]), latency_compare);
+    printf("%-18s %10u %10u %10u %10u %10u\n", idle_hook ? "write + idle hook" : "write only",
+           write_latency[LATENCY_WRITE_CNT / 2],
+           write_latency[LATENCY_WRITE_CNT * 99 / 100],
+           write_latency[LATENCY_WRITE_CNT * 999 / 1000],
+           write_latency[LATENCY_WRITE_CNT - 1], busy);
+}
+
+static void test_blocking_flush(void)
+{
+    uint64_t start;
+
+    start = sim_flash_time_us();
+    e2p_flush(E2P_FLUSH_BEGIN);
+    printf("%-18s %10u (blocking e2p_flush for reference)\n", "flush", (uint32_t)(sim_flash_time_us() - start));
+}
+
+uint32_t power_fail_run(void)
+{
+    uint32_t failed = 0;
+
+    printf("eeprom emulation power fail and latency test, flash simulated in RAM\n");
+
+    sim_flash_init(sim_flash, SIM_FLASH_BASE, SIM_FLASH_SIZE, SIM_ERASE_SIZE);
+    e2p_test.config.start_addr = SIM_FLASH_BASE;
+    e2p_test.config.erase_size = SIM_ERASE_SIZE;
+    e2p_test.config.sector_cnt = SIM_SECTOR_CNT;
+    e2p_test.config.version = 0x4553; /* 'E' 'S' */
+    e2p_test.config.flash_read = sim_flash_read;
+    e2p_test.config.flash_write = sim_flash_write;
+    e2p_test.config.flash_erase = sim_flash_erase;
+    e2p_config(&e2p_test);
+
+    failed += test_power_fail();
+    failed += test_gc_error() ? 0 : 1;
+    failed += test_gc_reserve() ? 0 : 1;
+
+    printf("\nwrite latency in simulated us, page program %uus, sector erase %uus\n",
+           SIM_FLASH_PAGE_PROGRAM_US, SIM_FLASH_SECTOR_ERASE_US);
+    printf("%-18s %10s %10s %10s %10s %10s\n", "mode", "p50", "p99", "p99.9", "max", "busy");
+    test_latency(false);
+    test_latency(true);
+    test_blocking_flush();
+
+    return failed;
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _POWER_FAIL_H
+#define _POWER_FAIL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Runs the power cut, compaction error and compaction reserve tests, then prints the write
+ * latency on the simulated flash.
+ *
+ * Returns the number of failed tests.
+ */
+uint32_t power_fail_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
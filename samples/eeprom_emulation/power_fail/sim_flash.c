@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "sim_flash.h"
+
+typedef struct {
+    uint8_t *mem;
+    uint32_t base;
+    uint32_t size;
+    uint32_t erase_size;
+    bool cut_armed;
+    bool power_lost;
+    bool write_error_armed;
+    uint32_t write_error_count;
+    uint32_t budget;
+    uint64_t time_us;
+} sim_flash_t;
+
+static sim_flash_t sim;
+
+/* consume budget, return how many of the requested units complete before power is lost */
+static uint32_t sim_flash_consume(uint32_t units)
+{
+    if (sim.power_lost) {
+        return 0;
+    }
+    if (!sim.cut_armed || units < sim.budget) {
+        sim.budget -= sim.cut_armed ? units : 0;
+        return units;
+    }
+    units = sim.budget;
+    sim.budget = 0;
+    sim.power_lost = true;
+    return units;
+}
+
+void sim_flash_init(uint8_t *mem, uint32_t base, uint32_t size, uint32_t erase_size)
+{
+    memset(&sim, 0, sizeof(sim));
+    sim.mem = mem;
+    sim.base = base;
+    sim.size = size;
+    sim.erase_size = erase_size;
+    memset(mem, 0xFF, size);
+}
+
+uint32_t sim_flash_read(uint8_t *buf, uint32_t addr, uint32_t size)
+{
+    memcpy(buf, &sim.mem[addr - sim.base], size);
+    return 0;
+}
+
+uint32_t sim_flash_write(uint8_t *buf, uint32_t addr, uint32_t size)
+{
+    uint8_t *dst = &sim.mem[addr - sim.base];
+    uint32_t done;
+    uint32_t first_page = (addr - sim.base) / SIM_FLASH_PAGE_SIZE;
+    uint32_t last_page = (addr - sim.base + size - 1) / SIM_FLASH_PAGE_SIZE;
+
+    if (sim.write_error_armed) {
+        if (sim.write_error_count == 0) {
+            return 1;
+        }
+        sim.write_error_count--;
+    }
+
+    done = sim_flash_consume(size);
+    for (uint32_t i = 0; i < done; i++) {
+        dst[i] &= buf[i];
+    }
+    if (done > 0) {
+        sim.time_us += (uint64_t)(last_page - first_page + 1) * SIM_FLASH_PAGE_PROGRAM_US;
+    }
+    return 0;
+}
+
+void sim_flash_erase(uint32_t start_addr, uint32_t size)
+{
+    uint32_t offset = start_addr - sim.base;
+
+    for (uint32_t i = 0; i < size; i += sim.erase_size) {
+        uint32_t done = sim_flash_consume(sim.erase_size);
+        if (done == 0) {
+            break;
+        }
+        /* a torn erase leaves the sector partly erased */
+        memset(&sim.mem[offset + i], 0xFF, done);
+        sim.time_us += SIM_FLASH_SECTOR_ERASE_US;
+    }
+}
+
+void sim_flash_arm_power_cut(uint32_t budget)
+{
+    sim.cut_armed = true;
+    sim.budget = budget;
+}
+
+bool sim_flash_power_lost(void)
+{
+    return sim.power_lost;
+}
+
+void sim_flash_power_on(void)
+{
+    sim.cut_armed = false;
+    sim.power_lost = false;
+    sim.write_error_armed = false;
+}
+
+void sim_flash_arm_write_error(uint32_t count)
+{
+    sim.write_error_armed = true;
+    sim.write_error_count = count;
+}
+
+uint64_t sim_flash_time_us(void)
+{
+    return sim.time_us;
+}
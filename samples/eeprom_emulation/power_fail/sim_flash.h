@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef _SIM_FLASH_H
+#define _SIM_FLASH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * RAM backed NOR flash model
+ *  - programming can only clear bits, erase sets a sector to 0xFF
+ *  - every programmed byte and every erased sector costs virtual time
+ *  - a power cut can be armed after a number of programmed bytes / erased sectors,
+ *    the operation in flight is torn and all later program/erase operations are dropped
+ *  - a program error can be armed after a number of writes, the failing writes return 1
+ */
+#define SIM_FLASH_PAGE_SIZE         (256U)
+#define SIM_FLASH_PAGE_PROGRAM_US   (700U)
+#define SIM_FLASH_SECTOR_ERASE_US   (45000U)
+
+void sim_flash_init(uint8_t *mem, uint32_t base, uint32_t size, uint32_t erase_size);
+uint32_t sim_flash_read(uint8_t *buf, uint32_t addr, uint32_t size);
+uint32_t sim_flash_write(uint8_t *buf, uint32_t addr, uint32_t size);
+void sim_flash_erase(uint32_t start_addr, uint32_t size);
+
+/* power is lost once budget units are consumed, one unit per programmed byte, erase_size units per sector */
+void sim_flash_arm_power_cut(uint32_t budget);
+bool sim_flash_power_lost(void);
+void sim_flash_power_on(void);
+
+/* the write after the next count writes and all later ones fail without programming, until sim_flash_power_on */
+void sim_flash_arm_write_error(uint32_t count);
+
+/* virtual busy time in us since init */
+uint64_t sim_flash_time_us(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -146,7 +146,9 @@ hpm_stat_t ecat_flash_eeprom_init(void)
             disable_global_irq(CSR_MSTATUS_MIE_MASK);
             /* init eeprom content */
             for (uint32_t i = 0; i < ESC_EEPROM_SIZE / EEPROM_WRITE_SIZE; i++) {
-                stat = e2p_write(i, EEPROM_WRITE_SIZE, &aEepromData[2*i]);
+                do {
+                    stat = e2p_write(i, EEPROM_WRITE_SIZE, &aEepromData[2*i]);
+                } while (stat == E2P_STATUS_BUSY);
                 if (stat != E2P_STATUS_OK) {
                     printf("Init EEPROM content failed.\n");
                     return status_fail;
@@ -163,7 +165,9 @@ hpm_stat_t ecat_flash_eeprom_init(void)
     for (uint32_t i = 0; i < ESC_EEPROM_SIZE / EEPROM_WRITE_SIZE; i++) {
         stat = e2p_read(i, EEPROM_WRITE_SIZE, (uint8_t *)&data);
         if (stat != E2P_STATUS_OK) {
-            stat = e2p_write(i, EEPROM_WRITE_SIZE, (uint8_t *)&dummy_data);
+            do {
+                stat = e2p_write(i, EEPROM_WRITE_SIZE, (uint8_t *)&dummy_data);
+            } while (stat == E2P_STATUS_BUSY);
             if (stat != E2P_STATUS_OK) {
                 break;
             }
@@ -181,7 +185,10 @@ hpm_stat_t ecat_flash_eeprom_write(uint32_t addr, uint8_t *data)
 {
     hpm_stat_t stat;
     disable_global_irq(CSR_MSTATUS_MIE_MASK);
-    stat = e2p_write(addr, EEPROM_WRITE_SIZE, data);
+    /* a write deferred by compaction is retried, it runs a bounded number of compaction steps each time */
+    do {
+        stat = e2p_write(addr, EEPROM_WRITE_SIZE, data);
+    } while (stat == E2P_STATUS_BUSY);
     enable_global_irq(CSR_MSTATUS_MIE_MASK);
     if (stat == status_success) {
         e2p_info("\n WRITE success: addr[%d] - val[0x%x]\n", addr, *((uint16_t *)data));
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include "board.h"
+#include "hpm_clock_drv.h"
+#include "hpm_csr_drv.h"
+#include "hpm_l1c_drv.h"
+#include "hpm_ffa_drv.h"
+#include "hpm_ffa_job.h"
+
+/*
+ * Streaming spectra of a vibration signal. Every frame is low-pass filtered by an FIR on the
+ * FFA, turned into complex samples by the CPU, transformed by an FFT on the FFA and the
+ * magnitude of the spectrum is computed by the CPU, whose peak bin is the frame result.
+ *
+ * The frames are processed twice: with the blocking api, and with a ring of FRAME_RING_SIZE
+ * job chains on the FFA job queue, where the CPU generates the next frames while the FFA works.
+ */
+
+#define FFT_LOG2            (9U)
+#define FFT_POINTS          (1U << FFT_LOG2)
+#define FIR_TAPS            (16U)
+#define FIR_INPUT_TAPS      (FFT_POINTS + FIR_TAPS - 1U)
+#define MAG_POINTS          (FFT_POINTS / 2U)
+#define FRAME_RING_SIZE     (4U)
+#define FRAME_COUNT         (256U)
+
+/* tone bins of the frames, below the first zero of the moving average at FFT_POINTS / FIR_TAPS */
+#define FRAME_TONE_BIN(n)   (4U + ((n) % 16U))
+
+typedef struct {
+    uint32_t index;
+    ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) ffa_q31_t raw[FIR_INPUT_TAPS];
+    ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) ffa_q31_t filtered[FFT_POINTS];
+    ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) ffa_q31_t cplx[2 * FFT_POINTS];
+    ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) ffa_q31_t spectrum[2 * FFT_POINTS];
+    ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) ffa_q31_t magnitude[MAG_POINTS];
+    ffa_job_t fir_job;
+    ffa_job_t complex_job;
+    ffa_job_t fft_job;
+    ffa_job_t mag_job;
+} frame_t;
+
+static frame_t s_frames[FRAME_RING_SIZE];
+ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) static ffa_q31_t s_fir_coeff[FIR_TAPS];
+static uint16_t s_blocking_peak[FRAME_COUNT];
+static uint16_t s_queued_peak[FRAME_COUNT];
+
+static void frame_generate(frame_t *frame, uint32_t index)
+{
+    float bin = (float)FRAME_TONE_BIN(index);
+
+    /* a tone, a smaller tone above the filter band and noise, scaled for the fft of the ffa */
+    frame->index = index;
+    for (uint32_t i = 0; i < FIR_INPUT_TAPS; i++) {
+        float t = (float)(index * FFT_POINTS + i) / FFT_POINTS;
+        float x = 0.5f * sinf(2.0f * (float)M_PI * bin * t) +
+                  0.2f * sinf(2.0f * (float)M_PI * 100.0f * t) +
+                  0.02f * ((float)(((i * 1103515245U + 12345U) >> 16) & 0xFFFFU) / 65536.0f - 0.5f);
+        frame->raw[i] = (ffa_q31_t)(x / FFT_POINTS * 2147483647.0f);
+    }
+}
+
+static hpm_stat_t frame_to_complex(ffa_job_t *job)
+{
+    const ffa_q31_t *src = (const ffa_q31_t *)job->xfer.cpu.src;
+    ffa_q31_t *dst = (ffa_q31_t *)job->xfer.cpu.dst;
+
+    for (uint32_t i = 0; i < job->xfer.cpu.num; i++) {
+        dst[2 * i] = src[i];
+        dst[2 * i + 1] = 0;
+    }
+    return status_success;
+}
+
+static uint16_t frame_peak_bin(const frame_t *frame)
+{
+    uint16_t peak = 1;
+
+    for (uint16_t i = 2; i < MAG_POINTS; i++) {
+        if (frame->magnitude[i] > frame->magnitude[peak]) {
+            peak = i;
+        }
+    }
+    return peak;
+}
+
+static void frame_done_callback(ffa_job_t *job, void *cb_data_ptr)
+{
+    frame_t *frame = (frame_t *)cb_data_ptr;
+
+    if (job->status == status_success) {
+        s_queued_peak[frame->index] = frame_peak_bin(frame);
+    }
+}
+
+static void frame_setup_jobs(frame_t *frame)
+{
+    ffa_job_t *job;
+
+    memset(&frame->fir_job, 0, sizeof(frame->fir_job));
+    memset(&frame->complex_job, 0, sizeof(frame->complex_job));
+    memset(&frame->fft_job, 0, sizeof(frame->fft_job));
+    memset(&frame->mag_job, 0, sizeof(frame->mag_job));
+
+    job = &frame->fir_job;
+    job->type = ffa_job_type_fir;
+    job->xfer.fir.data_type = FFA_DATA_TYPE_REAL_Q31;
+    job->xfer.fir.coef_taps = FIR_TAPS;
+    job->xfer.fir.input_taps = FIR_INPUT_TAPS;
+    job->xfer.fir.src = frame->raw;
+    job->xfer.fir.coeff = s_fir_coeff;
+    job->xfer.fir.dst = frame->filtered;
+    job->src_size = FIR_INPUT_TAPS * sizeof(ffa_q31_t);
+    job->coef_size = sizeof(s_fir_coeff);
+    job->dst_size = sizeof(frame->filtered);
+    job->next = &frame->complex_job;
+
+    job = &frame->complex_job;
+    job->type = ffa_job_type_cpu;
+    job->xfer.cpu.process = frame_to_complex;
+    job->xfer.cpu.src = frame->filtered;
+    job->xfer.cpu.dst = frame->cplx;
+    job->xfer.cpu.num = FFT_POINTS;
+    job->dst_size = sizeof(frame->cplx);
+    job->next = &frame->fft_job;
+
+    job = &frame->fft_job;
+    job->type = ffa_job_type_fft;
+    job->xfer.fft.num_points = FFT_POINTS;
+    job->xfer.fft.src_data_type = FFA_DATA_TYPE_COMPLEX_Q31;
+    job->xfer.fft.dst_data_type = FFA_DATA_TYPE_COMPLEX_Q31;
+    job->xfer.fft.src = frame->cplx;
+    job->xfer.fft.dst = frame->spectrum;
+    job->src_size = sizeof(frame->cplx);
+    job->dst_size = sizeof(frame->spectrum);
+    job->next = &frame->mag_job;
+
+    job = &frame->mag_job;
+    job->type = ffa_job_type_cpu;
+    job->xfer.cpu.process = hpm_ffa_job_cmag_q31;
+    job->xfer.cpu.src = frame->spectrum;
+    job->xfer.cpu.dst = frame->magnitude;
+    job->xfer.cpu.num = MAG_POINTS;
+    job->callback = frame_done_callback;
+    job->cb_data_ptr = frame;
+}
+
+static void cache_writeback(const void *buf, uint32_t size)
+{
+    if (l1c_dc_is_enabled()) {
+        uint32_t start = HPM_L1C_CACHELINE_ALIGN_DOWN((uint32_t)buf);
+        uint32_t end = HPM_L1C_CACHELINE_ALIGN_UP((uint32_t)buf + size);
+        l1c_dc_writeback(start, end - start);
+    }
+}
+
+static void cache_invalidate(void *buf, uint32_t size)
+{
+    if (l1c_dc_is_enabled()) {
+        l1c_dc_invalidate((uint32_t)buf, size);
+    }
+}
+
+/* the same processing with the blocking api and the cache maintenance done by hand */
+static hpm_stat_t frame_process_blocking(frame_t *frame)
+{
+    fir_xfer_t fir = frame->fir_job.xfer.fir;
+    fft_xfer_t fft = frame->fft_job.xfer.fft;
+    hpm_stat_t stat;
+
+    cache_writeback(frame->raw, FIR_INPUT_TAPS * sizeof(ffa_q31_t));
+    stat = ffa_calculate_fir_blocking(HPM_FFA, &fir);
+    if (stat != status_success) {
+        return stat;
+    }
+    cache_invalidate(frame->filtered, sizeof(frame->filtered));
+    (void)frame_to_complex(&frame->complex_job);
+    cache_writeback(frame->cplx, sizeof(frame->cplx));
+    stat = ffa_calculate_fft_blocking(HPM_FFA, &fft);
+    if (stat != status_success) {
+        return stat;
+    }
+    cache_invalidate(frame->spectrum, sizeof(frame->spectrum));
+    (void)hpm_ffa_job_cmag_q31(&frame->mag_job);
+    s_blocking_peak[frame->index] = frame_peak_bin(frame);
+    return status_success;
+}
+
+static void print_throughput(const char *name, uint64_t cycles)
+{
+    uint32_t freq = clock_get_frequency(clock_cpu0);
+    uint32_t fps = (uint32_t)((uint64_t)FRAME_COUNT * freq / cycles);
+
+    printf("%-10s %u frames, %u cycles per frame, %u frames/s\n", name, FRAME_COUNT,
+           (uint32_t)(cycles / FRAME_COUNT), fps);
+}
+
+int main(void)
+{
+    hpm_ffa_job_config_t config;
+    uint64_t blocking_cycles;
+    uint64_t queued_cycles;
+    uint64_t start;
+    uint32_t errors = 0;
+
+    board_init();
+    clock_add_to_group(clock_ffa0, 0);
+    printf("ffa job queue: %u-tap fir, %u-point fft and magnitude per frame\n", FIR_TAPS, FFT_POINTS);
+
+    /* moving average low-pass */
+    for (uint32_t i = 0; i < FIR_TAPS; i++) {
+        s_fir_coeff[i] = (ffa_q31_t)(0x7FFFFFFFUL / FIR_TAPS);
+    }
+    cache_writeback(s_fir_coeff, sizeof(s_fir_coeff));
+    for (uint32_t i = 0; i < FRAME_RING_SIZE; i++) {
+        frame_setup_jobs(&s_frames[i]);
+    }
+
+    /* blocking api, before the job queue owns the ffa interrupt */
+    start = hpm_csr_get_core_mcycle();
+    for (uint32_t n = 0; n < FRAME_COUNT; n++) {
+        frame_t *frame = &s_frames[n % FRAME_RING_SIZE];
+        frame_generate(frame, n);
+        if (frame_process_blocking(frame) != status_success) {
+            errors++;
+        }
+    }
+    blocking_cycles = hpm_csr_get_core_mcycle() - start;
+
+    hpm_ffa_job_get_default_config(&config);
+    config.running_core = BOARD_RUNNING_CORE;
+    hpm_ffa_job_init(&config);
+
+    /* job queue, a frame slot is refilled once its last job is done */
+    start = hpm_csr_get_core_mcycle();
+    for (uint32_t n = 0; n < FRAME_COUNT; n++) {
+        frame_t *frame = &s_frames[n % FRAME_RING_SIZE];
+        if (n >= FRAME_RING_SIZE) {
+            (void)hpm_ffa_job_wait(&frame->mag_job);
+        }
+        frame_generate(frame, n);
+        if (hpm_ffa_job_submit(&frame->fir_job) != status_success) {
+            errors++;
+        }
+    }
+    for (uint32_t i = 0; i < FRAME_RING_SIZE; i++) {
+        if (hpm_ffa_job_wait(&s_frames[i].mag_job) != status_success) {
+            errors++;
+        }
+    }
+    queued_cycles = hpm_csr_get_core_mcycle() - start;
+
+    for (uint32_t n = 0; n < FRAME_COUNT; n++) {
+        if ((s_blocking_peak[n] != FRAME_TONE_BIN(n)) || (s_queued_peak[n] != s_blocking_peak[n])) {
+            printf("frame %u: peak bin %u blocking, %u queued, %u expected\n", n,
+                   s_blocking_peak[n], s_queued_peak[n], FRAME_TONE_BIN(n));
+            errors++;
+        }
+    }
+
+    print_throughput("blocking", blocking_cycles);
+    print_throughput("queued", queued_cycles);
+    printf("throughput %u%% of the blocking api\n", (uint32_t)(blocking_cycles * 100U / queued_cycles));
+    printf("ffa job test %s\n", errors == 0 ? "PASSED" : "FAILED");
+
+    while (1) {
+        ;
+    }
+    return 0;
+}
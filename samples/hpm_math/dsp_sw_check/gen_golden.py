@@ -0,0 +1,861 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 HPMicro
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Generates src/golden_vectors.h for the dsp_sw_check sample.
+#
+# The fixed-point references model the riscv_dsp semantics with python integers: full
+# precision products, arithmetic right shifts and saturation to the output type. The
+# floating-point references are computed in double precision straight from the definitions
+# (DFT, DCT), so they are independent of any FFT algorithm.
+#
+# usage: python3 gen_golden.py [output]
+
+import math
+import os
+import struct
+import sys
+
+Q7_MIN, Q7_MAX = -(1 << 7), (1 << 7) - 1
+Q15_MIN, Q15_MAX = -(1 << 15), (1 << 15) - 1
+Q31_MIN, Q31_MAX = -(1 << 31), (1 << 31) - 1
+
+
+def sat(x, lo, hi):
+    return lo if x < lo else (hi if x > hi else x)
+
+
+def sat7(x):
+    return sat(x, Q7_MIN, Q7_MAX)
+
+
+def sat15(x):
+    return sat(x, Q15_MIN, Q15_MAX)
+
+
+def sat31(x):
+    return sat(x, Q31_MIN, Q31_MAX)
+
+
+def satu8(x):
+    return sat(x, 0, 0xFF)
+
+
+def wrap(x, bits):
+    """Two's complement wrap around, like a cast to a narrower C integer."""
+    x &= (1 << bits) - 1
+    return x - (1 << bits) if x >= (1 << (bits - 1)) else x
+
+
+def tdiv(a, b):
+    """C integer division, truncated toward zero."""
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
+
+
+class Lcg:
+    """Deterministic numbers, so the header only changes when the script does."""
+
+    def __init__(self, seed):
+        self.state = seed
+
+    def next(self):
+        self.state = (self.state * 1103515245 + 12345) & 0x7FFFFFFF
+        return self.state
+
+    def q(self, bits):
+        return (self.next() % (1 << bits)) - (1 << (bits - 1))
+
+    def uniform(self):
+        return self.next() / float(0x7FFFFFFF) * 2.0 - 1.0
+
+
+def q15_vec(rng, n, edges=()):
+    v = [rng.q(16) for _ in range(n)]
+    for i, e in enumerate(edges):
+        v[i] = e
+    return v
+
+
+def q31_vec(rng, n, edges=()):
+    v = [rng.q(32) for _ in range(n)]
+    for i, e in enumerate(edges):
+        v[i] = e
+    return v
+
+
+def q7_vec(rng, n, edges=()):
+    v = [rng.q(8) for _ in range(n)]
+    for i, e in enumerate(edges):
+        v[i] = e
+    return v
+
+
+def u8_vec(rng, n, edges=()):
+    v = [rng.next() & 0xFF for _ in range(n)]
+    for i, e in enumerate(edges):
+        v[i] = e
+    return v
+
+
+def search(values, better):
+    """Value and index of the first best element, like the strict comparison of the C loop."""
+    res, pos = values[0], 0
+    for i, v in enumerate(values):
+        if better(v, res):
+            res, pos = v, i
+    return res, pos
+
+
+def fir(x, coeff_rev, rshift, satf, block):
+    """Block FIR with time reversed coefficients, processed in blocks like the C code."""
+    taps = len(coeff_rev)
+    state = [0] * (taps - 1)
+    out = []
+    for b in range(0, len(x), block):
+        s = state + x[b:b + block]
+        for n in range(len(x[b:b + block])):
+            acc = sum(coeff_rev[k] * s[n + k] for k in range(taps))
+            out.append(satf(acc >> rshift))
+        state = s[len(s) - (taps - 1):]
+    return out
+
+
+def fir_prods(x, coeff_rev, out, block, step=1):
+    """Block FIR or decimator, out() turns the products of one output into the sample."""
+    taps = len(coeff_rev)
+    state = [0] * (taps - 1)
+    res = []
+    for b in range(0, len(x), block):
+        s = state + x[b:b + block]
+        for n in range(block // step):
+            res.append(out([coeff_rev[k] * s[n * step + k] for k in range(taps)]))
+        state = s[len(s) - (taps - 1):]
+    return res
+
+
+def upsplfir(x, coeff, L, out, block):
+    plen = len(coeff) // L
+    state = [0] * (plen - 1)
+    res = []
+    for b in range(0, len(x), block):
+        s = state + x[b:b + block]
+        for n in range(block):
+            for j in range(L):
+                res.append(out([s[n + k] * coeff[(L - 1 - j) + k * L] for k in range(plen)]))
+        state = s[len(s) - (plen - 1):]
+    return res
+
+
+def spafir(x, coeff, delays, out):
+    return [out([c * (x[n - d] if n >= d else 0) for c, d in zip(coeff, delays)]) for n in range(len(x))]
+
+
+def lfir(x, k, satf, q):
+    g_state = [0] * len(k)
+    res = []
+    for v in x:
+        f = g = v
+        for m in range(len(k)):
+            g_prev = g_state[m]
+            f_next = satf(f + ((k[m] * g_prev) >> q))
+            g_state[m] = g
+            g = satf(((k[m] * f) >> q) + g_prev)
+            f = f_next
+        res.append(f)
+    return res
+
+
+def lms(x, ref, coeff, mu, shift, q, satf, wrapf):
+    """Returns the outputs, the errors and the adapted coefficients."""
+    taps = len(coeff)
+    coeff = list(coeff)
+    hist = [0] * (taps - 1)
+    dst, err = [], []
+    for v, r in zip(x, ref):
+        hist.append(v)
+        w = hist[-taps:]
+        y = satf(sum(c * s for c, s in zip(coeff, w)) >> (q - shift))
+        e = satf(r - y)
+        alpha = wrapf((e * mu) >> q)
+        coeff = [satf(c + ((alpha * s) >> q)) for c, s in zip(coeff, w)]
+        dst.append(y)
+        err.append(e)
+    return dst, err, coeff
+
+
+def nlms(x, ref, coeff, mu, postshift, q, satf, wrapf, delta):
+    taps = len(coeff)
+    coeff = list(coeff)
+    hist = [0] * (taps - 1)
+    energy = x0 = 0
+    dst, err = [], []
+    for v, r in zip(x, ref):
+        hist.append(v)
+        w = hist[-taps:]
+        energy = satf(energy - ((x0 * x0) >> q) + ((v * v) >> q))
+        y = satf(sum(c * s for c, s in zip(coeff, w)) >> (q - postshift))
+        e = satf(r - y)
+        mu_err = wrapf((e * mu) >> q)
+        step = satf(tdiv(mu_err << q, energy + delta))
+        coeff = [satf(c + ((step * s) >> q)) for c, s in zip(coeff, w)]
+        x0 = w[0]
+        dst.append(y)
+        err.append(e)
+    return dst, err, coeff
+
+
+def liir(x, k, v, q, satf, block):
+    """Lattice IIR, the state vector is emulated as in the C code."""
+    stages = len(k)
+    state = [0] * (stages + block)
+    res = []
+    for b in range(0, len(x), block):
+        for n in range(block):
+            f = x[b + n]
+            acc = 0
+            for m in range(stages):
+                g = state[n + m]
+                f_next = satf(f - ((k[m] * g) >> q))
+                g_next = satf(((f_next * k[m]) >> q) + g)
+                acc += g_next * v[m]
+                state[n + m] = g_next
+                f = f_next
+            acc += f * v[stages]
+            state[n + stages] = f
+            res.append(satf(acc >> q))
+        state = state[block:block + stages] + [0] * block
+    return res
+
+
+def bq_df1(x, coeff, nstage, out):
+    """Direct form I cascade, out() turns the five products of a sample into y."""
+    data = list(x)
+    for s in range(nstage):
+        c = coeff[5 * s:5 * s + 5]
+        x1 = x2 = y1 = y2 = 0
+        res = []
+        for v in data:
+            y = out([c[0] * v, c[1] * x1, c[2] * x2, c[3] * y1, c[4] * y2])
+            x2, x1, y2, y1 = x1, v, y1, y
+            res.append(y)
+        data = res
+    return data
+
+
+def mul_32x64(x, y):
+    return (((x & 0xFFFFFFFF) * y) >> 32) + (x >> 32) * y
+
+
+def bq_df1_32x64(x, coeff, nstage, shift):
+    data = list(x)
+    for s in range(nstage):
+        c = coeff[5 * s:5 * s + 5]
+        x1 = x2 = y1 = y2 = 0
+        res = []
+        for v in data:
+            acc = c[0] * v + c[1] * x1 + c[2] * x2 + mul_32x64(y1, c[3]) + mul_32x64(y2, c[4])
+            y = wrap(acc << (shift + 1), 64)
+            x2, x1, y2, y1 = x1, v, y1, y
+            res.append(y >> 32)
+        data = res
+    return data
+
+
+def bq_df2t(x, coeff, nstage):
+    data = list(x)
+    for s in range(nstage):
+        b0, b1, b2, a1, a2 = coeff[5 * s:5 * s + 5]
+        d1 = d2 = 0.0
+        res = []
+        for v in data:
+            y = b0 * v + d1
+            d1 = b1 * v + a1 * y + d2
+            d2 = b2 * v + a2 * y
+            res.append(y)
+        data = res
+    return data
+
+
+def mat_mul(a, b, row, col, col2, out):
+    return [out([a[i * col + k] * b[k * col2 + j] for k in range(col)]) for i in range(row) for j in range(col2)]
+
+
+def bq_df1_q31(x, coeff, nstage, shift):
+    data = list(x)
+    for s in range(nstage):
+        c = coeff[5 * s:5 * s + 5]
+        x1 = x2 = y1 = y2 = 0
+        out = []
+        for v in data:
+            acc = c[0] * v + c[1] * x1 + c[2] * x2 + c[3] * y1 + c[4] * y2
+            y = sat31(acc >> (31 - shift))
+            x2, x1, y2, y1 = x1, v, y1, y
+            out.append(y)
+        data = out
+    return data
+
+
+def conv(a, b, rshift, satf):
+    n = len(a) + len(b) - 1
+    out = []
+    for i in range(n):
+        acc = 0
+        for k in range(len(a)):
+            if 0 <= i - k < len(b):
+                acc += a[k] * b[i - k]
+        out.append(satf(acc >> rshift))
+    return out
+
+
+def corr(a, b, rshift, satf):
+    """Lags -(len(b) - 1) .. len(a) - 1 placed like the riscv_dsp correlation."""
+    la, lb = len(a), len(b)
+    total = 2 * max(la, lb) - 1
+    out = [0] * total
+    swap = la < lb
+    if swap:
+        a, b, la, lb = b, a, lb, la
+    count = la + lb - 1
+    for i in range(count):
+        acc = 0
+        for j in range(la):
+            if 0 <= lb - 1 - i + j < lb:
+                acc += a[j] * b[lb - 1 - i + j]
+        if swap:
+            out[la + lb - 2 - i] = satf(acc >> rshift)
+        else:
+            out[la - lb + i] = satf(acc >> rshift)
+    return out
+
+
+def isqrt(x):
+    return math.isqrt(x)
+
+
+def hb(v, bits):
+    """Headroom, the values shifted right."""
+    return [x >> bits for x in v]
+
+
+def f32(v):
+    """The value stored in a C float."""
+    return struct.unpack("f", struct.pack("f", v))[0]
+
+
+def dft(x, sign=-1):
+    n = len(x) // 2
+    out = []
+    for k in range(n):
+        re = im = 0.0
+        for t in range(n):
+            a = sign * 2.0 * math.pi * k * t / n
+            xr, xi = x[2 * t], x[2 * t + 1]
+            re += xr * math.cos(a) - xi * math.sin(a)
+            im += xr * math.sin(a) + xi * math.cos(a)
+        out += [re, im]
+    return out
+
+
+def rdft_packed(x):
+    n = len(x)
+    spec = dft([v for s in x for v in (s, 0.0)])
+    out = [spec[0], spec[n]]
+    for k in range(1, n // 2):
+        out += [spec[2 * k], spec[2 * k + 1]]
+    return out
+
+
+def dct2(x):
+    n = len(x)
+    return [sum(x[i] * math.cos(math.pi * (i + 0.5) * k / n) for i in range(n)) for k in range(n)]
+
+
+def dct4(x):
+    n = len(x)
+    return [sum(x[i] * math.cos(math.pi * (i + 0.5) * (k + 0.5) / n) for i in range(n)) for k in range(n)]
+
+
+class Header:
+    def __init__(self):
+        self.lines = []
+
+    def array(self, ctype, name, values, fmt):
+        self.lines.append("static const %s %s[%d] = {" % (ctype, name, len(values)))
+        per_line = 4 if fmt in (f32s, f64s, q63s) else (6 if fmt is q31s else 8)
+        for i in range(0, len(values), per_line):
+            self.lines.append("    " + ", ".join(fmt(v) for v in values[i:i + per_line]) + ",")
+        self.lines.append("};")
+        self.lines.append("")
+
+    def define(self, name, value):
+        self.lines.append("#define %s (%s)" % (name, value))
+
+    def blank(self):
+        self.lines.append("")
+
+
+def q15s(v):
+    return "(q15_t)%d" % v if v == Q15_MIN else "%d" % v
+
+
+def q31s(v):
+    return "(q31_t)0x80000000" if v == Q31_MIN else "%d" % v
+
+
+def q7s(v):
+    return "(q7_t)%d" % v
+
+
+def q63s(v):
+    return "%dLL" % v
+
+
+def u8s(v):
+    return "%d" % v
+
+
+def f32s(v):
+    return "%.9ef" % v
+
+
+def f64s(v):
+    return "%.17e" % v
+
+
+def gen_basic(h, rng, n, a15, b15, a31, b31, a7, b7, ua, ub):
+    h.array("q31_t", "golden_abs_q31", [sat31(abs(x)) for x in a31], q31s)
+    h.array("q15_t", "golden_abs_q15", [sat15(abs(x)) for x in a15], q15s)
+    h.array("q31_t", "golden_add_q31", [sat31(x + y) for x, y in zip(a31, b31)], q31s)
+    h.array("q7_t", "golden_add_q7", [sat7(x + y) for x, y in zip(a7, b7)], q7s)
+    h.array("uint16_t", "golden_add_u8_u16", [x + y for x, y in zip(ua, ub)], u8s)
+    h.array("q15_t", "golden_sub_q15", [sat15(x - y) for x, y in zip(a15, b15)], q15s)
+    h.array("q7_t", "golden_sub_q7", [sat7(x - y) for x, y in zip(a7, b7)], q7s)
+    h.array("q7_t", "golden_sub_u8_q7", [sat7(x - y) for x, y in zip(ua, ub)], q7s)
+    h.array("q7_t", "golden_mul_q7", [sat7((x * y) >> 7) for x, y in zip(a7, b7)], q7s)
+    h.array("uint16_t", "golden_mul_u8_u16", [x * y for x, y in zip(ua, ub)], u8s)
+    h.array("q15_t", "golden_neg_q15", [sat15(-x) for x in a15], q15s)
+    h.array("q7_t", "golden_neg_q7", [sat7(-x) for x in a7], q7s)
+
+    # scalar divisions, with a zero divisor and quotients which saturate
+    num = [Q31_MAX, Q31_MIN, Q31_MIN] + q31_vec(rng, 5)
+    den = [0, 0, -1] + [v >> 4 for v in q31_vec(rng, 5)]
+    den[3] = num[3]
+    h.array("q31_t", "golden_div_num_q31", num, q31s)
+    h.array("q31_t", "golden_div_den_q31", den, q31s)
+    h.array("q31_t", "golden_div_q31",
+            [(Q31_MIN if x < 0 else Q31_MAX) if y == 0 else sat31(tdiv(x << 31, y)) for x, y in zip(num, den)],
+            q31s)
+    num64 = [-(1 << 40), 1 << 40, -(1 << 62), 123456789012]
+    den32 = [0, 3, 7, 1000]
+    h.array("q63_t", "golden_div_num_q63", num64, q63s)
+    h.array("uint32_t", "golden_div_den_u32", den32, u8s)
+    h.array("q31_t", "golden_div_s64_u32",
+            [(Q31_MIN if x < 0 else Q31_MAX) if y == 0 else sat31(tdiv(x, y)) for x, y in zip(num64, den32)], q31s)
+    h.array("q31_t", "golden_div_u64_u32",
+            [Q31_MAX if y == 0 else min((x & 0xFFFFFFFFFFFFFFFF) // y, Q31_MAX) for x, y in zip(num64, den32)], q31s)
+
+    h.define("GOLDEN_DPROD_Q31", q63s(sum((x * y) >> 14 for x, y in zip(a31, b31))))
+    h.define("GOLDEN_DPROD_U8XQ15", sum(x * y for x, y in zip(ua, b15)))
+    h.define("GOLDEN_DPROD_Q7", sum(x * y for x, y in zip(a7, b7)))
+    h.define("GOLDEN_DPROD_Q7XQ15", sum(x * y for x, y in zip(a7, b15)))
+    h.define("GOLDEN_DPROD_U8", "%dU" % sum(x * y for x, y in zip(ua, ub)))
+    h.blank()
+
+    offsets = {"q31": 0x40000000, "q15": -0x4000, "q7": 0x40, "u8": -0x50}
+    for name, value in offsets.items():
+        h.define("GOLDEN_OFFSET_%s" % name.upper(), value)
+    h.blank()
+    h.array("q31_t", "golden_offset_q31", [sat31(x + offsets["q31"]) for x in a31], q31s)
+    h.array("q15_t", "golden_offset_q15", [sat15(x + offsets["q15"]) for x in a15], q15s)
+    h.array("q7_t", "golden_offset_q7", [sat7(x + offsets["q7"]) for x in a7], q7s)
+    h.array("uint8_t", "golden_offset_u8", [satu8(x + offsets["u8"]) for x in ua], u8s)
+
+    # Q15 fract 0.75 with shift 1, Q7 fract -0.5 with shift 2
+    h.define("GOLDEN_SCALE_FRACT_Q15", 0x6000)
+    h.define("GOLDEN_SCALE_FRACT_Q7", -0x40)
+    h.blank()
+    h.array("q15_t", "golden_scale_q15", [sat15((x * 0x6000) >> (15 - 1)) for x in a15], q15s)
+    h.array("q7_t", "golden_scale_q7", [sat7((x * -0x40) >> (7 - 2)) for x in a7], q7s)
+    h.array("uint8_t", "golden_scale_u8", [satu8((x * 0x60) >> (7 - 1)) for x in ua], u8s)
+
+    h.array("q31_t", "golden_shift_left_q31", [sat31(x << 3) for x in a31], q31s)
+    h.array("q31_t", "golden_shift_right_q31", [x >> 2 for x in a31], q31s)
+    h.array("q7_t", "golden_shift_left_q7", [sat7(x << 3) for x in a7], q7s)
+    h.array("q7_t", "golden_shift_right_q7", [x >> 2 for x in a7], q7s)
+    h.array("uint8_t", "golden_shift_left_u8", [satu8(x << 1) for x in ua], u8s)
+    h.array("uint8_t", "golden_shift_right_u8", [x >> 3 for x in ua], u8s)
+
+    h.array("q31_t", "golden_clip_q31", [sat(x, -0x40000000, 0x30000000) for x in a31], q31s)
+    h.array("q15_t", "golden_clip_q15", [sat(x, -0x4000, 0x3000) for x in a15], q15s)
+    h.array("q7_t", "golden_clip_q7", [sat(x, -0x40, 0x30) for x in a7], q7s)
+
+    h.array("uint8_t", "golden_and_u8", [x & y for x, y in zip(ua, ub)], u8s)
+    h.array("uint8_t", "golden_or_u8", [x | y for x, y in zip(ua, ub)], u8s)
+    h.array("uint8_t", "golden_xor_u8", [x ^ y for x, y in zip(ua, ub)], u8s)
+    h.array("uint8_t", "golden_not_u8", [~x & 0xFF for x in ua], u8s)
+
+
+def gen_statistics(h, n, a15, a31, h31, a7, ua):
+    inputs = (("Q15", a15, sat15, q15s), ("Q31", a31, sat31, q31s), ("Q7", a7, sat7, q7s), ("U8", ua, None, u8s))
+    for name, v, satf, fmt in inputs:
+        searches = [("MAX", v, lambda x, y: x > y), ("MIN", v, lambda x, y: x < y)]
+        if satf is not None:
+            av = [satf(abs(x)) for x in v]
+            searches += [("ABSMAX", av, lambda x, y: x > y), ("ABSMIN", av, lambda x, y: x < y)]
+        for op, values, better in searches:
+            if (op, name) == ("MAX", "Q15"):
+                continue
+            res, pos = search(values, better)
+            h.define("GOLDEN_%s_%s" % (op, name), fmt(res))
+            h.define("GOLDEN_%s_%s_INDEX" % (op, name), pos)
+    h.define("GOLDEN_MEAN_Q15", tdiv(sum(a15), n))
+    h.define("GOLDEN_MEAN_Q7", tdiv(sum(a7), n))
+    h.define("GOLDEN_MEAN_U8", sum(ua) // n)
+    pwr31 = sum((x * x) >> 14 for x in h31)
+    h.define("GOLDEN_PWR_Q31", q63s(pwr31))
+    h.define("GOLDEN_PWR_Q7", sum(x * x for x in a7))
+    mean = pwr31 // n
+    h.define("GOLDEN_RMS_Q31", q31s(Q31_MAX if mean >= (1 << 48) else sat31(isqrt(mean << 14))))
+
+    s15 = sum(a15)
+    var15 = sat31(tdiv(sum(x * x for x in a15) - tdiv(s15 * s15, n), n - 1))
+    h.define("GOLDEN_VAR_Q15", q31s(var15))
+    h.define("GOLDEN_STD_Q15", sat15(isqrt(var15)))
+    mean31 = tdiv(sum(h31), n)
+    var31 = tdiv(sum((((x - mean31) >> 1) ** 2) >> 12 for x in h31), n - 1)
+    h.define("GOLDEN_VAR_Q31", q63s(var31))
+    h.define("GOLDEN_STD_Q31", q31s(Q31_MAX if var31 >= (1 << 48) else sat31(isqrt(var31 << 14))))
+    su = sum(ua)
+    varu = ((n * sum(x * x for x in ua) - su * su) << 14) // (n * (n - 1))
+    h.define("GOLDEN_STD_U8", sat15(isqrt(varu)))
+    h.blank()
+
+
+def gen_complex(h, n, ca, cb, a31, b31):
+    half = n // 2
+    h.array("q15_t", "golden_cconj_q15", [sat15(-x) if i & 1 else x for i, x in enumerate(ca)], q15s)
+    h.array("q31_t", "golden_cconj_q31", [sat31(-x) if i & 1 else x for i, x in enumerate(a31)], q31s)
+    cmul = []
+    for i in range(half):
+        ar, ai, br, bi = a31[2 * i], a31[2 * i + 1], b31[2 * i], b31[2 * i + 1]
+        cmul += [((ar * br) >> 33) - ((ai * bi) >> 33), ((ar * bi) >> 33) + ((ai * br) >> 33)]
+    h.array("q31_t", "golden_cmul_q31", cmul, q31s)
+
+    re = sum(ca[2 * i] * cb[2 * i] - ca[2 * i + 1] * cb[2 * i + 1] for i in range(half))
+    im = sum(ca[2 * i] * cb[2 * i + 1] + ca[2 * i + 1] * cb[2 * i] for i in range(half))
+    h.define("GOLDEN_CDPROD_TYP2_RE_Q15", q31s(sat31(re >> 6)))
+    h.define("GOLDEN_CDPROD_TYP2_IM_Q15", q31s(sat31(im >> 6)))
+    re = sum(((a31[2 * i] * b31[2 * i]) >> 14) - ((a31[2 * i + 1] * b31[2 * i + 1]) >> 14) for i in range(half))
+    im = sum(((a31[2 * i] * b31[2 * i + 1]) >> 14) + ((a31[2 * i + 1] * b31[2 * i]) >> 14) for i in range(half))
+    h.define("GOLDEN_CDPROD_TYP2_RE_Q31", q63s(re))
+    h.define("GOLDEN_CDPROD_TYP2_IM_Q31", q63s(im))
+    h.blank()
+
+    h.array("q15_t", "golden_cmag_q15", [isqrt(ca[2 * i] ** 2 + ca[2 * i + 1] ** 2) >> 2 for i in range(half)], q15s)
+    h.array("q31_t", "golden_cmag_q31", [isqrt(a31[2 * i] ** 2 + a31[2 * i + 1] ** 2) >> 2 for i in range(half)],
+            q31s)
+    h.array("q15_t", "golden_cmag_sqr_q15", [(ca[2 * i] ** 2 + ca[2 * i + 1] ** 2) >> 17 for i in range(half)], q15s)
+    h.array("q15_t", "golden_cmul_real_q15", [sat15((x * cb[i // 2]) >> 15) for i, x in enumerate(ca)], q15s)
+    h.array("q31_t", "golden_cmul_real_q31", [sat31((x * b31[i // 2]) >> 31) for i, x in enumerate(a31)], q31s)
+
+
+def gen_filtering(h, rng, n, a15, b15, a31, b31, h31, a7, b7, fir15, fir31, bq, fvec):
+    block = n // 2
+    fir7 = q7_vec(rng, 8)
+    h.array("q7_t", "golden_fir_coeff_q7", fir7, q7s)
+    h.array("q31_t", "golden_fir_fast_q31", fir_prods(a31, fir31, lambda p: wrap(2 * sum(v >> 32 for v in p), 32), block),
+            q31s)
+    h.array("q15_t", "golden_fir_fast_q15", fir_prods(a15, fir15, lambda p: sat15(wrap(sum(p), 32) >> 15), block),
+            q15s)
+    h.array("q7_t", "golden_fir_q7", fir_prods(a7, fir7, lambda p: sat7(sum(p) >> 7), block), q7s)
+
+    # reflection coefficients within +-0.25
+    lk15 = [x >> 2 for x in q15_vec(rng, 4)]
+    lk31 = [x >> 2 for x in q31_vec(rng, 4)]
+    h.array("q15_t", "golden_lfir_coeff_q15", lk15, q15s)
+    h.array("q31_t", "golden_lfir_coeff_q31", lk31, q31s)
+    h.array("q15_t", "golden_lfir_q15", lfir(a15, lk15, sat15, 15), q15s)
+    h.array("q31_t", "golden_lfir_q31", lfir(a31, lk31, sat31, 31), q31s)
+
+    # decimation by 2 and interpolation by 2 with the FIR coefficients
+    h.array("q15_t", "golden_dcmfir_q15", fir_prods(a15, fir15, lambda p: sat15(sum(p) >> 15), block, 2), q15s)
+    h.array("q15_t", "golden_dcmfir_fast_q15", fir_prods(a15, fir15, lambda p: sat15(wrap(sum(p), 32) >> 15), block, 2),
+            q15s)
+    h.array("q31_t", "golden_dcmfir_q31", fir_prods(a31, fir31, lambda p: sat31(sum(p) >> 31), block, 2), q31s)
+    h.array("q31_t", "golden_dcmfir_fast_q31",
+            fir_prods(a31, fir31, lambda p: sat31(wrap(sum(v >> 32 for v in p), 32) * 2), block, 2), q31s)
+    h.array("q15_t", "golden_upsplfir_q15", upsplfir(a15, fir15, 2, lambda p: sat15(sum(p) >> 15), block), q15s)
+    h.array("q31_t", "golden_upsplfir_q31", upsplfir(a31, fir31, 2, lambda p: sat31(sum(p) >> 31), block), q31s)
+
+    # sparse FIR, 4 taps, the Q15 sums are kept in 32 bits
+    delays = [0, 1, 3, 6]
+    sp15 = [x >> 2 for x in q15_vec(rng, 4)]
+    sp31 = q31_vec(rng, 4)
+    sp7 = q7_vec(rng, 4)
+    h.array("int32_t", "golden_spafir_delay", delays, u8s)
+    h.define("GOLDEN_SPAFIR_DELAY", max(delays))
+    h.blank()
+    h.array("q15_t", "golden_spafir_coeff_q15", sp15, q15s)
+    h.array("q31_t", "golden_spafir_coeff_q31", sp31, q31s)
+    h.array("q7_t", "golden_spafir_coeff_q7", sp7, q7s)
+    h.array("q15_t", "golden_spafir_q15", spafir(a15, sp15, delays, lambda p: sat15(sum(p) >> 15)), q15s)
+    h.array("q31_t", "golden_spafir_q31",
+            spafir(a31, sp31, delays, lambda p: sat31(wrap(sum(v >> 32 for v in p), 32) * 2)), q31s)
+    h.array("q7_t", "golden_spafir_q7", spafir(a7, sp7, delays, lambda p: sat7(sum(p) >> 7)), q7s)
+
+    # adaptive filters, 8 taps from zero, 2 or 3 bits of headroom in the input
+    zero = [0] * 8
+    for name, fmt, ctype, res in (
+            ("lms_q31", q31s, "q31_t", lms(h31, hb(b31, 3), zero, 0x20000000, 0, 31, sat31, lambda x: wrap(x, 32))),
+            ("lms_q15", q15s, "q15_t", lms(hb(a15, 2), hb(b15, 2), zero, 0x2000, 0, 15, sat15, lambda x: wrap(x, 16))),
+            ("nlms_q31", q31s, "q31_t",
+             nlms(h31, hb(b31, 3), zero, 0x40000000, 0, 31, sat31, lambda x: wrap(x, 32), 0x100)),
+            ("nlms_q15", q15s, "q15_t",
+             nlms(hb(a15, 2), hb(b15, 2), zero, 0x4000, 0, 15, sat15, lambda x: wrap(x, 16), 5))):
+        h.array(ctype, "golden_%s_out" % name, res[0], fmt)
+        h.array(ctype, "golden_%s_err" % name, res[1], fmt)
+        h.array(ctype, "golden_%s_coeff" % name, res[2], fmt)
+
+    l1, l2 = 12, 7
+    h.array("q31_t", "golden_conv_q31", conv(h31[:l1], b31[:l2], 31, sat31), q31s)
+    h.array("q7_t", "golden_conv_q7", conv(a7[:l1], b7[:l2], 7, sat7), q7s)
+    h.array("q31_t", "golden_corr_q31", corr(h31[:l1], b31[:l2], 31, sat31), q31s)
+    h.array("q7_t", "golden_corr_q7", corr(a7[:l2], b7[:l1], 7, sat7), q7s)
+
+    # a two stage low pass in Q14 (shift 1) for Q15
+    bq15 = []
+    for b0, b1, b2, a1, a2 in ((0.0675, 0.135, 0.0675, 1.143, -0.4128), (0.2, 0.4, 0.2, 0.3, -0.1)):
+        bq15 += [int(round(v * (1 << 14))) for v in (b0, b1, b2, a1, a2)]
+    x31 = hb(a31, 2)
+    x15 = hb(a15, 2)
+    h.array("q15_t", "golden_bq_coeff_q15", bq15, q15s)
+    h.array("q31_t", "golden_bq_fast_q31",
+            bq_df1(x31, bq, 2, lambda p: sat31(wrap(sum(v >> 32 for v in p), 32) << 2)), q31s)
+    h.array("q31_t", "golden_bq_32x64_q31", bq_df1_32x64(x31, bq, 2, 1), q31s)
+    h.array("q15_t", "golden_bq_q15", bq_df1(x15, bq15, 2, lambda p: sat15(sum(p) >> 14)), q15s)
+    h.array("q15_t", "golden_bq_fast_q15", bq_df1(x15, bq15, 2, lambda p: sat15(wrap(sum(p), 32) >> 14)), q15s)
+
+    # lattice IIR, 3 stages, reflection coefficients within +-0.25 and ladder ones within +-0.125
+    rk31 = hb(q31_vec(rng, 3), 2)
+    lv31 = hb(q31_vec(rng, 4), 3)
+    rk15 = hb(q15_vec(rng, 3), 2)
+    lv15 = hb(q15_vec(rng, 4), 3)
+    h.array("q31_t", "golden_liir_rcoeff_q31", rk31, q31s)
+    h.array("q31_t", "golden_liir_lcoeff_q31", lv31, q31s)
+    h.array("q15_t", "golden_liir_rcoeff_q15", rk15, q15s)
+    h.array("q15_t", "golden_liir_lcoeff_q15", lv15, q15s)
+    h.array("q31_t", "golden_liir_q31", liir(x31, rk31, lv31, 31, sat31, block), q31s)
+    h.array("q15_t", "golden_liir_q15", liir(x15, rk15, lv15, 15, sat15, block), q15s)
+
+    # direct form II transposed, the low pass of the Q31 checks in floating point
+    bqf = [f32(v / float(1 << 30)) for v in bq]
+    xf = [f32(v) for v in fvec]
+    h.array("float", "golden_bq_coeff_f32", bqf, f32s)
+    h.array("double", "golden_bq_df2T_f64", bq_df2t(xf, bqf, 2), f64s)
+    h.array("float", "golden_bq_df2T_f32", bq_df2t(xf, bqf, 2), f32s)
+    # stereo, golden_a_f32 read as 16 interleaved pairs
+    left = bq_df2t(xf[0::2], bqf, 2)
+    right = bq_df2t(xf[1::2], bqf, 2)
+    h.array("float", "golden_bq_stereo_df2T_f32", [v for pair in zip(left, right) for v in pair], f32s)
+
+
+def gen_matrix(h, a15, b15, a31, b31, h31, hb31, a7, b7, ua, ca, cb):
+    # 4x8 for the element wise operations, 4x5 by 5x3 for the products
+    h.array("q15_t", "golden_mat_add_q15", [sat15(x + y) for x, y in zip(a15, b15)], q15s)
+    h.array("q31_t", "golden_mat_add_q31", [sat31(x + y) for x, y in zip(a31, b31)], q31s)
+    h.array("q15_t", "golden_mat_sub_q15", [sat15(x - y) for x, y in zip(a15, b15)], q15s)
+    h.array("q31_t", "golden_mat_sub_q31", [sat31(x - y) for x, y in zip(a31, b31)], q31s)
+    h.array("q15_t", "golden_mat_mul_fast_q15", mat_mul(a15, b15, 4, 5, 3, lambda p: sat15(wrap(sum(p), 32) >> 15)),
+            q15s)
+    h.array("q31_t", "golden_mat_mul_q31", mat_mul(h31, b31, 4, 5, 3, lambda p: sat31(sum(p) >> 31)), q31s)
+    h.array("q31_t", "golden_mat_mul_fast_q31",
+            mat_mul(h31, b31, 4, 5, 3, lambda p: sat31(wrap(sum(v >> 32 for v in p), 32) * 2)), q31s)
+    h.array("q7_t", "golden_mat_mul_q7", mat_mul(a7, b7, 4, 5, 3, lambda p: sat7(sum(p) >> 7)), q7s)
+    h.array("q7_t", "golden_mat_mul_vxm_q7", mat_mul(a7, b7, 1, 5, 3, lambda p: sat7(sum(p) >> 7)), q7s)
+    h.array("q15_t", "golden_mat_mul_mxv_q15", mat_mul(a15, b15, 4, 5, 1, lambda p: sat15(sum(p) >> 15)), q15s)
+    h.array("q31_t", "golden_mat_mul_mxv_q31", mat_mul(h31, b31, 4, 5, 1, lambda p: sat31(sum(p) >> 31)), q31s)
+    h.array("q7_t", "golden_mat_mul_mxv_q7", mat_mul(a7, b7, 4, 5, 1, lambda p: sat7(sum(p) >> 7)), q7s)
+    h.array("q15_t", "golden_mat_scale_q15", [sat15((x * 0x6000) >> (15 - 1)) for x in a15], q15s)
+    h.array("q31_t", "golden_mat_scale_q31", [sat31((x * 0x60000000) >> (31 - 1)) for x in a31], q31s)
+
+    def trans(v):
+        return [v[r * 5 + c] for c in range(5) for r in range(4)]
+
+    h.array("q15_t", "golden_mat_trans_q15", trans(a15), q15s)
+    h.array("q31_t", "golden_mat_trans_q31", trans(a31), q31s)
+    h.array("uint8_t", "golden_mat_trans_u8", trans(ua), u8s)
+    h.array("q7_t", "golden_mat_trans_q7", trans(a7), q7s)
+    h.array("q31_t", "golden_mat_oprod_q31", [sat31((x * y) >> 31) for x in a31[:4] for y in b31[:5]], q31s)
+
+    # complex 2x3 by 3x2
+    def cmat(a, b, rshift, satf):
+        res = []
+        for r in range(2):
+            for c in range(2):
+                re = im = 0
+                for k in range(3):
+                    ar, ai = a[2 * (r * 3 + k)], a[2 * (r * 3 + k) + 1]
+                    br, bi = b[2 * (k * 2 + c)], b[2 * (k * 2 + c) + 1]
+                    re += ar * br - ai * bi
+                    im += ar * bi + ai * br
+                res += [satf(re >> rshift), satf(im >> rshift)]
+        return res
+
+    h.array("q15_t", "golden_cmat_mul_q15", cmat(ca, cb, 15, sat15), q15s)
+    h.array("q31_t", "golden_cmat_mul_q31", cmat(h31, hb31, 31, sat31), q31s)
+
+
+def main():
+    out = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), "src", "golden_vectors.h")
+    rng = Lcg(20250101)
+    h = Header()
+
+    n = 32
+    h.define("GOLDEN_VEC_SIZE", n)
+    h.blank()
+
+    # basic
+    a15 = q15_vec(rng, n, (Q15_MAX, Q15_MIN, Q15_MIN, 1))
+    b15 = q15_vec(rng, n, (1, -1, Q15_MIN, Q15_MAX))
+    a31 = q31_vec(rng, n, (Q31_MAX, Q31_MIN, Q31_MIN, 1))
+    b31 = q31_vec(rng, n, (1, -1, Q31_MIN, Q31_MAX))
+    a7 = q7_vec(rng, n, (Q7_MIN, Q7_MAX, -1, 0))
+    h.array("q15_t", "golden_a_q15", a15, q15s)
+    h.array("q15_t", "golden_b_q15", b15, q15s)
+    h.array("q31_t", "golden_a_q31", a31, q31s)
+    h.array("q31_t", "golden_b_q31", b31, q31s)
+    h.array("q7_t", "golden_a_q7", a7, q7s)
+
+    h.array("q15_t", "golden_add_q15", [sat15(x + y) for x, y in zip(a15, b15)], q15s)
+    h.array("q31_t", "golden_sub_q31", [sat31(x - y) for x, y in zip(a31, b31)], q31s)
+    h.array("q15_t", "golden_mul_q15", [sat15((x * y) >> 15) for x, y in zip(a15, b15)], q15s)
+    h.array("q31_t", "golden_mul_q31", [sat31((x * y) >> 31) for x, y in zip(a31, b31)], q31s)
+    h.array("q7_t", "golden_abs_q7", [sat7(abs(x)) for x in a7], q7s)
+    h.array("q15_t", "golden_shift_left_q15", [sat15(x << 3) for x in a15], q15s)
+    h.array("q15_t", "golden_shift_right_q15", [x >> 2 for x in a15], q15s)
+    scalefract, scale_shift = 0x60000000, 1
+    h.define("GOLDEN_SCALE_FRACT", "0x%08X" % scalefract)
+    h.define("GOLDEN_SCALE_SHIFT", scale_shift)
+    h.blank()
+    h.array("q31_t", "golden_scale_q31", [sat31((x * scalefract) >> (31 - scale_shift)) for x in a31], q31s)
+    h.array("q31_t", "golden_neg_q31", [sat31(-x) for x in a31], q31s)
+    h.define("GOLDEN_DPROD_Q15", q63s(sum(x * y for x, y in zip(a15, b15))))
+    h.blank()
+
+    # statistics
+    mx = max(a15)
+    h.define("GOLDEN_MAX_Q15", mx)
+    h.define("GOLDEN_MAX_Q15_INDEX", a15.index(mx))
+    s31 = sum(a31)
+    h.define("GOLDEN_MEAN_Q31", s31 // n if s31 >= 0 else -((-s31) // n))
+    pwr = sum(x * x for x in a15)
+    h.define("GOLDEN_PWR_Q15", q63s(pwr))
+    h.define("GOLDEN_RMS_Q15", sat15(isqrt(pwr // n)))
+    fvec = [rng.uniform() * 4.0 for _ in range(n)]
+    mean = sum(fvec) / n
+    h.define("GOLDEN_VAR_F32", f32s(sum((x - mean) ** 2 for x in fvec) / (n - 1)))
+    h.blank()
+    h.array("float", "golden_a_f32", fvec, f32s)
+
+    # complex, 16 samples
+    ca = q15_vec(rng, n, (Q15_MIN, Q15_MIN, Q15_MAX, Q15_MIN))
+    cb = q15_vec(rng, n, (Q15_MIN, Q15_MAX, Q15_MAX, Q15_MIN))
+    cmul = []
+    for i in range(n // 2):
+        ar, ai, br, bi = ca[2 * i], ca[2 * i + 1], cb[2 * i], cb[2 * i + 1]
+        cmul += [((ar * br) >> 17) - ((ai * bi) >> 17), ((ar * bi) >> 17) + ((ai * br) >> 17)]
+    h.array("q15_t", "golden_ca_q15", ca, q15s)
+    h.array("q15_t", "golden_cb_q15", cb, q15s)
+    h.array("q15_t", "golden_cmul_q15", cmul, q15s)
+    h.array("q31_t", "golden_cmag_sqr_q31",
+            [((a31[2 * i] ** 2) >> 33) + ((a31[2 * i + 1] ** 2) >> 33) for i in range(n // 2)], q31s)
+
+    # filtering, two blocks of 16 samples
+    taps = 8
+    fir15 = q15_vec(rng, taps)
+    # 3 bits of headroom, eight full scale products would overflow the 64-bit accumulator
+    fir31 = [c >> 3 for c in q31_vec(rng, taps)]
+    h.define("GOLDEN_FIR_TAPS", taps)
+    h.define("GOLDEN_FIR_BLOCK", n // 2)
+    h.blank()
+    h.array("q15_t", "golden_fir_coeff_q15", fir15, q15s)
+    h.array("q31_t", "golden_fir_coeff_q31", fir31, q31s)
+    h.array("q15_t", "golden_fir_q15", fir(a15, fir15, 15, sat15, n // 2), q15s)
+    h.array("q31_t", "golden_fir_q31", fir(a31, fir31, 31, sat31, n // 2), q31s)
+
+    # a stable 2 stage low pass in Q30 (shift 1), feedback coefficients negated
+    bq = []
+    for b0, b1, b2, a1, a2 in ((0.0675, 0.135, 0.0675, 1.143, -0.4128), (0.2, 0.4, 0.2, 0.3, -0.1)):
+        bq += [int(round(v * (1 << 30))) for v in (b0, b1, b2, a1, a2)]
+    h.array("q31_t", "golden_bq_coeff_q31", bq, q31s)
+    h.array("q31_t", "golden_bq_q31", bq_df1_q31([x >> 2 for x in a31], bq, 2, 1), q31s)
+
+    l1, l2 = 12, 7
+    h.define("GOLDEN_CONV_LEN1", l1)
+    h.define("GOLDEN_CONV_LEN2", l2)
+    h.blank()
+    h.array("q15_t", "golden_conv_q15", conv(a15[:l1], b15[:l2], 15, sat15), q15s)
+    h.array("q15_t", "golden_corr_q15", corr(a15[:l2], b15[:l1], 15, sat15), q15s)
+
+    # matrix
+    r, c, c2 = 4, 5, 3
+    m1 = a15[:r * c]
+    m2 = b15[:c * c2]
+    mm = []
+    for i in range(r):
+        for j in range(c2):
+            mm.append(sat15(sum(m1[i * c + k] * m2[k * c2 + j] for k in range(c)) >> 15))
+    h.array("q15_t", "golden_mat_mul_q15", mm, q15s)
+
+    # transforms
+    m = 6
+    fft_n = 1 << m
+    cx = [rng.uniform() * 0.5 for _ in range(2 * fft_n)]
+    h.define("GOLDEN_FFT_LOG2", m)
+    h.blank()
+    h.array("float", "golden_fft_in_f32", cx, f32s)
+    h.array("float", "golden_fft_out_f32", dft(cx), f32s)
+    rm = 7
+    rx = [rng.uniform() * 0.5 for _ in range(1 << rm)]
+    h.define("GOLDEN_RFFT_LOG2", rm)
+    h.blank()
+    h.array("float", "golden_rfft_in_f32", rx, f32s)
+    h.array("float", "golden_rfft_out_f32", rdft_packed(rx), f32s)
+    dm = 5
+    dx = [rng.uniform() for _ in range(1 << dm)]
+    h.define("GOLDEN_DCT_LOG2", dm)
+    h.blank()
+    h.array("float", "golden_dct_in_f32", dx, f32s)
+    h.array("float", "golden_dct_out_f32", dct2(dx), f32s)
+    h.array("float", "golden_dct4_out_f32", dct4(dx), f32s)
+
+    # the remaining fixed-point kernels, their inputs are drawn after the ones above
+    b7 = q7_vec(rng, n, (Q7_MIN, Q7_MIN, 1, Q7_MAX))
+    ua = u8_vec(rng, n, (0, 0xFF, 0xFF, 0))
+    ub = u8_vec(rng, n, (0xFF, 0, 0xFF, 0))
+    h.array("q7_t", "golden_b_q7", b7, q7s)
+    h.array("uint8_t", "golden_a_u8", ua, u8s)
+    h.array("uint8_t", "golden_b_u8", ub, u8s)
+    # 3 bits of headroom for the kernels which accumulate Q31 products in 64 bits
+    h31 = [x >> 3 for x in a31]
+    hb31 = [x >> 3 for x in b31]
+    h.array("q31_t", "golden_h_q31", h31, q31s)
+    h.array("q31_t", "golden_hb_q31", hb31, q31s)
+    gen_basic(h, rng, n, a15, b15, a31, b31, a7, b7, ua, ub)
+    gen_statistics(h, n, a15, a31, h31, a7, ua)
+    gen_complex(h, n, ca, cb, a31, b31)
+    gen_filtering(h, rng, n, a15, b15, a31, b31, h31, a7, b7, fir15, fir31, bq, fvec)
+    gen_matrix(h, a15, b15, a31, b31, h31, hb31, a7, b7, ua, ca, cb)
+
+    with open(out, "w") as f:
+        f.write("/*\n * Copyright (c) 2025 HPMicro\n *\n * SPDX-License-Identifier: BSD-3-Clause\n *\n */\n\n")
+        f.write("/* generated by gen_golden.py, do not edit */\n\n")
+        f.write("#ifndef GOLDEN_VECTORS_H\n#define GOLDEN_VECTORS_H\n\n")
+        f.write("#include \"riscv_dsp_math_types.h\"\n\n")
+        f.write("\n".join(h.lines).rstrip() + "\n\n")
+        f.write("#endif /* GOLDEN_VECTORS_H */\n")
+
+
+if __name__ == "__main__":
+    main()
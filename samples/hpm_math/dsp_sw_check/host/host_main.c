@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "dsp_sw_check.h"
+
+uint64_t dsp_sw_check_get_ticks(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+const char *dsp_sw_check_tick_unit(void)
+{
+    return "ns";
+}
+
+int main(void)
+{
+    uint32_t failed;
+
+    printf("riscv_dsp: portable C implementation (host)\n\n");
+    failed = dsp_sw_check_run_golden();
+    printf("\n");
+    dsp_sw_check_run_benchmark();
+    return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,837 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Golden vector checks and a small benchmark for the riscv_dsp API. The code only uses
+ * the riscv_dsp headers and the C library, so it runs on the board against either the
+ * andes library or the portable implementation (HPM_DSP_SW), and on a host against the
+ * portable implementation.
+ *
+ * Every fixed-point kernel is checked. Fixed-point results are compared bit by bit,
+ * floating-point results and transforms within a tolerance.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "riscv_dsp_basic_math.h"
+#include "riscv_dsp_statistics_math.h"
+#include "riscv_dsp_complex_math.h"
+#include "riscv_dsp_filtering_math.h"
+#include "riscv_dsp_matrix_math.h"
+#include "riscv_dsp_transform_math.h"
+#include "dsp_sw_check.h"
+#include "golden_vectors.h"
+
+#define N GOLDEN_VEC_SIZE
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+static uint32_t check_count;
+static uint32_t fail_count;
+
+static void report(const char *name, int32_t ok)
+{
+    check_count++;
+    if (!ok) {
+        fail_count++;
+    }
+    printf("  %-24s %s\n", name, ok ? "PASS" : "FAIL");
+}
+
+#define CHECK_EXACT(name, out, golden) report(name, memcmp(out, golden, sizeof(golden)) == 0)
+
+/* name is the kernel without its riscv_dsp_ prefix */
+#define CHECK_UNARY(name, type, src, out, size, golden)                 \
+    do {                                                                \
+        riscv_dsp_##name((type *)(src), out, size);                     \
+        CHECK_EXACT(#name, out, golden);                                \
+    } while (0)
+
+#define CHECK_BINARY(name, type, src1, src2, out, size, golden)         \
+    do {                                                                \
+        riscv_dsp_##name((type *)(src1), (type *)(src2), out, size);    \
+        CHECK_EXACT(#name, out, golden);                                \
+    } while (0)
+
+#define CHECK_SEARCH(name, src, golden, golden_index)                   \
+    do {                                                                \
+        uint32_t index = 0xFFFFFFFFUL;                                  \
+        int32_t ok = (riscv_dsp_##name(src, N, &index) == (golden));    \
+        report(#name, ok && (index == (golden_index)));                 \
+    } while (0)
+
+static int32_t close_f32(const float *out, const float *golden, uint32_t size, float tol)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        if (fabsf(out[i] - golden[i]) > tol) {
+            printf("    [%u] %f, expected %f\n", (unsigned int)i, (double)out[i], (double)golden[i]);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* fixed-point results against golden * scale */
+static int32_t close_q31(const q31_t *out, const float *golden, uint32_t size, float scale, float tol)
+{
+    static float conv[2 << GOLDEN_RFFT_LOG2];
+    static float ref[2 << GOLDEN_RFFT_LOG2];
+
+    for (uint32_t i = 0; i < size; i++) {
+        conv[i] = (float)out[i] / 2147483648.0f;
+        ref[i] = golden[i] * scale;
+    }
+    return close_f32(conv, ref, size, tol);
+}
+
+static int32_t close_q15(const q15_t *out, const float *golden, uint32_t size, float scale, float tol)
+{
+    static float conv[2 << GOLDEN_RFFT_LOG2];
+    static float ref[2 << GOLDEN_RFFT_LOG2];
+
+    for (uint32_t i = 0; i < size; i++) {
+        conv[i] = (float)out[i] / 32768.0f;
+        ref[i] = golden[i] * scale;
+    }
+    return close_f32(conv, ref, size, tol);
+}
+
+/* scratch buffers, large enough for every check */
+static q31_t buf_q31[4 * N];
+static q31_t buf2_q31[4 * N];
+static q15_t buf_q15[4 * N];
+static q15_t buf2_q15[4 * N];
+static q7_t buf_q7[4 * N];
+static uint8_t buf_u8[4 * N];
+static uint16_t buf_u16[4 * N];
+static float buf_f32[4 * N];
+static double buf_f64[4 * N];
+
+static void check_basic(void)
+{
+    int32_t ok;
+
+    printf("basic\n");
+    CHECK_UNARY(abs_q31, q31_t, golden_a_q31, buf_q31, N, golden_abs_q31);
+    CHECK_UNARY(abs_q15, q15_t, golden_a_q15, buf_q15, N, golden_abs_q15);
+    CHECK_UNARY(abs_q7, q7_t, golden_a_q7, buf_q7, N, golden_abs_q7);
+    CHECK_BINARY(add_q31, q31_t, golden_a_q31, golden_b_q31, buf_q31, N, golden_add_q31);
+    CHECK_BINARY(add_q15, q15_t, golden_a_q15, golden_b_q15, buf_q15, N, golden_add_q15);
+    CHECK_BINARY(add_q7, q7_t, golden_a_q7, golden_b_q7, buf_q7, N, golden_add_q7);
+    CHECK_BINARY(add_u8_u16, uint8_t, golden_a_u8, golden_b_u8, buf_u16, N, golden_add_u8_u16);
+    CHECK_BINARY(sub_q31, q31_t, golden_a_q31, golden_b_q31, buf_q31, N, golden_sub_q31);
+    CHECK_BINARY(sub_q15, q15_t, golden_a_q15, golden_b_q15, buf_q15, N, golden_sub_q15);
+    CHECK_BINARY(sub_q7, q7_t, golden_a_q7, golden_b_q7, buf_q7, N, golden_sub_q7);
+    CHECK_BINARY(sub_u8_q7, uint8_t, golden_a_u8, golden_b_u8, buf_q7, N, golden_sub_u8_q7);
+    CHECK_BINARY(mul_q31, q31_t, golden_a_q31, golden_b_q31, buf_q31, N, golden_mul_q31);
+    CHECK_BINARY(mul_q15, q15_t, golden_a_q15, golden_b_q15, buf_q15, N, golden_mul_q15);
+    CHECK_BINARY(mul_q7, q7_t, golden_a_q7, golden_b_q7, buf_q7, N, golden_mul_q7);
+    CHECK_BINARY(mul_u8_u16, uint8_t, golden_a_u8, golden_b_u8, buf_u16, N, golden_mul_u8_u16);
+    CHECK_UNARY(neg_q31, q31_t, golden_a_q31, buf_q31, N, golden_neg_q31);
+    CHECK_UNARY(neg_q15, q15_t, golden_a_q15, buf_q15, N, golden_neg_q15);
+    CHECK_UNARY(neg_q7, q7_t, golden_a_q7, buf_q7, N, golden_neg_q7);
+
+    ok = 1;
+    for (uint32_t i = 0; i < ARRAY_SIZE(golden_div_q31); i++) {
+        ok &= riscv_dsp_div_q31(golden_div_num_q31[i], golden_div_den_q31[i]) == golden_div_q31[i];
+    }
+    report("div_q31", ok);
+    ok = 1;
+    for (uint32_t i = 0; i < ARRAY_SIZE(golden_div_s64_u32); i++) {
+        ok &= riscv_dsp_div_s64_u32(golden_div_num_q63[i], golden_div_den_u32[i]) == golden_div_s64_u32[i];
+    }
+    report("div_s64_u32", ok);
+    ok = 1;
+    for (uint32_t i = 0; i < ARRAY_SIZE(golden_div_u64_u32); i++) {
+        ok &= riscv_dsp_div_u64_u32((uint64_t)golden_div_num_q63[i], golden_div_den_u32[i]) == golden_div_u64_u32[i];
+    }
+    report("div_u64_u32", ok);
+
+    report("dprod_q31", riscv_dsp_dprod_q31((q31_t *)golden_a_q31, (q31_t *)golden_b_q31, N) == GOLDEN_DPROD_Q31);
+    report("dprod_q15", riscv_dsp_dprod_q15((q15_t *)golden_a_q15, (q15_t *)golden_b_q15, N) == GOLDEN_DPROD_Q15);
+    report("dprod_u8xq15",
+           riscv_dsp_dprod_u8xq15((uint8_t *)golden_a_u8, (q15_t *)golden_b_q15, N) == GOLDEN_DPROD_U8XQ15);
+    report("dprod_q7", riscv_dsp_dprod_q7((q7_t *)golden_a_q7, (q7_t *)golden_b_q7, N) == GOLDEN_DPROD_Q7);
+    report("dprod_q7xq15",
+           riscv_dsp_dprod_q7xq15((q7_t *)golden_a_q7, (q15_t *)golden_b_q15, N) == GOLDEN_DPROD_Q7XQ15);
+    report("dprod_u8", riscv_dsp_dprod_u8((uint8_t *)golden_a_u8, (uint8_t *)golden_b_u8, N) == GOLDEN_DPROD_U8);
+
+    riscv_dsp_offset_q31((q31_t *)golden_a_q31, GOLDEN_OFFSET_Q31, buf_q31, N);
+    CHECK_EXACT("offset_q31", buf_q31, golden_offset_q31);
+    riscv_dsp_offset_q15((q15_t *)golden_a_q15, GOLDEN_OFFSET_Q15, buf_q15, N);
+    CHECK_EXACT("offset_q15", buf_q15, golden_offset_q15);
+    riscv_dsp_offset_q7((q7_t *)golden_a_q7, GOLDEN_OFFSET_Q7, buf_q7, N);
+    CHECK_EXACT("offset_q7", buf_q7, golden_offset_q7);
+    riscv_dsp_offset_u8((uint8_t *)golden_a_u8, GOLDEN_OFFSET_U8, buf_u8, N);
+    CHECK_EXACT("offset_u8", buf_u8, golden_offset_u8);
+
+    riscv_dsp_scale_q31((q31_t *)golden_a_q31, GOLDEN_SCALE_FRACT, GOLDEN_SCALE_SHIFT, buf_q31, N);
+    CHECK_EXACT("scale_q31", buf_q31, golden_scale_q31);
+    riscv_dsp_scale_q15((q15_t *)golden_a_q15, GOLDEN_SCALE_FRACT_Q15, 1, buf_q15, N);
+    CHECK_EXACT("scale_q15", buf_q15, golden_scale_q15);
+    riscv_dsp_scale_q7((q7_t *)golden_a_q7, GOLDEN_SCALE_FRACT_Q7, 2, buf_q7, N);
+    CHECK_EXACT("scale_q7", buf_q7, golden_scale_q7);
+    riscv_dsp_scale_u8((uint8_t *)golden_a_u8, 0x60, 1, buf_u8, N);
+    CHECK_EXACT("scale_u8", buf_u8, golden_scale_u8);
+
+    riscv_dsp_shift_q31((q31_t *)golden_a_q31, 3, buf_q31, N);
+    CHECK_EXACT("shift_q31 left", buf_q31, golden_shift_left_q31);
+    riscv_dsp_shift_q31((q31_t *)golden_a_q31, -2, buf_q31, N);
+    CHECK_EXACT("shift_q31 right", buf_q31, golden_shift_right_q31);
+    riscv_dsp_shift_q15((q15_t *)golden_a_q15, 3, buf_q15, N);
+    CHECK_EXACT("shift_q15 left", buf_q15, golden_shift_left_q15);
+    riscv_dsp_shift_q15((q15_t *)golden_a_q15, -2, buf_q15, N);
+    CHECK_EXACT("shift_q15 right", buf_q15, golden_shift_right_q15);
+    riscv_dsp_shift_q7((q7_t *)golden_a_q7, 3, buf_q7, N);
+    CHECK_EXACT("shift_q7 left", buf_q7, golden_shift_left_q7);
+    riscv_dsp_shift_q7((q7_t *)golden_a_q7, -2, buf_q7, N);
+    CHECK_EXACT("shift_q7 right", buf_q7, golden_shift_right_q7);
+    riscv_dsp_shift_u8((uint8_t *)golden_a_u8, 1, buf_u8, N);
+    CHECK_EXACT("shift_u8 left", buf_u8, golden_shift_left_u8);
+    riscv_dsp_shift_u8((uint8_t *)golden_a_u8, -3, buf_u8, N);
+    CHECK_EXACT("shift_u8 right", buf_u8, golden_shift_right_u8);
+
+    riscv_dsp_clip_q31((q31_t *)golden_a_q31, buf_q31, -0x40000000, 0x30000000, N);
+    CHECK_EXACT("clip_q31", buf_q31, golden_clip_q31);
+    riscv_dsp_clip_q15((q15_t *)golden_a_q15, buf_q15, -0x4000, 0x3000, N);
+    CHECK_EXACT("clip_q15", buf_q15, golden_clip_q15);
+    riscv_dsp_clip_q7((q7_t *)golden_a_q7, buf_q7, -0x40, 0x30, N);
+    CHECK_EXACT("clip_q7", buf_q7, golden_clip_q7);
+
+    CHECK_BINARY(and_u8, uint8_t, golden_a_u8, golden_b_u8, buf_u8, N, golden_and_u8);
+    CHECK_BINARY(or_u8, uint8_t, golden_a_u8, golden_b_u8, buf_u8, N, golden_or_u8);
+    CHECK_BINARY(xor_u8, uint8_t, golden_a_u8, golden_b_u8, buf_u8, N, golden_xor_u8);
+    CHECK_UNARY(not_u8, uint8_t, golden_a_u8, buf_u8, N, golden_not_u8);
+}
+
+static void check_statistics(void)
+{
+    printf("statistics\n");
+    CHECK_SEARCH(max_q31, golden_a_q31, GOLDEN_MAX_Q31, GOLDEN_MAX_Q31_INDEX);
+    CHECK_SEARCH(max_q15, golden_a_q15, GOLDEN_MAX_Q15, GOLDEN_MAX_Q15_INDEX);
+    CHECK_SEARCH(max_q7, golden_a_q7, GOLDEN_MAX_Q7, GOLDEN_MAX_Q7_INDEX);
+    CHECK_SEARCH(max_u8, golden_a_u8, GOLDEN_MAX_U8, GOLDEN_MAX_U8_INDEX);
+    CHECK_SEARCH(min_q31, golden_a_q31, GOLDEN_MIN_Q31, GOLDEN_MIN_Q31_INDEX);
+    CHECK_SEARCH(min_q15, golden_a_q15, GOLDEN_MIN_Q15, GOLDEN_MIN_Q15_INDEX);
+    CHECK_SEARCH(min_q7, golden_a_q7, GOLDEN_MIN_Q7, GOLDEN_MIN_Q7_INDEX);
+    CHECK_SEARCH(min_u8, golden_a_u8, GOLDEN_MIN_U8, GOLDEN_MIN_U8_INDEX);
+    CHECK_SEARCH(absmax_q31, golden_a_q31, GOLDEN_ABSMAX_Q31, GOLDEN_ABSMAX_Q31_INDEX);
+    CHECK_SEARCH(absmax_q15, golden_a_q15, GOLDEN_ABSMAX_Q15, GOLDEN_ABSMAX_Q15_INDEX);
+    CHECK_SEARCH(absmax_q7, golden_a_q7, GOLDEN_ABSMAX_Q7, GOLDEN_ABSMAX_Q7_INDEX);
+    CHECK_SEARCH(absmin_q31, golden_a_q31, GOLDEN_ABSMIN_Q31, GOLDEN_ABSMIN_Q31_INDEX);
+    CHECK_SEARCH(absmin_q15, golden_a_q15, GOLDEN_ABSMIN_Q15, GOLDEN_ABSMIN_Q15_INDEX);
+    CHECK_SEARCH(absmin_q7, golden_a_q7, GOLDEN_ABSMIN_Q7, GOLDEN_ABSMIN_Q7_INDEX);
+    report("mean_q31", riscv_dsp_mean_q31(golden_a_q31, N) == GOLDEN_MEAN_Q31);
+    report("mean_q15", riscv_dsp_mean_q15(golden_a_q15, N) == GOLDEN_MEAN_Q15);
+    report("mean_q7", riscv_dsp_mean_q7(golden_a_q7, N) == GOLDEN_MEAN_Q7);
+    report("mean_u8", riscv_dsp_mean_u8(golden_a_u8, N) == GOLDEN_MEAN_U8);
+    /* the Q31 statistics of the input with headroom, so they don't saturate */
+    report("pwr_q31", riscv_dsp_pwr_q31(golden_h_q31, N) == GOLDEN_PWR_Q31);
+    report("pwr_q15", riscv_dsp_pwr_q15(golden_a_q15, N) == GOLDEN_PWR_Q15);
+    report("pwr_q7", riscv_dsp_pwr_q7(golden_a_q7, N) == GOLDEN_PWR_Q7);
+    report("rms_q31", riscv_dsp_rms_q31(golden_h_q31, N) == GOLDEN_RMS_Q31);
+    report("rms_q15", riscv_dsp_rms_q15(golden_a_q15, N) == GOLDEN_RMS_Q15);
+    report("var_q31", riscv_dsp_var_q31(golden_h_q31, N) == GOLDEN_VAR_Q31);
+    report("var_q15", riscv_dsp_var_q15(golden_a_q15, N) == GOLDEN_VAR_Q15);
+    report("var_f32", fabsf(riscv_dsp_var_f32(golden_a_f32, N) - GOLDEN_VAR_F32) < 1e-4f);
+    report("std_q31", riscv_dsp_std_q31(golden_h_q31, N) == GOLDEN_STD_Q31);
+    report("std_q15", riscv_dsp_std_q15(golden_a_q15, N) == GOLDEN_STD_Q15);
+    report("std_u8", riscv_dsp_std_u8(golden_a_u8, N) == GOLDEN_STD_U8);
+}
+
+static void check_complex(void)
+{
+    q31_t re_q31;
+    q31_t im_q31;
+    q63_t re_q63;
+    q63_t im_q63;
+
+    printf("complex\n");
+    riscv_dsp_cconj_q31(golden_a_q31, buf_q31, N / 2);
+    CHECK_EXACT("cconj_q31", buf_q31, golden_cconj_q31);
+    riscv_dsp_cconj_q15(golden_ca_q15, buf_q15, N / 2);
+    CHECK_EXACT("cconj_q15", buf_q15, golden_cconj_q15);
+    riscv_dsp_cmul_q31(golden_a_q31, golden_b_q31, buf_q31, N / 2);
+    CHECK_EXACT("cmul_q31", buf_q31, golden_cmul_q31);
+    riscv_dsp_cmul_q15(golden_ca_q15, golden_cb_q15, buf_q15, N / 2);
+    CHECK_EXACT("cmul_q15", buf_q15, golden_cmul_q15);
+    /* the element wise products of cdprod are those of cmul */
+    riscv_dsp_cdprod_q31(golden_a_q31, golden_b_q31, N / 2, buf_q31);
+    CHECK_EXACT("cdprod_q31", buf_q31, golden_cmul_q31);
+    riscv_dsp_cdprod_q15(golden_ca_q15, golden_cb_q15, N / 2, buf_q15);
+    CHECK_EXACT("cdprod_q15", buf_q15, golden_cmul_q15);
+    riscv_dsp_cdprod_typ2_q31(golden_a_q31, golden_b_q31, N / 2, &re_q63, &im_q63);
+    report("cdprod_typ2_q31", (re_q63 == GOLDEN_CDPROD_TYP2_RE_Q31) && (im_q63 == GOLDEN_CDPROD_TYP2_IM_Q31));
+    riscv_dsp_cdprod_typ2_q15(golden_ca_q15, golden_cb_q15, N / 2, &re_q31, &im_q31);
+    report("cdprod_typ2_q15", (re_q31 == GOLDEN_CDPROD_TYP2_RE_Q15) && (im_q31 == GOLDEN_CDPROD_TYP2_IM_Q15));
+    riscv_dsp_cmag_q31(golden_a_q31, buf_q31, N / 2);
+    CHECK_EXACT("cmag_q31", buf_q31, golden_cmag_q31);
+    riscv_dsp_cmag_q15(golden_ca_q15, buf_q15, N / 2);
+    CHECK_EXACT("cmag_q15", buf_q15, golden_cmag_q15);
+    riscv_dsp_cmag_sqr_q31(golden_a_q31, buf_q31, N / 2);
+    CHECK_EXACT("cmag_sqr_q31", buf_q31, golden_cmag_sqr_q31);
+    riscv_dsp_cmag_sqr_q15(golden_ca_q15, buf_q15, N / 2);
+    CHECK_EXACT("cmag_sqr_q15", buf_q15, golden_cmag_sqr_q15);
+    riscv_dsp_cmul_real_q31(golden_a_q31, golden_b_q31, buf_q31, N / 2);
+    CHECK_EXACT("cmul_real_q31", buf_q31, golden_cmul_real_q31);
+    riscv_dsp_cmul_real_q15(golden_ca_q15, golden_cb_q15, buf_q15, N / 2);
+    CHECK_EXACT("cmul_real_q15", buf_q15, golden_cmul_real_q15);
+}
+
+/* FIR style filters: two blocks, the second one depends on the state left by the first */
+#define GOLDEN_BLOCKS(call)                                                 \
+    do {                                                                    \
+        for (uint32_t b = 0; b < N; b += GOLDEN_FIR_BLOCK) {                \
+            call;                                                           \
+        }                                                                   \
+    } while (0)
+
+static void check_fir(void)
+{
+    q31_t state_q31[GOLDEN_FIR_TAPS + GOLDEN_FIR_BLOCK - 1];
+    q15_t state_q15[GOLDEN_FIR_TAPS + GOLDEN_FIR_BLOCK - 1];
+    q7_t state_q7[GOLDEN_FIR_TAPS + GOLDEN_FIR_BLOCK - 1];
+    riscv_dsp_fir_q31_t fir_q31 = {GOLDEN_FIR_TAPS, state_q31, (q31_t *)golden_fir_coeff_q31};
+    riscv_dsp_fir_q15_t fir_q15 = {GOLDEN_FIR_TAPS, state_q15, (q15_t *)golden_fir_coeff_q15};
+    riscv_dsp_fir_q7_t fir_q7 = {GOLDEN_FIR_TAPS, state_q7, (q7_t *)golden_fir_coeff_q7};
+    riscv_dsp_lfir_q31_t lfir_q31 = {ARRAY_SIZE(golden_lfir_coeff_q31), state_q31, (q31_t *)golden_lfir_coeff_q31};
+    riscv_dsp_lfir_q15_t lfir_q15 = {ARRAY_SIZE(golden_lfir_coeff_q15), state_q15, (q15_t *)golden_lfir_coeff_q15};
+    riscv_dsp_dcmfir_q31_t dcm_q31 = {2, GOLDEN_FIR_TAPS, (q31_t *)golden_fir_coeff_q31, state_q31};
+    riscv_dsp_dcmfir_q15_t dcm_q15 = {2, GOLDEN_FIR_TAPS, (q15_t *)golden_fir_coeff_q15, state_q15};
+    riscv_dsp_upsplfir_q31_t up_q31 = {2, GOLDEN_FIR_TAPS / 2, (q31_t *)golden_fir_coeff_q31, state_q31};
+    riscv_dsp_upsplfir_q15_t up_q15 = {2, GOLDEN_FIR_TAPS / 2, (q15_t *)golden_fir_coeff_q15, state_q15};
+
+#define FIR_RUN(fn, inst, state, src, dst)                                                  \
+    do {                                                                                    \
+        memset(state, 0, sizeof(state));                                                    \
+        GOLDEN_BLOCKS(fn(&(inst), (void *)&(src)[b], &(dst)[b], GOLDEN_FIR_BLOCK));         \
+    } while (0)
+
+    FIR_RUN(riscv_dsp_fir_q31, fir_q31, state_q31, golden_a_q31, buf_q31);
+    CHECK_EXACT("fir_q31", buf_q31, golden_fir_q31);
+    FIR_RUN(riscv_dsp_fir_fast_q31, fir_q31, state_q31, golden_a_q31, buf_q31);
+    CHECK_EXACT("fir_fast_q31", buf_q31, golden_fir_fast_q31);
+    FIR_RUN(riscv_dsp_fir_q15, fir_q15, state_q15, golden_a_q15, buf_q15);
+    CHECK_EXACT("fir_q15", buf_q15, golden_fir_q15);
+    FIR_RUN(riscv_dsp_fir_fast_q15, fir_q15, state_q15, golden_a_q15, buf_q15);
+    CHECK_EXACT("fir_fast_q15", buf_q15, golden_fir_fast_q15);
+    FIR_RUN(riscv_dsp_fir_q7, fir_q7, state_q7, golden_a_q7, buf_q7);
+    CHECK_EXACT("fir_q7", buf_q7, golden_fir_q7);
+    FIR_RUN(riscv_dsp_lfir_q31, lfir_q31, state_q31, golden_a_q31, buf_q31);
+    CHECK_EXACT("lfir_q31", buf_q31, golden_lfir_q31);
+    FIR_RUN(riscv_dsp_lfir_q15, lfir_q15, state_q15, golden_a_q15, buf_q15);
+    CHECK_EXACT("lfir_q15", buf_q15, golden_lfir_q15);
+#undef FIR_RUN
+
+    /* decimation by 2 writes half a block, interpolation by 2 two blocks */
+#define FIR_RUN_RATE(fn, inst, state, src, dst, num, den)                                               \
+    do {                                                                                                \
+        memset(state, 0, sizeof(state));                                                                \
+        GOLDEN_BLOCKS(fn(&(inst), (void *)&(src)[b], &(dst)[b * (num) / (den)], GOLDEN_FIR_BLOCK));     \
+    } while (0)
+
+    FIR_RUN_RATE(riscv_dsp_dcmfir_q31, dcm_q31, state_q31, golden_a_q31, buf_q31, 1, 2);
+    CHECK_EXACT("dcmfir_q31", buf_q31, golden_dcmfir_q31);
+    FIR_RUN_RATE(riscv_dsp_dcmfir_fast_q31, dcm_q31, state_q31, golden_a_q31, buf_q31, 1, 2);
+    CHECK_EXACT("dcmfir_fast_q31", buf_q31, golden_dcmfir_fast_q31);
+    FIR_RUN_RATE(riscv_dsp_dcmfir_q15, dcm_q15, state_q15, golden_a_q15, buf_q15, 1, 2);
+    CHECK_EXACT("dcmfir_q15", buf_q15, golden_dcmfir_q15);
+    FIR_RUN_RATE(riscv_dsp_dcmfir_fast_q15, dcm_q15, state_q15, golden_a_q15, buf_q15, 1, 2);
+    CHECK_EXACT("dcmfir_fast_q15", buf_q15, golden_dcmfir_fast_q15);
+    FIR_RUN_RATE(riscv_dsp_upsplfir_q31, up_q31, state_q31, golden_a_q31, buf_q31, 2, 1);
+    CHECK_EXACT("upsplfir_q31", buf_q31, golden_upsplfir_q31);
+    FIR_RUN_RATE(riscv_dsp_upsplfir_q15, up_q15, state_q15, golden_a_q15, buf_q15, 2, 1);
+    CHECK_EXACT("upsplfir_q15", buf_q15, golden_upsplfir_q15);
+#undef FIR_RUN_RATE
+}
+
+static void check_spafir(void)
+{
+    q31_t state_q31[GOLDEN_SPAFIR_DELAY + GOLDEN_FIR_BLOCK] = {0};
+    q15_t state_q15[GOLDEN_SPAFIR_DELAY + GOLDEN_FIR_BLOCK] = {0};
+    q7_t state_q7[GOLDEN_SPAFIR_DELAY + GOLDEN_FIR_BLOCK] = {0};
+    int32_t *delay = (int32_t *)golden_spafir_delay;
+    riscv_dsp_spafir_q31_t sp_q31 = {ARRAY_SIZE(golden_spafir_delay), 0, state_q31, (q31_t *)golden_spafir_coeff_q31,
+                                     GOLDEN_SPAFIR_DELAY, delay};
+    riscv_dsp_spafir_q15_t sp_q15 = {ARRAY_SIZE(golden_spafir_delay), 0, state_q15, (q15_t *)golden_spafir_coeff_q15,
+                                     GOLDEN_SPAFIR_DELAY, delay};
+    riscv_dsp_spafir_q7_t sp_q7 = {ARRAY_SIZE(golden_spafir_delay), 0, state_q7, (q7_t *)golden_spafir_coeff_q7,
+                                   GOLDEN_SPAFIR_DELAY, delay};
+
+    GOLDEN_BLOCKS(riscv_dsp_spafir_q31(&sp_q31, (q31_t *)&golden_a_q31[b], &buf_q31[b], buf2_q31, GOLDEN_FIR_BLOCK));
+    CHECK_EXACT("spafir_q31", buf_q31, golden_spafir_q31);
+    GOLDEN_BLOCKS(riscv_dsp_spafir_q15(&sp_q15, (q15_t *)&golden_a_q15[b], &buf_q15[b], buf2_q15, buf2_q31,
+                                       GOLDEN_FIR_BLOCK));
+    CHECK_EXACT("spafir_q15", buf_q15, golden_spafir_q15);
+    GOLDEN_BLOCKS(riscv_dsp_spafir_q7(&sp_q7, (q7_t *)&golden_a_q7[b], &buf_q7[b], &buf_q7[2 * N], buf2_q31,
+                                      GOLDEN_FIR_BLOCK));
+    CHECK_EXACT("spafir_q7", buf_q7, golden_spafir_q7);
+}
+
+static void check_adaptive(void)
+{
+    static q31_t in_q31[N];
+    static q31_t ref_q31[N];
+    static q15_t in_q15[N];
+    static q15_t ref_q15[N];
+    q31_t state_q31[GOLDEN_FIR_TAPS + GOLDEN_FIR_BLOCK - 1] = {0};
+    q15_t state_q15[GOLDEN_FIR_TAPS + GOLDEN_FIR_BLOCK - 1] = {0};
+    q31_t coeff_q31[GOLDEN_FIR_TAPS] = {0};
+    q15_t coeff_q15[GOLDEN_FIR_TAPS] = {0};
+    riscv_dsp_lms_q31_t lms_q31 = {GOLDEN_FIR_TAPS, state_q31, coeff_q31, 0x20000000, 0};
+    riscv_dsp_lms_q15_t lms_q15 = {GOLDEN_FIR_TAPS, state_q15, coeff_q15, 0x2000, 0};
+    riscv_dsp_nlms_q31_t nlms_q31 = {GOLDEN_FIR_TAPS, state_q31, coeff_q31, 0x40000000, 0, 0, 0};
+    riscv_dsp_nlms_q15_t nlms_q15 = {GOLDEN_FIR_TAPS, state_q15, coeff_q15, 0x4000, 0, 0, 0};
+
+    /* 3 bits of headroom in Q31, 2 in Q15 */
+    for (uint32_t i = 0; i < N; i++) {
+        in_q31[i] = golden_h_q31[i];
+        ref_q31[i] = golden_hb_q31[i];
+        in_q15[i] = golden_a_q15[i] >> 2;
+        ref_q15[i] = golden_b_q15[i] >> 2;
+    }
+
+#define ADAPTIVE_RUN(fn, inst, state, coeff, in, ref, out, err)                                         \
+    do {                                                                                                \
+        memset(state, 0, sizeof(state));                                                                \
+        memset(coeff, 0, sizeof(coeff));                                                                \
+        GOLDEN_BLOCKS(fn(&(inst), &(in)[b], &(ref)[b], &(out)[b], &(err)[b], GOLDEN_FIR_BLOCK));        \
+    } while (0)
+
+    ADAPTIVE_RUN(riscv_dsp_lms_q31, lms_q31, state_q31, coeff_q31, in_q31, ref_q31, buf_q31, buf2_q31);
+    report("lms_q31", (memcmp(buf_q31, golden_lms_q31_out, sizeof(golden_lms_q31_out)) == 0) &&
+                          (memcmp(buf2_q31, golden_lms_q31_err, sizeof(golden_lms_q31_err)) == 0) &&
+                          (memcmp(coeff_q31, golden_lms_q31_coeff, sizeof(golden_lms_q31_coeff)) == 0));
+    ADAPTIVE_RUN(riscv_dsp_lms_q15, lms_q15, state_q15, coeff_q15, in_q15, ref_q15, buf_q15, buf2_q15);
+    report("lms_q15", (memcmp(buf_q15, golden_lms_q15_out, sizeof(golden_lms_q15_out)) == 0) &&
+                          (memcmp(buf2_q15, golden_lms_q15_err, sizeof(golden_lms_q15_err)) == 0) &&
+                          (memcmp(coeff_q15, golden_lms_q15_coeff, sizeof(golden_lms_q15_coeff)) == 0));
+    ADAPTIVE_RUN(riscv_dsp_nlms_q31, nlms_q31, state_q31, coeff_q31, in_q31, ref_q31, buf_q31, buf2_q31);
+    report("nlms_q31", (memcmp(buf_q31, golden_nlms_q31_out, sizeof(golden_nlms_q31_out)) == 0) &&
+                           (memcmp(buf2_q31, golden_nlms_q31_err, sizeof(golden_nlms_q31_err)) == 0) &&
+                           (memcmp(coeff_q31, golden_nlms_q31_coeff, sizeof(golden_nlms_q31_coeff)) == 0));
+    ADAPTIVE_RUN(riscv_dsp_nlms_q15, nlms_q15, state_q15, coeff_q15, in_q15, ref_q15, buf_q15, buf2_q15);
+    report("nlms_q15", (memcmp(buf_q15, golden_nlms_q15_out, sizeof(golden_nlms_q15_out)) == 0) &&
+                           (memcmp(buf2_q15, golden_nlms_q15_err, sizeof(golden_nlms_q15_err)) == 0) &&
+                           (memcmp(coeff_q15, golden_nlms_q15_coeff, sizeof(golden_nlms_q15_coeff)) == 0));
+#undef ADAPTIVE_RUN
+}
+
+static void check_conv(void)
+{
+    const uint32_t len = GOLDEN_CONV_LEN1 + GOLDEN_CONV_LEN2 - 1;
+    const uint32_t start = 4;
+    const uint32_t size = 10;
+    int32_t ok;
+
+    riscv_dsp_conv_q31((q31_t *)golden_h_q31, GOLDEN_CONV_LEN1, (q31_t *)golden_b_q31, GOLDEN_CONV_LEN2, buf_q31);
+    CHECK_EXACT("conv_q31", buf_q31, golden_conv_q31);
+    riscv_dsp_conv_q15((q15_t *)golden_a_q15, GOLDEN_CONV_LEN1, (q15_t *)golden_b_q15, GOLDEN_CONV_LEN2, buf_q15);
+    CHECK_EXACT("conv_q15", buf_q15, golden_conv_q15);
+    riscv_dsp_conv_q7((q7_t *)golden_a_q7, GOLDEN_CONV_LEN1, (q7_t *)golden_b_q7, GOLDEN_CONV_LEN2, buf_q7);
+    CHECK_EXACT("conv_q7", buf_q7, golden_conv_q7);
+
+    /* the outputs start .. start + size - 1 of the full convolution, a range beyond its end is refused */
+    memset(buf_q31, 0, sizeof(buf_q31));
+    ok = riscv_dsp_conv_partial_q31((q31_t *)golden_h_q31, GOLDEN_CONV_LEN1, (q31_t *)golden_b_q31, GOLDEN_CONV_LEN2,
+                                    buf_q31, start, size) == 0;
+    ok &= memcmp(&buf_q31[start], &golden_conv_q31[start], size * sizeof(q31_t)) == 0;
+    ok &= riscv_dsp_conv_partial_q31((q31_t *)golden_h_q31, GOLDEN_CONV_LEN1, (q31_t *)golden_b_q31, GOLDEN_CONV_LEN2,
+                                     buf_q31, start, len) != 0;
+    report("conv_partial_q31", ok);
+    memset(buf_q15, 0, sizeof(buf_q15));
+    ok = riscv_dsp_conv_partial_q15((q15_t *)golden_a_q15, GOLDEN_CONV_LEN1, (q15_t *)golden_b_q15, GOLDEN_CONV_LEN2,
+                                    buf_q15, start, size) == 0;
+    ok &= memcmp(&buf_q15[start], &golden_conv_q15[start], size * sizeof(q15_t)) == 0;
+    ok &= riscv_dsp_conv_partial_q15((q15_t *)golden_a_q15, GOLDEN_CONV_LEN1, (q15_t *)golden_b_q15, GOLDEN_CONV_LEN2,
+                                     buf_q15, start, len) != 0;
+    report("conv_partial_q15", ok);
+    memset(buf_q7, 0, sizeof(buf_q7));
+    ok = riscv_dsp_conv_partial_q7((q7_t *)golden_a_q7, GOLDEN_CONV_LEN1, (q7_t *)golden_b_q7, GOLDEN_CONV_LEN2,
+                                   buf_q7, start, size) == 0;
+    ok &= memcmp(&buf_q7[start], &golden_conv_q7[start], size * sizeof(q7_t)) == 0;
+    ok &= riscv_dsp_conv_partial_q7((q7_t *)golden_a_q7, GOLDEN_CONV_LEN1, (q7_t *)golden_b_q7, GOLDEN_CONV_LEN2,
+                                    buf_q7, start, len) != 0;
+    report("conv_partial_q7", ok);
+
+    /* the longer input first for Q31, second for Q15 and Q7 */
+    riscv_dsp_corr_q31((q31_t *)golden_h_q31, GOLDEN_CONV_LEN1, (q31_t *)golden_b_q31, GOLDEN_CONV_LEN2, buf_q31);
+    CHECK_EXACT("corr_q31", buf_q31, golden_corr_q31);
+    riscv_dsp_corr_q15((q15_t *)golden_a_q15, GOLDEN_CONV_LEN2, (q15_t *)golden_b_q15, GOLDEN_CONV_LEN1, buf_q15);
+    CHECK_EXACT("corr_q15", buf_q15, golden_corr_q15);
+    riscv_dsp_corr_q7((q7_t *)golden_a_q7, GOLDEN_CONV_LEN2, (q7_t *)golden_b_q7, GOLDEN_CONV_LEN1, buf_q7);
+    CHECK_EXACT("corr_q7", buf_q7, golden_corr_q7);
+}
+
+static void check_iir(void)
+{
+    static q31_t in_q31[N];
+    static q15_t in_q15[N];
+    q31_t state_q31[4 * 2];
+    q63_t state_q63[4 * 2];
+    q15_t state_q15[4 * 2];
+    q31_t liir_state_q31[ARRAY_SIZE(golden_liir_rcoeff_q31) + GOLDEN_FIR_BLOCK];
+    q15_t liir_state_q15[ARRAY_SIZE(golden_liir_rcoeff_q15) + GOLDEN_FIR_BLOCK];
+    float state_f32[4 * 2];
+    double state_f64[2 * 2];
+    static double coeff_f64[5 * 2];
+    static double in_f64[N];
+    riscv_dsp_bq_df1_q31_t bq_q31 = {2, state_q31, (q31_t *)golden_bq_coeff_q31, 1};
+    riscv_dsp_bq_df1_32x64_q31_t bq_32x64 = {2, state_q63, (q31_t *)golden_bq_coeff_q31, 1};
+    riscv_dsp_bq_df1_q15_t bq_q15 = {2, state_q15, (q15_t *)golden_bq_coeff_q15, 1};
+    riscv_dsp_liir_q31_t liir_q31 = {ARRAY_SIZE(golden_liir_rcoeff_q31), liir_state_q31,
+                                     (q31_t *)golden_liir_rcoeff_q31, (q31_t *)golden_liir_lcoeff_q31};
+    riscv_dsp_liir_q15_t liir_q15 = {ARRAY_SIZE(golden_liir_rcoeff_q15), liir_state_q15,
+                                     (q15_t *)golden_liir_rcoeff_q15, (q15_t *)golden_liir_lcoeff_q15};
+    riscv_dsp_bq_df2T_f32_t df2T_f32 = {2, state_f32, (float *)golden_bq_coeff_f32};
+    riscv_dsp_bq_df2T_f64_t df2T_f64 = {2, state_f64, coeff_f64};
+    riscv_dsp_bq_stereo_df2T_f32_t stereo_f32 = {2, state_f32, (float *)golden_bq_coeff_f32};
+    int32_t ok;
+
+    /* 2 bits of headroom for the gain of the filters */
+    for (uint32_t i = 0; i < N; i++) {
+        in_q31[i] = golden_a_q31[i] >> 2;
+        in_q15[i] = golden_a_q15[i] >> 2;
+        in_f64[i] = golden_a_f32[i];
+    }
+    for (uint32_t i = 0; i < ARRAY_SIZE(coeff_f64); i++) {
+        coeff_f64[i] = golden_bq_coeff_f32[i];
+    }
+
+    memset(state_q31, 0, sizeof(state_q31));
+    riscv_dsp_bq_df1_q31(&bq_q31, in_q31, buf_q31, N);
+    CHECK_EXACT("bq_df1_q31", buf_q31, golden_bq_q31);
+    memset(state_q31, 0, sizeof(state_q31));
+    riscv_dsp_bq_df1_fast_q31(&bq_q31, in_q31, buf_q31, N);
+    CHECK_EXACT("bq_df1_fast_q31", buf_q31, golden_bq_fast_q31);
+    memset(state_q63, 0, sizeof(state_q63));
+    riscv_dsp_bq_df1_32x64_q31(&bq_32x64, in_q31, buf_q31, N);
+    CHECK_EXACT("bq_df1_32x64_q31", buf_q31, golden_bq_32x64_q31);
+    memset(state_q15, 0, sizeof(state_q15));
+    riscv_dsp_bq_df1_q15(&bq_q15, in_q15, buf_q15, N);
+    CHECK_EXACT("bq_df1_q15", buf_q15, golden_bq_q15);
+    memset(state_q15, 0, sizeof(state_q15));
+    riscv_dsp_bq_df1_fast_q15(&bq_q15, in_q15, buf_q15, N);
+    CHECK_EXACT("bq_df1_fast_q15", buf_q15, golden_bq_fast_q15);
+
+    memset(liir_state_q31, 0, sizeof(liir_state_q31));
+    GOLDEN_BLOCKS(riscv_dsp_liir_q31(&liir_q31, &in_q31[b], &buf_q31[b], GOLDEN_FIR_BLOCK));
+    CHECK_EXACT("liir_q31", buf_q31, golden_liir_q31);
+    memset(liir_state_q31, 0, sizeof(liir_state_q31));
+    GOLDEN_BLOCKS(riscv_dsp_liir_fast_q31(&liir_q31, &in_q31[b], &buf_q31[b], GOLDEN_FIR_BLOCK));
+    CHECK_EXACT("liir_fast_q31", buf_q31, golden_liir_q31);
+    memset(liir_state_q15, 0, sizeof(liir_state_q15));
+    GOLDEN_BLOCKS(riscv_dsp_liir_q15(&liir_q15, &in_q15[b], &buf_q15[b], GOLDEN_FIR_BLOCK));
+    CHECK_EXACT("liir_q15", buf_q15, golden_liir_q15);
+    memset(liir_state_q15, 0, sizeof(liir_state_q15));
+    GOLDEN_BLOCKS(riscv_dsp_liir_fast_q15(&liir_q15, &in_q15[b], &buf_q15[b], GOLDEN_FIR_BLOCK));
+    CHECK_EXACT("liir_fast_q15", buf_q15, golden_liir_q15);
+
+    /* the floating-point low pass, in two blocks as well */
+    memset(state_f32, 0, sizeof(state_f32));
+    GOLDEN_BLOCKS(riscv_dsp_bq_df2T_f32(&df2T_f32, (float *)&golden_a_f32[b], &buf_f32[b], GOLDEN_FIR_BLOCK));
+    report("bq_df2T_f32", close_f32(buf_f32, golden_bq_df2T_f32, N, 1e-5f));
+    memset(state_f64, 0, sizeof(state_f64));
+    GOLDEN_BLOCKS(riscv_dsp_bq_df2T_f64(&df2T_f64, &in_f64[b], &buf_f64[b], GOLDEN_FIR_BLOCK));
+    ok = 1;
+    for (uint32_t i = 0; i < N; i++) {
+        ok &= fabs(buf_f64[i] - golden_bq_df2T_f64[i]) < 1e-12;
+    }
+    report("bq_df2T_f64", ok);
+    memset(state_f32, 0, sizeof(state_f32));
+    riscv_dsp_bq_stereo_df2T_f32(&stereo_f32, (float *)golden_a_f32, buf_f32, N / 2);
+    report("bq_stereo_df2T_f32", close_f32(buf_f32, golden_bq_stereo_df2T_f32, N, 1e-5f));
+}
+
+static void check_filtering(void)
+{
+    printf("filtering\n");
+    check_fir();
+    check_spafir();
+    check_adaptive();
+    check_conv();
+    check_iir();
+}
+
+static void check_matrix(void)
+{
+    float a[3 * 3] = {4.0f, 7.0f, 2.0f, 3.0f, 6.0f, 1.0f, 2.0f, 5.0f, 3.0f};
+    float inv[3 * 3];
+    float unity[3 * 3] = {1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+    float copy[3 * 3];
+
+    printf("matrix\n");
+    riscv_dsp_mat_add_q15(golden_a_q15, golden_b_q15, buf_q15, 4, 8);
+    CHECK_EXACT("mat_add_q15", buf_q15, golden_mat_add_q15);
+    riscv_dsp_mat_add_q31(golden_a_q31, golden_b_q31, buf_q31, 4, 8);
+    CHECK_EXACT("mat_add_q31", buf_q31, golden_mat_add_q31);
+    riscv_dsp_mat_sub_q15(golden_a_q15, golden_b_q15, buf_q15, 4, 8);
+    CHECK_EXACT("mat_sub_q15", buf_q15, golden_mat_sub_q15);
+    riscv_dsp_mat_sub_q31(golden_a_q31, golden_b_q31, buf_q31, 4, 8);
+    CHECK_EXACT("mat_sub_q31", buf_q31, golden_mat_sub_q31);
+
+    riscv_dsp_mat_mul_q15(golden_a_q15, golden_b_q15, buf_q15, 4, 5, 3);
+    CHECK_EXACT("mat_mul_q15", buf_q15, golden_mat_mul_q15);
+    riscv_dsp_mat_mul_fast_q15(golden_a_q15, golden_b_q15, buf_q15, 4, 5, 3);
+    CHECK_EXACT("mat_mul_fast_q15", buf_q15, golden_mat_mul_fast_q15);
+    riscv_dsp_mat_mul_q31(golden_h_q31, golden_b_q31, buf_q31, 4, 5, 3);
+    CHECK_EXACT("mat_mul_q31", buf_q31, golden_mat_mul_q31);
+    riscv_dsp_mat_mul_fast_q31(golden_h_q31, golden_b_q31, buf_q31, 4, 5, 3);
+    CHECK_EXACT("mat_mul_fast_q31", buf_q31, golden_mat_mul_fast_q31);
+    riscv_dsp_mat_mul_q7(golden_a_q7, golden_b_q7, buf_q7, 4, 5, 3);
+    CHECK_EXACT("mat_mul_q7", buf_q7, golden_mat_mul_q7);
+    riscv_dsp_mat_mul_vxm_q7(golden_a_q7, golden_b_q7, buf_q7, 5, 3);
+    CHECK_EXACT("mat_mul_vxm_q7", buf_q7, golden_mat_mul_vxm_q7);
+    riscv_dsp_mat_mul_mxv_q15(golden_a_q15, golden_b_q15, buf_q15, 4, 5);
+    CHECK_EXACT("mat_mul_mxv_q15", buf_q15, golden_mat_mul_mxv_q15);
+    riscv_dsp_mat_mul_mxv_q31(golden_h_q31, golden_b_q31, buf_q31, 4, 5);
+    CHECK_EXACT("mat_mul_mxv_q31", buf_q31, golden_mat_mul_mxv_q31);
+    riscv_dsp_mat_mul_mxv_q7(golden_a_q7, golden_b_q7, buf_q7, 4, 5);
+    CHECK_EXACT("mat_mul_mxv_q7", buf_q7, golden_mat_mul_mxv_q7);
+
+    riscv_dsp_mat_scale_q15(golden_a_q15, 0x6000, 1, buf_q15, 4, 8);
+    CHECK_EXACT("mat_scale_q15", buf_q15, golden_mat_scale_q15);
+    riscv_dsp_mat_scale_q31(golden_a_q31, 0x60000000, 1, buf_q31, 4, 8);
+    CHECK_EXACT("mat_scale_q31", buf_q31, golden_mat_scale_q31);
+    riscv_dsp_mat_trans_q15(golden_a_q15, buf_q15, 4, 5);
+    CHECK_EXACT("mat_trans_q15", buf_q15, golden_mat_trans_q15);
+    riscv_dsp_mat_trans_q31(golden_a_q31, buf_q31, 4, 5);
+    CHECK_EXACT("mat_trans_q31", buf_q31, golden_mat_trans_q31);
+    riscv_dsp_mat_trans_u8(golden_a_u8, buf_u8, 4, 5);
+    CHECK_EXACT("mat_trans_u8", buf_u8, golden_mat_trans_u8);
+    riscv_dsp_mat_trans_q7(golden_a_q7, buf_q7, 4, 5);
+    CHECK_EXACT("mat_trans_q7", buf_q7, golden_mat_trans_q7);
+    riscv_dsp_mat_oprod_q31(golden_a_q31, golden_b_q31, buf_q31, 4, 5);
+    CHECK_EXACT("mat_oprod_q31", buf_q31, golden_mat_oprod_q31);
+    riscv_dsp_cmat_mul_q15(golden_ca_q15, golden_cb_q15, buf_q15, 2, 3, 2);
+    CHECK_EXACT("cmat_mul_q15", buf_q15, golden_cmat_mul_q15);
+    riscv_dsp_cmat_mul_q31(golden_h_q31, golden_hb_q31, buf_q31, 2, 3, 2);
+    CHECK_EXACT("cmat_mul_q31", buf_q31, golden_cmat_mul_q31);
+
+    memcpy(copy, a, sizeof(a));
+    report("mat_inv_f32 ret", riscv_dsp_mat_inv_f32(copy, inv, 3) == 0);
+    riscv_dsp_mat_mul_f32(a, inv, buf_f32, 3, 3, 3);
+    report("mat_inv_f32 A*inv(A)", close_f32(buf_f32, unity, 9, 1e-5f));
+}
+
+/*
+ * The complex fixed-point transforms: the forward one returns the spectrum divided by 2N, the
+ * inverse one takes that spectrum back to the input.
+ */
+#define CHECK_CFFT_Q(name, buf, fwd, inv, conv, close, tol, rt_tol)                                 \
+    do {                                                                                            \
+        for (uint32_t i = 0; i < 2 * fft_n; i++) {                                                  \
+            (buf)[i] = conv(golden_fft_in_f32[i]);                                                  \
+        }                                                                                           \
+        report("cfft_" name, (fwd(buf, GOLDEN_FFT_LOG2) == 0) &&                                    \
+                                 close(buf, golden_fft_out_f32, 2 * fft_n, 1.0f / (float)(2 * fft_n), tol)); \
+        report("cifft_" name, (inv(buf, GOLDEN_FFT_LOG2) == 0) &&                                   \
+                                  close(buf, golden_fft_in_f32, 2 * fft_n, 1.0f, rt_tol));          \
+    } while (0)
+
+#define TO_Q31(x) ((q31_t)((x) * 2147483648.0f))
+#define TO_Q15(x) ((q15_t)((x) * 32768.0f))
+
+/* the generic fixed-point transforms have no return value */
+static int32_t cfft_q31(q31_t *src, uint32_t m)
+{
+    riscv_dsp_cfft_q31(src, m);
+    return 0;
+}
+
+static int32_t cifft_q31(q31_t *src, uint32_t m)
+{
+    riscv_dsp_cifft_q31(src, m);
+    return 0;
+}
+
+static int32_t cfft_q15(q15_t *src, uint32_t m)
+{
+    riscv_dsp_cfft_q15(src, m);
+    return 0;
+}
+
+static int32_t cifft_q15(q15_t *src, uint32_t m)
+{
+    riscv_dsp_cifft_q15(src, m);
+    return 0;
+}
+
+static void check_transform(void)
+{
+    const uint32_t fft_n = 1UL << GOLDEN_FFT_LOG2;
+    const uint32_t rfft_n = 1UL << GOLDEN_RFFT_LOG2;
+    const uint32_t dct_n = 1UL << GOLDEN_DCT_LOG2;
+    static float fbuf[2 << GOLDEN_RFFT_LOG2];
+    static q31_t qbuf[2 << GOLDEN_RFFT_LOG2];
+    static q15_t sbuf[2 << GOLDEN_RFFT_LOG2];
+    static float half[2 << GOLDEN_RFFT_LOG2];
+
+    printf("transform\n");
+    memcpy(fbuf, golden_fft_in_f32, sizeof(golden_fft_in_f32));
+    report("cfft_rd2_f32", (riscv_dsp_cfft_rd2_f32(fbuf, GOLDEN_FFT_LOG2) == 0) &&
+                               close_f32(fbuf, golden_fft_out_f32, 2 * fft_n, 1e-4f));
+    riscv_dsp_cifft_rd2_f32(fbuf, GOLDEN_FFT_LOG2);
+    report("cifft_rd2_f32", close_f32(fbuf, golden_fft_in_f32, 2 * fft_n, 1e-6f));
+
+    /* a round trip through a 16-bit data path loses the low bits of every stage */
+    CHECK_CFFT_Q("q31", qbuf, cfft_q31, cifft_q31, TO_Q31, close_q31, 1e-6f, 1e-6f);
+    CHECK_CFFT_Q("rd2_q31", qbuf, riscv_dsp_cfft_rd2_q31, riscv_dsp_cifft_rd2_q31, TO_Q31, close_q31, 1e-6f, 1e-6f);
+    CHECK_CFFT_Q("rd4_q31", qbuf, riscv_dsp_cfft_rd4_q31, riscv_dsp_cifft_rd4_q31, TO_Q31, close_q31, 1e-6f, 1e-6f);
+    CHECK_CFFT_Q("q15", sbuf, cfft_q15, cifft_q15, TO_Q15, close_q15, 8.0f / 32768.0f, 1024.0f / 32768.0f);
+    CHECK_CFFT_Q("rd2_q15", sbuf, riscv_dsp_cfft_rd2_q15, riscv_dsp_cifft_rd2_q15, TO_Q15, close_q15,
+                 8.0f / 32768.0f, 1024.0f / 32768.0f);
+    CHECK_CFFT_Q("rd4_q15", sbuf, riscv_dsp_cfft_rd4_q15, riscv_dsp_cifft_rd4_q15, TO_Q15, close_q15,
+                 8.0f / 32768.0f, 1024.0f / 32768.0f);
+
+    memcpy(fbuf, golden_rfft_in_f32, sizeof(golden_rfft_in_f32));
+    report("rfft_f32", (riscv_dsp_rfft_f32(fbuf, GOLDEN_RFFT_LOG2) == 0) &&
+                           close_f32(fbuf, golden_rfft_out_f32, rfft_n, 1e-4f));
+    riscv_dsp_rifft_f32(fbuf, GOLDEN_RFFT_LOG2);
+    report("rifft_f32", close_f32(fbuf, golden_rfft_in_f32, rfft_n, 1e-6f));
+
+    for (uint32_t i = 0; i < rfft_n; i++) {
+        qbuf[i] = TO_Q31(golden_rfft_in_f32[i]);
+        sbuf[i] = TO_Q15(golden_rfft_in_f32[i]);
+    }
+    report("rfft_q31", (riscv_dsp_rfft_q31(qbuf, GOLDEN_RFFT_LOG2) == 0) &&
+                           close_q31(qbuf, golden_rfft_out_f32, rfft_n, 1.0f / (float)(2 * rfft_n), 1e-6f));
+    report("rifft_q31", (riscv_dsp_rifft_q31(qbuf, GOLDEN_RFFT_LOG2) == 0) &&
+                            close_q31(qbuf, golden_rfft_in_f32, rfft_n, 1.0f, 1e-6f));
+    report("rfft_q15", (riscv_dsp_rfft_q15(sbuf, GOLDEN_RFFT_LOG2) == 0) &&
+                           close_q15(sbuf, golden_rfft_out_f32, rfft_n, 1.0f / (float)(2 * rfft_n), 8.0f / 32768.0f));
+    /* a round trip through 8 stages with a 16-bit data path */
+    report("rifft_q15", (riscv_dsp_rifft_q15(sbuf, GOLDEN_RFFT_LOG2) == 0) &&
+                            close_q15(sbuf, golden_rfft_in_f32, rfft_n, 1.0f, 1024.0f / 32768.0f));
+
+    memcpy(fbuf, golden_dct_in_f32, sizeof(golden_dct_in_f32));
+    riscv_dsp_dct_f32(fbuf, GOLDEN_DCT_LOG2);
+    report("dct_f32", close_f32(fbuf, golden_dct_out_f32, dct_n, 1e-4f));
+    riscv_dsp_idct_f32(fbuf, GOLDEN_DCT_LOG2);
+    report("idct_f32", close_f32(fbuf, golden_dct_in_f32, dct_n, 1e-5f));
+    memcpy(fbuf, golden_dct_in_f32, sizeof(golden_dct_in_f32));
+    riscv_dsp_dct4_f32(fbuf, GOLDEN_DCT_LOG2);
+    report("dct4_f32", close_f32(fbuf, golden_dct4_out_f32, dct_n, 1e-4f));
+    riscv_dsp_idct4_f32(fbuf, GOLDEN_DCT_LOG2);
+    report("idct4_f32", close_f32(fbuf, golden_dct_in_f32, dct_n, 1e-5f));
+
+    /* the fixed-point DCTs scale like the FFTs, on an input halved so that it stays below 1.0 */
+    for (uint32_t i = 0; i < dct_n; i++) {
+        half[i] = 0.5f * golden_dct_in_f32[i];
+    }
+#define CHECK_DCT_Q(name, fwd, inv, buf, conv, close, golden, tol, rt_tol)                      \
+    do {                                                                                        \
+        for (uint32_t i = 0; i < dct_n; i++) {                                                  \
+            buf[i] = conv(half[i]);                                                             \
+        }                                                                                       \
+        fwd(buf, GOLDEN_DCT_LOG2);                                                              \
+        report(name, close(buf, golden, dct_n, 0.5f / (float)(2 * dct_n), tol));           \
+        inv(buf, GOLDEN_DCT_LOG2);                                                              \
+        report("i" name, close(buf, half, dct_n, 1.0f, rt_tol));                               \
+    } while (0)
+
+    CHECK_DCT_Q("dct_q31", riscv_dsp_dct_q31, riscv_dsp_idct_q31, qbuf, TO_Q31, close_q31, golden_dct_out_f32,
+                1e-6f, 1e-6f);
+    CHECK_DCT_Q("dct4_q31", riscv_dsp_dct4_q31, riscv_dsp_idct4_q31, qbuf, TO_Q31, close_q31, golden_dct4_out_f32,
+                1e-6f, 1e-6f);
+    CHECK_DCT_Q("dct_q15", riscv_dsp_dct_q15, riscv_dsp_idct_q15, sbuf, TO_Q15, close_q15, golden_dct_out_f32,
+                8.0f / 32768.0f, 1024.0f / 32768.0f);
+    CHECK_DCT_Q("dct4_q15", riscv_dsp_dct4_q15, riscv_dsp_idct4_q15, sbuf, TO_Q15, close_q15, golden_dct4_out_f32,
+                8.0f / 32768.0f, 1024.0f / 32768.0f);
+#undef CHECK_DCT_Q
+}
+
+uint32_t dsp_sw_check_run_golden(void)
+{
+    check_count = 0;
+    fail_count = 0;
+    check_basic();
+    check_statistics();
+    check_complex();
+    check_filtering();
+    check_matrix();
+    check_transform();
+    printf("%u checks, %u failed\n", (unsigned int)check_count, (unsigned int)fail_count);
+    return fail_count;
+}
+
+/* Benchmark */
+#define BENCH_FIR_TAPS  (64U)
+#define BENCH_BLOCK     (256U)
+#define BENCH_FFT_LOG2  (10U)
+#define BENCH_MAT_DIM   (16U)
+#define BENCH_RUNS      (10U)
+
+static float bench_f32[2 << BENCH_FFT_LOG2];
+static q15_t bench_q15[BENCH_BLOCK];
+static q15_t bench_out_q15[BENCH_BLOCK];
+static q15_t bench_coeff_q15[BENCH_FIR_TAPS];
+static q15_t bench_state_q15[BENCH_FIR_TAPS + BENCH_BLOCK - 1];
+static float bench_mat[3][BENCH_MAT_DIM * BENCH_MAT_DIM];
+
+static void bench_print(const char *name, uint64_t ticks)
+{
+    printf("  %-32s %10llu %s\n", name, (unsigned long long)(ticks / BENCH_RUNS), dsp_sw_check_tick_unit());
+}
+
+void dsp_sw_check_run_benchmark(void)
+{
+    riscv_dsp_fir_q15_t fir = {BENCH_FIR_TAPS, bench_state_q15, bench_coeff_q15};
+    volatile q63_t sink = 0;
+    uint64_t start;
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(bench_q15); i++) {
+        bench_q15[i] = (q15_t)((i * 2654435761UL) >> 17);
+    }
+    for (uint32_t i = 0; i < BENCH_FIR_TAPS; i++) {
+        bench_coeff_q15[i] = (q15_t)(32767 / BENCH_FIR_TAPS);
+    }
+    for (uint32_t i = 0; i < ARRAY_SIZE(bench_mat[0]); i++) {
+        bench_mat[0][i] = (float)(i % 7) * 0.25f;
+        bench_mat[1][i] = (float)(i % 5) * 0.5f;
+    }
+
+    printf("benchmark, average of %u runs\n", (unsigned int)BENCH_RUNS);
+
+    start = dsp_sw_check_get_ticks();
+    for (uint32_t r = 0; r < BENCH_RUNS; r++) {
+        sink += riscv_dsp_dprod_q15(bench_q15, bench_q15, BENCH_BLOCK);
+    }
+    bench_print("dprod_q15 256", dsp_sw_check_get_ticks() - start);
+
+    start = dsp_sw_check_get_ticks();
+    for (uint32_t r = 0; r < BENCH_RUNS; r++) {
+        riscv_dsp_fir_q15(&fir, bench_q15, bench_out_q15, BENCH_BLOCK);
+    }
+    bench_print("fir_q15 64 taps x 256", dsp_sw_check_get_ticks() - start);
+
+    start = dsp_sw_check_get_ticks();
+    for (uint32_t r = 0; r < BENCH_RUNS; r++) {
+        riscv_dsp_mat_mul_f32(bench_mat[0], bench_mat[1], bench_mat[2], BENCH_MAT_DIM, BENCH_MAT_DIM, BENCH_MAT_DIM);
+    }
+    bench_print("mat_mul_f32 16x16", dsp_sw_check_get_ticks() - start);
+
+    start = dsp_sw_check_get_ticks();
+    for (uint32_t r = 0; r < BENCH_RUNS; r++) {
+        for (uint32_t i = 0; i < ARRAY_SIZE(bench_f32); i++) {
+            bench_f32[i] = (float)(i & 0xF) * 0.0625f;
+        }
+        riscv_dsp_cfft_rd2_f32(bench_f32, BENCH_FFT_LOG2);
+    }
+    bench_print("cfft_rd2_f32 1024 (with reload)", dsp_sw_check_get_ticks() - start);
+
+    start = dsp_sw_check_get_ticks();
+    for (uint32_t r = 0; r < BENCH_RUNS; r++) {
+        for (uint32_t i = 0; i < (1UL << BENCH_FFT_LOG2); i++) {
+            bench_f32[i] = (float)(i & 0xF) * 0.0625f;
+        }
+        riscv_dsp_rfft_f32(bench_f32, BENCH_FFT_LOG2);
+    }
+    bench_print("rfft_f32 1024 (with reload)", dsp_sw_check_get_ticks() - start);
+
+    (void)sink;
+}
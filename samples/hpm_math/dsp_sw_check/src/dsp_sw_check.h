@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef DSP_SW_CHECK_H
+#define DSP_SW_CHECK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Provided by the platform: a free running counter for the benchmark and the name of
+ * its unit, e.g. "cycles" on the board or "ns" on the host.
+ */
+uint64_t dsp_sw_check_get_ticks(void);
+const char *dsp_sw_check_tick_unit(void);
+
+/* runs every golden vector check, returns the number of failed checks */
+uint32_t dsp_sw_check_run_golden(void);
+
+/* times a few typical kernels and prints the results */
+void dsp_sw_check_run_benchmark(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DSP_SW_CHECK_H */
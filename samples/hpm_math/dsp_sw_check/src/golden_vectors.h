@@ -0,0 +1,1317 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* generated by gen_golden.py, do not edit */
+
+#ifndef GOLDEN_VECTORS_H
+#define GOLDEN_VECTORS_H
+
+#include "riscv_dsp_math_types.h"
+
+#define GOLDEN_VEC_SIZE (32)
+
+static const q15_t golden_a_q15[32] = {
+    32767, (q15_t)-32768, (q15_t)-32768, 1, -32170, -7465, 18372, 30381,
+    28130, -10893, 7216, -12119, -31186, 21967, -13476, -12699,
+    -10438, 32747, 16712, -5151, 11526, 12231, 10740, 25885,
+    5010, 355, -3744, 13849, -10530, 20671, -15476, 6869,
+};
+
+static const q15_t golden_b_q15[32] = {
+    1, -1, (q15_t)-32768, 32767, -7242, -26441, -2012, -12403,
+    -31422, 2387, 29328, -10359, -19570, -6225, 10172, 25413,
+    31386, 20427, 936, -4415, -22938, 7591, -19884, -18947,
+    -15630, -4797, -24640, -19207, 7230, 6815, -2068, -22603,
+};
+
+static const q31_t golden_a_q31[32] = {
+    2147483647, (q31_t)0x80000000, (q31_t)0x80000000, 1, -1342704362, -1639694697,
+    -303376252, -720463763, -1158263646, -1920717517, -276891408, -1568059799,
+    -661614354, -943036017, -1326271460, -1277204443, -1720136198, -259125333,
+    -1098582520, -205299295, -1250570298, -1583613049, -1485346124, -342657315,
+    -940629422, -625817309, -1954906592, -497703975, -919006818, -824257409,
+    -1831248820, -277633899,
+};
+
+static const q31_t golden_b_q31[32] = {
+    1, -1, (q31_t)0x80000000, 2147483647, -348670346, -1248537481,
+    -1272649500, -150679219, -1822374910, -679984877, -1984319664, -1621478071,
+    -1793384882, -31728785, -1785565060, -913842939, -351350438, -558579829,
+    -707520408, -215071615, -531060442, -2102539929, -2079960300, -109467715,
+    -2095697486, -1253862141, -931165056, -434240839, -1280198914, -1361019297,
+    -1198460756, -1877798539,
+};
+
+static const q7_t golden_a_q7[32] = {
+    (q7_t)-128, (q7_t)127, (q7_t)-1, (q7_t)0, (q7_t)86, (q7_t)-41, (q7_t)-60, (q7_t)-83,
+    (q7_t)-30, (q7_t)115, (q7_t)48, (q7_t)-87, (q7_t)46, (q7_t)-49, (q7_t)92, (q7_t)101,
+    (q7_t)58, (q7_t)-21, (q7_t)72, (q7_t)-31, (q7_t)6, (q7_t)-57, (q7_t)-12, (q7_t)29,
+    (q7_t)-110, (q7_t)99, (q7_t)96, (q7_t)25, (q7_t)-34, (q7_t)-65, (q7_t)-116, (q7_t)-43,
+};
+
+static const q15_t golden_add_q15[32] = {
+    32767, (q15_t)-32768, (q15_t)-32768, 32767, (q15_t)-32768, (q15_t)-32768, 16360, 17978,
+    -3292, -8506, 32767, -22478, (q15_t)-32768, 15742, -3304, 12714,
+    20948, 32767, 17648, -9566, -11412, 19822, -9144, 6938,
+    -10620, -4442, -28384, -5358, -3300, 27486, -17544, -15734,
+};
+
+static const q31_t golden_sub_q31[32] = {
+    2147483646, -2147483647, 0, -2147483646, -994034016, -391157216,
+    969273248, -569784544, 664111264, -1240732640, 1707428256, 53418272,
+    1131770528, -911307232, 459293600, -363361504, -1368785760, 299454496,
+    -391062112, 9772320, -719509856, 518926880, 594614176, -233189600,
+    1155068064, 628044832, -1023741536, -63463136, 361192096, 536761888,
+    -632788064, 1600164640,
+};
+
+static const q15_t golden_mul_q15[32] = {
+    0, 1, 32767, 0, 7109, 6023, -1129, -11500,
+    -26975, -794, 6458, 3831, 18625, -4174, -4184, -9849,
+    -9998, 20413, 477, 694, -8069, 2833, -6518, -14968,
+    -2390, -52, 2815, -8118, -2324, 4299, 976, -4739,
+};
+
+static const q31_t golden_mul_q31[32] = {
+    0, 1, 2147483647, 0, 218004544, 953311234,
+    179787927, 50551685, 982913471, 608181052, 255853433, 1183978551,
+    552520705, 13933231, 1102752973, 543503212, 281431994, 67400831,
+    361944340, 20560832, 309258892, 1550470324, 1438642372, 17466914,
+    917946321, 365399118, 847662196, 100640296, 547855873, 522392913,
+    1021977441, 242768102,
+};
+
+static const q7_t golden_abs_q7[32] = {
+    (q7_t)127, (q7_t)127, (q7_t)1, (q7_t)0, (q7_t)86, (q7_t)41, (q7_t)60, (q7_t)83,
+    (q7_t)30, (q7_t)115, (q7_t)48, (q7_t)87, (q7_t)46, (q7_t)49, (q7_t)92, (q7_t)101,
+    (q7_t)58, (q7_t)21, (q7_t)72, (q7_t)31, (q7_t)6, (q7_t)57, (q7_t)12, (q7_t)29,
+    (q7_t)110, (q7_t)99, (q7_t)96, (q7_t)25, (q7_t)34, (q7_t)65, (q7_t)116, (q7_t)43,
+};
+
+static const q15_t golden_shift_left_q15[32] = {
+    32767, (q15_t)-32768, (q15_t)-32768, 8, (q15_t)-32768, (q15_t)-32768, 32767, 32767,
+    32767, (q15_t)-32768, 32767, (q15_t)-32768, (q15_t)-32768, 32767, (q15_t)-32768, (q15_t)-32768,
+    (q15_t)-32768, 32767, 32767, (q15_t)-32768, 32767, 32767, 32767, 32767,
+    32767, 2840, -29952, 32767, (q15_t)-32768, 32767, (q15_t)-32768, 32767,
+};
+
+static const q15_t golden_shift_right_q15[32] = {
+    8191, -8192, -8192, 0, -8043, -1867, 4593, 7595,
+    7032, -2724, 1804, -3030, -7797, 5491, -3369, -3175,
+    -2610, 8186, 4178, -1288, 2881, 3057, 2685, 6471,
+    1252, 88, -936, 3462, -2633, 5167, -3869, 1717,
+};
+
+#define GOLDEN_SCALE_FRACT (0x60000000)
+#define GOLDEN_SCALE_SHIFT (1)
+
+static const q31_t golden_scale_q31[32] = {
+    2147483647, (q31_t)0x80000000, (q31_t)0x80000000, 1, -2014056543, (q31_t)0x80000000,
+    -455064378, -1080695645, -1737395469, (q31_t)0x80000000, -415337112, (q31_t)0x80000000,
+    -992421531, -1414554026, -1989407190, -1915806665, (q31_t)0x80000000, -388688000,
+    -1647873780, -307948943, -1875855447, (q31_t)0x80000000, (q31_t)0x80000000, -513985973,
+    -1410944133, -938725964, (q31_t)0x80000000, -746555963, -1378510227, -1236386114,
+    (q31_t)0x80000000, -416450849,
+};
+
+static const q31_t golden_neg_q31[32] = {
+    -2147483647, 2147483647, 2147483647, -1, 1342704362, 1639694697,
+    303376252, 720463763, 1158263646, 1920717517, 276891408, 1568059799,
+    661614354, 943036017, 1326271460, 1277204443, 1720136198, 259125333,
+    1098582520, 205299295, 1250570298, 1583613049, 1485346124, 342657315,
+    940629422, 625817309, 1954906592, 497703975, 919006818, 824257409,
+    1831248820, 277633899,
+};
+
+#define GOLDEN_DPROD_Q15 (-276650288LL)
+
+#define GOLDEN_MAX_Q15 (32767)
+#define GOLDEN_MAX_Q15_INDEX (0)
+#define GOLDEN_MEAN_Q31 (-971947366)
+#define GOLDEN_PWR_Q15 (12090076436LL)
+#define GOLDEN_RMS_Q15 (19437)
+#define GOLDEN_VAR_F32 (5.358571691e+00f)
+
+static const float golden_a_f32[32] = {
+    -1.285873017e+00f, 1.276482924e+00f, 3.409078572e+00f, 3.433741398e+00f,
+    1.415493135e-01f, -7.540738903e-01f, -3.445288047e+00f, -3.495343160e+00f,
+    5.613429642e-01f, -3.664374519e+00f, -1.259967743e+00f, 1.901080168e+00f,
+    1.090784614e-01f, -1.104965987e+00f, 2.432366598e+00f, 2.649557851e+00f,
+    -2.741599939e+00f, -1.220108705e+00f, 1.815533790e+00f, 3.780481584e+00f,
+    1.683330442e+00f, 1.843434482e+00f, 2.831836540e+00f, -2.594763289e+00f,
+    1.674503778e-01f, 2.536984219e+00f, -8.540713772e-01f, -2.722274329e+00f,
+    3.099534457e-01f, -1.630094412e+00f, -3.219442919e+00f, 2.590266428e+00f,
+};
+
+static const q15_t golden_ca_q15[32] = {
+    (q15_t)-32768, (q15_t)-32768, 32767, (q15_t)-32768, -25962, -18921, -17916, -25619,
+    -13790, -25421, 29296, 2537, 26222, 20751, 17820, 23461,
+    31610, -4309, 8072, 3361, -10938, 21255, -21452, 23133,
+    -46, 6307, 22432, 16217, 18206, -25601, 19916, 30741,
+};
+
+static const q15_t golden_cb_q15[32] = {
+    (q15_t)-32768, 32767, 32767, (q15_t)-32768, 7158, 3063, -30108, -27443,
+    386, 28819, -5936, -20279, -19506, -32017, -15876, -28539,
+    16090, 24331, 488, -20479, 28326, -7961, 21652, 19261,
+    -12494, -23421, 9728, 24121, -21378, 1503, -24020, -23307,
+};
+
+static const q15_t golden_cmul_q15[32] = {
+    16384, 0, -1, -16384, -975, -1641, -1248, 9635,
+    5549, -3108, -934, -4648, 1166, -9495, 2950, -6723,
+    4680, 5338, 556, -1250, -1073, 5257, -6943, 668,
+    1131, -594, -1320, 5331, -2676, 4383, 1817, -9176,
+};
+
+static const q31_t golden_cmag_sqr_q31[16] = {
+    1073741823, 536870912, 522874027, 71142006, 585654104, 295168764,
+    154489008, 394676715, 352274449, 145406386, 474014826, 270510457,
+    148596126, 473736904, 177413900, 399368910,
+};
+
+#define GOLDEN_FIR_TAPS (8)
+#define GOLDEN_FIR_BLOCK (16)
+
+static const q15_t golden_fir_coeff_q15[8] = {
+    4746, 8443, -19176, -25743, -12970, -11817, 2756, 32173,
+};
+
+static const q31_t golden_fir_coeff_q31[8] = {
+    -84992740, -221804914, -227413530, -266594059, -163047899, -94145383,
+    -87896629, -158685524,
+};
+
+static const q15_t golden_fir_q15[32] = {
+    32172, -29418, (q15_t)-32768, -3908, -32541, 9502, 32767, 32767,
+    32767, -6613, (q15_t)-32768, (q15_t)-32768, (q15_t)-32768, 23044, 17013, -2615,
+    16722, 32767, 15894, 7676, 7236, -16621, -27366, 18537,
+    1390, -28077, -29070, -10629, -22510, 20911, -7368, -5716,
+};
+
+static const q31_t golden_fir_q31[32] = {
+    -158685524, 70788895, 152436770, 18994113, 89816623, 378348511,
+    420597040, 603709590, 726355337, 674693498, 554539273, 643413998,
+    587354738, 634051800, 670582090, 708447223, 661932138, 606294382,
+    659074645, 624688995, 691751593, 659350361, 637023784, 487157540,
+    569598366, 606251340, 726710611, 628537656, 590648042, 540247657,
+    666807117, 572052037,
+};
+
+static const q31_t golden_bq_coeff_q31[10] = {
+    72477573, 144955146, 72477573, 1227286905, -443240625, 214748365,
+    429496730, 214748365, 322122547, -107374182,
+};
+
+static const q31_t golden_bq_q31[32] = {
+    7247757, 32201785, 47513026, -754334, -104137498, -199538729,
+    -258562199, -284985599, -279648179, -259345110, -253202260, -264273353,
+    -273745476, -272556042, -264244391, -257894700, -264503061, -283720657,
+    -297337767, -286924939, -254789474, -223325684, -218484936, -243857669,
+    -271072334, -272445798, -253968904, -242430737, -247227407, -252305098,
+    -249007026, -248723289,
+};
+
+#define GOLDEN_CONV_LEN1 (12)
+#define GOLDEN_CONV_LEN2 (7)
+
+static const q15_t golden_conv_q15[18] = {
+    0, -2, -32767, 32767, -7242, (q15_t)-32768, 32767, 3749,
+    -16716, 15597, 6189, 17940, (q15_t)-32768, -2822, -6651, -2476,
+    9335, 744,
+};
+
+static const q15_t golden_corr_q15[23] = {
+    -10359, 32767, -16583, (q15_t)-32768, 26803, 15380, -26859, 32767,
+    32767, (q15_t)-32768, 19462, 32767, (q15_t)-32768, 20643, 25837, -18373,
+    -1, 0, 0, 0, 0, 0, 0,
+};
+
+static const q15_t golden_mat_mul_q15[12] = {
+    -11542, 25756, 15109, 25060, 11686, (q15_t)-32768, -556, 32767,
+    21340, -8156, 5848, -17163,
+};
+
+#define GOLDEN_FFT_LOG2 (6)
+
+static const float golden_fft_in_f32[128] = {
+    -1.276032653e-01f, 2.565840388e-01f, 9.991696877e-02f, -3.195919028e-02f,
+    6.645870515e-02f, -4.464650994e-04f, -3.002876098e-01f, -4.312233790e-01f,
+    2.925203530e-01f, -3.897971645e-01f, 4.139752839e-01f, 3.993507744e-01f,
+    2.212450349e-01f, -4.407539670e-01f, 8.203584542e-02f, -2.453839978e-01f,
+    4.234654805e-01f, 1.789007872e-02f, 3.383521404e-01f, -2.883560279e-01f,
+    7.953437724e-02f, 4.895486496e-01f, -4.681783747e-01f, 1.471813385e-01f,
+    4.445343329e-01f, -1.697721093e-01f, 1.032704884e-02f, -4.343473273e-01f,
+    -3.369027906e-01f, 3.763340338e-01f, 1.142667218e-01f, 2.064602700e-01f,
+    2.758283658e-02f, 3.986528869e-01f, -2.771808318e-01f, 3.993308255e-01f,
+    2.733670952e-01f, -3.987487969e-01f, -3.033078517e-01f, -3.635410084e-01f,
+    4.989379321e-03f, -1.159500762e-01f, 6.110605624e-02f, 3.301978083e-01f,
+    -1.530905672e-01f, 8.781929295e-02f, 2.727616936e-01f, -2.749539962e-01f,
+    4.126235595e-01f, -5.965414856e-02f, 4.145424184e-01f, -6.731782042e-02f,
+    -3.141097919e-01f, -7.747869593e-02f, -3.382993321e-01f, -4.412041395e-01f,
+    -9.218506403e-02f, 2.731032613e-01f, -1.367211415e-01f, -1.095345722e-01f,
+    -4.364552581e-01f, -1.491021442e-01f, -4.174853433e-01f, 1.128329214e-01f,
+    -4.376782207e-01f, 7.311423662e-02f, 4.399806303e-01f, -4.761742796e-01f,
+    2.046464415e-01f, -3.513590660e-01f, 1.032082683e-01f, 2.156750996e-01f,
+    3.029982118e-02f, 3.249941039e-01f, -2.334536164e-01f, 1.919816554e-01f,
+    1.409755492e-01f, 3.676876425e-01f, 4.650038839e-01f, 3.890776140e-01f,
+    9.127100305e-02f, -9.224819257e-03f, 6.582691919e-02f, -4.295639912e-01f,
+    -5.821210591e-02f, 4.573139511e-01f, 2.815604083e-01f, -4.371232628e-01f,
+    -4.319077721e-01f, 6.850052791e-02f, -4.516560659e-01f, -1.966805117e-01f,
+    -1.807163589e-01f, -2.397715527e-01f, 1.131920203e-01f, -3.351664519e-01f,
+    -3.800758896e-01f, -4.741823026e-01f, 1.740087758e-01f, -4.692655201e-01f,
+    -3.909239592e-01f, 3.836660869e-01f, 4.160869219e-01f, 8.547767884e-02f,
+    4.101997255e-01f, 1.085724847e-01f, -2.111588119e-01f, -2.089011998e-01f,
+    1.256601804e-01f, 4.454819411e-01f, -1.334739121e-01f, 1.795106638e-02f,
+    1.495933582e-01f, 2.440267593e-02f, -3.633119352e-01f, -2.015105554e-01f,
+    -1.071182683e-01f, -3.047550511e-01f, 6.010201786e-02f, -3.271482973e-01f,
+    -4.860107442e-01f, -4.986681999e-01f, 2.459421981e-01f, -4.050136613e-01f,
+    2.494057039e-01f, 1.033166773e-02f, -4.140625167e-01f, 3.680773852e-01f,
+};
+
+static const float golden_fft_out_f32[128] = {
+    -1.609982402e-01f, -2.826441751e+00f, 2.036440859e+00f, -2.358409142e+00f,
+    1.126175452e+00f, -2.598514691e+00f, -2.854559112e+00f, -1.271646923e+00f,
+    -1.401294193e+00f, -3.995419912e+00f, 3.512405788e+00f, 5.650078447e+00f,
+    -8.029521210e-01f, 2.044592780e+00f, -2.794001714e+00f, 5.032231933e+00f,
+    -1.049627022e+00f, 5.713224478e-01f, 1.859750408e+00f, 3.086622787e+00f,
+    -2.604288719e+00f, -9.867792685e-01f, -1.919345039e+00f, -1.979429606e-02f,
+    -3.734661918e+00f, 2.082692074e+00f, 2.746680443e+00f, 3.869008220e+00f,
+    -1.303436828e+00f, -2.280567350e+00f, 1.445357219e+00f, 9.743129351e-01f,
+    2.631024720e-01f, -1.884575249e+00f, -1.624301559e+00f, -5.364984538e+00f,
+    -2.269681608e+00f, 5.044938440e-01f, -8.484891167e-01f, -2.455930987e+00f,
+    -1.526891502e+00f, -1.330942381e+00f, 1.334318726e+00f, -3.777400409e+00f,
+    -1.181058242e+00f, -3.565495245e+00f, -2.149439174e+00f, 1.254954464e+00f,
+    -3.110175302e+00f, -1.135050702e-01f, 4.884364513e+00f, 8.510032753e-01f,
+    1.172193253e+00f, 3.027464255e+00f, -8.841302051e-01f, 3.955641081e+00f,
+    1.157938450e+00f, 2.391761460e-01f, -1.519919332e+00f, -2.395901729e+00f,
+    -2.159726403e-01f, -1.362557055e+00f, 3.639804681e+00f, 1.352194100e+00f,
+    -4.082359972e-01f, 3.795107754e+00f, 5.291114161e-01f, -2.946912264e+00f,
+    2.413904251e-01f, -1.652418966e+00f, -3.430294586e-01f, 4.892000612e-01f,
+    -3.429535654e+00f, -2.274303261e+00f, 1.152913579e+00f, 5.020141597e-01f,
+    1.331920635e+00f, 1.860393629e+00f, 3.539413747e+00f, -4.508234847e-01f,
+    5.025320805e-01f, 4.348351893e-01f, -5.540836129e-01f, 2.416209819e+00f,
+    1.823350589e+00f, 2.758791102e-01f, 4.326951790e+00f, -2.330898225e+00f,
+    -7.401621576e-01f, 8.046131323e-01f, -4.997540987e+00f, -7.634966887e-01f,
+    -2.707537750e-01f, 4.474094293e+00f, -3.976342609e+00f, -7.350738518e-01f,
+    1.632607342e+00f, 2.301711441e-01f, 3.677432770e+00f, 1.440969398e-01f,
+    -1.516596927e+00f, 3.633454630e+00f, -2.580480208e+00f, -3.229171578e-01f,
+    -6.025669397e-01f, 3.509371740e+00f, 4.554242325e+00f, -1.380721650e+00f,
+    1.746756820e+00f, 1.956370952e-01f, -3.588897558e+00f, 1.295131595e+00f,
+    3.604225566e+00f, 1.613746708e+00f, -1.276293585e+00f, -3.593552912e-01f,
+    6.764839299e-01f, 1.418086088e+00f, -1.123649320e-01f, 2.689393189e+00f,
+    -5.680649606e+00f, 3.210853045e+00f, 2.611040567e+00f, -7.588747177e-01f,
+    -1.358145168e+00f, 1.495879908e+00f, 9.538794380e-02f, 2.082021047e-03f,
+};
+
+#define GOLDEN_RFFT_LOG2 (7)
+
+static const float golden_rfft_in_f32[128] = {
+    4.374503768e-01f, 2.213628794e-01f, -3.087389729e-01f, -4.219839121e-01f,
+    -1.708148092e-01f, -2.329799797e-01f, 4.759042808e-01f, 4.936694642e-01f,
+    2.801871387e-01f, -3.709278241e-01f, 2.302853916e-01f, -9.730427274e-02f,
+    4.169301237e-01f, 8.658304791e-02f, 2.884197819e-02f, 3.516565961e-01f,
+    3.715261719e-01f, 1.152029464e-01f, 3.153582778e-01f, -2.408235291e-01f,
+    1.785760180e-01f, -4.361734192e-02f, 9.776668860e-03f, -1.291015086e-01f,
+    -7.212093359e-02f, 7.525918799e-02f, -1.975642867e-02f, -4.750125366e-01f,
+    2.667527268e-01f, 2.259633763e-01f, 2.241397187e-01f, 1.969296661e-01f,
+    3.457111245e-01f, -1.569006092e-01f, -3.981551937e-01f, -2.076204711e-01f,
+    -1.987468124e-01f, 4.781460948e-01f, 4.669865169e-01f, 1.568031896e-01f,
+    -1.304898922e-01f, 4.995302875e-01f, 3.692391540e-02f, 2.706689210e-01f,
+    2.245021755e-01f, -2.248781774e-01f, -1.527847739e-01f, -4.010655633e-01f,
+    -3.652450097e-01f, -4.440993988e-01f, 1.338199790e-01f, -4.364189277e-01f,
+    3.202504969e-02f, 2.795454374e-01f, 4.867855334e-01f, -3.920551626e-01f,
+    8.588470639e-02f, -4.873052002e-01f, -3.808320239e-01f, -1.784056531e-01f,
+    -1.220834933e-01f, -2.493705678e-01f, -4.050626028e-01f, -4.054943746e-01f,
+    -2.307330993e-01f, 2.931268419e-01f, 3.596175354e-01f, 2.692837872e-01f,
+    5.530932851e-02f, -8.476233137e-02f, -8.259019795e-02f, 2.601815899e-01f,
+    -4.988333201e-01f, -4.482660726e-01f, -1.448318130e-03f, -3.923351350e-01f,
+    3.518431330e-01f, -2.860208753e-01f, -4.393404964e-01f, 4.372748239e-01f,
+    -8.928463868e-02f, -1.420297495e-01f, -3.219440930e-02f, 2.915372335e-01f,
+    2.801331239e-01f, 4.223016463e-01f, 1.910797826e-01f, -1.963315246e-01f,
+    3.578792228e-01f, -2.451992541e-01f, -1.256146653e-01f, -3.181715267e-01f,
+    -3.167611593e-01f, -3.534143050e-01f, -3.907808084e-01f, 4.726704983e-01f,
+    2.264282530e-01f, -3.077051587e-01f, 2.621866356e-01f, 7.293784692e-02f,
+    -2.848670901e-01f, 1.952381021e-01f, -3.009996916e-01f, 4.578573992e-01f,
+    -4.080950981e-01f, -1.637797936e-01f, -2.512863873e-01f, -4.049199554e-01f,
+    1.961697930e-01f, -1.752141866e-01f, -2.480615171e-01f, 1.291799057e-02f,
+    2.645928314e-01f, -2.483634971e-01f, -4.632024653e-01f, -8.371061882e-03f,
+    3.435545372e-01f, -1.390303563e-01f, 1.663605891e-01f, -1.535028604e-01f,
+    2.074856622e-01f, -3.851086485e-02f, 3.013155688e-01f, 2.714613275e-01f,
+    -1.231884740e-01f, -3.051619757e-01f, -4.783762265e-01f, 2.120395180e-01f,
+};
+
+static const float golden_rfft_out_f32[128] = {
+    -1.764470936e+00f, 4.008140655e+00f, 3.433349131e+00f, -2.894064501e+00f,
+    -1.530643765e+00f, -3.469904251e+00f, 2.276929430e+00f, 9.905048648e-01f,
+    -8.162926046e-01f, -1.297825937e+00f, -3.585187751e+00f, 5.265916381e-01f,
+    -2.735165981e-03f, 2.864181329e+00f, -3.039733444e+00f, 2.094860760e+00f,
+    -8.788872509e-01f, -4.348278553e+00f, 3.543649234e+00f, 5.135265258e+00f,
+    -1.025569014e+00f, -4.263551191e+00f, -5.667809929e+00f, 1.088994083e+00f,
+    2.854292363e+00f, -9.380290987e-02f, 8.014808935e-01f, 1.635481709e+00f,
+    -5.328735502e-01f, -1.104493003e+00f, 2.461400638e+00f, 3.958013652e-01f,
+    1.023378533e+00f, 3.303170568e+00f, 5.132702620e+00f, 1.219781356e+00f,
+    -2.433387936e-01f, -3.642690422e+00f, 1.336238352e+00f, -7.214813772e-01f,
+    4.357713401e+00f, -8.947626042e-01f, 5.482608398e+00f, 7.773556836e-01f,
+    1.251530218e+00f, -4.288604359e+00f, 2.848279885e+00f, 1.124464540e+00f,
+    5.137043191e+00f, -2.079875155e+00f, 3.446721768e-01f, 2.540998129e-01f,
+    6.893073121e-01f, -2.221165064e+00f, 8.548738933e-01f, 2.125722451e+00f,
+    -3.041639776e+00f, -1.321803710e+00f, -4.027182965e-01f, -8.250173632e-01f,
+    -1.074851982e+00f, 1.480857938e+00f, 5.287617670e+00f, -5.753978393e-01f,
+    2.701520474e+00f, 1.624249548e+00f, -1.341605381e+00f, 2.512233818e+00f,
+    1.129158377e+00f, 7.448834307e-01f, 3.392213072e-01f, 2.012739406e+00f,
+    1.031014721e+00f, 1.329057012e+00f, -1.733470979e+00f, -1.747205078e+00f,
+    -1.798077591e-01f, -2.293306957e+00f, 2.105174438e+00f, -1.995669203e+00f,
+    1.659348482e+00f, 3.981151275e+00f, 1.744544518e+00f, -1.361006974e+00f,
+    -2.390647308e-01f, -3.070179968e+00f, -5.268792864e-01f, 3.718075015e+00f,
+    1.893350564e-01f, -3.228401132e+00f, 1.485339350e-01f, 1.927875050e-01f,
+    -2.723542611e+00f, -2.404497252e+00f, 2.011440059e+00f, -3.256127783e-02f,
+    -1.717359883e+00f, 3.515969939e+00f, -2.063506326e+00f, 3.615240720e-01f,
+    1.920167789e+00f, 1.747257834e-01f, 2.940647403e+00f, -2.908967117e+00f,
+    3.241456996e+00f, 3.063145725e+00f, -3.264008955e+00f, 1.246405115e+00f,
+    -1.660410345e+00f, -9.750936647e-01f, -1.226416479e+00f, 1.457262083e+00f,
+    -1.363310328e+00f, -9.232340421e-01f, 7.047231982e-01f, -4.592298026e-01f,
+    -3.609534950e+00f, 3.565709666e+00f, -3.714580864e-01f, 1.106343624e+00f,
+    -3.037741755e+00f, -3.847256686e+00f, -2.773456314e-01f, 1.784683244e+00f,
+    1.985455369e+00f, 6.650833366e-01f, 1.083924599e+00f, 2.296046004e+00f,
+};
+
+#define GOLDEN_DCT_LOG2 (5)
+
+static const float golden_dct_in_f32[32] = {
+    6.585114550e-01f, 7.604059986e-01f, 9.018190586e-01f, 4.726013855e-01f,
+    9.965064591e-01f, 3.076815080e-01f, 5.466841583e-02f, -2.547332967e-01f,
+    -6.955543587e-01f, -7.554475338e-01f, -4.705907402e-01f, -2.338781120e-01f,
+    -5.031020956e-01f, -5.041545040e-01f, 6.951316715e-01f, -1.182916561e-01f,
+    -2.893541061e-01f, 3.717479368e-01f, 8.080564671e-01f, -6.376196582e-01f,
+    4.733871731e-01f, -4.187644205e-01f, -3.998417516e-01f, -8.127828714e-01f,
+    3.841541435e-01f, -9.771558465e-01f, 5.982571997e-01f, -5.499712143e-01f,
+    4.929527182e-01f, 7.902845590e-01f, -1.389203701e-01f, -6.760441613e-01f,
+};
+
+static const float golden_dct_out_f32[32] = {
+    3.299594523e-01f, 3.135892746e+00f, 4.020215771e+00f, 4.209242430e+00f,
+    4.998538541e+00f, -6.164341388e-01f, -3.390668214e+00f, 5.200308616e-01f,
+    -3.057960631e+00f, 7.182046116e-01f, -7.057414537e-01f, 1.527434531e+00f,
+    -1.404658019e+00f, 2.294883001e+00f, -1.127576316e+00f, 2.492418642e-01f,
+    -2.062203278e+00f, 1.166377846e+00f, 1.970912335e+00f, -1.127290258e+00f,
+    -3.493813685e+00f, 6.753398267e-01f, 1.887346841e+00f, -3.019005951e+00f,
+    1.333257956e+00f, -8.853559267e-01f, 1.674595531e+00f, 4.985758886e-01f,
+    5.842019553e-01f, 2.029364851e+00f, -3.344653488e+00f, 4.337739760e+00f,
+};
+
+static const float golden_dct4_out_f32[32] = {
+    1.310613057e+00f, 4.088520723e+00f, 3.882119359e+00f, 4.848013946e+00f,
+    3.254454413e+00f, -3.870902377e+00f, -4.273831525e-01f, -1.655649422e+00f,
+    -1.307994233e+00f, 2.465117086e-01f, 3.710504711e-01f, 2.074312361e-01f,
+    -6.097730706e-02f, 1.591056377e+00f, -1.534968963e+00f, 1.534357177e-01f,
+    -2.089596670e+00f, 3.385229963e+00f, -3.493913754e-01f, -1.886018669e+00f,
+    -3.087755300e+00f, 3.661575929e+00f, -2.118721724e+00f, -4.526841282e-01f,
+    3.585149359e-01f, -6.271719411e-02f, 1.922535100e+00f, -4.794264258e-01f,
+    2.424681367e+00f, -1.178889417e+00f, -7.066480039e-01f, 5.197553568e+00f,
+};
+
+static const q7_t golden_b_q7[32] = {
+    (q7_t)-128, (q7_t)-128, (q7_t)1, (q7_t)127, (q7_t)-26, (q7_t)39, (q7_t)-44, (q7_t)125,
+    (q7_t)114, (q7_t)-61, (q7_t)64, (q7_t)121, (q7_t)-66, (q7_t)31, (q7_t)108, (q7_t)53,
+    (q7_t)-54, (q7_t)59, (q7_t)88, (q7_t)-79, (q7_t)-106, (q7_t)23, (q7_t)4, (q7_t)-19,
+    (q7_t)34, (q7_t)-77, (q7_t)112, (q7_t)-23, (q7_t)110, (q7_t)15, (q7_t)-100, (q7_t)-91,
+};
+
+static const uint8_t golden_a_u8[32] = {
+    0, 255, 255, 0, 198, 135, 180, 221,
+    82, 35, 32, 217, 158, 127, 76, 149,
+    170, 155, 56, 17, 118, 119, 228, 77,
+    2, 19, 80, 73, 78, 111, 124, 5,
+};
+
+static const uint8_t golden_b_u8[32] = {
+    255, 0, 255, 0, 38, 103, 20, 189,
+    178, 3, 128, 185, 254, 95, 172, 117,
+    10, 123, 152, 241, 214, 87, 68, 45,
+    98, 243, 176, 41, 174, 79, 220, 229,
+};
+
+static const q31_t golden_h_q31[32] = {
+    268435455, -268435456, -268435456, 0, -167838046, -204961838,
+    -37922032, -90057971, -144782956, -240089690, -34611426, -196007475,
+    -82701795, -117879503, -165783933, -159650556, -215017025, -32390667,
+    -137322815, -25662412, -156321288, -197951632, -185668266, -42832165,
+    -117578678, -78227164, -244363324, -62212997, -114875853, -103032177,
+    -228906103, -34704238,
+};
+
+static const q31_t golden_hb_q31[32] = {
+    0, -1, -268435456, 268435455, -43583794, -156067186,
+    -159081188, -18834903, -227796864, -84998110, -248039958, -202684759,
+    -224173111, -3966099, -223195633, -114230368, -43918805, -69822479,
+    -88440051, -26883952, -66382556, -262817492, -259995038, -13683465,
+    -261962186, -156732768, -116395632, -54280105, -160024865, -170127413,
+    -149807595, -234724818,
+};
+
+static const q31_t golden_abs_q31[32] = {
+    2147483647, 2147483647, 2147483647, 1, 1342704362, 1639694697,
+    303376252, 720463763, 1158263646, 1920717517, 276891408, 1568059799,
+    661614354, 943036017, 1326271460, 1277204443, 1720136198, 259125333,
+    1098582520, 205299295, 1250570298, 1583613049, 1485346124, 342657315,
+    940629422, 625817309, 1954906592, 497703975, 919006818, 824257409,
+    1831248820, 277633899,
+};
+
+static const q15_t golden_abs_q15[32] = {
+    32767, 32767, 32767, 1, 32170, 7465, 18372, 30381,
+    28130, 10893, 7216, 12119, 31186, 21967, 13476, 12699,
+    10438, 32747, 16712, 5151, 11526, 12231, 10740, 25885,
+    5010, 355, 3744, 13849, 10530, 20671, 15476, 6869,
+};
+
+static const q31_t golden_add_q31[32] = {
+    2147483647, (q31_t)0x80000000, (q31_t)0x80000000, 2147483647, -1691374708, (q31_t)0x80000000,
+    -1576025752, -871142982, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000,
+    (q31_t)0x80000000, -974764802, (q31_t)0x80000000, (q31_t)0x80000000, -2071486636, -817705162,
+    -1806102928, -420370910, -1781630740, (q31_t)0x80000000, (q31_t)0x80000000, -452125030,
+    (q31_t)0x80000000, -1879679450, (q31_t)0x80000000, -931944814, (q31_t)0x80000000, (q31_t)0x80000000,
+    (q31_t)0x80000000, (q31_t)0x80000000,
+};
+
+static const q7_t golden_add_q7[32] = {
+    (q7_t)-128, (q7_t)-1, (q7_t)0, (q7_t)127, (q7_t)60, (q7_t)-2, (q7_t)-104, (q7_t)42,
+    (q7_t)84, (q7_t)54, (q7_t)112, (q7_t)34, (q7_t)-20, (q7_t)-18, (q7_t)127, (q7_t)127,
+    (q7_t)4, (q7_t)38, (q7_t)127, (q7_t)-110, (q7_t)-100, (q7_t)-34, (q7_t)-8, (q7_t)10,
+    (q7_t)-76, (q7_t)22, (q7_t)127, (q7_t)2, (q7_t)76, (q7_t)-50, (q7_t)-128, (q7_t)-128,
+};
+
+static const uint16_t golden_add_u8_u16[32] = {
+    255, 255, 510, 0, 236, 238, 200, 410,
+    260, 38, 160, 402, 412, 222, 248, 266,
+    180, 278, 208, 258, 332, 206, 296, 122,
+    100, 262, 256, 114, 252, 190, 344, 234,
+};
+
+static const q15_t golden_sub_q15[32] = {
+    32766, -32767, 0, -32766, -24928, 18976, 20384, 32767,
+    32767, -13280, -22112, -1760, -11616, 28192, -23648, (q15_t)-32768,
+    (q15_t)-32768, 12320, 15776, -736, 32767, 4640, 30624, 32767,
+    20640, 5152, 20896, 32767, -17760, 13856, -13408, 29472,
+};
+
+static const q7_t golden_sub_q7[32] = {
+    (q7_t)0, (q7_t)127, (q7_t)-2, (q7_t)-127, (q7_t)112, (q7_t)-80, (q7_t)-16, (q7_t)-128,
+    (q7_t)-128, (q7_t)127, (q7_t)-16, (q7_t)-128, (q7_t)112, (q7_t)-80, (q7_t)-16, (q7_t)48,
+    (q7_t)112, (q7_t)-80, (q7_t)-16, (q7_t)48, (q7_t)112, (q7_t)-80, (q7_t)-16, (q7_t)48,
+    (q7_t)-128, (q7_t)127, (q7_t)-16, (q7_t)48, (q7_t)-128, (q7_t)-80, (q7_t)-16, (q7_t)48,
+};
+
+static const q7_t golden_sub_u8_q7[32] = {
+    (q7_t)-128, (q7_t)127, (q7_t)0, (q7_t)0, (q7_t)127, (q7_t)32, (q7_t)127, (q7_t)32,
+    (q7_t)-96, (q7_t)32, (q7_t)-96, (q7_t)32, (q7_t)-96, (q7_t)32, (q7_t)-96, (q7_t)32,
+    (q7_t)127, (q7_t)32, (q7_t)-96, (q7_t)-128, (q7_t)-96, (q7_t)32, (q7_t)127, (q7_t)32,
+    (q7_t)-96, (q7_t)-128, (q7_t)-96, (q7_t)32, (q7_t)-96, (q7_t)32, (q7_t)-96, (q7_t)-128,
+};
+
+static const q7_t golden_mul_q7[32] = {
+    (q7_t)127, (q7_t)-127, (q7_t)-1, (q7_t)0, (q7_t)-18, (q7_t)-13, (q7_t)20, (q7_t)-82,
+    (q7_t)-27, (q7_t)-55, (q7_t)24, (q7_t)-83, (q7_t)-24, (q7_t)-12, (q7_t)77, (q7_t)41,
+    (q7_t)-25, (q7_t)-10, (q7_t)49, (q7_t)19, (q7_t)-5, (q7_t)-11, (q7_t)-1, (q7_t)-5,
+    (q7_t)-30, (q7_t)-60, (q7_t)84, (q7_t)-5, (q7_t)-30, (q7_t)-8, (q7_t)90, (q7_t)30,
+};
+
+static const uint16_t golden_mul_u8_u16[32] = {
+    0, 0, 65025, 0, 7524, 13905, 3600, 41769,
+    14596, 105, 4096, 40145, 40132, 12065, 13072, 17433,
+    1700, 19065, 8512, 4097, 25252, 10353, 15504, 3465,
+    196, 4617, 14080, 2993, 13572, 8769, 27280, 1145,
+};
+
+static const q15_t golden_neg_q15[32] = {
+    -32767, 32767, 32767, -1, 32170, 7465, -18372, -30381,
+    -28130, 10893, -7216, 12119, 31186, -21967, 13476, 12699,
+    10438, -32747, -16712, 5151, -11526, -12231, -10740, -25885,
+    -5010, -355, 3744, -13849, 10530, -20671, 15476, -6869,
+};
+
+static const q7_t golden_neg_q7[32] = {
+    (q7_t)127, (q7_t)-127, (q7_t)1, (q7_t)0, (q7_t)-86, (q7_t)41, (q7_t)60, (q7_t)83,
+    (q7_t)30, (q7_t)-115, (q7_t)-48, (q7_t)87, (q7_t)-46, (q7_t)49, (q7_t)-92, (q7_t)-101,
+    (q7_t)-58, (q7_t)21, (q7_t)-72, (q7_t)31, (q7_t)-6, (q7_t)57, (q7_t)12, (q7_t)-29,
+    (q7_t)110, (q7_t)-99, (q7_t)-96, (q7_t)-25, (q7_t)34, (q7_t)65, (q7_t)116, (q7_t)43,
+};
+
+static const q31_t golden_div_num_q31[8] = {
+    2147483647, (q31_t)0x80000000, (q31_t)0x80000000, -1675707718, -69837461, -159477560,
+    -961493663, -1083324282,
+};
+
+static const q31_t golden_div_den_q31[8] = {
+    0, 0, -1, -1675707718, -46858473, -125487767,
+    -56304015, -90705682,
+};
+
+static const q31_t golden_div_q31[8] = {
+    2147483647, (q31_t)0x80000000, 2147483647, 2147483647, 2147483647, 2147483647,
+    2147483647, 2147483647,
+};
+
+static const q63_t golden_div_num_q63[4] = {
+    -1099511627776LL, 1099511627776LL, -4611686018427387904LL, 123456789012LL,
+};
+
+static const uint32_t golden_div_den_u32[4] = {
+    0, 3, 7, 1000,
+};
+
+static const q31_t golden_div_s64_u32[4] = {
+    (q31_t)0x80000000, 2147483647, (q31_t)0x80000000, 123456789,
+};
+
+static const q31_t golden_div_u64_u32[4] = {
+    2147483647, 2147483647, 2147483647, 123456789,
+};
+
+#define GOLDEN_DPROD_Q31 (2281517146700319LL)
+#define GOLDEN_DPROD_U8XQ15 (-21449677)
+#define GOLDEN_DPROD_Q7 (-7119)
+#define GOLDEN_DPROD_Q7XQ15 (7713747)
+#define GOLDEN_DPROD_U8 (434067U)
+
+#define GOLDEN_OFFSET_Q31 (1073741824)
+#define GOLDEN_OFFSET_Q15 (-16384)
+#define GOLDEN_OFFSET_Q7 (64)
+#define GOLDEN_OFFSET_U8 (-80)
+
+static const q31_t golden_offset_q31[32] = {
+    2147483647, -1073741824, -1073741824, 1073741825, -268962538, -565952873,
+    770365572, 353278061, -84521822, -846975693, 796850416, -494317975,
+    412127470, 130705807, -252529636, -203462619, -646394374, 814616491,
+    -24840696, 868442529, -176828474, -509871225, -411604300, 731084509,
+    133112402, 447924515, -881164768, 576037849, 154735006, 249484415,
+    -757506996, 796107925,
+};
+
+static const q15_t golden_offset_q15[32] = {
+    16383, (q15_t)-32768, (q15_t)-32768, -16383, (q15_t)-32768, -23849, 1988, 13997,
+    11746, -27277, -9168, -28503, (q15_t)-32768, 5583, -29860, -29083,
+    -26822, 16363, 328, -21535, -4858, -4153, -5644, 9501,
+    -11374, -16029, -20128, -2535, -26914, 4287, -31860, -9515,
+};
+
+static const q7_t golden_offset_q7[32] = {
+    (q7_t)-64, (q7_t)127, (q7_t)63, (q7_t)64, (q7_t)127, (q7_t)23, (q7_t)4, (q7_t)-19,
+    (q7_t)34, (q7_t)127, (q7_t)112, (q7_t)-23, (q7_t)110, (q7_t)15, (q7_t)127, (q7_t)127,
+    (q7_t)122, (q7_t)43, (q7_t)127, (q7_t)33, (q7_t)70, (q7_t)7, (q7_t)52, (q7_t)93,
+    (q7_t)-46, (q7_t)127, (q7_t)127, (q7_t)89, (q7_t)30, (q7_t)-1, (q7_t)-52, (q7_t)21,
+};
+
+static const uint8_t golden_offset_u8[32] = {
+    0, 175, 175, 0, 118, 55, 100, 141,
+    2, 0, 0, 137, 78, 47, 0, 69,
+    90, 75, 0, 0, 38, 39, 148, 0,
+    0, 0, 0, 0, 0, 31, 44, 0,
+};
+
+#define GOLDEN_SCALE_FRACT_Q15 (24576)
+#define GOLDEN_SCALE_FRACT_Q7 (-64)
+
+static const q15_t golden_scale_q15[32] = {
+    32767, (q15_t)-32768, (q15_t)-32768, 1, (q15_t)-32768, -11198, 27558, 32767,
+    32767, -16340, 10824, -18179, (q15_t)-32768, 32767, -20214, -19049,
+    -15657, 32767, 25068, -7727, 17289, 18346, 16110, 32767,
+    7515, 532, -5616, 20773, -15795, 31006, -23214, 10303,
+};
+
+static const q7_t golden_scale_q7[32] = {
+    (q7_t)127, (q7_t)-128, (q7_t)2, (q7_t)0, (q7_t)-128, (q7_t)82, (q7_t)120, (q7_t)127,
+    (q7_t)60, (q7_t)-128, (q7_t)-96, (q7_t)127, (q7_t)-92, (q7_t)98, (q7_t)-128, (q7_t)-128,
+    (q7_t)-116, (q7_t)42, (q7_t)-128, (q7_t)62, (q7_t)-12, (q7_t)114, (q7_t)24, (q7_t)-58,
+    (q7_t)127, (q7_t)-128, (q7_t)-128, (q7_t)-50, (q7_t)68, (q7_t)127, (q7_t)127, (q7_t)86,
+};
+
+static const uint8_t golden_scale_u8[32] = {
+    0, 255, 255, 0, 255, 202, 255, 255,
+    123, 52, 48, 255, 237, 190, 114, 223,
+    255, 232, 84, 25, 177, 178, 255, 115,
+    3, 28, 120, 109, 117, 166, 186, 7,
+};
+
+static const q31_t golden_shift_left_q31[32] = {
+    2147483647, (q31_t)0x80000000, (q31_t)0x80000000, 8, (q31_t)0x80000000, (q31_t)0x80000000,
+    (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000,
+    (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, -2073002664,
+    (q31_t)0x80000000, -1642394360, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000,
+    (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000,
+    (q31_t)0x80000000, (q31_t)0x80000000,
+};
+
+static const q31_t golden_shift_right_q31[32] = {
+    536870911, -536870912, -536870912, 0, -335676091, -409923675,
+    -75844063, -180115941, -289565912, -480179380, -69222852, -392014950,
+    -165403589, -235759005, -331567865, -319301111, -430034050, -64781334,
+    -274645630, -51324824, -312642575, -395903263, -371336531, -85664329,
+    -235157356, -156454328, -488726648, -124425994, -229751705, -206064353,
+    -457812205, -69408475,
+};
+
+static const q7_t golden_shift_left_q7[32] = {
+    (q7_t)-128, (q7_t)127, (q7_t)-8, (q7_t)0, (q7_t)127, (q7_t)-128, (q7_t)-128, (q7_t)-128,
+    (q7_t)-128, (q7_t)127, (q7_t)127, (q7_t)-128, (q7_t)127, (q7_t)-128, (q7_t)127, (q7_t)127,
+    (q7_t)127, (q7_t)-128, (q7_t)127, (q7_t)-128, (q7_t)48, (q7_t)-128, (q7_t)-96, (q7_t)127,
+    (q7_t)-128, (q7_t)127, (q7_t)127, (q7_t)127, (q7_t)-128, (q7_t)-128, (q7_t)-128, (q7_t)-128,
+};
+
+static const q7_t golden_shift_right_q7[32] = {
+    (q7_t)-32, (q7_t)31, (q7_t)-1, (q7_t)0, (q7_t)21, (q7_t)-11, (q7_t)-15, (q7_t)-21,
+    (q7_t)-8, (q7_t)28, (q7_t)12, (q7_t)-22, (q7_t)11, (q7_t)-13, (q7_t)23, (q7_t)25,
+    (q7_t)14, (q7_t)-6, (q7_t)18, (q7_t)-8, (q7_t)1, (q7_t)-15, (q7_t)-3, (q7_t)7,
+    (q7_t)-28, (q7_t)24, (q7_t)24, (q7_t)6, (q7_t)-9, (q7_t)-17, (q7_t)-29, (q7_t)-11,
+};
+
+static const uint8_t golden_shift_left_u8[32] = {
+    0, 255, 255, 0, 255, 255, 255, 255,
+    164, 70, 64, 255, 255, 254, 152, 255,
+    255, 255, 112, 34, 236, 238, 255, 154,
+    4, 38, 160, 146, 156, 222, 248, 10,
+};
+
+static const uint8_t golden_shift_right_u8[32] = {
+    0, 31, 31, 0, 24, 16, 22, 27,
+    10, 4, 4, 27, 19, 15, 9, 18,
+    21, 19, 7, 2, 14, 14, 28, 9,
+    0, 2, 10, 9, 9, 13, 15, 0,
+};
+
+static const q31_t golden_clip_q31[32] = {
+    805306368, -1073741824, -1073741824, 1, -1073741824, -1073741824,
+    -303376252, -720463763, -1073741824, -1073741824, -276891408, -1073741824,
+    -661614354, -943036017, -1073741824, -1073741824, -1073741824, -259125333,
+    -1073741824, -205299295, -1073741824, -1073741824, -1073741824, -342657315,
+    -940629422, -625817309, -1073741824, -497703975, -919006818, -824257409,
+    -1073741824, -277633899,
+};
+
+static const q15_t golden_clip_q15[32] = {
+    12288, -16384, -16384, 1, -16384, -7465, 12288, 12288,
+    12288, -10893, 7216, -12119, -16384, 12288, -13476, -12699,
+    -10438, 12288, 12288, -5151, 11526, 12231, 10740, 12288,
+    5010, 355, -3744, 12288, -10530, 12288, -15476, 6869,
+};
+
+static const q7_t golden_clip_q7[32] = {
+    (q7_t)-64, (q7_t)48, (q7_t)-1, (q7_t)0, (q7_t)48, (q7_t)-41, (q7_t)-60, (q7_t)-64,
+    (q7_t)-30, (q7_t)48, (q7_t)48, (q7_t)-64, (q7_t)46, (q7_t)-49, (q7_t)48, (q7_t)48,
+    (q7_t)48, (q7_t)-21, (q7_t)48, (q7_t)-31, (q7_t)6, (q7_t)-57, (q7_t)-12, (q7_t)29,
+    (q7_t)-64, (q7_t)48, (q7_t)48, (q7_t)25, (q7_t)-34, (q7_t)-64, (q7_t)-64, (q7_t)-43,
+};
+
+static const uint8_t golden_and_u8[32] = {
+    0, 0, 255, 0, 6, 7, 20, 157,
+    18, 3, 0, 153, 158, 95, 12, 21,
+    10, 27, 24, 17, 86, 87, 68, 13,
+    2, 19, 16, 9, 14, 79, 92, 5,
+};
+
+static const uint8_t golden_or_u8[32] = {
+    255, 255, 255, 0, 230, 231, 180, 253,
+    242, 35, 160, 249, 254, 127, 236, 245,
+    170, 251, 184, 241, 246, 119, 228, 109,
+    98, 243, 240, 105, 238, 111, 252, 229,
+};
+
+static const uint8_t golden_xor_u8[32] = {
+    255, 255, 0, 0, 224, 224, 160, 96,
+    224, 32, 160, 96, 96, 32, 224, 224,
+    160, 224, 160, 224, 160, 32, 160, 96,
+    96, 224, 224, 96, 224, 32, 160, 224,
+};
+
+static const uint8_t golden_not_u8[32] = {
+    255, 0, 0, 255, 57, 120, 75, 34,
+    173, 220, 223, 38, 97, 128, 179, 106,
+    85, 100, 199, 238, 137, 136, 27, 178,
+    253, 236, 175, 182, 177, 144, 131, 250,
+};
+
+#define GOLDEN_MIN_Q15 ((q15_t)-32768)
+#define GOLDEN_MIN_Q15_INDEX (1)
+#define GOLDEN_ABSMAX_Q15 (32767)
+#define GOLDEN_ABSMAX_Q15_INDEX (0)
+#define GOLDEN_ABSMIN_Q15 (1)
+#define GOLDEN_ABSMIN_Q15_INDEX (3)
+#define GOLDEN_MAX_Q31 (2147483647)
+#define GOLDEN_MAX_Q31_INDEX (0)
+#define GOLDEN_MIN_Q31 ((q31_t)0x80000000)
+#define GOLDEN_MIN_Q31_INDEX (1)
+#define GOLDEN_ABSMAX_Q31 (2147483647)
+#define GOLDEN_ABSMAX_Q31_INDEX (0)
+#define GOLDEN_ABSMIN_Q31 (1)
+#define GOLDEN_ABSMIN_Q31_INDEX (3)
+#define GOLDEN_MAX_Q7 ((q7_t)127)
+#define GOLDEN_MAX_Q7_INDEX (1)
+#define GOLDEN_MIN_Q7 ((q7_t)-128)
+#define GOLDEN_MIN_Q7_INDEX (0)
+#define GOLDEN_ABSMAX_Q7 ((q7_t)127)
+#define GOLDEN_ABSMAX_Q7_INDEX (0)
+#define GOLDEN_ABSMIN_Q7 ((q7_t)0)
+#define GOLDEN_ABSMIN_Q7_INDEX (3)
+#define GOLDEN_MAX_U8 (255)
+#define GOLDEN_MAX_U8_INDEX (1)
+#define GOLDEN_MIN_U8 (0)
+#define GOLDEN_MIN_U8_INDEX (0)
+#define GOLDEN_MEAN_Q15 (2017)
+#define GOLDEN_MEAN_Q7 (1)
+#define GOLDEN_MEAN_U8 (111)
+#define GOLDEN_PWR_Q31 (49774095187881LL)
+#define GOLDEN_PWR_Q7 (165908)
+#define GOLDEN_RMS_Q31 (159638143)
+#define GOLDEN_VAR_Q15 (385802681)
+#define GOLDEN_STD_Q15 (19641)
+#define GOLDEN_VAR_Q31 (675635416944LL)
+#define GOLDEN_STD_Q31 (105212217)
+#define GOLDEN_STD_U8 (9963)
+
+static const q15_t golden_cconj_q15[32] = {
+    (q15_t)-32768, 32767, 32767, 32767, -25962, 18921, -17916, 25619,
+    -13790, 25421, 29296, -2537, 26222, -20751, 17820, -23461,
+    31610, 4309, 8072, -3361, -10938, -21255, -21452, -23133,
+    -46, -6307, 22432, -16217, 18206, 25601, 19916, -30741,
+};
+
+static const q31_t golden_cconj_q31[32] = {
+    2147483647, 2147483647, (q31_t)0x80000000, -1, -1342704362, 1639694697,
+    -303376252, 720463763, -1158263646, 1920717517, -276891408, 1568059799,
+    -661614354, 943036017, -1326271460, 1277204443, -1720136198, 259125333,
+    -1098582520, 205299295, -1250570298, 1583613049, -1485346124, 342657315,
+    -940629422, 625817309, -1954906592, 497703975, -919006818, 824257409,
+    -1831248820, 277633899,
+};
+
+static const q31_t golden_cmul_q31[32] = {
+    0, -2, 536870912, -536870913, -183826672, 261716735,
+    32309060, 112062593, 93683104, 499173669, -232031279, 414497362,
+    134646869, 199328496, 139812440, 406584636, 53507791, 122454620,
+    85345877, 44415630, -310302858, 404004033, 355293865, 101899618,
+    138136801, 289983974, 186755475, 152777045, 6365740, 268453668,
+    194802335, 439054528,
+};
+
+#define GOLDEN_CDPROD_TYP2_RE_Q15 (39038940)
+#define GOLDEN_CDPROD_TYP2_IM_Q15 (-45858256)
+#define GOLDEN_CDPROD_TYP2_RE_Q31 (645592231232673LL)
+#define GOLDEN_CDPROD_TYP2_IM_Q31 (1666992416540823LL)
+
+static const q15_t golden_cmag_q15[16] = {
+    11585, 11585, 8031, 7815, 7230, 7351, 8359, 7365,
+    7975, 2185, 5976, 7887, 1576, 6920, 7853, 9157,
+};
+
+static const q31_t golden_cmag_q31[16] = {
+    759250124, 536870912, 529826251, 195433042, 560732247, 398079796,
+    287994192, 460315596, 434886082, 279400178, 504464837, 381089486,
+    282448116, 504316928, 308623335, 463043789,
+};
+
+static const q15_t golden_cmag_sqr_q15[16] = {
+    16384, 16383, 7873, 7456, 6381, 6597, 8531, 6622,
+    7764, 583, 4359, 7593, 303, 5845, 7529, 10236,
+};
+
+static const q15_t golden_cmul_real_q15[32] = {
+    32767, 32767, 32766, -32767, -25962, -18921, 17916, 25619,
+    -3013, -5554, 2738, 237, -24094, -19067, -14925, -19649,
+    372, -51, 7099, 2955, 1981, -3851, 13275, -14317,
+    27, -3755, -21918, -15846, -8821, 12403, -17346, -26774,
+};
+
+static const q31_t golden_cmul_real_q31[32] = {
+    0, -1, 1, -1, 1342704362, 1639694697,
+    -303376252, -720463763, 188058328, 311852079, 160983438, 911663021,
+    392088283, 558865403, 93058472, 89615661, 1459723826, 219896205,
+    347858061, 65006509, 1155553028, 1463291474, 1121524799, 258726683,
+    785528954, 522626238, 28883484, 7353509, 764125242, 685344091,
+    779271965, 118144684,
+};
+
+static const q7_t golden_fir_coeff_q7[8] = {
+    (q7_t)96, (q7_t)25, (q7_t)-34, (q7_t)-65, (q7_t)-116, (q7_t)-43, (q7_t)-22, (q7_t)-37,
+};
+
+static const q31_t golden_fir_fast_q31[32] = {
+    -158685524, 70788894, 152436768, 18994108, 89816618, 378348506,
+    420597034, 603709584, 726355332, 674693492, 554539266, 643413990,
+    587354730, 634051792, 670582084, 708447218, 661932130, 606294374,
+    659074640, 624688988, 691751584, 659350354, 637023778, 487157534,
+    569598362, 606251332, 726710604, 628537648, 590648036, 540247650,
+    666807110, 572052028,
+};
+
+static const q15_t golden_fir_fast_q15[32] = {
+    32172, -29418, (q15_t)-32768, -3908, -32541, 9502, (q15_t)-32768, 32767,
+    32767, -6613, (q15_t)-32768, (q15_t)-32768, 32767, 23044, 17013, -2615,
+    16722, 32767, 15894, 7676, 7236, -16621, -27366, 18537,
+    1390, -28077, -29070, -10629, -22510, 20911, -7368, -5716,
+};
+
+static const q7_t golden_fir_q7[32] = {
+    (q7_t)37, (q7_t)-15, (q7_t)21, (q7_t)73, (q7_t)-75, (q7_t)-33, (q7_t)-63, (q7_t)-101,
+    (q7_t)127, (q7_t)51, (q7_t)109, (q7_t)120, (q7_t)-124, (q7_t)-120, (q7_t)-78, (q7_t)-39,
+    (q7_t)74, (q7_t)-90, (q7_t)-128, (q7_t)-100, (q7_t)-77, (q7_t)44, (q7_t)95, (q7_t)43,
+    (q7_t)86, (q7_t)66, (q7_t)-35, (q7_t)24, (q7_t)-114, (q7_t)-96, (q7_t)-42, (q7_t)-17,
+};
+
+static const q15_t golden_lfir_coeff_q15[4] = {
+    3838, 4660, -2099, -5235,
+};
+
+static const q31_t golden_lfir_coeff_q31[4] = {
+    -429709335, -174651325, -317288912, -68133452,
+};
+
+static const q15_t golden_lfir_q15[32] = {
+    32767, -28350, -29672, -10301, (q15_t)-32768, -4771, 18294, 32767,
+    32767, -4189, 3474, -19441, (q15_t)-32768, 17532, -14152, -7497,
+    -10529, 27534, 23175, 3408, 11745, 6880, 11445, 28561,
+    6837, 1080, -7025, 8827, -9913, 21062, -14437, 5772,
+};
+
+static const q31_t golden_lfir_q31[32] = {
+    2147483647, -2076664846, -1859102688, 251345410, -974554090, -1041583612,
+    109209790, -392697200, -746021050, -1594166062, 216998171, -1233367191,
+    -74972163, -649881823, -902051461, -862197575, -1281941998, 313981097,
+    -741233854, 277182652, -1067192027, -1199300500, -1091029824, 173103319,
+    -540435846, -189040214, -1705098111, 6548108, -614399405, -346532262,
+    -1512450195, 218202776,
+};
+
+static const q15_t golden_dcmfir_q15[16] = {
+    32172, (q15_t)-32768, -32541, 32767, 32767, (q15_t)-32768, (q15_t)-32768, 17013,
+    16722, 15894, 7236, -27366, 1390, -29070, -22510, -7368,
+};
+
+static const q15_t golden_dcmfir_fast_q15[16] = {
+    32172, (q15_t)-32768, -32541, (q15_t)-32768, 32767, (q15_t)-32768, 32767, 17013,
+    16722, 15894, 7236, -27366, 1390, -29070, -22510, -7368,
+};
+
+static const q31_t golden_dcmfir_q31[16] = {
+    -158685524, 152436770, 89816623, 420597040, 726355337, 554539273,
+    587354738, 670582090, 661932138, 659074645, 691751593, 637023784,
+    569598366, 726710611, 590648042, 666807117,
+};
+
+static const q31_t golden_dcmfir_fast_q31[16] = {
+    -158685524, 152436768, 89816618, 420597034, 726355332, 554539266,
+    587354730, 670582084, 661932130, 659074640, 691751584, 637023778,
+    569598362, 726710604, 590648036, 666807110,
+};
+
+static const q15_t golden_upsplfir_q15[64] = {
+    32172, 2755, (q15_t)-32768, -15726, (q15_t)-32768, -8962, 32767, 32767,
+    -14287, 11723, -4172, 7358, 32767, 23326, 20779, -5008,
+    306, -21492, (q15_t)-32768, -27169, -3259, -7144, 1304, 6573,
+    (q15_t)-32768, -3627, 32767, 22328, 224, 6666, (q15_t)-32768, -13107,
+    10578, 15216, 32767, 12365, 9527, -7288, (q15_t)-32768, -27724,
+    8482, -2029, 16205, 1901, -4249, -11430, 14902, -7563,
+    -9702, -14338, -19027, -15546, -1071, 361, 15959, 3164,
+    -12301, -4125, 12248, -2741, -10809, -1316, -6628, -6919,
+};
+
+static const q31_t golden_upsplfir_q31[64] = {
+    -158685524, -87896629, 64540141, -75151270, -13763152, 23530998,
+    138934528, 305468688, 587616373, 367363236, 401832002, 254050493,
+    260988301, 279100455, 408776073, 279303676, 324192763, 199131473,
+    313481754, 254858767, 322868094, 308335661, 486083741, 334444867,
+    350389815, 251474987, 321951416, 265844301, 383438725, 258008291,
+    337927278, 279023920, 445148781, 345149526, 390098879, 328951446,
+    437997704, 297346567, 273166426, 187332920, 264554391, 193366237,
+    310798389, 224987270, 355636602, 321589062, 416197675, 343995828,
+    432488268, 284486975, 283434772, 192105504, 324054844, 240701780,
+    297324382, 272298189, 397053289, 307191780, 364897204, 233589235,
+    336946758, 254553671, 298042995, 274060550,
+};
+
+static const int32_t golden_spafir_delay[4] = {
+    0, 1, 3, 6,
+};
+
+#define GOLDEN_SPAFIR_DELAY (6)
+
+static const q15_t golden_spafir_coeff_q15[4] = {
+    -7036, 4162, -6205, 2891,
+};
+
+static const q31_t golden_spafir_coeff_q31[4] = {
+    -2082324676, -1157536571, -2119557606, -323556021,
+};
+
+static const q7_t golden_spafir_coeff_q7[4] = {
+    (q7_t)-88, (q7_t)-63, (q7_t)102, (q7_t)-89,
+};
+
+static const q15_t golden_spafir_q15[32] = {
+    -7036, 11197, 2874, -10368, 13112, 3721, -2003, -990,
+    -3659, 2433, -11525, -2467, 8840, -7364, 10460, 5959,
+    -2895, -6875, 224, 7143, -10520, -5448, -699, -3488,
+    1370, -1929, -3036, -3319, 4900, -2784, 3768, -1416,
+};
+
+static const q31_t golden_spafir_q31[32] = {
+    -2082324676, 924788104, 2147483647, -962021038, 2147483647, (q31_t)0x80000000,
+    854443366, 2147483647, 2147483647, 2147483647, 2147483647, 2147483647,
+    2147483647, 1652886928, 2147483647, 2147483647, 2147483647, 2147483647,
+    2147483647, 2147483647, 1778867566, 2147483647, 2147483647, 2147483647,
+    2147483647, 2147483647, 2147483647, 2147483647, 2000867220, 2147483647,
+    2147483647, 2147483647,
+};
+
+static const q7_t golden_spafir_q7[32] = {
+    (q7_t)88, (q7_t)-25, (q7_t)-62, (q7_t)-102, (q7_t)42, (q7_t)-15, (q7_t)127, (q7_t)66,
+    (q7_t)29, (q7_t)-113, (q7_t)-128, (q7_t)40, (q7_t)127, (q7_t)107, (q7_t)-88, (q7_t)-128,
+    (q7_t)-128, (q7_t)119, (q7_t)9, (q7_t)66, (q7_t)-70, (q7_t)23, (q7_t)-29, (q7_t)5,
+    (q7_t)-35, (q7_t)-2, (q7_t)-96, (q7_t)-113, (q7_t)98, (q7_t)117, (q7_t)127, (q7_t)-10,
+};
+
+static const q31_t golden_lms_q31_out[32] = {
+    0, 0, 0, 0, 392958, -1931218,
+    859919, -57795, -2474689, -4592972, -2391537, -5319029,
+    -8639051, -7013551, -9620525, -11479517, -13178152, -10961965,
+    -12131367, -12347543, -11400363, -14668817, -15492131, -15383470,
+    -14383704, -17465045, -19472311, -20803067, -18956296, -20665666,
+    -21890874, -21153928,
+};
+
+static const q31_t golden_lms_q31_err[32] = {
+    0, -1, -268435456, 268435455, -43976752, -154135968,
+    -159941107, -18777108, -225322175, -80405138, -245648421, -197365730,
+    -215534060, 3047452, -213575108, -102750851, -30740653, -58860514,
+    -76308684, -14536409, -54982193, -248148675, -244502907, 1700005,
+    -247578482, -139267723, -96923321, -33477038, -141068569, -149461747,
+    -127916721, -213570890,
+};
+
+static const q31_t golden_lms_q31_coeff[8] = {
+    49048216, 48117849, 44608637, 52184962, 65644447, 30657894,
+    56156788, 63289905,
+};
+
+static const q15_t golden_lms_q15_out[32] = {
+    0, 0, 0, 0, 2, -163, 329, 112,
+    -81, -187, 73, 541, -92, 174, 122, -547,
+    114, 218, -439, -500, 547, 274, -397, -225,
+    140, -241, -36, -58, -367, -273, 157, -126,
+};
+
+static const q15_t golden_lms_q15_err[32] = {
+    0, -1, -8192, 8191, -1813, -6448, -832, -3213,
+    -7775, 783, 7259, -3131, -4801, -1731, 2421, 6900,
+    7732, 4888, 673, -604, -6282, 1623, -4574, -4512,
+    -4048, -959, -6124, -4744, 2174, 1976, -674, -5525,
+};
+
+static const q15_t golden_lms_q15_coeff[8] = {
+    437, -432, -1540, -203, 629, -1628, -574, -172,
+};
+
+static const q31_t golden_nlms_q31_out[32] = {
+    0, 0, 0, 0, 12574676, -63127863,
+    32747164, -9073257, -64923757, -136453385, -47283292, -120299825,
+    -207154766, -134845028, -156602135, -157438192, -156931434, -95674171,
+    -61900899, -119538118, -20223899, -110237046, -122034038, -154999961,
+    -107472257, -174002783, -193148771, -154145767, -75649929, -151974874,
+    -161218934, -101799730,
+};
+
+static const q31_t golden_nlms_q31_err[32] = {
+    0, -1, -268435456, 268435455, -56158470, -92939323,
+    -191828352, -9761646, -162873107, 51455275, -200756666, -82384934,
+    -17018345, 130878929, -66593498, 43207824, 113012629, 25851692,
+    -26539152, 92654166, -46158657, -152580446, -137961000, 141316496,
+    -154489929, 17270015, 76753139, 99865662, -84374936, -18152539,
+    11411339, -132925088,
+};
+
+static const q31_t golden_nlms_q31_coeff[8] = {
+    267721228, 508193326, 227147283, 278808262, 824353816, -63377059,
+    448357879, 762295404,
+};
+
+static const q15_t golden_nlms_q15_out[32] = {
+    0, 0, 0, 0, 25, -1726, 3517, 666,
+    -608, -1938, 1197, 5150, -2367, 1403, 389, -3171,
+    -67, 1062, -3192, -3706, 4838, -531, -2741, -2511,
+    -801, -3345, -1833, -2756, -3571, -2786, 906, -163,
+};
+
+static const q15_t golden_nlms_q15_err[32] = {
+    0, -1, -8192, 8191, -1836, -4885, -4020, -3767,
+    -7248, 2534, 6135, -7740, -2526, -2960, 2154, 9524,
+    7913, 4044, 3426, 2602, -10573, 2428, -2230, -2226,
+    -3107, 2145, -4327, -2046, 5378, 4489, -1423, -5488,
+};
+
+static const q15_t golden_nlms_q15_coeff[8] = {
+    3695, -1751, -5568, -9233, -6109, -11294, 801, -2129,
+};
+
+static const q31_t golden_conv_q31[18] = {
+    0, -1, -268435455, 536870911, -43583794, -380918848,
+    208407837, 352272164, 19291949, 182994307, 279510785, 253441676,
+    -107138176, 337924207, 35000994, 194229968, 134469425, 116158656,
+};
+
+static const q7_t golden_conv_q7[18] = {
+    (q7_t)127, (q7_t)1, (q7_t)-127, (q7_t)-126, (q7_t)66, (q7_t)-111, (q7_t)127, (q7_t)127,
+    (q7_t)54, (q7_t)-111, (q7_t)-128, (q7_t)22, (q7_t)127, (q7_t)42, (q7_t)-51, (q7_t)-8,
+    (q7_t)-44, (q7_t)29,
+};
+
+static const q31_t golden_corr_q31[23] = {
+    0, 0, 0, 0, 0, -159081187,
+    3014002, 271564579, 468086433, -393822330, 219045519, 437323420,
+    -59141794, 107194418, 408120810, 131469982, 120538111, 24270734,
+    237302485, -161396049, 196007474, 0, -1,
+};
+
+static const q7_t golden_corr_q7[23] = {
+    (q7_t)-121, (q7_t)56, (q7_t)123, (q7_t)-128, (q7_t)69, (q7_t)127, (q7_t)-128, (q7_t)127,
+    (q7_t)-78, (q7_t)2, (q7_t)109, (q7_t)-9, (q7_t)-51, (q7_t)-27, (q7_t)-128, (q7_t)-46,
+    (q7_t)101, (q7_t)60, (q7_t)0, (q7_t)0, (q7_t)0, (q7_t)0, (q7_t)0,
+};
+
+static const q15_t golden_bq_coeff_q15[10] = {
+    1106, 2212, 1106, 18727, -6763, 3277, 6554, 3277,
+    4915, -1638,
+};
+
+static const q31_t golden_bq_fast_q31[32] = {
+    7247756, 32201776, 47513012, -754364, -104137540, -199538776,
+    -258562252, -284985652, -279648232, -259345164, -253202320, -264273408,
+    -273745536, -272556100, -264244444, -257894756, -264503112, -283720712,
+    -297337820, -286924992, -254789528, -223325732, -218484976, -243857708,
+    -271072372, -272445836, -253968940, -242430780, -247227452, -252305144,
+    -249007072, -248723340,
+};
+
+static const q31_t golden_bq_32x64_q31[32] = {
+    7247757, 32201785, 47513027, -754332, -104137497, -199538728,
+    -258562197, -284985597, -279648177, -259345108, -253202259, -264273352,
+    -273745474, -272556039, -264244388, -257894698, -264503060, -283720656,
+    -297337765, -286924937, -254789472, -223325683, -218484935, -243857668,
+    -271072332, -272445796, -253968902, -242430735, -247227406, -252305097,
+    -249007025, -248723288,
+};
+
+static const q15_t golden_bq_q15[32] = {
+    110, 490, 723, -14, -1631, -3203, -4061, -3743,
+    -1954, 729, 2918, 3594, 2768, 1052, -636, -1550,
+    -1844, -1926, -1475, -168, 1351, 2250, 2532, 2675,
+    2961, 3272, 3200, 2570, 1724, 1074, 742, 593,
+};
+
+static const q15_t golden_bq_fast_q15[32] = {
+    110, 490, 723, -14, -1631, -3203, -4061, -3743,
+    -1954, 729, 2918, 3594, 2768, 1052, -636, -1550,
+    -1844, -1926, -1475, -168, 1351, 2250, 2532, 2675,
+    2961, 3272, 3200, 2570, 1724, 1074, 742, 593,
+};
+
+static const q31_t golden_liir_rcoeff_q31[3] = {
+    -11907467, -100066849, -307391076,
+};
+
+static const q31_t golden_liir_lcoeff_q31[4] = {
+    -184240296, -241613848, -27090993, -33428233,
+};
+
+static const q15_t golden_liir_rcoeff_q15[3] = {
+    -4089, 7131, -7603,
+};
+
+static const q15_t golden_liir_lcoeff_q15[4] = {
+    -1991, 2023, 715, -3978,
+};
+
+static const q31_t golden_liir_q31[32] = {
+    -4317575, 7311412, -52595923, -2365448, 100196466, 60365004,
+    44521598, 80458639, 57277761, 38333709, 50294291, 84872847,
+    60969108, 58730087, 62667777, 49882804, 64977686, 69776350,
+    85287871, 57182126, 47506020, 39400640, 44131759, 73031554,
+    84914506, 55343466, 45781439, 42933062, 71969248, 66624048,
+    48758550, 48085826,
+};
+
+static const q15_t golden_liir_q15[32] = {
+    -864, 506, 1988, -688, 33, 1215, -830, -1074,
+    -313, 613, 79, -517, 1062, -378, -600, 1330,
+    221, -1229, -819, 992, -90, -1093, -199, -438,
+    -395, 298, -58, -567, 35, -34, -162, 400,
+};
+
+static const float golden_bq_coeff_f32[10] = {
+    6.750000268e-02f, 1.350000054e-01f, 6.750000268e-02f, 1.143000007e+00f,
+    -4.128000140e-01f, 2.000000030e-01f, 4.000000060e-01f, 2.000000030e-01f,
+    3.000000119e-01f, -1.000000015e-01f,
+};
+
+static const double golden_bq_df2T_f64[32] = {
+    -1.73592871971535237e-02, -7.72540799091657460e-02, -8.58263732344589081e-02, 2.02528659389693472e-01,
+    8.63048928210378929e-01, 1.53174569756971546e+00, 1.67924988297777178e+00, 1.06929535797106889e+00,
+    -6.38455089407584109e-02, -1.16896393207676841e+00, -1.85153675631471737e+00, -2.08689243368533717e+00,
+    -1.89099190648500604e+00, -1.30816421127776805e+00, -6.22447389957858421e-01, -3.37999468824649041e-02,
+    4.95279460213582601e-01, 8.15909357065992658e-01, 6.83659375266060687e-01, 3.45657088156283099e-01,
+    3.58663104553859635e-01, 8.54470594682857021e-01, 1.48296713163842231e+00, 1.88903881612293789e+00,
+    1.85937859894220114e+00, 1.39543535751717873e+00, 8.48325002763214098e-01, 4.91510015466857852e-01,
+    1.66150570761532529e-01, -2.74056894702877418e-01, -7.20523947231094142e-01, -1.07686020758358914e+00,
+};
+
+static const float golden_bq_df2T_f32[32] = {
+    -1.735928720e-02f, -7.725407991e-02f, -8.582637323e-02f, 2.025286594e-01f,
+    8.630489282e-01f, 1.531745698e+00f, 1.679249883e+00f, 1.069295358e+00f,
+    -6.384550894e-02f, -1.168963932e+00f, -1.851536756e+00f, -2.086892434e+00f,
+    -1.890991906e+00f, -1.308164211e+00f, -6.224473900e-01f, -3.379994688e-02f,
+    4.952794602e-01f, 8.159093571e-01f, 6.836593753e-01f, 3.456570882e-01f,
+    3.586631046e-01f, 8.544705947e-01f, 1.482967132e+00f, 1.889038816e+00f,
+    1.859378599e+00f, 1.395435358e+00f, 8.483250028e-01f, 4.915100155e-01f,
+    1.661505708e-01f, -2.740568947e-01f, -7.205239472e-01f, -1.076860208e+00f,
+};
+
+static const float golden_bq_stereo_df2T_f32[32] = {
+    -1.735928720e-02f, 1.723252063e-02f, -4.846403695e-02f, 1.401521206e-01f,
+    2.676618346e-02f, 4.661308115e-01f, 2.437908469e-01f, 8.159583642e-01f,
+    3.177907715e-01f, 7.145812227e-01f, 4.623579388e-02f, -1.155491718e-02f,
+    -3.534954355e-01f, -8.610720765e-01f, -5.635719473e-01f, -1.211126874e+00f,
+    -4.701446577e-01f, -9.527946217e-01f, -2.198945620e-01f, -3.773388425e-01f,
+    -3.107258206e-03f, 2.762963770e-01f, 2.559624320e-01f, 8.852996749e-01f,
+    6.916113085e-01f, 1.221657327e+00f, 1.129606033e+00f, 1.127326939e+00f,
+    1.246565008e+00f, 7.020361182e-01f, 9.376909443e-01f, 1.311718666e-01f,
+};
+
+static const q15_t golden_mat_add_q15[32] = {
+    32767, (q15_t)-32768, (q15_t)-32768, 32767, (q15_t)-32768, (q15_t)-32768, 16360, 17978,
+    -3292, -8506, 32767, -22478, (q15_t)-32768, 15742, -3304, 12714,
+    20948, 32767, 17648, -9566, -11412, 19822, -9144, 6938,
+    -10620, -4442, -28384, -5358, -3300, 27486, -17544, -15734,
+};
+
+static const q31_t golden_mat_add_q31[32] = {
+    2147483647, (q31_t)0x80000000, (q31_t)0x80000000, 2147483647, -1691374708, (q31_t)0x80000000,
+    -1576025752, -871142982, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000, (q31_t)0x80000000,
+    (q31_t)0x80000000, -974764802, (q31_t)0x80000000, (q31_t)0x80000000, -2071486636, -817705162,
+    -1806102928, -420370910, -1781630740, (q31_t)0x80000000, (q31_t)0x80000000, -452125030,
+    (q31_t)0x80000000, -1879679450, (q31_t)0x80000000, -931944814, (q31_t)0x80000000, (q31_t)0x80000000,
+    (q31_t)0x80000000, (q31_t)0x80000000,
+};
+
+static const q15_t golden_mat_sub_q15[32] = {
+    32766, -32767, 0, -32766, -24928, 18976, 20384, 32767,
+    32767, -13280, -22112, -1760, -11616, 28192, -23648, (q15_t)-32768,
+    (q15_t)-32768, 12320, 15776, -736, 32767, 4640, 30624, 32767,
+    20640, 5152, 20896, 32767, -17760, 13856, -13408, 29472,
+};
+
+static const q31_t golden_mat_sub_q31[32] = {
+    2147483646, -2147483647, 0, -2147483646, -994034016, -391157216,
+    969273248, -569784544, 664111264, -1240732640, 1707428256, 53418272,
+    1131770528, -911307232, 459293600, -363361504, -1368785760, 299454496,
+    -391062112, 9772320, -719509856, 518926880, 594614176, -233189600,
+    1155068064, 628044832, -1023741536, -63463136, 361192096, 536761888,
+    -632788064, 1600164640,
+};
+
+static const q15_t golden_mat_mul_fast_q15[12] = {
+    -11542, 25756, 15109, 25060, 11686, (q15_t)-32768, -556, 32767,
+    21340, -8156, 5848, -17163,
+};
+
+static const q31_t golden_mat_mul_q31[12] = {
+    30808947, 64898480, 254980646, 261794183, 149805831, 612380360,
+    28777042, 148999586, 445600996, -130908359, 164451664, 437171920,
+};
+
+static const q31_t golden_mat_mul_fast_q31[12] = {
+    30808944, 64898476, 254980642, 261794180, 149805826, 612380356,
+    28777036, 148999582, 445600994, -130908366, 164451662, 437171914,
+};
+
+static const q7_t golden_mat_mul_q7[12] = {
+    (q7_t)127, (q7_t)122, (q7_t)109, (q7_t)-35, (q7_t)-16, (q7_t)-24, (q7_t)-128, (q7_t)12,
+    (q7_t)46, (q7_t)-55, (q7_t)-105, (q7_t)41,
+};
+
+static const q7_t golden_mat_mul_vxm_q7[3] = {
+    (q7_t)127, (q7_t)122, (q7_t)109,
+};
+
+static const q15_t golden_mat_mul_mxv_q15[4] = {
+    32767, 154, 32767, -14898,
+};
+
+static const q31_t golden_mat_mul_mxv_q31[4] = {
+    295686024, -15743476, -8260651, -100765541,
+};
+
+static const q7_t golden_mat_mul_mxv_q7[4] = {
+    (q7_t)-17, (q7_t)47, (q7_t)-28, (q7_t)-82,
+};
+
+static const q15_t golden_mat_scale_q15[32] = {
+    32767, (q15_t)-32768, (q15_t)-32768, 1, (q15_t)-32768, -11198, 27558, 32767,
+    32767, -16340, 10824, -18179, (q15_t)-32768, 32767, -20214, -19049,
+    -15657, 32767, 25068, -7727, 17289, 18346, 16110, 32767,
+    7515, 532, -5616, 20773, -15795, 31006, -23214, 10303,
+};
+
+static const q31_t golden_mat_scale_q31[32] = {
+    2147483647, (q31_t)0x80000000, (q31_t)0x80000000, 1, -2014056543, (q31_t)0x80000000,
+    -455064378, -1080695645, -1737395469, (q31_t)0x80000000, -415337112, (q31_t)0x80000000,
+    -992421531, -1414554026, -1989407190, -1915806665, (q31_t)0x80000000, -388688000,
+    -1647873780, -307948943, -1875855447, (q31_t)0x80000000, (q31_t)0x80000000, -513985973,
+    -1410944133, -938725964, (q31_t)0x80000000, -746555963, -1378510227, -1236386114,
+    (q31_t)0x80000000, -416450849,
+};
+
+static const q15_t golden_mat_trans_q15[20] = {
+    32767, -7465, 7216, -12699, (q15_t)-32768, 18372, -12119, -10438,
+    (q15_t)-32768, 30381, -31186, 32747, 1, 28130, 21967, 16712,
+    -32170, -10893, -13476, -5151,
+};
+
+static const q31_t golden_mat_trans_q31[20] = {
+    2147483647, -1639694697, -276891408, -1277204443, (q31_t)0x80000000, -303376252,
+    -1568059799, -1720136198, (q31_t)0x80000000, -720463763, -661614354, -259125333,
+    1, -1158263646, -943036017, -1098582520, -1342704362, -1920717517,
+    -1326271460, -205299295,
+};
+
+static const uint8_t golden_mat_trans_u8[20] = {
+    0, 135, 32, 149, 255, 180, 217, 170,
+    255, 221, 158, 155, 0, 82, 127, 56,
+    198, 35, 76, 17,
+};
+
+static const q7_t golden_mat_trans_q7[20] = {
+    (q7_t)-128, (q7_t)-41, (q7_t)48, (q7_t)101, (q7_t)127, (q7_t)-60, (q7_t)-87, (q7_t)58,
+    (q7_t)-1, (q7_t)-83, (q7_t)46, (q7_t)-21, (q7_t)0, (q7_t)-30, (q7_t)-49, (q7_t)72,
+    (q7_t)86, (q7_t)115, (q7_t)92, (q7_t)-31,
+};
+
+static const q31_t golden_mat_oprod_q31[20] = {
+    0, -1, -2147483647, 2147483646, -348670346, -1,
+    1, 2147483647, -2147483647, 348670346, -1, 1,
+    2147483647, -2147483647, 348670346, 0, -1, -1,
+    0, -1,
+};
+
+static const q15_t golden_cmat_mul_q15[8] = {
+    32767, -27151, (q15_t)-32768, 22161, 32767, 26656, (q15_t)-32768, 8614,
+};
+
+static const q31_t golden_cmat_mul_q31[8] = {
+    15139136, 47893052, 19926080, 108977818, -18596567, 37556366,
+    10115018, 51478275,
+};
+
+#endif /* GOLDEN_VECTORS_H */
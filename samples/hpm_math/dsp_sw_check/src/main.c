@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include "board.h"
+#include "hpm_csr_drv.h"
+#include "hpm_clock_drv.h"
+#include "hpm_math.h"
+#include "dsp_sw_check.h"
+
+uint64_t dsp_sw_check_get_ticks(void)
+{
+    return hpm_csr_get_core_mcycle();
+}
+
+const char *dsp_sw_check_tick_unit(void)
+{
+    return "cycles";
+}
+
+int main(void)
+{
+    uint32_t failed;
+
+    board_init();
+    printf("cpu0:\t\t %dHz\n\n", clock_get_frequency(clock_cpu0));
+#if HPM_DSP_CORE == HPM_DSP_SW
+    printf("riscv_dsp: portable C implementation\n\n");
+#else
+    printf("riscv_dsp: andes dsp library\n\n");
+#endif
+
+    failed = dsp_sw_check_run_golden();
+    printf("\n");
+    dsp_sw_check_run_benchmark();
+    printf("\n%s\n", (failed == 0) ? "dsp check PASSED" : "dsp check FAILED");
+
+    while (1) {
+    }
+    return 0;
+}
@@ -33,6 +33,14 @@ ffa_q31_t ffa_buf[FFT_COMPLEX_MAX];
 q31_t ffa_buf[FFT_COMPLEX_MAX];
 #endif
 
+#define FFT_PLAN_MAX_LOG2 (10)
+float fft_twiddle[HPM_SOFTWARE_FFT_TWIDDLE_SIZE(FFT_PLAN_MAX_LOG2)];
+uint16_t fft_bitrev[HPM_SOFTWARE_CFFT_BITREV_SIZE(FFT_PLAN_MAX_LOG2)];
+fft_type_t fft_plan_buf[FFT_COMPLEX_MAX];
+#ifdef HPMSOC_HAS_HPMSDK_FFA
+q15_t ffa_q15_buf[FFT_COMPLEX_MAX];
+#endif
+
 uint32_t run_times;
 uint64_t delta_time;
 
@@ -106,6 +114,119 @@ void fft_printf(fft_type_t *buf, fft_type_t *output, uint16_t num)
     printf("------------------------------------\r\n");
 }
 
+#ifdef HPMSOC_HAS_HPMSDK_FFA
+void ffa_buf_flush(void *buf, uint32_t size)
+{
+    if (l1c_dc_is_enabled()) {
+        l1c_dc_flush(HPM_L1C_CACHELINE_ALIGN_DOWN((uint32_t)buf),
+            HPM_L1C_CACHELINE_ALIGN_UP((uint32_t)buf + size) - HPM_L1C_CACHELINE_ALIGN_DOWN((uint32_t)buf));
+    }
+}
+
+void ffa_buf_invalidate(void *buf, uint32_t size)
+{
+    if (l1c_dc_is_enabled()) {
+        l1c_dc_invalidate(HPM_L1C_CACHELINE_ALIGN_DOWN((uint32_t)buf),
+            HPM_L1C_CACHELINE_ALIGN_UP((uint32_t)buf + size) - HPM_L1C_CACHELINE_ALIGN_DOWN((uint32_t)buf));
+    }
+}
+#endif
+
+uint32_t fft_check(fft_type_t *buf, fft_type_t *ref, uint32_t num, fft_type_t precision)
+{
+    uint32_t err = 0;
+    for (uint32_t i = 0; i < num; i++) {
+        if ((buf[i] > ref[i] + precision) || (buf[i] < ref[i] - precision)) {
+            err++;
+        }
+    }
+    return err;
+}
+
+/**
+ * @brief Planned software fft of 2^m samples against the software cooley-tukey fft and the ffa.
+ * The planned transforms are checked against the cooley-tukey spectrum and their inverses.
+ *
+ * @param[in] m base 2 logarithm of the number of samples
+ * @return number of errors
+ */
+uint32_t fft_plan_test(uint8_t m)
+{
+    uint16_t point = 1 << m;
+    uint32_t err = 0;
+    uint32_t legacy_times, cfft_times, cifft_times, rfft_times, rifft_times;
+    hpm_software_fft_plan_t plan;
+
+    /* reference spectrum */
+    init_fft_inputbuf(&fft_buf[0], point);
+    start_time();
+    hpm_software_cfft_float(&fft_buf[0], m);
+    legacy_times = get_end_time();
+
+    /* complex */
+    start_time();
+    hpm_software_cfft_plan_init(&plan, m, fft_twiddle, fft_bitrev);
+    run_times = get_end_time();
+    printf("Software fft plan Total samples: %d.\r\n", point);
+    printf("plan init times:%d tick.\r\n", run_times);
+    for (uint32_t i = 0; i < 2 * point; i++) {
+        fft_plan_buf[i] = fft_buf_copy[i];
+    }
+    start_time();
+    hpm_software_cfft_plan_float(&plan, &fft_plan_buf[0]);
+    cfft_times = get_end_time();
+    err += fft_check(&fft_plan_buf[0], &fft_buf[0], 2 * point, FFT_PRECISION * point);
+    start_time();
+    hpm_software_cifft_plan_float(&plan, &fft_plan_buf[0]);
+    cifft_times = get_end_time();
+    err += fft_check(&fft_plan_buf[0], &fft_buf_copy[0], 2 * point, FFT_PRECISION);
+
+    /* real, the input has no imaginary part */
+    hpm_software_rfft_plan_init(&plan, m, fft_twiddle, fft_bitrev);
+    for (uint32_t i = 0; i < point; i++) {
+        fft_plan_buf[i] = fft_buf_copy[2 * i];
+    }
+    start_time();
+    hpm_software_rfft_plan_float(&plan, &fft_plan_buf[0]);
+    rfft_times = get_end_time();
+    /* X[N/2] is packed in place of the imaginary part of X[0] */
+    fft_buf[1] = fft_buf[point];
+    err += fft_check(&fft_plan_buf[0], &fft_buf[0], point, FFT_PRECISION * point);
+    start_time();
+    hpm_software_rifft_plan_float(&plan, &fft_plan_buf[0]);
+    rifft_times = get_end_time();
+    for (uint32_t i = 0; i < point; i++) {
+        if ((fft_plan_buf[i] > fft_buf_copy[2 * i] + FFT_PRECISION) ||
+        (fft_plan_buf[i] < fft_buf_copy[2 * i] - FFT_PRECISION)) {
+            err++;
+        }
+    }
+
+    printf("cooley tukey fft times:%d tick.\r\n", legacy_times);
+    printf("plan cfft times:%d tick, cifft times:%d tick.\r\n", cfft_times, cifft_times);
+    printf("plan rfft times:%d tick, rifft times:%d tick.\r\n", rfft_times, rifft_times);
+#ifdef HPMSOC_HAS_HPMSDK_FFA
+    if (m <= 9) {
+        ffa_buf_flush(&ffa_buf[0], 2 * point * sizeof(q31_t));
+        start_time();
+        hpm_ffa_cfft_q31(&ffa_buf[0], m);
+        run_times = get_end_time();
+        ffa_buf_invalidate(&ffa_buf[0], 2 * point * sizeof(q31_t));
+        printf("ffa cfft q31 times:%d tick.\r\n", run_times);
+
+        hpm_dsp_convert_f32_q15(fft_buf_conversion, ffa_q15_buf, 2 * point);
+        ffa_buf_flush(&ffa_q15_buf[0], 2 * point * sizeof(q15_t));
+        start_time();
+        hpm_ffa_cfft_q15(&ffa_q15_buf[0], m);
+        run_times = get_end_time();
+        ffa_buf_invalidate(&ffa_q15_buf[0], 2 * point * sizeof(q15_t));
+        printf("ffa cfft q15 times:%d tick.\r\n", run_times);
+    }
+#endif
+    printf("------------------------------------\r\n\r\n\r\n");
+    return err;
+}
+
 int main(void)
 {
     uint8_t shift = 0;
@@ -290,6 +411,14 @@ int main(void)
         fft_printf(&fft_buf[0], &fft_mag_output[0], point);
     }
     printf("**************************************\r\n\r\n\r\n\r\n");
+    /**
+     * @brief Planned software fft.  2^j complex and real samples
+     *
+     */
+    for (uint8_t i = 6; i <= FFT_PLAN_MAX_LOG2; i++) {
+        err_num += fft_plan_test(i);
+    }
+    printf("**************************************\r\n\r\n\r\n\r\n");
 /* conversion test */
     for (uint8_t i = 6; i <= 10; i++) {
         point = 1 << i;
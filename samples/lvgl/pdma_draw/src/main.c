@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include "board.h"
+#include "hpm_debug_console.h"
+#include "hpm_lvgl.h"
+#include <demos/lv_demos.h>
+#if defined(LV_USE_DRAW_HPM_PDMA) && LV_USE_DRAW_HPM_PDMA
+#include "lv_draw_hpm_pdma.h"
+#endif
+
+#define STATS_PERIOD_MS     (5000)
+
+#if defined(LV_USE_DRAW_HPM_PDMA) && LV_USE_DRAW_HPM_PDMA
+static void stats_timer_cb(lv_timer_t *timer)
+{
+    lv_draw_hpm_pdma_stats_t stats;
+
+    (void) timer;
+    lv_draw_hpm_pdma_get_stats(&stats);
+    lv_draw_hpm_pdma_reset_stats();
+    printf("pdma draw: fill %u, blit %u, transform %u, fallback %u\n",
+           stats.fill, stats.blit, stats.transform, stats.fallback);
+}
+#endif
+
+int main(void)
+{
+    board_init();
+    board_init_cap_touch();
+    board_init_lcd();
+
+#if defined(LV_USE_DRAW_HPM_PDMA) && LV_USE_DRAW_HPM_PDMA
+    printf("lvgl benchmark, PDMA draw unit enabled\n");
+#else
+    printf("lvgl benchmark, SW renderer only\n");
+#endif
+
+    hpm_lvgl_init();
+#if defined(LV_USE_DRAW_HPM_PDMA) && LV_USE_DRAW_HPM_PDMA
+    lv_timer_create(stats_timer_cb, STATS_PERIOD_MS, NULL);
+#endif
+    /* the summary is printed on the console when all scenes are done */
+    lv_demo_benchmark();
+
+    while (1) {
+        lv_timer_periodic_handler();
+    }
+
+    return 0;
+}
@@ -8,7 +8,6 @@
 #include "common.h"
 #include "hpm_common.h"
 #include "hpm_otp_drv.h"
-#include "ethernetif.h"
 #include "netconf.h"
 #include "lwip.h"
 #include "lwip/timeouts.h"
@@ -20,7 +19,6 @@ static enet_phy_status_t last_status[BOARD_ENET_COUNT] = {{.enet_phy_link = enet
 
 #if defined(NO_SYS) && !NO_SYS
 uint32_t msg[BOARD_ENET_COUNT];
-extern osSemaphoreId_t s_xSemaphore[];
 
 #if defined(__ENABLE_FREERTOS) && __ENABLE_FREERTOS
 void timer_callback(TimerHandle_t xTimer)
@@ -228,7 +226,7 @@ void enet_services(struct netif *netif)
 #if defined(NO_SYS) && NO_SYS
 void enet_common_handler(struct netif *netif)
 {
-    ethernetif_input(netif);
+    hpm_enet_netif_input(netif);
 
     /* Handle all system timeouts for all core protocols */
     #if defined(LWIP_TIMERS) && LWIP_TIMERS
@@ -245,12 +243,6 @@ void enet_common_handler(struct netif *netif)
 #if defined(__ENABLE_ENET_RECEIVE_INTERRUPT) && __ENABLE_ENET_RECEIVE_INTERRUPT || defined(NO_SYS) && !NO_SYS
 static void isr_enet(uint8_t idx)
 {
-#if defined(NO_SYS) && !NO_SYS
-#if defined(__ENABLE_FREERTOS) && __ENABLE_FREERTOS
-    portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
-#endif
-#endif
-
     uint32_t status;
     uint32_t rxgbfrmis;
     uint32_t intr_status;
@@ -270,22 +262,9 @@ static void isr_enet(uint8_t idx)
         ptr->XMII_CSR;
     }
 
-    if (ENET_DMA_STATUS_RI_GET(status)) {
-    #if defined(NO_SYS) && !NO_SYS
-#if defined(__ENABLE_FREERTOS) && __ENABLE_FREERTOS
-        /* Give the semaphore to wakeup LwIP task */
-        xSemaphoreGiveFromISR(s_xSemaphore[idx], &xHigherPriorityTaskWoken);
-        /* Switch tasks if necessary. */
-        if (xHigherPriorityTaskWoken != pdFALSE) {
-            portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
-        }
-#elif defined(__ENABLE_RTTHREAD_NANO) && __ENABLE_RTTHREAD_NANO
-        rt_sem_release(s_xSemaphore[idx]);
-#endif
-    #else
-        rx_flag[idx] = true;
-    #endif
-        ptr->DMA_STATUS |= ENET_DMA_STATUS_RI_MASK;
+    if (ENET_DMA_STATUS_RI_GET(status) && !hpm_enet_netif_isr(&enet_netif[idx])) {
+        /* the netif isn't added yet, the frames wait in the ring */
+        ptr->DMA_STATUS = ENET_DMA_STATUS_RI_MASK | ENET_DMA_STATUS_NIS_MASK;
     }
 
     if (ENET_MMC_INTR_RX_RXCTRLFIS_GET(rxgbfrmis)) {
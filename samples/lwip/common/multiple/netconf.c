@@ -11,8 +11,8 @@
 #include "netconf.h"
 #include "lwip/netifapi.h"
 #include "netif/etharp.h"
-#include "ethernetif.h"
 #include "common.h"
+#include "lwip.h"
 
 #if defined(LWIP_DHCP) && LWIP_DHCP
 #include "lwip/dhcp.h"
@@ -39,6 +39,15 @@ mac_init_t mac_init[BOARD_ENET_COUNT] = {
     {HPM_STRINGIFY(MAC1_CONFIG)}
 };
 
+hpm_enet_netif_t enet_netif[BOARD_ENET_COUNT];
+
+static hpm_enet_netif_rx_buf_t enet_rx_bufs[BOARD_ENET_COUNT][ENET_RX_BUFF_COUNT + ENET_RX_SPARE_COUNT];
+static hpm_enet_netif_rx_buf_t *enet_rx_desc_buf[BOARD_ENET_COUNT][ENET_RX_BUFF_COUNT];
+static hpm_enet_netif_tx_slot_t enet_tx_slots[BOARD_ENET_COUNT][ENET_TX_BUFF_COUNT];
+
+ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE)
+static uint8_t enet_rx_spare[BOARD_ENET_COUNT][ENET_RX_SPARE_COUNT][ENET_RX_BUFF_SIZE];
+
 
 #if defined(LWIP_DHCP) && LWIP_DHCP
 /**
@@ -79,17 +88,32 @@ static void netif_update_status(struct netif *netif)
 void netif_config(struct netif *netif, uint8_t i)
 {
     ip_addr_t ipaddr, netmask, gw;
+    hpm_enet_netif_config_t config = {
+        .base = (ENET_Type *)board_get_enet_base(i),
+        .desc = &desc[i],
+        .mac = mac[i],
+        .rx_bufs = enet_rx_bufs[i],
+        .rx_desc_buf = enet_rx_desc_buf[i],
+        .tx_slots = enet_tx_slots[i],
+        .rx_spare = &enet_rx_spare[i][0][0],
+        .rx_spare_count = ENET_RX_SPARE_COUNT,
+    };
 
     ip4addr_aton(ip_init[i].ip_addr, &ipaddr);
     ip4addr_aton(ip_init[i].netmask, &netmask);
     ip4addr_aton(ip_init[i].gw, &gw);
 
+    if (hpm_enet_netif_config(&enet_netif[i], &config) != status_success) {
+        printf("Enet%d netif config failed !\n", i);
+        return;
+    }
+
 #if defined(NO_SYS) && NO_SYS
-    netif_add(netif, &ipaddr, &netmask, &gw, NULL, &ethernetif_init, &ethernet_input);
+    netif_add(netif, &ipaddr, &netmask, &gw, &enet_netif[i], &hpm_enet_netif_init, &ethernet_input);
     netif_set_up(netif);
     netif_set_default(netif);
 #else
-    netifapi_netif_add(netif, &ipaddr, &netmask, &gw, NULL, &ethernetif_init, &tcpip_input);
+    netifapi_netif_add(netif, &ipaddr, &netmask, &gw, &enet_netif[i], &hpm_enet_netif_init, &tcpip_input);
     netifapi_netif_set_up(netif);
     netifapi_netif_set_default(netif);
 #endif
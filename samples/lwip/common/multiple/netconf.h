@@ -10,6 +10,7 @@
 #include "lwipopts.h"
 #include "sys_arch.h"
 #include "lwip/netif.h"
+#include "hpm_enet_netif.h"
 
 /* Exported typedef ------------------------------------------------------------*/
 typedef struct {
@@ -67,6 +68,11 @@ typedef struct {
 #define REMOTE_IP1_CONFIG 192.168.200.5
 #endif
 
+/* RX buffers swapped into the ring when a frame is passed up to lwIP */
+#ifndef ENET_RX_SPARE_COUNT
+#define ENET_RX_SPARE_COUNT (ENET_RX_BUFF_COUNT / 2)
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -76,6 +82,7 @@ extern sys_mbox_t netif_status_mbox[];
 #endif
 
 extern mac_init_t mac_init[];
+extern hpm_enet_netif_t enet_netif[];
 /* Exported functions ------------------------------------------------------- */
 #if defined(LWIP_DHCP) && LWIP_DHCP
 void LwIP_DHCP_task(void *pvParameters);
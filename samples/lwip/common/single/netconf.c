@@ -15,8 +15,8 @@
 
 #include "lwip/netifapi.h"
 #include "netif/etharp.h"
-#include "ethernetif.h"
 #include "common.h"
+#include "lwip.h"
 
 #if defined(__ENABLE_FREERTOS) && __ENABLE_FREERTOS
 #include "FreeRTOS.h"
@@ -30,6 +30,16 @@
 sys_mbox_t netif_status_mbox;
 #endif
 
+hpm_enet_netif_t enet_netif;
+
+/* Private variables --------------------------------------------------------*/
+static hpm_enet_netif_rx_buf_t enet_rx_bufs[ENET_RX_BUFF_COUNT + ENET_RX_SPARE_COUNT];
+static hpm_enet_netif_rx_buf_t *enet_rx_desc_buf[ENET_RX_BUFF_COUNT];
+static hpm_enet_netif_tx_slot_t enet_tx_slots[ENET_TX_BUFF_COUNT];
+
+ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE)
+static uint8_t enet_rx_spare[ENET_RX_SPARE_COUNT][ENET_RX_BUFF_SIZE];
+
 #if defined(LWIP_DHCP) && LWIP_DHCP
 /**
 * @brief  LwIP_DHCP_Process_Handle
@@ -67,6 +77,16 @@ void netif_config(struct netif *netif)
     ip_addr_t ipaddr;
     ip_addr_t netmask;
     ip_addr_t gw;
+    hpm_enet_netif_config_t config = {
+        .base = ENET,
+        .desc = &desc,
+        .mac = mac,
+        .rx_bufs = enet_rx_bufs,
+        .rx_desc_buf = enet_rx_desc_buf,
+        .tx_slots = enet_tx_slots,
+        .rx_spare = &enet_rx_spare[0][0],
+        .rx_spare_count = ENET_RX_SPARE_COUNT,
+    };
 
 #if defined(LWIP_DHCP) && LWIP_DHCP
     ip4_addr_set_zero(&gw);
@@ -78,12 +98,17 @@ void netif_config(struct netif *netif)
     ip4addr_aton(HPM_STRINGIFY(GW_CONFIG), &gw);
 #endif
 
+    if (hpm_enet_netif_config(&enet_netif, &config) != status_success) {
+        printf("Enet netif config failed !\n");
+        return;
+    }
+
 #if defined(NO_SYS) && NO_SYS
-    netif_add(netif, &ipaddr, &netmask, &gw, NULL, &ethernetif_init, &ethernet_input);
+    netif_add(netif, &ipaddr, &netmask, &gw, &enet_netif, &hpm_enet_netif_init, &ethernet_input);
     netif_set_up(netif);
     netif_set_default(netif);
 #else
-    netifapi_netif_add(netif, &ipaddr, &netmask, &gw, NULL, &ethernetif_init, &tcpip_input);
+    netifapi_netif_add(netif, &ipaddr, &netmask, &gw, &enet_netif, &hpm_enet_netif_init, &tcpip_input);
     netifapi_netif_set_up(netif);
     netifapi_netif_set_default(netif);
 #endif
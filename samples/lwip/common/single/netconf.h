@@ -10,6 +10,7 @@
 #include "lwipopts.h"
 #include "sys_arch.h"
 #include "lwip/netif.h"
+#include "hpm_enet_netif.h"
 
 /* MAC Address */
 #ifndef MAC_CONFIG
@@ -36,6 +37,11 @@
 #define REMOTE_IP_CONFIG 192.168.100.5
 #endif
 
+/* RX buffers swapped into the ring when a frame is passed up to lwIP */
+#ifndef ENET_RX_SPARE_COUNT
+#define ENET_RX_SPARE_COUNT (ENET_RX_BUFF_COUNT / 2)
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -44,6 +50,8 @@ extern "C" {
 extern sys_mbox_t netif_status_mbox;
 #endif
 
+extern hpm_enet_netif_t enet_netif;
+
 /* Exported functions ------------------------------------------------------- */
 
 #if defined(LWIP_DHCP) && LWIP_DHCP
@@ -51,10 +51,6 @@ mbedtls_pk_context pkey;
 mbedtls_ssl_cache_context cache;
 #endif
 
-#if defined(__USE_ENET_RECEIVE_INTERRUPT) && __USE_ENET_RECEIVE_INTERRUPT
-volatile bool rx_flag;
-#endif
-
 struct netif gnetif;
 
 /* Entropy poll callback for a hardware source */
@@ -11,7 +11,7 @@
 #include "common.h"
 #include "netconf.h"
 #include "sys_arch.h"
-#include "ethernetif.h"
+#include "hpm_enet_netif.h"
 #include "lwip.h"
 #include "lwip/init.h"
 #include "lwip/timeouts.h"
@@ -147,12 +147,21 @@ lwiperf_report(void *arg, enum lwiperf_report_type report_type,
   const ip_addr_t* local_addr, u16_t local_port, const ip_addr_t* remote_addr, u16_t remote_port,
   u32_t bytes_transferred, u32_t ms_duration, u32_t bandwidth_kbitpsec)
 {
+  hpm_enet_netif_stats_t stats;
+
   LWIP_UNUSED_ARG(arg);
   LWIP_UNUSED_ARG(local_addr);
   LWIP_UNUSED_ARG(local_port);
 
   LWIP_PLATFORM_DIAG(("iperf report: type=%d, remote: %s:%d, total bytes: %"U32_F", duration in ms: %"U32_F", kbits/s: %"U32_F"\n",
     (int)report_type, ipaddr_ntoa(remote_addr), (int)remote_port, bytes_transferred, ms_duration, bandwidth_kbitpsec));
+
+  hpm_enet_netif_get_stats(&enet_netif, &stats);
+  LWIP_PLATFORM_DIAG(("netif: rx %"U32_F", tx %"U32_F", rx copy %"U32_F", rx drop: error %"U32_F", input %"U32_F", pbuf %"U32_F
+    ", desc starved %"U32_F", missed %"U32_F", overflow %"U32_F", tx ring full %"U32_F"\n",
+    stats.rx_frames, stats.tx_frames, stats.rx_copy, stats.rx_err_drop, stats.rx_input_drop, stats.rx_pbuf_exhausted,
+    stats.rx_desc_starved, stats.rx_missed, stats.rx_fifo_overflow, stats.tx_ring_full));
+  hpm_enet_netif_reset_stats(&enet_netif);
 }
 
 static bool select_mode(struct netif *netif, bool *server_mode, bool *tcp, enum lwiperf_client_type *client_type)
@@ -11,7 +11,7 @@
 #include "common.h"
 #include "netconf.h"
 #include "sys_arch.h"
-#include "ethernetif.h"
+#include "hpm_enet_netif.h"
 #include "lwip.h"
 #include "lwip/init.h"
 #include "lwip/timeouts.h"
@@ -30,10 +30,6 @@
 #define IPERF_CLIENT_AMOUNT (-1000) /* 10 seconds */
 #endif
 
-#if defined(__ENABLE_ENET_RECEIVE_INTERRUPT) && __ENABLE_ENET_RECEIVE_INTERRUPT
-volatile bool rx_flag[BOARD_ENET_COUNT];
-#endif
-
 typedef struct {
     enet_rx_desc_t dma_rx_desc_tab[ENET_RX_BUFF_COUNT];
     enet_tx_desc_t dma_tx_desc_tab[ENET_TX_BUFF_COUNT];
@@ -341,7 +337,7 @@ int main(void)
 
     while (1) {
         for (uint8_t i = 0; i < BOARD_ENET_COUNT; i++) {
-            ethernetif_input(&gnetif[i]);
+            hpm_enet_netif_input(&gnetif[i]);
             sys_check_timeouts();
             iperf(gnetif);
         }
@@ -30,7 +30,4 @@
 extern enet_desc_t desc;
 extern uint8_t mac[];
 
-#if __ENABLE_ENET_RECEIVE_INTERRUPT
-extern volatile bool rx_flag;
-#endif
 #endif /* LWIP_H */
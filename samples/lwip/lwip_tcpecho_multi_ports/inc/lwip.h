@@ -24,7 +24,4 @@ typedef ENET_Type enet_base_t;
 extern enet_desc_t desc[];
 extern uint8_t mac[BOARD_ENET_COUNT][ENET_MAC];
 
-#if __ENABLE_ENET_RECEIVE_INTERRUPT
-extern volatile bool rx_flag[];
-#endif
 #endif /* LWIP_H */
@@ -15,10 +15,6 @@
 #include "lwip/init.h"
 #include "tcp_echo.h"
 
-#if defined(__ENABLE_ENET_RECEIVE_INTERRUPT) && __ENABLE_ENET_RECEIVE_INTERRUPT
-volatile bool rx_flag[BOARD_ENET_COUNT];
-#endif
-
 typedef struct {
     enet_rx_desc_t dma_rx_desc_tab[ENET_RX_BUFF_COUNT];
     enet_tx_desc_t dma_tx_desc_tab[ENET_TX_BUFF_COUNT];
@@ -30,10 +30,6 @@ __RW uint8_t tx_buff[ENET_TX_BUFF_COUNT][ENET_TX_BUFF_SIZE]; /* Ethernet Transmi
 enet_desc_t desc;
 uint8_t mac[ENET_MAC];
 
-#if defined(__ENABLE_ENET_RECEIVE_INTERRUPT) && __ENABLE_ENET_RECEIVE_INTERRUPT
-volatile bool rx_flag;
-#endif
-
 struct netif gnetif;
 
 /*---------------------------------------------------------------------*
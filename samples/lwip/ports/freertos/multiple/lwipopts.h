@@ -94,6 +94,14 @@
 #define LWIP_NETIF_TX_SINGLE_PBUF 1
 #endif
 
+/**
+ * LWIP_SUPPORT_CUSTOM_PBUF==1: the ENET RX buffers are passed up the stack as
+ * custom pbufs and recycled when they are freed (see hpm_enet_netif.c).
+ */
+#ifndef LWIP_SUPPORT_CUSTOM_PBUF
+#define LWIP_SUPPORT_CUSTOM_PBUF 1
+#endif
+
 /**
  * NO_SYS==1: Provides VERY minimal functionality. Otherwise,
  * use lwIP facilities.
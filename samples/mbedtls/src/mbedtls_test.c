@@ -8,9 +8,12 @@
 #include "board.h"
 #include "hpm_debug_console.h"
 #include "mbedtls/aes.h"
+#include "mbedtls/gcm.h"
 #include <stdio.h>
 #define LED_FLASH_PERIOD_IN_MS 300
 #include "hpm_romapi.h"
+#include "hpm_clock_drv.h"
+#include "hpm_csr_drv.h"
 #include "mbedtls/base64.h"
 #include "mbedtls/md.h"
 #include "mbedtls/sha1.h"
@@ -225,6 +228,173 @@ static void mbedtls_sha256_demo(void)
     }
 }
 
+#if defined(MBEDTLS_AES_CRYPT_CTR_ALT) && defined(MBEDTLS_AES192_ALT_SW)
+#define BENCH_MAX_RECORD_SIZE  (16384U)
+#define BENCH_BYTES_PER_RUN    (65536U)
+
+static uint8_t s_bench_input[BENCH_MAX_RECORD_SIZE];
+static uint8_t s_bench_golden[BENCH_MAX_RECORD_SIZE];
+static uint8_t s_bench_output[BENCH_MAX_RECORD_SIZE];
+
+typedef int (*bench_ctr_func_t)(mbedtls_aes_context *ctx, size_t length, uint8_t nonce_counter[16],
+                                const uint8_t *input, uint8_t *output);
+
+static void bench_increment_counter(uint8_t nonce_counter[16])
+{
+    for (int i = 16; i > 0; i--) {
+        if (++nonce_counter[i - 1] != 0) {
+            break;
+        }
+    }
+}
+
+/* AES-CTR with the software AES of the port, without the SDP */
+static int bench_ctr_software(mbedtls_aes_context *ctx, size_t length, uint8_t nonce_counter[16],
+                              const uint8_t *input, uint8_t *output)
+{
+    uint8_t stream[16];
+
+    for (size_t n = 0; n < length; n += 16) {
+        size_t use_len = (length - n < 16) ? (length - n) : 16;
+        mbedtls_internal_aes_encrypt_sw(ctx, nonce_counter, stream);
+        bench_increment_counter(nonce_counter);
+        for (size_t i = 0; i < use_len; i++) {
+            output[n + i] = input[n + i] ^ stream[i];
+        }
+    }
+    return 0;
+}
+
+/* AES-CTR with one SDP operation per 16-byte block, like the generic counter mode of mbedtls */
+static int bench_ctr_sdp_per_block(mbedtls_aes_context *ctx, size_t length, uint8_t nonce_counter[16],
+                                   const uint8_t *input, uint8_t *output)
+{
+    uint8_t stream[16];
+    int ret;
+
+    for (size_t n = 0; n < length; n += 16) {
+        size_t use_len = (length - n < 16) ? (length - n) : 16;
+        ret = mbedtls_aes_crypt_ecb(ctx, MBEDTLS_AES_ENCRYPT, nonce_counter, stream);
+        if (ret != 0) {
+            return ret;
+        }
+        bench_increment_counter(nonce_counter);
+        for (size_t i = 0; i < use_len; i++) {
+            output[n + i] = input[n + i] ^ stream[i];
+        }
+    }
+    return 0;
+}
+
+/* AES-CTR with the whole record handed to the SDP */
+static int bench_ctr_sdp_bulk(mbedtls_aes_context *ctx, size_t length, uint8_t nonce_counter[16],
+                              const uint8_t *input, uint8_t *output)
+{
+    uint8_t stream[16];
+    size_t nc_off = 0;
+
+    return mbedtls_aes_crypt_ctr(ctx, length, &nc_off, nonce_counter, stream, input, output);
+}
+
+static uint32_t bench_kbytes_per_second(uint32_t bytes, uint64_t cycles)
+{
+    return (uint32_t)((uint64_t)bytes * clock_get_frequency(clock_cpu0) / 1024U / cycles);
+}
+
+/* throughput of a counter mode path, whose output must match s_bench_golden */
+static uint32_t bench_ctr(bench_ctr_func_t func, mbedtls_aes_context *ctx, uint32_t record_size, bool *passed)
+{
+    uint32_t runs = BENCH_BYTES_PER_RUN / record_size;
+    uint8_t nonce_counter[16] = {0};
+    uint64_t start;
+    uint64_t cycles;
+
+    if ((func(ctx, record_size, nonce_counter, s_bench_input, s_bench_output) != 0) ||
+        (memcmp(s_bench_output, s_bench_golden, record_size) != 0)) {
+        *passed = false;
+    }
+
+    start = hpm_csr_get_core_mcycle();
+    for (uint32_t i = 0; i < runs; i++) {
+        (void)func(ctx, record_size, nonce_counter, s_bench_input, s_bench_output);
+    }
+    cycles = hpm_csr_get_core_mcycle() - start;
+
+    return bench_kbytes_per_second(runs * record_size, cycles);
+}
+
+/* throughput of AES-GCM encryption, checked by an authenticated decryption */
+static uint32_t bench_gcm(mbedtls_gcm_context *ctx, uint32_t record_size, bool *passed)
+{
+    static const uint8_t iv[12] = {0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88};
+    static const uint8_t add[13] = {0x17, 0x03, 0x03};
+    uint32_t runs = BENCH_BYTES_PER_RUN / record_size;
+    uint8_t tag[16];
+    uint64_t start;
+    uint64_t cycles;
+
+    start = hpm_csr_get_core_mcycle();
+    for (uint32_t i = 0; i < runs; i++) {
+        (void)mbedtls_gcm_crypt_and_tag(ctx, MBEDTLS_GCM_ENCRYPT, record_size, iv, sizeof(iv), add, sizeof(add),
+                                        s_bench_input, s_bench_output, sizeof(tag), tag);
+    }
+    cycles = hpm_csr_get_core_mcycle() - start;
+
+    if ((mbedtls_gcm_auth_decrypt(ctx, record_size, iv, sizeof(iv), add, sizeof(add), tag, sizeof(tag),
+                                  s_bench_output, s_bench_output) != 0) ||
+        (memcmp(s_bench_output, s_bench_input, record_size) != 0)) {
+        *passed = false;
+    }
+
+    return bench_kbytes_per_second(runs * record_size, cycles);
+}
+
+static void mbedtls_aes_throughput_benchmark(void)
+{
+    const uint8_t key[16] = {
+        0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+    mbedtls_aes_context sw_ctx;
+    mbedtls_aes_context sdp_ctx;
+    mbedtls_gcm_context gcm_ctx;
+    bool passed = true;
+
+    for (uint32_t i = 0; i < BENCH_MAX_RECORD_SIZE; i++) {
+        s_bench_input[i] = (uint8_t)(i * 7U + 3U);
+    }
+
+    mbedtls_aes_init(&sw_ctx);
+    mbedtls_aes_init(&sdp_ctx);
+    mbedtls_gcm_init(&gcm_ctx);
+    mbedtls_aes_setkey_enc_sw(&sw_ctx, key, 128);
+    mbedtls_aes_setkey_enc(&sdp_ctx, key, 128);
+    mbedtls_gcm_setkey(&gcm_ctx, MBEDTLS_CIPHER_ID_AES, key, 128);
+
+    mbedtls_printf("- AES-128 throughput in KB/s\n");
+    mbedtls_printf("%8s %10s %10s %10s %10s\n", "record", "ctr sw", "ctr block", "ctr bulk", "gcm bulk");
+    for (uint32_t record_size = 16; record_size <= BENCH_MAX_RECORD_SIZE; record_size *= 4) {
+        uint8_t nonce_counter[16] = {0};
+        uint32_t sw, per_block, bulk, gcm;
+
+        bench_ctr_software(&sw_ctx, record_size, nonce_counter, s_bench_input, s_bench_golden);
+        sw = bench_ctr(bench_ctr_software, &sw_ctx, record_size, &passed);
+        per_block = bench_ctr(bench_ctr_sdp_per_block, &sdp_ctx, record_size, &passed);
+        bulk = bench_ctr(bench_ctr_sdp_bulk, &sdp_ctx, record_size, &passed);
+        gcm = bench_gcm(&gcm_ctx, record_size, &passed);
+        mbedtls_printf("%8u %10u %10u %10u %10u\n", record_size, sw, per_block, bulk, gcm);
+    }
+
+    mbedtls_gcm_free(&gcm_ctx);
+    mbedtls_aes_free(&sdp_ctx);
+    mbedtls_aes_free(&sw_ctx);
+
+    if (!passed) {
+        mbedtls_printf("[ERROR] Opps, result doesn't match the golden data %s\n", __func__);
+    } else {
+        mbedtls_printf("[OK] %s calculation for passed\n", __func__);
+    }
+}
+#endif
+
 int main(void)
 {
     int u;
@@ -244,6 +414,9 @@ int main(void)
     mbedtls_sha1_demo();
     mbedtls_sha256_demo();
     mbedtls_hmac_demo();
+#if defined(MBEDTLS_AES_CRYPT_CTR_ALT) && defined(MBEDTLS_AES192_ALT_SW)
+    mbedtls_aes_throughput_benchmark();
+#endif
     mbedtls_printf("All Test Finished\n");
     while (1) {
         u = getchar();
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "board.h"
+#include "hpm_clock_drv.h"
+#include "hpm_csr_drv.h"
+#include "hpm_dma_mgr.h"
+#include "hpm_memcpy_async.h"
+
+/*
+ * Copies between two buffers of the SDRAM with memcpy and with the memcpy async queue on each
+ * engine, for sizes from TEST_MIN_SIZE to TEST_MAX_SIZE. For each size the throughput is
+ * reported, and for the queue the CPU time saved against memcpy: while a job runs, the CPU
+ * waits in a loop which counts the cycles it was not interrupted, what remains is the time
+ * spent in the submission, the interrupts and the cache maintenance.
+ */
+
+#define TEST_MIN_SIZE           (256U)
+#ifndef TEST_MAX_SIZE
+#define TEST_MAX_SIZE           (1024U * 1024U)
+#endif
+#define TEST_BYTES_PER_SIZE     (4U * 1024U * 1024U)    /* bytes copied for each measurement */
+#define TEST_MISALIGNMENT       (64U)                   /* room for the unaligned checks */
+
+/* longer gaps between two reads of mcycle in the wait loop are interrupts */
+#define IDLE_GAP_CYCLES         (64U)
+
+typedef struct {
+    const char *name;
+    memcpy_async_engine_t engine;
+} test_engine_t;
+
+static const test_engine_t s_engines[] = {
+    { "auto", memcpy_async_engine_auto },
+    { "dma", memcpy_async_engine_dma },
+#if defined(HPMSOC_HAS_HPMSDK_SDP)
+    { "sdp", memcpy_async_engine_sdp },
+#endif
+};
+
+#define TEST_ENGINE_COUNT (sizeof(s_engines) / sizeof(s_engines[0]))
+
+ATTR_PLACE_AT(".framebuffer") ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) static uint8_t s_src[TEST_MAX_SIZE + TEST_MISALIGNMENT];
+ATTR_PLACE_AT(".framebuffer") ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) static uint8_t s_dst[TEST_MAX_SIZE + TEST_MISALIGNMENT];
+static memcpy_async_job_t s_job;
+
+static uint32_t test_iterations(uint32_t size)
+{
+    uint32_t n = TEST_BYTES_PER_SIZE / size;
+    return (n > 0U) ? n : 1U;
+}
+
+/* wait for the job, returns the cycles the cpu was free */
+static uint64_t test_wait_idle(const memcpy_async_job_t *job)
+{
+    uint64_t idle = 0;
+    uint64_t last = hpm_csr_get_core_mcycle();
+
+    while (!hpm_memcpy_async_is_done(job)) {
+        uint64_t now = hpm_csr_get_core_mcycle();
+        if ((now - last) < IDLE_GAP_CYCLES) {
+            idle += now - last;
+        }
+        last = now;
+    }
+    return idle;
+}
+
+static uint32_t test_kbps(uint32_t size, uint32_t iterations, uint64_t cycles)
+{
+    uint64_t freq = clock_get_frequency(clock_cpu0);
+
+    return (uint32_t)((uint64_t)size * iterations * freq / 1024U / cycles);
+}
+
+static uint64_t test_memcpy(uint32_t size)
+{
+    uint32_t iterations = test_iterations(size);
+    uint64_t start = hpm_csr_get_core_mcycle();
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        memcpy(s_dst, s_src, size);
+    }
+    return hpm_csr_get_core_mcycle() - start;
+}
+
+static hpm_stat_t test_async(memcpy_async_engine_t engine, uint32_t size, uint64_t *cycles, uint64_t *busy)
+{
+    uint32_t iterations = test_iterations(size);
+    uint64_t idle = 0;
+    uint64_t start;
+    hpm_stat_t stat = status_success;
+
+    memset(s_dst, 0, size);
+    s_job.engine = engine;
+    start = hpm_csr_get_core_mcycle();
+    for (uint32_t i = 0; (i < iterations) && (stat == status_success); i++) {
+        stat = hpm_memcpy_async_copy(&s_job, s_dst, s_src, size);
+        if (stat == status_success) {
+            idle += test_wait_idle(&s_job);
+            stat = s_job.status;
+        }
+    }
+    *cycles = hpm_csr_get_core_mcycle() - start;
+    *busy = *cycles - idle;
+    if ((stat == status_success) && (memcmp(s_dst, s_src, size) != 0)) {
+        stat = status_fail;
+    }
+    return stat;
+}
+
+/* unaligned buffers, and a fill, must leave the bytes around them untouched */
+static hpm_stat_t test_unaligned(memcpy_async_engine_t engine, uint32_t size)
+{
+    const uint32_t src_off = 3;
+    const uint32_t dst_off = 17;
+    hpm_stat_t stat;
+
+    memset(s_dst, 0xA5, size + TEST_MISALIGNMENT);
+    s_job.engine = engine;
+    stat = hpm_memcpy_async_copy(&s_job, &s_dst[dst_off], &s_src[src_off], size);
+    if (stat == status_success) {
+        stat = hpm_memcpy_async_wait(&s_job);
+    }
+    if ((stat == status_success) &&
+        ((memcmp(&s_dst[dst_off], &s_src[src_off], size) != 0) || (s_dst[dst_off - 1U] != 0xA5U) ||
+         (s_dst[dst_off + size] != 0xA5U))) {
+        stat = status_fail;
+    }
+    if (stat == status_success) {
+        stat = hpm_memcpy_async_fill(&s_job, &s_dst[dst_off], 0x3C, size);
+    }
+    if (stat == status_success) {
+        stat = hpm_memcpy_async_wait(&s_job);
+    }
+    if (stat == status_success) {
+        for (uint32_t i = 0; i < size; i++) {
+            if (s_dst[dst_off + i] != 0x3CU) {
+                return status_fail;
+            }
+        }
+        if ((s_dst[dst_off - 1U] != 0xA5U) || (s_dst[dst_off + size] != 0xA5U)) {
+            stat = status_fail;
+        }
+    }
+    return stat;
+}
+
+int main(void)
+{
+    hpm_memcpy_async_config_t config;
+    hpm_memcpy_async_stats_t stats;
+    uint32_t errors = 0;
+
+    board_init();
+#if defined(HPMSOC_HAS_HPMSDK_SDP)
+    clock_add_to_group(clock_sdp, BOARD_RUNNING_CORE & 0x1);
+#endif
+    dma_mgr_init();
+    hpm_memcpy_async_get_default_config(&config);
+    config.running_core = BOARD_RUNNING_CORE;
+    if (hpm_memcpy_async_init(&config) != status_success) {
+        printf("memcpy async init failed\n");
+        while (1) {
+            ;
+        }
+    }
+
+    for (uint32_t i = 0; i < sizeof(s_src); i++) {
+        s_src[i] = (uint8_t)((i * 2654435761U) >> 24);
+    }
+
+    printf("memcpy async: KB/s, and CPU time saved against memcpy, cpu threshold of auto %u bytes\n",
+           config.cpu_threshold);
+    printf("%8s %12s", "size", "memcpy");
+    for (uint32_t e = 0; e < TEST_ENGINE_COUNT; e++) {
+        printf(" %10s %6s", s_engines[e].name, "saved");
+    }
+    printf("\n");
+
+    for (uint32_t size = TEST_MIN_SIZE; size <= TEST_MAX_SIZE; size *= 4U) {
+        uint64_t memcpy_cycles = test_memcpy(size);
+
+        printf("%8u %12u", size, test_kbps(size, test_iterations(size), memcpy_cycles));
+        for (uint32_t e = 0; e < TEST_ENGINE_COUNT; e++) {
+            uint64_t cycles;
+            uint64_t busy;
+            hpm_stat_t stat = test_async(s_engines[e].engine, size, &cycles, &busy);
+
+            if ((stat == status_success) && (test_unaligned(s_engines[e].engine, size) == status_success)) {
+                int32_t saved = (int32_t)(100 - (int64_t)(busy * 100U / memcpy_cycles));
+                printf(" %10u %5d%%", test_kbps(size, test_iterations(size), cycles), saved);
+            } else {
+                printf(" %10s %6s", "error", "-");
+                errors++;
+            }
+        }
+        printf("\n");
+    }
+
+    hpm_memcpy_async_get_stats(&stats);
+    printf("jobs: cpu %u, dma %u, sdp %u\n", stats.jobs[memcpy_async_engine_cpu],
+           stats.jobs[memcpy_async_engine_dma], stats.jobs[memcpy_async_engine_sdp]);
+    printf("memcpy async test %s\n", errors == 0 ? "PASSED" : "FAILED");
+
+    while (1) {
+        ;
+    }
+    return 0;
+}
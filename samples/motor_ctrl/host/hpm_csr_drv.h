@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef HPM_CSR_DRV_H
+#define HPM_CSR_DRV_H
+
+#include <stdint.h>
+
+/*
+ * Host stand-in for the cycle counter read by the hpm_mcl_v2 loops, shared by the host builds
+ * of the motor_ctrl samples. Each host build provides mcl_host_get_ticks.
+ */
+uint64_t mcl_host_get_ticks(void);
+
+static inline uint64_t hpm_csr_get_core_mcycle(void)
+{
+    return mcl_host_get_ticks();
+}
+
+#endif /* HPM_CSR_DRV_H */
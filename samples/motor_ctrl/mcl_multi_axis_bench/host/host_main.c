@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "hpm_csr_drv.h"
+#include "mcl_multi_axis_bench.h"
+
+uint64_t mcl_host_get_ticks(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t mcl_bench_get_ticks(void)
+{
+    return mcl_host_get_ticks();
+}
+
+const char *mcl_bench_tick_unit(void)
+{
+    return "ns";
+}
+
+void mcl_user_delay_us(uint64_t tick)
+{
+    (void)tick;
+}
+
+int main(void)
+{
+    uint32_t failed = mcl_multi_axis_bench_run();
+
+    printf("%s\n", (failed == 0) ? "multi-axis bench PASSED" : "multi-axis bench FAILED");
+    return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include "board.h"
+#include "hpm_csr_drv.h"
+#include "hpm_clock_drv.h"
+#include "mcl_multi_axis_bench.h"
+
+uint64_t mcl_bench_get_ticks(void)
+{
+    return hpm_csr_get_core_mcycle();
+}
+
+const char *mcl_bench_tick_unit(void)
+{
+    return "cycles";
+}
+
+void mcl_user_delay_us(uint64_t tick)
+{
+    board_delay_us(tick);
+}
+
+int main(void)
+{
+    uint32_t failed;
+
+    board_init();
+    printf("cpu0:\t\t %dHz\n\n", clock_get_frequency(clock_cpu0));
+
+    failed = mcl_multi_axis_bench_run();
+    printf("%s\n", (failed == 0) ? "multi-axis bench PASSED" : "multi-axis bench FAILED");
+
+    while (1) {
+    }
+    return 0;
+}
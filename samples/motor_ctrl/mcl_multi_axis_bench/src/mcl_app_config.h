@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef MCL_APP_CONFIG_H
+#define MCL_APP_CONFIG_H
+
+#define MCL_EN_THETA_FORECAST (1)
+#define MCL_EN_DQ_AXIS_DECOUPLING_FUNCTION (1)
+#define MCL_EN_DEAD_AREA_COMPENSATION (1)
+#define MCL_EN_SENSORLESS_SMC (0)
+/* the bench times the loops itself */
+#define MCL_EN_LOOP_TIME_COUNT (0)
+#define MCL_MULTI_AXIS_MAX (4)
+
+#endif
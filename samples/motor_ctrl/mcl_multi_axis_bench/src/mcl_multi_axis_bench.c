@@ -0,0 +1,527 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "hpm_mcl_multi_axis.h"
+#include "mcl_multi_axis_bench.h"
+
+#define BENCH_2PI               (6.28318530717959f)
+#define BENCH_SQRT3             (1.73205080756888f)
+
+/* simulated board, the numbers of bldc_foc */
+#define BENCH_PWM_FREQUENCY     (20000)
+#define BENCH_TS                (1.0f / BENCH_PWM_FREQUENCY)
+#define BENCH_PERIODS_MS(ms)    ((uint32_t)(ms) * (BENCH_PWM_FREQUENCY / 1000))
+#define BENCH_MCU_CLOCK_TICK    (480000000)
+#define BENCH_PWM_CLOCK_TICK    (100000000)
+#define BENCH_PWM_DEAD_AREA_TICK    (100)
+#define BENCH_ENCODER_PRECISION (4000)
+#define BENCH_SUBSTEPS          (10)
+
+#define BENCH_POLE_NUM          (4)
+#define BENCH_RES               (0.36f)
+#define BENCH_LS                (0.0004f)
+#define BENCH_FLUX              (0.0069f)
+#define BENCH_VBUS              (24.0f)
+#define BENCH_CURRENT_LOOP_BANDWIDTH    (1000.0f)
+
+/* the duty cycles of both paths may only differ by rounding */
+#define BENCH_DUTY_TOLERANCE    (1e-4f)
+
+/* the callbacks below are written out for 4 axes */
+#define BENCH_AXIS_NUM          (4)
+#if BENCH_AXIS_NUM > MCL_MULTI_AXIS_MAX
+#error "MCL_MULTI_AXIS_MAX is below the number of axes of the bench"
+#endif
+
+/* hpm_mcl_loop per axis, the reference, and hpm_mcl_multi_axis_loop, which drives the motors */
+#define BENCH_PATH_LOOP         (0)
+#define BENCH_PATH_MULTI        (1)
+#define BENCH_PATH_NUM          (2)
+
+typedef struct {
+    mcl_encoder_t encoder;
+    mcl_filter_iir_df1_t encoder_iir;
+    mcl_filter_iir_df1_memory_t encoder_iir_mem[2];
+    mcl_analog_t analog;
+    mcl_drivers_t drivers;
+    mcl_control_t control;
+    mcl_loop_t loop;
+    struct {
+        mcl_cfg_t mcl;
+        mcl_encoer_cfg_t encoder;
+        mcl_filter_iir_df1_cfg_t encoder_iir;
+        mcl_filter_iir_df1_matrix_t encoder_iir_mat[2];
+        mcl_analog_cfg_t analog;
+        mcl_drivers_cfg_t drivers;
+        mcl_control_cfg_t control;
+        mcl_loop_cfg_t loop;
+    } cfg;
+} bench_stack_t;
+
+/* one motor held at its speed by a load machine, and its peripherals */
+typedef struct {
+    float id;
+    float iq;
+    float speed;                /**< mechanical, rad/s */
+    double position;            /**< mechanical, rad */
+    int32_t adc[MCL_ANALOG_CHN_NUM];
+    float encoder_theta;        /**< mechanical, [0, 2pi) */
+    float duty[BENCH_PATH_NUM][mcl_drivers_chn_c + 1];  /**< shadow registers written by each path */
+    float duty_active[mcl_drivers_chn_c + 1];           /**< loaded at the PWM reload */
+} bench_axis_t;
+
+typedef struct {
+    hpm_mcl_stat_t (*analog_get_value)(mcl_analog_chn_t chn, int32_t *value);
+    hpm_mcl_stat_t (*encoder_get_theta)(float *theta);
+    hpm_mcl_stat_t (*pwm_duty_set[BENCH_PATH_NUM])(mcl_drivers_channel_t chn, float duty);
+} bench_callback_t;
+
+typedef struct {
+    double sum_sq;
+    float max;
+    uint32_t num;
+} bench_err_t;
+
+/* per axis: speed of the load machine and the iq steps */
+static const float bench_speed[BENCH_AXIS_NUM] = {50.0f, -80.0f, 120.0f, 20.0f};
+static const float bench_ref_q[BENCH_AXIS_NUM][2] = {
+    {1.0f, -1.0f}, {-1.5f, 2.0f}, {2.0f, 0.5f}, {0.5f, -2.0f}
+};
+
+static bench_stack_t bench_stack[BENCH_PATH_NUM][BENCH_AXIS_NUM];
+static bench_axis_t bench_axis[BENCH_AXIS_NUM];
+static mcl_multi_axis_t bench_multi;
+
+/*
+ * board callbacks, the application of a multi-axis board has one set of them per axis
+ */
+static void bench_control_init(void)
+{
+}
+
+static hpm_mcl_stat_t bench_analog_init(void)
+{
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t bench_analog_update_sample_location(mcl_analog_chn_t chn, uint32_t tick)
+{
+    (void)chn;
+    (void)tick;
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t bench_encoder_start_sample(void)
+{
+    return mcl_success;
+}
+
+static void bench_pwm_init(void)
+{
+}
+
+static hpm_mcl_stat_t bench_pwm_enable_all(void)
+{
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t bench_pwm_disable_all(void)
+{
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t bench_pwm_channel(mcl_drivers_channel_t chn)
+{
+    (void)chn;
+    return mcl_success;
+}
+
+static inline hpm_mcl_stat_t bench_pwm_duty_set(uint32_t path, uint32_t axis, mcl_drivers_channel_t chn, float duty)
+{
+    if (chn > mcl_drivers_chn_c) {
+        return mcl_invalid_argument;
+    }
+    bench_axis[axis].duty[path][chn] = duty;
+    return mcl_success;
+}
+
+#define BENCH_AXIS_CALLBACKS(n) \
+    static hpm_mcl_stat_t bench_analog_get_value_##n(mcl_analog_chn_t chn, int32_t *value) \
+    { \
+        *value = bench_axis[n].adc[chn]; \
+        return mcl_success; \
+    } \
+    static hpm_mcl_stat_t bench_encoder_get_theta_##n(float *theta) \
+    { \
+        *theta = bench_axis[n].encoder_theta; \
+        return mcl_success; \
+    } \
+    static hpm_mcl_stat_t bench_pwm_duty_set_loop_##n(mcl_drivers_channel_t chn, float duty) \
+    { \
+        return bench_pwm_duty_set(BENCH_PATH_LOOP, n, chn, duty); \
+    } \
+    static hpm_mcl_stat_t bench_pwm_duty_set_multi_##n(mcl_drivers_channel_t chn, float duty) \
+    { \
+        return bench_pwm_duty_set(BENCH_PATH_MULTI, n, chn, duty); \
+    }
+
+BENCH_AXIS_CALLBACKS(0)
+BENCH_AXIS_CALLBACKS(1)
+BENCH_AXIS_CALLBACKS(2)
+BENCH_AXIS_CALLBACKS(3)
+
+#define BENCH_AXIS_CALLBACK_ENTRY(n) \
+    {bench_analog_get_value_##n, bench_encoder_get_theta_##n, {bench_pwm_duty_set_loop_##n, bench_pwm_duty_set_multi_##n}}
+
+static const bench_callback_t bench_callback[BENCH_AXIS_NUM] = {
+    BENCH_AXIS_CALLBACK_ENTRY(0),
+    BENCH_AXIS_CALLBACK_ENTRY(1),
+    BENCH_AXIS_CALLBACK_ENTRY(2),
+    BENCH_AXIS_CALLBACK_ENTRY(3),
+};
+
+/*
+ * motor model, averaged over the PWM period as in mcl_plant_sim, without dead time
+ */
+static void bench_motor_step(bench_axis_t *axis)
+{
+    float dt = BENCH_TS / BENCH_SUBSTEPS;
+    float va = (1.0f - axis->duty_active[mcl_drivers_chn_a]) * BENCH_VBUS;
+    float vb = (1.0f - axis->duty_active[mcl_drivers_chn_b]) * BENCH_VBUS;
+    float vc = (1.0f - axis->duty_active[mcl_drivers_chn_c]) * BENCH_VBUS;
+    float valpha = (2.0f * va - vb - vc) / 3.0f;
+    float vbeta = (vb - vc) / BENCH_SQRT3;
+    float we = axis->speed * BENCH_POLE_NUM;
+
+    for (uint32_t n = 0; n < BENCH_SUBSTEPS; n++) {
+        float theta = (float)fmod(axis->position * BENCH_POLE_NUM, (double)BENCH_2PI);
+        float s = sinf(theta);
+        float c = cosf(theta);
+        float vd = valpha * c + vbeta * s;
+        float vq = -valpha * s + vbeta * c;
+
+        axis->id += (vd - BENCH_RES * axis->id + we * BENCH_LS * axis->iq) / BENCH_LS * dt;
+        axis->iq += (vq - BENCH_RES * axis->iq - we * (BENCH_LS * axis->id + BENCH_FLUX)) / BENCH_LS * dt;
+        axis->position += (double)(axis->speed * dt);
+    }
+}
+
+static int32_t bench_adc_convert(bench_stack_t *stack, mcl_analog_chn_t chn, float current)
+{
+    physical_board_analog_t *analog = &stack->cfg.mcl.physical.board.analog[chn];
+    int32_t adc = (int32_t)lrintf(current * analog->sample_res * analog->opamp_gain * analog->sample_precision / analog->adc_reference_vol);
+
+    if (adc > analog->sample_precision / 2) {
+        adc = analog->sample_precision / 2;
+    } else if (adc < -(analog->sample_precision / 2)) {
+        adc = -(analog->sample_precision / 2);
+    }
+    return adc;
+}
+
+static void bench_motor_sample(uint32_t n)
+{
+    bench_axis_t *axis = &bench_axis[n];
+    float theta = (float)fmod(axis->position * BENCH_POLE_NUM, (double)BENCH_2PI);
+    float s = sinf(theta);
+    float c = cosf(theta);
+    float ialpha = axis->id * c - axis->iq * s;
+    float ibeta = axis->id * s + axis->iq * c;
+    double count = floor(axis->position * BENCH_ENCODER_PRECISION / (double)BENCH_2PI);
+    float abs_theta = (float)(count * (double)BENCH_2PI / BENCH_ENCODER_PRECISION);
+
+    axis->adc[analog_a_current] = bench_adc_convert(&bench_stack[0][n], analog_a_current, ialpha);
+    axis->adc[analog_b_current] = bench_adc_convert(&bench_stack[0][n], analog_b_current, -0.5f * ialpha + 0.5f * BENCH_SQRT3 * ibeta);
+    abs_theta = fmodf(abs_theta, BENCH_2PI);
+    axis->encoder_theta = (abs_theta < 0) ? (abs_theta + BENCH_2PI) : abs_theta;
+}
+
+/*
+ * axis setup, following the bldc_foc sample
+ */
+static void bench_pid_init(mcl_control_pid_t *pid, float kp, float ki, float limit)
+{
+    pid->cfg.kp = kp;
+    pid->cfg.ki = ki;
+    pid->cfg.integral_max = limit;
+    pid->cfg.integral_min = -limit;
+    pid->cfg.output_max = limit;
+    pid->cfg.output_min = -limit;
+}
+
+static void bench_stack_cfg(bench_stack_t *stack, const bench_callback_t *callback, uint32_t path)
+{
+    mcl_cfg_t *mcl = &stack->cfg.mcl;
+    float wc = BENCH_CURRENT_LOOP_BANDWIDTH * BENCH_2PI;
+
+    for (uint32_t i = analog_a_current; i <= analog_b_current; i++) {
+        mcl->physical.board.analog[i].adc_reference_vol = 3.3;
+        mcl->physical.board.analog[i].opamp_gain = 10;
+        mcl->physical.board.analog[i].sample_precision = 4095;
+        mcl->physical.board.analog[i].sample_res = 0.01f;
+    }
+    mcl->physical.board.num_current_sample_res = 2;
+    mcl->physical.board.pwm_dead_time_tick = BENCH_PWM_DEAD_AREA_TICK;
+    mcl->physical.board.pwm_frequency = BENCH_PWM_FREQUENCY;
+    mcl->physical.board.pwm_reload = BENCH_PWM_CLOCK_TICK / BENCH_PWM_FREQUENCY - 1;
+    mcl->physical.time.adc_sample_ts = MCL_FREQUENCY_TO_PERIOD(BENCH_PWM_FREQUENCY);
+    mcl->physical.time.current_loop_ts = MCL_FREQUENCY_TO_PERIOD(BENCH_PWM_FREQUENCY);
+    mcl->physical.time.encoder_process_ts = MCL_FREQUENCY_TO_PERIOD(BENCH_PWM_FREQUENCY);
+    mcl->physical.time.speed_loop_ts = MCL_FREQUENCY_TO_PERIOD(BENCH_PWM_FREQUENCY) * 5;
+    mcl->physical.time.position_loop_ts = MCL_FREQUENCY_TO_PERIOD(BENCH_PWM_FREQUENCY) * 5;
+    mcl->physical.time.mcu_clock_tick = BENCH_MCU_CLOCK_TICK;
+    mcl->physical.time.pwm_clock_tick = BENCH_PWM_CLOCK_TICK;
+    mcl->physical.motor.i_max = 9;
+    mcl->physical.motor.inertia = 3e-5f;
+    mcl->physical.motor.ls = BENCH_LS;
+    mcl->physical.motor.ld = BENCH_LS;
+    mcl->physical.motor.lq = BENCH_LS;
+    mcl->physical.motor.res = BENCH_RES;
+    mcl->physical.motor.flux = BENCH_FLUX;
+    mcl->physical.motor.pole_num = BENCH_POLE_NUM;
+    mcl->physical.motor.power = 50;
+    mcl->physical.motor.rpm_max = 4000;
+    mcl->physical.motor.vbus = BENCH_VBUS;
+    mcl->physical.motor.hall = phase_120;
+
+    stack->cfg.analog.enable_a_current = true;
+    stack->cfg.analog.enable_b_current = true;
+    stack->cfg.analog.callback.init = bench_analog_init;
+    stack->cfg.analog.callback.update_sample_location = bench_analog_update_sample_location;
+    stack->cfg.analog.callback.get_value = callback->analog_get_value;
+
+    stack->cfg.encoder.communication_interval_us = 0;
+    stack->cfg.encoder.disable_start_sample_interrupt = true;
+    stack->cfg.encoder.period_call_time_s = MCL_FREQUENCY_TO_PERIOD(BENCH_PWM_FREQUENCY);
+    stack->cfg.encoder.precision = BENCH_ENCODER_PRECISION;
+    stack->cfg.encoder.speed_abs_switch_m_t = 5;
+    stack->cfg.encoder.speed_cal_method = encoder_method_m;
+    stack->cfg.encoder.timeout_s = 0.5;
+    stack->cfg.encoder.callback.start_sample = bench_encoder_start_sample;
+    stack->cfg.encoder.callback.get_theta = callback->encoder_get_theta;
+    /* low pass, fpass 100 fstop 2000 */
+    stack->cfg.encoder_iir.section = 2;
+    stack->cfg.encoder_iir.matrix = stack->cfg.encoder_iir_mat;
+    stack->cfg.encoder_iir_mat[0].a1 = -1.947404031871316831825424742419272661209f;
+    stack->cfg.encoder_iir_mat[0].a2 = 0.95152023575172306468772376319975592196f;
+    stack->cfg.encoder_iir_mat[0].b0 = 1;
+    stack->cfg.encoder_iir_mat[0].b1 = 2;
+    stack->cfg.encoder_iir_mat[0].b2 = 1;
+    stack->cfg.encoder_iir_mat[0].scale = 0.001029050970101526990552187612593115773f;
+    stack->cfg.encoder_iir_mat[1].a1 = -1.88285893096534651114382086234400048852f;
+    stack->cfg.encoder_iir_mat[1].a2 = 0.886838706662149367510039610351668670774f;
+    stack->cfg.encoder_iir_mat[1].b0 = 1;
+    stack->cfg.encoder_iir_mat[1].b1 = 2;
+    stack->cfg.encoder_iir_mat[1].b2 = 1;
+    stack->cfg.encoder_iir_mat[1].scale = 0.000994943924200649039424337871651005116f;
+
+    stack->cfg.drivers.callback.init = bench_pwm_init;
+    stack->cfg.drivers.callback.enable_all_drivers = bench_pwm_enable_all;
+    stack->cfg.drivers.callback.disable_all_drivers = bench_pwm_disable_all;
+    stack->cfg.drivers.callback.update_duty_cycle = callback->pwm_duty_set[path];
+    stack->cfg.drivers.callback.enable_drivers = bench_pwm_channel;
+    stack->cfg.drivers.callback.disable_drivers = bench_pwm_channel;
+
+    /* the current loop as a first order system of the chosen bandwidth */
+    stack->cfg.control.callback.init = bench_control_init;
+    bench_pid_init(&stack->cfg.control.currentd_pid_cfg, BENCH_LS * wc, BENCH_RES * wc * BENCH_TS, 14);
+    bench_pid_init(&stack->cfg.control.currentq_pid_cfg, BENCH_LS * wc, BENCH_RES * wc * BENCH_TS, 14);
+    bench_pid_init(&stack->cfg.control.speed_pid_cfg, 0.06f, 0.0005f, 5);
+    bench_pid_init(&stack->cfg.control.position_pid_cfg, 40.0f, 0, 300);
+
+    stack->cfg.loop.mode = mcl_mode_foc;
+    stack->cfg.loop.enable_speed_loop = false;
+    stack->cfg.loop.enable_position_loop = false;
+}
+
+static hpm_mcl_stat_t bench_stack_init(bench_stack_t *stack)
+{
+    mcl_user_value_t user = {.value = 0, .enable = true};
+    hpm_mcl_stat_t stat;
+
+    stat = hpm_mcl_analog_init(&stack->analog, &stack->cfg.analog, &stack->cfg.mcl);
+    if (stat == mcl_success) {
+        stat = hpm_mcl_filter_iir_df1_init(&stack->encoder_iir, &stack->cfg.encoder_iir, &stack->encoder_iir_mem[0]);
+    }
+    if (stat == mcl_success) {
+        stat = hpm_mcl_encoder_init(&stack->encoder, &stack->cfg.mcl, &stack->cfg.encoder, &stack->encoder_iir);
+    }
+    if (stat == mcl_success) {
+        stat = hpm_mcl_drivers_init(&stack->drivers, &stack->cfg.drivers);
+    }
+    if (stat == mcl_success) {
+        stat = hpm_mcl_control_init(&stack->control, &stack->cfg.control);
+    }
+    if (stat == mcl_success) {
+        stat = hpm_mcl_loop_init(&stack->loop, &stack->cfg.loop, &stack->cfg.mcl,
+                        &stack->encoder, &stack->analog, &stack->control, &stack->drivers, NULL);
+    }
+    if (stat != mcl_success) {
+        return stat;
+    }
+    hpm_mcl_disable_dead_area_compensation(&stack->loop);
+    hpm_mcl_loop_set_current_d(&stack->loop, user);
+    hpm_mcl_loop_set_current_q(&stack->loop, user);
+    hpm_mcl_loop_enable(&stack->loop);
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t bench_init(uint32_t num)
+{
+    mcl_loop_t *loop[BENCH_AXIS_NUM];
+
+    memset(bench_stack, 0, sizeof(bench_stack));
+    memset(bench_axis, 0, sizeof(bench_axis));
+    memset(&bench_multi, 0, sizeof(bench_multi));
+    for (uint32_t n = 0; n < num; n++) {
+        bench_axis[n].speed = bench_speed[n];
+        for (uint32_t path = 0; path < BENCH_PATH_NUM; path++) {
+            bench_stack_cfg(&bench_stack[path][n], &bench_callback[n], path);
+        }
+        bench_motor_sample(n);
+        for (uint32_t path = 0; path < BENCH_PATH_NUM; path++) {
+            if (bench_stack_init(&bench_stack[path][n]) != mcl_success) {
+                return mcl_fail;
+            }
+        }
+        loop[n] = &bench_stack[BENCH_PATH_MULTI][n].loop;
+    }
+    return hpm_mcl_multi_axis_init(&bench_multi, loop, num, NULL);
+}
+
+/*
+ * the motor only sees the line voltages, hpm_mcl_control_svpwm moves the zero vectors off
+ * centre on some sector borders, e.g. for alpha = 0 and beta < 0
+ */
+static inline float bench_line_duty(const bench_axis_t *axis, uint32_t path, uint32_t from, uint32_t to)
+{
+    return axis->duty[path][from] - axis->duty[path][to];
+}
+
+static void bench_err_add(bench_err_t *err, float val)
+{
+    val = fabsf(val);
+    err->sum_sq += (double)val * val;
+    err->num++;
+    if (val > err->max) {
+        err->max = val;
+    }
+}
+
+static uint32_t bench_err_check(const char *name, const char *unit, const bench_err_t *err,
+                                float rms_limit, float max_limit)
+{
+    float rms = (err->num != 0) ? (float)sqrt(err->sum_sq / err->num) : 0;
+    bool pass = (err->num != 0) && (rms <= rms_limit) && (err->max <= max_limit);
+
+    printf("  %-20s rms %9.6f  max %9.6f %-2s (limit %g / %g) %s\n", name, (double)rms, (double)err->max,
+            unit, (double)rms_limit, (double)max_limit, pass ? "ok" : "FAILED");
+    return pass ? 0 : 1;
+}
+
+/*
+ * num axes for 200 ms, one iq step per axis at 100 ms. Every PWM period both paths run on the
+ * same samples, the batched one drives the motors.
+ */
+static uint32_t bench_run_axes(uint32_t num)
+{
+    const uint32_t periods = BENCH_PERIODS_MS(200);
+    const uint32_t settle = BENCH_PERIODS_MS(2);
+    const char *unit = mcl_bench_tick_unit();
+    bench_err_t err_duty = {0}, err_d = {0}, err_q = {0};
+    uint64_t ticks[BENCH_PATH_NUM] = {0};
+    uint64_t start;
+    uint32_t failed = 0;
+    uint32_t step_at = 0;
+    uint32_t phase;
+    double mean[BENCH_PATH_NUM];
+
+    printf("%u axes:\n", (unsigned int)num);
+    if (bench_init(num) != mcl_success) {
+        printf("  init FAILED\n");
+        return 1;
+    }
+    for (uint32_t k = 0; k < periods; k++) {
+        phase = (k < periods / 2) ? 0 : 1;
+        if ((k == 0) || (k == periods / 2)) {
+            mcl_user_value_t user = {.enable = true};
+
+            step_at = k;
+            for (uint32_t n = 0; n < num; n++) {
+                user.value = bench_ref_q[n][phase];
+                for (uint32_t path = 0; path < BENCH_PATH_NUM; path++) {
+                    hpm_mcl_loop_set_current_q(&bench_stack[path][n].loop, user);
+                }
+            }
+        }
+
+        /* sample at the reload, the encoders are processed ahead of the loops on both paths */
+        for (uint32_t n = 0; n < num; n++) {
+            bench_motor_sample(n);
+            for (uint32_t path = 0; path < BENCH_PATH_NUM; path++) {
+                hpm_mcl_encoder_process(&bench_stack[path][n].encoder, BENCH_MCU_CLOCK_TICK / BENCH_PWM_FREQUENCY);
+            }
+        }
+        /* the paths take turns to run first, so that neither always finds the caches warm */
+        for (uint32_t i = 0; i < BENCH_PATH_NUM; i++) {
+            uint32_t path = (i + k) % BENCH_PATH_NUM;
+
+            start = mcl_bench_get_ticks();
+            if (path == BENCH_PATH_LOOP) {
+                for (uint32_t n = 0; n < num; n++) {
+                    hpm_mcl_loop(&bench_stack[BENCH_PATH_LOOP][n].loop);
+                }
+            } else {
+                hpm_mcl_multi_axis_loop(&bench_multi);
+            }
+            ticks[path] += mcl_bench_get_ticks() - start;
+        }
+
+        /* the new duty cycles are loaded at the next reload */
+        for (uint32_t n = 0; n < num; n++) {
+            bench_axis_t *axis = &bench_axis[n];
+
+            bench_err_add(&err_duty, bench_line_duty(axis, BENCH_PATH_MULTI, mcl_drivers_chn_a, mcl_drivers_chn_b) -
+                                     bench_line_duty(axis, BENCH_PATH_LOOP, mcl_drivers_chn_a, mcl_drivers_chn_b));
+            bench_err_add(&err_duty, bench_line_duty(axis, BENCH_PATH_MULTI, mcl_drivers_chn_b, mcl_drivers_chn_c) -
+                                     bench_line_duty(axis, BENCH_PATH_LOOP, mcl_drivers_chn_b, mcl_drivers_chn_c));
+            memcpy(axis->duty_active, axis->duty[BENCH_PATH_MULTI], sizeof(axis->duty_active));
+            bench_motor_step(axis);
+            if ((k - step_at) >= settle) {
+                bench_err_add(&err_d, axis->id);
+                bench_err_add(&err_q, bench_ref_q[n][phase] - axis->iq);
+            }
+        }
+    }
+    failed += bench_err_check("line duty difference", "", &err_duty, BENCH_DUTY_TOLERANCE, BENCH_DUTY_TOLERANCE);
+    failed += bench_err_check("id error", "A", &err_d, 0.1f, 0.4f);
+    failed += bench_err_check("iq error", "A", &err_q, 0.1f, 0.4f);
+
+    for (uint32_t path = 0; path < BENCH_PATH_NUM; path++) {
+        mean[path] = (double)ticks[path] / periods;
+    }
+    printf("  isr: %u x hpm_mcl_loop %.1f %s, hpm_mcl_multi_axis_loop %.1f %s, saved %.1f %s (%.1f%%)\n",
+            (unsigned int)num, mean[BENCH_PATH_LOOP], unit, mean[BENCH_PATH_MULTI], unit,
+            mean[BENCH_PATH_LOOP] - mean[BENCH_PATH_MULTI], unit,
+            100.0 * (1.0 - mean[BENCH_PATH_MULTI] / mean[BENCH_PATH_LOOP]));
+    return failed;
+}
+
+uint32_t mcl_multi_axis_bench_run(void)
+{
+    uint32_t failed = 0;
+
+    for (uint32_t num = 1; num <= BENCH_AXIS_NUM; num++) {
+        failed += bench_run_axes(num);
+        printf("\n");
+    }
+    return failed;
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef MCL_MULTI_AXIS_BENCH_H
+#define MCL_MULTI_AXIS_BENCH_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Provided by the platform: a free running counter for timing the loops and the name of
+ * its unit, e.g. "cycles" on the board or "ns" on the host.
+ */
+uint64_t mcl_bench_get_ticks(void);
+const char *mcl_bench_tick_unit(void);
+
+/*
+ * Runs 1 to MCL_MULTI_AXIS_MAX foc axes against motor models twice per PWM period: once
+ * through hpm_mcl_loop per axis and once through hpm_mcl_multi_axis_loop, on the same
+ * samples. The duty cycles of both are compared and the tracking of the current references
+ * is checked, then the ISR cost of both and the time saved by the batched pass is printed.
+ *
+ * Returns the number of failed checks.
+ */
+uint32_t mcl_multi_axis_bench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MCL_MULTI_AXIS_BENCH_H */
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "hpm_csr_drv.h"
+#include "mcl_sim.h"
+
+uint64_t mcl_host_get_ticks(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t mcl_sim_get_ticks(void)
+{
+    return mcl_host_get_ticks();
+}
+
+const char *mcl_sim_tick_unit(void)
+{
+    return "ns";
+}
+
+uint64_t mcl_sim_ticks_per_second(void)
+{
+    return 1000000000ULL;
+}
+
+void mcl_user_delay_us(uint64_t tick)
+{
+    (void)tick;
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t limit = 0;
+    uint32_t failed;
+
+    if (argc > 1) {
+        limit = strtoull(argv[1], NULL, 0);
+    }
+    failed = mcl_sim_run(limit);
+    printf("%s\n", (failed == 0) ? "plant sim PASSED" : "plant sim FAILED");
+    return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include "board.h"
+#include "hpm_csr_drv.h"
+#include "hpm_clock_drv.h"
+#include "mcl_sim.h"
+
+/* mean ISR cost allowed per scenario, 0 to only report it */
+#define SIM_ISR_CYCLE_LIMIT (0)
+
+uint64_t mcl_sim_get_ticks(void)
+{
+    return hpm_csr_get_core_mcycle();
+}
+
+const char *mcl_sim_tick_unit(void)
+{
+    return "cycles";
+}
+
+uint64_t mcl_sim_ticks_per_second(void)
+{
+    return clock_get_frequency(clock_cpu0);
+}
+
+void mcl_user_delay_us(uint64_t tick)
+{
+    board_delay_us(tick);
+}
+
+int main(void)
+{
+    uint32_t failed;
+
+    board_init();
+    printf("cpu0:\t\t %dHz\n\n", clock_get_frequency(clock_cpu0));
+
+    failed = mcl_sim_run(SIM_ISR_CYCLE_LIMIT);
+    printf("%s\n", (failed == 0) ? "plant sim PASSED" : "plant sim FAILED");
+
+    while (1) {
+    }
+    return 0;
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <math.h>
+#include "mcl_plant.h"
+
+#define PLANT_PI            (3.14159265358979f)
+#define PLANT_2PI           (6.28318530717959f)
+#define PLANT_SQRT3         (1.73205080756888f)
+#define PLANT_SQRT3_DIV2    (0.86602540378444f)
+
+static inline float plant_clamp(float x, float lo, float hi)
+{
+    return (x < lo) ? lo : ((x > hi) ? hi : x);
+}
+
+static inline float plant_sign(float x)
+{
+    return (x > 0) ? 1.0f : ((x < 0) ? -1.0f : 0.0f);
+}
+
+static inline float plant_wrap(float theta)
+{
+    theta = fmodf(theta, PLANT_2PI);
+    return (theta < 0) ? (theta + PLANT_2PI) : theta;
+}
+
+static void plant_pmsm_mechanics(mcl_plant_pmsm_t *plant, float dt)
+{
+    const mcl_plant_pmsm_cfg_t *cfg = plant->cfg;
+
+    plant->torque = 1.5f * cfg->pole_num * (cfg->flux * plant->iq + (cfg->ld - cfg->lq) * plant->id * plant->iq);
+    plant->speed += (plant->torque - cfg->friction * plant->speed - plant->load_torque) / cfg->inertia * dt;
+    plant->position += (double)(plant->speed * dt);
+    plant->theta = plant_wrap((float)fmod(plant->position * cfg->pole_num, (double)PLANT_2PI));
+}
+
+void mcl_plant_pmsm_init(mcl_plant_pmsm_t *plant, const mcl_plant_pmsm_cfg_t *cfg, double position)
+{
+    plant->cfg = cfg;
+    plant->id = 0;
+    plant->iq = 0;
+    plant->speed = 0;
+    plant->position = position;
+    plant->theta = plant_wrap((float)fmod(position * cfg->pole_num, (double)PLANT_2PI));
+    plant->torque = 0;
+    plant->load_torque = 0;
+}
+
+void mcl_plant_pmsm_get_current(const mcl_plant_pmsm_t *plant, float *ia, float *ib, float *ic)
+{
+    float s = sinf(plant->theta);
+    float c = cosf(plant->theta);
+    float alpha = plant->id * c - plant->iq * s;
+    float beta = plant->id * s + plant->iq * c;
+
+    *ia = alpha;
+    *ib = -0.5f * alpha + PLANT_SQRT3_DIV2 * beta;
+    *ic = -0.5f * alpha - PLANT_SQRT3_DIV2 * beta;
+}
+
+void mcl_plant_pmsm_step_inverter(mcl_plant_pmsm_t *plant, float duty_a, float duty_b, float duty_c, float ts)
+{
+    const mcl_plant_pmsm_cfg_t *cfg = plant->cfg;
+    float dt = ts / cfg->substeps;
+    float dead = 2.0f * cfg->dead_time / ts;
+
+    for (uint32_t n = 0; n < cfg->substeps; n++) {
+        float ia, ib, ic;
+        float va, vb, vc;
+        float valpha, vbeta, vd, vq;
+        float s, c, we;
+
+        mcl_plant_pmsm_get_current(plant, &ia, &ib, &ic);
+        va = plant_clamp(1.0f - duty_a - dead * plant_sign(ia), 0, 1) * cfg->vbus;
+        vb = plant_clamp(1.0f - duty_b - dead * plant_sign(ib), 0, 1) * cfg->vbus;
+        vc = plant_clamp(1.0f - duty_c - dead * plant_sign(ic), 0, 1) * cfg->vbus;
+        valpha = (2.0f * va - vb - vc) / 3.0f;
+        vbeta = (vb - vc) / PLANT_SQRT3;
+        s = sinf(plant->theta);
+        c = cosf(plant->theta);
+        vd = valpha * c + vbeta * s;
+        vq = -valpha * s + vbeta * c;
+        we = plant->speed * cfg->pole_num;
+
+        plant->id += (vd - cfg->rs * plant->id + we * cfg->lq * plant->iq) / cfg->ld * dt;
+        plant->iq += (vq - cfg->rs * plant->iq - we * (cfg->ld * plant->id + cfg->flux)) / cfg->lq * dt;
+        plant_pmsm_mechanics(plant, dt);
+    }
+}
+
+void mcl_plant_pmsm_step_six_step(mcl_plant_pmsm_t *plant, int32_t high, int32_t low, float duty, float ts)
+{
+    const mcl_plant_pmsm_cfg_t *cfg = plant->cfg;
+    float dt = ts / cfg->substeps;
+    float ls = 0.5f * (cfg->ld + cfg->lq);
+
+    for (uint32_t n = 0; n < cfg->substeps; n++) {
+        float iabc[3];
+        float e[3];
+        float i, we, alpha, beta, s, c;
+
+        if ((high < 0) || (low < 0) || (high == low)) {
+            /* no conducting pair, the diodes clear the current within the period */
+            plant->id = 0;
+            plant->iq = 0;
+            plant_pmsm_mechanics(plant, dt);
+            continue;
+        }
+        mcl_plant_pmsm_get_current(plant, &iabc[0], &iabc[1], &iabc[2]);
+        /* only the pair conducts, the current of the third phase has decayed at commutation */
+        i = 0.5f * (iabc[high] - iabc[low]);
+        if (i < 0) {
+            i = 0;
+        }
+        we = plant->speed * cfg->pole_num;
+        for (uint32_t k = 0; k < 3; k++) {
+            e[k] = -we * cfg->flux * sinf(plant->theta - (float)k * (PLANT_2PI / 3.0f));
+        }
+        i += (duty * cfg->vbus - 2.0f * cfg->rs * i - (e[high] - e[low])) / (2.0f * ls) * dt;
+        if (i < 0) {
+            i = 0;
+        }
+        iabc[0] = 0;
+        iabc[1] = 0;
+        iabc[2] = 0;
+        iabc[high] = i;
+        iabc[low] = -i;
+        alpha = iabc[0];
+        beta = (iabc[1] - iabc[2]) / PLANT_SQRT3;
+        s = sinf(plant->theta);
+        c = cosf(plant->theta);
+        plant->id = alpha * c + beta * s;
+        plant->iq = -alpha * s + beta * c;
+        plant_pmsm_mechanics(plant, dt);
+    }
+}
+
+uint8_t mcl_plant_pmsm_get_hall(const mcl_plant_pmsm_t *plant)
+{
+    float theta = plant_wrap(plant->theta - plant->cfg->hall_offset);
+    uint8_t u, v, w;
+
+    /* w lags u by 120 degrees and v by 240 degrees */
+    u = (theta < PLANT_PI) ? 1 : 0;
+    w = ((theta >= (PLANT_2PI / 3.0f)) && (theta < (5.0f * PLANT_PI / 3.0f))) ? 1 : 0;
+    v = ((theta >= (4.0f * PLANT_PI / 3.0f)) || (theta < (PLANT_PI / 3.0f))) ? 1 : 0;
+
+    return (uint8_t)((u << 2) | (v << 1) | w);
+}
+
+void mcl_plant_stepper_init(mcl_plant_stepper_t *plant, const mcl_plant_stepper_cfg_t *cfg, double position)
+{
+    plant->cfg = cfg;
+    plant->ia = 0;
+    plant->ib = 0;
+    plant->speed = 0;
+    plant->position = position;
+    plant->torque = 0;
+    plant->load_torque = 0;
+}
+
+void mcl_plant_stepper_step(mcl_plant_stepper_t *plant, float duty_a0, float duty_a1,
+                            float duty_b0, float duty_b1, float ts)
+{
+    const mcl_plant_stepper_cfg_t *cfg = plant->cfg;
+    float dt = ts / cfg->substeps;
+    float va = (duty_a1 - duty_a0) * cfg->vbus;
+    float vb = (duty_b1 - duty_b0) * cfg->vbus;
+
+    for (uint32_t n = 0; n < cfg->substeps; n++) {
+        float theta = (float)fmod(plant->position * cfg->pole_num, (double)PLANT_2PI);
+        float s = sinf(theta);
+        float c = cosf(theta);
+        float k = cfg->pole_num * cfg->flux;
+
+        plant->ia += (va - cfg->rs * plant->ia + k * plant->speed * s) / cfg->ls * dt;
+        plant->ib += (vb - cfg->rs * plant->ib - k * plant->speed * c) / cfg->ls * dt;
+        plant->torque = k * (plant->ib * c - plant->ia * s);
+        plant->speed += (plant->torque - cfg->friction * plant->speed - plant->load_torque) / cfg->inertia * dt;
+        plant->position += (double)(plant->speed * dt);
+    }
+}
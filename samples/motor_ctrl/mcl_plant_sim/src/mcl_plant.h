@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef MCL_PLANT_H
+#define MCL_PLANT_H
+
+#include <stdint.h>
+
+/**
+ * @brief Discrete-time motor models behind the hpm_mcl_v2 callbacks
+ *
+ * The models are averaged over one PWM period: the duty cycles written by the loop are held
+ * for the whole period and the electrical and mechanical equations are integrated with
+ * forward Euler in cfg->substeps steps.
+ *
+ * Inverter conventions follow hpm_mcl_control_svpwm and hpm_mcl_drivers_block_update:
+ * - foc: the duty of a phase is the share of the period its low side conducts, the phase
+ *   voltage is (1 - duty) * vbus. During the dead time the phase follows the freewheeling
+ *   diode, which costs 2 * dead_time / ts of the period against the current.
+ * - six-step: the high side of one phase switches with duty, the low side of another one
+ *   is on, the third phase floats. The conducting pair sees duty * vbus.
+ * - step: each winding sits in an H bridge of two half bridges x0 and x1 with the same
+ *   convention as foc, the winding voltage is (duty_x1 - duty_x0) * vbus.
+ *
+ * Currents are positive out of the inverter into the motor.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    float rs;           /**< phase resistance, ohm */
+    float ld;           /**< d axis inductance, H */
+    float lq;           /**< q axis inductance, H */
+    float flux;         /**< permanent magnet flux linkage, Wb */
+    int32_t pole_num;   /**< pole pairs */
+    float inertia;      /**< rotor and load inertia, kg m^2 */
+    float friction;     /**< viscous friction, N m s/rad */
+    float vbus;         /**< dc link voltage, V */
+    float dead_time;    /**< dead time of one switching edge, s, 0 for ideal switches */
+    float hall_offset;  /**< electrical angle of the hall sensor u rising edge, rad */
+    uint32_t substeps;  /**< integration steps per PWM period */
+} mcl_plant_pmsm_cfg_t;
+
+typedef struct {
+    const mcl_plant_pmsm_cfg_t *cfg;
+    float id;           /**< A */
+    float iq;           /**< A */
+    float speed;        /**< mechanical, rad/s */
+    double position;    /**< mechanical, rad, not wrapped */
+    float theta;        /**< electrical angle in [0, 2pi) */
+    float torque;       /**< electromagnetic torque, N m */
+    float load_torque;  /**< set by the user, N m */
+} mcl_plant_pmsm_t;
+
+typedef struct {
+    float rs;           /**< winding resistance, ohm */
+    float ls;           /**< winding inductance, H */
+    float flux;         /**< permanent magnet flux linkage, Wb */
+    int32_t pole_num;   /**< pole pairs, 50 for a 1.8 degree motor */
+    float inertia;      /**< kg m^2 */
+    float friction;     /**< N m s/rad */
+    float vbus;         /**< V */
+    uint32_t substeps;  /**< integration steps per PWM period */
+} mcl_plant_stepper_cfg_t;
+
+typedef struct {
+    const mcl_plant_stepper_cfg_t *cfg;
+    float ia;           /**< winding a current, A */
+    float ib;           /**< winding b current, A */
+    float speed;        /**< mechanical, rad/s */
+    double position;    /**< mechanical, rad, not wrapped */
+    float torque;       /**< N m */
+    float load_torque;  /**< N m */
+} mcl_plant_stepper_t;
+
+/**
+ * @brief Reset a PMSM at standstill
+ *
+ * @param plant @ref mcl_plant_pmsm_t
+ * @param cfg @ref mcl_plant_pmsm_cfg_t
+ * @param position mechanical rotor position, rad
+ */
+void mcl_plant_pmsm_init(mcl_plant_pmsm_t *plant, const mcl_plant_pmsm_cfg_t *cfg, double position);
+
+/**
+ * @brief Advance a PMSM on a three-phase inverter by one PWM period
+ *
+ * @param plant @ref mcl_plant_pmsm_t
+ * @param duty_a low side share of phase a in [0, 1]
+ * @param duty_b low side share of phase b in [0, 1]
+ * @param duty_c low side share of phase c in [0, 1]
+ * @param ts PWM period, s
+ */
+void mcl_plant_pmsm_step_inverter(mcl_plant_pmsm_t *plant, float duty_a, float duty_b, float duty_c, float ts);
+
+/**
+ * @brief Advance a PMSM on a six-step inverter by one PWM period
+ *
+ * @param plant @ref mcl_plant_pmsm_t
+ * @param high phase 0..2 whose high side switches, negative if none
+ * @param low phase 0..2 whose low side is on, negative if none
+ * @param duty high side on time in [0, 1]
+ * @param ts PWM period, s
+ */
+void mcl_plant_pmsm_step_six_step(mcl_plant_pmsm_t *plant, int32_t high, int32_t low, float duty, float ts);
+
+/**
+ * @brief Phase currents of a PMSM
+ *
+ * @param plant @ref mcl_plant_pmsm_t
+ * @param ia phase a, A
+ * @param ib phase b, A
+ * @param ic phase c, A
+ */
+void mcl_plant_pmsm_get_current(const mcl_plant_pmsm_t *plant, float *ia, float *ib, float *ic);
+
+/**
+ * @brief Levels of 120 degree hall sensors
+ *
+ * The sensors are placed so that the sector of hpm_mcl_control_get_block_sector counts down
+ * while the rotor turns in the positive direction, the direction motor_dir_back drives it.
+ *
+ * @param plant @ref mcl_plant_pmsm_t
+ * @return (u << 2) | (v << 1) | w
+ */
+uint8_t mcl_plant_pmsm_get_hall(const mcl_plant_pmsm_t *plant);
+
+/**
+ * @brief Reset a two-phase hybrid stepper at standstill
+ *
+ * @param plant @ref mcl_plant_stepper_t
+ * @param cfg @ref mcl_plant_stepper_cfg_t
+ * @param position mechanical rotor position, rad
+ */
+void mcl_plant_stepper_init(mcl_plant_stepper_t *plant, const mcl_plant_stepper_cfg_t *cfg, double position);
+
+/**
+ * @brief Advance a stepper on two H bridges by one PWM period
+ *
+ * @param plant @ref mcl_plant_stepper_t
+ * @param duty_a0 low side share of half bridge a0
+ * @param duty_a1 low side share of half bridge a1
+ * @param duty_b0 low side share of half bridge b0
+ * @param duty_b1 low side share of half bridge b1
+ * @param ts PWM period, s
+ */
+void mcl_plant_stepper_step(mcl_plant_stepper_t *plant, float duty_a0, float duty_a1,
+                            float duty_b0, float duty_b1, float ts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MCL_PLANT_H */
@@ -0,0 +1,1113 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "hpm_mcl_loop.h"
+#include "mcl_plant.h"
+#include "mcl_sim.h"
+
+#define SIM_PI                  (3.14159265358979f)
+#define SIM_2PI                 (6.28318530717959f)
+
+/* simulated board, the numbers of bldc_foc */
+#define SIM_PWM_FREQUENCY       (20000)
+#define SIM_TS                  (1.0f / SIM_PWM_FREQUENCY)
+#define SIM_PERIODS_MS(ms)      ((uint32_t)(ms) * (SIM_PWM_FREQUENCY / 1000))
+#define SIM_MCU_CLOCK_TICK      (480000000)
+#define SIM_PWM_CLOCK_TICK      (100000000)
+#define SIM_PWM_DEAD_AREA_TICK  (100)
+#define SIM_ENCODER_PRECISION   (4000)
+#define SIM_SPEED_LOOP_TIMES    (5)
+/* the block loop runs from a 1 ms timer */
+#define SIM_BLOCK_TIMER_TIMES   (20)
+#define SIM_BLOCK_ISR_FREQUENCY (SIM_PWM_FREQUENCY / SIM_BLOCK_TIMER_TIMES)
+
+#define SIM_PMSM_POLE_NUM       (4)
+#define SIM_PMSM_RES            (0.36f)
+#define SIM_PMSM_LS             (0.0004f)
+#define SIM_PMSM_FLUX           (0.0069f)
+#define SIM_PMSM_VBUS           (24.0f)
+#define SIM_CURRENT_LOOP_BANDWIDTH  (1000.0f)
+/*
+ * bldc_foc enables the dead area compensation, against the inverter model its offsets
+ * currently widen the current error instead of closing it, set to 1 to measure them
+ */
+#ifndef SIM_FOC_DEAD_AREA_COMPENSATION
+#define SIM_FOC_DEAD_AREA_COMPENSATION (0)
+#endif
+
+#define SIM_STEP_POLE_NUM       (50)
+
+#define SIM_RETURN_IF_FAIL(x) \
+    do { \
+        hpm_mcl_stat_t stat_ = (x); \
+        if (stat_ != mcl_success) { \
+            return stat_; \
+        } \
+    } while (0)
+
+typedef struct {
+    mcl_encoder_t encoder;
+    mcl_filter_iir_df1_t encoder_iir;
+    mcl_filter_iir_df1_memory_t encoder_iir_mem[2];
+    mcl_analog_t analog;
+    mcl_drivers_t drivers;
+    mcl_control_t control;
+    mcl_loop_t loop;
+    mcl_path_plan_t path;
+    struct {
+        mcl_cfg_t mcl;
+        mcl_encoer_cfg_t encoder;
+        mcl_filter_iir_df1_cfg_t encoder_iir;
+        mcl_filter_iir_df1_matrix_t encoder_iir_mat[2];
+        mcl_analog_cfg_t analog;
+        mcl_drivers_cfg_t drivers;
+        mcl_control_cfg_t control;
+        mcl_loop_cfg_t loop;
+        mcl_path_plan_cfg_t path;
+    } cfg;
+} sim_motor_t;
+
+/* what the peripherals of the board would show to the loop */
+typedef struct {
+    int32_t adc[MCL_ANALOG_CHN_NUM];
+    float encoder_theta;        /**< mechanical, [0, 2pi) */
+    float encoder_abs_theta;    /**< mechanical, multi-turn */
+    float hall_theta;           /**< mechanical, from the hall edges */
+    uint8_t hall;
+    float duty[mcl_drivers_chn_b1 + 1];     /**< shadow registers written by the loop */
+    float duty_active[mcl_drivers_chn_b1 + 1];  /**< loaded at the PWM reload */
+    uint32_t switch_on;         /**< one bit per mcl_drivers_chn_ah..cl */
+} sim_hw_t;
+
+typedef enum {
+    sim_stage_encoder = 0,
+    sim_stage_path,
+    sim_stage_clarke,
+    sim_stage_sincos,
+    sim_stage_park,
+    sim_stage_current_pi,
+    sim_stage_speed_pi,
+    sim_stage_position_pi,
+    sim_stage_invpark,
+    sim_stage_svpwm,
+    sim_stage_dead_area,
+    sim_stage_block_sector,
+    sim_stage_num
+} sim_stage_t;
+
+typedef struct {
+    uint64_t ticks;
+    uint64_t max;
+    uint32_t calls;
+} sim_cost_t;
+
+typedef struct {
+    double sum_sq;
+    float max;
+    uint32_t num;
+} sim_err_t;
+
+typedef struct {
+    const char *name;
+    uint32_t (*run)(sim_cost_t *cost, bool report);
+    uint32_t isr_frequency;
+} sim_scenario_t;
+
+static const char *const sim_stage_name[sim_stage_num] = {
+    "encoder", "path plan", "clarke", "sincos", "park", "current pi", "speed pi",
+    "position pi", "invpark", "svpwm", "dead area", "block sector"
+};
+
+static const mcl_plant_pmsm_cfg_t sim_pmsm_cfg = {
+    .rs = SIM_PMSM_RES,
+    .ld = SIM_PMSM_LS,
+    .lq = SIM_PMSM_LS,
+    .flux = SIM_PMSM_FLUX,
+    .pole_num = SIM_PMSM_POLE_NUM,
+    .inertia = 3e-5f,
+    .friction = 2e-5f,
+    .vbus = SIM_PMSM_VBUS,
+    .dead_time = (float)SIM_PWM_DEAD_AREA_TICK / SIM_PWM_CLOCK_TICK,
+    .hall_offset = -SIM_PI / 6.0f,
+    .substeps = 10,
+};
+
+static const mcl_plant_stepper_cfg_t sim_stepper_cfg = {
+    .rs = 1.2f,
+    .ls = 0.0025f,
+    .flux = 0.006f,
+    .pole_num = SIM_STEP_POLE_NUM,
+    .inertia = 1e-5f,
+    .friction = 1e-4f,
+    .vbus = 24.0f,
+    .substeps = 10,
+};
+
+static sim_motor_t sim_motor;
+static sim_hw_t sim_hw;
+static mcl_plant_pmsm_t sim_pmsm;
+static mcl_plant_stepper_t sim_stepper;
+
+static bool sim_probe_enable;
+static mcl_control_method_t sim_method;
+static uint64_t sim_stage_ticks[sim_stage_num];
+static uint32_t sim_stage_calls[sim_stage_num];
+static uint64_t sim_tick_overhead;
+
+/*
+ * stage probes, installed in the method table of the control module in place of the
+ * functions hpm_mcl_control_init selected
+ */
+static inline uint64_t sim_probe_begin(void)
+{
+    return mcl_sim_get_ticks();
+}
+
+static inline void sim_probe_end(sim_stage_t stage, uint64_t start)
+{
+    uint64_t ticks = mcl_sim_get_ticks() - start;
+
+    sim_stage_ticks[stage] += (ticks > sim_tick_overhead) ? (ticks - sim_tick_overhead) : 0;
+    sim_stage_calls[stage]++;
+}
+
+static hpm_mcl_type_t sim_probe_sin(hpm_mcl_type_t x)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_type_t y = sim_method.sin_x(x);
+
+    sim_probe_end(sim_stage_sincos, start);
+    return y;
+}
+
+static hpm_mcl_type_t sim_probe_cos(hpm_mcl_type_t x)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_type_t y = sim_method.cos_x(x);
+
+    sim_probe_end(sim_stage_sincos, start);
+    return y;
+}
+
+static void sim_probe_sincos(hpm_mcl_type_t x, hpm_mcl_type_t *sin_x, hpm_mcl_type_t *cos_x)
+{
+    uint64_t start = sim_probe_begin();
+
+    sim_method.sincos_x(x, sin_x, cos_x);
+    sim_probe_end(sim_stage_sincos, start);
+}
+
+static hpm_mcl_stat_t sim_probe_park(hpm_mcl_type_t alpha, hpm_mcl_type_t beta,
+                hpm_mcl_type_t sin_x, hpm_mcl_type_t cos_x,
+                hpm_mcl_type_t *d, hpm_mcl_type_t *q)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.park(alpha, beta, sin_x, cos_x, d, q);
+
+    sim_probe_end(sim_stage_park, start);
+    return stat;
+}
+
+static hpm_mcl_stat_t sim_probe_clarke(hpm_mcl_type_t ia, hpm_mcl_type_t ib, hpm_mcl_type_t ic,
+                hpm_mcl_type_t *alpha, hpm_mcl_type_t *beta)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.clarke(ia, ib, ic, alpha, beta);
+
+    sim_probe_end(sim_stage_clarke, start);
+    return stat;
+}
+
+static hpm_mcl_stat_t sim_probe_currentd_pid(hpm_mcl_type_t ref, hpm_mcl_type_t sens, mcl_control_pid_t *pid_x, hpm_mcl_type_t *output)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.currentd_pid(ref, sens, pid_x, output);
+
+    sim_probe_end(sim_stage_current_pi, start);
+    return stat;
+}
+
+static hpm_mcl_stat_t sim_probe_currentq_pid(hpm_mcl_type_t ref, hpm_mcl_type_t sens, mcl_control_pid_t *pid_x, hpm_mcl_type_t *output)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.currentq_pid(ref, sens, pid_x, output);
+
+    sim_probe_end(sim_stage_current_pi, start);
+    return stat;
+}
+
+static hpm_mcl_stat_t sim_probe_speed_pid(hpm_mcl_type_t ref, hpm_mcl_type_t sens, mcl_control_pid_t *pid_x, hpm_mcl_type_t *output)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.speed_pid(ref, sens, pid_x, output);
+
+    sim_probe_end(sim_stage_speed_pi, start);
+    return stat;
+}
+
+static hpm_mcl_stat_t sim_probe_position_pid(hpm_mcl_type_t ref, hpm_mcl_type_t sens, mcl_control_pid_t *pid_x, hpm_mcl_type_t *output)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.position_pid(ref, sens, pid_x, output);
+
+    sim_probe_end(sim_stage_position_pi, start);
+    return stat;
+}
+
+static hpm_mcl_stat_t sim_probe_invpark(hpm_mcl_type_t d, hpm_mcl_type_t q, hpm_mcl_type_t sin_x,
+                hpm_mcl_type_t cos_x, hpm_mcl_type_t *alpha, hpm_mcl_type_t *beta)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.invpark(d, q, sin_x, cos_x, alpha, beta);
+
+    sim_probe_end(sim_stage_invpark, start);
+    return stat;
+}
+
+static hpm_mcl_stat_t sim_probe_svpwm(hpm_mcl_type_t alpha, hpm_mcl_type_t beta, hpm_mcl_type_t vbus, mcl_control_svpwm_duty_t *duty)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.svpwm(alpha, beta, vbus, duty);
+
+    sim_probe_end(sim_stage_svpwm, start);
+    return stat;
+}
+
+static hpm_mcl_stat_t sim_probe_step_svpwm(hpm_mcl_type_t alpha, hpm_mcl_type_t beta, hpm_mcl_type_t vbus, mcl_control_svpwm_duty_t *duty)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.step_svpwm(alpha, beta, vbus, duty);
+
+    sim_probe_end(sim_stage_svpwm, start);
+    return stat;
+}
+
+static hpm_mcl_stat_t sim_probe_get_block_sector(hall_phase_t hall, uint8_t u, uint8_t v, uint8_t w, uint8_t *sector)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.get_block_sector(hall, u, v, w, sector);
+
+    sim_probe_end(sim_stage_block_sector, start);
+    return stat;
+}
+
+static hpm_mcl_stat_t sim_probe_dead_area(mcl_control_dead_area_compensation_t *dead_area,
+                float id, float iq, float theta,
+                float deadtime, float ts, mcl_control_dead_area_pwm_offset_t *pwm_out)
+{
+    uint64_t start = sim_probe_begin();
+    hpm_mcl_stat_t stat = sim_method.dead_area_polarity_detection(dead_area, id, iq, theta, deadtime, ts, pwm_out);
+
+    sim_probe_end(sim_stage_dead_area, start);
+    return stat;
+}
+
+static void sim_probe_install(mcl_control_t *control)
+{
+    sim_method = control->method;
+    if (!sim_probe_enable) {
+        return;
+    }
+    if (sim_method.sincos_x != NULL) {
+        control->method.sincos_x = sim_probe_sincos;
+    } else {
+        control->method.sin_x = sim_probe_sin;
+        control->method.cos_x = sim_probe_cos;
+    }
+    control->method.park = sim_probe_park;
+    control->method.clarke = sim_probe_clarke;
+    control->method.currentd_pid = sim_probe_currentd_pid;
+    control->method.currentq_pid = sim_probe_currentq_pid;
+    control->method.speed_pid = sim_probe_speed_pid;
+    control->method.position_pid = sim_probe_position_pid;
+    control->method.invpark = sim_probe_invpark;
+    control->method.svpwm = sim_probe_svpwm;
+    control->method.step_svpwm = sim_probe_step_svpwm;
+    control->method.get_block_sector = sim_probe_get_block_sector;
+    control->method.dead_area_polarity_detection = sim_probe_dead_area;
+}
+
+static void sim_encoder_process(uint32_t tick_deta)
+{
+    uint64_t start = sim_probe_begin();
+
+    hpm_mcl_encoder_process(&sim_motor.encoder, tick_deta);
+    if (sim_probe_enable) {
+        sim_probe_end(sim_stage_encoder, start);
+    }
+}
+
+static void sim_path_generate(void)
+{
+    uint64_t start = sim_probe_begin();
+
+    hpm_mcl_path_t_cure_generate(&sim_motor.path);
+    if (sim_probe_enable) {
+        sim_probe_end(sim_stage_path, start);
+    }
+}
+
+static void sim_cost_add(sim_cost_t *cost, uint64_t start)
+{
+    uint64_t ticks = mcl_sim_get_ticks() - start;
+
+    ticks = (ticks > sim_tick_overhead) ? (ticks - sim_tick_overhead) : 0;
+    cost->ticks += ticks;
+    cost->calls++;
+    if (ticks > cost->max) {
+        cost->max = ticks;
+    }
+}
+
+static void sim_err_add(sim_err_t *err, float val)
+{
+    val = fabsf(val);
+    err->sum_sq += (double)val * val;
+    err->num++;
+    if (val > err->max) {
+        err->max = val;
+    }
+}
+
+static uint32_t sim_err_check(const char *name, const char *unit, const sim_err_t *err,
+                              float rms_limit, float max_limit)
+{
+    float rms = (err->num != 0) ? (float)sqrt(err->sum_sq / err->num) : 0;
+    bool pass = (err->num != 0) && (rms <= rms_limit) && (err->max <= max_limit);
+
+    printf("  %-20s rms %9.4f  max %9.4f %-5s (limit %g / %g) %s\n", name, (double)rms, (double)err->max,
+            unit, (double)rms_limit, (double)max_limit, pass ? "ok" : "FAILED");
+    return pass ? 0 : 1;
+}
+
+static inline float sim_wrap(float theta)
+{
+    theta = fmodf(theta, SIM_2PI);
+    return (theta < 0) ? (theta + SIM_2PI) : theta;
+}
+
+static inline float sim_wrap_pm_pi(float theta)
+{
+    theta = sim_wrap(theta + SIM_PI);
+    return theta - SIM_PI;
+}
+
+/*
+ * board callbacks
+ */
+static void sim_control_init(void)
+{
+}
+
+static hpm_mcl_stat_t sim_analog_init(void)
+{
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_analog_update_sample_location(mcl_analog_chn_t chn, uint32_t tick)
+{
+    (void)chn;
+    (void)tick;
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_analog_get_value(mcl_analog_chn_t chn, int32_t *value)
+{
+    *value = sim_hw.adc[chn];
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_encoder_start_sample(void)
+{
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_encoder_get_theta(float *theta)
+{
+    *theta = sim_hw.encoder_theta;
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_encoder_get_abs_theta(float *theta)
+{
+    *theta = sim_hw.encoder_abs_theta;
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_hall_get_theta(float *theta)
+{
+    *theta = sim_hw.hall_theta;
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_encoder_get_uvw_level(mcl_encoder_uvw_level_t *level)
+{
+    level->u = (sim_hw.hall >> 2) & 0x01;
+    level->v = (sim_hw.hall >> 1) & 0x01;
+    level->w = sim_hw.hall & 0x01;
+    return mcl_success;
+}
+
+static void sim_pwm_init(void)
+{
+}
+
+static hpm_mcl_stat_t sim_pwm_enable_all(void)
+{
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_pwm_disable_all(void)
+{
+    sim_hw.switch_on = 0;
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_pwm_duty_set(mcl_drivers_channel_t chn, float duty)
+{
+    if (chn > mcl_drivers_chn_b1) {
+        return mcl_invalid_argument;
+    }
+    sim_hw.duty[chn] = duty;
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_pwm_enable_channel(mcl_drivers_channel_t chn)
+{
+    sim_hw.switch_on |= 1U << (chn - mcl_drivers_chn_ah);
+    return mcl_success;
+}
+
+static hpm_mcl_stat_t sim_pwm_disable_channel(mcl_drivers_channel_t chn)
+{
+    sim_hw.switch_on &= ~(1U << (chn - mcl_drivers_chn_ah));
+    return mcl_success;
+}
+
+/*
+ * sampling of the plant by the simulated peripherals
+ */
+static int32_t sim_adc_convert(mcl_analog_chn_t chn, float current)
+{
+    physical_board_analog_t *analog = &sim_motor.cfg.mcl.physical.board.analog[chn];
+    float val = current * analog->sample_res * analog->opamp_gain * analog->sample_precision / analog->adc_reference_vol;
+    int32_t adc = (int32_t)lrintf(val);
+
+    /* a 12-bit converter around its midpoint */
+    if (adc > analog->sample_precision / 2) {
+        adc = analog->sample_precision / 2;
+    } else if (adc < -(analog->sample_precision / 2)) {
+        adc = -(analog->sample_precision / 2);
+    }
+    return adc;
+}
+
+static void sim_encoder_sample(double position)
+{
+    double count = floor(position * SIM_ENCODER_PRECISION / (double)SIM_2PI);
+
+    sim_hw.encoder_abs_theta = (float)(count * (double)SIM_2PI / SIM_ENCODER_PRECISION);
+    sim_hw.encoder_theta = sim_wrap(sim_hw.encoder_abs_theta);
+}
+
+static void sim_pmsm_sample(void)
+{
+    float ia, ib, ic;
+
+    mcl_plant_pmsm_get_current(&sim_pmsm, &ia, &ib, &ic);
+    sim_hw.adc[analog_a_current] = sim_adc_convert(analog_a_current, ia);
+    sim_hw.adc[analog_b_current] = sim_adc_convert(analog_b_current, ib);
+    sim_encoder_sample(sim_pmsm.position);
+}
+
+static void sim_stepper_sample(void)
+{
+    /* the shunts of the H bridges only see the magnitude */
+    sim_hw.adc[analog_a_current] = sim_adc_convert(analog_a_current, fabsf(sim_stepper.ia));
+    sim_hw.adc[analog_b_current] = sim_adc_convert(analog_b_current, fabsf(sim_stepper.ib));
+}
+
+static void sim_pwm_reload(void)
+{
+    memcpy(sim_hw.duty_active, sim_hw.duty, sizeof(sim_hw.duty));
+}
+
+/*
+ * motor setup, following the bldc_foc, step_motor_foc and bldc_block samples
+ */
+static void sim_motor_reset(void)
+{
+    memset(&sim_motor, 0, sizeof(sim_motor));
+    memset(&sim_hw, 0, sizeof(sim_hw));
+    memset(sim_stage_ticks, 0, sizeof(sim_stage_ticks));
+    memset(sim_stage_calls, 0, sizeof(sim_stage_calls));
+}
+
+static void sim_board_init(float sample_res, float opamp_gain)
+{
+    mcl_cfg_t *mcl = &sim_motor.cfg.mcl;
+
+    for (uint32_t i = analog_a_current; i <= analog_b_current; i++) {
+        mcl->physical.board.analog[i].adc_reference_vol = 3.3;
+        mcl->physical.board.analog[i].opamp_gain = opamp_gain;
+        mcl->physical.board.analog[i].sample_precision = 4095;
+        mcl->physical.board.analog[i].sample_res = sample_res;
+    }
+    mcl->physical.board.num_current_sample_res = 2;
+    mcl->physical.board.pwm_dead_time_tick = SIM_PWM_DEAD_AREA_TICK;
+    mcl->physical.board.pwm_frequency = SIM_PWM_FREQUENCY;
+    mcl->physical.board.pwm_reload = SIM_PWM_CLOCK_TICK / SIM_PWM_FREQUENCY - 1;
+    mcl->physical.time.adc_sample_ts = MCL_FREQUENCY_TO_PERIOD(SIM_PWM_FREQUENCY);
+    mcl->physical.time.current_loop_ts = MCL_FREQUENCY_TO_PERIOD(SIM_PWM_FREQUENCY);
+    mcl->physical.time.encoder_process_ts = MCL_FREQUENCY_TO_PERIOD(SIM_PWM_FREQUENCY);
+    mcl->physical.time.speed_loop_ts = MCL_FREQUENCY_TO_PERIOD(SIM_PWM_FREQUENCY) * SIM_SPEED_LOOP_TIMES;
+    mcl->physical.time.position_loop_ts = MCL_FREQUENCY_TO_PERIOD(SIM_PWM_FREQUENCY) * SIM_SPEED_LOOP_TIMES;
+    mcl->physical.time.mcu_clock_tick = SIM_MCU_CLOCK_TICK;
+    mcl->physical.time.pwm_clock_tick = SIM_PWM_CLOCK_TICK;
+
+    sim_motor.cfg.analog.enable_a_current = true;
+    sim_motor.cfg.analog.enable_b_current = true;
+    sim_motor.cfg.analog.callback.init = sim_analog_init;
+    sim_motor.cfg.analog.callback.update_sample_location = sim_analog_update_sample_location;
+    sim_motor.cfg.analog.callback.get_value = sim_analog_get_value;
+
+    sim_motor.cfg.drivers.callback.init = sim_pwm_init;
+    sim_motor.cfg.drivers.callback.enable_all_drivers = sim_pwm_enable_all;
+    sim_motor.cfg.drivers.callback.disable_all_drivers = sim_pwm_disable_all;
+    sim_motor.cfg.drivers.callback.update_duty_cycle = sim_pwm_duty_set;
+    sim_motor.cfg.drivers.callback.enable_drivers = sim_pwm_enable_channel;
+    sim_motor.cfg.drivers.callback.disable_drivers = sim_pwm_disable_channel;
+
+    sim_motor.cfg.control.callback.init = sim_control_init;
+}
+
+static void sim_pmsm_motor_init(void)
+{
+    mcl_cfg_t *mcl = &sim_motor.cfg.mcl;
+
+    mcl->physical.motor.i_max = 9;
+    mcl->physical.motor.inertia = sim_pmsm_cfg.inertia;
+    mcl->physical.motor.ls = SIM_PMSM_LS;
+    mcl->physical.motor.ld = SIM_PMSM_LS;
+    mcl->physical.motor.lq = SIM_PMSM_LS;
+    mcl->physical.motor.res = SIM_PMSM_RES;
+    mcl->physical.motor.flux = SIM_PMSM_FLUX;
+    mcl->physical.motor.pole_num = SIM_PMSM_POLE_NUM;
+    mcl->physical.motor.power = 50;
+    mcl->physical.motor.rpm_max = 4000;
+    mcl->physical.motor.vbus = SIM_PMSM_VBUS;
+    mcl->physical.motor.hall = phase_120;
+
+    sim_motor.cfg.encoder.communication_interval_us = 0;
+    sim_motor.cfg.encoder.disable_start_sample_interrupt = true;
+    sim_motor.cfg.encoder.period_call_time_s = MCL_FREQUENCY_TO_PERIOD(SIM_PWM_FREQUENCY);
+    sim_motor.cfg.encoder.precision = SIM_ENCODER_PRECISION;
+    sim_motor.cfg.encoder.speed_abs_switch_m_t = 5;
+    sim_motor.cfg.encoder.speed_cal_method = encoder_method_m;
+    sim_motor.cfg.encoder.timeout_s = 0.5;
+    sim_motor.cfg.encoder.callback.start_sample = sim_encoder_start_sample;
+    sim_motor.cfg.encoder.callback.get_theta = sim_encoder_get_theta;
+    sim_motor.cfg.encoder.callback.get_absolute_theta = sim_encoder_get_abs_theta;
+    sim_motor.cfg.encoder.callback.get_uvw_level = sim_encoder_get_uvw_level;
+
+    /* low pass, fpass 100 fstop 2000 */
+    sim_motor.cfg.encoder_iir.section = 2;
+    sim_motor.cfg.encoder_iir.matrix = sim_motor.cfg.encoder_iir_mat;
+    sim_motor.cfg.encoder_iir_mat[0].a1 = -1.947404031871316831825424742419272661209f;
+    sim_motor.cfg.encoder_iir_mat[0].a2 = 0.95152023575172306468772376319975592196f;
+    sim_motor.cfg.encoder_iir_mat[0].b0 = 1;
+    sim_motor.cfg.encoder_iir_mat[0].b1 = 2;
+    sim_motor.cfg.encoder_iir_mat[0].b2 = 1;
+    sim_motor.cfg.encoder_iir_mat[0].scale = 0.001029050970101526990552187612593115773f;
+    sim_motor.cfg.encoder_iir_mat[1].a1 = -1.88285893096534651114382086234400048852f;
+    sim_motor.cfg.encoder_iir_mat[1].a2 = 0.886838706662149367510039610351668670774f;
+    sim_motor.cfg.encoder_iir_mat[1].b0 = 1;
+    sim_motor.cfg.encoder_iir_mat[1].b1 = 2;
+    sim_motor.cfg.encoder_iir_mat[1].b2 = 1;
+    sim_motor.cfg.encoder_iir_mat[1].scale = 0.000994943924200649039424337871651005116f;
+}
+
+static void sim_pid_init(mcl_control_pid_t *pid, float kp, float ki, float integral_limit, float output_limit)
+{
+    pid->cfg.kp = kp;
+    pid->cfg.ki = ki;
+    pid->cfg.integral_max = integral_limit;
+    pid->cfg.integral_min = -integral_limit;
+    pid->cfg.output_max = output_limit;
+    pid->cfg.output_min = -output_limit;
+}
+
+static hpm_mcl_stat_t sim_foc_init(bool speed_loop, bool position_loop)
+{
+    float wc = SIM_CURRENT_LOOP_BANDWIDTH * SIM_2PI;
+
+    sim_motor_reset();
+    mcl_plant_pmsm_init(&sim_pmsm, &sim_pmsm_cfg, 0);
+    sim_pmsm_sample();
+    sim_board_init(0.01f, 10);
+    sim_pmsm_motor_init();
+
+    /* the current loop as a first order system of the chosen bandwidth */
+    sim_pid_init(&sim_motor.cfg.control.currentd_pid_cfg, SIM_PMSM_LS * wc, SIM_PMSM_RES * wc * SIM_TS, 14, 14);
+    sim_pid_init(&sim_motor.cfg.control.currentq_pid_cfg, SIM_PMSM_LS * wc, SIM_PMSM_RES * wc * SIM_TS, 14, 14);
+    sim_pid_init(&sim_motor.cfg.control.speed_pid_cfg, 0.06f, 0.0005f, 5, 5);
+    sim_pid_init(&sim_motor.cfg.control.position_pid_cfg, 40.0f, 0, 10, 300);
+    sim_motor.cfg.control.dead_area_compensation_cfg.cfg.lowpass_k = 0.1;
+
+    sim_motor.cfg.loop.mode = mcl_mode_foc;
+    sim_motor.cfg.loop.enable_speed_loop = speed_loop;
+    sim_motor.cfg.loop.enable_position_loop = position_loop;
+
+    SIM_RETURN_IF_FAIL(hpm_mcl_analog_init(&sim_motor.analog, &sim_motor.cfg.analog, &sim_motor.cfg.mcl));
+    SIM_RETURN_IF_FAIL(hpm_mcl_filter_iir_df1_init(&sim_motor.encoder_iir, &sim_motor.cfg.encoder_iir, &sim_motor.encoder_iir_mem[0]));
+    SIM_RETURN_IF_FAIL(hpm_mcl_encoder_init(&sim_motor.encoder, &sim_motor.cfg.mcl, &sim_motor.cfg.encoder, &sim_motor.encoder_iir));
+    SIM_RETURN_IF_FAIL(hpm_mcl_drivers_init(&sim_motor.drivers, &sim_motor.cfg.drivers));
+    SIM_RETURN_IF_FAIL(hpm_mcl_control_init(&sim_motor.control, &sim_motor.cfg.control));
+    sim_probe_install(&sim_motor.control);
+    SIM_RETURN_IF_FAIL(hpm_mcl_loop_init(&sim_motor.loop, &sim_motor.cfg.loop, &sim_motor.cfg.mcl,
+                    &sim_motor.encoder, &sim_motor.analog, &sim_motor.control, &sim_motor.drivers, NULL));
+    hpm_mcl_enable_dq_axis_decoupling(&sim_motor.loop);
+#if defined(SIM_FOC_DEAD_AREA_COMPENSATION) && SIM_FOC_DEAD_AREA_COMPENSATION
+    hpm_mcl_enable_dead_area_compensation(&sim_motor.loop);
+#else
+    hpm_mcl_disable_dead_area_compensation(&sim_motor.loop);
+#endif
+    hpm_mcl_loop_enable(&sim_motor.loop);
+    return mcl_success;
+}
+
+/* one PWM period: sample at the reload, run the interrupt, the new duty is loaded at the next reload */
+static void sim_foc_period(sim_cost_t *cost)
+{
+    uint64_t start;
+
+    sim_pmsm_sample();
+    start = mcl_sim_get_ticks();
+    sim_encoder_process(SIM_MCU_CLOCK_TICK / SIM_PWM_FREQUENCY);
+    hpm_mcl_loop(&sim_motor.loop);
+    sim_cost_add(cost, start);
+    mcl_plant_pmsm_step_inverter(&sim_pmsm, sim_hw.duty_active[mcl_drivers_chn_a],
+                                 sim_hw.duty_active[mcl_drivers_chn_b], sim_hw.duty_active[mcl_drivers_chn_c], SIM_TS);
+    sim_pwm_reload();
+}
+
+static void sim_set_value(hpm_mcl_stat_t (*set)(mcl_loop_t *loop, mcl_user_value_t value), float value)
+{
+    mcl_user_value_t user;
+
+    user.enable = true;
+    user.value = value;
+    set(&sim_motor.loop, user);
+}
+
+/*
+ * scenario: current loop alone, steps of iq with the rotor free to accelerate
+ */
+static uint32_t sim_scenario_foc_current(sim_cost_t *cost, bool report)
+{
+    const uint32_t periods = SIM_PERIODS_MS(100);
+    const uint32_t settle = SIM_PERIODS_MS(2);
+    sim_err_t err_d = {0}, err_q = {0};
+    float ref_q = 0;
+    uint32_t step_at = 0;
+    uint32_t failed = 0;
+
+    if (sim_foc_init(false, false) != mcl_success) {
+        printf("  init FAILED\n");
+        return 1;
+    }
+    sim_set_value(hpm_mcl_loop_set_current_d, 0);
+    for (uint32_t k = 0; k < periods; k++) {
+        float next_q = (k < periods / 4) ? 0 : ((k < periods / 2) ? 2.0f : ((k < 3 * periods / 4) ? -2.0f : 0.5f));
+
+        if (next_q != ref_q) {
+            ref_q = next_q;
+            step_at = k;
+            sim_set_value(hpm_mcl_loop_set_current_q, ref_q);
+        }
+        sim_foc_period(cost);
+        if ((k - step_at) >= settle) {
+            sim_err_add(&err_d, sim_pmsm.id);
+            sim_err_add(&err_q, ref_q - sim_pmsm.iq);
+        }
+    }
+    if (report) {
+        failed += sim_err_check("id error", "A", &err_d, 0.1f, 0.4f);
+        failed += sim_err_check("iq error", "A", &err_q, 0.1f, 0.4f);
+    }
+    return failed;
+}
+
+/*
+ * scenario: speed loop with speed steps and a load step
+ */
+static uint32_t sim_scenario_foc_speed(sim_cost_t *cost, bool report)
+{
+    const uint32_t periods = SIM_PERIODS_MS(1200);
+    sim_err_t err[3] = {0};
+    uint32_t failed = 0;
+    float ref = 150.0f;
+
+    if (sim_foc_init(true, false) != mcl_success) {
+        printf("  init FAILED\n");
+        return 1;
+    }
+    sim_set_value(hpm_mcl_loop_set_current_d, 0);
+    sim_set_value(hpm_mcl_loop_set_speed, ref);
+    for (uint32_t k = 0; k < periods; k++) {
+        if (k == SIM_PERIODS_MS(400)) {
+            sim_pmsm.load_torque = 0.05f;
+        } else if (k == SIM_PERIODS_MS(800)) {
+            ref = -100.0f;
+            sim_set_value(hpm_mcl_loop_set_speed, ref);
+        }
+        sim_foc_period(cost);
+        if ((k >= SIM_PERIODS_MS(250)) && (k < SIM_PERIODS_MS(400))) {
+            sim_err_add(&err[0], ref - sim_pmsm.speed);
+        } else if ((k >= SIM_PERIODS_MS(600)) && (k < SIM_PERIODS_MS(800))) {
+            sim_err_add(&err[1], ref - sim_pmsm.speed);
+        } else if (k >= SIM_PERIODS_MS(1050)) {
+            sim_err_add(&err[2], ref - sim_pmsm.speed);
+        }
+    }
+    if (report) {
+        failed += sim_err_check("speed error 150", "rad/s", &err[0], 0.2f, 1.0f);
+        failed += sim_err_check("speed error loaded", "rad/s", &err[1], 0.2f, 1.0f);
+        failed += sim_err_check("speed error -100", "rad/s", &err[2], 0.2f, 1.0f);
+    }
+    return failed;
+}
+
+/*
+ * scenario: position loop over the speed loop, two turns and back
+ */
+static uint32_t sim_scenario_foc_position(sim_cost_t *cost, bool report)
+{
+    const uint32_t periods = SIM_PERIODS_MS(1000);
+    sim_err_t err[2] = {0};
+    uint32_t failed = 0;
+    float ref = 2.0f * SIM_2PI;
+
+    if (sim_foc_init(true, true) != mcl_success) {
+        printf("  init FAILED\n");
+        return 1;
+    }
+    sim_set_value(hpm_mcl_loop_set_current_d, 0);
+    sim_set_value(hpm_mcl_loop_set_position, ref);
+    for (uint32_t k = 0; k < periods; k++) {
+        if (k == SIM_PERIODS_MS(500)) {
+            ref = 0;
+            sim_set_value(hpm_mcl_loop_set_position, ref);
+        }
+        sim_foc_period(cost);
+        if ((k >= SIM_PERIODS_MS(350)) && (k < SIM_PERIODS_MS(500))) {
+            sim_err_add(&err[0], ref - (float)sim_pmsm.position);
+        } else if (k >= SIM_PERIODS_MS(850)) {
+            sim_err_add(&err[1], ref - (float)sim_pmsm.position);
+        }
+    }
+    if (report) {
+        failed += sim_err_check("position error 4pi", "rad", &err[0], 0.02f, 0.04f);
+        failed += sim_err_check("position error 0", "rad", &err[1], 0.02f, 0.04f);
+    }
+    return failed;
+}
+
+/*
+ * scenario: stepper in step foc mode following the path plan, forwards and backwards
+ */
+static hpm_mcl_stat_t sim_step_init(void)
+{
+    mcl_cfg_t *mcl = &sim_motor.cfg.mcl;
+
+    sim_motor_reset();
+    /* the rotor rests where the current vector at path angle 0 holds it */
+    mcl_plant_stepper_init(&sim_stepper, &sim_stepper_cfg, -0.25 * SIM_PI / SIM_STEP_POLE_NUM);
+    sim_board_init(2.4f, 1);
+    mcl->physical.board.pwm_dead_time_tick = 0;
+    mcl->physical.motor.i_max = 5;
+    mcl->physical.motor.inertia = sim_stepper_cfg.inertia;
+    mcl->physical.motor.ls = sim_stepper_cfg.ls;
+    mcl->physical.motor.res = sim_stepper_cfg.rs;
+    mcl->physical.motor.pole_num = SIM_STEP_POLE_NUM;
+    mcl->physical.motor.power = 20;
+    mcl->physical.motor.rpm_max = 600;
+    mcl->physical.motor.vbus = sim_stepper_cfg.vbus;
+
+    sim_pid_init(&sim_motor.cfg.control.currentd_pid_cfg, 2.4f, 0.1f, 100, 15);
+    sim_pid_init(&sim_motor.cfg.control.currentq_pid_cfg, 2.4f, 0.1f, 100, 15);
+
+    sim_motor.cfg.loop.mode = mcl_mode_step_foc;
+    sim_motor.cfg.loop.enable_speed_loop = true;
+    sim_motor.cfg.path.loop_ts = SIM_TS;
+    sim_motor.cfg.path.t_cure.time = 0;
+
+    SIM_RETURN_IF_FAIL(hpm_mcl_path_init(&sim_motor.path, &sim_motor.cfg.path, &sim_motor.cfg.mcl));
+    SIM_RETURN_IF_FAIL(hpm_mcl_analog_init(&sim_motor.analog, &sim_motor.cfg.analog, &sim_motor.cfg.mcl));
+    SIM_RETURN_IF_FAIL(hpm_mcl_drivers_init(&sim_motor.drivers, &sim_motor.cfg.drivers));
+    SIM_RETURN_IF_FAIL(hpm_mcl_control_init(&sim_motor.control, &sim_motor.cfg.control));
+    sim_probe_install(&sim_motor.control);
+    SIM_RETURN_IF_FAIL(hpm_mcl_loop_init(&sim_motor.loop, &sim_motor.cfg.loop, &sim_motor.cfg.mcl,
+                    NULL, &sim_motor.analog, &sim_motor.control, &sim_motor.drivers, &sim_motor.path));
+    hpm_mcl_loop_enable(&sim_motor.loop);
+    return mcl_success;
+}
+
+static void sim_step_path(float speed, float time)
+{
+    path_plan_t_cure_cfg_t path;
+
+    path.speed = speed;
+    path.acc_time = 0.05f;
+    path.dec_time = 0.05f;
+    path.acc = path.speed / path.acc_time;
+    path.dec = path.speed / path.dec_time;
+    path.time = time;
+    hpm_mcl_path_update_t_cure(&sim_motor.path, &path);
+}
+
+static uint32_t sim_scenario_step_foc(sim_cost_t *cost, bool report)
+{
+    const uint32_t periods = SIM_PERIODS_MS(1100);
+    const float id = 0.65f;
+    sim_err_t err_i = {0}, err_pos = {0};
+    double ref_position = 0;
+    float theta_last = 0;
+    uint32_t failed = 0;
+
+    if (sim_step_init() != mcl_success) {
+        printf("  init FAILED\n");
+        return 1;
+    }
+    sim_set_value(hpm_mcl_loop_set_current_d, id);
+    sim_step_path(SIM_2PI * 1, 0.5f);
+    sim_step_path(-SIM_2PI * 2, 0.5f);
+    for (uint32_t k = 0; k < periods; k++) {
+        uint64_t start;
+        float theta, d;
+
+        sim_stepper_sample();
+        start = mcl_sim_get_ticks();
+        sim_path_generate();
+        hpm_mcl_loop(&sim_motor.loop);
+        sim_cost_add(cost, start);
+        mcl_plant_stepper_step(&sim_stepper, sim_hw.duty_active[mcl_drivers_chn_a0], sim_hw.duty_active[mcl_drivers_chn_a1],
+                               sim_hw.duty_active[mcl_drivers_chn_b0], sim_hw.duty_active[mcl_drivers_chn_b1], SIM_TS);
+        sim_pwm_reload();
+
+        /* the current vector sits pi/4 behind the path angle, the rotor follows it */
+        theta = hpm_mcl_path_get_current_theta(&sim_motor.path);
+        ref_position += (double)(sim_wrap_pm_pi(theta - theta_last) / SIM_STEP_POLE_NUM);
+        theta_last = theta;
+        theta = sim_wrap(theta - 0.25f * SIM_PI);
+        d = sim_stepper.ia * cosf(theta) + sim_stepper.ib * sinf(theta);
+        if (k >= SIM_PERIODS_MS(5)) {
+            sim_err_add(&err_i, id - d);
+        }
+        sim_err_add(&err_pos, (float)(sim_stepper.position - (ref_position - 0.25 * SIM_PI / SIM_STEP_POLE_NUM)) * (360.0f / SIM_2PI));
+    }
+    if (report) {
+        failed += sim_err_check("current error", "A", &err_i, 0.01f, 0.1f);
+        failed += sim_err_check("following error", "deg", &err_pos, 0.1f, 0.5f);
+    }
+    return failed;
+}
+
+/*
+ * scenario: six-step drive from the hall sensors with the speed loop on a 1 ms timer
+ */
+static hpm_mcl_stat_t sim_block_init(void)
+{
+    sim_motor_reset();
+    mcl_plant_pmsm_init(&sim_pmsm, &sim_pmsm_cfg, 0);
+    sim_hw.hall = mcl_plant_pmsm_get_hall(&sim_pmsm);
+    sim_board_init(0.01f, 10);
+    sim_pmsm_motor_init();
+    sim_motor.cfg.mcl.physical.board.pwm_dead_time_tick = 0;
+    sim_motor.cfg.mcl.physical.time.encoder_process_ts = MCL_FREQUENCY_TO_PERIOD(SIM_BLOCK_ISR_FREQUENCY);
+    sim_motor.cfg.mcl.physical.time.speed_loop_ts = MCL_FREQUENCY_TO_PERIOD(SIM_BLOCK_ISR_FREQUENCY) * 2;
+    sim_motor.cfg.encoder.period_call_time_s = MCL_FREQUENCY_TO_PERIOD(SIM_BLOCK_ISR_FREQUENCY);
+    sim_motor.cfg.encoder.precision = 6;
+    sim_motor.cfg.encoder.callback.get_theta = sim_hall_get_theta;
+    sim_motor.cfg.encoder.callback.get_absolute_theta = sim_hall_get_theta;
+
+    sim_pid_init(&sim_motor.cfg.control.speed_pid_cfg, 0.002f, 0.00002f, 0.95f, 1);
+
+    sim_motor.cfg.loop.mode = mcl_mode_block;
+    sim_motor.cfg.loop.enable_speed_loop = true;
+
+    SIM_RETURN_IF_FAIL(hpm_mcl_filter_iir_df1_init(&sim_motor.encoder_iir, &sim_motor.cfg.encoder_iir, &sim_motor.encoder_iir_mem[0]));
+    SIM_RETURN_IF_FAIL(hpm_mcl_encoder_init(&sim_motor.encoder, &sim_motor.cfg.mcl, &sim_motor.cfg.encoder, &sim_motor.encoder_iir));
+    SIM_RETURN_IF_FAIL(hpm_mcl_drivers_init(&sim_motor.drivers, &sim_motor.cfg.drivers));
+    SIM_RETURN_IF_FAIL(hpm_mcl_control_init(&sim_motor.control, &sim_motor.cfg.control));
+    sim_probe_install(&sim_motor.control);
+    SIM_RETURN_IF_FAIL(hpm_mcl_loop_init(&sim_motor.loop, &sim_motor.cfg.loop, &sim_motor.cfg.mcl,
+                    &sim_motor.encoder, &sim_motor.analog, &sim_motor.control, &sim_motor.drivers, NULL));
+    hpm_mcl_loop_start_block(&sim_motor.loop);
+    hpm_mcl_loop_enable(&sim_motor.loop);
+    return mcl_success;
+}
+
+/* the phase whose high and low side are switched on, -1 if none */
+static void sim_block_get_pair(int32_t *high, int32_t *low)
+{
+    *high = -1;
+    *low = -1;
+    for (int32_t k = 0; k < 3; k++) {
+        if (sim_hw.switch_on & (1U << (2 * k))) {
+            *high = k;
+        }
+        if (sim_hw.switch_on & (1U << (2 * k + 1))) {
+            *low = k;
+        }
+    }
+}
+
+/* hall sector of the table of hpm_mcl_control_get_block_sector, 0 for an invalid pattern */
+static int32_t sim_hall_sector(uint8_t hall)
+{
+    const uint8_t hall_tbl_120[8] = {0, 4, 2, 3, 6, 5, 1, 0};
+
+    return hall_tbl_120[hall & 0x07];
+}
+
+static uint32_t sim_scenario_block(sim_cost_t *cost, bool report)
+{
+    const uint32_t periods = SIM_PERIODS_MS(3000);
+    const float ref = 150.0f;
+    sim_err_t err = {0};
+    uint32_t failed = 0;
+
+    if (sim_block_init() != mcl_success) {
+        printf("  init FAILED\n");
+        return 1;
+    }
+    sim_set_value(hpm_mcl_loop_set_speed, ref);
+    for (uint32_t k = 0; k < periods; k++) {
+        int32_t high, low;
+        uint8_t hall;
+
+        if ((k % SIM_BLOCK_TIMER_TIMES) == 0) {
+            uint64_t start = mcl_sim_get_ticks();
+
+            sim_encoder_process(SIM_MCU_CLOCK_TICK / SIM_BLOCK_ISR_FREQUENCY);
+            hpm_mcl_loop(&sim_motor.loop);
+            sim_cost_add(cost, start);
+        }
+        sim_block_get_pair(&high, &low);
+        mcl_plant_pmsm_step_six_step(&sim_pmsm, high, low, sim_hw.duty_active[mcl_drivers_chn_a], SIM_TS);
+        sim_pwm_reload();
+        hall = mcl_plant_pmsm_get_hall(&sim_pmsm);
+        if (hall != sim_hw.hall) {
+            /* hall interrupt: step the angle by one sector and commutate, the sector counts down forwards */
+            int32_t delta = (sim_hall_sector(sim_hw.hall) - sim_hall_sector(hall) + 6) % 6;
+
+            sim_hw.hall = hall;
+            sim_hw.hall_theta = sim_wrap(sim_hw.hall_theta + ((delta == 1) ? 1.0f : -1.0f) * (SIM_PI / 3.0f) / SIM_PMSM_POLE_NUM);
+            hpm_mcl_loop_refresh_block(&sim_motor.loop);
+        }
+        if (k >= SIM_PERIODS_MS(2000)) {
+            sim_err_add(&err, ref - sim_pmsm.speed);
+        }
+    }
+    if (report) {
+        failed += sim_err_check("speed error 150", "rad/s", &err, 1.0f, 2.0f);
+    }
+    return failed;
+}
+
+static const sim_scenario_t sim_scenario[] = {
+    {"foc current loop", sim_scenario_foc_current, SIM_PWM_FREQUENCY},
+    {"foc speed loop", sim_scenario_foc_speed, SIM_PWM_FREQUENCY},
+    {"foc position loop", sim_scenario_foc_position, SIM_PWM_FREQUENCY},
+    {"step foc", sim_scenario_step_foc, SIM_PWM_FREQUENCY},
+    {"block speed loop", sim_scenario_block, SIM_BLOCK_ISR_FREQUENCY},
+};
+
+static void sim_calibrate_overhead(void)
+{
+    uint64_t min = UINT64_MAX;
+
+    sim_tick_overhead = 0;
+    for (uint32_t i = 0; i < 1000; i++) {
+        uint64_t start = mcl_sim_get_ticks();
+        uint64_t ticks = mcl_sim_get_ticks() - start;
+
+        if (ticks < min) {
+            min = ticks;
+        }
+    }
+    sim_tick_overhead = min;
+}
+
+/*
+ * the probes add their own cost to the instrumented run, the shares are taken against the
+ * mean of the run without them
+ */
+static void sim_report_stages(const sim_cost_t *cost, double isr_mean)
+{
+    double sum = 0;
+    const char *unit = mcl_sim_tick_unit();
+
+    printf("  %-14s %12s %10s %12s %7s\n", "stage", "per call", "calls/isr", "per isr", "share");
+    for (uint32_t s = 0; s < sim_stage_num; s++) {
+        double per_isr;
+
+        if (sim_stage_calls[s] == 0) {
+            continue;
+        }
+        per_isr = (double)sim_stage_ticks[s] / cost->calls;
+        sum += per_isr;
+        printf("  %-14s %8.1f %-3s %10.2f %8.1f %-3s %6.1f%%\n", sim_stage_name[s],
+                (double)sim_stage_ticks[s] / sim_stage_calls[s], unit, (double)sim_stage_calls[s] / cost->calls,
+                per_isr, unit, 100.0 * per_isr / isr_mean);
+    }
+    /* the rest of the loop: current conversion, decoupling, limits and the driver calls */
+    printf("  %-14s %12s %10s %8.1f %-3s %6.1f%%\n", "other", "", "",
+            (isr_mean > sum) ? (isr_mean - sum) : 0, unit, (isr_mean > sum) ? (100.0 * (isr_mean - sum) / isr_mean) : 0);
+}
+
+uint32_t mcl_sim_run(uint64_t isr_tick_limit)
+{
+    uint32_t failed = 0;
+    const char *unit = mcl_sim_tick_unit();
+
+    sim_calibrate_overhead();
+    for (uint32_t i = 0; i < sizeof(sim_scenario) / sizeof(sim_scenario[0]); i++) {
+        const sim_scenario_t *scenario = &sim_scenario[i];
+        double budget = (double)mcl_sim_ticks_per_second() / scenario->isr_frequency;
+        sim_cost_t cost = {0};
+        double mean;
+
+        printf("%s:\n", scenario->name);
+        sim_probe_enable = false;
+        failed += scenario->run(&cost, true);
+        if (cost.calls == 0) {
+            continue;
+        }
+        mean = (double)cost.ticks / cost.calls;
+        printf("  isr %u Hz: mean %.1f %s, max %llu %s, budget %.0f %s, headroom %.1f%%, max loop rate %.1f kHz\n",
+                (unsigned int)scenario->isr_frequency, mean, unit, (unsigned long long)cost.max, unit, budget, unit,
+                100.0 * (1.0 - mean / budget), (double)mcl_sim_ticks_per_second() / mean / 1000.0);
+        if ((isr_tick_limit != 0) && (mean > (double)isr_tick_limit)) {
+            printf("  isr mean above the limit of %llu %s FAILED\n", (unsigned long long)isr_tick_limit, unit);
+            failed++;
+        }
+
+        sim_probe_enable = true;
+        memset(&cost, 0, sizeof(cost));
+        scenario->run(&cost, false);
+        sim_report_stages(&cost, mean);
+        sim_probe_enable = false;
+        printf("\n");
+    }
+    return failed;
+}
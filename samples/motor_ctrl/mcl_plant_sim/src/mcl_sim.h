@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef MCL_SIM_H
+#define MCL_SIM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Provided by the platform: a free running counter for timing the loop, the name of its
+ * unit, e.g. "cycles" on the board or "ns" on the host, and its rate in ticks per second.
+ */
+uint64_t mcl_sim_get_ticks(void);
+const char *mcl_sim_tick_unit(void);
+uint64_t mcl_sim_ticks_per_second(void);
+
+/*
+ * Runs every scenario of the harness against the plant models: the hpm_mcl_v2 loop in
+ * foc, step foc and block mode. For each scenario the tracking error is checked against
+ * its limits, then the cost of the interrupt and of every stage of the loop is printed.
+ *
+ * isr_tick_limit: max mean ISR cost in ticks, a scenario above it fails, 0 to skip.
+ * Returns the number of failed checks.
+ */
+uint32_t mcl_sim_run(uint64_t isr_tick_limit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MCL_SIM_H */
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "mcl_trig_bench.h"
+
+uint64_t mcl_trig_bench_get_ticks(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+const char *mcl_trig_bench_tick_unit(void)
+{
+    return "ns";
+}
+
+int main(void)
+{
+    uint32_t failed;
+
+    failed = mcl_trig_bench_run_accuracy();
+    printf("\n");
+    mcl_trig_bench_run_benchmark();
+    return (failed == 0) ? 0 : 1;
+}
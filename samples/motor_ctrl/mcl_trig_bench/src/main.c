@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include "board.h"
+#include "hpm_csr_drv.h"
+#include "hpm_clock_drv.h"
+#include "mcl_trig_bench.h"
+
+uint64_t mcl_trig_bench_get_ticks(void)
+{
+    return hpm_csr_get_core_mcycle();
+}
+
+const char *mcl_trig_bench_tick_unit(void)
+{
+    return "cycles";
+}
+
+int main(void)
+{
+    uint32_t failed;
+
+    board_init();
+    printf("cpu0:\t\t %dHz\n\n", clock_get_frequency(clock_cpu0));
+
+    failed = mcl_trig_bench_run_accuracy();
+    printf("\n");
+    mcl_trig_bench_run_benchmark();
+    printf("\n%s\n", (failed == 0) ? "trig check PASSED" : "trig check FAILED");
+
+    while (1) {
+    }
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <math.h>
+#include "hpm_mcl_trig.h"
+#include "mcl_trig_bench.h"
+
+#define BENCH_PI            (3.14159265358979323846)
+/* electrical angles of the current loop stay within a few turns, the kernels are specified up to 64 * pi */
+#define BENCH_ANGLE_RANGE   (64.0 * BENCH_PI)
+#define BENCH_SWEEP_POINTS  (200000U)
+#define BENCH_INPUTS        (256U)
+#define BENCH_ROUNDS        (200U)
+
+#define BENCH_LUT_SINCOS_MAX_ERR    (2e-5)
+#define BENCH_LUT_ATAN2_MAX_ERR     (2e-5)
+#define BENCH_POLY_SINCOS_MAX_ERR   (5e-7)
+#define BENCH_POLY_ATAN2_MAX_ERR    (2e-5)
+
+typedef void (*bench_sincos_t)(float x, float *sin_x, float *cos_x);
+typedef float (*bench_atan2_t)(float y, float x);
+
+static float bench_angle[BENCH_INPUTS];
+static float bench_y[BENCH_INPUTS];
+static float bench_x[BENCH_INPUTS];
+static volatile float bench_sink;
+
+static void bench_sincos_libm(float x, float *sin_x, float *cos_x)
+{
+    *sin_x = sinf(x);
+    *cos_x = cosf(x);
+}
+
+static float bench_atan2_libm(float y, float x)
+{
+    return atan2f(y, x);
+}
+
+static double bench_sincos_error(bench_sincos_t sincos)
+{
+    double max_err = 0;
+
+    for (uint32_t i = 0; i <= BENCH_SWEEP_POINTS; i++) {
+        float x = (float)(-BENCH_ANGLE_RANGE + 2.0 * BENCH_ANGLE_RANGE * i / BENCH_SWEEP_POINTS);
+        float s, c;
+        double err;
+
+        sincos(x, &s, &c);
+        err = fabs((double)s - sin((double)x));
+        if (err > max_err) {
+            max_err = err;
+        }
+        err = fabs((double)c - cos((double)x));
+        if (err > max_err) {
+            max_err = err;
+        }
+    }
+    return max_err;
+}
+
+static double bench_atan2_error(bench_atan2_t atan2_x)
+{
+    static const float radius[] = {1e-3f, 1.0f, 37.5f, 1e4f};
+    double max_err = 0;
+
+    for (uint32_t r = 0; r < sizeof(radius) / sizeof(radius[0]); r++) {
+        for (uint32_t i = 0; i < BENCH_SWEEP_POINTS / 4; i++) {
+            double a = -BENCH_PI + 2.0 * BENCH_PI * i / (BENCH_SWEEP_POINTS / 4);
+            float y = (float)(radius[r] * sin(a));
+            float x = (float)(radius[r] * cos(a));
+            double err = fabs((double)atan2_x(y, x) - atan2((double)y, (double)x));
+
+            /* both results are right at the branch cut */
+            if (err > BENCH_PI) {
+                err = fabs(err - 2.0 * BENCH_PI);
+            }
+            if (err > max_err) {
+                max_err = err;
+            }
+        }
+    }
+    return max_err;
+}
+
+static uint32_t bench_report_error(const char *name, double err, double limit)
+{
+    bool pass = (limit <= 0) || (err <= limit);
+
+    if (limit > 0) {
+        printf("  %-16s max error %.3e (limit %.1e) %s\n", name, err, limit, pass ? "ok" : "FAILED");
+    } else {
+        printf("  %-16s max error %.3e\n", name, err);
+    }
+    return pass ? 0 : 1;
+}
+
+uint32_t mcl_trig_bench_run_accuracy(void)
+{
+    uint32_t failed = 0;
+
+    hpm_mcl_trig_lut_init();
+    printf("accuracy against double precision, |angle| <= 64 * pi:\n");
+    failed += bench_report_error("sincos libm", bench_sincos_error(bench_sincos_libm), 0);
+    failed += bench_report_error("sincos lut", bench_sincos_error(hpm_mcl_trig_sincos_lut), BENCH_LUT_SINCOS_MAX_ERR);
+    failed += bench_report_error("sincos poly", bench_sincos_error(hpm_mcl_trig_sincos_poly), BENCH_POLY_SINCOS_MAX_ERR);
+    failed += bench_report_error("atan2 libm", bench_atan2_error(bench_atan2_libm), 0);
+    failed += bench_report_error("atan2 lut", bench_atan2_error(hpm_mcl_trig_atan2_lut), BENCH_LUT_ATAN2_MAX_ERR);
+    failed += bench_report_error("atan2 poly", bench_atan2_error(hpm_mcl_trig_atan2_poly), BENCH_POLY_ATAN2_MAX_ERR);
+    return failed;
+}
+
+static void bench_time_sincos(const char *name, bench_sincos_t sincos)
+{
+    float acc = 0;
+    uint64_t start, ticks;
+
+    start = mcl_trig_bench_get_ticks();
+    for (uint32_t r = 0; r < BENCH_ROUNDS; r++) {
+        for (uint32_t i = 0; i < BENCH_INPUTS; i++) {
+            float s, c;
+
+            sincos(bench_angle[i], &s, &c);
+            acc += s + c;
+        }
+    }
+    ticks = mcl_trig_bench_get_ticks() - start;
+    bench_sink = acc;
+    printf("  %-16s %8.1f %s/call\n", name, (double)ticks / (BENCH_ROUNDS * BENCH_INPUTS),
+            mcl_trig_bench_tick_unit());
+}
+
+static void bench_time_atan2(const char *name, bench_atan2_t atan2_x)
+{
+    float acc = 0;
+    uint64_t start, ticks;
+
+    start = mcl_trig_bench_get_ticks();
+    for (uint32_t r = 0; r < BENCH_ROUNDS; r++) {
+        for (uint32_t i = 0; i < BENCH_INPUTS; i++) {
+            acc += atan2_x(bench_y[i], bench_x[i]);
+        }
+    }
+    ticks = mcl_trig_bench_get_ticks() - start;
+    bench_sink = acc;
+    printf("  %-16s %8.1f %s/call\n", name, (double)ticks / (BENCH_ROUNDS * BENCH_INPUTS),
+            mcl_trig_bench_tick_unit());
+}
+
+void mcl_trig_bench_run_benchmark(void)
+{
+    hpm_mcl_trig_lut_init();
+    /* angles of an electrical turn and back, currents on a circle */
+    for (uint32_t i = 0; i < BENCH_INPUTS; i++) {
+        double a = 4.0 * BENCH_PI * i / BENCH_INPUTS;
+
+        bench_angle[i] = (float)a;
+        bench_y[i] = (float)(12.5 * sin(a));
+        bench_x[i] = (float)(12.5 * cos(a));
+    }
+
+    printf("sincos:\n");
+    bench_time_sincos("libm", bench_sincos_libm);
+    bench_time_sincos("lut", hpm_mcl_trig_sincos_lut);
+    bench_time_sincos("poly", hpm_mcl_trig_sincos_poly);
+    printf("atan2:\n");
+    bench_time_atan2("libm", bench_atan2_libm);
+    bench_time_atan2("lut", hpm_mcl_trig_atan2_lut);
+    bench_time_atan2("poly", hpm_mcl_trig_atan2_poly);
+}
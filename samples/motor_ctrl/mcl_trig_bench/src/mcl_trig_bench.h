@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef MCL_TRIG_BENCH_H
+#define MCL_TRIG_BENCH_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Provided by the platform: a free running counter for the benchmark and the name of
+ * its unit, e.g. "cycles" on the board or "ns" on the host.
+ */
+uint64_t mcl_trig_bench_get_ticks(void);
+const char *mcl_trig_bench_tick_unit(void);
+
+/* measures the max error of every kernel, returns the number of kernels out of spec */
+uint32_t mcl_trig_bench_run_accuracy(void);
+
+/* times every kernel and prints the results */
+void mcl_trig_bench_run_benchmark(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MCL_TRIG_BENCH_H */
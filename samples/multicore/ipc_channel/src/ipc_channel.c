@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "board.h"
+#include "hpm_clock_drv.h"
+#include "hpm_csr_drv.h"
+#include "hpm_ipc_event_mgr.h"
+#include "hpm_ipc_channel.h"
+#if (BOARD_RUNNING_CORE == HPM_CORE0)
+#include "multicore_common.h"
+#endif
+
+/*
+ * Core0 measures an IPC channel, core1 serves it: a ping is echoed as a pong, data messages are
+ * counted and acknowledged at the end of a transfer. The receive rings are drained either by the
+ * doorbells or by polling, on both cores.
+ *
+ * - latency: round trip of a ping, core0 sends the next ping once it received the pong
+ * - throughput: core0 sends TEST_BYTES of data messages, committed one by one or in batches, the
+ *   doorbells rung show how the doorbells are coalesced
+ */
+
+#define APP_CHANNEL_ID          (0U)
+#define APP_RING_SIZE           (4096U)
+
+#define APP_MSG_READY           (1U)    /* core1 -> core0, channel initialized */
+#define APP_MSG_SET_MODE        (2U)    /* core0 -> core1, uint32_t doorbell or polling */
+#define APP_MSG_MODE_SET        (3U)    /* core1 -> core0 */
+#define APP_MSG_PING            (4U)    /* core0 -> core1 */
+#define APP_MSG_PONG            (5U)    /* core1 -> core0, payload of the ping */
+#define APP_MSG_DATA            (6U)    /* core0 -> core1 */
+#define APP_MSG_DATA_END        (7U)    /* core0 -> core1 */
+#define APP_MSG_DATA_ACK        (8U)    /* core1 -> core0, uint32_t bytes received */
+
+#define TEST_PINGS              (1000U)
+#define TEST_BYTES              (1024U * 1024U)
+
+/* both cores place the channel at the start of the share memory */
+ATTR_SHARE_MEM ATTR_ALIGN(IPC_CHANNEL_LINE_SIZE) static uint8_t s_channel_shm[IPC_CHANNEL_SHM_SIZE(APP_RING_SIZE)];
+static ipc_channel_t s_channel;
+static volatile bool s_polling;
+
+/* the remote core frees the transmit ring whatever the mode of the local receive ring */
+static void app_send(uint16_t type, const void *data, uint16_t len)
+{
+    while (ipc_channel_send(&s_channel, type, data, len) == status_ipc_channel_full) {
+        ;
+    }
+}
+
+#if (BOARD_RUNNING_CORE == HPM_CORE0)
+
+static volatile uint32_t s_ready;
+static volatile uint32_t s_mode_set;
+static volatile uint32_t s_pongs;
+static volatile uint32_t s_data_acks;
+static volatile uint32_t s_bytes_acked;
+static uint8_t s_data[IPC_CHANNEL_MAX_PAYLOAD(APP_RING_SIZE)];
+
+static void app_channel_callback(ipc_channel_t *ch, const ipc_channel_msg_t *msg, void *callback_data)
+{
+    (void)ch;
+    (void)callback_data;
+    switch (msg->type) {
+    case APP_MSG_READY:
+        s_ready++;
+        break;
+    case APP_MSG_MODE_SET:
+        s_mode_set++;
+        break;
+    case APP_MSG_PONG:
+        s_pongs++;
+        break;
+    case APP_MSG_DATA_ACK:
+        s_bytes_acked = *(uint32_t *)msg->payload;
+        s_data_acks++;
+        break;
+    default:
+        break;
+    }
+}
+
+/* wait for a counter to change, polling the ring in polling mode */
+static void app_wait(volatile uint32_t *counter, uint32_t last)
+{
+    while (*counter == last) {
+        if (s_polling) {
+            (void)ipc_channel_poll(&s_channel, 0);
+        }
+    }
+}
+
+static void app_set_mode(bool polling)
+{
+    uint32_t mode = polling ? 1U : 0U;
+    uint32_t last = s_mode_set;
+
+    s_polling = polling;
+    ipc_channel_set_rx_doorbell(&s_channel, !polling);
+    app_send(APP_MSG_SET_MODE, &mode, sizeof(mode));
+    app_wait(&s_mode_set, last);
+}
+
+static uint32_t app_cycles_to_ns(uint64_t cycles)
+{
+    return (uint32_t)(cycles * 1000U / (clock_get_frequency(clock_cpu0) / 1000000U));
+}
+
+static void test_latency(uint16_t len)
+{
+    uint64_t total = 0;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+
+    for (uint32_t i = 0; i < TEST_PINGS; i++) {
+        uint32_t last = s_pongs;
+        uint64_t start = hpm_csr_get_core_mcycle();
+        uint64_t cycles;
+
+        app_send(APP_MSG_PING, s_data, len);
+        app_wait(&s_pongs, last);
+        cycles = hpm_csr_get_core_mcycle() - start;
+        total += cycles;
+        min = (cycles < min) ? cycles : min;
+        max = (cycles > max) ? cycles : max;
+    }
+    printf("  ping %4u bytes: round trip avg %6u ns, min %6u ns, max %6u ns\n", len,
+           app_cycles_to_ns(total / TEST_PINGS), app_cycles_to_ns(min), app_cycles_to_ns(max));
+}
+
+static void test_throughput(uint16_t len, uint32_t batch)
+{
+    uint32_t count = TEST_BYTES / len;
+    uint32_t last = s_data_acks;
+    ipc_channel_stats_t before;
+    ipc_channel_stats_t after;
+    uint64_t start;
+    uint64_t cycles;
+
+    ipc_channel_get_stats(&s_channel, &before);
+    start = hpm_csr_get_core_mcycle();
+    for (uint32_t i = 0; i < count; i++) {
+        void *payload;
+
+        while (ipc_channel_alloc(&s_channel, APP_MSG_DATA, len, &payload) == status_ipc_channel_full) {
+            /* publish what was allocated, the ring is full of messages not sent yet otherwise */
+            ipc_channel_commit(&s_channel);
+        }
+        memcpy(payload, s_data, len);
+        if (((i + 1U) % batch) == 0U) {
+            ipc_channel_commit(&s_channel);
+        }
+    }
+    ipc_channel_commit(&s_channel);
+    app_send(APP_MSG_DATA_END, NULL, 0);
+    app_wait(&s_data_acks, last);
+    cycles = hpm_csr_get_core_mcycle() - start;
+    ipc_channel_get_stats(&s_channel, &after);
+
+    printf("  data %4u bytes, batch %2u: %6u KB/s, %6u messages, %6u commits, %6u doorbells%s\n", len, batch,
+           (uint32_t)((uint64_t)count * len * clock_get_frequency(clock_cpu0) / 1024U / cycles),
+           after.tx_messages - before.tx_messages, after.tx_commits - before.tx_commits,
+           after.tx_doorbells - before.tx_doorbells, (s_bytes_acked == count * len) ? "" : ", ERROR");
+}
+
+static void test_run(bool polling)
+{
+    static const uint16_t ping_sizes[] = { 4, 64, 1024 };
+    static const uint16_t data_sizes[] = { 16, 64, 256, 1024 };
+    static const uint32_t batches[] = { 1, 16 };
+
+    app_set_mode(polling);
+    printf("%s:\n", polling ? "polling" : "doorbell");
+    for (uint32_t i = 0; i < ARRAY_SIZE(ping_sizes); i++) {
+        test_latency(ping_sizes[i]);
+    }
+    for (uint32_t i = 0; i < ARRAY_SIZE(data_sizes); i++) {
+        for (uint32_t j = 0; j < ARRAY_SIZE(batches); j++) {
+            test_throughput(data_sizes[i], batches[j]);
+        }
+    }
+}
+
+int main(void)
+{
+    ipc_channel_config_t config;
+
+    board_init();
+    ipc_init();
+    ipc_enable_event_interrupt(2U);
+
+    ipc_channel_get_default_config(&config);
+    config.id = APP_CHANNEL_ID;
+    config.master = true;
+    config.shm = s_channel_shm;
+    config.ring_size = APP_RING_SIZE;
+    config.callback = app_channel_callback;
+    if (ipc_channel_init(&s_channel, &config) != status_success) {
+        printf("ipc channel init failed\n");
+        while (1) {
+            ;
+        }
+    }
+    for (uint32_t i = 0; i < sizeof(s_data); i++) {
+        s_data[i] = (uint8_t)i;
+    }
+
+    multicore_release_cpu(HPM_CORE1, SEC_CORE_IMG_START);
+    app_wait(&s_ready, 0);
+
+    printf("ipc channel benchmark, ring of %u bytes\n", APP_RING_SIZE);
+    test_run(false);
+    test_run(true);
+    printf("ipc channel benchmark done\n");
+
+    while (1) {
+        ;
+    }
+    return 0;
+}
+
+#else
+
+static volatile bool s_mode_pending;
+static volatile bool s_mode_polling;
+static uint32_t s_bytes;
+
+static void app_channel_callback(ipc_channel_t *ch, const ipc_channel_msg_t *msg, void *callback_data)
+{
+    (void)ch;
+    (void)callback_data;
+    switch (msg->type) {
+    case APP_MSG_SET_MODE:
+        /* applied by the main loop, out of the poll of the ring */
+        s_mode_polling = (*(uint32_t *)msg->payload != 0U);
+        s_mode_pending = true;
+        break;
+    case APP_MSG_PING:
+        app_send(APP_MSG_PONG, msg->payload, msg->len);
+        break;
+    case APP_MSG_DATA:
+        s_bytes += msg->len;
+        break;
+    case APP_MSG_DATA_END:
+        app_send(APP_MSG_DATA_ACK, &s_bytes, sizeof(s_bytes));
+        s_bytes = 0;
+        break;
+    default:
+        break;
+    }
+}
+
+int main(void)
+{
+    ipc_channel_config_t config;
+
+    board_init_core1();
+    ipc_init();
+    ipc_enable_event_interrupt(2U);
+
+    ipc_channel_get_default_config(&config);
+    config.id = APP_CHANNEL_ID;
+    config.shm = s_channel_shm;
+    config.callback = app_channel_callback;
+    while (ipc_channel_init(&s_channel, &config) == status_ipc_channel_not_ready) {
+        ;
+    }
+    app_send(APP_MSG_READY, NULL, 0);
+
+    while (1) {
+        if (s_mode_pending) {
+            s_mode_pending = false;
+            s_polling = s_mode_polling;
+            ipc_channel_set_rx_doorbell(&s_channel, !s_polling);
+            app_send(APP_MSG_MODE_SET, NULL, 0);
+        }
+        if (s_polling) {
+            (void)ipc_channel_poll(&s_channel, 0);
+        }
+    }
+    return 0;
+}
+
+#endif
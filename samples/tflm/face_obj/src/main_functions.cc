@@ -5,16 +5,39 @@
  *
  */
 
+#include <stdio.h>
 #include "main_functions.h"
 #include "image_provider.h"
 #include "model_settings.h"
+#include "hpm_common.h"
+#include "tensorflow/lite/micro/memory_planner/tiered_memory_planner.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_error_reporter.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_time.h"
 #include "tensorflow/lite/micro/system_setup.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "face_obj_trained.h"
 
+/*
+ * Place the hottest activation and scratch buffers in the DLM and the others
+ * in the tensor arena in SDRAM. Set it to 0 to plan the whole arena in SDRAM
+ * and compare the inference cycles.
+ */
+#ifndef FACE_OBJ_TIERED_ARENA
+#define FACE_OBJ_TIERED_ARENA 1
+#endif
+
+#ifndef FACE_OBJ_FAST_ARENA_SIZE
+#define FACE_OBJ_FAST_ARENA_SIZE (128U * 1024U)
+#endif
+
+/* print the average inference cycles every FACE_OBJ_CYCLES_FRAMES frames */
+#ifndef FACE_OBJ_CYCLES_FRAMES
+#define FACE_OBJ_CYCLES_FRAMES 32U
+#endif
+
 // Globals, used for compatibility with Arduino-style sketches.
 namespace {
 tflite::ErrorReporter* error_reporter = nullptr;
@@ -32,6 +55,12 @@ TfLiteTensor* input = nullptr;
 // An area of memory to use for input, output, and intermediate arrays.
 constexpr int kTensorArenaSize = FACE_OBJ_TRAIN_SIZE;
 static uint8_t tensor_arena[kTensorArenaSize];
+#if FACE_OBJ_TIERED_ARENA
+ATTR_PLACE_AT_FAST_RAM_BSS_WITH_ALIGNMENT(16)
+static uint8_t fast_arena[FACE_OBJ_FAST_ARENA_SIZE];
+#endif
+uint32_t invoke_frames;
+uint64_t invoke_cycles;
 }  // namespace
 
 // The name of this function is important for Arduino compatibility.
@@ -73,8 +102,17 @@ void setup() {
 
   // Build an interpreter to run the model with.
   // NOLINTNEXTLINE(runtime-global-variables)
+#if FACE_OBJ_TIERED_ARENA
+  // NOLINTNEXTLINE(runtime-global-variables)
+  static tflite::TieredMemoryPlanner planner(fast_arena, sizeof(fast_arena));
+  tflite::MicroAllocator* allocator = tflite::MicroAllocator::Create(
+      tensor_arena, kTensorArenaSize, &planner, error_reporter);
+  static tflite::MicroInterpreter static_interpreter(
+      model, micro_op_resolver, allocator, error_reporter);
+#else
   static tflite::MicroInterpreter static_interpreter(
       model, micro_op_resolver, tensor_arena, kTensorArenaSize, error_reporter);
+#endif
   interpreter = &static_interpreter;
 
   // Allocate memory from the tensor_arena for the model's tensors.
@@ -84,6 +122,13 @@ void setup() {
     return;
   }
 
+#if FACE_OBJ_TIERED_ARENA
+  printf("fast arena: %u of %u bytes used\n",
+         (uint32_t)planner.GetFastMemorySize(), (uint32_t)sizeof(fast_arena));
+#endif
+  printf("tensor arena: %u of %u bytes used\n",
+         (uint32_t)interpreter->arena_used_bytes(), (uint32_t)kTensorArenaSize);
+
   // Get information about the memory area to use for the model's input.
   input = interpreter->input(0);
 }
@@ -99,9 +144,17 @@ void loop() {
   }
 
   // Run the model on this input and make sure it succeeds.
+  uint32_t start = tflite::GetCurrentTimeTicks();
   if (kTfLiteOk != interpreter->Invoke()) {
     TF_LITE_REPORT_ERROR(error_reporter, "Invoke failed.");
   }
+  invoke_cycles += (uint32_t)(tflite::GetCurrentTimeTicks() - start);
+  if (++invoke_frames == FACE_OBJ_CYCLES_FRAMES) {
+    printf("invoke: %u cycles per frame\n",
+           (uint32_t)(invoke_cycles / invoke_frames));
+    invoke_frames = 0;
+    invoke_cycles = 0;
+  }
 
   TfLiteTensor* output = interpreter->output(0);
   // // Process the inference results.
@@ -109,6 +109,7 @@ void th_results() {
   result = diffsum;
 
   th_printf("m-results-[%0.3f]\r\n", (double) result);
+  runner->LogProfile();
 }
 
 // Implement this method with the logic to perform one inference cycle.
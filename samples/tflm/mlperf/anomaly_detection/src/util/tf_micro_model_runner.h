@@ -18,7 +18,15 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/micro_profiler.h"
 
+/*
+ * Set to 1 to print the cycles taken by each op of the last inference, after its
+ * results, so that the printing is outside the timed loop of ee_infer
+ */
+#ifndef MLPERF_OP_PROFILE
+#define MLPERF_OP_PROFILE 0
+#endif
 
 namespace tflite {
 
@@ -31,8 +39,13 @@ class MicroModelRunner {
                    uint8_t* tensor_arena, int tensor_arena_size)
       : model_(tflite::GetModel(model)),
         reporter_(&micro_reporter_),
+#if MLPERF_OP_PROFILE
+        interpreter_(model_, resolver, tensor_arena, tensor_arena_size,
+                     reporter_, nullptr, &profiler_) {
+#else
         interpreter_(model_, resolver, tensor_arena, tensor_arena_size,
                      reporter_) {
+#endif
     	//interpreter_.AllocateTensors();
 		TfLiteStatus allocate_status = interpreter_.AllocateTensors();
 		if (allocate_status != kTfLiteOk) {
@@ -43,6 +56,9 @@ class MicroModelRunner {
   }
 
   void Invoke() {
+#if MLPERF_OP_PROFILE
+    profiler_.ClearEvents();
+#endif
     // Run the model on this input and make sure it succeeds.
     TfLiteStatus invoke_status = interpreter_.Invoke();
     if (invoke_status != kTfLiteOk) {
@@ -50,6 +66,12 @@ class MicroModelRunner {
     }
   }
 
+  void LogProfile() {
+#if MLPERF_OP_PROFILE
+    profiler_.Log();
+#endif
+  }
+
   void SetInput(const inputT* custom_input) {
     // Populate input tensor with an image with no person.
     TfLiteTensor* input = interpreter_.input(0);
@@ -80,6 +102,9 @@ class MicroModelRunner {
   const tflite::Model* model_;
   tflite::MicroErrorReporter micro_reporter_;
   tflite::ErrorReporter* reporter_;
+#if MLPERF_OP_PROFILE
+  tflite::MicroProfiler profiler_;
+#endif
   tflite::MicroInterpreter interpreter_;
 };
 
@@ -96,6 +96,7 @@ void th_results() {
     }
   }
   th_printf("]\r\n");
+  runner->LogProfile();
 }
 
 // Implement this method with the logic to perform one inference cycle.
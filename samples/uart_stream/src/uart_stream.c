@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025 HPMicro
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdio.h>
+#include "board.h"
+#include "hpm_clock_drv.h"
+#include "hpm_csr_drv.h"
+#include "hpm_uart_stream.h"
+
+/*
+ * Throughput and CPU load of a UART stream, the UART is in loopback mode so that no wiring is
+ * needed. TEST_BYTES are sent in frames of APP_FRAME_SIZE, with APP_TX_REQS requests queued at
+ * once, and checked by the receive callback.
+ *
+ * The CPU load is estimated from the iterations of the main loop, compared with the same loop
+ * without traffic.
+ */
+
+#define APP_UART                BOARD_APP_UART_BASE
+#define APP_UART_IRQ            BOARD_APP_UART_IRQ
+#define APP_UART_CLK_NAME       BOARD_APP_UART_CLK_NAME
+#define APP_UART_RX_DMA_REQ     BOARD_APP_UART_RX_DMA_REQ
+#define APP_UART_TX_DMA_REQ     BOARD_APP_UART_TX_DMA_REQ
+
+#define APP_RX_SIZE             (4096U)
+#define APP_FRAME_SIZE          (256U)
+#define APP_TX_REQS             (8U)
+
+#define TEST_BYTES              (256U * 1024U)
+#define TEST_TIMEOUT_MS         (2000U)
+#define TEST_CALIBRATION_MS     (100U)
+
+static uart_stream_t s_stream;
+ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) static uint8_t s_rx_buf[APP_RX_SIZE];
+static uint8_t s_tx_buf[APP_TX_REQS][APP_FRAME_SIZE];
+static uart_stream_tx_req_t s_tx_req[APP_TX_REQS];
+static volatile uint32_t s_rx_bytes;
+static volatile uint32_t s_rx_errors;
+
+SDK_DECLARE_EXT_ISR_M(APP_UART_IRQ, app_uart_isr)
+void app_uart_isr(void)
+{
+    hpm_uart_stream_uart_isr(&s_stream);
+}
+
+static inline uint8_t app_pattern(uint32_t index)
+{
+    return (uint8_t)(index % 251U);
+}
+
+/* the data is checked in place, in the receive buffer */
+static uint32_t app_rx_callback(uart_stream_t *stream, const uint8_t *data, uint32_t size, void *cb_data_ptr)
+{
+    uint32_t index = s_rx_bytes;
+
+    (void)stream;
+    (void)cb_data_ptr;
+    for (uint32_t i = 0; i < size; i++) {
+        if (data[i] != app_pattern(index + i)) {
+            s_rx_errors++;
+        }
+    }
+    s_rx_bytes = index + size;
+    return size;
+}
+
+static uint64_t app_ms_to_cycles(uint32_t ms)
+{
+    return (uint64_t)clock_get_frequency(clock_cpu0) / 1000U * ms;
+}
+
+/* iterations of an empty main loop per million cycles */
+static uint32_t app_calibrate(void)
+{
+    uint64_t duration = app_ms_to_cycles(TEST_CALIBRATION_MS);
+    uint64_t start = hpm_csr_get_core_mcycle();
+    uint32_t loops = 0;
+
+    while ((hpm_csr_get_core_mcycle() - start) < duration) {
+        /* the checks of a test loop when no request is done */
+        for (uint32_t i = 0; i < APP_TX_REQS; i++) {
+            (void)hpm_uart_stream_tx_is_done(&s_tx_req[i]);
+        }
+        loops++;
+    }
+    return (uint32_t)((uint64_t)loops * 1000000U / duration);
+}
+
+static void test_run(uint32_t baudrate, uint32_t idle_loops)
+{
+    uart_stream_config_t config;
+    uart_stream_stats_t stats;
+    uint64_t timeout = app_ms_to_cycles(TEST_TIMEOUT_MS);
+    uint64_t start;
+    uint64_t cycles;
+    uint32_t sent = 0;
+    uint32_t loops = 0;
+    uint32_t load;
+    uint32_t last = 0;
+    uint64_t last_progress;
+
+    hpm_uart_stream_get_default_config(&config);
+    config.uart = APP_UART;
+    config.src_freq_in_hz = clock_get_frequency(APP_UART_CLK_NAME);
+    config.baudrate = baudrate;
+    config.rx_dma_req = APP_UART_RX_DMA_REQ;
+    config.tx_dma_req = APP_UART_TX_DMA_REQ;
+    config.running_core = BOARD_RUNNING_CORE;
+    config.rx_buf = s_rx_buf;
+    config.rx_size = sizeof(s_rx_buf);
+    config.rx_callback = app_rx_callback;
+    if (hpm_uart_stream_init(&s_stream, &config) != status_success) {
+        printf("  %7u baud: not supported\n", baudrate);
+        return;
+    }
+    uart_modem_enable_loopback(APP_UART);
+    intc_m_enable_irq_with_priority(APP_UART_IRQ, 1);
+
+    s_rx_bytes = 0;
+    s_rx_errors = 0;
+    for (uint32_t i = 0; i < APP_TX_REQS; i++) {
+        s_tx_req[i].done = true;
+    }
+
+    start = hpm_csr_get_core_mcycle();
+    last_progress = start;
+    while (s_rx_bytes < TEST_BYTES) {
+        for (uint32_t i = 0; (i < APP_TX_REQS) && (sent < TEST_BYTES); i++) {
+            if (!hpm_uart_stream_tx_is_done(&s_tx_req[i])) {
+                continue;
+            }
+            for (uint32_t j = 0; j < APP_FRAME_SIZE; j++) {
+                s_tx_buf[i][j] = app_pattern(sent + j);
+            }
+            (void)hpm_uart_stream_send(&s_stream, &s_tx_req[i], s_tx_buf[i], APP_FRAME_SIZE);
+            sent += APP_FRAME_SIZE;
+        }
+#if !defined(HPM_IP_FEATURE_UART_RX_IDLE_DETECT) || (HPM_IP_FEATURE_UART_RX_IDLE_DETECT == 0)
+        hpm_uart_stream_rx_poll(&s_stream);
+#endif
+        loops++;
+        if (s_rx_bytes != last) {
+            last = s_rx_bytes;
+            last_progress = hpm_csr_get_core_mcycle();
+        } else if ((hpm_csr_get_core_mcycle() - last_progress) > timeout) {
+            break;
+        }
+    }
+    cycles = hpm_csr_get_core_mcycle() - start;
+    hpm_uart_stream_get_stats(&s_stream, &stats);
+    while ((s_rx_bytes >= TEST_BYTES) && hpm_uart_stream_tx_is_busy(&s_stream)) {
+        ;
+    }
+    intc_m_disable_irq(APP_UART_IRQ);
+    hpm_uart_stream_deinit(&s_stream);
+
+    /* the main loop ran less often than without traffic for the time spent in the interrupts */
+    loops = (uint32_t)((uint64_t)loops * 1000000U / cycles);
+    load = (loops < idle_loops) ? (100U - loops * 100U / idle_loops) : 0U;
+    printf("  %7u baud: %4u KB/s, cpu load %3u%%, %u chains, %u idle, %u lost, %u errors%s\n", baudrate,
+           (uint32_t)((uint64_t)s_rx_bytes * clock_get_frequency(clock_cpu0) / 1024U / cycles), load,
+           stats.tx_chains, stats.rx_idle, stats.rx_lost, s_rx_errors,
+           (s_rx_bytes >= TEST_BYTES) ? "" : ", TIMEOUT");
+}
+
+int main(void)
+{
+    static const uint32_t baudrates[] = { 921600U, 1000000U, 2000000U, 3000000U, 6000000U };
+    uint32_t idle_loops;
+
+    board_init();
+    board_init_uart(APP_UART);
+    dma_mgr_init();
+
+    for (uint32_t i = 0; i < APP_TX_REQS; i++) {
+        s_tx_req[i].done = true;
+    }
+    idle_loops = app_calibrate();
+
+    printf("uart stream benchmark, %u bytes in frames of %u bytes, %u requests queued\n", TEST_BYTES,
+           APP_FRAME_SIZE, APP_TX_REQS);
+    for (uint32_t i = 0; i < ARRAY_SIZE(baudrates); i++) {
+        test_run(baudrates[i], idle_loops);
+    }
+    printf("uart stream benchmark done\n");
+
+    while (1) {
+        ;
+    }
+    return 0;
+}
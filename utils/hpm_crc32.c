@@ -1,26 +1,208 @@
 /*
- * Copyright (c) 2023 HPMicro
+ * Copyright (c) 2023-2024 HPMicro
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
+#include <stdbool.h>
 #include "hpm_crc32.h"
+#if HPM_CRC32_HW_ENABLED
+#include "hpm_soc.h"
+#include "hpm_crc_drv.h"
+#endif
 
+#define HPM_CRC32_POLY_REFLECTED (0xEDB88320UL)
 
-uint32_t crc32(const uint8_t *buf, uint32_t len)
+#if HPM_CRC32_SLICING_WIDTH == 8
+#define HPM_CRC32_TABLE_ROWS (8U)
+#else
+#define HPM_CRC32_TABLE_ROWS (4U)
+#endif
+
+/* tables live in RAM and are generated on first use, XIP flash lookups would be slower */
+static uint32_t s_crc32_table[HPM_CRC32_TABLE_ROWS][256];
+static volatile bool s_crc32_table_ready;
+
+static void crc32_table_generate(void)
+{
+    uint32_t crc;
+
+    for (uint32_t n = 0; n < 256; n++) {
+        crc = n;
+        for (uint8_t i = 0; i < 8; i++) {
+            crc = (crc & 1) ? ((crc >> 1) ^ HPM_CRC32_POLY_REFLECTED) : (crc >> 1);
+        }
+        s_crc32_table[0][n] = crc;
+    }
+
+    for (uint32_t n = 0; n < 256; n++) {
+        crc = s_crc32_table[0][n];
+        for (uint32_t k = 1; k < HPM_CRC32_TABLE_ROWS; k++) {
+            crc = s_crc32_table[0][crc & 0xFF] ^ (crc >> 8);
+            s_crc32_table[k][n] = crc;
+        }
+    }
+    /* generation is idempotent, a concurrent first caller at most regenerates the same table */
+    s_crc32_table_ready = true;
+}
+
+static inline void crc32_table_prepare(void)
+{
+    if (!s_crc32_table_ready) {
+        crc32_table_generate();
+    }
+}
+
+static inline uint32_t crc32_byte(uint32_t crc, uint8_t data)
+{
+    return s_crc32_table[0][(crc ^ data) & 0xFF] ^ (crc >> 8);
+}
+
+uint32_t hpm_crc32_bitwise(uint32_t crc, const uint8_t *buf, uint32_t len)
 {
     uint8_t i;
-    uint32_t crc = 0xFFFFFFFF;
+
     while (len--) {
         crc ^= *buf++;
         for (i = 0; i < 8; ++i) {
             if (crc & 1)
-                crc = (crc >> 1) ^ 0xEDB88320;
+                crc = (crc >> 1) ^ HPM_CRC32_POLY_REFLECTED;
             else
                 crc = (crc >> 1);
         }
     }
 
-    return ~crc;
+    return crc;
+}
+
+uint32_t hpm_crc32_slicing4(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+    const uint32_t *word;
+
+    crc32_table_prepare();
+    while ((len > 0) && (((uintptr_t)buf & 3U) != 0U)) {
+        crc = crc32_byte(crc, *buf++);
+        len--;
+    }
+
+    word = (const uint32_t *)buf;
+    while (len >= 4) {
+        crc ^= *word++;
+        crc = s_crc32_table[3][crc & 0xFF] ^
+              s_crc32_table[2][(crc >> 8) & 0xFF] ^
+              s_crc32_table[1][(crc >> 16) & 0xFF] ^
+              s_crc32_table[0][crc >> 24];
+        len -= 4;
+    }
+
+    buf = (const uint8_t *)word;
+    while (len--) {
+        crc = crc32_byte(crc, *buf++);
+    }
+
+    return crc;
+}
+
+#if HPM_CRC32_SLICING_WIDTH == 8
+uint32_t hpm_crc32_slicing8(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+    const uint32_t *word;
+    uint32_t hi;
+
+    crc32_table_prepare();
+    while ((len > 0) && (((uintptr_t)buf & 3U) != 0U)) {
+        crc = crc32_byte(crc, *buf++);
+        len--;
+    }
+
+    word = (const uint32_t *)buf;
+    while (len >= 8) {
+        crc ^= *word++;
+        hi = *word++;
+        crc = s_crc32_table[7][crc & 0xFF] ^
+              s_crc32_table[6][(crc >> 8) & 0xFF] ^
+              s_crc32_table[5][(crc >> 16) & 0xFF] ^
+              s_crc32_table[4][crc >> 24] ^
+              s_crc32_table[3][hi & 0xFF] ^
+              s_crc32_table[2][(hi >> 8) & 0xFF] ^
+              s_crc32_table[1][(hi >> 16) & 0xFF] ^
+              s_crc32_table[0][hi >> 24];
+        len -= 8;
+    }
+
+    buf = (const uint8_t *)word;
+    while (len--) {
+        crc = crc32_byte(crc, *buf++);
+    }
+
+    return crc;
+}
+#endif
+
+#if HPM_CRC32_HW_ENABLED
+static void crc32_hw_start(void)
+{
+    crc_channel_config_t cfg;
+
+    crc_get_default_channel_config(&cfg);
+    cfg.preset = crc_preset_crc32;
+    cfg.in_byte_order = crc_in_byte_order_lsb;
+    crc_setup_channel_config(HPM_CRC, HPM_CRC32_HW_CHANNEL, &cfg);
+}
+
+uint32_t hpm_crc32_hw(const uint8_t *buf, uint32_t len)
+{
+    crc32_hw_start();
+    crc_calc_large_block_fast(HPM_CRC, HPM_CRC32_HW_CHANNEL, (uint8_t *)buf, len);
+    return crc_get_result(HPM_CRC, HPM_CRC32_HW_CHANNEL);
+}
+#endif
+
+static inline uint32_t crc32_sw_update(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+#if HPM_CRC32_SLICING_WIDTH == 8
+    return hpm_crc32_slicing8(crc, buf, len);
+#elif HPM_CRC32_SLICING_WIDTH == 4
+    return hpm_crc32_slicing4(crc, buf, len);
+#else
+    return hpm_crc32_bitwise(crc, buf, len);
+#endif
+}
+
+void hpm_crc32_init(hpm_crc32_ctx_t *ctx)
+{
+    ctx->crc = HPM_CRC32_INIT_VALUE;
+#if HPM_CRC32_HW_ENABLED
+    crc32_hw_start();
+#endif
+}
+
+void hpm_crc32_update(hpm_crc32_ctx_t *ctx, const uint8_t *buf, uint32_t len)
+{
+#if HPM_CRC32_HW_ENABLED
+    (void)ctx;
+    crc_calc_large_block_fast(HPM_CRC, HPM_CRC32_HW_CHANNEL, (uint8_t *)buf, len);
+#else
+    ctx->crc = crc32_sw_update(ctx->crc, buf, len);
+#endif
+}
+
+uint32_t hpm_crc32_final(hpm_crc32_ctx_t *ctx)
+{
+#if HPM_CRC32_HW_ENABLED
+    ctx->crc = crc_get_result(HPM_CRC, HPM_CRC32_HW_CHANNEL);
+    return ctx->crc;
+#else
+    return ctx->crc ^ HPM_CRC32_XOROUT_VALUE;
+#endif
+}
+
+uint32_t crc32(const uint8_t *buf, uint32_t len)
+{
+#if HPM_CRC32_HW_ENABLED
+    return hpm_crc32_hw(buf, len);
+#else
+    return crc32_sw_update(HPM_CRC32_INIT_VALUE, buf, len) ^ HPM_CRC32_XOROUT_VALUE;
+#endif
 }
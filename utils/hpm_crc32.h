@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 HPMicro
+ * Copyright (c) 2023-2024 HPMicro
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -9,13 +9,109 @@
 #define _HPM_CRC32_H
 
 #include <stdint.h>
+
+/*
+ * CRC-32 (IEEE 802.3, poly 0x04C11DB7 reflected, init 0xFFFFFFFF, xorout 0xFFFFFFFF)
+ *
+ * Software engine selection:
+ *   HPM_CRC32_SLICING_WIDTH = 1: bitwise, no table
+ *   HPM_CRC32_SLICING_WIDTH = 4: slicing-by-4, 4KB table (default)
+ *   HPM_CRC32_SLICING_WIDTH = 8: slicing-by-8, 8KB table
+ *
+ * If HPM_CRC32_USE_HW is set to 1 and the SoC has the CRC peripheral, crc32() and the
+ * hpm_crc32_init/update/final API are backed by CRC channel HPM_CRC32_HW_CHANNEL.
+ */
+#ifndef HPM_CRC32_SLICING_WIDTH
+#define HPM_CRC32_SLICING_WIDTH (4U)
+#endif
+
+#ifndef HPM_CRC32_USE_HW
+#define HPM_CRC32_USE_HW (0)
+#endif
+
+#if HPM_CRC32_USE_HW && defined(HPMSOC_HAS_HPMSDK_CRC)
+#define HPM_CRC32_HW_ENABLED (1)
+#ifndef HPM_CRC32_HW_CHANNEL
+#define HPM_CRC32_HW_CHANNEL (0U)
+#endif
+#else
+#define HPM_CRC32_HW_ENABLED (0)
+#endif
+
+#define HPM_CRC32_INIT_VALUE   (0xFFFFFFFFUL)
+#define HPM_CRC32_XOROUT_VALUE (0xFFFFFFFFUL)
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus  */
 
+/**
+ * @brief incremental crc32 context
+ */
+typedef struct {
+    uint32_t crc;
+} hpm_crc32_ctx_t;
+
+/**
+ * @brief calculate crc32 of a buffer in one shot with the configured engine
+ *
+ * @param buf data buffer
+ * @param len data length in bytes
+ * @return crc32 value
+ */
 uint32_t crc32(const uint8_t *buf, uint32_t len);
 
+/**
+ * @brief start an incremental crc32 calculation
+ *
+ * @note with the hardware engine the CRC channel is owned by ctx until hpm_crc32_final,
+ *       only one hardware stream may be active at a time
+ *
+ * @param ctx context
+ */
+void hpm_crc32_init(hpm_crc32_ctx_t *ctx);
+
+/**
+ * @brief feed data into an incremental crc32 calculation
+ *
+ * @param ctx context
+ * @param buf data buffer
+ * @param len data length in bytes
+ */
+void hpm_crc32_update(hpm_crc32_ctx_t *ctx, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief finish an incremental crc32 calculation
+ *
+ * @param ctx context
+ * @return crc32 value
+ */
+uint32_t hpm_crc32_final(hpm_crc32_ctx_t *ctx);
+
+/*
+ * Raw engines, they work on the un-inverted crc state:
+ *   crc32(buf, len) == ~hpm_crc32_xxx(HPM_CRC32_INIT_VALUE, buf, len)
+ * The bitwise and slicing-by-4 engines are always available, slicing-by-8 only when
+ * HPM_CRC32_SLICING_WIDTH is 8, as it needs the larger table.
+ */
+uint32_t hpm_crc32_bitwise(uint32_t crc, const uint8_t *buf, uint32_t len);
+uint32_t hpm_crc32_slicing4(uint32_t crc, const uint8_t *buf, uint32_t len);
+#if HPM_CRC32_SLICING_WIDTH == 8
+uint32_t hpm_crc32_slicing8(uint32_t crc, const uint8_t *buf, uint32_t len);
+#endif
+
+#if HPM_CRC32_HW_ENABLED
+/**
+ * @brief calculate crc32 of a buffer in one shot on the CRC peripheral
+ *
+ * @param buf data buffer
+ * @param len data length in bytes
+ * @return crc32 value
+ */
+uint32_t hpm_crc32_hw(const uint8_t *buf, uint32_t len);
+#endif
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus  */
-#endif
\ No newline at end of file
+#endif